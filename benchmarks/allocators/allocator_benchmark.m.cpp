@@ -0,0 +1,729 @@
+// allocator_benchmark.m.cpp                                          -*-C++-*-
+
+// This program benchmarks the BDE allocators on the workloads described in
+// the ISO WG21 papers "On Quantifying Memory-Allocation Strategies" (N4468,
+// P0089R0, and P0089R1):
+//
+//: o 'vector-of-vectors': repeatedly build and destroy a vector of vectors of
+//:   integers, each grown element by element (many small, short-lived
+//:   allocations of varying sizes).
+//:
+//: o 'list-of-strings': repeatedly build and destroy a list of strings too
+//:   long for the short string optimization (node-based containers).
+//:
+//: o 'churn': maintain a system of containers, repeatedly replacing randomly
+//:   chosen containers by containers of random sizes, so that the memory of
+//:   the system becomes diffused over the lifetime of the system.
+//
+// Each workload is run against each *allocation strategy* of the table
+// 'STRATEGIES' below, optionally:
+//
+//: o *winking out* the containers: releasing all memory through the
+//:   allocator instead of destroying the containers (only for strategies
+//:   whose allocator supports 'release'), and
+//:
+//: o in several threads, each using either its own ('local') allocator, or a
+//:   single ('shared') allocator (only for thread-safe strategies).
+//
+// The results are written to the standard output, one line per run, in CSV
+// (the default) or JSON Lines format.  New strategies are benchmarked by
+// adding them to 'STRATEGIES'.  Run with '-h' for usage.
+
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_hugepageallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_numaallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+// ============================================================================
+//                           ALLOCATION STRATEGIES
+// ----------------------------------------------------------------------------
+
+                            // ===================
+                            // class StrategyState
+                            // ===================
+
+class StrategyState {
+    // This protocol provides the allocator of an allocation strategy for the
+    // duration of a run.
+
+  public:
+    // CREATORS
+    virtual ~StrategyState();
+        // Destroy this object, and the allocator it provides.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *allocator() = 0;
+        // Return the allocator of this strategy.
+
+    virtual void release();
+        // Release all memory allocated through the allocator of this
+        // strategy.  The behavior is undefined unless the strategy is
+        // managed (see 'Strategy').
+};
+
+                          // =======================
+                          // class NewDeleteStrategy
+                          // =======================
+
+class NewDeleteStrategy : public StrategyState {
+    // This class provides the 'new'/'delete' allocation strategy.
+
+  public:
+    // MANIPULATORS
+    virtual bslma::Allocator *allocator();
+};
+
+                           // =====================
+                           // class ManagedStrategy
+                           // =====================
+
+template <class ALLOCATOR>
+class ManagedStrategy : public StrategyState {
+    // This class template provides the allocation strategy of a managed
+    // allocator of the (template parameter) type 'ALLOCATOR', constructed by
+    // default.
+
+    // DATA
+    ALLOCATOR d_allocator;  // allocator of the strategy
+
+  public:
+    // MANIPULATORS
+    virtual bslma::Allocator *allocator();
+
+    virtual void release();
+};
+
+                         // ========================
+                         // class HugePageSequential
+                         // ========================
+
+class HugePageSequential : public StrategyState {
+    // This class provides the allocation strategy of a sequential allocator
+    // obtaining buffers, of (multiples of) the huge page size, from a huge
+    // page allocator.
+
+    // DATA
+    bdlma::HugePageAllocator   d_hugePage;    // supplies the buffers
+    bdlma::SequentialAllocator d_sequential;  // allocator of the strategy
+
+  public:
+    // CREATORS
+    HugePageSequential();
+        // Create an object providing the strategy.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *allocator();
+
+    virtual void release();
+};
+
+                      // =============================
+                      // class MultipoolOverSequential
+                      // =============================
+
+class MultipoolOverSequential : public StrategyState {
+    // This class provides the allocation strategy of a multipool obtaining
+    // its memory from a sequential allocator ("monotonic + multipool" in
+    // P0089).  Note that, as the multipool obtains its own pools from the
+    // sequential allocator, the multipool is destroyed and re-created when
+    // the sequential allocator is released.
+
+    // DATA
+    bdlma::SequentialAllocator                     d_sequential;
+                                                      // supplies the
+                                                      // multipool
+
+    bsls::ObjectBuffer<bdlma::MultipoolAllocator>  d_multipool;
+                                                      // allocator of the
+                                                      // strategy
+
+  public:
+    // CREATORS
+    MultipoolOverSequential();
+        // Create an object providing the strategy.
+
+    virtual ~MultipoolOverSequential();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual bslma::Allocator *allocator();
+
+    virtual void release();
+};
+
+                            // -------------------
+                            // class StrategyState
+                            // -------------------
+
+// CREATORS
+StrategyState::~StrategyState()
+{
+}
+
+// MANIPULATORS
+void StrategyState::release()
+{
+    BSLS_ASSERT_OPT(!"strategy is not managed");
+}
+
+                          // -----------------------
+                          // class NewDeleteStrategy
+                          // -----------------------
+
+// MANIPULATORS
+bslma::Allocator *NewDeleteStrategy::allocator()
+{
+    return &bslma::NewDeleteAllocator::singleton();
+}
+
+                           // ---------------------
+                           // class ManagedStrategy
+                           // ---------------------
+
+// MANIPULATORS
+template <class ALLOCATOR>
+bslma::Allocator *ManagedStrategy<ALLOCATOR>::allocator()
+{
+    return &d_allocator;
+}
+
+template <class ALLOCATOR>
+void ManagedStrategy<ALLOCATOR>::release()
+{
+    d_allocator.release();
+}
+
+                         // ------------------------
+                         // class HugePageSequential
+                         // ------------------------
+
+// CREATORS
+HugePageSequential::HugePageSequential()
+: d_hugePage()
+, d_sequential(d_hugePage.pageSize(), &d_hugePage)
+{
+}
+
+// MANIPULATORS
+bslma::Allocator *HugePageSequential::allocator()
+{
+    return &d_sequential;
+}
+
+void HugePageSequential::release()
+{
+    d_sequential.release();
+}
+
+                      // -----------------------------
+                      // class MultipoolOverSequential
+                      // -----------------------------
+
+// CREATORS
+MultipoolOverSequential::MultipoolOverSequential()
+: d_sequential()
+{
+    new (d_multipool.buffer()) bdlma::MultipoolAllocator(&d_sequential);
+}
+
+MultipoolOverSequential::~MultipoolOverSequential()
+{
+    d_multipool.object().~MultipoolAllocator();
+}
+
+// MANIPULATORS
+bslma::Allocator *MultipoolOverSequential::allocator()
+{
+    return &d_multipool.object();
+}
+
+void MultipoolOverSequential::release()
+{
+    d_multipool.object().~MultipoolAllocator();
+    d_sequential.release();
+    new (d_multipool.buffer()) bdlma::MultipoolAllocator(&d_sequential);
+}
+
+template <class TYPE>
+StrategyState *createState()
+    // Return a new 'StrategyState' of the (template parameter) 'TYPE'.
+{
+    return new TYPE();
+}
+
+struct Strategy {
+    // This 'struct' describes an allocation strategy.
+
+    const char      *d_name;          // name of the strategy
+    bool             d_isManaged;     // 'true' if supports 'release'
+    bool             d_isThreadSafe;  // 'true' if may be shared by threads
+    StrategyState *(*d_create)();     // create a state of the strategy
+};
+
+const Strategy STRATEGIES[] = {
+    // To benchmark a new allocator, add a line for it here.
+
+    { "newdelete",            false, true,  &createState<NewDeleteStrategy> },
+    { "sequential",           true,  false,
+        &createState<ManagedStrategy<bdlma::SequentialAllocator> > },
+    { "multipool",            true,  false,
+        &createState<ManagedStrategy<bdlma::MultipoolAllocator> > },
+    { "sequential+multipool", true,  false,
+        &createState<MultipoolOverSequential> },
+    { "concurrentmultipool",  true,  true,
+        &createState<ManagedStrategy<bdlma::ConcurrentMultipoolAllocator> > },
+    { "numa",                 true,  true,
+        &createState<ManagedStrategy<bdlma::NumaAllocator> > },
+    { "hugepage+sequential",  true,  false,
+        &createState<HugePageSequential> },
+};
+
+const int NUM_STRATEGIES = sizeof STRATEGIES / sizeof *STRATEGIES;
+
+// ============================================================================
+//                                WORKLOADS
+// ----------------------------------------------------------------------------
+
+class Random {
+    // This class provides a deterministic linear congruential generator of
+    // pseudo-random numbers, so that each run performs the same operations.
+
+    // DATA
+    bsls::Types::Uint64 d_state;  // state of the generator
+
+  public:
+    // CREATORS
+    explicit Random(unsigned seed)
+    : d_state(seed)
+    {
+    }
+
+    // MANIPULATORS
+    int operator()(int limit)
+        // Return a pseudo-random number in the range '[0 .. limit)'.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<int>((d_state >> 33) % limit);
+    }
+};
+
+typedef bsl::vector<bsl::vector<int> > VectorOfVectors;
+typedef bsl::list<bsl::string>         ListOfStrings;
+
+const char LONG_STRING[] = "a string long enough to require an allocation";
+
+void runVectorOfVectors(StrategyState *state, int scale, bool wink)
+    // Build and destroy (or, if the specified 'wink' is 'true', wink out) the
+    // specified 'scale' vectors of vectors using the allocator of the
+    // specified 'state'.
+{
+    bslma::Allocator *allocator = state->allocator();
+
+    for (int i = 0; i < scale; ++i) {
+        VectorOfVectors *outer = new (*allocator) VectorOfVectors(allocator);
+
+        outer->resize(64);
+        for (int j = 0; j < 64; ++j) {
+            bsl::vector<int>& inner = (*outer)[j];
+            for (int k = 0; k < 64 + j; ++k) {
+                inner.push_back(k);
+            }
+        }
+
+        if (wink) {
+            state->release();
+        }
+        else {
+            allocator->deleteObject(outer);
+        }
+    }
+}
+
+void runListOfStrings(StrategyState *state, int scale, bool wink)
+    // Build and destroy (or, if the specified 'wink' is 'true', wink out) the
+    // specified 'scale' lists of strings using the allocator of the specified
+    // 'state'.
+{
+    bslma::Allocator *allocator = state->allocator();
+
+    for (int i = 0; i < scale; ++i) {
+        ListOfStrings *list = new (*allocator) ListOfStrings(allocator);
+
+        for (int j = 0; j < 256; ++j) {
+            list->push_back(bsl::string(LONG_STRING, allocator));
+            list->back().append(j % 32, 'x');
+        }
+
+        if (wink) {
+            state->release();
+        }
+        else {
+            allocator->deleteObject(list);
+        }
+    }
+}
+
+void runChurn(StrategyState *state, int scale, bool wink)
+    // Maintain a system of containers using the allocator of the specified
+    // 'state', replacing randomly chosen containers the specified 'scale'
+    // times 64 times, then destroy (or, if the specified 'wink' is 'true',
+    // wink out) the system.
+{
+    enum { k_NUM_CONTAINERS = 512 };
+
+    bslma::Allocator *allocator = state->allocator();
+
+    typedef bsl::vector<bsl::string> Container;
+    typedef bsl::vector<Container *> System;
+
+    System *system = new (*allocator) System(allocator);
+    system->resize(k_NUM_CONTAINERS);
+
+    Random random(12345);
+
+    for (int i = 0; i < scale * 64 + k_NUM_CONTAINERS; ++i) {
+        Container *& slot = (*system)[i < k_NUM_CONTAINERS
+                                      ? i
+                                      : random(k_NUM_CONTAINERS)];
+        if (slot) {
+            allocator->deleteObject(slot);
+        }
+        slot = new (*allocator) Container(allocator);
+
+        const int size = 1 + random(32);
+        for (int j = 0; j < size; ++j) {
+            slot->push_back(bsl::string(LONG_STRING, allocator));
+        }
+    }
+
+    if (wink) {
+        state->release();
+    }
+    else {
+        for (int i = 0; i < k_NUM_CONTAINERS; ++i) {
+            allocator->deleteObject((*system)[i]);
+        }
+        allocator->deleteObject(system);
+    }
+}
+
+struct Workload {
+    // This 'struct' describes a workload.
+
+    const char *d_name;                              // name of the workload
+    void      (*d_run)(StrategyState *, int, bool);  // run the workload
+};
+
+const Workload WORKLOADS[] = {
+    { "vector-of-vectors", &runVectorOfVectors },
+    { "list-of-strings",   &runListOfStrings   },
+    { "churn",             &runChurn           },
+};
+
+const int NUM_WORKLOADS = sizeof WORKLOADS / sizeof *WORKLOADS;
+
+// ============================================================================
+//                                  RUNS
+// ----------------------------------------------------------------------------
+
+struct Run {
+    // This 'struct' describes a run of a workload against a strategy.
+
+    const Workload *d_workload_p;   // workload to run
+    const Strategy *d_strategy_p;   // strategy to run against
+    bool            d_shared;       // 'true' if threads share an allocator
+    bool            d_wink;         // 'true' if containers are winked out
+    int             d_numThreads;   // number of threads running the workload
+    int             d_scale;        // number of repetitions of the workload
+};
+
+struct ThreadArgs {
+    // This 'struct' provides the arguments of a thread of a run.
+
+    const Run      *d_run_p;        // run performed
+    StrategyState  *d_shared_p;     // shared strategy state, or 0
+    bslmt::Barrier *d_barrier_p;    // starts the threads together
+};
+
+extern "C" void *runThread(void *arg)
+    // Run the workload of the 'ThreadArgs' at the specified 'arg' against its
+    // strategy, using the shared state of the strategy if any, and a new
+    // state otherwise.
+{
+    const ThreadArgs& args = *static_cast<ThreadArgs *>(arg);
+    const Run&        run  = *args.d_run_p;
+
+    args.d_barrier_p->wait();
+
+    StrategyState *state = args.d_shared_p
+                         ? args.d_shared_p
+                         : run.d_strategy_p->d_create();
+
+    run.d_workload_p->d_run(state, run.d_scale, run.d_wink);
+
+    if (!args.d_shared_p) {
+        delete state;
+    }
+    return 0;
+}
+
+double execute(const Run& run)
+    // Perform the specified 'run', and return its duration (in seconds), or
+    // a negative value if a thread could not be created.
+{
+    StrategyState *shared = run.d_shared ? run.d_strategy_p->d_create() : 0;
+
+    bslmt::Barrier                         barrier(run.d_numThreads + 1);
+    bsl::vector<ThreadArgs>                args(run.d_numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(run.d_numThreads);
+
+    for (int i = 0; i < run.d_numThreads; ++i) {
+        args[i].d_run_p     = &run;
+        args[i].d_shared_p  = shared;
+        args[i].d_barrier_p = &barrier;
+        if (0 != bslmt::ThreadUtil::create(&handles[i],
+                                           runThread,
+                                           &args[i])) {
+            bsl::cerr << "Error: cannot create thread." << bsl::endl;
+            bsl::exit(1);
+        }
+    }
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start(false);
+    barrier.wait();
+
+    for (int i = 0; i < run.d_numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    stopwatch.stop();
+
+    delete shared;
+
+    return stopwatch.accumulatedWallTime();
+}
+
+// ============================================================================
+//                                 OUTPUT
+// ----------------------------------------------------------------------------
+
+void printHeader(bool json)
+    // Print the header of the results, in JSON Lines format if the specified
+    // 'json' is 'true', and in CSV format otherwise.
+{
+    if (!json) {
+        bsl::cout << "workload,allocator,mode,wink,threads,scale,seconds"
+                  << bsl::endl;
+    }
+}
+
+void printResult(const Run& run, double seconds, bool json)
+    // Print the result of the specified 'run', of the specified 'seconds', in
+    // JSON Lines format if the specified 'json' is 'true', and in CSV format
+    // otherwise.
+{
+    const char *mode = run.d_shared ? "shared" : "local";
+
+    if (json) {
+        bsl::cout << "{\"workload\":\"" << run.d_workload_p->d_name << "\","
+                  << "\"allocator\":\"" << run.d_strategy_p->d_name << "\","
+                  << "\"mode\":\"" << mode << "\","
+                  << "\"wink\":" << (run.d_wink ? "true" : "false") << ","
+                  << "\"threads\":" << run.d_numThreads << ","
+                  << "\"scale\":" << run.d_scale << ","
+                  << "\"seconds\":" << seconds << "}" << bsl::endl;
+    }
+    else {
+        bsl::cout << run.d_workload_p->d_name << ","
+                  << run.d_strategy_p->d_name << ","
+                  << mode << ","
+                  << (run.d_wink ? 1 : 0) << ","
+                  << run.d_numThreads << ","
+                  << run.d_scale << ","
+                  << seconds << bsl::endl;
+    }
+}
+
+void usage(const char *program)
+    // Print the usage of the specified 'program' to the standard error.
+{
+    bsl::cerr
+        << "usage: " << program << " [options]\n"
+        << "  -w <workload>   run only <workload> (repeatable)\n"
+        << "  -a <allocator>  run only <allocator> (repeatable)\n"
+        << "  -t <threads>    number of threads (default: 1)\n"
+        << "  -s <scale>      repetitions of each workload (default: 1000)\n"
+        << "  -m <mode>       'local', 'shared', or 'both' (default: both)\n"
+        << "  -j              write JSON Lines instead of CSV\n"
+        << "  -l              list the workloads and allocators\n"
+        << "  -h              print this message\n";
+}
+
+bool isSelected(const bsl::vector<bsl::string>& selection, const char *name)
+    // Return 'true' if the specified 'selection' is empty or contains the
+    // specified 'name', and 'false' otherwise.
+{
+    if (selection.empty()) {
+        return true;                                                  // RETURN
+    }
+    for (bsl::size_t i = 0; i < selection.size(); ++i) {
+        if (selection[i] == name) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    bsl::vector<bsl::string> workloads;
+    bsl::vector<bsl::string> allocators;
+    int                      numThreads = 1;
+    int                      scale      = 1000;
+    bsl::string              mode("both");
+    bool                     json       = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *option = argv[i];
+        const char *value  = i + 1 < argc ? argv[i + 1] : 0;
+
+        if (0 == bsl::strcmp(option, "-j")) {
+            json = true;
+        }
+        else if (0 == bsl::strcmp(option, "-l")) {
+            for (int j = 0; j < NUM_WORKLOADS; ++j) {
+                bsl::cout << "workload  " << WORKLOADS[j].d_name << "\n";
+            }
+            for (int j = 0; j < NUM_STRATEGIES; ++j) {
+                bsl::cout << "allocator " << STRATEGIES[j].d_name
+                          << (STRATEGIES[j].d_isManaged ? " managed" : "")
+                          << (STRATEGIES[j].d_isThreadSafe
+                              ? " thread-safe"
+                              : "")
+                          << "\n";
+            }
+            return 0;                                                 // RETURN
+        }
+        else if (value && 0 == bsl::strcmp(option, "-w")) {
+            workloads.push_back(value);
+            ++i;
+        }
+        else if (value && 0 == bsl::strcmp(option, "-a")) {
+            allocators.push_back(value);
+            ++i;
+        }
+        else if (value && 0 == bsl::strcmp(option, "-t")) {
+            numThreads = bsl::atoi(value);
+            ++i;
+        }
+        else if (value && 0 == bsl::strcmp(option, "-s")) {
+            scale = bsl::atoi(value);
+            ++i;
+        }
+        else if (value && 0 == bsl::strcmp(option, "-m")) {
+            mode = value;
+            ++i;
+        }
+        else {
+            usage(argv[0]);
+            return 0 == bsl::strcmp(option, "-h") ? 0 : 1;            // RETURN
+        }
+    }
+
+    if (numThreads < 1 || scale < 1
+     || (mode != "local" && mode != "shared" && mode != "both")) {
+        usage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    printHeader(json);
+
+    for (int w = 0; w < NUM_WORKLOADS; ++w) {
+        if (!isSelected(workloads, WORKLOADS[w].d_name)) {
+            continue;
+        }
+        for (int s = 0; s < NUM_STRATEGIES; ++s) {
+            const Strategy& strategy = STRATEGIES[s];
+
+            if (!isSelected(allocators, strategy.d_name)) {
+                continue;
+            }
+            for (int shared = 0; shared < 2; ++shared) {
+                // Sharing an allocator is meaningful only for several
+                // threads, and possible only for thread-safe allocators.
+
+                if (shared ? mode == "local"
+                                 || 1 == numThreads
+                                 || !strategy.d_isThreadSafe
+                           : mode == "shared" && 1 != numThreads) {
+                    continue;
+                }
+                for (int wink = 0; wink < 2; ++wink) {
+                    // A shared allocator cannot be released while other
+                    // threads use it.
+
+                    if (wink && (!strategy.d_isManaged || shared)) {
+                        continue;
+                    }
+
+                    Run run;
+                    run.d_workload_p = &WORKLOADS[w];
+                    run.d_strategy_p = &strategy;
+                    run.d_shared     = shared;
+                    run.d_wink       = wink;
+                    run.d_numThreads = numThreads;
+                    run.d_scale      = scale;
+
+                    printResult(run, execute(run), json);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -695,21 +695,24 @@ int Decoder::decodeImp(TYPE *value,
         return -1;                                                    // RETURN
     }
 
-    // This used to be 'BUF_SIZE' but that caused a #define conflict.
+    // This used to be 'BUF_SIZE' but that caused a #define conflict.  The
+    // enumerator is copied into the buffer only if it must be unescaped.
 
     const int                                     BAL_BUF_SIZE = 128;
     bdlma::LocalSequentialAllocator<BAL_BUF_SIZE> bufferAllocator;
-    bsl::string                                   tmpString(&bufferAllocator);
+    bslstl::StringRef                             enumString;
 
-    rc = baljsn::ParserUtil::getValue(&tmpString, dataValue);
+    rc = baljsn::ParserUtil::getStringRef(&enumString,
+                                          dataValue,
+                                          &bufferAllocator);
     if (rc) {
         d_logStream << "Error reading enumeration value\n";
         return -1;                                                    // RETURN
     }
 
     rc = bdlat_EnumFunctions::fromString(value,
-                                         tmpString.data(),
-                                         static_cast<int>(tmpString.size()));
+                                         enumString.data(),
+                                         static_cast<int>(enumString.size()));
 
     if (rc) {
         d_logStream << "Could not decode Enum String, value not allowed \""
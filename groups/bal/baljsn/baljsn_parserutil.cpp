@@ -133,27 +133,29 @@ static const bsls::Types::Uint64 UINT64_MAX_DIVIDED_BY_10_TO_THE_10 =
                                              UINT64_MAX_VALUE / 10000000000ULL;
 static const bsls::Types::Uint64 UINT64_MAX_VALUE_LAST_DIGIT = 5;
 
-}  // close unnamed namespace
-
-namespace baljsn {
-
-                             // -----------------
-                             // struct ParserUtil
-                             // -----------------
-
-// CLASS METHODS
-int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
+const char *findQuoteOrBackslash(const char *iter, const char *end)
+    // Return the address of the first '"' or '\\' in the specified range
+    // '[iter, end)', or 'end' if there is none.
 {
-    const char *iter = data.begin();
-    const char *end  = data.end();
-
-    if (iter == end || '"' != *iter) {
-        return -1;                                                    // RETURN
+    while (iter < end && '"' != *iter && '\\' != *iter) {
+        ++iter;
     }
+    return iter;
+}
 
-    value->clear();
+int unescapeString(char **output, const char **position, const char *end)
+    // Write, to the buffer at the specified '*output', the unescaped
+    // characters of the JSON string literal in the range '[*position, end)'
+    // up to its closing '"', advancing '*output' past each character written.
+    // Return 0, and load the address of the closing quote into '*position',
+    // if the closing quote is reached, and a non-zero value if an invalid
+    // escape sequence or the end of the range is reached first.  The behavior
+    // is undefined unless the buffer at '*output' has room for
+    // 'end - *position' characters.  Note that no escape sequence decodes to
+    // more characters than it contains, so '*output' may be '*position'.
+{
+    const char *iter = *position;
 
-    ++iter;
     while (iter < end) {
         if ('\\' == *iter) {
             ++iter;
@@ -163,19 +165,19 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
 
             switch (*iter) {
               case 'b': {
-                *value += '\b';
+                *(*output)++ = '\b';
               } break;
               case 'f': {
-                *value += '\f';
+                *(*output)++ = '\f';
               } break;
               case 'n': {
-                *value += '\n';
+                *(*output)++ = '\n';
               } break;
               case 'r': {
-                *value += '\r';
+                *(*output)++ = '\r';
               } break;
               case 't': {
-                *value += '\t';
+                *(*output)++ = '\t';
               } break;
               case '"'  : BSLS_ANNOTATION_FALLTHROUGH;
               case '\\' : BSLS_ANNOTATION_FALLTHROUGH;
@@ -183,7 +185,7 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
 
                 // printable characters
 
-                *value += *iter;
+                *(*output)++ = *iter;
               } break;
               case 'u':
               case 'U': {
@@ -271,7 +273,8 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
                     return rc;                                        // RETURN
                 }
 
-                value->append(utf8String);
+                bsl::memcpy(*output, utf8String.data(), utf8String.length());
+                *output += utf8String.length();
 
                 iter += increment;
               } break;
@@ -281,10 +284,11 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
             }
         }
         else if ('"' == *iter) {
+            *position = iter;
             return 0;                                                 // RETURN
         }
         else {
-            *value += *iter;
+            *(*output)++ = *iter;
         }
         ++iter;
     }
@@ -292,6 +296,106 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
     return -1;
 }
 
+}  // close unnamed namespace
+
+namespace baljsn {
+
+                             // -----------------
+                             // struct ParserUtil
+                             // -----------------
+
+// CLASS METHODS
+int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
+{
+    const char *iter = data.begin();
+    const char *end  = data.end();
+
+    if (iter == end || '"' != *iter) {
+        return -1;                                                    // RETURN
+    }
+
+    ++iter;
+
+    // Most strings have no escape sequences, and are copied in one step.
+
+    const char *special = findQuoteOrBackslash(iter, end);
+    if (special == end || '"' == *special) {
+        value->assign(iter, special);
+        return special == end ? -1 : 0;                               // RETURN
+    }
+
+    value->resize(end - iter);
+
+    char      *output = &(*value)[0];
+    const int  rc     = unescapeString(&output, &iter, end);
+
+    value->resize(output - value->data());
+    return rc;
+}
+
+int ParserUtil::getStringRef(bslstl::StringRef *value,
+                             bslstl::StringRef  data,
+                             bslma::Allocator  *arena)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(arena);
+
+    const char *iter = data.begin();
+    const char *end  = data.end();
+
+    if (iter == end || '"' != *iter) {
+        return -1;                                                    // RETURN
+    }
+
+    ++iter;
+
+    const char *special = findQuoteOrBackslash(iter, end);
+    if (special == end || '"' == *special) {
+        value->assign(iter, special);
+        return special == end ? -1 : 0;                               // RETURN
+    }
+
+    char      *buffer = static_cast<char *>(arena->allocate(end - iter));
+    char      *output = buffer;
+    const int  rc     = unescapeString(&output, &iter, end);
+
+    value->assign(buffer, output);
+    return rc;
+}
+
+int ParserUtil::getUnquotedStringRef(bslstl::StringRef *value,
+                                     bslstl::StringRef  data,
+                                     bslma::Allocator  *arena)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(arena);
+
+    const char *special = findQuoteOrBackslash(data.begin(), data.end());
+    if (special == data.end()) {
+        value->assign(data.begin(), data.end());
+        return 0;                                                     // RETURN
+    }
+
+    // Copy the body, followed by a closing quote, to the arena, and unescape
+    // it in place.
+
+    const bsl::size_t  length = data.length();
+    char              *buffer =
+                          static_cast<char *>(arena->allocate(length + 1));
+    bsl::memcpy(buffer, data.data(), length);
+    buffer[length] = '"';
+
+    const char *iter   = buffer;
+    char       *output = buffer;
+    const int   rc     = unescapeString(&output, &iter, buffer + length + 1);
+
+    value->assign(buffer, output);
+
+    // A quote before the end of the body is not escaped.
+
+    return 0 == rc && buffer + length == iter ? 0 : -1;
+}
+
 int ParserUtil::getValue(bdldfp::Decimal64 *value,
                          bslstl::StringRef data)
 {
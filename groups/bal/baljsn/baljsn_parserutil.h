@@ -22,6 +22,13 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this utility
 // in the package documentation file (doc/baljsn.txt).
 //
+// In addition, 'getStringRef' (and 'getUnquotedStringRef', given the body of
+// the literal without its quotes) decodes a JSON string literal without
+// copying it when possible: a reference to the characters of the input is
+// returned for strings having no escape sequences, and only strings that must
+// be unescaped are materialized, into memory supplied by a caller-specified
+// arena allocator.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -70,6 +77,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlt_iso8601util.h>
 
+#include <bslma_allocator.h>
+
 #include <bsl_limits.h>
 #include <bsl_cstring.h>
 #include <bsl_string.h>
@@ -153,6 +162,34 @@ struct ParserUtil {
         // Load into the specified 'value' the characters read from the
         // specified 'data'.  Return 0 on success or a non-zero value on
         // failure.
+
+    static int getStringRef(bslstl::StringRef *value,
+                            bslstl::StringRef  data,
+                            bslma::Allocator  *arena);
+        // Load into the specified 'value' a reference to the string value in
+        // the specified 'data', a JSON string literal including its enclosing
+        // quotes.  If 'data' contains no escape sequences, 'value' refers to
+        // the characters of 'data' and no memory is allocated; otherwise the
+        // unescaped characters are written to memory obtained from the
+        // specified 'arena', and 'value' refers to that memory.  Return 0 on
+        // success or a non-zero value on failure, in which case 'value' is
+        // unspecified.  Note that memory obtained from 'arena' is never
+        // deallocated by this function, so 'arena' is typically a sequential
+        // allocator whose memory is released all at once.
+
+    static int getUnquotedStringRef(bslstl::StringRef *value,
+                                    bslstl::StringRef  data,
+                                    bslma::Allocator  *arena);
+        // Load into the specified 'value' a reference to the string value in
+        // the specified 'data', the characters of a JSON string literal
+        // *excluding* its enclosing quotes.  If 'data' contains no escape
+        // sequences, 'value' refers to the characters of 'data' and no memory
+        // is allocated; otherwise the unescaped characters are written to
+        // memory obtained from the specified 'arena', and 'value' refers to
+        // that memory.  Return 0 on success or a non-zero value on failure
+        // (including if 'data' contains an unescaped '"'), in which case
+        // 'value' is unspecified.  Note that memory obtained from 'arena' is
+        // never deallocated by this function.
 };
 
 // ============================================================================
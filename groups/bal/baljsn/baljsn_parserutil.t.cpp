@@ -76,9 +76,11 @@ using bsl::endl;
 // [19] static int getValue(bdlt::DatetimeTz    *v, bslstl::StringRef s);
 // [20] static int getValue(vector<char>        *v, bslstl::StringRef s);
 // [21] static int getValue(bdldfp::Decimal64   *v, bslstl::StringRef s);
+// [22] static int getStringRef(StringRef *v, StringRef s, Allocator *a);
+// [22] static int getUnquotedStringRef(StringRef *, StringRef, Alloc *);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [22] USAGE EXAMPLE
+// [23] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -172,7 +174,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 22: {
+      case 23: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -238,6 +240,189 @@ int main(int argc, char *argv[])
     ASSERT(21                      == employee.d_age);
 //..
       } break;
+      case 22: {
+        // --------------------------------------------------------------------
+        // TESTING 'getStringRef' AND 'getUnquotedStringRef'
+        //
+        // Concerns:
+        //: 1 A string without escape sequences is returned as a reference to
+        //:   the characters of the input, and no memory is allocated.
+        //:
+        //: 2 A string with escape sequences is unescaped into memory supplied
+        //:   by the arena, in a single allocation.
+        //:
+        //: 3 The value and the return code agree with those of 'getValue'
+        //:   for 'bsl::string' on valid input, and the return code agrees on
+        //:   invalid input.
+        //:
+        //: 4 'getUnquotedStringRef', given the characters between the quotes
+        //:   of a literal, behaves as 'getStringRef' given the literal, and
+        //:   fails for an unescaped quote.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of JSON string
+        //:   literals, valid and invalid, with and without escape sequences.
+        //:
+        //: 2 For each row in the table of P-1, invoke 'getStringRef' with a
+        //:   test allocator as the arena and verify that the return code and,
+        //:   on success, the value match those of 'getValue' for a
+        //:   'bsl::string'.  If the literal has no backslash, verify that the
+        //:   value refers into the input and the arena was not used;
+        //:   otherwise verify that the arena allocated exactly one block and
+        //:   that the value refers into it.  (C-1..3)
+        //:
+        //: 3 For each row in the table of P-1 whose input is enclosed in
+        //:   quotes, invoke 'getUnquotedStringRef' with the characters
+        //:   between the quotes, and verify that the results match those of
+        //:   'getStringRef'.  Verify that a body having an unescaped quote is
+        //:   rejected.  (C-4)
+        //
+        // Testing:
+        //   static int getStringRef(StringRef *v, StringRef s, Allocator *a);
+        //   static int getUnquotedStringRef(StringRef *, StringRef, Alloc *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                      << endl
+                      << "TESTING 'getStringRef' AND 'getUnquotedStringRef'"
+                      << endl
+                      << "================================================="
+                      << endl;
+
+        static const struct {
+            int         d_line;     // line number
+            const char *d_input_p;  // input literal
+        } DATA[] = {
+            //LINE  INPUT
+            //----  ----------------------------------------
+            { L_,   "\"\""                               },
+            { L_,   "\"ABC\""                            },
+            { L_,   "\"A B C 0 1 2 / \xC3\xA9\""         },
+            { L_,   "\"ABC\" trailing"                   },
+            { L_,   "\"\\\"\""                           },
+            { L_,   "\"\\\\\""                           },
+            { L_,   "\"a\\bc\\fd\\ne\\rf\\tg\\/h\""      },
+            { L_,   "\"\\u0041\\U00e9\\u2710\""          },
+            { L_,   "\"\\ud83d\\ude42!\""                },
+            { L_,   "\"prefix \\\"quoted\\\" suffix\""   },
+
+            { L_,   ""                                   },
+            { L_,   "ABC"                                },
+            { L_,   "\""                                 },
+            { L_,   "\"ABC"                              },
+            { L_,   "\"AB\\"                             },
+            { L_,   "\"\\x\""                            },
+            { L_,   "\"\\U7G00\""                        },
+            { L_,   "\"\\ud83d\""                        },
+            { L_,   "\"\\ud83d\\ude4\""                  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE  = DATA[ti].d_line;
+            const StringRef INPUT(DATA[ti].d_input_p);
+
+            bsl::string EXP;
+            const int   EXP_RC = Util::getValue(&EXP, INPUT);
+
+            bslma::TestAllocator arena("arena", veryVeryVerbose);
+
+            StringRef value;
+            const int rc = Util::getStringRef(&value, INPUT, &arena);
+
+            if (veryVerbose) {
+                P_(LINE) P_(INPUT) P_(rc) P(value)
+            }
+
+            ASSERTV(LINE, EXP_RC, rc, !EXP_RC == !rc);
+
+            if (0 == rc) {
+                ASSERTV(LINE, EXP, value, EXP == value);
+
+                if (0 == bsl::memchr(INPUT.data(), '\\', INPUT.length())) {
+                    ASSERTV(LINE, 0 == arena.numBlocksTotal());
+                    ASSERTV(LINE, INPUT.begin() + 1 == value.begin());
+                }
+                else {
+                    ASSERTV(LINE, arena.numBlocksTotal(),
+                            1 == arena.numBlocksTotal());
+
+                    const char *block = static_cast<const char *>(
+                                                 arena.lastAllocatedAddress());
+                    ASSERTV(LINE, block == value.begin());
+                }
+            }
+
+            // 'getStringRef' leaves the release of arena memory to the
+            // caller.
+
+            if (arena.numBlocksInUse()) {
+                arena.deallocate(arena.lastAllocatedAddress());
+            }
+
+            if (INPUT.length() < 2
+             || '"' != INPUT[0]
+             || '"' != INPUT[INPUT.length() - 1]) {
+                continue;
+            }
+
+            const StringRef BODY(INPUT.begin() + 1, INPUT.end() - 1);
+
+            StringRef unquoted;
+            const int unquotedRc = Util::getUnquotedStringRef(&unquoted,
+                                                              BODY,
+                                                              &arena);
+
+            ASSERTV(LINE, rc, unquotedRc, !rc == !unquotedRc);
+
+            if (0 == unquotedRc) {
+                ASSERTV(LINE, EXP, unquoted, EXP == unquoted);
+
+                if (0 == bsl::memchr(BODY.data(), '\\', BODY.length())) {
+                    ASSERTV(LINE, 0 == arena.numBlocksInUse());
+                    ASSERTV(LINE, BODY.begin() == unquoted.begin());
+                }
+            }
+
+            if (arena.numBlocksInUse()) {
+                arena.deallocate(arena.lastAllocatedAddress());
+            }
+        }
+
+        if (verbose) cout << "\tUnescaped quote in an unquoted body." << endl;
+        {
+            static const struct {
+                int         d_line;     // line number
+                const char *d_body_p;   // body of a literal
+                int         d_valid;    // 1 if the body is valid
+            } DATA[] = {
+                //LINE  BODY           VALID
+                //----  -------------  -----
+                { L_,   "a\"b",        0     },
+                { L_,   "a\\\"b\"",    0     },
+                { L_,   "\"",          0     },
+                { L_,   "a\\\"b",      1     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int  LINE  = DATA[ti].d_line;
+                const bool VALID = DATA[ti].d_valid;
+
+                bslma::TestAllocator arena("arena", veryVeryVerbose);
+
+                StringRef value;
+                const int rc = Util::getUnquotedStringRef(&value,
+                                                          DATA[ti].d_body_p,
+                                                          &arena);
+                ASSERTV(LINE, rc, VALID == (0 == rc));
+
+                if (arena.numBlocksInUse()) {
+                    arena.deallocate(arena.lastAllocatedAddress());
+                }
+            }
+        }
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // TESTING 'getValue' for Decimal64 values
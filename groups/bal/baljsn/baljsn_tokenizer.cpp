@@ -4,15 +4,26 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <baljsn_parserutil.h>                 // for testing only
+#include <baljsn_parserutil.h>
 
+#include <bdlb_bitutil.h>
 #include <bdlb_chartype.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2) &&                                        \
+   (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+#define U_SSE2
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -53,6 +64,19 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+///Structural Index
+///- - - - - - - -
+// When the 'useStructuralIndex' option is set, every time characters are
+// loaded into the string buffer they are classified, 'k_INDEX_BLOCK_SIZE' (64)
+// at a time, into one bitmap per 'IndexKind', bit 'i' of a bitmap describing
+// character 'i' of the block.  The scanning functions then find the next
+// interesting character with a count of trailing zero bits rather than a
+// character-by-character loop.  'extractStringValue' stops at every quote and
+// backslash, so that escapes are processed exactly as in the
+// character-by-character scan; the characters skipped between two stops are
+// neither quotes nor backslashes, which is all the escape processing needs to
+// know about them.
 
 namespace BloombergLP {
 namespace {
@@ -60,6 +84,106 @@ namespace {
     static const char *WHITESPACE = " \n\t\v\f\r";
     static const char *TOKENS     = "{}[]:,";
 
+typedef bsls::Types::Uint64 Uint64;
+
+void classifyBlock(Uint64      *nonWhitespace,
+                   Uint64      *stringSpecial,
+                   Uint64      *valueEnd,
+                   const char  *data,
+                   bsl::size_t  length)
+    // Load into the specified 'nonWhitespace', 'stringSpecial', and
+    // 'valueEnd' bitmaps the positions, among the specified 'length'
+    // characters at the specified 'data', of the characters that are not
+    // whitespace, that are quotes or backslashes, and that are whitespace,
+    // tokens, or null characters, respectively.  Bits at positions 'length'
+    // and above are cleared.
+    // The behavior is undefined unless '0 < length <= 64'.
+{
+    Uint64 space   = 0;
+    Uint64 special = 0;
+    Uint64 token   = 0;
+
+#if defined(U_SSE2)
+    if (64 == length) {
+        const __m128i tab     = _mm_set1_epi8('\t');
+        const __m128i four    = _mm_set1_epi8(4);
+        const __m128i blank   = _mm_set1_epi8(' ');
+        const __m128i quote   = _mm_set1_epi8('"');
+        const __m128i escape  = _mm_set1_epi8('\\');
+        const __m128i lower   = _mm_set1_epi8(0x20);
+        const __m128i lbrace  = _mm_set1_epi8('{');
+        const __m128i rbrace  = _mm_set1_epi8('}');
+        const __m128i colon   = _mm_set1_epi8(':');
+        const __m128i comma   = _mm_set1_epi8(',');
+        const __m128i nul     = _mm_setzero_si128();
+
+        for (int i = 0; i < 4; ++i) {
+            const __m128i chars = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(data + 16 * i));
+
+            // '\t', '\n', '\v', '\f', and '\r' are contiguous, so one
+            // unsigned range check identifies them.  Setting bit 5 maps '['
+            // and ']' onto '{' and '}', and no other character onto either.
+
+            const __m128i offset = _mm_sub_epi8(chars, tab);
+            const __m128i isSpace = _mm_or_si128(
+                      _mm_cmpeq_epi8(_mm_min_epu8(offset, four), offset),
+                      _mm_cmpeq_epi8(chars, blank));
+            const __m128i isSpecial = _mm_or_si128(
+                                               _mm_cmpeq_epi8(chars, quote),
+                                               _mm_cmpeq_epi8(chars, escape));
+            const __m128i folded  = _mm_or_si128(chars, lower);
+            const __m128i isToken = _mm_or_si128(
+                         _mm_or_si128(_mm_cmpeq_epi8(folded, lbrace),
+                                      _mm_cmpeq_epi8(folded, rbrace)),
+                         _mm_or_si128(
+                                  _mm_or_si128(_mm_cmpeq_epi8(chars, colon),
+                                               _mm_cmpeq_epi8(chars, comma)),
+                                  _mm_cmpeq_epi8(chars, nul)));
+
+            const int shift = 16 * i;
+            space   |= static_cast<Uint64>(_mm_movemask_epi8(isSpace))
+                                                                      << shift;
+            special |= static_cast<Uint64>(_mm_movemask_epi8(isSpecial))
+                                                                      << shift;
+            token   |= static_cast<Uint64>(_mm_movemask_epi8(isToken))
+                                                                      << shift;
+        }
+
+        *nonWhitespace = ~space;
+        *stringSpecial = special;
+        *valueEnd      = space | token;
+        return;                                                       // RETURN
+    }
+#endif
+
+    for (bsl::size_t i = 0; i < length; ++i) {
+        const char   ch  = data[i];
+        const Uint64 bit = static_cast<Uint64>(1) << i;
+
+        if (' ' == ch || ('\t' <= ch && ch <= '\r')) {
+            space |= bit;
+        }
+        else if ('"' == ch || '\\' == ch) {
+            special |= bit;
+        }
+        else if (bsl::strchr(TOKENS, ch)) {
+            // Note that, as in the character-by-character scan, the null
+            // character matches the terminator of 'TOKENS'.
+
+            token |= bit;
+        }
+    }
+
+    const Uint64 mask = 64 == length
+                      ? ~static_cast<Uint64>(0)
+                      : (static_cast<Uint64>(1) << length) - 1;
+
+    *nonWhitespace = ~space & mask;
+    *stringSpecial = special;
+    *valueEnd      = space | token;
+}
+
 }  // close unnamed namespace
 
 namespace baljsn {
@@ -69,6 +193,31 @@ namespace baljsn {
                               // ----------------
 
 // PRIVATE MANIPULATORS
+void Tokenizer::indexStringBuffer(bsl::size_t position)
+{
+    const bsl::size_t length     = d_stringBuffer.length();
+    const bsl::size_t numBlocks  = (length + k_INDEX_BLOCK_SIZE - 1)
+                                                         / k_INDEX_BLOCK_SIZE;
+    const char       *data       = d_stringBuffer.data();
+
+    d_structuralIndex.resize(numBlocks * k_NUM_INDEX_KINDS);
+
+    for (bsl::size_t block = position / k_INDEX_BLOCK_SIZE;
+         block < numBlocks;
+         ++block) {
+        const bsl::size_t  begin = block * k_INDEX_BLOCK_SIZE;
+        Uint64            *bits  = &d_structuralIndex[block
+                                                         * k_NUM_INDEX_KINDS];
+
+        classifyBlock(bits + e_NON_WHITESPACE,
+                      bits + e_STRING_SPECIAL,
+                      bits + e_VALUE_END,
+                      data + begin,
+                      bsl::min<bsl::size_t>(k_INDEX_BLOCK_SIZE,
+                                            length - begin));
+    }
+}
+
 int Tokenizer::reloadStringBuffer()
 {
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -108,6 +257,10 @@ int Tokenizer::reloadStringBuffer()
     d_readOffset += numRead;
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+
+    if (d_useStructuralIndex) {
+        indexStringBuffer(0);
+    }
     return static_cast<int>(numRead);
 }
 
@@ -149,6 +302,10 @@ int Tokenizer::expandBufferForLargeValue()
 
     d_readOffset += numRead;
     d_stringBuffer.resize(currLength + numRead);
+
+    if (d_useStructuralIndex) {
+        indexStringBuffer(currLength);
+    }
     return numRead ? 0 : -1;
 }
 
@@ -196,6 +353,9 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
     d_readOffset += numRead;
     d_stringBuffer.resize(d_valueIter + numRead);
 
+    if (d_useStructuralIndex) {
+        indexStringBuffer(0);
+    }
     return static_cast<int>(numRead);
 }
 
@@ -205,8 +365,23 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        while (d_valueIter < d_stringBuffer.length()) {
+            if (d_useStructuralIndex) {
+                const bsl::size_t next = nextIndexed(e_STRING_SPECIAL,
+                                                     d_valueIter);
+                if (next != d_valueIter) {
+                    // Skip to the next quote or backslash.  The skipped
+                    // characters are neither.
+
+                    previousChar = 0;
+                    d_valueIter  = next;
+                    continue;
+                }
+            }
+
+            if ('"' == d_stringBuffer[d_valueIter]) {
+                break;
+            }
 
             if ('\\' == d_stringBuffer[d_valueIter]
              && '\\' == previousChar) {
@@ -266,10 +441,15 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
+        if (d_useStructuralIndex) {
+            d_valueIter = nextIndexed(e_VALUE_END, d_valueIter);
+        }
+        else {
+            while (d_valueIter < d_stringBuffer.length()
+                && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
+                && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
+                ++d_valueIter;
+            }
         }
 
         if (d_valueIter >= d_stringBuffer.length()) {
@@ -310,9 +490,11 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
+        const bsl::size_t pos = d_useStructuralIndex
+                              ? nextIndexed(e_NON_WHITESPACE, d_cursor)
+                              : d_stringBuffer.find_first_not_of(WHITESPACE,
+                                                                 d_cursor);
+        if (pos < d_stringBuffer.length()) {
             d_cursor = pos;
             break;
         }
@@ -688,7 +870,69 @@ int Tokenizer::resetStreamBufGetPointer()
     return newPos >= 0 ? 0 : -1;
 }
 
+// PRIVATE ACCESSORS
+bsl::size_t Tokenizer::nextIndexed(IndexKind kind, bsl::size_t position) const
+{
+    const bsl::size_t length = d_stringBuffer.length();
+    if (position >= length) {
+        return length;                                                // RETURN
+    }
+
+    bsl::size_t   block = position / k_INDEX_BLOCK_SIZE;
+    bsl::uint64_t bits  = d_structuralIndex[block * k_NUM_INDEX_KINDS + kind];
+
+    bits >>= position % k_INDEX_BLOCK_SIZE;
+    if (bits) {
+        return position + bdlb::BitUtil::numTrailingUnsetBits(bits);  // RETURN
+    }
+
+    const bsl::size_t numBlocks = d_structuralIndex.size() / k_NUM_INDEX_KINDS;
+    for (++block; block < numBlocks; ++block) {
+        bits = d_structuralIndex[block * k_NUM_INDEX_KINDS + kind];
+        if (bits) {
+            return block * k_INDEX_BLOCK_SIZE                         // RETURN
+                 + bdlb::BitUtil::numTrailingUnsetBits(bits);
+        }
+    }
+    return length;
+}
+
 // ACCESSORS
+int Tokenizer::unescapedValue(bslstl::StringRef *data,
+                              bslma::Allocator  *arena) const
+{
+    if (e_ELEMENT_NAME == d_tokenType) {
+        // The value of a name excludes the enclosing quotes (the opening one
+        // of which may no longer be in the buffer, if the name straddled a
+        // reload).  Note that 'value' is not used, as it fails for an empty
+        // name.
+
+        return ParserUtil::getUnquotedStringRef(                      // RETURN
+                                  data,
+                                  bslstl::StringRef(
+                                          d_stringBuffer.data() + d_valueBegin,
+                                          d_stringBuffer.data() + d_valueEnd),
+                                  arena);
+    }
+
+    bslstl::StringRef literal;
+    if (0 != value(&literal)) {
+        return -1;                                                    // RETURN
+    }
+    else if ('"' != literal[0]) {
+        *data = literal;
+        return 0;                                                     // RETURN
+    }
+
+    bslstl::StringRef result;
+    if (0 != ParserUtil::getStringRef(&result, literal, arena)) {
+        return -1;                                                    // RETURN
+    }
+
+    *data = result;
+    return 0;
+}
+
 int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
@@ -27,6 +27,21 @@ BSLS_IDENT("$Id: $")
 // but not all such errors are detected.  In particular, callers should check
 // that closing brackets and braces match opening ones.
 //
+///Structural Index
+///----------------
+// By default the tokenizer examines the characters of its input one at a
+// time.  If the 'useStructuralIndex' option is set, the tokenizer instead
+// classifies each chunk of input it reads from the 'streambuf' in a single
+// vectorized pass (using SSE2 instructions where available), recording in
+// bitmaps the positions of quotes and backslashes, of whitespace, and of the
+// characters that end a non-string value.  The token state machine then
+// locates the end of whitespace, of string literals, and of other values by
+// searching those bitmaps instead of testing each character.  The sequence of
+// tokens and values produced, and the errors reported, are identical in both
+// modes, and for all settings of the other options.  The structural index is
+// most beneficial for documents having long string values or much
+// whitespace.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -131,6 +146,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlma_bufferedsequentialallocator.h>
 
+#include <bslma_allocator.h>
+
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -194,6 +211,19 @@ class Tokenizer {
         e_ARRAY_CONTEXT               // array context
     };
 
+    enum IndexKind {
+        // This 'enum' lists the character classes recorded, for each block of
+        // 'k_INDEX_BLOCK_SIZE' characters of the string buffer, in the
+        // structural index.
+
+        e_NON_WHITESPACE,             // not a whitespace character
+        e_STRING_SPECIAL,             // '"' or '\\'
+        e_VALUE_END,                  // whitespace, '\0', or one of
+                                      // "{}[]:,"
+
+        k_NUM_INDEX_KINDS
+    };
+
     // One intermediate data buffer used for reading data from the stream, and
     // another for the context state stack.
 
@@ -202,7 +232,9 @@ class Tokenizer {
         k_MAX_STRING_SIZE          = k_BUFSIZE - 1,
 
         k_STACKBUFSIZE             = 256,
-        k_UTF8_MESSAGE_BUFFER_SIZE = 256
+        k_UTF8_MESSAGE_BUFFER_SIZE = 256,
+
+        k_INDEX_BLOCK_SIZE         = 64
     };
 
     // DATA
@@ -239,6 +271,11 @@ class Tokenizer {
 
     bsl::vector<char>   d_contextStack;     // context type stack
 
+    bsl::vector<Uint64> d_structuralIndex;  // unused unless
+                                            // 'd_useStructuralIndex' -- for
+                                            // each block of the string buffer,
+                                            // one bitmap per 'IndexKind'
+
     int                 d_readStatus;       // 0 until EOF or an error is
                                             // encountered, then indicates
                                             // nature of error.  Returned by
@@ -260,6 +297,10 @@ class Tokenizer {
     bool                d_allowNonUtf8StringLiterals;
                                             // Disables UTF-8 validation
 
+    bool                d_useStructuralIndex;
+                                            // option for scanning the input
+                                            // using the structural index
+
     // PRIVATE MANIPULATORS
     int extractStringValue();
         // Extract the string value starting at the current data cursor and
@@ -284,6 +325,12 @@ class Tokenizer {
         // update the cursor to the new read location.  Return the number of
         // bytes read from the 'streambuf'.
 
+    void indexStringBuffer(bsl::size_t position);
+        // Update the structural index to describe the characters of the
+        // string buffer, 'd_stringBuffer', from the specified 'position' to
+        // its end.  The index of the characters before 'position' is left
+        // unchanged.
+
     int expandBufferForLargeValue();
         // Increase the size of the string buffer, 'd_stringBuffer', and then
         // append additional characters, from the internally-held 'streambuf' (
@@ -313,6 +360,14 @@ class Tokenizer {
         // return the top context from the 'd_contextStack' stack without
         // popping.
 
+    bsl::size_t nextIndexed(IndexKind kind, bsl::size_t position) const;
+        // Return the position of the first character of the string buffer,
+        // 'd_stringBuffer', at or after the specified 'position' that is in
+        // the character class indicated by the specified 'kind', or the
+        // length of the string buffer if there is no such character.  The
+        // behavior is undefined unless the structural index describes the
+        // whole string buffer.
+
   private:
     // NOT IMPLEMENTED
     Tokenizer(const Tokenizer&);
@@ -334,7 +389,8 @@ class Tokenizer {
         // Note that the reader will not be on a valid node until
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues',
-        // 'allowHeterogenousArrays', or 'allowNonUtf8StringLiterals' options.
+        // 'allowHeterogenousArrays', 'allowNonUtf8StringLiterals', or
+        // 'useStructuralIndex' options.
 
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
@@ -382,6 +438,16 @@ class Tokenizer {
         // error for stand alone JSON values.  By default, the value of the
         // 'allowStandAloneValues' option is 'true'.
 
+    void setUseStructuralIndex(bool value);
+        // Set the 'useStructuralIndex' option to the specified 'value'.  If
+        // the 'useStructuralIndex' value is 'true' this tokenizer will
+        // classify its input in vectorized passes and locate the ends of
+        // whitespace and values using the resulting index (see {Structural
+        // Index}); otherwise this tokenizer will examine its input one
+        // character at a time.  The tokens produced are the same for either
+        // value.  By default, the value of the 'useStructuralIndex' option is
+        // 'false'.
+
     // ACCESSORS
     bool allowHeterogenousArrays() const;
         // Return the value of the 'allowHeterogenousArrays' option of this
@@ -395,6 +461,10 @@ class Tokenizer {
         // Return the value of the 'allowStandAloneValues' option of this
         // tokenizer.
 
+    bool useStructuralIndex() const;
+        // Return the value of the 'useStructuralIndex' option of this
+        // tokenizer.
+
     bsls::Types::Uint64 readOffset() const;
         // Return the position relative to when 'reset' was called.  If end of
         // file or bad UTF-8 has been encountered, the position relative to
@@ -417,6 +487,20 @@ class Tokenizer {
     TokenType tokenType() const;
         // Return the token type of the current token.
 
+    int unescapedValue(bslstl::StringRef *data,
+                       bslma::Allocator  *arena) const;
+        // Load into the specified 'data' the value of the current token,
+        // without enclosing quotes and with escape sequences replaced by the
+        // characters they represent, if the current token's type is
+        // 'e_ELEMENT_NAME' or 'e_ELEMENT_VALUE', or leave 'data' unmodified
+        // otherwise.  Return 0 on success and a non-zero value otherwise.  If
+        // the value has no escape sequences, 'data' refers to the internal
+        // buffer of this tokenizer, as for 'value', and is invalidated by the
+        // next call to 'advanceToNextToken'; otherwise the unescaped value is
+        // written to memory obtained from the specified 'arena', which is
+        // never deallocated by this function.  Note that the value of a token
+        // that is not a string (e.g., a number) is loaded unchanged.
+
     int value(bslstl::StringRef *data) const;
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'e_ELEMENT_NAME' or 'e_ELEMENT_VALUE' or
@@ -471,11 +555,13 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_readOffset(0)
 , d_tokenType(e_BEGIN)
 , d_contextStack(200, &d_stackAllocator)
+, d_structuralIndex(basicAllocator)
 , d_readStatus(0)
 , d_bufEndStatus(0)
 , d_allowStandAloneValues(true)
 , d_allowHeterogenousArrays(true)
 , d_allowNonUtf8StringLiterals(true)
+, d_useStructuralIndex(false)
 {
     d_stringBuffer.reserve(k_MAX_STRING_SIZE);
     d_contextStack.clear();
@@ -524,6 +610,15 @@ void Tokenizer::setAllowNonUtf8StringLiterals(bool value)
     d_allowNonUtf8StringLiterals = value;
 }
 
+inline
+void Tokenizer::setUseStructuralIndex(bool value)
+{
+    if (value && !d_useStructuralIndex) {
+        indexStringBuffer(0);
+    }
+    d_useStructuralIndex = value;
+}
+
 // ACCESSORS
 inline
 bool Tokenizer::allowStandAloneValues() const
@@ -543,6 +638,12 @@ bool Tokenizer::allowNonUtf8StringLiterals() const
     return d_allowNonUtf8StringLiterals;
 }
 
+inline
+bool Tokenizer::useStructuralIndex() const
+{
+    return d_useStructuralIndex;
+}
+
 inline
 bsls::Types::Uint64 Tokenizer::readOffset() const
 {
@@ -13,6 +13,8 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
 #include <bsl_climits.h>
@@ -53,6 +55,7 @@ using bsl::endl;
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
+// [18] void setUseStructuralIndex(bool value);
 // [ 3] int advanceToNextToken();
 //
 // ACCESSORS
@@ -60,13 +63,16 @@ using bsl::endl;
 // [13] bool allowStandAloneValues() const;
 // [14] bool allowHeterogenousArrays() const;
 // [ 3] int value(bslstl::StringRef *data) const;
+// [19] int unescapedValue(bslstl::StringRef *, bslma::Allocator *) const;
 // [17] bool utf8ErrorIsSet() const;
 // [17} const char *utf8ErrorMessage(const char *) const;
 // [17] void setAllowNonUtf8StringLiterals(bool);
 // [17] bool allowNonUtf8StringLiterals() const;
+// [18] bool useStructuralIndex() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [18] USAGE EXAMPLE
+// [20] USAGE EXAMPLE
+// [-1] PERFORMANCE: STRUCTURAL INDEX
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -326,6 +332,43 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+bsl::string tokenizeAll(const bsl::string&  input,
+                        bool                useStructuralIndex,
+                        bool                allowNonUtf8StringLiterals,
+                        bool                allowHeterogenousArrays,
+                        bool                allowStandAloneValues)
+    // Return a description of the sequence of tokens, with their values, and
+    // of the final return code and read status obtained from tokenizing the
+    // specified 'input' with a tokenizer having the specified
+    // 'useStructuralIndex', 'allowNonUtf8StringLiterals',
+    // 'allowHeterogenousArrays', and 'allowStandAloneValues' options.
+{
+    bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+    Obj mX;  const Obj& X = mX;
+    mX.setUseStructuralIndex(useStructuralIndex);
+    mX.setAllowNonUtf8StringLiterals(allowNonUtf8StringLiterals);
+    mX.setAllowHeterogenousArrays(allowHeterogenousArrays);
+    mX.setAllowStandAloneValues(allowStandAloneValues);
+    mX.reset(&isb);
+
+    bsl::ostringstream result;
+    int                rc;
+    while (0 == (rc = mX.advanceToNextToken())) {
+        result << X.tokenType();
+
+        bslstl::StringRef value;
+        if (0 == X.value(&value)) {
+            result << '<' << value << '>';
+        }
+        result << ' ';
+    }
+    result << "rc=" << rc << " status=" << X.readStatus()
+           << " offset=" << X.readOffset();
+
+    return result.str();
+}
+
 const Utf8Util::ErrorStatus EIT = Utf8Util::k_END_OF_INPUT_TRUNCATION;
 const Utf8Util::ErrorStatus UCO = Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET;
 const Utf8Util::ErrorStatus NCO = Utf8Util::k_NON_CONTINUATION_OCTET;
@@ -489,7 +532,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -611,6 +654,473 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING 'unescapedValue'
+        //
+        // Concerns:
+        //: 1 The enclosing quotes of names and string values are removed, and
+        //:   escape sequences are replaced.
+        //:
+        //: 2 Names and values without escape sequences refer into the
+        //:   tokenizer's buffer, and the arena is not used.
+        //:
+        //: 3 Names and values with escape sequences are written to memory
+        //:   from the arena.
+        //:
+        //: 4 Values that are not strings are loaded unchanged.
+        //:
+        //: 5 A non-zero value is returned, and 'data' is unmodified, for
+        //:   tokens without a value and for invalid escape sequences.
+        //:
+        //: 6 Empty names and empty string values are loaded as empty.
+        //:
+        //: 7 Names that straddle a reload of the tokenizer's buffer (so that
+        //:   their opening quote is no longer in the buffer) are loaded
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 Tokenize a document having names and values with and without
+        //:   escape sequences, and number and literal values, and verify the
+        //:   value loaded by 'unescapedValue' for each token, and the use of
+        //:   a test allocator supplied as the arena.  (C-1..6)
+        //:
+        //: 2 For names with and without escape sequences, preceded by values
+        //:   of lengths placing the names at every offset around the size of
+        //:   the buffer, verify the value loaded by 'unescapedValue' for the
+        //:   name.  (C-7)
+        //
+        // Testing:
+        //   int unescapedValue(bslstl::StringRef *, bslma::Allocator *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'unescapedValue'" << endl
+                          << "========================" << endl;
+
+        const char *INPUT = "{\"plain\":\"text\",\"esc\\\"aped\":\"a\\tb\","
+                            "\"num\":-1.5e3,\"list\":[true,\"\\u00e9\",\"\"],"
+                            "\"\":\"\",\"bad\":\"\\x\"}";
+
+        static const struct {
+            Obj::TokenType  d_type;         // expected token type
+            int             d_rc;           // expected return code
+            const char     *d_value_p;      // expected value
+            bool            d_usesArena;    // value is in the arena
+        } EXP[] = {
+            { Obj::e_START_OBJECT,  -1, "",           false },
+            { Obj::e_ELEMENT_NAME,   0, "plain",      false },
+            { Obj::e_ELEMENT_VALUE,  0, "text",       false },
+            { Obj::e_ELEMENT_NAME,   0, "esc\"aped",  true  },
+            { Obj::e_ELEMENT_VALUE,  0, "a\tb",       true  },
+            { Obj::e_ELEMENT_NAME,   0, "num",        false },
+            { Obj::e_ELEMENT_VALUE,  0, "-1.5e3",     false },
+            { Obj::e_ELEMENT_NAME,   0, "list",       false },
+            { Obj::e_START_ARRAY,   -1, "",           false },
+            { Obj::e_ELEMENT_VALUE,  0, "true",       false },
+            { Obj::e_ELEMENT_VALUE,  0, "\xC3\xA9",   true  },
+            { Obj::e_ELEMENT_VALUE,  0, "",           false },
+            { Obj::e_END_ARRAY,     -1, "",           false },
+            { Obj::e_ELEMENT_NAME,   0, "",           false },
+            { Obj::e_ELEMENT_VALUE,  0, "",           false },
+            { Obj::e_ELEMENT_NAME,   0, "bad",        false },
+            { Obj::e_ELEMENT_VALUE, -1, "",           true  },
+            { Obj::e_END_OBJECT,    -1, "",           false },
+        };
+        const int NUM_EXP = sizeof EXP / sizeof *EXP;
+
+        bdlsb::FixedMemInStreamBuf isb(INPUT, bsl::strlen(INPUT));
+
+        Obj mX;  const Obj& X = mX;
+        mX.reset(&isb);
+
+        for (int i = 0; i < NUM_EXP; ++i) {
+            ASSERTV(i, 0 == mX.advanceToNextToken());
+            ASSERTV(i, X.tokenType(), EXP[i].d_type == X.tokenType());
+
+            bslma::TestAllocator arena("arena", veryVeryVerbose);
+
+            const char        SENTINEL[] = "sentinel";
+            bslstl::StringRef value(SENTINEL);
+
+            const int rc = X.unescapedValue(&value, &arena);
+            ASSERTV(i, rc, EXP[i].d_rc == rc);
+
+            if (rc) {
+                ASSERTV(i, SENTINEL == value.data());
+            }
+            else {
+                ASSERTV(i, value, EXP[i].d_value_p == value);
+            }
+
+            ASSERTV(i, arena.numBlocksTotal(),
+                    EXP[i].d_usesArena == (0 != arena.numBlocksTotal()));
+
+            if (!rc && !EXP[i].d_usesArena && !value.isEmpty()) {
+                // The value refers into the token returned by 'value'.
+
+                bslstl::StringRef raw;
+                ASSERTV(i, 0 == X.value(&raw));
+                ASSERTV(i, raw.begin() <= value.begin());
+                ASSERTV(i, value.end() <= raw.end());
+            }
+
+            if (arena.numBlocksInUse()) {
+                arena.deallocate(arena.lastAllocatedAddress());
+            }
+        }
+        ASSERT(0 != mX.advanceToNextToken());
+
+        if (verbose) cout << "\tNames straddling a buffer reload." << endl;
+        {
+            const int BUFSIZE = 8 * 1024;
+
+            static const struct {
+                const char *d_name_p;   // name, as written in the document
+                const char *d_value_p;  // expected unescaped name
+            } NAMES[] = {
+                { "abcdefghijklmnop",     "abcdefghijklmnop"    },
+                { "abcdefgh\\\\ijklmnop", "abcdefgh\\ijklmnop"  },
+                { "abc\\\"def\\u00e9ghi", "abc\"def\xC3\xA9ghi" },
+            };
+            const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            for (int ni = 0; ni < NUM_NAMES; ++ni) {
+                const char *NAME  = NAMES[ni].d_name_p;
+                const char *VALUE = NAMES[ni].d_value_p;
+
+                for (int length  = BUFSIZE - 40;
+                         length <= BUFSIZE + 10;
+                         ++length) {
+                    const bsl::string INPUT = "{\"pad\":\"" +
+                                              bsl::string(length, 'x') +
+                                              "\",\"" + NAME + "\":1}";
+
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.size());
+
+                    Obj mX;  const Obj& X = mX;
+                    mX.reset(&isb);
+
+                    for (int i = 0; i < 4; ++i) {
+                        ASSERTV(ni, length, i, 0 == mX.advanceToNextToken());
+                    }
+                    ASSERTV(ni, length, Obj::e_ELEMENT_NAME == X.tokenType());
+
+                    bslma::TestAllocator arena("arena", veryVeryVerbose);
+                    bslstl::StringRef    value;
+
+                    ASSERTV(ni, length, 0 == X.unescapedValue(&value, &arena));
+                    ASSERTV(ni, length, value, VALUE == value);
+
+                    if (arena.numBlocksInUse()) {
+                        arena.deallocate(arena.lastAllocatedAddress());
+                    }
+                }
+            }
+        }
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'useStructuralIndex' OPTION
+        //
+        // Concerns:
+        //: 1 The 'useStructuralIndex' option is 'false' by default, and the
+        //:   manipulator sets the value returned by the accessor.
+        //:
+        //: 2 The tokens, values, return codes, read status, and read offset
+        //:   produced with the option set are identical to those produced
+        //:   without it, for well-formed and malformed input, and for all
+        //:   values of the other options.
+        //:
+        //: 3 Quotes escaped by an odd number of backslashes, and not by an
+        //:   even number, are skipped, including when the backslashes and the
+        //:   quote straddle a 64-byte block or a buffer reload.
+        //:
+        //: 4 Values longer than the internal buffer are handled.
+        //:
+        //: 5 Setting the option between tokens does not change the result.
+        //:
+        //: 6 An embedded null character ends an unquoted value, as in the
+        //:   character-by-character scan.
+        //
+        // Plan:
+        //: 1 Default-construct a tokenizer and verify the accessor.  Set the
+        //:   option to 'true' and back, verifying the accessor each time.
+        //:   (C-1)
+        //:
+        //: 2 For each document in a table of JSON documents, for leading
+        //:   whitespace of each length from 0 to 130, and for each
+        //:   combination of the other options, tokenize the document with
+        //:   and without the option and compare the results.  (C-2..3)
+        //:
+        //: 3 Repeat P-2 with documents consisting of string and number values
+        //:   whose lengths place escapes and terminators near the end of the
+        //:   internal buffer, and exceed it.  (C-3..4)
+        //:
+        //: 4 Tokenize a document, setting the option before each second
+        //:   token, and compare the results with a tokenizer that does not
+        //:   use the option.  (C-5)
+        //:
+        //: 5 Repeat P-2 with documents having null characters embedded in
+        //:   values, in strings, and between tokens, and verify the tokens
+        //:   produced for one of them.  (C-6)
+        //
+        // Testing:
+        //   void setUseStructuralIndex(bool value);
+        //   bool useStructuralIndex() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'useStructuralIndex' OPTION" << endl
+                          << "===================================" << endl;
+
+        if (verbose) cout << "\nTesting the manipulator and accessor." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(false == X.useStructuralIndex());
+
+            mX.setUseStructuralIndex(true);
+            ASSERT(true  == X.useStructuralIndex());
+
+            mX.setUseStructuralIndex(false);
+            ASSERT(false == X.useStructuralIndex());
+        }
+
+        if (verbose) cout << "\nComparing with the character scan." << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+
+                const char *d_input_p;    // JSON document
+            } DATA[] = {
+                //LINE  INPUT
+                //----  -----------------------------------------------------
+                { L_,   ""                                                   },
+                { L_,   "{}"                                                 },
+                { L_,   "[]"                                                 },
+                { L_,   "{\"a\":1}"                                          },
+                { L_,   "{ \"a\" : \"b\" , \"c\" : [1, 2.5e3, true] }"       },
+                { L_,   "{\"a\":{\"b\":{\"c\":[[],[{}],null]}}}"             },
+                { L_,   "[1,{\"a\":1},[2],\"x\"]"                            },
+                { L_,   "[{\"a\":1},1]"                                      },
+                { L_,   "\"standalone\""                                     },
+                { L_,   "12345"                                              },
+                { L_,   "{\"a\":\"x\\\"y\"}"                                 },
+                { L_,   "{\"a\":\"x\\\\\"}"                                  },
+                { L_,   "{\"a\":\"x\\\\\\\"y\"}"                             },
+                { L_,   "{\"a\\\"b\":\"\\\\\\\\\"}"                          },
+                { L_,   "{\"a\":\"\\u00e9\\n\\t\\/\"}"                       },
+                { L_,   "{\"a\":\"\\n\"}"                                    },
+                { L_,   "[\"\\u00e9\", \"\\tx\\\\\", \"\\\\\\/\"]"           },
+                { L_,   "{\n\t\"a\"\v:\f\"b\"\r}\n"                          },
+                { L_,   "{\"a\":\"\xc3\xa9\xe2\x82\xac\"}"                   },
+                { L_,   "{\"a\":\"\xc3\"}"                                   },
+                { L_,   "{\"a\":\"\xff\xfe\"}"                               },
+                { L_,   "{\"a\":\x80}"                                       },
+                { L_,   "{\"a\":1,}"                                         },
+                { L_,   "{\"a\"1}"                                           },
+                { L_,   "{\"a\":[1 2]}"                                      },
+                { L_,   "{\"a\":\"unterminated"                              },
+                { L_,   "{\"a\":12}]}"                                       },
+                { L_,   "{\"a\":tru\te}"                                     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const bsl::string INPUT(DATA[ti].d_input_p);
+
+                for (int pad = 0; pad <= 130; ++pad) {
+                    bsl::string input;
+                    for (int i = 0; i < pad; ++i) {
+                        input.push_back(WS[i % (sizeof WS - 1)]);
+                    }
+                    input += INPUT;
+
+                    for (int options = 0; options < 8; ++options) {
+                        const bool NON_UTF8    = options & 1;
+                        const bool HETEROGENOUS = options & 2;
+                        const bool STAND_ALONE = options & 4;
+
+                        const bsl::string EXP = tokenizeAll(input,
+                                                            false,
+                                                            NON_UTF8,
+                                                            HETEROGENOUS,
+                                                            STAND_ALONE);
+                        const bsl::string RESULT = tokenizeAll(input,
+                                                               true,
+                                                               NON_UTF8,
+                                                               HETEROGENOUS,
+                                                               STAND_ALONE);
+
+                        if (veryVeryVerbose) {
+                            P_(LINE) P_(pad) P_(options) P(RESULT)
+                        }
+
+                        ASSERTV(LINE, pad, options, EXP, RESULT,
+                                EXP == RESULT);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting embedded null characters." << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+
+                const char *d_input_p;    // JSON document
+
+                int         d_length;     // length of 'd_input_p'
+            } DATA[] = {
+                //LINE  INPUT                                   LENGTH
+                //----  --------------------------------------  ------
+                { L_,   "[12\0,3]",                              7     },
+                { L_,   "[12\0 ,3]",                             8     },
+                { L_,   "{\"a\":tr\0ue}",                        11    },
+                { L_,   "{\"a\":1\0}",                           8     },
+                { L_,   "[\"a\0b\"]",                            7     },
+                { L_,   "[\0]",                                  3     },
+                { L_,   "\0",                                    1     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const bsl::string INPUT(DATA[ti].d_input_p,
+                                        DATA[ti].d_length);
+
+                for (int pad = 0; pad <= 130; ++pad) {
+                    bsl::string input;
+                    for (int i = 0; i < pad; ++i) {
+                        input.push_back(WS[i % (sizeof WS - 1)]);
+                    }
+                    input += INPUT;
+
+                    for (int options = 0; options < 8; ++options) {
+                        const bool NON_UTF8    = options & 1;
+                        const bool HETEROGENOUS = options & 2;
+                        const bool STAND_ALONE = options & 4;
+
+                        const bsl::string EXP = tokenizeAll(input,
+                                                            false,
+                                                            NON_UTF8,
+                                                            HETEROGENOUS,
+                                                            STAND_ALONE);
+                        const bsl::string RESULT = tokenizeAll(input,
+                                                               true,
+                                                               NON_UTF8,
+                                                               HETEROGENOUS,
+                                                               STAND_ALONE);
+
+                        ASSERTV(LINE, pad, options, EXP, RESULT,
+                                EXP == RESULT);
+                    }
+                }
+            }
+
+            // The null character ends the value '12', and is then rejected.
+
+            const bsl::string INPUT("[12\0,3]", 7);
+            const bsl::string EXP("e_START_ARRAY e_ELEMENT_VALUE<12> "
+                                  "rc=-1 status=0 offset=7");
+
+            ASSERTV(EXP == tokenizeAll(INPUT, false, false, false, false));
+            ASSERTV(EXP == tokenizeAll(INPUT, true,  false, false, false));
+        }
+
+        if (verbose) cout << "\nTesting values near the buffer size." << endl;
+        {
+            const int BUFSIZE = 8 * 1024;
+
+            for (int length = BUFSIZE - 80; length <= BUFSIZE + 80; ++length) {
+                for (int numEscapes = 0; numEscapes <= 3; ++numEscapes) {
+                    bsl::string value(length, 'x');
+                    for (int i = 0; i < numEscapes; ++i) {
+                        value += "\\";
+                    }
+                    if (numEscapes % 2) {
+                        value += "\"tail";
+                    }
+
+                    const bsl::string STRING_INPUT = "{\"name\": [\"" +
+                                                     value +
+                                                     "\", 12, \"a\\\"\"]}";
+                    const bsl::string NUMBER_INPUT = "[\"abc\", " +
+                                                     bsl::string(length, '1') +
+                                                     " ,true]";
+
+                    for (int options = 0; options < 2; ++options) {
+                        const bool NON_UTF8 = options & 1;
+
+                        ASSERTV(length, numEscapes, options,
+                                tokenizeAll(STRING_INPUT,
+                                            false,
+                                            NON_UTF8,
+                                            true,
+                                            true) ==
+                                tokenizeAll(STRING_INPUT,
+                                            true,
+                                            NON_UTF8,
+                                            true,
+                                            true));
+
+                        ASSERTV(length, numEscapes, options,
+                                tokenizeAll(NUMBER_INPUT,
+                                            false,
+                                            NON_UTF8,
+                                            true,
+                                            true) ==
+                                tokenizeAll(NUMBER_INPUT,
+                                            true,
+                                            NON_UTF8,
+                                            true,
+                                            true));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting setting the option mid-stream."
+                          << endl;
+        {
+            const bsl::string INPUT =
+                  "{ \"a\" : [ \"b\\\"\", 1, { \"c\" : 2 } ], \"d\" : \"e\" }";
+
+            bdlsb::FixedMemInStreamBuf isbX(INPUT.data(), INPUT.length());
+            bdlsb::FixedMemInStreamBuf isbY(INPUT.data(), INPUT.length());
+
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            mX.reset(&isbX);
+            mY.reset(&isbY);
+
+            int i = 0;
+            while (true) {
+                mX.setUseStructuralIndex(i % 4 < 2);
+
+                const int RC_X = mX.advanceToNextToken();
+                const int RC_Y = mY.advanceToNextToken();
+
+                ASSERTV(i, RC_X, RC_Y, RC_X == RC_Y);
+                if (RC_X || RC_Y) {
+                    break;
+                }
+
+                ASSERTV(i, X.tokenType(), Y.tokenType(),
+                        X.tokenType() == Y.tokenType());
+
+                bslstl::StringRef valueX, valueY;
+                ASSERTV(i, X.value(&valueX) == Y.value(&valueY));
+                ASSERTV(i, valueX, valueY, valueX == valueY);
+
+                ++i;
+            }
+            ASSERTV(i, 13 == i);
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING UTF8
@@ -7268,6 +7778,73 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: STRUCTURAL INDEX
+        //
+        // Concerns:
+        //: 1 Tokenizing with the 'useStructuralIndex' option set is faster
+        //:   than without it.
+        //
+        // Plan:
+        //: 1 Build a document of about 2 MB consisting of an array of objects
+        //:   having string, number, and nested array members, and time
+        //:   tokenizing it repeatedly with and without the option.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: STRUCTURAL INDEX
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: STRUCTURAL INDEX" << endl
+             << "=============================" << endl;
+
+        bsl::string input = "[";
+        for (int i = 0; i < 10000; ++i) {
+            if (i) {
+                input += ",\n";
+            }
+            input += "  {\n"
+                     "    \"name\"       : \"Lorem ipsum dolor sit amet\",\n"
+                     "    \"description\": \"consectetur adipiscing elit, sed"
+                     " do eiusmod tempor \\\"incididunt\\\" ut labore\",\n"
+                     "    \"value\"      : 12345.678,\n"
+                     "    \"tags\"       : [ \"alpha\", \"beta\", true ],\n"
+                     "    \"timestamp\"  : \"2012-08-18T13:25:00.000+00:00\"\n"
+                     "  }";
+        }
+        input += "]";
+
+        const int NUM_ITERATIONS = 20;
+
+        for (int useIndex = 0; useIndex < 2; ++useIndex) {
+            bsls::Stopwatch timer;
+            timer.start();
+
+            int numTokens = 0;
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+                Obj mX;
+                mX.setUseStructuralIndex(useIndex);
+                mX.reset(&isb);
+
+                while (0 == mX.advanceToNextToken()) {
+                    ++numTokens;
+                }
+            }
+            timer.stop();
+
+            const double mbPerSecond = static_cast<double>(input.length())
+                                     * NUM_ITERATIONS
+                                     / timer.elapsedTime() / 1e6;
+
+            cout << (useIndex ? "structural index:    "
+                              : "character scan:      ")
+                 << mbPerSecond << " MB/s ("
+                 << numTokens / NUM_ITERATIONS << " tokens)" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
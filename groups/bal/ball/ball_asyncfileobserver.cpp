@@ -19,6 +19,10 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
+#include <bsls_systemtime.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -42,7 +46,9 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_DEFAULT_MAX_BATCH_SIZE   = 256,
+    k_MAX_POLL_INTERVAL        = 1000   // microseconds
 };
 
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
@@ -86,20 +92,68 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
     while (!done) {
-        AsyncFileObserver_Record asyncRecord = d_recordQueue.popFront();
+        // Block for the first record of the batch, then take whatever else is
+        // available (waiting up to the flush latency for more) without
+        // blocking.
+
+        d_batch.push_back(d_recordQueue.popFront());
+        done = Transmission::e_END ==
+                                d_batch.back().d_context.transmissionCause();
+
+        const int                maxBatchSize = d_maxBatchSize.loadRelaxed();
+        const bsls::Types::Int64 latency      = d_flushLatency.loadRelaxed();
+        const bsls::Types::Int64 deadline     = 0 < latency
+            ? bsls::SystemTime::nowMonotonicClock().totalMicroseconds()
+                                                                     + latency
+            : 0;
+
+        AsyncFileObserver_Record asyncRecord;
+        while (!done && static_cast<int>(d_batch.size()) < maxBatchSize) {
+            if (0 == d_recordQueue.tryPopFront(&asyncRecord)) {
+                d_batch.push_back(asyncRecord);
+                done = Transmission::e_END ==
+                                   asyncRecord.d_context.transmissionCause();
+                continue;
+            }
+
+            if (0 >= latency || d_shuttingDownFlag) {
+                break;
+            }
 
-        // Publish the next log record on the queue only if the observer is not
-        // shutting down.
+            const bsls::Types::Int64 remaining = deadline -
+                    bsls::SystemTime::nowMonotonicClock().totalMicroseconds();
+            if (0 >= remaining) {
+                break;
+            }
+            const bsls::Types::Int64 sleepTime =
+                 bsl::min<bsls::Types::Int64>(remaining, k_MAX_POLL_INTERVAL);
+            bslmt::ThreadUtil::microSleep(static_cast<int>(sleepTime));
+        }
+        asyncRecord.d_record.reset();
 
-        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
+        // Publish the batch (excluding a terminating 'e_END' record) only if
+        // the observer is not shutting down.
+
+        if (d_shuttingDownFlag) {
             done = true;
         }
         else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+            const bsl::size_t numRecords = d_batch.size() - (done ? 1 : 0);
+
+            for (bsl::size_t i = 0; i < numRecords; ++i) {
+                d_batchRecords.push_back(d_batch[i].d_record.get());
+            }
+            if (0 < numRecords) {
+                d_fileObserver.publishBatch(&d_batchRecords[0],
+                                            static_cast<int>(numRecords));
+            }
         }
 
+        // Release the references to the published records.
+
+        d_batch.clear();
+        d_batchRecords.clear();
+
         // Publish the count of dropped records.  To avoid repeatedly
         // publishing this information when the record queue is full, we
         // publish the number of dropped records only when the queue becomes
@@ -176,6 +230,8 @@ void AsyncFileObserver::construct()
     d_threadHandle     = bslmt::ThreadUtil::invalidHandle();
     d_shuttingDownFlag = 0;
     d_dropCount        = 0;
+    d_maxBatchSize     = k_DEFAULT_MAX_BATCH_SIZE;
+    d_flushLatency     = 0;
 
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
@@ -196,6 +252,8 @@ AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -208,6 +266,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -221,6 +281,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -235,6 +297,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -251,6 +315,8 @@ AsyncFileObserver::AsyncFileObserver(
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -125,6 +125,9 @@ BSLS_IDENT("$Id: $")
 // | Thread      | stopPublicationThread       |                              |
 // | Management  | shutdownPublicationThread   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Batched     | setMaxBatchSize             | maxBatchSize                 |
+// | Publication | setFlushLatency             | flushLatency                 |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::AsyncFileObserver' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -164,6 +167,33 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+///Batched Publication
+///-------------------
+// The publication thread does not publish queued records one at a time.
+// Instead, it removes from the queue all records that are immediately
+// available, up to a configurable maximum batch size (by default 256), and
+// publishes them together: the records of a batch are formatted into a single
+// reusable buffer that is written to the log file (and, for records that meet
+// the 'stdout' threshold, to 'stdout') with a single write, and the locks of
+// the underlying file observer are acquired only once per batch.  This
+// markedly reduces the per-record cost of publication under bursts of logging,
+// which, in turn, reduces the number of records dropped (or the time spent
+// blocking in 'publish') due to a full queue.
+//
+// The maximum batch size can be changed at any time by calling
+// 'setMaxBatchSize'; a maximum batch size of 1 results in records being
+// published individually.  In addition, a flush latency can be configured by
+// calling 'setFlushLatency'.  When the flush latency is positive and fewer
+// than the maximum number of records are available, the publication thread
+// waits, for at most the flush latency (measured from the removal of the first
+// record of the batch), for additional records to arrive before publishing the
+// batch.  A positive flush latency trades latency of log output for fewer,
+// larger writes.  The default flush latency is 0, i.e., a batch is published
+// as soon as the queue is observed to be empty.  Note that, irrespective of
+// these settings, records are published in the order in which they were
+// enqueued, and the log file rotation rules are applied to each record as if
+// the records were published individually.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -482,11 +512,15 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_threadutil.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -555,6 +589,27 @@ class AsyncFileObserver : public Observer {
                                                      // publishing the count of
                                                      // dropped log records
 
+    bsls::AtomicInt                d_maxBatchSize;   // maximum number of
+                                                     // records published by
+                                                     // the publication thread
+                                                     // as a single batch
+
+    bsls::AtomicInt64              d_flushLatency;   // maximum time (in
+                                                     // microseconds) that the
+                                                     // publication thread
+                                                     // waits to fill a batch
+
+    bsl::vector<AsyncFileObserver_Record>
+                                   d_batch;          // records of the batch
+                                                     // being published (used
+                                                     // by publication thread
+                                                     // only)
+
+    bsl::vector<const Record *>    d_batchRecords;   // addresses of the
+                                                     // records in 'd_batch'
+                                                     // (used by publication
+                                                     // thread only)
+
     mutable bslmt::Mutex           d_mutex;          // serialize operations
 
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
@@ -580,10 +635,10 @@ class AsyncFileObserver : public Observer {
 
     void publishThreadEntryPoint();
         // Publish records from the record queue, to the log file and 'stdout',
-        // until signaled to stop.  The behavior is undefined if this method is
-        // invoked concurrently from multiple threads, i.e., it is *not*
-        // thread-safe.  Note that this function is the entry point for the
-        // publication thread.
+        // in batches (see {Batched Publication}), until signaled to stop.  The
+        // behavior is undefined if this method is invoked concurrently from
+        // multiple threads, i.e., it is *not* thread-safe.  Note that this
+        // function is the entry point for the publication thread.
 
     int shutdownThread();
         // Stop the publication thread and discard all currently queued log
@@ -840,6 +895,16 @@ class AsyncFileObserver : public Observer {
         // of 'bdlt::Datetime(1, 1, 1)' and an interval of 24 hours would
         // configure a periodic rotation at midnight each day.
 
+    void setFlushLatency(const bsls::TimeInterval& latency);
+        // Set the maximum time that the publication thread of this async file
+        // observer waits for additional records to arrive, when fewer than
+        // 'maxBatchSize()' records are available, before publishing a batch
+        // to the specified 'latency'.  A 'latency' of 0 indicates that a batch
+        // is published as soon as the record queue is observed to be empty.
+        // The behavior is undefined unless
+        // 'bsls::TimeInterval() <= latency'.  Note that the new value takes
+        // effect starting with the next batch.  See {Batched Publication}.
+
     void setLogFormat(const char *logFileFormat, const char *stdoutFormat);
         // Set the format specifications for log records written to the log
         // file and to 'stdout' to the specified 'logFileFormat' and
@@ -857,6 +922,13 @@ class AsyncFileObserver : public Observer {
         // received through the 'publish' method as well as those that are
         // currently on the queue.
 
+    void setMaxBatchSize(int maxBatchSize);
+        // Set the maximum number of records that the publication thread of
+        // this async file observer removes from the record queue and publishes
+        // as a single batch to the specified 'maxBatchSize'.  The behavior is
+        // undefined unless '1 <= maxBatchSize'.  Note that the new value takes
+        // effect starting with the next batch.  See {Batched Publication}.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -900,6 +972,11 @@ class AsyncFileObserver : public Observer {
         // thread is stopped.
 
     // ACCESSORS
+    bsls::TimeInterval flushLatency() const;
+        // Return the maximum time that the publication thread of this async
+        // file observer waits for additional records to arrive before
+        // publishing an incomplete batch.  See {Batched Publication}.
+
     void getLogFormat(const char **logFileFormat,
                       const char **stdoutFormat) const;
         // Load the format specification for log records written by this async
@@ -955,6 +1032,11 @@ class AsyncFileObserver : public Observer {
         // !DEPRECATED!: Use 'bdlt::LocalTimeOffset' instead.
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+    int maxBatchSize() const;
+        // Return the maximum number of records that the publication thread of
+        // this async file observer publishes as a single batch.  See {Batched
+        // Publication}.
+
     int recordQueueLength() const;
         // Return the number of log records currently on the record queue of
         // this async file observer.
@@ -1060,6 +1142,14 @@ void AsyncFileObserver::rotateOnTimeInterval(
     d_fileObserver.rotateOnTimeInterval(interval, startTime);
 }
 
+inline
+void AsyncFileObserver::setFlushLatency(const bsls::TimeInterval& latency)
+{
+    BSLS_ASSERT(bsls::TimeInterval() <= latency);
+
+    d_flushLatency.storeRelaxed(latency.totalMicroseconds());
+}
+
 inline
 void AsyncFileObserver::setLogFormat(const char *logFileFormat,
                                      const char *stdoutFormat)
@@ -1067,6 +1157,14 @@ void AsyncFileObserver::setLogFormat(const char *logFileFormat,
     d_fileObserver.setLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+void AsyncFileObserver::setMaxBatchSize(int maxBatchSize)
+{
+    BSLS_ASSERT(1 <= maxBatchSize);
+
+    d_maxBatchSize.storeRelaxed(maxBatchSize);
+}
+
 inline
 void AsyncFileObserver::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
@@ -1081,6 +1179,14 @@ void AsyncFileObserver::setStdoutThreshold(Severity::Level stdoutThreshold)
 }
 
 // ACCESSORS
+inline
+bsls::TimeInterval AsyncFileObserver::flushLatency() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_flushLatency.loadRelaxed());
+    return result;
+}
+
 inline
 void AsyncFileObserver::getLogFormat(const char **logFileFormat,
                                      const char **stdoutFormat) const
@@ -1132,6 +1238,12 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 }
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+inline
+int AsyncFileObserver::maxBatchSize() const
+{
+    return d_maxBatchSize.loadRelaxed();
+}
+
 inline
 int AsyncFileObserver::recordQueueLength() const
 {
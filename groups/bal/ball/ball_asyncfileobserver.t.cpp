@@ -26,8 +26,10 @@
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
@@ -103,7 +105,9 @@ using bsl::flush;
 // [ 6] void rotateOnSize(int size);
 // [ 6] void rotateOnTimeInterval(const DatetimeInterval timeInterval);
 // [ 6] void rotateOnTimeInterval(const DatetimeI&, const Datetime&);
+// [13] void setFlushLatency(const bsls::TimeInterval& latency);
 // [ 1] void setLogFormat(const char* logF, const char* stdoutF);
+// [13] void setMaxBatchSize(int maxBatchSize);
 // [ 8] void setOnFileRotationCallback(const OnFileRotationCallback&);
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold);
 // [ 3] void shutdownPublicationThread();
@@ -111,6 +115,7 @@ using bsl::flush;
 // [ 3] void stopPublicationThread();
 //
 // ACCESSORS
+// [13] bsls::TimeInterval flushLatency() const;
 // [ 1] void getLogFormat(const char** logF, const char** stdoutF) const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
@@ -118,17 +123,19 @@ using bsl::flush;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
+// [13] int maxBatchSize() const;
 // [11] int recordQueueLength() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [13] CONCERN: BATCHED PUBLICATION
 // [10] CONCERN: CONCURRENT PUBLICATION
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -623,7 +630,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +782,203 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BATCHED PUBLICATION
+        //
+        // Concerns:
+        //: 1 The maximum batch size and flush latency have the documented
+        //:   default values, and 'setMaxBatchSize' and 'setFlushLatency' set
+        //:   the values returned by 'maxBatchSize' and 'flushLatency'.
+        //:
+        //: 2 For any maximum batch size, every record is published exactly
+        //:   once and in the order in which it was enqueued.
+        //:
+        //: 3 With a positive flush latency, an incomplete batch is not
+        //:   published before the latency expires, unless the publication
+        //:   thread is stopped, in which case the pending records are
+        //:   published without waiting for the latency to expire.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the default values of the batch settings, then set and
+        //:   verify a number of values.  (C-1)
+        //:
+        //: 2 For a set of maximum batch sizes, log a sequence of records
+        //:   (having consecutive integers as messages) while the publication
+        //:   thread is stopped, so that they accumulate in the queue, then
+        //:   start and stop the publication thread and verify the content of
+        //:   the log file.  (C-2)
+        //:
+        //: 3 Set a long flush latency, log a record, and verify that it has
+        //:   not been written to the log file shortly thereafter.  Then stop
+        //:   the publication thread and verify that the record has been
+        //:   written.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-4)
+        //
+        // Testing:
+        //   void setFlushLatency(const bsls::TimeInterval& latency);
+        //   void setMaxBatchSize(int maxBatchSize);
+        //   bsls::TimeInterval flushLatency() const;
+        //   int maxBatchSize() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+        if (verbose) cout << "\nTESTING BATCHED PUBLICATION"
+                          << "\n===========================" << endl;
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_TRACE,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF));
+
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+        BALL_LOG_SET_CATEGORY("ball::AsyncFileObserverTest");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tTesting batch settings." << endl;
+        {
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERTV(X.maxBatchSize(), 256 == X.maxBatchSize());
+            ASSERTV(X.flushLatency(),
+                    bsls::TimeInterval() == X.flushLatency());
+
+            static const int BATCH_SIZES[] = { 1, 2, 1000, INT_MAX };
+            for (int i = 0; i < 4; ++i) {
+                mX.setMaxBatchSize(BATCH_SIZES[i]);
+                ASSERTV(i, BATCH_SIZES[i] == X.maxBatchSize());
+            }
+
+            static const bsls::Types::Int64 LATENCIES[] = { 1, 999, 1000001 };
+            for (int i = 0; i < 3; ++i) {
+                bsls::TimeInterval latency;
+                latency.addMicroseconds(LATENCIES[i]);
+
+                mX.setFlushLatency(latency);
+                ASSERTV(i, latency == X.flushLatency());
+            }
+
+            mX.setFlushLatency(bsls::TimeInterval());
+            ASSERT(bsls::TimeInterval() == X.flushLatency());
+        }
+
+        if (verbose) cout << "\tTesting order of publication." << endl;
+        {
+            enum { k_NUM_RECORDS = 1000 };
+
+            static const int BATCH_SIZES[] = { 1, 7, 256, k_NUM_RECORDS * 2 };
+
+            for (int ti = 0; ti < 4; ++ti) {
+                const int BATCH_SIZE = BATCH_SIZES[ti];
+
+                if (veryVerbose) { T_ P(BATCH_SIZE) }
+
+                TempDirectoryGuard tempDirGuard;
+                bsl::string        fileName(tempDirGuard.getTempDirName());
+                bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+                bsl::shared_ptr<Obj> mX(
+                             new (ta) Obj(ball::Severity::e_OFF,
+                                          false,
+                                          k_NUM_RECORDS * 2,
+                                          ball::Severity::e_TRACE,
+                                          &ta),
+                             &ta);
+
+                mX->setLogFormat("%m\n", "%m\n");
+                mX->setMaxBatchSize(BATCH_SIZE);
+                ASSERT(0 == mX->enableFileLogging(fileName.c_str()));
+
+                ASSERT(0 == manager.registerObserver(mX, "batchObserver"));
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    BALL_LOG_TRACE << i;
+                }
+                ASSERTV(BATCH_SIZE, mX->recordQueueLength(),
+                        k_NUM_RECORDS == mX->recordQueueLength());
+
+                ASSERT(0 == mX->startPublicationThread());
+                ASSERT(0 == mX->stopPublicationThread());
+
+                ASSERT(0 == manager.deregisterObserver("batchObserver"));
+
+                mX->disableFileLogging();
+
+                bsl::ifstream fs(fileName.c_str());
+                ASSERT(fs.is_open());
+
+                int         numLines = 0;
+                bsl::string line;
+                while (getline(fs, line)) {
+                    bsl::ostringstream expected;
+                    expected << numLines;
+                    ASSERTV(BATCH_SIZE, numLines, line,
+                            expected.str() == line);
+                    ++numLines;
+                }
+                ASSERTV(BATCH_SIZE, numLines, k_NUM_RECORDS == numLines);
+            }
+        }
+
+        if (verbose) cout << "\tTesting flush latency." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+            bsl::string        fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bsl::shared_ptr<Obj> mX(new (ta) Obj(ball::Severity::e_OFF, &ta),
+                                    &ta);
+
+            mX->setLogFormat("%m\n", "%m\n");
+            mX->setFlushLatency(bsls::TimeInterval(30, 0));
+            ASSERT(0 == mX->enableFileLogging(fileName.c_str()));
+
+            ASSERT(0 == manager.registerObserver(mX, "batchObserver"));
+            ASSERT(0 == mX->startPublicationThread());
+
+            BALL_LOG_TRACE << "latency";
+
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            ASSERTV(FsUtil::getFileSize(fileName),
+                    0 == FsUtil::getFileSize(fileName));
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            ASSERT(0 == mX->stopPublicationThread());
+
+            ASSERTV(timer.elapsedTime(), 10 > timer.elapsedTime());
+
+            ASSERTV(FsUtil::getFileSize(fileName),
+                    8 == FsUtil::getFileSize(fileName));
+
+            ASSERT(0 == manager.deregisterObserver("batchObserver"));
+            mX->disableFileLogging();
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_FAIL(mX.setMaxBatchSize(0));
+            ASSERT_PASS(mX.setMaxBatchSize(1));
+
+            ASSERT_FAIL(mX.setFlushLatency(bsls::TimeInterval(0, -1)));
+            ASSERT_PASS(mX.setFlushLatency(bsls::TimeInterval(0,  0)));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
@@ -0,0 +1,1093 @@
+// ball_deferredlogger.cpp                                            -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogger_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_transmission.h>
+
+#include <bdls_processutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+
+#include <bsl_cstring.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+namespace {
+
+typedef ball::DeferredLogger_Argument Argument;
+
+const char k_BINARY_MAGIC[] = "BALLDLG1";
+    // characters beginning a stream written by 'writeBinary'
+
+enum {
+    k_BINARY_MAGIC_LENGTH = 8,          // length of 'k_BINARY_MAGIC'
+
+    k_MAX_STRING_LENGTH   = 1 << 20,    // longest string accepted by
+                                        // 'decodeBinary'
+
+    k_MAX_CAPACITY        = 1 << 30     // largest supported capacity
+};
+
+const char k_STRING_TAG = 'S';  // introduces a string definition
+const char k_RECORD_TAG = 'R';  // introduces a message
+
+                              // ==============
+                              // struct Message
+                              // ==============
+
+struct Message {
+    // This 'struct' describes a message to be formatted and published,
+    // independently of whether it was read from a ring buffer entry or a
+    // binary stream.
+
+    const char          *d_categoryName_p;  // category name
+    const char          *d_fileName_p;      // file name
+    const char          *d_format_p;        // 'printf'-style format
+    int                  d_lineNumber;      // line number
+    int                  d_severity;        // severity
+    bsls::Types::Int64   d_timestamp;       // microseconds since epoch
+    bsls::Types::Uint64  d_threadId;        // id of the logging thread
+    int                  d_numArguments;    // number of arguments
+    const Argument      *d_arguments_p;     // arguments
+    const char          *d_strings_p;       // storage of string arguments
+};
+
+                       // ---------------------------
+                       // Message Formatting Functions
+                       // ---------------------------
+
+template <class TYPE>
+void appendFormatted(bsl::string *result, const char *spec, TYPE value)
+    // Append to the specified 'result' the specified 'value' formatted
+    // according to the specified 'printf'-style conversion 'spec'.
+{
+    char buffer[128];
+
+    int length = ball::Log::format(buffer, sizeof buffer, spec, value);
+    if (0 <= length) {
+        result->append(buffer, length);
+        return;                                                       // RETURN
+    }
+
+    // The field width exceeds 'buffer'; retry with larger buffers.
+
+    bsl::vector<char> largeBuffer(result->get_allocator().mechanism());
+    bsl::size_t       size = sizeof buffer;
+    do {
+        size *= 2;
+        largeBuffer.resize(size);
+        length = ball::Log::format(largeBuffer.data(), size, spec, value);
+    } while (length < 0 && size < k_MAX_STRING_LENGTH);
+
+    result->append(largeBuffer.data());
+}
+
+bsls::Types::Int64 toInt64(const Argument& argument)
+    // Return the value of the specified 'argument' converted to a signed
+    // integer.  The behavior is undefined if 'argument' is a string.
+{
+    switch (argument.d_type) {
+      case Argument::e_INT64: {
+        return argument.d_int64;                                      // RETURN
+      }
+      case Argument::e_UINT64: {
+        return static_cast<bsls::Types::Int64>(argument.d_uint64);    // RETURN
+      }
+      case Argument::e_DOUBLE: {
+        return static_cast<bsls::Types::Int64>(argument.d_double);    // RETURN
+      }
+      default: {
+        BSLS_ASSERT(Argument::e_POINTER == argument.d_type);
+
+        return static_cast<bsls::Types::Int64>(
+                 reinterpret_cast<bsls::Types::UintPtr>(argument.d_pointer_p));
+                                                                      // RETURN
+      }
+    }
+}
+
+double toDouble(const Argument& argument)
+    // Return the value of the specified 'argument' converted to 'double'.  The
+    // behavior is undefined if 'argument' is a string.
+{
+    switch (argument.d_type) {
+      case Argument::e_DOUBLE: {
+        return argument.d_double;                                     // RETURN
+      }
+      case Argument::e_UINT64: {
+        return static_cast<double>(argument.d_uint64);                // RETURN
+      }
+      default: {
+        return static_cast<double>(toInt64(argument));                // RETURN
+      }
+    }
+}
+
+void appendArgument(bsl::string     *result,
+                    bsl::string     *spec,
+                    char             conversion,
+                    const Argument&  argument,
+                    const char      *strings)
+    // Append to the specified 'result' the specified 'argument' formatted
+    // according to the specified 'conversion' character and the specified
+    // 'spec', holding the '%' character and any flags, field width, and
+    // precision preceding 'conversion' in the format string.  String
+    // arguments are stored in the specified 'strings'.  Note that 'spec' is
+    // modified.
+{
+    if (Argument::e_STRING == argument.d_type) {
+        const char *string = strings + argument.d_offset;
+
+        if ('s' == conversion) {
+            *spec += 's';
+            appendFormatted(result, spec->c_str(), string);
+        }
+        else {
+            // The conversion does not match the argument; output the string.
+
+            result->append(string, argument.d_length);
+        }
+        return;                                                       // RETURN
+    }
+
+    switch (conversion) {
+      case 'd':
+      case 'i': {
+        *spec += "ll";
+        *spec += conversion;
+        appendFormatted(result, spec->c_str(), toInt64(argument));
+      } break;
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X': {
+        *spec += "ll";
+        *spec += conversion;
+        appendFormatted(result,
+                        spec->c_str(),
+                        static_cast<bsls::Types::Uint64>(toInt64(argument)));
+      } break;
+      case 'c': {
+        *spec += conversion;
+        appendFormatted(result,
+                        spec->c_str(),
+                        static_cast<int>(toInt64(argument)));
+      } break;
+      case 'p': {
+        *spec += conversion;
+        appendFormatted(
+                   result,
+                   spec->c_str(),
+                   Argument::e_POINTER == argument.d_type
+                   ? argument.d_pointer_p
+                   : reinterpret_cast<const void *>(
+                        static_cast<bsls::Types::UintPtr>(toInt64(argument))));
+      } break;
+      case 's': {
+        // The argument is not a string; output it in its natural format.
+
+        switch (argument.d_type) {
+          case Argument::e_INT64: {
+            appendFormatted(result, "%lld", argument.d_int64);
+          } break;
+          case Argument::e_UINT64: {
+            appendFormatted(result, "%llu", argument.d_uint64);
+          } break;
+          case Argument::e_DOUBLE: {
+            appendFormatted(result, "%g", argument.d_double);
+          } break;
+          default: {
+            appendFormatted(result, "%p", argument.d_pointer_p);
+          } break;
+        }
+      } break;
+      default: {
+        // floating-point conversions
+
+        *spec += conversion;
+        appendFormatted(result, spec->c_str(), toDouble(argument));
+      } break;
+    }
+}
+
+void formatMessage(bsl::string *result, const Message& message)
+    // Append to the specified 'result' the text of the specified 'message',
+    // produced by formatting its arguments according to its format.
+{
+    const char *format        = message.d_format_p;
+    int         argumentIndex = 0;
+
+    bsl::string spec(result->get_allocator());
+
+    while (*format) {
+        if ('%' != *format) {
+            const char *next = bsl::strchr(format, '%');
+            if (!next) {
+                result->append(format);
+                break;
+            }
+            result->append(format, next);
+            format = next;
+        }
+
+        const char *conversionBegin = format++;
+
+        if ('%' == *format) {
+            *result += '%';
+            ++format;
+            continue;
+        }
+
+        // Gather the flags, field width, and precision, and skip the length
+        // modifiers, which are irrelevant to the captured arguments.
+
+        spec.assign(1, '%');
+        while (*format && bsl::strchr("-+ #0123456789.", *format)) {
+            spec += *format++;
+        }
+        while (*format && bsl::strchr("hlLqjzt", *format)) {
+            ++format;
+        }
+
+        const char conversion = *format;
+        if (!conversion) {
+            result->append(conversionBegin);
+            break;
+        }
+        ++format;
+
+        if (!bsl::strchr("diouxXeEfFgGaAcsp", conversion)
+         || argumentIndex >= message.d_numArguments) {
+            // Unsupported conversion, or no argument: output it verbatim.
+
+            result->append(conversionBegin, format);
+            continue;
+        }
+
+        appendArgument(result,
+                       &spec,
+                       conversion,
+                       message.d_arguments_p[argumentIndex++],
+                       message.d_strings_p);
+    }
+}
+
+void publishMessage(ball::Observer   *observer,
+                    const Message&    message,
+                    int               processId,
+                    bslma::Allocator *allocator)
+    // Format the specified 'message', logged by the process having the
+    // specified 'processId', into a record allocated from the specified
+    // 'allocator', and publish the record to the specified 'observer'.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(allocator, allocator);
+
+    bdlt::Datetime timestamp = bdlt::EpochUtil::epoch();
+    timestamp.addMicroseconds(message.d_timestamp);
+
+    bsl::string text(allocator);
+    formatMessage(&text, message);
+
+    ball::RecordAttributes& attributes = record->fixedFields();
+    attributes.setTimestamp(timestamp);
+    attributes.setProcessID(processId);
+    attributes.setThreadID(message.d_threadId);
+    attributes.setFileName(message.d_fileName_p);
+    attributes.setLineNumber(message.d_lineNumber);
+    attributes.setCategory(message.d_categoryName_p);
+    attributes.setSeverity(message.d_severity);
+    attributes.setMessage(text.c_str());
+
+    observer->publish(record,
+                      ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+}
+
+Message toMessage(const ball::DeferredLogger_Entry& entry)
+    // Return a description of the message held by the specified 'entry'.
+{
+    Message message;
+    message.d_categoryName_p = entry.d_category_p->categoryName();
+    message.d_fileName_p     = entry.d_fileName_p;
+    message.d_format_p       = entry.d_format_p;
+    message.d_lineNumber     = entry.d_lineNumber;
+    message.d_severity       = entry.d_severity;
+    message.d_timestamp      = entry.d_timestamp;
+    message.d_threadId       = entry.d_threadId;
+    message.d_numArguments   = entry.d_numArguments;
+    message.d_arguments_p    = entry.d_arguments;
+    message.d_strings_p      = entry.d_strings;
+    return message;
+}
+
+                             // ================
+                             // struct Publisher
+                             // ================
+
+struct Publisher {
+    // This 'struct' provides a visitor that formats ring buffer entries and
+    // publishes them to an observer.
+
+    // DATA
+    ball::Observer   *d_observer_p;   // observer (held, not owned)
+    int               d_processId;    // id of this process
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // MANIPULATORS
+    void operator()(const ball::DeferredLogger_Entry& entry)
+        // Format the specified 'entry' and publish it.
+    {
+        publishMessage(d_observer_p,
+                       toMessage(entry),
+                       d_processId,
+                       d_allocator_p);
+    }
+};
+
+                        // ------------------------
+                        // Binary Encoding Functions
+                        // ------------------------
+
+bsls::Types::Uint64 zigZagEncode(bsls::Types::Int64 value)
+    // Return the "zig-zag" encoding of the specified 'value', which maps
+    // signed values of small magnitude to small unsigned values.
+{
+    const bsls::Types::Uint64 bits = static_cast<bsls::Types::Uint64>(value);
+    return value < 0 ? ~(bits << 1) : bits << 1;
+}
+
+bsls::Types::Int64 zigZagDecode(bsls::Types::Uint64 value)
+    // Return the signed value whose "zig-zag" encoding is the specified
+    // 'value'.
+{
+    const bsls::Types::Uint64 bits = value & 1 ? ~(value >> 1) : value >> 1;
+    return static_cast<bsls::Types::Int64>(bits);
+}
+
+void appendVarint(bsl::string *output, bsls::Types::Uint64 value)
+    // Append the LEB128 encoding of the specified 'value' to the specified
+    // 'output'.
+{
+    while (value >= 0x80) {
+        *output += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    *output += static_cast<char>(value);
+}
+
+void appendDouble(bsl::string *output, double value)
+    // Append the IEEE-754 representation of the specified 'value', least
+    // significant byte first, to the specified 'output'.
+{
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    for (int i = 0; i < 8; ++i) {
+        *output += static_cast<char>(bits & 0xFF);
+        bits >>= 8;
+    }
+}
+
+                            // ==================
+                            // class BinaryWriter
+                            // ==================
+
+class BinaryWriter {
+    // This class provides a visitor that encodes ring buffer entries in the
+    // binary log format, defining each string the first time it is referred
+    // to, and writes them to a stream.
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_map<const void *, unsigned int> StringIdMap;
+
+    // DATA
+    bsl::streambuf *d_output_p;      // output stream (held, not owned)
+    StringIdMap    *d_stringIds_p;   // ids of defined strings (held, not
+                                     // owned)
+    bsl::string     d_buffer;        // encoding of the current entry
+    bool            d_isValid;       // 'false' if a write failed
+
+    // PRIVATE MANIPULATORS
+    unsigned int stringId(const char *string);
+        // Return the id of the specified 'string', first appending its
+        // definition to the buffer if it is not yet defined.
+
+  private:
+    // NOT IMPLEMENTED
+    BinaryWriter(const BinaryWriter&);
+    BinaryWriter& operator=(const BinaryWriter&);
+
+  public:
+    // CREATORS
+    BinaryWriter(bsl::streambuf   *output,
+                 StringIdMap      *stringIds,
+                 bslma::Allocator *allocator);
+        // Create a writer of the specified 'output' stream, in which the
+        // strings of the specified 'stringIds' are defined, using the
+        // specified 'allocator' to supply memory.
+
+    // MANIPULATORS
+    void operator()(const ball::DeferredLogger_Entry& entry);
+        // Write the specified 'entry' to the output stream.
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if every write to the output stream succeeded, and
+        // 'false' otherwise.
+};
+
+                            // ------------------
+                            // class BinaryWriter
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+unsigned int BinaryWriter::stringId(const char *string)
+{
+    StringIdMap::const_iterator it = d_stringIds_p->find(string);
+    if (d_stringIds_p->end() != it) {
+        return it->second;                                            // RETURN
+    }
+
+    const unsigned int id = static_cast<unsigned int>(d_stringIds_p->size());
+    d_stringIds_p->insert(bsl::make_pair(static_cast<const void *>(string),
+                                         id));
+
+    const bsl::size_t length = bsl::strlen(string);
+
+    d_buffer += k_STRING_TAG;
+    appendVarint(&d_buffer, id);
+    appendVarint(&d_buffer, length);
+    d_buffer.append(string, length);
+
+    return id;
+}
+
+// CREATORS
+BinaryWriter::BinaryWriter(bsl::streambuf   *output,
+                           StringIdMap      *stringIds,
+                           bslma::Allocator *allocator)
+: d_output_p(output)
+, d_stringIds_p(stringIds)
+, d_buffer(allocator)
+, d_isValid(true)
+{
+}
+
+// MANIPULATORS
+void BinaryWriter::operator()(const ball::DeferredLogger_Entry& entry)
+{
+    d_buffer.clear();
+
+    const unsigned int categoryId =
+                                  stringId(entry.d_category_p->categoryName());
+    const unsigned int fileId     = stringId(entry.d_fileName_p);
+    const unsigned int formatId   = stringId(entry.d_format_p);
+
+    d_buffer += k_RECORD_TAG;
+    appendVarint(&d_buffer, categoryId);
+    appendVarint(&d_buffer, fileId);
+    appendVarint(&d_buffer, formatId);
+    appendVarint(&d_buffer, zigZagEncode(entry.d_lineNumber));
+    appendVarint(&d_buffer, zigZagEncode(entry.d_severity));
+    appendVarint(&d_buffer, zigZagEncode(entry.d_timestamp));
+    appendVarint(&d_buffer, entry.d_threadId);
+    appendVarint(&d_buffer, entry.d_numArguments);
+
+    for (int i = 0; i < entry.d_numArguments; ++i) {
+        const Argument& argument = entry.d_arguments[i];
+
+        d_buffer += static_cast<char>(argument.d_type);
+
+        switch (argument.d_type) {
+          case Argument::e_INT64: {
+            appendVarint(&d_buffer, zigZagEncode(argument.d_int64));
+          } break;
+          case Argument::e_UINT64: {
+            appendVarint(&d_buffer, argument.d_uint64);
+          } break;
+          case Argument::e_DOUBLE: {
+            appendDouble(&d_buffer, argument.d_double);
+          } break;
+          case Argument::e_POINTER: {
+            appendVarint(&d_buffer,
+                         reinterpret_cast<bsls::Types::UintPtr>(
+                                                       argument.d_pointer_p));
+          } break;
+          default: {
+            BSLS_ASSERT(Argument::e_STRING == argument.d_type);
+
+            appendVarint(&d_buffer, argument.d_length);
+            d_buffer.append(entry.d_strings + argument.d_offset,
+                            argument.d_length);
+          } break;
+        }
+    }
+
+    const bsl::streamsize length =
+                                 static_cast<bsl::streamsize>(d_buffer.size());
+    if (d_isValid && length != d_output_p->sputn(d_buffer.data(), length)) {
+        d_isValid = false;
+    }
+}
+
+// ACCESSORS
+bool BinaryWriter::isValid() const
+{
+    return d_isValid;
+}
+
+                            // ==================
+                            // class BinaryReader
+                            // ==================
+
+class BinaryReader {
+    // This class provides functions that read the elements of the binary log
+    // format from a stream.  Each function returns 0 on success, and a
+    // non-zero value if the stream does not hold a valid element.
+
+    // DATA
+    bsl::streambuf *d_input_p;  // input stream (held, not owned)
+
+  public:
+    // CREATORS
+    explicit BinaryReader(bsl::streambuf *input);
+        // Create a reader of the specified 'input' stream.
+
+    // MANIPULATORS
+    int readByte(int *result);
+        // Load into the specified 'result' the next byte of the stream.
+
+    int readVarint(bsls::Types::Uint64 *result);
+        // Load into the specified 'result' the next LEB128-encoded integer of
+        // the stream.
+
+    template <class INTEGER>
+    int readVarint(INTEGER *result, bsls::Types::Uint64 maxValue);
+        // Load into the specified 'result' the next LEB128-encoded integer of
+        // the stream, failing if it exceeds the specified 'maxValue'.
+
+    int readSignedVarint(bsls::Types::Int64 *result);
+        // Load into the specified 'result' the next "zig-zag" and LEB128
+        // encoded integer of the stream.
+
+    int readDouble(double *result);
+        // Load into the specified 'result' the next 8-byte IEEE-754 value of
+        // the stream.
+
+    int readString(bsl::string *result);
+        // Append to the specified 'result' the next length-prefixed string of
+        // the stream.
+};
+
+                            // ------------------
+                            // class BinaryReader
+                            // ------------------
+
+// CREATORS
+BinaryReader::BinaryReader(bsl::streambuf *input)
+: d_input_p(input)
+{
+}
+
+// MANIPULATORS
+int BinaryReader::readByte(int *result)
+{
+    const int byte = d_input_p->sbumpc();
+    if (bsl::streambuf::traits_type::eof() == byte) {
+        return -1;                                                    // RETURN
+    }
+    *result = byte;
+    return 0;
+}
+
+int BinaryReader::readVarint(bsls::Types::Uint64 *result)
+{
+    *result = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int byte;
+        if (0 != readByte(&byte)) {
+            return -1;                                                // RETURN
+        }
+        *result |= static_cast<bsls::Types::Uint64>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+template <class INTEGER>
+int BinaryReader::readVarint(INTEGER *result, bsls::Types::Uint64 maxValue)
+{
+    bsls::Types::Uint64 value;
+    if (0 != readVarint(&value) || value > maxValue) {
+        return -1;                                                    // RETURN
+    }
+    *result = static_cast<INTEGER>(value);
+    return 0;
+}
+
+int BinaryReader::readSignedVarint(bsls::Types::Int64 *result)
+{
+    bsls::Types::Uint64 value;
+    if (0 != readVarint(&value)) {
+        return -1;                                                    // RETURN
+    }
+    *result = zigZagDecode(value);
+    return 0;
+}
+
+int BinaryReader::readDouble(double *result)
+{
+    unsigned char bytes[8];
+    if (8 != d_input_p->sgetn(reinterpret_cast<char *>(bytes), 8)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsls::Types::Uint64 bits = 0;
+    for (int i = 7; 0 <= i; --i) {
+        bits = (bits << 8) | bytes[i];
+    }
+    bsl::memcpy(result, &bits, sizeof bits);
+    return 0;
+}
+
+int BinaryReader::readString(bsl::string *result)
+{
+    bsl::size_t length;
+    if (0 != readVarint(&length, k_MAX_STRING_LENGTH)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t offset = result->size();
+    result->resize(offset + length);
+
+    const bsl::streamsize numBytes = static_cast<bsl::streamsize>(length);
+    if (0 < length && numBytes != d_input_p->sgetn(&(*result)[offset],
+                                                   numBytes)) {
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+namespace ball {
+
+                            // --------------------
+                            // class DeferredLogger
+                            // --------------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Pointer
+                                         DeferredLogger::s_defaultLogger = {0};
+
+// PRIVATE MANIPULATORS
+DeferredLogger::Entry *DeferredLogger::beginEntry(
+                                                const Category&  category,
+                                                int              severity,
+                                                const char      *fileName,
+                                                int              lineNumber,
+                                                const char      *format)
+{
+    bsls::Types::Uint64 position = d_writePosition.loadRelaxed();
+
+    for (;;) {
+        const bsls::Types::Uint64 sequence =
+                                d_sequences_p[position & d_mask].loadAcquire();
+
+        if (sequence == position) {
+            const bsls::Types::Uint64 previous =
+                           d_writePosition.testAndSwap(position, position + 1);
+            if (previous == position) {
+                break;
+            }
+            position = previous;
+        }
+        else if (static_cast<bsls::Types::Int64>(sequence - position) < 0) {
+            // The entry has not yet been published since the ring buffer last
+            // wrapped around: the ring buffer is full.
+
+            d_numDropped.addRelaxed(1);
+            return 0;                                                 // RETURN
+        }
+        else {
+            position = d_writePosition.loadRelaxed();
+        }
+    }
+
+    Entry *entry = d_entries_p + (position & d_mask);
+
+    entry->d_position     = position;
+    entry->d_category_p   = &category;
+    entry->d_fileName_p   = fileName;
+    entry->d_format_p     = format;
+    entry->d_timestamp    =
+                      bsls::SystemTime::nowRealtimeClock().totalMicroseconds();
+    entry->d_threadId     = bslmt::ThreadUtil::selfIdAsUint64();
+    entry->d_lineNumber   = lineNumber;
+    entry->d_severity     = severity;
+    entry->d_numArguments = 0;
+    entry->d_stringLength = 0;
+
+    return entry;
+}
+
+void DeferredLogger::commitEntry(Entry *entry)
+{
+    d_sequences_p[entry->d_position & d_mask].storeRelease(
+                                                       entry->d_position + 1);
+}
+
+template <class VISITOR>
+int DeferredLogger::consume(VISITOR *visitor, int maxNumRecords)
+{
+    int numVisited = 0;
+
+    while (numVisited < maxNumRecords) {
+        bsls::AtomicUint64& sequence =
+                                    d_sequences_p[d_readPosition & d_mask];
+        if (sequence.loadAcquire() != d_readPosition + 1) {
+            break;
+        }
+
+        (*visitor)(d_entries_p[d_readPosition & d_mask]);
+
+        sequence.storeRelease(d_readPosition + d_mask + 1);
+        ++d_readPosition;
+        ++numVisited;
+    }
+
+    return numVisited;
+}
+
+// CLASS METHODS
+DeferredLogger *DeferredLogger::setDefaultLogger(DeferredLogger *logger)
+{
+    return static_cast<DeferredLogger *>(
+              bsls::AtomicOperations::swapPtrAcqRel(&s_defaultLogger, logger));
+}
+
+int DeferredLogger::decodeBinary(Observer         *observer,
+                                 bsl::streambuf   *input,
+                                 bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(input);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    char magic[k_BINARY_MAGIC_LENGTH];
+    if (k_BINARY_MAGIC_LENGTH != input->sgetn(magic, k_BINARY_MAGIC_LENGTH)
+     || 0 != bsl::memcmp(magic, k_BINARY_MAGIC, k_BINARY_MAGIC_LENGTH)) {
+        return -1;                                                    // RETURN
+    }
+
+    BinaryReader reader(input);
+
+    int processId;
+    if (0 != reader.readVarint(&processId, INT_MAX)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<bsl::string> strings(allocator);
+    bsl::string              argumentStrings(allocator);
+    Argument                 arguments[k_MAX_NUM_ARGUMENTS];
+
+    int numPublished = 0;
+    int tag;
+    while (0 == reader.readByte(&tag)) {
+        if (k_STRING_TAG == tag) {
+            bsl::size_t id;
+            if (0 != reader.readVarint(&id, strings.size())
+             || id != strings.size()) {
+                return -1;                                            // RETURN
+            }
+            strings.resize(id + 1);
+            if (0 != reader.readString(&strings.back())) {
+                return -1;                                            // RETURN
+            }
+            continue;
+        }
+
+        if (k_RECORD_TAG != tag) {
+            return -1;                                                // RETURN
+        }
+
+        const bsl::size_t  maxId = strings.size() - 1;
+        bsl::size_t        categoryId;
+        bsl::size_t        fileId;
+        bsl::size_t        formatId;
+        bsls::Types::Int64 lineNumber;
+        bsls::Types::Int64 severity;
+        Message            message;
+
+        if (strings.empty()
+         || 0 != reader.readVarint(&categoryId, maxId)
+         || 0 != reader.readVarint(&fileId, maxId)
+         || 0 != reader.readVarint(&formatId, maxId)
+         || 0 != reader.readSignedVarint(&lineNumber)
+         || 0 != reader.readSignedVarint(&severity)
+         || 0 != reader.readSignedVarint(&message.d_timestamp)
+         || 0 != reader.readVarint(&message.d_threadId)
+         || 0 != reader.readVarint(&message.d_numArguments,
+                                   k_MAX_NUM_ARGUMENTS)) {
+            return -1;                                                // RETURN
+        }
+
+        argumentStrings.clear();
+
+        for (int i = 0; i < message.d_numArguments; ++i) {
+            Argument& argument = arguments[i];
+
+            int type;
+            if (0 != reader.readByte(&type)) {
+                return -1;                                            // RETURN
+            }
+            argument.d_type = type;
+
+            int rc;
+            switch (type) {
+              case Argument::e_INT64: {
+                rc = reader.readSignedVarint(&argument.d_int64);
+              } break;
+              case Argument::e_UINT64: {
+                rc = reader.readVarint(&argument.d_uint64);
+              } break;
+              case Argument::e_DOUBLE: {
+                rc = reader.readDouble(&argument.d_double);
+              } break;
+              case Argument::e_POINTER: {
+                bsls::Types::Uint64 address;
+                rc = reader.readVarint(&address);
+                argument.d_pointer_p = reinterpret_cast<const void *>(
+                               static_cast<bsls::Types::UintPtr>(address));
+              } break;
+              case Argument::e_STRING: {
+                argument.d_offset = argumentStrings.size();
+                rc = reader.readString(&argumentStrings);
+                argument.d_length = static_cast<int>(argumentStrings.size() -
+                                                     argument.d_offset);
+                argumentStrings += '\0';
+              } break;
+              default: {
+                rc = -1;
+              } break;
+            }
+            if (0 != rc
+             || k_STRING_CAPACITY < static_cast<int>(argumentStrings.size())) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        if (lineNumber < 0 || INT_MAX < lineNumber
+         || severity < 0 || INT_MAX < severity) {
+            return -1;                                                // RETURN
+        }
+
+        bdlt::Datetime timestamp = bdlt::EpochUtil::epoch();
+        if (0 != timestamp.addMicrosecondsIfValid(message.d_timestamp)) {
+            return -1;                                                // RETURN
+        }
+
+        message.d_categoryName_p = strings[categoryId].c_str();
+        message.d_fileName_p     = strings[fileId].c_str();
+        message.d_format_p       = strings[formatId].c_str();
+        message.d_lineNumber     = static_cast<int>(lineNumber);
+        message.d_severity       = static_cast<int>(severity);
+        message.d_arguments_p    = arguments;
+        message.d_strings_p      = argumentStrings.c_str();
+
+        publishMessage(observer, message, processId, allocator);
+        ++numPublished;
+    }
+
+    return numPublished;
+}
+
+// CREATORS
+DeferredLogger::DeferredLogger(int capacity, bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_sequences_p(0)
+, d_mask(0)
+, d_writePosition(0)
+, d_readPosition(0)
+, d_numDropped(0)
+, d_binaryStringIds(basicAllocator)
+, d_binaryOutput_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(capacity <= k_MAX_CAPACITY);
+
+    bsls::Types::Uint64 numEntries = 1;
+    while (numEntries < static_cast<bsls::Types::Uint64>(capacity)) {
+        numEntries <<= 1;
+    }
+    d_mask = numEntries - 1;
+
+    d_entries_p = static_cast<Entry *>(
+                    d_allocator_p->allocate(
+                        static_cast<bsl::size_t>(numEntries * sizeof(Entry))));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_entries_p,
+                                                        d_allocator_p);
+
+    d_sequences_p = static_cast<bsls::AtomicUint64 *>(
+          d_allocator_p->allocate(static_cast<bsl::size_t>(
+                                numEntries * sizeof(bsls::AtomicUint64))));
+
+    for (bsls::Types::Uint64 i = 0; i < numEntries; ++i) {
+        new (d_sequences_p + i) bsls::AtomicUint64(i);
+    }
+
+    proctor.release();
+}
+
+DeferredLogger::~DeferredLogger()
+{
+    BSLS_ASSERT(this != defaultLogger());
+
+    d_allocator_p->deallocate(d_sequences_p);
+    d_allocator_p->deallocate(d_entries_p);
+}
+
+// MANIPULATORS
+int DeferredLogger::publish(Observer *observer, int maxNumRecords)
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(0 <= maxNumRecords);
+
+    static const int processId = bdls::ProcessUtil::getProcessId();
+
+    Publisher publisher = { observer, processId, d_allocator_p };
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_readMutex);
+
+    return consume(&publisher, maxNumRecords);
+}
+
+int DeferredLogger::writeBinary(bsl::streambuf *output, int maxNumRecords)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(0 <= maxNumRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_readMutex);
+
+    if (d_binaryOutput_p != output) {
+        // Start a new stream.
+
+        d_binaryStringIds.clear();
+        d_binaryOutput_p = 0;
+
+        bsl::string header(k_BINARY_MAGIC,
+                           k_BINARY_MAGIC_LENGTH,
+                           d_allocator_p);
+        appendVarint(&header,
+                     static_cast<bsls::Types::Uint64>(
+                                           bdls::ProcessUtil::getProcessId()));
+
+        const bsl::streamsize length =
+                                   static_cast<bsl::streamsize>(header.size());
+        if (length != output->sputn(header.data(), length)) {
+            return -1;                                                // RETURN
+        }
+        d_binaryOutput_p = output;
+    }
+
+    BinaryWriter writer(output, &d_binaryStringIds, d_allocator_p);
+
+    const int numWritten = consume(&writer, maxNumRecords);
+
+    if (!writer.isValid()) {
+        // The string definitions of the stream can no longer be relied upon;
+        // start a new stream on the next call.
+
+        d_binaryOutput_p = 0;
+        return -1;                                                    // RETURN
+    }
+
+    return numWritten;
+}
+
+                     // ---------------------------------
+                     // struct DeferredLogger_ArgumentUtil
+                     // ---------------------------------
+
+// CLASS METHODS
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         const char           *value)
+{
+    if (!value) {
+        value = "(null)";
+    }
+
+    DeferredLogger_Argument& argument =
+                                 entry->d_arguments[entry->d_numArguments++];
+
+    argument.d_type   = DeferredLogger_Argument::e_STRING;
+    argument.d_offset = entry->d_stringLength;
+
+    // Copy as much of 'value' as fits, leaving room for a null terminator.
+
+    const int available = DeferredLogger_Entry::k_STRING_CAPACITY
+                        - entry->d_stringLength
+                        - 1;
+    char     *storage   = entry->d_strings + entry->d_stringLength;
+    int       length    = 0;
+
+    if (0 <= available) {
+        while (length < available && value[length]) {
+            storage[length] = value[length];
+            ++length;
+        }
+        storage[length] = '\0';
+        entry->d_stringLength += length + 1;
+    }
+    else {
+        // No storage is left: refer to the null terminator of the previous
+        // string.
+
+        argument.d_offset = DeferredLogger_Entry::k_STRING_CAPACITY - 1;
+    }
+
+    argument.d_length = length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
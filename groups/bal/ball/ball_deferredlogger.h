@@ -0,0 +1,1120 @@
+// ball_deferredlogger.h                                              -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGGER
+#define INCLUDED_BALL_DEFERREDLOGGER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a logger that defers message formatting to publication.
+//
+//@CLASSES:
+//  ball::DeferredLogger: ring buffer of unformatted log messages
+//
+//@MACROS: BALL_LOGDEFER_TRACE, BALL_LOGDEFER_DEBUG, BALL_LOGDEFER_INFO,
+//         BALL_LOGDEFER_WARN,  BALL_LOGDEFER_ERROR, BALL_LOGDEFER_FATAL,
+//         BALL_LOGDEFER
+//
+//@SEE_ALSO: ball_log, ball_loggermanager, ball_observer
+//
+//@DESCRIPTION: This component provides a mechanism, 'ball::DeferredLogger',
+// that records log messages *without* formatting them.  A call to one of the
+// 'logMessage' methods captures the address of a 'printf'-style format string
+// and the raw values of (up to 'k_MAX_NUM_ARGUMENTS') arguments, together with
+// the category, severity, file name, line number, timestamp, and thread id of
+// the message, into a fixed-size entry of a ring buffer that is allocated at
+// construction.  No memory is allocated, and no text is formatted, on the
+// logging thread.
+//
+// The captured messages are formatted later, on the thread that calls
+// 'publish', which converts each pending entry into a 'ball::Record' and
+// passes it to an observer.  Alternatively, 'writeBinary' writes the pending
+// entries to a compact binary stream, which may be decoded -- possibly
+// offline, by a separate process -- by 'decodeBinary' (see
+// {Binary Log Format}).
+//
+// The 'BALL_LOGDEFER_*' macros provided by this component are the deferred
+// analogs of the 'BALL_LOGVA_*' macros of 'ball_log'.  They observe the
+// category established by 'BALL_LOG_SET_CATEGORY' (or one of its variants),
+// and its thresholds, in exactly the same way, but record the message to the
+// logger installed by 'ball::DeferredLogger::setDefaultLogger'.  If no logger
+// is installed, the macros format and log the message immediately, exactly
+// as 'BALL_LOGVA' does.
+//
+///Captured Arguments
+///------------------
+// Arguments of fundamental arithmetic types, 'const char *' strings, and
+// pointers are supported; use of any other argument type is a compile-time
+// error.  Integral arguments are captured as 64-bit values, and floating-point
+// arguments as 'double', so the length modifiers ('h', 'l', 'll', etc.) of the
+// conversion specifications in the format string are ignored, and a mismatch
+// between a conversion and the type of its argument is handled safely (unlike
+// with 'printf').  The characters of string arguments are copied into storage
+// within the entry; at most 'k_STRING_CAPACITY' bytes (including a null
+// terminator for each string) are available for all of the strings of one
+// message, and longer strings are truncated.  Conversions using '*' for the
+// field width or precision, and the '%n' conversion, are not supported, and
+// are copied verbatim to the formatted message, as are conversions for which
+// no argument was supplied.
+//
+// Note that only the *address* of the format string, and of the file name, is
+// captured.  Both must therefore remain valid until the message is published;
+// string literals, and the '__FILE__' supplied by the macros, satisfy this
+// requirement.
+//
+///Buffer Capacity
+///---------------
+// The capacity of the ring buffer is fixed at construction (rounded up to a
+// power of two).  A message logged while the ring buffer is full is discarded,
+// so that logging never blocks, and is counted by 'numDropped'.  Clients must
+// publish frequently enough to keep up with the rate at which messages are
+// logged.
+//
+///Binary Log Format
+///-----------------
+// The stream written by 'writeBinary' begins with the 8 characters 'BALLDLG1'
+// followed by the process id.  Each subsequent element is introduced by a
+// one-byte tag:
+//..
+//  'S' <id> <length> <bytes>     defines string <id> (category name, file
+//                                name, or format string)
+//
+//  'R' <category id> <file id> <format id> <line> <severity> <timestamp>
+//      <thread id> <number of arguments> (<type> <value>)*
+//                                a message referring to previously defined
+//                                strings
+//..
+// All integers are encoded as unsigned LEB128 variable-length integers
+// (signed values, i.e., the timestamp in microseconds since the Unix epoch
+// and signed integral arguments, are first "zig-zag" encoded), the type of
+// each argument is a single byte, 'double' values are encoded as the 8 bytes
+// of their IEEE-754 representation (least-significant byte first), and
+// string arguments are encoded as a length followed by their bytes.  Each
+// distinct category name, file name, and format string is defined once per
+// stream, so a message typically occupies just a few bytes more than its
+// arguments.
+//
+///Thread Safety
+///-------------
+// 'ball::DeferredLogger' is fully thread-safe: the 'logMessage' methods may be
+// called concurrently from any number of threads (they do not acquire a lock),
+// and may be called concurrently with 'publish' and 'writeBinary', which are
+// serialized with respect to each other.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging on a Latency-Sensitive Path
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a latency-sensitive function that logs a message for
+// each order it processes, and that we want to avoid the cost of formatting
+// those messages on the processing thread.
+//
+// First, we define the function, using the 'BALL_LOGDEFER_INFO' macro exactly
+// as we would use 'BALL_LOGVA_INFO':
+//..
+//  void processOrder(int orderId, double price, const char *symbol)
+//  {
+//      BALL_LOG_SET_CATEGORY("ORDERS");
+//
+//      BALL_LOGDEFER_INFO("order %d: %s at %.2f", orderId, symbol, price);
+//  }
+//..
+// Then, in 'main', we initialize the logger manager singleton, with a
+// 'ball::StreamObserver' writing to 'bsl::cout':
+//..
+//  ball::LoggerManagerConfiguration configuration;
+//  configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_INFO,
+//                                                 ball::Severity::e_INFO,
+//                                                 ball::Severity::e_OFF,
+//                                                 ball::Severity::e_OFF);
+//
+//  ball::LoggerManagerScopedGuard guard(configuration);
+//
+//  bsl::shared_ptr<ball::StreamObserver> observer =
+//                          bsl::make_shared<ball::StreamObserver>(&bsl::cout);
+//
+//  ball::LoggerManager::singleton().registerObserver(observer, "default");
+//..
+// Next, we create a deferred logger having room for 1024 pending messages,
+// and install it as the default logger used by the 'BALL_LOGDEFER_*' macros:
+//..
+//  ball::DeferredLogger deferredLogger(1024);
+//
+//  ball::DeferredLogger::setDefaultLogger(&deferredLogger);
+//..
+// Now, we process some orders.  Each call records its message in the ring
+// buffer of 'deferredLogger', without formatting it:
+//..
+//  processOrder(1, 100.25, "IBM");
+//  processOrder(2, 98.5,   "MSFT");
+//..
+// Finally, we publish the pending messages to 'observer' (typically, this is
+// done periodically by a dedicated thread), and uninstall the logger:
+//..
+//  int numPublished = deferredLogger.publish(observer.get());
+//  assert(2 == numPublished);
+//
+//  ball::DeferredLogger::setDefaultLogger(0);
+//..
+// The messages published to 'observer' are "order 1: IBM at 100.25" and
+// "order 2: MSFT at 98.50", and have the timestamps and thread id recorded
+// when 'processOrder' was called.
+
+#include <balscm_version.h>
+
+#include <ball_category.h>
+#include <ball_log.h>
+#include <ball_severity.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_streambuf.h>
+#include <bsl_unordered_map.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Observer;
+
+                       // ==============================
+                       // struct DeferredLogger_Argument
+                       // ==============================
+
+struct DeferredLogger_Argument {
+    // This component-private 'struct' holds the value of one argument of a
+    // message recorded by a 'DeferredLogger'.
+
+    // TYPES
+    enum Type {
+        e_INT64,    // 'd_int64'
+        e_UINT64,   // 'd_uint64'
+        e_DOUBLE,   // 'd_double'
+        e_POINTER,  // 'd_pointer'
+        e_STRING    // 'd_offset' and 'd_length' within the string storage
+    };
+
+    // DATA
+    int                         d_type;      // 'Type' of the argument
+
+    int                         d_length;    // length of a string argument
+
+    union {
+        bsls::Types::Int64      d_int64;
+        bsls::Types::Uint64     d_uint64;
+        double                  d_double;
+        const void             *d_pointer_p;
+        bsls::Types::Int64      d_offset;
+    };
+};
+
+                        // ===========================
+                        // struct DeferredLogger_Entry
+                        // ===========================
+
+struct DeferredLogger_Entry {
+    // This component-private 'struct' holds one message recorded by a
+    // 'DeferredLogger'.
+
+    // CONSTANTS
+    enum {
+        k_MAX_NUM_ARGUMENTS = 8,    // maximum number of arguments
+        k_STRING_CAPACITY   = 128   // bytes available for string arguments
+    };
+
+    // DATA
+    bsls::Types::Uint64      d_position;        // position in the ring buffer
+
+    const Category          *d_category_p;      // category (held, not owned)
+
+    const char              *d_fileName_p;      // file name (held, not owned)
+
+    const char              *d_format_p;        // format (held, not owned)
+
+    bsls::Types::Int64       d_timestamp;       // microseconds since epoch
+
+    bsls::Types::Uint64      d_threadId;        // id of the logging thread
+
+    int                      d_lineNumber;      // line number
+
+    int                      d_severity;        // severity
+
+    int                      d_numArguments;    // number of arguments
+
+    int                      d_stringLength;    // bytes used in 'd_strings'
+
+    DeferredLogger_Argument  d_arguments[k_MAX_NUM_ARGUMENTS];
+                                                // arguments
+
+    char                     d_strings[k_STRING_CAPACITY];
+                                                // null-terminated characters
+                                                // of string arguments
+};
+
+                     // =================================
+                     // struct DeferredLogger_ArgumentUtil
+                     // =================================
+
+struct DeferredLogger_ArgumentUtil {
+    // This component-private utility 'struct' provides a suite of functions
+    // that append an argument to a 'DeferredLogger_Entry'.  Each function
+    // has undefined behavior unless the entry holds fewer than
+    // 'DeferredLogger_Entry::k_MAX_NUM_ARGUMENTS' arguments.
+
+  private:
+    // PRIVATE CLASS METHODS
+    static void appendInt64(DeferredLogger_Entry *entry,
+                            bsls::Types::Int64    value);
+    static void appendUint64(DeferredLogger_Entry *entry,
+                             bsls::Types::Uint64   value);
+    static void appendDouble(DeferredLogger_Entry *entry, double value);
+    static void appendPointer(DeferredLogger_Entry *entry, const void *value);
+        // Append the specified 'value' to the arguments of the specified
+        // 'entry'.
+
+  public:
+    // CLASS METHODS
+    static void append(DeferredLogger_Entry *entry, bool value);
+    static void append(DeferredLogger_Entry *entry, char value);
+    static void append(DeferredLogger_Entry *entry, signed char value);
+    static void append(DeferredLogger_Entry *entry, unsigned char value);
+    static void append(DeferredLogger_Entry *entry, short value);
+    static void append(DeferredLogger_Entry *entry, unsigned short value);
+    static void append(DeferredLogger_Entry *entry, int value);
+    static void append(DeferredLogger_Entry *entry, unsigned int value);
+    static void append(DeferredLogger_Entry *entry, long value);
+    static void append(DeferredLogger_Entry *entry, unsigned long value);
+    static void append(DeferredLogger_Entry *entry,
+                       bsls::Types::Int64    value);
+    static void append(DeferredLogger_Entry *entry,
+                       bsls::Types::Uint64   value);
+    static void append(DeferredLogger_Entry *entry, float value);
+    static void append(DeferredLogger_Entry *entry, double value);
+    static void append(DeferredLogger_Entry *entry, long double value);
+    static void append(DeferredLogger_Entry *entry, const void *value);
+    template <class TYPE>
+    static void append(DeferredLogger_Entry *entry, const TYPE *value);
+        // Append the specified 'value' to the arguments of the specified
+        // 'entry'.
+
+    static void append(DeferredLogger_Entry *entry, const char *value);
+        // Append a copy of the specified null-terminated 'value' to the
+        // arguments of the specified 'entry', truncating it if the string
+        // storage of 'entry' is insufficient.  If 'value' is null, append the
+        // string "(null)".
+};
+
+                            // ====================
+                            // class DeferredLogger
+                            // ====================
+
+class DeferredLogger {
+    // This class provides a mechanism that records log messages, and the
+    // values of their arguments, into a fixed-size ring buffer without
+    // formatting them, and that formats the recorded messages when they are
+    // published.  This class is fully thread-safe (see {Thread Safety}).
+
+    // PRIVATE TYPES
+    typedef DeferredLogger_Entry                         Entry;
+    typedef DeferredLogger_ArgumentUtil                  ArgumentUtil;
+    typedef bsl::unordered_map<const void *, unsigned int> StringIdMap;
+
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Pointer s_defaultLogger;
+                                              // logger used by the macros
+
+    // DATA
+    Entry                *d_entries_p;        // ring buffer (owned)
+
+    bsls::AtomicUint64   *d_sequences_p;      // state of each entry (owned)
+
+    bsls::Types::Uint64   d_mask;             // capacity minus one
+
+    bsls::AtomicUint64    d_writePosition;    // next position to write
+
+    bsls::Types::Uint64   d_readPosition;     // next position to read
+
+    bsls::AtomicInt64     d_numDropped;       // number of discarded messages
+
+    bslmt::Mutex          d_readMutex;        // serializes readers
+
+    StringIdMap           d_binaryStringIds;  // ids of strings defined in
+                                              // 'd_binaryOutput_p'
+
+    bsl::streambuf       *d_binaryOutput_p;   // stream last written by
+                                              // 'writeBinary' (held, not
+                                              // owned)
+
+    bslma::Allocator     *d_allocator_p;      // memory allocator (held, not
+                                              // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    DeferredLogger(const DeferredLogger&);
+    DeferredLogger& operator=(const DeferredLogger&);
+
+    // PRIVATE MANIPULATORS
+    Entry *beginEntry(const Category&  category,
+                      int              severity,
+                      const char      *fileName,
+                      int              lineNumber,
+                      const char      *format);
+        // Reserve an entry of the ring buffer, fill its fixed fields with the
+        // specified 'category', 'severity', 'fileName', 'lineNumber', and
+        // 'format', and the current time and thread id, and return its
+        // address, or return 0 (and count the message as dropped) if the ring
+        // buffer is full.
+
+    void commitEntry(Entry *entry);
+        // Make the specified 'entry', previously returned by 'beginEntry',
+        // available for publication.
+
+    template <class VISITOR>
+    int consume(VISITOR *visitor, int maxNumRecords);
+        // Invoke the specified 'visitor' on each pending entry, in the order
+        // in which they were committed, until there are no pending entries or
+        // 'maxNumRecords' entries were visited, releasing each entry after it
+        // is visited, and return the number of entries visited.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DeferredLogger, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_NUM_ARGUMENTS = Entry::k_MAX_NUM_ARGUMENTS,
+            // maximum number of arguments of a message
+
+        k_STRING_CAPACITY   = Entry::k_STRING_CAPACITY
+            // bytes available for the string arguments of a message
+    };
+
+    // CLASS METHODS
+    static DeferredLogger *defaultLogger();
+        // Return the address of the logger used by the 'BALL_LOGDEFER_*'
+        // macros, or 0 if there is none.
+
+    static DeferredLogger *setDefaultLogger(DeferredLogger *logger);
+        // Install the specified 'logger' as the logger used by the
+        // 'BALL_LOGDEFER_*' macros, and return the address of the previously
+        // installed logger (or 0 if there was none).  Specify 0 to uninstall
+        // the current logger, in which case the macros format and log their
+        // messages immediately.  The behavior is undefined unless 'logger'
+        // remains valid until it is uninstalled and no thread is using it.
+
+    static int decodeBinary(Observer         *observer,
+                            bsl::streambuf   *input,
+                            bslma::Allocator *basicAllocator = 0);
+        // Read the messages written by 'writeBinary' from the specified
+        // 'input' stream, format them, and publish them to the specified
+        // 'observer'.  Return the number of messages published if the entire
+        // contents of 'input' were decoded successfully, and a negative value
+        // otherwise.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    // CREATORS
+    explicit DeferredLogger(int               capacity,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a deferred logger able to hold at least the specified
+        // 'capacity' pending messages.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '0 < capacity'.
+
+    ~DeferredLogger();
+        // Destroy this object.  Messages that are still pending are
+        // discarded.  The behavior is undefined if this object is the default
+        // logger.
+
+    // MANIPULATORS
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format);
+    template <class A1>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1);
+    template <class A1, class A2>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2);
+    template <class A1, class A2, class A3>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2,
+                    const A3&        a3);
+    template <class A1, class A2, class A3, class A4>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2,
+                    const A3&        a3,
+                    const A4&        a4);
+    template <class A1, class A2, class A3, class A4, class A5>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2,
+                    const A3&        a3,
+                    const A4&        a4,
+                    const A5&        a5);
+    template <class A1, class A2, class A3, class A4, class A5, class A6>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2,
+                    const A3&        a3,
+                    const A4&        a4,
+                    const A5&        a5,
+                    const A6&        a6);
+    template <class A1,
+              class A2,
+              class A3,
+              class A4,
+              class A5,
+              class A6,
+              class A7>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2,
+                    const A3&        a3,
+                    const A4&        a4,
+                    const A5&        a5,
+                    const A6&        a6,
+                    const A7&        a7);
+    template <class A1,
+              class A2,
+              class A3,
+              class A4,
+              class A5,
+              class A6,
+              class A7,
+              class A8>
+    void logMessage(const Category&  category,
+                    int              severity,
+                    const char      *fileName,
+                    int              lineNumber,
+                    const char      *format,
+                    const A1&        a1,
+                    const A2&        a2,
+                    const A3&        a3,
+                    const A4&        a4,
+                    const A5&        a5,
+                    const A6&        a6,
+                    const A7&        a7,
+                    const A8&        a8);
+        // Record a message having the specified 'category', 'severity',
+        // 'fileName', 'lineNumber', and 'printf'-style 'format', and the
+        // (optionally) specified arguments 'a1' up to 'a8', for later
+        // publication, or discard the message if the ring buffer of this
+        // logger is full.  The behavior is undefined unless 'category'
+        // remains valid, and 'fileName' and 'format' are null-terminated
+        // strings that remain unmodified, until the message is published or
+        // written.  Note that the thresholds of 'category' are *not* consulted
+        // (see 'BALL_LOGDEFER').
+
+    int publish(Observer *observer, int maxNumRecords = INT_MAX);
+        // Format the pending messages of this logger, in the order in which
+        // they were recorded, and publish each to the specified 'observer'
+        // as a 'ball::Record' having a "pass-through" context.  Optionally
+        // specify 'maxNumRecords', the maximum number of messages to publish.
+        // Return the number of messages published.
+
+    int writeBinary(bsl::streambuf *output, int maxNumRecords = INT_MAX);
+        // Write the pending messages of this logger, in the order in which
+        // they were recorded, to the specified 'output' stream in the format
+        // described in {Binary Log Format}.  Optionally specify
+        // 'maxNumRecords', the maximum number of messages to write.  Return
+        // the number of messages written, or a negative value if an error
+        // occurred writing to 'output' (in which case the messages are
+        // lost).  If 'output' is not the stream specified by the previous
+        // call to this method, first write the header of the format, and
+        // define each string anew.  The behavior is undefined unless 'output'
+        // is written to only by this method, and, if it is the stream
+        // specified by the previous call, refers to the same stream.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of pending messages of this logger.
+
+    bsls::Types::Int64 numDropped() const;
+        // Return the number of messages discarded because the ring buffer of
+        // this logger was full.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // ---------------------------------
+                     // struct DeferredLogger_ArgumentUtil
+                     // ---------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+void DeferredLogger_ArgumentUtil::appendInt64(DeferredLogger_Entry *entry,
+                                              bsls::Types::Int64    value)
+{
+    DeferredLogger_Argument& argument =
+                                 entry->d_arguments[entry->d_numArguments++];
+    argument.d_type  = DeferredLogger_Argument::e_INT64;
+    argument.d_int64 = value;
+}
+
+inline
+void DeferredLogger_ArgumentUtil::appendUint64(DeferredLogger_Entry *entry,
+                                               bsls::Types::Uint64   value)
+{
+    DeferredLogger_Argument& argument =
+                                 entry->d_arguments[entry->d_numArguments++];
+    argument.d_type   = DeferredLogger_Argument::e_UINT64;
+    argument.d_uint64 = value;
+}
+
+inline
+void DeferredLogger_ArgumentUtil::appendDouble(DeferredLogger_Entry *entry,
+                                               double                value)
+{
+    DeferredLogger_Argument& argument =
+                                 entry->d_arguments[entry->d_numArguments++];
+    argument.d_type   = DeferredLogger_Argument::e_DOUBLE;
+    argument.d_double = value;
+}
+
+inline
+void DeferredLogger_ArgumentUtil::appendPointer(DeferredLogger_Entry *entry,
+                                                const void           *value)
+{
+    DeferredLogger_Argument& argument =
+                                 entry->d_arguments[entry->d_numArguments++];
+    argument.d_type      = DeferredLogger_Argument::e_POINTER;
+    argument.d_pointer_p = value;
+}
+
+// CLASS METHODS
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         bool                  value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         char                  value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         signed char           value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         unsigned char         value)
+{
+    appendUint64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         short                 value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         unsigned short        value)
+{
+    appendUint64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         int                   value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         unsigned int          value)
+{
+    appendUint64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         long                  value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         unsigned long         value)
+{
+    appendUint64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         bsls::Types::Int64    value)
+{
+    appendInt64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         bsls::Types::Uint64   value)
+{
+    appendUint64(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         float                 value)
+{
+    appendDouble(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         double                value)
+{
+    appendDouble(entry, value);
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         long double           value)
+{
+    appendDouble(entry, static_cast<double>(value));
+}
+
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         const void           *value)
+{
+    appendPointer(entry, value);
+}
+
+template <class TYPE>
+inline
+void DeferredLogger_ArgumentUtil::append(DeferredLogger_Entry *entry,
+                                         const TYPE           *value)
+{
+    appendPointer(entry, static_cast<const void *>(value));
+}
+
+                            // --------------------
+                            // class DeferredLogger
+                            // --------------------
+
+// CLASS METHODS
+inline
+DeferredLogger *DeferredLogger::defaultLogger()
+{
+    return static_cast<DeferredLogger *>(
+                bsls::AtomicOperations::getPtrAcquire(&s_defaultLogger));
+}
+
+// MANIPULATORS
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        commitEntry(entry);
+    }
+}
+
+template <class A1>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        commitEntry(entry);
+    }
+}
+
+template <class A1, class A2>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        commitEntry(entry);
+    }
+}
+
+template <class A1, class A2, class A3>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2,
+                                const A3&        a3)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        ArgumentUtil::append(entry, a3);
+        commitEntry(entry);
+    }
+}
+
+template <class A1, class A2, class A3, class A4>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2,
+                                const A3&        a3,
+                                const A4&        a4)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        ArgumentUtil::append(entry, a3);
+        ArgumentUtil::append(entry, a4);
+        commitEntry(entry);
+    }
+}
+
+template <class A1, class A2, class A3, class A4, class A5>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2,
+                                const A3&        a3,
+                                const A4&        a4,
+                                const A5&        a5)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        ArgumentUtil::append(entry, a3);
+        ArgumentUtil::append(entry, a4);
+        ArgumentUtil::append(entry, a5);
+        commitEntry(entry);
+    }
+}
+
+template <class A1, class A2, class A3, class A4, class A5, class A6>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2,
+                                const A3&        a3,
+                                const A4&        a4,
+                                const A5&        a5,
+                                const A6&        a6)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        ArgumentUtil::append(entry, a3);
+        ArgumentUtil::append(entry, a4);
+        ArgumentUtil::append(entry, a5);
+        ArgumentUtil::append(entry, a6);
+        commitEntry(entry);
+    }
+}
+
+template <class A1,
+          class A2,
+          class A3,
+          class A4,
+          class A5,
+          class A6,
+          class A7>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2,
+                                const A3&        a3,
+                                const A4&        a4,
+                                const A5&        a5,
+                                const A6&        a6,
+                                const A7&        a7)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        ArgumentUtil::append(entry, a3);
+        ArgumentUtil::append(entry, a4);
+        ArgumentUtil::append(entry, a5);
+        ArgumentUtil::append(entry, a6);
+        ArgumentUtil::append(entry, a7);
+        commitEntry(entry);
+    }
+}
+
+template <class A1,
+          class A2,
+          class A3,
+          class A4,
+          class A5,
+          class A6,
+          class A7,
+          class A8>
+inline
+void DeferredLogger::logMessage(const Category&  category,
+                                int              severity,
+                                const char      *fileName,
+                                int              lineNumber,
+                                const char      *format,
+                                const A1&        a1,
+                                const A2&        a2,
+                                const A3&        a3,
+                                const A4&        a4,
+                                const A5&        a5,
+                                const A6&        a6,
+                                const A7&        a7,
+                                const A8&        a8)
+{
+    if (Entry *entry = beginEntry(category,
+                                  severity,
+                                  fileName,
+                                  lineNumber,
+                                  format)) {
+        ArgumentUtil::append(entry, a1);
+        ArgumentUtil::append(entry, a2);
+        ArgumentUtil::append(entry, a3);
+        ArgumentUtil::append(entry, a4);
+        ArgumentUtil::append(entry, a5);
+        ArgumentUtil::append(entry, a6);
+        ArgumentUtil::append(entry, a7);
+        ArgumentUtil::append(entry, a8);
+        commitEntry(entry);
+    }
+}
+
+// ACCESSORS
+inline
+int DeferredLogger::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+inline
+bsls::Types::Int64 DeferredLogger::numDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DeferredLogger::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+                 // ====================================
+                 // Implementation Details: Do *NOT* Use
+                 // ====================================
+
+#define BALL_LOGDEFER_LOG_IMP(CATEGORYHOLDER, SEVERITY, ...)                  \
+    if (BloombergLP::ball::DeferredLogger *ball_logdefer_lOgGeR =             \
+                  (CATEGORYHOLDER)->category()                                \
+                  ? BloombergLP::ball::DeferredLogger::defaultLogger()        \
+                  : 0) {                                                      \
+        ball_logdefer_lOgGeR->logMessage(*(CATEGORYHOLDER)->category(),      \
+                                         (SEVERITY),                          \
+                                         __FILE__,                            \
+                                         __LINE__,                            \
+                                         __VA_ARGS__);                        \
+    }                                                                         \
+    else {                                                                    \
+        BloombergLP::ball::Log_Formatter ball_log_fOrMaTtEr(                  \
+                                                (CATEGORYHOLDER)->category(), \
+                                                __FILE__,                     \
+                                                __LINE__,                     \
+                                                (SEVERITY));                  \
+        BloombergLP::ball::Log::format(ball_log_fOrMaTtEr.messageBuffer(),    \
+                                       ball_log_fOrMaTtEr.messageBufferLen(), \
+                                       __VA_ARGS__);                          \
+    }
+
+#define BALL_LOGDEFER_CONST_IMP(SEVERITY, ...)                                \
+do {                                                                          \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BALL_LOGDEFER_LOG_IMP(ball_log_cAtEgOrYhOlDeR,                        \
+                              (SEVERITY),                                     \
+                              __VA_ARGS__)                                    \
+    }                                                                         \
+} while(0)
+
+                       // =====================
+                       // 'printf'-style macros
+                       // =====================
+
+#define BALL_LOGDEFER(SEVERITY, ...)                                          \
+do {                                                                          \
+    const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =        \
+                         ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
+    if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
+           BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
+                                                     (SEVERITY))) {           \
+        BALL_LOGDEFER_LOG_IMP(ball_log_cAtEgOrYhOlDeR,                        \
+                              (SEVERITY),                                     \
+                              __VA_ARGS__)                                    \
+    }                                                                         \
+} while(0)
+
+#define BALL_LOGDEFER_TRACE(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_TRACE, __VA_ARGS__)
+
+#define BALL_LOGDEFER_DEBUG(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG, __VA_ARGS__)
+
+#define BALL_LOGDEFER_INFO( ...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_INFO,  __VA_ARGS__)
+
+#define BALL_LOGDEFER_WARN( ...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_WARN,  __VA_ARGS__)
+
+#define BALL_LOGDEFER_ERROR(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_ERROR, __VA_ARGS__)
+
+#define BALL_LOGDEFER_FATAL(...)                                              \
+    BALL_LOGDEFER_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
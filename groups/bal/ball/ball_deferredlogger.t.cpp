@@ -0,0 +1,1680 @@
+// ball_deferredlogger.t.cpp                                          -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <ball_category.h>
+#include <ball_categorymanager.h>
+#include <ball_context.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_streamobserver.h>
+#include <ball_transmission.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+
+#include <bdls_processutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a mechanism, 'ball::DeferredLogger', that
+// records unformatted messages into a ring buffer, publishes them (formatting
+// each) to an observer, and writes them to (and decodes them from) a binary
+// stream, together with macros that record messages to the default deferred
+// logger.  Messages are published to a test observer that collects the
+// records, and the fields of the collected records are verified.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 7] static int decodeBinary(Observer *, streambuf *, Allocator *);
+// [ 8] static DeferredLogger *defaultLogger();
+// [ 8] static DeferredLogger *setDefaultLogger(DeferredLogger *logger);
+//
+// CREATORS
+// [ 2] explicit DeferredLogger(int capacity, Allocator *ba = 0);
+// [ 2] ~DeferredLogger();
+//
+// MANIPULATORS
+// [ 4] void logMessage(category, severity, file, line, format, ...);
+// [ 4] int publish(Observer *observer, int maxNumRecords = INT_MAX);
+// [ 7] int writeBinary(bsl::streambuf *output, int maxNumRecords);
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 6] bsls::Types::Int64 numDropped() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// MACROS
+// [ 8] BALL_LOGDEFER_TRACE
+// [ 8] BALL_LOGDEFER_DEBUG
+// [ 8] BALL_LOGDEFER_INFO
+// [ 8] BALL_LOGDEFER_WARN
+// [ 8] BALL_LOGDEFER_ERROR
+// [ 8] BALL_LOGDEFER_FATAL
+// [ 8] BALL_LOGDEFER
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: ARGUMENT CAPTURE
+// [ 5] CONCERN: RECORD FIELDS
+// [ 9] CONCERN: CONCURRENT LOGGING AND PUBLICATION
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: DEFERRED VS. IMMEDIATE FORMATTING
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredLogger        Obj;
+typedef ball::Severity              Sev;
+typedef bsls::Types::Int64          Int64;
+typedef bsls::Types::Uint64         Uint64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+                           // =====================
+                           // class RecordCollector
+                           // =====================
+
+class RecordCollector : public ball::Observer {
+    // This class provides an observer that retains a copy of each record
+    // published to it.
+
+    // DATA
+    bsl::vector<ball::Record> d_records;  // published records
+    mutable bslmt::Mutex      d_mutex;    // protects 'd_records'
+
+  public:
+    // CREATORS
+    explicit RecordCollector(bslma::Allocator *basicAllocator = 0)
+        // Create a collector having no records.  Optionally specify a
+        // 'basicAllocator' used to supply memory.
+    : d_records(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&                       context)
+        // Append a copy of the specified 'record' to the records of this
+        // collector.  The behavior is undefined unless the specified
+        // 'context' indicates a "pass-through" record.
+    {
+        ASSERT(ball::Transmission::e_PASSTHROUGH ==
+                                                 context.transmissionCause());
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.push_back(*record);
+    }
+
+    virtual void releaseRecords()
+        // Do nothing.
+    {
+    }
+
+    void clear()
+        // Remove all records from this collector.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.clear();
+    }
+
+    // ACCESSORS
+    int numRecords() const
+        // Return the number of records of this collector.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return static_cast<int>(d_records.size());
+    }
+
+    const ball::Record& record(int index) const
+        // Return a reference to the record at the specified 'index'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_records[index];
+    }
+
+    bsl::string message(int index) const
+        // Return the message of the record at the specified 'index'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_records[index].fixedFields().message();
+    }
+};
+
+                           // ====================
+                           // class DiscardObserver
+                           // ====================
+
+class DiscardObserver : public ball::Observer {
+    // This class provides an observer that discards the records published to
+    // it.
+
+  public:
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>&,
+                         const ball::Context&)
+        // Do nothing.
+    {
+    }
+
+    virtual void releaseRecords()
+        // Do nothing.
+    {
+    }
+};
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ProducerArgs {
+    // This 'struct' holds the arguments of 'producerThread'.
+
+    Obj                 *d_logger_p;      // logger to log to
+    const ball::Category *d_category_p;   // category to log with
+    bslmt::Barrier      *d_barrier_p;     // barrier to wait on before logging
+    int                  d_threadIndex;   // index of this producer
+    int                  d_numMessages;   // number of messages to log
+};
+
+extern "C" void *producerThread(void *arg)
+    // Log the number of messages specified by the 'ProducerArgs' object at
+    // the specified 'arg' address, identifying the producer and message in
+    // the arguments of each.
+{
+    ProducerArgs *args = static_cast<ProducerArgs *>(arg);
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < args->d_numMessages; ++i) {
+        args->d_logger_p->logMessage(*args->d_category_p,
+                                     Sev::e_INFO,
+                                     __FILE__,
+                                     __LINE__,
+                                     "producer %d message %d",
+                                     args->d_threadIndex,
+                                     i);
+        if (0 == i % 64) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    return 0;
+}
+
+int parseProducerMessage(int *threadIndex, int *index, const bsl::string& s)
+    // Load into the specified 'threadIndex' and 'index' the values
+    // formatted into the specified message 's' by 'producerThread'.  Return 0
+    // on success, and a non-zero value otherwise.
+{
+    return 2 == bsl::sscanf(s.c_str(),
+                            "producer %d message %d",
+                            threadIndex,
+                            index)
+           ? 0
+           : -1;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BALL_DEFERREDLOGGER_USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging on a Latency-Sensitive Path
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a latency-sensitive function that logs a message for
+// each order it processes, and that we want to avoid the cost of formatting
+// those messages on the processing thread.
+//
+// First, we define the function, using the 'BALL_LOGDEFER_INFO' macro exactly
+// as we would use 'BALL_LOGVA_INFO':
+//..
+    void processOrder(int orderId, double price, const char *symbol)
+    {
+        BALL_LOG_SET_CATEGORY("ORDERS");
+
+        BALL_LOGDEFER_INFO("order %d: %s at %.2f", orderId, symbol, price);
+    }
+//..
+
+}  // close namespace BALL_DEFERREDLOGGER_USAGE_EXAMPLE
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BALL_DEFERREDLOGGER_USAGE_EXAMPLE;
+
+// Then, in 'main', we initialize the logger manager singleton, with a
+// 'ball::StreamObserver' writing to 'bsl::cout':
+//..
+    ball::LoggerManagerConfiguration configuration;
+    configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_INFO,
+                                                   ball::Severity::e_INFO,
+                                                   ball::Severity::e_OFF,
+                                                   ball::Severity::e_OFF);
+
+    ball::LoggerManagerScopedGuard guard(configuration);
+
+    bsl::shared_ptr<ball::StreamObserver> observer =
+                            bsl::make_shared<ball::StreamObserver>(&bsl::cout);
+
+    ball::LoggerManager::singleton().registerObserver(observer, "default");
+//..
+// Next, we create a deferred logger having room for 1024 pending messages,
+// and install it as the default logger used by the 'BALL_LOGDEFER_*' macros:
+//..
+    ball::DeferredLogger deferredLogger(1024);
+
+    ball::DeferredLogger::setDefaultLogger(&deferredLogger);
+//..
+// Now, we process some orders.  Each call records its message in the ring
+// buffer of 'deferredLogger', without formatting it:
+//..
+    processOrder(1, 100.25, "IBM");
+    processOrder(2, 98.5,   "MSFT");
+//..
+// Finally, we publish the pending messages to 'observer' (typically, this is
+// done periodically by a dedicated thread), and uninstall the logger:
+//..
+    int numPublished = deferredLogger.publish(observer.get());
+    ASSERT(2 == numPublished);
+
+    ball::DeferredLogger::setDefaultLogger(0);
+//..
+// The messages published to 'observer' are "order 1: IBM at 100.25" and
+// "order 2: MSFT at 98.50", and have the timestamps and thread id recorded
+// when 'processOrder' was called.
+
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT LOGGING AND PUBLICATION
+        //
+        // Concerns:
+        //: 1 Messages may be logged concurrently from multiple threads while
+        //:   another thread publishes them.
+        //:
+        //: 2 Every message logged is either published exactly once, intact,
+        //:   or counted as dropped.
+        //:
+        //: 3 The messages of each producer are published in the order in
+        //:   which they were logged.
+        //
+        // Plan:
+        //: 1 Create a deferred logger having a small capacity, and start
+        //:   several threads, each logging a sequence of numbered messages,
+        //:   while the main thread publishes to a collecting observer until
+        //:   all producers have finished and no message is pending.
+        //:
+        //: 2 Verify that the number of messages published plus the number of
+        //:   messages dropped equals the number logged, that each message is
+        //:   well-formed, and that the message numbers of each producer are
+        //:   strictly increasing.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT LOGGING AND PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT LOGGING AND PUBLICATION"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        const int k_NUM_THREADS  = 4;
+        const int k_NUM_MESSAGES = 5000;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+
+        ball::CategoryManager categoryManager(&oa);
+        const ball::Category *category =
+                         categoryManager.addCategory("CONCURRENT", 0, 0, 0, 0);
+
+        RecordCollector collector(&ca);
+        Obj             mX(64, &oa);
+
+        bslmt::Barrier            barrier(k_NUM_THREADS + 1);
+        ProducerArgs              args[k_NUM_THREADS];
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_logger_p    = &mX;
+            args[i].d_category_p  = category;
+            args[i].d_barrier_p   = &barrier;
+            args[i].d_threadIndex = i;
+            args[i].d_numMessages = k_NUM_MESSAGES;
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  &producerThread,
+                                                  &args[i]));
+        }
+
+        barrier.wait();
+
+        int numPublished = 0;
+        while (numPublished + mX.numDropped() <
+                                              k_NUM_THREADS * k_NUM_MESSAGES) {
+            const int n = mX.publish(&collector);
+            if (0 == n) {
+                bslmt::ThreadUtil::yield();
+            }
+            numPublished += n;
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        ASSERT(0 == mX.publish(&collector));
+
+        if (veryVerbose) { T_ P_(numPublished) P(mX.numDropped()) }
+
+        ASSERTV(numPublished, mX.numDropped(),
+                k_NUM_THREADS * k_NUM_MESSAGES ==
+                                               numPublished + mX.numDropped());
+        ASSERT(numPublished == collector.numRecords());
+
+        int lastIndex[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            lastIndex[i] = -1;
+        }
+
+        for (int i = 0; i < collector.numRecords(); ++i) {
+            int threadIndex;
+            int index;
+
+            const bsl::string message = collector.message(i);
+
+            ASSERTV(message, 0 == parseProducerMessage(&threadIndex,
+                                                       &index,
+                                                       message));
+            ASSERTV(threadIndex, 0 <= threadIndex);
+            ASSERTV(threadIndex, threadIndex < k_NUM_THREADS);
+
+            if (0 <= threadIndex && threadIndex < k_NUM_THREADS) {
+                ASSERTV(threadIndex, index, lastIndex[threadIndex],
+                        lastIndex[threadIndex] < index);
+                lastIndex[threadIndex] = index;
+            }
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING MACROS
+        //
+        // Concerns:
+        //: 1 When a default logger is installed, each macro records its
+        //:   message, having the severity of the macro, the category
+        //:   established by 'BALL_LOG_SET_CATEGORY', and the file and line of
+        //:   the macro invocation, to the default logger.
+        //:
+        //: 2 The macros record no message if the severity is less severe than
+        //:   the thresholds of the category.
+        //:
+        //: 3 When no default logger is installed, the macros format and log
+        //:   their messages immediately.
+        //:
+        //: 4 'setDefaultLogger' returns the previously installed logger.
+        //
+        // Plan:
+        //: 1 Initialize the logger manager singleton with a collecting
+        //:   observer, and a "pass" threshold of 'e_INFO'.  Install a default
+        //:   deferred logger, invoke each macro, and verify the records
+        //:   published by the deferred logger.  (C-1..2)
+        //:
+        //: 2 Uninstall the default deferred logger, invoke 'BALL_LOGDEFER',
+        //:   and verify that the message was published immediately to the
+        //:   observer of the logger manager.  (C-3)
+        //:
+        //: 3 Verify the return values of 'setDefaultLogger' and
+        //:   'defaultLogger'.  (C-4)
+        //
+        // Testing:
+        //   static DeferredLogger *defaultLogger();
+        //   static DeferredLogger *setDefaultLogger(DeferredLogger *logger);
+        //   BALL_LOGDEFER_TRACE
+        //   BALL_LOGDEFER_DEBUG
+        //   BALL_LOGDEFER_INFO
+        //   BALL_LOGDEFER_WARN
+        //   BALL_LOGDEFER_ERROR
+        //   BALL_LOGDEFER_FATAL
+        //   BALL_LOGDEFER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MACROS" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_INFO,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        bsl::shared_ptr<RecordCollector> immediate =
+                               bsl::allocate_shared<RecordCollector>(&ca, &ca);
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                  immediate,
+                                                                  "test"));
+
+        RecordCollector deferred(&ca);
+
+        BALL_LOG_SET_CATEGORY("DEFERRED.MACROS");
+
+        Obj mX(16, &oa);
+
+        ASSERT(0 == Obj::defaultLogger());
+        ASSERT(0 == Obj::setDefaultLogger(&mX));
+        ASSERT(&mX == Obj::defaultLogger());
+
+        const int LINE = L_;
+        BALL_LOGDEFER_TRACE("trace %d", 1);
+        BALL_LOGDEFER_DEBUG("debug %d", 2);
+        BALL_LOGDEFER_INFO( "info %d",  3);
+        BALL_LOGDEFER_WARN( "warn %d",  4);
+        BALL_LOGDEFER_ERROR("error %d", 5);
+        BALL_LOGDEFER_FATAL("fatal %d", 6);
+        BALL_LOGDEFER(Sev::e_WARN, "severity %d", Sev::e_WARN);
+        BALL_LOGDEFER(Sev::e_TRACE, "severity %d", Sev::e_TRACE);
+        BALL_LOGDEFER_INFO("no arguments");
+
+        ASSERT(0 == immediate->numRecords());
+
+        ASSERT(6 == mX.publish(&deferred));
+        ASSERT(6 == deferred.numRecords());
+
+        static const struct {
+            int         d_line;         // source line number
+            const char *d_message;      // expected message
+            int         d_severity;     // expected severity
+            int         d_lineOffset;   // offset of the macro from 'LINE'
+        } DATA[] = {
+            //LINE  MESSAGE          SEVERITY       OFFSET
+            //----  ---------------  -------------  ------
+            { L_,   "info 3",        Sev::e_INFO,        3 },
+            { L_,   "warn 4",        Sev::e_WARN,        4 },
+            { L_,   "error 5",       Sev::e_ERROR,       5 },
+            { L_,   "fatal 6",       Sev::e_FATAL,       6 },
+            { L_,   "severity 96",   Sev::e_WARN,        7 },
+            { L_,   "no arguments",  Sev::e_INFO,        9 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA && ti < deferred.numRecords(); ++ti) {
+            const int                     DLINE = DATA[ti].d_line;
+            const ball::RecordAttributes& FIELDS =
+                                           deferred.record(ti).fixedFields();
+
+            ASSERTV(DLINE, FIELDS.message(),
+                    bsl::string(DATA[ti].d_message) == FIELDS.message());
+            ASSERTV(DLINE, DATA[ti].d_severity == FIELDS.severity());
+            ASSERTV(DLINE, FIELDS.lineNumber(),
+                    LINE + DATA[ti].d_lineOffset == FIELDS.lineNumber());
+            ASSERTV(DLINE,
+                    bsl::string("DEFERRED.MACROS") == FIELDS.category());
+            ASSERTV(DLINE, bsl::string(__FILE__) == FIELDS.fileName());
+        }
+
+        ASSERT(&mX == Obj::setDefaultLogger(0));
+        ASSERT(0   == Obj::defaultLogger());
+
+        BALL_LOGDEFER(Sev::e_ERROR, "immediate %s", "message");
+        BALL_LOGDEFER_DEBUG("immediate %s", "suppressed");
+
+        ASSERT(0 == mX.publish(&deferred));
+        ASSERT(1 == immediate->numRecords());
+        if (1 == immediate->numRecords()) {
+            ASSERTV(immediate->message(0),
+                    "immediate message" == immediate->message(0));
+        }
+
+        ASSERT(0 == ball::LoggerManager::singleton().deregisterObserver(
+                                                                      "test"));
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeBinary' AND 'decodeBinary'
+        //
+        // Concerns:
+        //: 1 Messages written by 'writeBinary' and decoded by 'decodeBinary'
+        //:   are published with the same fields and message as by 'publish'.
+        //:
+        //: 2 Each string is defined once per stream, so that a repeated
+        //:   message is encoded compactly.
+        //:
+        //: 3 A stream may be written by several calls to 'writeBinary', and
+        //:   switching to another stream begins a new, self-contained stream.
+        //:
+        //: 4 'decodeBinary' fails on malformed or truncated input, and on
+        //:   input not written by 'writeBinary'.
+        //:
+        //: 5 'writeBinary' reports a failure to write to its stream.
+        //
+        // Plan:
+        //: 1 Log the same messages to two deferred loggers; publish one
+        //:   directly, write the other to a stream and decode it, and compare
+        //:   the resulting records.  (C-1)
+        //:
+        //: 2 Write one message, then many more identical messages, to a
+        //:   stream, and verify that the size of each subsequent message is
+        //:   much smaller than that of the first.  (C-2)
+        //:
+        //: 3 Write to a stream in several calls, then to a second stream, and
+        //:   verify that both streams decode.  (C-3)
+        //:
+        //: 4 Decode every proper prefix, and corrupted variants, of a valid
+        //:   stream, and verify failure.  (C-4)
+        //:
+        //: 5 Write to a stream that has no capacity.  (C-5)
+        //
+        // Testing:
+        //   static int decodeBinary(Observer *, streambuf *, Allocator *);
+        //   int writeBinary(bsl::streambuf *output, int maxNumRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'writeBinary' AND 'decodeBinary'" << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("stream", veryVeryVeryVerbose);
+
+        ball::CategoryManager categoryManager(&oa);
+        const ball::Category& CAT1 =
+                      *categoryManager.addCategory("BINARY.ONE", 0, 0, 0, 0);
+        const ball::Category& CAT2 =
+                      *categoryManager.addCategory("BINARY.TWO", 0, 0, 0, 0);
+
+        const char *const LONG_STRING =
+            "0123456789012345678901234567890123456789012345678901234567890123"
+            "0123456789012345678901234567890123456789012345678901234567890123";
+
+        int dummy;
+
+        Obj mX(64, &oa);
+        Obj mY(64, &oa);
+
+        for (int i = 0; i < 2; ++i) {
+            Obj& mZ = i ? mY : mX;
+
+            mZ.logMessage(CAT1, Sev::e_INFO, "a.cpp", 10, "plain");
+            mZ.logMessage(CAT2,
+                          Sev::e_WARN,
+                          "b.cpp",
+                          20,
+                          "%d %u %c %5.1f %s %p",
+                          -12345,
+                          4000000000u,
+                          'x',
+                          -2.25,
+                          "str",
+                          static_cast<const void *>(&dummy));
+            mZ.logMessage(CAT1,
+                          Sev::e_ERROR,
+                          "a.cpp",
+                          30,
+                          "%lld %llu %g",
+                          -(static_cast<Int64>(1) << 62),
+                          ~static_cast<Uint64>(0),
+                          1e300);
+            mZ.logMessage(CAT1, Sev::e_DEBUG, "a.cpp", 40, "%s", LONG_STRING);
+        }
+
+        RecordCollector direct(&ca);
+        ASSERT(4 == mY.publish(&direct));
+
+        bdlsb::MemOutStreamBuf out(&sa);
+        ASSERT(4 == mX.writeBinary(&out));
+        ASSERT(0 == mX.writeBinary(&out));
+
+        if (veryVerbose) { T_ P(out.length()) }
+
+        {
+            RecordCollector decoded(&ca);
+
+            bdlsb::FixedMemInStreamBuf in(out.data(), out.length());
+            ASSERT(4 == Obj::decodeBinary(&decoded, &in, &oa));
+            ASSERT(4 == decoded.numRecords());
+
+            for (int j = 0; j < 4 && j < decoded.numRecords(); ++j) {
+                const ball::RecordAttributes& E =
+                                                direct.record(j).fixedFields();
+                const ball::RecordAttributes& A =
+                                               decoded.record(j).fixedFields();
+
+                ASSERTV(j, E.message(), A.message(),
+                        bsl::string(E.message()) == A.message());
+                ASSERTV(j, bsl::string(E.category()) == A.category());
+                ASSERTV(j, bsl::string(E.fileName()) == A.fileName());
+                ASSERTV(j, E.lineNumber() == A.lineNumber());
+                ASSERTV(j, E.severity()   == A.severity());
+                ASSERTV(j, E.threadID()   == A.threadID());
+                ASSERTV(j, E.processID()  == A.processID());
+                ASSERTV(j, E.timestamp(), A.timestamp(),
+                        A.timestamp() <= E.timestamp());
+            }
+        }
+
+        if (verbose) cout << "\tStrings are defined once per stream." << endl;
+        {
+            bdlsb::MemOutStreamBuf out2(&sa);
+
+            mX.logMessage(CAT1, Sev::e_INFO, "a.cpp", 10, "message %d", 1);
+            ASSERT(1 == mX.writeBinary(&out2));
+            const bsl::size_t firstLength = out2.length();
+
+            for (int j = 0; j < 32; ++j) {
+                mX.logMessage(CAT1, Sev::e_INFO, "a.cpp", 10, "message %d", j);
+            }
+            ASSERT(32 == mX.writeBinary(&out2));
+
+            const bsl::size_t perMessage = (out2.length() - firstLength) / 32;
+
+            if (veryVerbose) { T_ P_(firstLength) P(perMessage) }
+
+            ASSERTV(perMessage, perMessage <= 32);
+            ASSERTV(firstLength, perMessage, 2 * perMessage < firstLength);
+
+            RecordCollector decoded(&ca);
+
+            bdlsb::FixedMemInStreamBuf in(out2.data(), out2.length());
+            ASSERT(33 == Obj::decodeBinary(&decoded, &in, &oa));
+            if (33 == decoded.numRecords()) {
+                ASSERT("message 1"  == decoded.message(0));
+                ASSERT("message 31" == decoded.message(32));
+            }
+        }
+
+        if (verbose) cout << "\tStreams written in several calls." << endl;
+        {
+            bdlsb::MemOutStreamBuf out3(&sa);
+            bdlsb::MemOutStreamBuf out4(&sa);
+
+            mX.logMessage(CAT1, Sev::e_INFO, "a.cpp", 10, "first");
+            mX.logMessage(CAT2, Sev::e_INFO, "b.cpp", 20, "second");
+            mX.logMessage(CAT1, Sev::e_INFO, "a.cpp", 10, "third");
+
+            ASSERT(1 == mX.writeBinary(&out3, 1));
+            ASSERT(1 == mX.writeBinary(&out3, 1));
+            ASSERT(1 == mX.writeBinary(&out4));
+
+            RecordCollector decoded(&ca);
+
+            bdlsb::FixedMemInStreamBuf in3(out3.data(), out3.length());
+            ASSERT(2 == Obj::decodeBinary(&decoded, &in3, &oa));
+
+            bdlsb::FixedMemInStreamBuf in4(out4.data(), out4.length());
+            ASSERT(1 == Obj::decodeBinary(&decoded, &in4, &oa));
+
+            if (3 == decoded.numRecords()) {
+                ASSERT("first"      == decoded.message(0));
+                ASSERT("second"     == decoded.message(1));
+                ASSERT(bsl::string("BINARY.TWO") ==
+                                   decoded.record(1).fixedFields().category());
+                ASSERT("third"      == decoded.message(2));
+            }
+        }
+
+        if (verbose) cout << "\tMalformed input." << endl;
+        {
+            RecordCollector decoded(&ca);
+
+            bsl::string data(out.data(), out.length(), &sa);
+
+            // Determine the length of the header of a stream.
+
+            bdlsb::MemOutStreamBuf empty(&sa);
+            ASSERT(0 == mY.writeBinary(&empty));
+
+            const bsl::size_t headerLength = empty.length();
+            ASSERTV(headerLength, 8 < headerLength);
+
+            {
+                bdlsb::FixedMemInStreamBuf in(empty.data(), empty.length());
+                ASSERT(0 == Obj::decodeBinary(&decoded, &in, &oa));
+            }
+
+            // A truncated header, or a truncated element, is malformed.
+
+            for (bsl::size_t length = 0; length < data.size(); ++length) {
+                bdlsb::FixedMemInStreamBuf in(data.data(), length);
+
+                const int rc = Obj::decodeBinary(&decoded, &in, &oa);
+
+                ASSERTV(length, rc, length >= headerLength || rc < 0);
+                ASSERTV(length, rc, rc < 4);
+            }
+
+            bsl::string corrupt(data, &sa);
+            corrupt[0] = 'X';
+            {
+                bdlsb::FixedMemInStreamBuf in(corrupt.data(), corrupt.size());
+                ASSERT(0 > Obj::decodeBinary(&decoded, &in, &oa));
+            }
+
+            // An unknown tag.
+
+            corrupt = data;
+            corrupt += 'Z';
+            {
+                bdlsb::FixedMemInStreamBuf in(corrupt.data(), corrupt.size());
+                ASSERT(0 > Obj::decodeBinary(&decoded, &in, &oa));
+            }
+
+            // A record referring to an undefined string.
+
+            corrupt.assign(data.data(), headerLength);
+            corrupt += 'R';
+            corrupt += '\x05';
+            corrupt.append(64, '\0');
+            {
+                bdlsb::FixedMemInStreamBuf in(corrupt.data(), corrupt.size());
+                ASSERT(0 > Obj::decodeBinary(&decoded, &in, &oa));
+            }
+
+            // A string definition out of sequence.
+
+            corrupt.assign(data.data(), headerLength);
+            corrupt += 'S';
+            corrupt += '\x03';
+            corrupt += '\x01';
+            corrupt += 'a';
+            {
+                bdlsb::FixedMemInStreamBuf in(corrupt.data(), corrupt.size());
+                ASSERT(0 > Obj::decodeBinary(&decoded, &in, &oa));
+            }
+        }
+
+        if (verbose) cout << "\tOutput failure." << endl;
+        {
+            char                        buffer[4];
+            bdlsb::FixedMemOutStreamBuf full(buffer, sizeof buffer);
+
+            mX.logMessage(CAT1, Sev::e_INFO, "a.cpp", 10, "lost");
+            ASSERT(0 > mX.writeBinary(&full));
+            ASSERT(0 > mX.writeBinary(&full));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'numDropped'
+        //
+        // Concerns:
+        //: 1 A message logged while the ring buffer is full is discarded and
+        //:   counted by 'numDropped'.
+        //:
+        //: 2 Publishing frees entries, which are reused as the positions in
+        //:   the ring buffer wrap around.
+        //:
+        //: 3 'publish' publishes at most 'maxNumRecords' messages.
+        //
+        // Plan:
+        //: 1 Fill a deferred logger, log more messages, and verify
+        //:   'numDropped' and the messages published.  Repeat several times
+        //:   so that the positions wrap around, publishing in batches of
+        //:   various sizes.  (C-1..3)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numDropped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'numDropped'" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+
+        ball::CategoryManager categoryManager(&oa);
+        const ball::Category& CAT =
+                          *categoryManager.addCategory("DROPPED", 0, 0, 0, 0);
+
+        Obj mX(8, &oa);  const Obj& X = mX;
+
+        ASSERT(0 == X.numDropped());
+
+        Int64 expectedDropped = 0;
+        int   next            = 0;
+
+        for (int round = 0; round < 5; ++round) {
+            RecordCollector collector(&ca);
+
+            const int first = next;
+            for (int i = 0; i < X.capacity() + round; ++i) {
+                mX.logMessage(CAT, Sev::e_INFO, "f.cpp", 1, "%d", next++);
+            }
+            expectedDropped += round;
+
+            ASSERTV(round, X.numDropped(), expectedDropped == X.numDropped());
+
+            const int batch = round + 1;
+            int       numPublished = 0;
+            int       n;
+            do {
+                n = mX.publish(&collector, batch);
+                ASSERTV(round, n, n <= batch);
+                numPublished += n;
+            } while (0 < n);
+
+            ASSERTV(round, numPublished, X.capacity() == numPublished);
+
+            for (int i = 0; i < collector.numRecords(); ++i) {
+                bsl::string expected(&ca);
+                expected = bsl::to_string(first + i);
+                ASSERTV(round, i, collector.message(i),
+                        expected == collector.message(i));
+            }
+            next = first + X.capacity() + round;
+        }
+
+        ASSERT(0 == mX.publish(&*bsl::make_shared<DiscardObserver>(), 0));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: RECORD FIELDS
+        //
+        // Concerns:
+        //: 1 The published record has the category name, severity, file name,
+        //:   and line number specified to 'logMessage'.
+        //:
+        //: 2 The timestamp and thread id of the record are those at the time
+        //:   'logMessage' was called, not at the time of publication.
+        //:
+        //: 3 The process id of the record is that of the current process.
+        //:
+        //: 4 Messages are published in the order in which they were logged.
+        //
+        // Plan:
+        //: 1 Log a message from another thread, and wait before publishing
+        //:   it from the main thread.  Verify the fields of the record.
+        //:   (C-1..3)
+        //:
+        //: 2 Log several messages and verify the order in which they are
+        //:   published.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: RECORD FIELDS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: RECORD FIELDS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+
+        ball::CategoryManager categoryManager(&oa);
+        const ball::Category *category =
+                            categoryManager.addCategory("FIELDS", 0, 0, 0, 0);
+
+        RecordCollector collector(&ca);
+        Obj             mX(4, &oa);
+
+        const bdlt::Datetime before = bdlt::CurrentTime::utc();
+
+        bslmt::Barrier            barrier(1);
+        ProducerArgs              args = { &mX, category, &barrier, 7, 1 };
+        bslmt::ThreadUtil::Handle handle;
+
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                              &producerThread,
+                                              &args));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        const bdlt::Datetime after = bdlt::CurrentTime::utc();
+
+        bslmt::ThreadUtil::microSleep(20000);
+
+        ASSERT(1 == mX.publish(&collector));
+        ASSERT(1 == collector.numRecords());
+
+        if (1 == collector.numRecords()) {
+            const ball::RecordAttributes& FIELDS =
+                                            collector.record(0).fixedFields();
+
+            if (veryVerbose) { T_ P(FIELDS) }
+
+            ASSERT(Sev::e_INFO == FIELDS.severity());
+
+            ASSERT(bsl::string("producer 7 message 0") == FIELDS.message());
+            ASSERT(bsl::string("FIELDS")               == FIELDS.category());
+            ASSERT(bsl::string(__FILE__)               == FIELDS.fileName());
+            ASSERT(0                      <  FIELDS.lineNumber());
+            ASSERT(FIELDS.threadID() != bslmt::ThreadUtil::selfIdAsUint64());
+            ASSERT(bdls::ProcessUtil::getProcessId() == FIELDS.processID());
+
+            // Allow for the resolution of the clocks.
+
+            ASSERTV(before, FIELDS.timestamp(),
+                    before - bdlt::DatetimeInterval(0, 0, 0, 1) <=
+                                                          FIELDS.timestamp());
+            ASSERTV(after, FIELDS.timestamp(),
+                    FIELDS.timestamp() <=
+                                   after + bdlt::DatetimeInterval(0, 0, 0, 1));
+        }
+
+        collector.clear();
+
+        for (int i = 0; i < 3; ++i) {
+            mX.logMessage(*category, Sev::e_INFO, "f.cpp", i, "%d", i);
+        }
+        ASSERT(3 == mX.publish(&collector));
+        for (int i = 0; i < 3 && i < collector.numRecords(); ++i) {
+            ASSERTV(i, i == collector.record(i).fixedFields().lineNumber());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'logMessage' AND 'publish'
+        //
+        // Concerns:
+        //: 1 The published message is the format, with each conversion
+        //:   specification replaced by its argument formatted as 'printf'
+        //:   would format it.
+        //:
+        //: 2 Length modifiers are ignored, and mismatched argument types are
+        //:   converted, so that formatting is type-safe.
+        //:
+        //: 3 Unsupported conversions, and conversions lacking an argument, are
+        //:   output verbatim; excess arguments are ignored.
+        //:
+        //: 4 Each 'logMessage' overload, taking 0 to 8 arguments, captures
+        //:   all of its arguments.
+        //:
+        //: 5 Field widths exceeding the internal formatting buffer are
+        //:   honored.
+        //
+        // Plan:
+        //: 1 Using a table-based approach, log messages having various formats
+        //:   and arguments, publish them, and compare each message to the
+        //:   expected value.  (C-1..3)
+        //:
+        //: 2 Log a message using each overload.  (C-4)
+        //:
+        //: 3 Log a message using a large field width.  (C-5)
+        //
+        // Testing:
+        //   void logMessage(category, severity, file, line, format, ...);
+        //   int publish(Observer *observer, int maxNumRecords = INT_MAX);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'logMessage' AND 'publish'" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+
+        ball::CategoryManager categoryManager(&oa);
+        const ball::Category& CAT =
+                           *categoryManager.addCategory("FORMAT", 0, 0, 0, 0);
+
+        RecordCollector collector(&ca);
+        Obj             mX(64, &oa);
+
+        const void *const PTR = reinterpret_cast<const void *>(0x1234);
+
+        char expectedPointer[32];
+        bsl::sprintf(expectedPointer, "[%p]", PTR);
+
+        int line = 0;
+
+#define LOG(...) mX.logMessage(CAT, Sev::e_INFO, __FILE__, ++line, __VA_ARGS__)
+
+        static const char *const EXPECTED[] = {
+            "no conversions",
+            "100% literal",
+            "int -7 unsigned 7 hex ff HEX FF octal 17",
+            "long 123456789012 ulong 18446744073709551615",
+            "short -3 uchar 250 schar -5 bool 1",
+            "char 'a' padded [   42] [42   ] [+42] [00042]",
+            "double 3.14 1.500000e+00 0.25 float 0.5",
+            "string [abc] [  abc] [ab] null [(null)]",
+            "mismatch 7 2 hello 3.5",
+            "verbatim %*d %n then 1 2",
+            "missing 1 %s",
+            "excess 1",
+            "length modifiers 1 2 3 4 5",
+            "%",
+        };
+
+        LOG("no conversions");
+        LOG("100%% literal");
+        LOG("int %d unsigned %u hex %x HEX %X octal %o", -7, 7u, 255, 255, 15);
+        LOG("long %ld ulong %lu", 123456789012LL, ~static_cast<Uint64>(0));
+        LOG("short %hd uchar %hhu schar %hhd bool %d",
+            static_cast<short>(-3),
+            static_cast<unsigned char>(250),
+            static_cast<signed char>(-5),
+            true);
+        LOG("char '%c' padded [%5d] [%-5d] [%+d] [%05d]", 'a', 42, 42, 42, 42);
+        LOG("double %.2f %e %g float %g", 3.14159, 1.5, 0.25, 0.5f);
+        LOG("string [%s] [%5s] [%.2s] null [%s]",
+            "abc",
+            "abc",
+            "abc",
+            static_cast<const char *>(0));
+        LOG("mismatch %s %d %d %g", 7, 2.9, "hello", 3.5f);
+        LOG("verbatim %*d %n then %d %d", 1, 2);
+        LOG("missing %d %s", 1);
+        LOG("excess %d", 1, 2, 3);
+        LOG("length modifiers %hd %ld %lld %zu %jd", 1, 2, 3, 4, 5);
+        LOG("%");
+
+        const int NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+        ASSERT(NUM_EXPECTED == mX.publish(&collector));
+        ASSERT(NUM_EXPECTED == collector.numRecords());
+
+        for (int i = 0; i < NUM_EXPECTED && i < collector.numRecords(); ++i) {
+            if (veryVerbose) { T_ P(collector.message(i)) }
+
+            ASSERTV(i, EXPECTED[i], collector.message(i),
+                    EXPECTED[i] == collector.message(i));
+        }
+
+        if (verbose) cout << "\tPointers." << endl;
+        {
+            collector.clear();
+
+            LOG("[%p]", PTR);
+            LOG("[%p]", static_cast<const int *>(PTR));
+            ASSERT(2 == mX.publish(&collector));
+            ASSERTV(collector.message(0), expectedPointer,
+                    expectedPointer == collector.message(0));
+            ASSERTV(collector.message(1), expectedPointer,
+                    expectedPointer == collector.message(1));
+        }
+
+        if (verbose) cout << "\tEach overload." << endl;
+        {
+            collector.clear();
+
+            LOG("%d %d %d %d %d %d %d %d");
+            LOG("%d %d %d %d %d %d %d %d", 1);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2, 3);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2, 3, 4);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7);
+            LOG("%d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8);
+
+            static const char *const OVERLOADS[] = {
+                "%d %d %d %d %d %d %d %d",
+                "1 %d %d %d %d %d %d %d",
+                "1 2 %d %d %d %d %d %d",
+                "1 2 3 %d %d %d %d %d",
+                "1 2 3 4 %d %d %d %d",
+                "1 2 3 4 5 %d %d %d",
+                "1 2 3 4 5 6 %d %d",
+                "1 2 3 4 5 6 7 %d",
+                "1 2 3 4 5 6 7 8",
+            };
+
+            ASSERT(9 == mX.publish(&collector));
+            for (int i = 0; i < 9 && i < collector.numRecords(); ++i) {
+                ASSERTV(i, collector.message(i),
+                        OVERLOADS[i] == collector.message(i));
+            }
+        }
+
+        if (verbose) cout << "\tLarge field width." << endl;
+        {
+            collector.clear();
+
+            LOG("[%1000d]", 5);
+            ASSERT(1 == mX.publish(&collector));
+
+            const bsl::string message = collector.message(0);
+            ASSERTV(message.size(), 1002 == message.size());
+            ASSERT('5' == message[1000]);
+            ASSERT(' ' == message[999]);
+        }
+
+#undef LOG
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: ARGUMENT CAPTURE
+        //
+        // Concerns:
+        //: 1 Integral arguments are captured as signed or unsigned 64-bit
+        //:   values according to their type, floating-point arguments as
+        //:   'double', and pointers (other than 'const char *') as pointers.
+        //:
+        //: 2 String arguments are copied, null-terminated, into the string
+        //:   storage of the entry, and truncated when the storage is
+        //:   exhausted.
+        //:
+        //: 3 A null string is captured as "(null)".
+        //
+        // Plan:
+        //: 1 Append arguments of each supported type to an entry using
+        //:   'DeferredLogger_ArgumentUtil::append', and verify the captured
+        //:   type and value.  (C-1)
+        //:
+        //: 2 Append strings until the storage is exhausted, and verify the
+        //:   captured strings.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: ARGUMENT CAPTURE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: ARGUMENT CAPTURE" << endl
+                          << "=========================" << endl;
+
+        typedef ball::DeferredLogger_Argument     Arg;
+        typedef ball::DeferredLogger_ArgumentUtil Util;
+        typedef ball::DeferredLogger_Entry        Entry;
+
+        Entry entry;
+        entry.d_numArguments = 0;
+        entry.d_stringLength = 0;
+
+        int dummy;
+
+        Util::append(&entry, static_cast<short>(-2));
+        Util::append(&entry, static_cast<unsigned short>(2));
+        Util::append(&entry, -3L);
+        Util::append(&entry, 3UL);
+        Util::append(&entry, static_cast<Int64>(-4));
+        Util::append(&entry, static_cast<Uint64>(4));
+        Util::append(&entry, 1.5f);
+        Util::append(&entry, &dummy);
+
+        ASSERT(8 == entry.d_numArguments);
+
+        ASSERT(Arg::e_INT64   == entry.d_arguments[0].d_type);
+        ASSERT(-2             == entry.d_arguments[0].d_int64);
+        ASSERT(Arg::e_UINT64  == entry.d_arguments[1].d_type);
+        ASSERT(2              == entry.d_arguments[1].d_uint64);
+        ASSERT(Arg::e_INT64   == entry.d_arguments[2].d_type);
+        ASSERT(-3             == entry.d_arguments[2].d_int64);
+        ASSERT(Arg::e_UINT64  == entry.d_arguments[3].d_type);
+        ASSERT(3              == entry.d_arguments[3].d_uint64);
+        ASSERT(Arg::e_INT64   == entry.d_arguments[4].d_type);
+        ASSERT(-4             == entry.d_arguments[4].d_int64);
+        ASSERT(Arg::e_UINT64  == entry.d_arguments[5].d_type);
+        ASSERT(4              == entry.d_arguments[5].d_uint64);
+        ASSERT(Arg::e_DOUBLE  == entry.d_arguments[6].d_type);
+        ASSERT(1.5            == entry.d_arguments[6].d_double);
+        ASSERT(Arg::e_POINTER == entry.d_arguments[7].d_type);
+        ASSERT(&dummy         == entry.d_arguments[7].d_pointer_p);
+
+        if (verbose) cout << "\tStrings." << endl;
+
+        const int k_CAPACITY = Obj::k_STRING_CAPACITY;
+
+        bsl::string longString(k_CAPACITY, 'x', &defaultAllocator);
+        char        mutableString[] = "mutable";
+
+        entry.d_numArguments = 0;
+        entry.d_stringLength = 0;
+
+        Util::append(&entry, "abc");
+        Util::append(&entry, static_cast<const char *>(0));
+        Util::append(&entry, mutableString);
+        Util::append(&entry, longString.c_str());
+        Util::append(&entry, "none left");
+
+        mutableString[0] = 'M';
+
+        ASSERT(5 == entry.d_numArguments);
+
+        const int expectedLengths[] = {
+            3, 6, 7, k_CAPACITY - (4 + 7 + 8) - 1, 0
+        };
+        const char *expectedStrings[] = {
+            "abc", "(null)", "mutable", longString.c_str(), ""
+        };
+
+        for (int i = 0; i < 5; ++i) {
+            const Arg& ARG = entry.d_arguments[i];
+
+            ASSERTV(i, Arg::e_STRING == ARG.d_type);
+            ASSERTV(i, ARG.d_length, expectedLengths[i] == ARG.d_length);
+            ASSERTV(i, 0 <= ARG.d_offset);
+            ASSERTV(i, ARG.d_offset + ARG.d_length < k_CAPACITY);
+
+            const char *string = entry.d_strings + ARG.d_offset;
+            ASSERTV(i, '\0' == string[ARG.d_length]);
+            ASSERTV(i, 0 == bsl::strncmp(expectedStrings[i],
+                                         string,
+                                         ARG.d_length));
+        }
+        ASSERT(k_CAPACITY == entry.d_stringLength);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //
+        // Concerns:
+        //: 1 The capacity is the specified capacity rounded up to a power of
+        //:   two.
+        //:
+        //: 2 All memory is allocated from the specified allocator at
+        //:   construction, and released on destruction.
+        //:
+        //: 3 Logging and publishing allocate no memory from the allocator of
+        //:   the logger, other than for the records published.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create loggers having various capacities, and verify their
+        //:   capacity, allocator, and memory use.  (C-1..2)
+        //:
+        //: 2 Log messages, and verify that no memory is allocated.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid capacities.  (C-4)
+        //
+        // Testing:
+        //   explicit DeferredLogger(int capacity, Allocator *ba = 0);
+        //   ~DeferredLogger();
+        //   int capacity() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS" << endl
+                          << "================" << endl;
+
+        static const struct {
+            int d_line;       // source line number
+            int d_capacity;   // requested capacity
+            int d_expected;   // expected capacity
+        } DATA[] = {
+            //LINE  CAPACITY  EXPECTED
+            //----  --------  --------
+            { L_,          1,        1 },
+            { L_,          2,        2 },
+            { L_,          3,        4 },
+            { L_,          8,        8 },
+            { L_,          9,       16 },
+            { L_,       1000,     1024 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int CAPACITY = DATA[ti].d_capacity;
+            const int EXPECTED = DATA[ti].d_expected;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(CAPACITY, &oa);  const Obj& X = mX;
+
+                ASSERTV(LINE, X.capacity(), EXPECTED == X.capacity());
+                ASSERTV(LINE, &oa == X.allocator());
+                ASSERTV(LINE, 0 == X.numDropped());
+                ASSERTV(LINE, 2 == oa.numBlocksInUse());
+
+                ball::CategoryManager categoryManager(&defaultAllocator);
+                const ball::Category& CAT =
+                     *categoryManager.addCategory("CREATORS", 0, 0, 0, 0);
+
+                const Int64 numAllocations = oa.numAllocations();
+                for (int i = 0; i < EXPECTED; ++i) {
+                    mX.logMessage(CAT, Sev::e_INFO, "f.cpp", 1, "%s", "x");
+                }
+                ASSERTV(LINE, numAllocations == oa.numAllocations());
+
+                DiscardObserver observer;
+                ASSERTV(LINE, EXPECTED == mX.publish(&observer));
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+
+        {
+            bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+            Obj mX(1);  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            ASSERT_FAIL(Obj(0, &oa));
+            ASSERT_FAIL(Obj(-1, &oa));
+            ASSERT_PASS(Obj(1, &oa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Log a few messages, publish them, and verify the messages.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator ca("collector", veryVeryVeryVerbose);
+
+        ball::CategoryManager categoryManager(&oa);
+        const ball::Category& CAT =
+                           *categoryManager.addCategory("BREATHE", 0, 0, 0, 0);
+
+        RecordCollector collector(&ca);
+        Obj             mX(4, &oa);
+
+        mX.logMessage(CAT, Sev::e_INFO, __FILE__, __LINE__, "hello");
+        mX.logMessage(CAT,
+                      Sev::e_WARN,
+                      __FILE__,
+                      __LINE__,
+                      "%s has %d items costing %.2f",
+                      "cart",
+                      3,
+                      9.5);
+
+        ASSERT(2 == mX.publish(&collector));
+        ASSERT(2 == collector.numRecords());
+        ASSERT(0 == mX.publish(&collector));
+
+        ASSERT("hello"                        == collector.message(0));
+        ASSERT("cart has 3 items costing 9.50" == collector.message(1));
+        ASSERT(Sev::e_WARN == collector.record(1).fixedFields().severity());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DEFERRED VS. IMMEDIATE FORMATTING
+        //
+        // Concerns:
+        //: 1 Recording a message with 'BALL_LOGDEFER_INFO' is substantially
+        //:   cheaper, on the logging thread, than logging it with
+        //:   'BALL_LOGVA_INFO'.
+        //
+        // Plan:
+        //: 1 Time logging a message having several arguments with each macro,
+        //:   publishing the deferred messages after each batch, and report
+        //:   the average cost per message on the logging thread and of
+        //:   publication.
+        //
+        // Testing:
+        //   PERFORMANCE: DEFERRED VS. IMMEDIATE FORMATTING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: DEFERRED VS. IMMEDIATE FORMATTING"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        const int k_BATCH_SIZE  = 1024;
+        const int k_NUM_BATCHES = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(Sev::e_OFF,
+                                                       Sev::e_INFO,
+                                                       Sev::e_OFF,
+                                                       Sev::e_OFF);
+
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        bsl::shared_ptr<DiscardObserver> observer =
+                                           bsl::make_shared<DiscardObserver>();
+        ball::LoggerManager::singleton().registerObserver(observer, "discard");
+
+        BALL_LOG_SET_CATEGORY("PERFORMANCE");
+
+        Obj mX(k_BATCH_SIZE);
+
+        bsls::Stopwatch immediate;
+        bsls::Stopwatch deferred;
+        bsls::Stopwatch publication;
+
+        for (int batch = 0; batch < k_NUM_BATCHES; ++batch) {
+            immediate.start();
+            for (int i = 0; i < k_BATCH_SIZE; ++i) {
+                BALL_LOGVA_INFO("order %d: %s at %.2f qty %d",
+                                i,
+                                "SYMBOL",
+                                99.5,
+                                batch);
+            }
+            immediate.stop();
+
+            Obj::setDefaultLogger(&mX);
+
+            deferred.start();
+            for (int i = 0; i < k_BATCH_SIZE; ++i) {
+                BALL_LOGDEFER_INFO("order %d: %s at %.2f qty %d",
+                                   i,
+                                   "SYMBOL",
+                                   99.5,
+                                   batch);
+            }
+            deferred.stop();
+
+            Obj::setDefaultLogger(0);
+
+            publication.start();
+            mX.publish(observer.get());
+            publication.stop();
+        }
+
+        const double numMessages =
+                         static_cast<double>(k_BATCH_SIZE) * k_NUM_BATCHES;
+
+        cout << "immediate (BALL_LOGVA_INFO): "
+             << immediate.accumulatedWallTime() / numMessages * 1e9
+             << " ns/message" << endl
+             << "deferred (BALL_LOGDEFER_INFO): "
+             << deferred.accumulatedWallTime() / numMessages * 1e9
+             << " ns/message" << endl
+             << "deferred publication: "
+             << publication.accumulatedWallTime() / numMessages * 1e9
+             << " ns/message" << endl
+             << "dropped: " << mX.numDropped() << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,6 +13,8 @@ BSLS_IDENT_RCSID(ball_fileobserver_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
 
+#include <bsls_assert.h>
+
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>                      // for 'bsl::strcmp'
 #include <bsl_sstream.h>
@@ -236,6 +238,29 @@ void FileObserver::publish(const Record& record, const Context& context)
     d_fileObserver2.publish(record, context);
 }
 
+void FileObserver::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bsl::ostringstream oss;
+    for (int i = 0; i < numRecords; ++i) {
+        if (records[i]->fixedFields().severity() <= d_stdoutThreshold) {
+            d_stdoutFormatter(oss, *records[i]);
+        }
+    }
+
+    const bsl::string& output = oss.str();
+    if (!output.empty()) {
+        bsl::fwrite(output.c_str(), 1, output.length(), stdout);
+        bsl::fflush(stdout);
+    }
+
+    d_fileObserver2.publishBatch(records, numRecords);
+}
+
 void FileObserver::setLogFormat(const char *logFileFormat,
                                 const char *stdoutFormat)
 {
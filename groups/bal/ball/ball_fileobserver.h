@@ -625,6 +625,18 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records in the specified
+        // 'records' array, in order, by writing them to the current log file
+        // if file logging is enabled for this file observer, and writing those
+        // at least as severe as the value returned by 'stdoutThreshold' to
+        // 'stdout'.  Output to each destination is formatted into a single
+        // buffer and written, and flushed, once per batch.  The behavior is
+        // undefined unless '0 <= numRecords', and each of the first
+        // 'numRecords' elements of 'records' is the address of a valid record.
+        // Note that this method produces the same output as calling 'publish'
+        // on each record in turn.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -36,6 +36,7 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 
 #include <bslstl_stringref.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
@@ -43,6 +44,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -399,6 +402,36 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+bool FileObserver2::isRotationDue(const bdlt::Datetime& currentLogTimeUtc,
+                                  bsls::Types::Uint64   numPendingBytes)
+{
+    BSLS_ASSERT(d_rotationSize >= 0);
+    BSLS_ASSERT(d_rotationInterval.totalSeconds() >= 0);
+
+    if (!d_logStreamBuf.isOpened()) {
+        return false;                                                 // RETURN
+    }
+
+    if (d_rotationSize) {
+        // 'tellp' returns -1 on failure.  Rotate the log file if either
+        // 'tellp' fails, or the rotation size is exceeded.
+
+        const bsl::streamoff position = d_logOutStream.tellp();
+
+        const bsls::Types::Uint64 maxSize =
+                      static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024;
+
+        if (0 > position
+         || static_cast<bsls::Types::Uint64>(position) + numPendingBytes >
+                                                                     maxSize) {
+            return true;                                              // RETURN
+        }
+    }
+
+    return d_rotationInterval.totalSeconds()
+        && d_nextRotationTimeUtc <= currentLogTimeUtc;
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -550,31 +583,82 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
                                      const bdlt::Datetime&  currentLogTimeUtc)
 {
-    BSLS_ASSERT(d_rotationSize >= 0);
-    BSLS_ASSERT(d_rotationInterval.totalSeconds() >= 0);
     BSLS_ASSERT(rotatedLogFileName);
 
-    if (!d_logStreamBuf.isOpened()) {
-        return 1;                                                     // RETURN
+    if (isRotationDue(currentLogTimeUtc, 0)) {
+        return rotateFile(rotatedLogFileName);                        // RETURN
     }
 
-    if (d_rotationSize) {
-        // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
+    return 1;
+}
+
+int FileObserver2::writeBatchBuffer()
+{
+    const char        *data     = d_batchStreamBuf.data();
+    const bsl::size_t  numBytes = d_batchStreamBuf.length();
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+    int rc = 0;
 
-            return rotateFile(rotatedLogFileName);                    // RETURN
+    if (0 < numBytes && d_logStreamBuf.isOpened()) {
+#ifdef BSLS_PLATFORM_OS_UNIX
+        // Hand the whole batch to the kernel at once rather than in chunks of
+        // the size of the stream buffer.  Any output already pending in the
+        // stream buffer is flushed first to preserve ordering; 'tellp' (used
+        // for size-based rotation) accounts for bytes written directly to the
+        // descriptor.
+
+        if (!d_logOutStream.flush()) {
+            rc = -1;
         }
-    }
 
-    if (d_rotationInterval.totalSeconds()
-        && d_nextRotationTimeUtc <= currentLogTimeUtc) {
-        return rotateFile(rotatedLogFileName);                        // RETURN
+        bsl::size_t numWritten = 0;
+        while (0 == rc && numWritten < numBytes) {
+            const bsl::size_t remaining = numBytes - numWritten;
+            const int         chunk     = static_cast<int>(
+                                  bsl::min<bsl::size_t>(remaining, 1u << 30));
+            const int         result    = bdls::FilesystemUtil::write(
+                                               d_logStreamBuf.fileDescriptor(),
+                                               data + numWritten,
+                                               chunk);
+            if (0 >= result) {
+                rc = -1;
+            }
+            else {
+                numWritten += result;
+            }
+        }
+#else
+        // Write through the stream buffer so that any text-mode translation it
+        // performs is preserved.
+
+        d_logOutStream.write(data, static_cast<bsl::streamsize>(numBytes));
+        d_logOutStream.flush();
+
+        rc = d_logOutStream ? 0 : -1;
+#endif
+
+        if (0 != rc) {
+            char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+            snprintf(errorBuffer,
+                     sizeof errorBuffer,
+                     "Error on file stream for %s: %s.",
+                     d_logFileName.c_str(),
+                     bsl::strerror(getErrorCode()));
+            bsls::Log::platformDefaultMessageHandler(
+                                                    bsls::LogSeverity::e_ERROR,
+                                                    __FILE__,
+                                                    __LINE__,
+                                                    errorBuffer);
+
+            d_logStreamBuf.clear();
+        }
     }
 
-    return 1;
+    d_batchStreamBuf.pubseekpos(0);
+    d_batchOutStream.clear();
+
+    return rc;
 }
 
 // CREATORS
@@ -585,6 +669,8 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  false,
                  basicAllocator)
 , d_logOutStream(&d_logStreamBuf)
+, d_batchStreamBuf(basicAllocator)
+, d_batchOutStream(&d_batchStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -760,6 +846,55 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(const Record *const *records,
+                                 int                  numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    // Record the outcome of any rotation performed within the batch so that
+    // the callback can be invoked without holding 'd_mutex'.
+
+    typedef bsl::pair<int, bsl::string> RotationResult;
+
+    bsl::vector<RotationResult> rotations(
+                                 d_logFilePattern.get_allocator().mechanism());
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (int i = 0; i < numRecords; ++i) {
+            const Record& record = *records[i];
+
+            if (isRotationDue(record.fixedFields().timestamp(),
+                              d_batchStreamBuf.length())) {
+                writeBatchBuffer();
+
+                rotations.resize(rotations.size() + 1);
+                rotations.back().first = rotateFile(&rotations.back().second);
+            }
+
+            if (d_logStreamBuf.isOpened()) {
+                d_logFileFunctor(d_batchOutStream, record);
+            }
+        }
+
+        writeBatchBuffer();
+    }
+
+    if (!rotations.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+                if (0 >= rotations[i].first) {
+                    d_onRotationCb(rotations[i].first, rotations[i].second);
+                }
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
@@ -307,6 +307,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -317,6 +319,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsls_types.h>
+
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
@@ -369,6 +373,15 @@ class FileObserver2 : public Observer {
                                                        // file logging (refers
                                                        // to 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // reusable arena into
+                                                       // which 'publishBatch'
+                                                       // formats records
+
+    bsl::ostream           d_batchOutStream;           // output stream for
+                                                       // batch formatting
+                                                       // (refers to
+                                                       // 'd_batchStreamBuf')
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current log filename
@@ -426,6 +439,15 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    bool isRotationDue(const bdlt::Datetime& currentLogTimeUtc,
+                       bsls::Types::Uint64   numPendingBytes);
+        // Return 'true' if the log file is open and either the specified
+        // 'currentLogTimeUtc' is at or past the scheduled rotation time of the
+        // log file, or the size of the log file, augmented by the specified
+        // 'numPendingBytes' not yet written to it, exceeds the allowable size,
+        // and 'false' otherwise.  The behavior is undefined unless the caller
+        // acquired the lock for this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
@@ -453,6 +475,14 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods, respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    int writeBatchBuffer();
+        // Write the records formatted into the batch arena to the current log
+        // file, if any, using a single write where the platform permits, and
+        // rewind the arena (retaining its capacity).  Return 0 on success,
+        // and a non-zero value otherwise, in which case file logging is
+        // disabled.  The behavior is undefined unless the caller acquired the
+        // lock for this object.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2, bslma::UsesBslmaAllocator);
@@ -565,6 +595,21 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records in the specified
+        // 'records' array, in order, by formatting them into an internal
+        // buffer and writing that buffer to the current log file, if file
+        // logging is enabled for this file observer, with a single write.  The
+        // lock on this object is acquired once for the whole batch.  Log file
+        // rotation is checked before each record exactly as by 'publish' (the
+        // file size accounting for records of the batch not yet written), and
+        // any rotation callback is invoked once per attempted rotation after
+        // the batch is complete.  The behavior is undefined unless
+        // '0 <= numRecords', and each of the first 'numRecords' elements of
+        // 'records' is the address of a valid record.  Note that this method
+        // produces the same output as calling 'publish' on each record in
+        // turn.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
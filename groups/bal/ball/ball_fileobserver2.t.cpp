@@ -52,6 +52,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -101,6 +102,7 @@ using bsl::flush;
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const Record *const *records, int numRecords);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
@@ -116,7 +118,8 @@ using bsl::flush;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
+// [13] CONCERN: LOGGING AN EMPTY MESSAGE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -712,7 +715,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +791,175 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the same output as publishing each record
+        //:   of the batch, in order, with 'publish'.
+        //:
+        //: 2 An empty batch has no effect.
+        //:
+        //: 3 Records are dropped if file logging is not enabled.
+        //:
+        //: 4 The size of the log file used by size-based rotation accounts
+        //:   for the records of the batch that are not yet written, so a
+        //:   rotation occurs in the middle of a batch at the same record at
+        //:   which it would occur had the records been published singly.
+        //:
+        //: 5 The rotation callback is invoked (after the batch is written)
+        //:   once for each rotation performed during the batch.
+        //:
+        //: 6 No memory is allocated from the default allocator when
+        //:   publishing a batch that does not cause a rotation.
+        //
+        // Plan:
+        //: 1 Publish a set of records to one observer with 'publishBatch' and
+        //:   to another with 'publish' and compare the resulting log files.
+        //:   (C-1)
+        //:
+        //: 2 Publish an empty batch and verify the log file is unchanged.
+        //:   (C-2)
+        //:
+        //: 3 Publish a batch with file logging disabled.  (C-3)
+        //:
+        //: 4 Enable rotation on a size of 1 KB, and publish a batch of records
+        //:   of about 600 bytes each.  Verify that the log file is rotated
+        //:   before the third record and before the fifth record, that the
+        //:   rotated files and current log file hold the expected number of
+        //:   records, and that the rotation callback was invoked twice.
+        //:   (C-4..5)
+        //:
+        //: 5 Use a test allocator as the default allocator, and verify that
+        //:   it is not used by 'publishBatch' in P-1.  (C-6)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_RECORDS = 5 };
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+        bslma::TestAllocator da("da", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::string message(600, 'x', &ta);
+
+        bsl::vector<ball::Record> records(&ta);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3 + i,
+                                        "CATEGORY",
+                                        ball::Severity::e_INFO,
+                                        message.c_str(),
+                                        &ta);
+
+            records.push_back(ball::Record(attr, ball::UserFields(), &ta));
+        }
+
+        const ball::Record *RECORDS[k_NUM_RECORDS];
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            RECORDS[i] = &records[i];
+        }
+
+        const ball::Context CONTEXT(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        TempDirectoryGuard tempDirGuard(&ta);
+
+        if (verbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            bsl::string fileName1(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName1, "batch.log");
+            bsl::string fileName2(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName2, "single.log");
+
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName1.c_str()));
+            ASSERT(0 == mY.enableFileLogging(fileName2.c_str()));
+
+            mX.publishBatch(RECORDS, 0);
+            ASSERT(0 == FsUtil::getFileSize(fileName1.c_str()));
+
+            const Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+            mX.publishBatch(RECORDS, k_NUM_RECORDS);
+
+            ASSERTV(NUM_DEFAULT_BLOCKS,   da.numBlocksTotal(),
+                    NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mY.publish(*RECORDS[i], CONTEXT);
+            }
+
+            mX.disableFileLogging();
+            mY.disableFileLogging();
+            ASSERT(false == X.isFileLoggingEnabled());
+
+            bsl::string batchOutput(&ta), singleOutput(&ta);
+
+            ASSERT(2 * k_NUM_RECORDS ==
+                       readFileIntoString(__LINE__, fileName1, batchOutput));
+            ASSERT(2 * k_NUM_RECORDS ==
+                      readFileIntoString(__LINE__, fileName2, singleOutput));
+            ASSERTV(batchOutput, singleOutput, batchOutput == singleOutput);
+
+            const Int64 size = FsUtil::getFileSize(fileName1.c_str());
+
+            mX.publishBatch(RECORDS, k_NUM_RECORDS);
+            ASSERT(size == FsUtil::getFileSize(fileName1.c_str()));
+        }
+
+        if (verbose) cout << "\tTesting rotation within a batch." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "rotate.log");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            RotCb cb(&ta);
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+            ASSERT(1 == X.rotationSize());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bsl::string logFileName(&ta);
+            ASSERT(X.isFileLoggingEnabled(&logFileName));
+
+            mX.publishBatch(RECORDS, k_NUM_RECORDS);
+
+            // Records 0 and 1 fit within 1 KB; the file is rotated before
+            // records 2 and 4.
+
+            ASSERTV(cb.numInvocations(), 2 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+            ASSERT(FsUtil::exists(cb.rotatedFileName()));
+            ASSERTV(getNumLines(cb.rotatedFileName().c_str()),
+                    4 == getNumLines(cb.rotatedFileName().c_str()));
+            ASSERTV(getNumLines(logFileName.c_str()),
+                    2 == getNumLines(logFileName.c_str()));
+
+            mX.disableFileLogging();
+        }
+
+        if (verbose) cout << "\tTesting with file logging disabled." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.publishBatch(RECORDS, k_NUM_RECORDS);
+            ASSERT(false == X.isFileLoggingEnabled());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
@@ -29,6 +29,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <bslmt_once.h>
 #include <bslmt_qlock.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadlocalvariable.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
@@ -118,6 +119,150 @@ void bufferPoolDeleter(void *buffer, void *pool)
     p->deallocate(buffer);
 }
 
+                        // ===========================
+                        // struct ThreadMessageBuffers
+                        // ===========================
+
+struct ThreadMessageBuffers {
+    // This 'struct' holds the message buffers of one thread, used by loggers
+    // having the 'e_PER_THREAD_BUFFER' message buffer policy.  The buffer
+    // lent by 'Logger::obtainMessageBuffer(int *)' is distinct from the one
+    // guarded by 'd_mutex', so that calls to the two overloads may be nested.
+
+    bslmt::Mutex      d_mutex;            // returned with 'd_lockedBuffer_p'
+
+    char             *d_lockedBuffer_p;   // buffer returned with 'd_mutex'
+                                          // (owned)
+
+    int               d_lockedSize;       // size of 'd_lockedBuffer_p'
+
+    char             *d_lentBuffer_p;     // buffer lent by managed pointer
+                                          // (owned)
+
+    int               d_lentSize;         // size of 'd_lentBuffer_p'
+
+    bool              d_isLent;           // 'true' while 'd_lentBuffer_p' is
+                                          // referred to by a managed pointer
+
+    bslma::Allocator *d_allocator_p;      // memory allocator (held, not
+                                          // owned)
+};
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(ThreadMessageBuffers *, g_threadMessageBuffers, 0);
+    // Cache for 'bslmt::ThreadUtil::getSpecific'; the buffers are owned by
+    // thread-specific storage.
+#endif
+
+void destroyThreadMessageBuffers(void *arg)
+    // Destroy the 'ThreadMessageBuffers' object at the specified 'arg' address
+    // and release its memory.  This function is invoked on thread exit.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadMessageBuffers = 0;
+#endif
+
+    ThreadMessageBuffers *buffers = static_cast<ThreadMessageBuffers *>(arg);
+    if (buffers) {
+        bslma::Allocator *allocator = buffers->d_allocator_p;
+
+        BSLS_ASSERT(!buffers->d_isLent);
+
+        allocator->deallocate(buffers->d_lockedBuffer_p);
+        allocator->deallocate(buffers->d_lentBuffer_p);
+        allocator->deleteObjectRaw(buffers);
+    }
+}
+
+const bslmt::ThreadUtil::Key& threadMessageBuffersKey()
+    // Return a reference to the thread-specific storage key under which the
+    // message buffers of each thread are stored.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        int rc = bslmt::ThreadUtil::createKey(&s_key,
+                                              &destroyThreadMessageBuffers);
+        BSLS_ASSERT_OPT(0 == rc);
+        (void)rc;
+    }
+    return s_key;
+}
+
+ThreadMessageBuffers *threadMessageBuffers()
+    // Return the address of the message buffers of the calling thread,
+    // creating them if necessary.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (g_threadMessageBuffers) {
+        return g_threadMessageBuffers;                                // RETURN
+    }
+#endif
+
+    const bslmt::ThreadUtil::Key& key = threadMessageBuffersKey();
+
+    ThreadMessageBuffers *buffers = static_cast<ThreadMessageBuffers *>(
+                                          bslmt::ThreadUtil::getSpecific(key));
+    if (!buffers) {
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        buffers = new (*allocator) ThreadMessageBuffers();
+        buffers->d_lockedBuffer_p = 0;
+        buffers->d_lockedSize     = 0;
+        buffers->d_lentBuffer_p   = 0;
+        buffers->d_lentSize       = 0;
+        buffers->d_isLent         = false;
+        buffers->d_allocator_p    = allocator;
+
+        if (0 != bslmt::ThreadUtil::setSpecific(key, buffers)) {
+            bsls::Log::platformDefaultMessageHandler(
+                  bsls::LogSeverity::e_ERROR,
+                  __FILE__,
+                  __LINE__,
+                  "Failed to add message buffers to thread specific storage.");
+            BSLS_ASSERT(false);
+        }
+    }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadMessageBuffers = buffers;
+#endif
+
+    return buffers;
+}
+
+char *reserveBuffer(char             **buffer,
+                    int               *size,
+                    int                requiredSize,
+                    bslma::Allocator  *allocator)
+    // Ensure that the specified '*buffer', having the specified '*size', can
+    // hold at least the specified 'requiredSize' bytes, reallocating it from
+    // the specified 'allocator' (and updating '*size') if necessary, and
+    // return '*buffer'.
+{
+    if (*size < requiredSize) {
+        char *newBuffer = static_cast<char *>(
+                                           allocator->allocate(requiredSize));
+        allocator->deallocate(*buffer);
+        *buffer = newBuffer;
+        *size   = requiredSize;
+    }
+    return *buffer;
+}
+
+void threadBufferDeleter(void *, void *buffers)
+    // Mark the lent buffer of the specified 'buffers' as available.  The
+    // behavior is undefined unless 'buffers' refers to an instance of
+    // 'ThreadMessageBuffers' whose lent buffer is in use.
+{
+    BSLS_ASSERT(buffers);
+
+    ThreadMessageBuffers *b = static_cast<ThreadMessageBuffers *>(buffers);
+
+    BSLS_ASSERT(b->d_isLent);
+
+    b->d_isLent = false;
+}
+
 const char *filterName(
    bsl::string                                             *filteredNameBuffer,
    const char                                              *originalName,
@@ -283,6 +428,8 @@ Logger::Logger(const bsl::shared_ptr<Observer>&            observer,
                int                                         scratchBufferSize,
                LoggerManagerConfiguration::LogOrder        logOrder,
                LoggerManagerConfiguration::TriggerMarkers  triggerMarkers,
+               LoggerManagerConfiguration::MessageBufferPolicy
+                                                           messageBufferPolicy,
                bslma::Allocator                           *globalAllocator)
 : d_recordPool(-1, globalAllocator)
 , d_observer(observer)
@@ -293,6 +440,7 @@ Logger::Logger(const bsl::shared_ptr<Observer>&            observer,
 , d_scratchBufferSize(scratchBufferSize)
 , d_logOrder(logOrder)
 , d_triggerMarkers(triggerMarkers)
+, d_messageBufferPolicy(messageBufferPolicy)
 , d_allocator_p(globalAllocator)
 {
     BSLS_ASSERT(d_observer);
@@ -504,6 +652,25 @@ void Logger::logMessage(const Category&  category,
 
 char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 {
+    if (LoggerManagerConfiguration::e_PER_THREAD_BUFFER ==
+                                                       d_messageBufferPolicy) {
+        ThreadMessageBuffers *buffers = threadMessageBuffers();
+
+        // The mutex is private to this thread, so it can be held only by an
+        // enclosing call (e.g., one made for another logger by this thread
+        // while formatting a message, or from an observer), in which case
+        // fall back to the buffer of this logger.
+
+        if (0 == buffers->d_mutex.tryLock()) {
+            *mutex      = &buffers->d_mutex;
+            *bufferSize = d_scratchBufferSize;
+            return reserveBuffer(&buffers->d_lockedBuffer_p,          // RETURN
+                                 &buffers->d_lockedSize,
+                                 d_scratchBufferSize,
+                                 buffers->d_allocator_p);
+        }
+    }
+
     d_scratchBufferMutex.lock();
     *mutex      = &d_scratchBufferMutex;
     *bufferSize = d_scratchBufferSize;
@@ -513,6 +680,30 @@ char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 bslma::ManagedPtr<char> Logger::obtainMessageBuffer(int *bufferSize)
 {
     *bufferSize = d_scratchBufferSize;
+
+    if (LoggerManagerConfiguration::e_PER_THREAD_BUFFER ==
+                                                       d_messageBufferPolicy) {
+        ThreadMessageBuffers *buffers = threadMessageBuffers();
+
+        // If the buffer of this thread is already lent (i.e., a message is
+        // logged while the arguments of another are being formatted), fall
+        // back to the pool.
+
+        if (!buffers->d_isLent) {
+            buffers->d_isLent = true;
+
+            char *buffer = reserveBuffer(&buffers->d_lentBuffer_p,
+                                         &buffers->d_lentSize,
+                                         d_scratchBufferSize,
+                                         buffers->d_allocator_p);
+
+            return bslma::ManagedPtr<char>(                           // RETURN
+                                         buffer,
+                                         static_cast<void *>(buffers),
+                                         &threadBufferDeleter);
+        }
+    }
+
     char *buffer = static_cast<char *>(d_bufferPool.allocate());
 
     bslma::ManagedPtr<char> bufferManagedPtr(
@@ -607,6 +798,7 @@ LoggerManager::LoggerManager(
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
 , d_logOrder(configuration.logOrder())
 , d_triggerMarkers(configuration.triggerMarkers())
+, d_messageBufferPolicy(configuration.messageBufferPolicy())
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
 {
     BSLS_ASSERT(d_observer);
@@ -649,6 +841,7 @@ void LoggerManager::constructObject(
                                             d_scratchBufferSize,
                                             d_logOrder,
                                             d_triggerMarkers,
+                                            d_messageBufferPolicy,
                                             d_allocator_p);
     d_loggers.insert(d_logger_p);
     d_defaultCategory_p = d_categoryManager.addCategory(
@@ -992,6 +1185,7 @@ LoggerManager::LoggerManager(
 , d_defaultLoggers(bslma::Default::globalAllocator(globalAllocator))
 , d_logOrder(configuration.logOrder())
 , d_triggerMarkers(configuration.triggerMarkers())
+, d_messageBufferPolicy(configuration.messageBufferPolicy())
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
 {
     BSLS_ASSERT(d_observer);
@@ -1039,6 +1233,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer)
                                                 d_scratchBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
+                                                d_messageBufferPolicy,
                                                 d_allocator_p);
     d_loggers.insert(logger);
 
@@ -1057,6 +1252,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
                                                 scratchBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
+                                                d_messageBufferPolicy,
                                                 d_allocator_p);
     d_loggers.insert(logger);
 
@@ -1080,6 +1276,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
                                                 d_scratchBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
+                                                d_messageBufferPolicy,
                                                 d_allocator_p);
     d_loggers.insert(logger);
 
@@ -1103,6 +1300,7 @@ Logger *LoggerManager::allocateLogger(RecordBuffer *buffer,
                                                 scratchBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
+                                                d_messageBufferPolicy,
                                                 d_allocator_p);
 
     d_loggers.insert(logger);
@@ -1124,6 +1322,7 @@ Logger *LoggerManager::allocateLogger(
                                                 d_scratchBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
+                                                d_messageBufferPolicy,
                                                 d_allocator_p);
     d_loggers.insert(logger);
 
@@ -1144,6 +1343,7 @@ Logger *LoggerManager::allocateLogger(
                                                 scratchBufferSize,
                                                 d_logOrder,
                                                 d_triggerMarkers,
+                                                d_messageBufferPolicy,
                                                 d_allocator_p);
 
     d_loggers.insert(logger);
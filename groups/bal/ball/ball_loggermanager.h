@@ -333,6 +333,22 @@ BSLS_IDENT("$Id: $")
 // have them share a common logger so that the trace-back log *does* include
 // all relevant records.
 //
+///Message Formatting Buffers
+/// - - - - - - - - - - - - -
+// 'printf'-style log messages (e.g., those of the 'BALL_LOGVA' macros) are
+// formatted into a buffer obtained from the logger by 'obtainMessageBuffer'
+// before the record is logged.  By default (i.e., if the 'messageBufferPolicy'
+// attribute of the 'ball::LoggerManagerConfiguration' supplied to the logger
+// manager is 'e_SHARED_BUFFER'), each logger provides a single buffer guarded
+// by a mutex, and a pool of buffers shared by all threads, so that threads
+// logging through the same logger contend for them.  If the
+// 'messageBufferPolicy' attribute is 'e_PER_THREAD_BUFFER', each thread
+// instead formats messages into buffers of its own, created on first use (of
+// at least the 'defaultLoggerBufferSize' of the configuration, or of the size
+// requested when the logger was allocated, if larger), and released when the
+// thread exits; no lock shared between threads is taken.  The memory for
+// these per-thread buffers is supplied by the global allocator.
+//
 ///'bsls::Log' Logging Redirection
 ///-------------------------------
 // The 'ball::LoggerManager' singleton, on construction, redirects 'bsls::Log'
@@ -963,6 +979,9 @@ class Logger {
     LoggerManagerConfiguration::TriggerMarkers
                   d_triggerMarkers;             // trigger markers
 
+    LoggerManagerConfiguration::MessageBufferPolicy
+                  d_messageBufferPolicy;        // message buffer policy
+
     bslma::Allocator
                  *d_allocator_p;                // memory allocator (held, not
                                                 // owned)
@@ -983,6 +1002,8 @@ class Logger {
            int                                         scratchBufferSize,
            LoggerManagerConfiguration::LogOrder        logOrder,
            LoggerManagerConfiguration::TriggerMarkers  triggerMarkers,
+           LoggerManagerConfiguration::MessageBufferPolicy
+                                                       messageBufferPolicy,
            bslma::Allocator                           *globalAllocator);
         // Create a logger having the specified 'observer' that receives
         // published log records, the specified 'recordBuffer' that stores log
@@ -992,11 +1013,12 @@ class Logger {
         // 'scratchBufferSize' for the internal message buffer accessible via
         // 'obtainMessageBuffer', and the specified 'globalAllocator' used to
         // supply memory.  On a Trigger or Trigger-All event, the messages are
-        // published in the specified 'logOrder'.  The behavior is undefined
-        // unless 'observer', 'recordBuffer', and 'globalAllocator' are
-        // non-null.  Note that this constructor is 'private' since the
-        // creation of instances of 'Logger' is managed by its 'friend'
-        // 'LoggerManager'.
+        // published in the specified 'logOrder'.  The buffers returned by
+        // 'obtainMessageBuffer' are provided according to the specified
+        // 'messageBufferPolicy'.  The behavior is undefined unless
+        // 'observer', 'recordBuffer', and 'globalAllocator' are non-null.
+        // Note that this constructor is 'private' since the creation of
+        // instances of 'Logger' is managed by its 'friend' 'LoggerManager'.
 
     ~Logger();
         // Destroy this logger.
@@ -1110,13 +1132,22 @@ class Logger {
         // thread of execution currently holds a lock on the buffer.  Note that
         // the buffer is intended to be used *only* for formatting log messages
         // immediately before calling 'logMessage'; other use may adversely
-        // affect performance for the entire program.
+        // affect performance for the entire program.  Also note that, if the
+        // message buffer policy of this logger is 'e_PER_THREAD_BUFFER', the
+        // buffer and mutex are private to the calling thread, so that this
+        // method does not block, unless the calling thread already holds them
+        // (through a call for another logger), in which case the buffer of
+        // this logger is returned as if the policy were 'e_SHARED_BUFFER'.
 
     bslma::ManagedPtr<char> obtainMessageBuffer(int *bufferSize);
         // Return a managed pointer that refers to the memory block to which
         // this thread of execution has exclusive access and load the size (in
-        // bytes) of this buffer into the specified 'bufferSize' address.  Note
-        // that this method is intended for *internal* *use* only.
+        // bytes) of this buffer into the specified 'bufferSize' address.  If
+        // the message buffer policy of this logger is 'e_PER_THREAD_BUFFER',
+        // the block is owned by the calling thread (unless that block is
+        // already in use by an enclosing call, in which case a pooled block
+        // is returned).  Note that this method is intended for *internal*
+        // *use* only.
 
     void publish();
         // Publish to the observer held by this logger all records stored in
@@ -1269,6 +1300,10 @@ class LoggerManager {
     LoggerManagerConfiguration::TriggerMarkers
                            d_triggerMarkers;     // trigger markers
 
+    LoggerManagerConfiguration::MessageBufferPolicy
+                           d_messageBufferPolicy;
+                                                 // message buffer policy
+
     bslma::Allocator      *d_allocator_p;        // memory allocator (held,
                                                  // not owned)
 
@@ -212,6 +212,7 @@ using namespace bdlf::PlaceHolders;
 // [40] USAGE EXAMPLE #3
 // [41] USAGE EXAMPLE #4
 // [37] CONCERN: RECORD POOL MEMORY CONSUMPTION
+// [44] CONCERN: PER-THREAD MESSAGE BUFFERS
 // [19] CONCERN: PERFORMANCE IMPLICATIONS
 // [12] CONCERN: USER FIELDS POPULATOR CALLBACK
 // [11] CONCERN: INTERNAL BROADCAST OBSERVER
@@ -365,6 +366,107 @@ void executeInParallel(int numThreads, bslmt::ThreadUtil::ThreadFunction func)
     delete [] threads;
 }
 
+struct MessageBufferInfo {
+    // This 'struct' records the message buffers obtained by one thread from a
+    // logger.
+
+    ball::Logger   *d_logger_p;       // logger to query (held, not owned)
+    bslmt::Barrier *d_barrier_p;      // barrier waited upon before returning
+
+    bslmt::Mutex   *d_mutex_p;        // mutex returned with 'd_lockedBuffer_p'
+    char           *d_lockedBuffer_p; // buffer guarded by 'd_mutex_p'
+    int             d_lockedSize;     // size of 'd_lockedBuffer_p'
+    char           *d_lentBuffer_p;   // buffer obtained by managed pointer
+    char           *d_nestedBuffer_p; // buffer obtained while another is lent
+    char           *d_reusedBuffer_p; // buffer obtained after both released
+    int             d_lentSize;       // size of 'd_lentBuffer_p'
+};
+
+extern "C" void *obtainMessageBuffers(void *arg)
+    // Obtain message buffers from the logger of the 'MessageBufferInfo'
+    // object at the specified 'arg' address, record their addresses and sizes
+    // in that object, and write to each buffer.  Wait on the barrier of that
+    // object before returning, so that the buffers of all threads are alive
+    // at the same time.
+{
+    MessageBufferInfo *info = static_cast<MessageBufferInfo *>(arg);
+
+    info->d_lockedBuffer_p = info->d_logger_p->obtainMessageBuffer(
+                                                         &info->d_mutex_p,
+                                                         &info->d_lockedSize);
+    bsl::memset(info->d_lockedBuffer_p, 'a', info->d_lockedSize);
+    info->d_mutex_p->unlock();
+
+    {
+        bslma::ManagedPtr<char> lent =
+                   info->d_logger_p->obtainMessageBuffer(&info->d_lentSize);
+        bsl::memset(lent.get(), 'b', info->d_lentSize);
+
+        int                     nestedSize;
+        bslma::ManagedPtr<char> nested =
+                           info->d_logger_p->obtainMessageBuffer(&nestedSize);
+        bsl::memset(nested.get(), 'c', nestedSize);
+
+        info->d_lentBuffer_p   = lent.get();
+        info->d_nestedBuffer_p = nested.get();
+    }
+
+    int                     reusedSize;
+    bslma::ManagedPtr<char> reused =
+                           info->d_logger_p->obtainMessageBuffer(&reusedSize);
+    info->d_reusedBuffer_p = reused.get();
+
+    info->d_barrier_p->wait();
+    return 0;
+}
+
+struct NestedMessageBufferInfo {
+    // This 'struct' records the message buffers obtained by one thread from
+    // two loggers, the second while the buffer of the first is held.
+
+    ball::Logger *d_outerLogger_p;    // logger queried first (held, not
+                                      // owned)
+
+    ball::Logger *d_innerLogger_p;    // logger queried second (held, not
+                                      // owned)
+
+    bslmt::Mutex *d_outerMutex_p;     // mutex returned by 'd_outerLogger_p'
+    char         *d_outerBuffer_p;    // buffer returned by 'd_outerLogger_p'
+    bslmt::Mutex *d_innerMutex_p;     // mutex returned by 'd_innerLogger_p'
+    char         *d_innerBuffer_p;    // buffer returned by 'd_innerLogger_p'
+    int           d_innerSize;        // size of 'd_innerBuffer_p'
+    bool          d_outerIntact;      // 'true' if the outer message survived
+                                      // the formatting of the inner one
+};
+
+extern "C" void *obtainNestedMessageBuffers(void *arg)
+    // Obtain, by mutex, the message buffer of the outer logger of the
+    // 'NestedMessageBufferInfo' object at the specified 'arg' address, then,
+    // while holding it, that of its inner logger, format a message into each,
+    // and record the results in that object.
+{
+    NestedMessageBufferInfo *info =
+                                 static_cast<NestedMessageBufferInfo *>(arg);
+
+    int outerSize;
+    info->d_outerBuffer_p = info->d_outerLogger_p->obtainMessageBuffer(
+                                                        &info->d_outerMutex_p,
+                                                        &outerSize);
+    bsl::snprintf(info->d_outerBuffer_p, outerSize, "outer message");
+
+    info->d_innerBuffer_p = info->d_innerLogger_p->obtainMessageBuffer(
+                                                        &info->d_innerMutex_p,
+                                                        &info->d_innerSize);
+    bsl::snprintf(info->d_innerBuffer_p, info->d_innerSize, "inner message");
+
+    info->d_outerIntact =
+                   0 == bsl::strcmp(info->d_outerBuffer_p, "outer message");
+
+    info->d_innerMutex_p->unlock();
+    info->d_outerMutex_p->unlock();
+    return 0;
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE 1
 // ----------------------------------------------------------------------------
@@ -1767,6 +1869,151 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 44: {
+        // --------------------------------------------------------------------
+        // CONCERN: PER-THREAD MESSAGE BUFFERS
+        //
+        // Concerns:
+        //: 1 With the 'e_SHARED_BUFFER' policy, every thread is given the
+        //:   same mutex-guarded buffer.
+        //:
+        //: 2 With the 'e_PER_THREAD_BUFFER' policy, concurrently executing
+        //:   threads are given distinct buffers, by both 'obtainMessageBuffer'
+        //:   overloads.
+        //:
+        //: 3 With the 'e_PER_THREAD_BUFFER' policy, a buffer obtained by
+        //:   managed pointer while another is still held is distinct from
+        //:   it, and the buffer of the thread is reused once released.
+        //:
+        //: 4 The buffers have (at least) the configured size.
+        //:
+        //: 5 Per-thread buffers are allocated from the global allocator, and
+        //:   released when the thread exits.
+        //:
+        //: 6 A buffer can be obtained, by mutex, from a second logger while
+        //:   the calling thread holds the buffer obtained from the first
+        //:   (e.g., when a message is logged while another is formatted),
+        //:   without deadlock.
+        //
+        // Plan:
+        //: 1 For each message buffer policy, create a logger manager, and
+        //:   obtain buffers from its logger in two concurrently executing
+        //:   threads.  Verify the addresses and sizes of the buffers, and that
+        //:   no memory from the global allocator remains in use after the
+        //:   threads are joined.  (C-1..5)
+        //:
+        //: 2 For each message buffer policy, while holding the buffer of the
+        //:   logger of the manager, obtain the buffer of a second logger,
+        //:   format a message into both, and verify that the buffers and
+        //:   mutexes are distinct.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: PER-THREAD MESSAGE BUFFERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PER-THREAD MESSAGE BUFFERS" << endl
+                          << "===================================" << endl;
+
+        typedef ball::LoggerManagerConfiguration Config;
+
+        const int k_NUM_THREADS = 2;
+        const int k_BUFFER_SIZE = 1024;
+
+        bslma::TestAllocator ga("global", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        bslma::Allocator *originalGlobalAllocator =
+                                    bslma::Default::setGlobalAllocator(&ga);
+
+        const Config::MessageBufferPolicy POLICIES[] = {
+            Config::e_SHARED_BUFFER,
+            Config::e_PER_THREAD_BUFFER
+        };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Config::MessageBufferPolicy POLICY = POLICIES[ti];
+
+            if (veryVerbose) { T_ P(POLICY) }
+
+            Config mXC;
+            ASSERT(0 == mXC.setDefaultLoggerBufferSizeIfValid(k_BUFFER_SIZE));
+            mXC.setMessageBufferPolicy(POLICY);
+
+            Obj mX(mXC, &ta);
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            MessageBufferInfo         info[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                info[i].d_logger_p  = &mX.getLogger();
+                info[i].d_barrier_p = &barrier;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      &obtainMessageBuffers,
+                                                      &info[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                const MessageBufferInfo& I = info[i];
+
+                LOOP2_ASSERT(ti, i, k_BUFFER_SIZE <= I.d_lockedSize);
+                LOOP2_ASSERT(ti, i, k_BUFFER_SIZE <= I.d_lentSize);
+                LOOP2_ASSERT(ti, i, I.d_lentBuffer_p != I.d_nestedBuffer_p);
+                LOOP2_ASSERT(ti, i, I.d_lockedBuffer_p != I.d_lentBuffer_p);
+            }
+
+            if (Config::e_SHARED_BUFFER == POLICY) {
+                ASSERT(info[0].d_mutex_p        == info[1].d_mutex_p);
+                ASSERT(info[0].d_lockedBuffer_p == info[1].d_lockedBuffer_p);
+            }
+            else {
+                ASSERT(info[0].d_mutex_p        != info[1].d_mutex_p);
+                ASSERT(info[0].d_lockedBuffer_p != info[1].d_lockedBuffer_p);
+                ASSERT(info[0].d_lentBuffer_p   != info[1].d_lentBuffer_p);
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    LOOP_ASSERT(i, info[i].d_lentBuffer_p ==
+                                                     info[i].d_reusedBuffer_p);
+                }
+            }
+
+            if (veryVerbose) { T_ T_ Q(NESTED LOGGERS) }
+            {
+                ball::FixedSizeRecordBuffer recordBuffer(k_BUFFER_SIZE, &ta);
+
+                NestedMessageBufferInfo nested;
+                nested.d_outerLogger_p = &mX.getLogger();
+                nested.d_innerLogger_p = mX.allocateLogger(&recordBuffer);
+                nested.d_outerIntact   = false;
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                   &handle,
+                                                   &obtainNestedMessageBuffers,
+                                                   &nested));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                LOOP_ASSERT(ti, nested.d_outerMutex_p  !=
+                                                       nested.d_innerMutex_p);
+                LOOP_ASSERT(ti, nested.d_outerBuffer_p !=
+                                                      nested.d_innerBuffer_p);
+                LOOP_ASSERT(ti, k_BUFFER_SIZE <= nested.d_innerSize);
+                LOOP_ASSERT(ti, nested.d_outerIntact);
+
+                mX.deallocateLogger(nested.d_innerLogger_p);
+            }
+
+            LOOP2_ASSERT(ti, ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+        }
+
+        bslma::Default::setGlobalAllocator(originalGlobalAllocator);
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 43: {
         // --------------------------------------------------------------------
@@ -58,6 +58,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 bsl::allocator<DefaultThresholdLevelsCallback>(basicAllocator))
 , d_logOrder(e_LIFO)
 , d_triggerMarkers(e_BEGIN_END_MARKERS)
+, d_messageBufferPolicy(e_SHARED_BUFFER)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -79,6 +80,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 original.d_defaultThresholdsCb)
 , d_logOrder(original.d_logOrder)
 , d_triggerMarkers(original.d_triggerMarkers)
+, d_messageBufferPolicy(original.d_messageBufferPolicy)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -93,6 +95,7 @@ LoggerManagerConfiguration::operator=(const LoggerManagerConfiguration& rhs)
     d_defaultThresholdsCb = rhs.d_defaultThresholdsCb;
     d_logOrder            = rhs.d_logOrder;
     d_triggerMarkers      = rhs.d_triggerMarkers;
+    d_messageBufferPolicy = rhs.d_messageBufferPolicy;
 
     return *this;
 }
@@ -159,6 +162,12 @@ void LoggerManagerConfiguration::setTriggerMarkers(TriggerMarkers value)
     d_triggerMarkers = value;
 }
 
+void LoggerManagerConfiguration::setMessageBufferPolicy(
+                                                     MessageBufferPolicy value)
+{
+    d_messageBufferPolicy = value;
+}
+
 // ACCESSORS
 const LoggerManagerDefaults& LoggerManagerConfiguration::defaults() const
 {
@@ -225,6 +234,12 @@ LoggerManagerConfiguration::triggerMarkers() const
     return d_triggerMarkers;
 }
 
+LoggerManagerConfiguration::MessageBufferPolicy
+LoggerManagerConfiguration::messageBufferPolicy() const
+{
+    return d_messageBufferPolicy;
+}
+
 bsl::ostream&
 LoggerManagerConfiguration::print(bsl::ostream& stream,
                                   int           level,
@@ -272,6 +287,12 @@ LoggerManagerConfiguration::print(bsl::ostream& stream,
                                                  : "BEGIN_END_MARKERS";
     stream << "Trigger markers are " << triggerMarker << NL;
 
+    bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+    const char *bufferPolicy = d_messageBufferPolicy == e_SHARED_BUFFER
+                                                   ? "SHARED_BUFFER"
+                                                   : "PER_THREAD_BUFFER";
+    stream << "Message buffer policy is " << bufferPolicy << NL;
+
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << ']' << NL;
 
@@ -295,7 +316,8 @@ bool ball::operator==(const ball::LoggerManagerConfiguration& lhs,
         && (bool)lhs.d_categoryNameFilter  == (bool)rhs.d_categoryNameFilter
         && (bool)lhs.d_defaultThresholdsCb == (bool)rhs.d_defaultThresholdsCb
         && lhs.d_logOrder                  == rhs.d_logOrder
-        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers;
+        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers
+        && lhs.d_messageBufferPolicy       == rhs.d_messageBufferPolicy;
 }
 
 bool ball::operator!=(const ball::LoggerManagerConfiguration& lhs,
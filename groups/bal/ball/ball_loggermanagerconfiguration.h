@@ -62,6 +62,8 @@ BSLS_IDENT("$Id: $")
 //
 //  TriggerMarkers                               triggerMarkers
 //
+//  MessageBufferPolicy                          messageBufferPolicy
+//
 //  NAME                            DESCRIPTION
 //  -------------------             -------------------------------------------
 //  defaults                        constrained defaults for buffer size and
@@ -90,6 +92,13 @@ BSLS_IDENT("$Id: $")
 //                                  sequence of records logged due to a Trigger
 //                                  or Trigger-All event; default is
 //                                  'e_BEGIN_END_MARKERS'.
+//
+//  messageBufferPolicy             defines whether the buffers into which
+//                                  loggers format 'printf'-style messages are
+//                                  shared by all threads (and protected by a
+//                                  lock) or are private to each thread; see
+//                                  {'ball_loggermanager'}; default is
+//                                  'e_SHARED_BUFFER'.
 //..
 // The constraints are as follows:
 //..
@@ -107,6 +116,8 @@ BSLS_IDENT("$Id: $")
 //  +--------------------------------+--------------------------------+
 //  | triggerMarkers                 | (none)                         |
 //  +--------------------------------+--------------------------------+
+//  | messageBufferPolicy            | (none)                         |
+//  +--------------------------------+--------------------------------+
 //..
 // For convenience, the 'ball::LoggerManagerConfiguration' interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -170,12 +181,16 @@ BSLS_IDENT("$Id: $")
 //    config.setUserFieldsPopulatorCallback(&exampleCallback);
 //    config.setLogOrder(ball::LoggerManagerConfiguration::e_FIFO);
 //    config.setTriggerMarkers(ball::LoggerManagerConfiguration::e_NO_MARKERS);
+//    config.setMessageBufferPolicy(
+//                  ball::LoggerManagerConfiguration::e_PER_THREAD_BUFFER);
 //..
 // Now, we verify the options are configured correctly:
 //..
 //    assert(ball::LoggerManagerConfiguration::e_FIFO == config.logOrder());
 //    assert(ball::LoggerManagerConfiguration::e_NO_MARKERS
 //                                                 == config.triggerMarkers());
+//    assert(ball::LoggerManagerConfiguration::e_PER_THREAD_BUFFER
+//                                            == config.messageBufferPolicy());
 //..
 // Finally, we print the configuration value to 'stdout' and return:
 //..
@@ -201,6 +216,7 @@ BSLS_IDENT("$Id: $")
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Message buffer policy is PER_THREAD_BUFFER
 //  ]
 //..
 
@@ -301,6 +317,21 @@ class LoggerManagerConfiguration {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    enum MessageBufferPolicy {
+        // The 'MessageBufferPolicy' enumeration defines how loggers provide
+        // the buffers into which 'printf'-style log messages are formatted.
+        // If this attribute is 'e_SHARED_BUFFER', each logger has a single
+        // buffer protected by a mutex, and a pool of buffers shared by all
+        // threads.  If this attribute is 'e_PER_THREAD_BUFFER', each thread
+        // formats messages into buffers of its own, so that threads logging
+        // through the same logger do not contend.  The default value of this
+        // attribute is 'e_SHARED_BUFFER'.
+
+        e_SHARED_BUFFER,     // buffers shared by all threads (default)
+
+        e_PER_THREAD_BUFFER  // buffers private to each thread
+    };
+
   private:
     // DATA
     LoggerManagerDefaults d_defaults;             // default buffer size for
@@ -328,6 +359,8 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    MessageBufferPolicy   d_messageBufferPolicy;  // message buffer policy
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -450,6 +483,10 @@ class LoggerManagerConfiguration {
         // Set the trigger marker attribute of this object to the specified
         // 'value'.
 
+    void setMessageBufferPolicy(MessageBufferPolicy value);
+        // Set the message buffer policy attribute of this object to the
+        // specified 'value'.
+
     // ACCESSORS
     const LoggerManagerDefaults& defaults() const;
         // Return a reference to the non-modifiable defaults object attribute
@@ -500,6 +537,10 @@ class LoggerManagerConfiguration {
         // Return the trigger marker attribute of this object.  See attributes
         // description for effects of the trigger markers.
 
+    MessageBufferPolicy messageBufferPolicy() const;
+        // Return the message buffer policy attribute of this object.  See
+        // attributes description for effects of the message buffer policy.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
                         int           spacesPerLevel = 4) const;
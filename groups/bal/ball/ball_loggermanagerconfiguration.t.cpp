@@ -61,6 +61,8 @@ using namespace bsl;  // automatically added by script
 // [ 1] const ball::LMD& defaults() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] void setMessageBufferPolicy(MessageBufferPolicy value);
+// [ 7] MessageBufferPolicy messageBufferPolicy() const;
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -70,7 +72,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -192,12 +194,16 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
       config.setUserFieldsPopulatorCallback(&exampleCallback);
       config.setLogOrder(ball::LoggerManagerConfiguration::e_FIFO);
       config.setTriggerMarkers(ball::LoggerManagerConfiguration::e_NO_MARKERS);
+      config.setMessageBufferPolicy(
+                    ball::LoggerManagerConfiguration::e_PER_THREAD_BUFFER);
 //..
 // Now, we verify the options are configured correctly:
 //..
       ASSERT(ball::LoggerManagerConfiguration::e_FIFO == config.logOrder());
       ASSERT(ball::LoggerManagerConfiguration::e_NO_MARKERS
                                                    == config.triggerMarkers());
+      ASSERT(ball::LoggerManagerConfiguration::e_PER_THREAD_BUFFER
+                                              == config.messageBufferPolicy());
 //..
 // Finally, we print the configuration value to 'stdout' and return:
 //..
@@ -223,6 +229,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Message buffer policy is PER_THREAD_BUFFER
 //  ]
 //..
 
@@ -309,7 +316,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -328,6 +335,58 @@ int main(int argc, char *argv[])
 
         initializeConfiguration(verbose);
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'setMessageBufferPolicy' AND 'messageBufferPolicy':
+        //   Verify 'setMessageBufferPolicy' and 'messageBufferPolicy'.
+        //
+        // Concern:
+        //   That 'setMessageBufferPolicy' and 'messageBufferPolicy' work
+        //   correctly, and that the attribute participates in copying,
+        //   assignment, and equality comparison.
+        //
+        // Plan:
+        //   1. Create a configuration and verify 'messageBufferPolicy'.
+        //   2. Invoke 'setMessageBufferPolicy' with each enumerator and verify
+        //      'messageBufferPolicy'.
+        //   3. Verify that configurations differing only in this attribute
+        //      compare unequal, and that copies and assigned-to objects
+        //      compare equal to their source.
+        //
+        // Testing:
+        //   void setMessageBufferPolicy(MessageBufferPolicy value);
+        //   MessageBufferPolicy messageBufferPolicy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING 'setMessageBufferPolicy' AND "
+                 << "'messageBufferPolicy'"
+                 << "\n====================================="
+                 << "=====================\n";
+
+        Obj lmc;
+        ASSERT(lmc.messageBufferPolicy() == Obj::e_SHARED_BUFFER);
+
+        lmc.setMessageBufferPolicy(Obj::e_PER_THREAD_BUFFER);
+        ASSERT(lmc.messageBufferPolicy() == Obj::e_PER_THREAD_BUFFER);
+
+        const Obj X0;
+        ASSERT(X0 != lmc);
+
+        const Obj X1(lmc);
+        ASSERT(X1 == lmc);
+        ASSERT(X1.messageBufferPolicy() == Obj::e_PER_THREAD_BUFFER);
+
+        Obj mX2;
+        mX2 = lmc;
+        ASSERT(mX2 == lmc);
+
+        lmc.setMessageBufferPolicy(Obj::e_SHARED_BUFFER);
+        ASSERT(lmc.messageBufferPolicy() == Obj::e_SHARED_BUFFER);
+        ASSERT(X0 == lmc);
+        ASSERT(X1 != lmc);
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -34,6 +34,20 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // clients should not need to access a 'balm::Collector' directly, but instead
 // use it through another type (see 'balm_metric').
 //
+///Performance
+///-----------
+// The aggregated values of a 'balm::Collector' are held in a
+// 'balm::StripedAccumulator', which divides them into stripes updated by
+// different threads (see 'balm_stripedaccumulator').  The 'update' and
+// 'accumulateCountTotalMinMax' methods therefore do not contend with one
+// another when invoked from different threads, making them suitable for
+// instrumenting frequently executed code.  The 'load', 'loadAndReset',
+// 'reset', and 'setCountTotalMinMax' methods merge or reset all stripes, and
+// are comparatively expensive; they are expected to be invoked when metrics
+// are published.  Note that when values are supplied from several threads,
+// the loaded total may differ, in its least significant bits, from the total
+// of the same values summed in order.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -84,11 +98,7 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
-
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
-
-#include <bsl_algorithm.h>
+#include <balm_stripedaccumulator.h>
 
 namespace BloombergLP {
 
@@ -101,17 +111,17 @@ namespace balm {
 
 class Collector {
     // This class provides a mechanism for collecting and aggregating the
-    // value of a metric over a period of time.  The collector contains a
-    // 'MetricRecord' object that holds the identity of the metric being
-    // collected, the number of times an event occurred, and the total,
-    // minimum, and maximum aggregates of the associated measurement value.
+    // value of a metric over a period of time.  The collector holds the
+    // identity of the metric being collected, the number of times an event
+    // occurred, and the total, minimum, and maximum aggregates of the
+    // associated measurement value.
     // The default value for the count is 0, the default value for the total
     // is 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and
     // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
 
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId                           d_metricId;     // collected metric
+    StripedAccumulator<double, double> d_accumulator;  // aggregated values
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
@@ -190,8 +200,8 @@ class Collector {
 // CREATORS
 inline
 Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
+: d_metricId(metricId)
+, d_accumulator(MetricRecord::k_DEFAULT_MIN, MetricRecord::k_DEFAULT_MAX)
 {
 }
 
@@ -204,32 +214,23 @@ Collector::~Collector()
 inline
 void Collector::reset()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    d_accumulator.reset();
 }
 
 inline
 void Collector::loadAndReset(MetricRecord *record)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    record->metricId() = d_metricId;
+    d_accumulator.loadAndReset(&record->count(),
+                               &record->total(),
+                               &record->min(),
+                               &record->max());
 }
 
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    d_accumulator.update(value);
 }
 
 inline
@@ -238,11 +239,7 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
+    d_accumulator.accumulateCountTotalMinMax(count, total, min, max);
 }
 
 inline
@@ -251,25 +248,24 @@ void Collector::setCountTotalMinMax(int    count,
                                     double min,
                                     double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    d_accumulator.setCountTotalMinMax(count, total, min, max);
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
 inline
 void Collector::load(MetricRecord *record) const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
+    record->metricId() = d_metricId;
+    d_accumulator.load(&record->count(),
+                       &record->total(),
+                       &record->min(),
+                       &record->max());
 }
 }  // close package namespace
 
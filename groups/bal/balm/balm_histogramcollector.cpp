@@ -0,0 +1,292 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <balm_metricrecord.h>
+#include <balm_quantilerecord.h>
+
+#include <bslma_default.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cmath.h>
+
+// IMPLEMENTATION NOTES: The bucket counting a value 'v' not less than
+// '2^k_PRECISION_BITS' is identified by the number of bits, 'shift', by which
+// 'v' must be shifted right to leave 'k_PRECISION_BITS' significant bits, and
+// by those bits, 'm = v >> shift' (so that
+// '2^(k_PRECISION_BITS - 1) <= m < 2^k_PRECISION_BITS').  The index of the
+// bucket is 'shift * 2^(k_PRECISION_BITS - 1) + m', which places the buckets
+// for each 'shift' directly after those for 'shift - 1', and the buckets for
+// 'shift == 1' directly after the '2^k_PRECISION_BITS' exact buckets.
+
+namespace BloombergLP {
+namespace {
+
+const double DEFAULT_QUANTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+    // quantiles reported by a collector when none are supplied
+
+const int NUM_DEFAULT_QUANTILES = sizeof  DEFAULT_QUANTILES
+                                / sizeof *DEFAULT_QUANTILES;
+
+const bsls::Types::Int64 EMPTY_MIN = LLONG_MAX;
+    // minimum of a stripe having no values
+
+const bsls::Types::Int64 EMPTY_MAX = -1;
+    // maximum of a stripe having no values
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                         // ------------------------
+                         // class HistogramCollector
+                         // ------------------------
+
+// PRIVATE TYPES
+HistogramCollector::Stripe::Stripe()
+: d_total(0)
+, d_min(EMPTY_MIN)
+, d_max(EMPTY_MAX)
+{
+    // The default constructor of 'bsls::AtomicInt64' initializes each bucket
+    // to 0.
+}
+
+// PRIVATE MANIPULATORS
+HistogramCollector::Stripe *HistogramCollector::createStripe(int index)
+{
+    Stripe *stripe = new (*d_allocator_p) Stripe();
+
+    Stripe *previous = d_stripes[index].testAndSwap(0, stripe);
+    if (previous) {
+        // Another thread assigned to the same stripe installed it first.
+
+        d_allocator_p->deleteObjectRaw(stripe);
+        return previous;                                              // RETURN
+    }
+    return stripe;
+}
+
+// PRIVATE ACCESSORS
+void HistogramCollector::collect(QuantileRecord *record, bool resetFlag) const
+{
+    BSLS_ASSERT(record);
+
+    typedef bsls::Types::Int64 Int64;
+
+    bsl::vector<Int64> counts(k_NUM_BUCKETS, 0, d_allocator_p);
+
+    Int64 count = 0;
+    Int64 total = 0;
+    Int64 min   = EMPTY_MIN;
+    Int64 max   = EMPTY_MAX;
+
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        Stripe *stripe = d_stripes[i].loadAcquire();
+        if (!stripe) {
+            continue;
+        }
+
+        // Collect the buckets before the total, minimum, and maximum (see
+        // 'update').
+
+        for (int j = 0; j < k_NUM_BUCKETS; ++j) {
+            bsls::AtomicInt64& bucket = stripe->d_buckets[j];
+
+            // Avoid writing to the (typically many) empty buckets.
+
+            if (0 == bucket.loadRelaxed()) {
+                continue;
+            }
+
+            const Int64 n = resetFlag ? bucket.swap(0) : bucket.load();
+            counts[j] += n;
+            count     += n;
+        }
+
+        if (resetFlag) {
+            total += stripe->d_total.swap(0);
+            min    = bsl::min(min, stripe->d_min.swap(EMPTY_MIN));
+            max    = bsl::max(max, stripe->d_max.swap(EMPTY_MAX));
+        }
+        else {
+            total += stripe->d_total.load();
+            min    = bsl::min(min, stripe->d_min.load());
+            max    = bsl::max(max, stripe->d_max.load());
+        }
+    }
+
+    MetricRecord& metricRecord = record->record();
+
+    metricRecord.metricId() = d_metricId;
+    metricRecord.count()    = static_cast<int>(bsl::min<Int64>(count,
+                                                               INT_MAX));
+    metricRecord.total()    = static_cast<double>(total);
+    metricRecord.min()      = 0 < count
+                            ? static_cast<double>(min)
+                            : MetricRecord::k_DEFAULT_MIN;
+    metricRecord.max()      = 0 < count
+                            ? static_cast<double>(max)
+                            : MetricRecord::k_DEFAULT_MAX;
+
+    record->removeAllQuantiles();
+
+    for (bsl::size_t i = 0; i < d_quantiles.size(); ++i) {
+        const double quantile = d_quantiles[i];
+
+        if (0 == count) {
+            record->appendQuantile(quantile, 0);
+            continue;
+        }
+
+        const double exactRank = bsl::ceil(quantile *
+                                           static_cast<double>(count));
+        const Int64  rank      = bsl::max<Int64>(
+                                               1,
+                                               static_cast<Int64>(exactRank));
+
+        // The least and greatest values are known exactly.
+
+        if (1 == rank) {
+            record->appendQuantile(quantile, static_cast<double>(min));
+            continue;
+        }
+        if (count <= rank) {
+            record->appendQuantile(quantile, static_cast<double>(max));
+            continue;
+        }
+
+        int   index      = 0;
+        Int64 cumulative = counts[0];
+        while (cumulative < rank) {
+            cumulative += counts[++index];
+        }
+
+        const Int64  lower = bucketLowerBound(index);
+        const Int64  upper = bucketUpperBound(index);
+        const double value = static_cast<double>(lower) +
+                                        static_cast<double>(upper - lower) / 2;
+
+        record->appendQuantile(quantile,
+                               bsl::max(static_cast<double>(min),
+                                        bsl::min(static_cast<double>(max),
+                                                 value)));
+    }
+}
+
+// CLASS METHODS
+bsls::Types::Int64 HistogramCollector::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < (1 << k_PRECISION_BITS)) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift       = (index >> (k_PRECISION_BITS - 1)) - 1;
+    const int significand = index - (shift << (k_PRECISION_BITS - 1));
+
+    return static_cast<bsls::Types::Int64>(
+                      static_cast<bsls::Types::Uint64>(significand) << shift);
+}
+
+bsls::Types::Int64 HistogramCollector::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < (1 << k_PRECISION_BITS)) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift       = (index >> (k_PRECISION_BITS - 1)) - 1;
+    const int significand = index - (shift << (k_PRECISION_BITS - 1));
+
+    const bsls::Types::Uint64 next =
+                   static_cast<bsls::Types::Uint64>(significand + 1) << shift;
+
+    return static_cast<bsls::Types::Int64>(next - 1);
+}
+
+void HistogramCollector::defaultQuantiles(bsl::vector<double> *quantiles)
+{
+    BSLS_ASSERT(quantiles);
+
+    quantiles->assign(DEFAULT_QUANTILES,
+                      DEFAULT_QUANTILES + NUM_DEFAULT_QUANTILES);
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId&   metricId,
+                                       bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_quantiles(DEFAULT_QUANTILES,
+              DEFAULT_QUANTILES + NUM_DEFAULT_QUANTILES,
+              basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+HistogramCollector::HistogramCollector(
+                                 const MetricId&             metricId,
+                                 const bsl::vector<double>&  quantiles,
+                                 bslma::Allocator           *basicAllocator)
+: d_metricId(metricId)
+, d_quantiles(quantiles, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    for (bsl::size_t i = 0; i < d_quantiles.size(); ++i) {
+        BSLS_ASSERT(0 <= d_quantiles[i]);
+        BSLS_ASSERT(1 >= d_quantiles[i]);
+    }
+}
+
+HistogramCollector::~HistogramCollector()
+{
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        d_allocator_p->deleteObjectRaw(d_stripes[i].load());
+    }
+}
+
+// MANIPULATORS
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        Stripe *stripe = d_stripes[i].loadAcquire();
+        if (!stripe) {
+            continue;
+        }
+
+        for (int j = 0; j < k_NUM_BUCKETS; ++j) {
+            if (0 != stripe->d_buckets[j].loadRelaxed()) {
+                stripe->d_buckets[j].store(0);
+            }
+        }
+        stripe->d_total.store(0);
+        stripe->d_min.store(EMPTY_MIN);
+        stripe->d_max.store(EMPTY_MAX);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
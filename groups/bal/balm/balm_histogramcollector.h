@@ -0,0 +1,390 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free collector of the distribution of a metric.
+//
+//@CLASSES:
+//  balm::HistogramCollector: histogram of integral metric values
+//
+//@SEE_ALSO: balm_quantilerecord, balm_metricsmanager, balm_integercollector
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// that records the distribution of the non-negative integral values of a
+// metric (typically a latency or a size) in a log-linear histogram, and
+// reports the count, total, minimum, and maximum of those values together
+// with their value at a configured sequence of quantiles (for example the
+// median, or the 99th percentile) in a 'balm::QuantileRecord'.
+//
+// Histogram collectors may be created by a 'balm::MetricsManager' (see
+// 'balm::MetricsManager::addHistogramCollector'), in which case the quantile
+// records are published, alongside the records of the other metrics of the
+// category, each time the category is published.
+//
+///Histogram Buckets
+///-----------------
+// Values less than 2^'k_PRECISION_BITS' are counted exactly, each in its own
+// bucket.  Each larger range of values '[2^n .. 2^(n + 1))' is divided into
+// 2^('k_PRECISION_BITS' - 1) buckets of equal width.  A bucket therefore
+// spans at most 1/2^('k_PRECISION_BITS' - 1) of the values it holds, and the
+// value reported for a quantile, the midpoint of the bucket holding it, is
+// within a relative error of 1/2^'k_PRECISION_BITS' (about 1.6%) of the
+// exact value.  All non-negative 64-bit values are representable, in
+// 'k_NUM_BUCKETS' buckets.
+//
+// The value reported for a quantile 'q' of 'N' values is that of the value
+// having rank 'ceil(q * N)' (and at least 1) among the values in increasing
+// order, limited to the range of the recorded minimum and maximum.  The
+// values of rank 1 and 'N' (for example, at the quantiles 0 and 1) are
+// reported exactly, as the minimum and maximum.  The value reported for every
+// quantile of an empty histogram is 0.
+//
+///Performance
+///-----------
+// Recording a value ('update') is lock-free: it increments one bucket and
+// updates a running total (and, occasionally, the minimum or maximum) using
+// atomic operations.  To avoid contention between threads, the histogram is
+// divided into the same stripes as a 'balm::StripedAccumulator' (see
+// 'balm_stripedaccumulator'): each thread records into the stripe assigned to
+// it, and the stripes are merged when the histogram is loaded.  The memory of
+// a stripe (about 15 KB) is allocated the first time a thread assigned to
+// that stripe records a value, so a histogram updated by a single thread
+// occupies a single stripe.
+//
+// Loading the histogram ('load' or 'loadAndReset') visits every bucket of
+// every allocated stripe, and is comparatively expensive; it is expected to
+// be invoked when metrics are published.  The count and quantiles reported by
+// 'loadAndReset' describe exactly the values whose buckets it reset, but,
+// because 'loadAndReset' is not atomic with respect to concurrent calls to
+// 'update', the total, minimum, and maximum may additionally reflect a value
+// recorded concurrently with the reset (whose bucket is then reported by the
+// next call).
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording the Distribution of Request Latencies
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category          myCategory("MyCategory");
+//  balm::MetricDescription description(&myCategory, "RequestLatency");
+//  balm::MetricId          latencyId(&description);
+//..
+// Then, we create a histogram collector reporting the median and the 99th
+// percentile of the latencies:
+//..
+//  bsl::vector<double> quantiles;
+//  quantiles.push_back(0.5);
+//  quantiles.push_back(0.99);
+//
+//  balm::HistogramCollector collector(latencyId, quantiles);
+//..
+// Next, we record the latencies, in microseconds, of 100 requests, 1 through
+// 100:
+//..
+//  for (int latency = 1; latency <= 100; ++latency) {
+//      collector.update(latency);
+//  }
+//..
+// Finally, we load the recorded distribution into a 'balm::QuantileRecord'.
+// Note that the values up to 64 are counted exactly, but the value at the
+// 99th percentile (99) shares a bucket with 98, and is reported as the
+// midpoint of the bucket:
+//..
+//  balm::QuantileRecord record;
+//  collector.loadAndReset(&record);
+//
+//  assert(latencyId == record.record().metricId());
+//  assert(100       == record.record().count());
+//  assert(5050      == record.record().total());
+//  assert(1         == record.record().min());
+//  assert(100       == record.record().max());
+//
+//  assert(2         == record.numQuantiles());
+//  assert(0.5       == record.quantile(0));
+//  assert(50        == record.value(0));
+//  assert(0.99      == record.quantile(1));
+//  assert(98.5      == record.value(1));
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_stripedaccumulator.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+class QuantileRecord;
+
+                         // ========================
+                         // class HistogramCollector
+                         // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for recording the distribution of the
+    // non-negative integral values of a metric in a log-linear histogram,
+    // and for reporting the count, total, minimum, and maximum of those
+    // values, as well as their value at a configured sequence of quantiles.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_PRECISION_BITS = 6,
+            // values less than '1 << k_PRECISION_BITS' are counted exactly
+
+        k_NUM_BUCKETS = (65 - k_PRECISION_BITS) << (k_PRECISION_BITS - 1)
+            // number of buckets needed to count all non-negative 64-bit
+            // values
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Stripe {
+        // The histogram of the values recorded by the threads assigned to a
+        // stripe.
+
+        bsls::AtomicInt64 d_buckets[k_NUM_BUCKETS];  // count of each bucket
+        bsls::AtomicInt64 d_total;                   // total of values
+        bsls::AtomicInt64 d_min;                     // minimum value
+        bsls::AtomicInt64 d_max;                     // maximum value
+
+        Stripe();
+            // Create an empty stripe.
+    };
+
+    // DATA
+    MetricId                    d_metricId;     // collected metric
+
+    bsl::vector<double>         d_quantiles;    // reported quantiles
+
+    bsls::AtomicPointer<Stripe> d_stripes[StripedAccumulatorUtil::
+                                                               k_NUM_STRIPES];
+                                                // per-thread histograms
+                                                // (owned, allocated on
+                                                // first use)
+
+    bslma::Allocator           *d_allocator_p;  // memory allocator (held,
+                                                // not owned)
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE MANIPULATORS
+    Stripe *createStripe(int index);
+        // Return the address of the stripe at the specified 'index' of this
+        // collector, allocating it if it was not already allocated.
+
+    // PRIVATE ACCESSORS
+    void collect(QuantileRecord *record, bool resetFlag) const;
+        // Load into the specified 'record' the id of the collected metric,
+        // the count, total, minimum, and maximum of the recorded values, and
+        // their values at the quantiles of this collector; if the specified
+        // 'resetFlag' is 'true', also reset this collector to its default
+        // state.  Note that this method is 'const' so that it may implement
+        // 'load'; it modifies this collector only if 'resetFlag' is 'true'.
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(bsls::Types::Int64 value);
+        // Return the index of the histogram bucket counting the specified
+        // 'value'.  The behavior is undefined unless '0 <= value'.
+
+    static bsls::Types::Int64 bucketLowerBound(int index);
+        // Return the least value counted by the histogram bucket at the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static bsls::Types::Int64 bucketUpperBound(int index);
+        // Return the greatest value counted by the histogram bucket at the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static void defaultQuantiles(bsl::vector<double> *quantiles);
+        // Load into the specified 'quantiles' the quantiles reported by a
+        // collector when none are supplied at construction: 0.5, 0.9, 0.99,
+        // and 0.999.
+
+    // CREATORS
+    explicit HistogramCollector(const MetricId&   metricId,
+                                bslma::Allocator *basicAllocator = 0);
+    HistogramCollector(const MetricId&             metricId,
+                       const bsl::vector<double>&  quantiles,
+                       bslma::Allocator           *basicAllocator = 0);
+        // Create an empty histogram collector for the metric having the
+        // specified 'metricId'.  Optionally specify the 'quantiles' at which
+        // the values of the metric are reported; if 'quantiles' is not
+        // specified, the quantiles loaded by 'defaultQuantiles' are reported.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless each of 'quantiles' is in
+        // the range '[0 .. 1]'.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void loadAndReset(QuantileRecord *record);
+        // Load into the specified 'record' the id of the collected metric,
+        // the count, total, minimum, and maximum of the values recorded since
+        // this collector was last reset, and their values at the quantiles of
+        // this collector; then reset this collector to its default state.
+        // If no values were recorded, the count and total are 0, the minimum
+        // and maximum are 'MetricRecord::k_DEFAULT_MIN' and
+        // 'MetricRecord::k_DEFAULT_MAX', and the value at each quantile is 0.
+
+    void reset();
+        // Discard the values recorded by this collector.
+
+    void update(bsls::Types::Int64 value);
+        // Record the specified 'value' in the histogram of this collector.
+        // The behavior is undefined unless '0 <= value'.
+
+    // ACCESSORS
+    void load(QuantileRecord *record) const;
+        // Load into the specified 'record' the id of the collected metric,
+        // the count, total, minimum, and maximum of the values recorded since
+        // this collector was last reset, and their values at the quantiles of
+        // this collector.  If no values were recorded, the count and total
+        // are 0, the minimum and maximum are 'MetricRecord::k_DEFAULT_MIN'
+        // and 'MetricRecord::k_DEFAULT_MAX', and the value at each quantile
+        // is 0.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    const bsl::vector<double>& quantiles() const;
+        // Return a reference to the non-modifiable sequence of quantiles at
+        // which this collector reports the values of its metric.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class HistogramCollector
+                         // ------------------------
+
+// CLASS METHODS
+inline
+int HistogramCollector::bucketIndex(bsls::Types::Int64 value)
+{
+    BSLS_ASSERT(0 <= value);
+
+    const bsl::uint64_t v = static_cast<bsl::uint64_t>(value);
+
+    if (v < (1u << k_PRECISION_BITS)) {
+        return static_cast<int>(v);                                   // RETURN
+    }
+
+    // 'v >> shift' has 'k_PRECISION_BITS' significant bits.
+
+    const int shift = 64 - bdlb::BitUtil::numLeadingUnsetBits(v)
+                                                          - k_PRECISION_BITS;
+
+    return (shift << (k_PRECISION_BITS - 1)) + static_cast<int>(v >> shift);
+}
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(bsls::Types::Int64 value)
+{
+    BSLS_ASSERT(0 <= value);
+
+    const int  index  = StripedAccumulatorUtil::stripeIndex();
+    Stripe    *stripe = d_stripes[index].loadAcquire();
+
+    if (!stripe) {
+        stripe = createStripe(index);
+    }
+
+    // The total, minimum, and maximum are updated before the bucket so that,
+    // when 'collect' observes the bucket, it also observes them.
+
+    stripe->d_total.add(value);
+
+    bsls::Types::Int64 min = stripe->d_min.loadRelaxed();
+    while (value < min) {
+        min = stripe->d_min.testAndSwap(min, value);
+    }
+
+    bsls::Types::Int64 max = stripe->d_max.loadRelaxed();
+    while (value > max) {
+        max = stripe->d_max.testAndSwap(max, value);
+    }
+
+    stripe->d_buckets[bucketIndex(value)].add(1);
+}
+
+inline
+void HistogramCollector::loadAndReset(QuantileRecord *record)
+{
+    collect(record, true);
+}
+
+// ACCESSORS
+inline
+void HistogramCollector::load(QuantileRecord *record) const
+{
+    collect(record, false);
+}
+
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+inline
+const bsl::vector<double>& HistogramCollector::quantiles() const
+{
+    return d_quantiles;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,876 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_integercollector.h>
+#include <balm_metricdescription.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+#include <balm_quantilerecord.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramCollector' is a mechanism recording the distribution of
+// non-negative integral values, supplied by many threads, in a log-linear
+// histogram.  We first verify the mapping of values to buckets, which is the
+// basis of the accuracy of the reported quantiles.  We then verify, from a
+// single thread, the count, total, minimum, and maximum reported by the
+// collector and the management of its memory, then compare the reported
+// quantiles to those computed from sorted values, and finally verify that
+// values recorded concurrently by several threads are neither lost nor
+// counted twice.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(bsls::Types::Int64 value);
+// [ 2] bsls::Types::Int64 bucketLowerBound(int index);
+// [ 2] bsls::Types::Int64 bucketUpperBound(int index);
+// [ 3] void defaultQuantiles(bsl::vector<double> *quantiles);
+//
+// CREATORS
+// [ 3] explicit HistogramCollector(const MetricId&, bslma::Allocator * = 0);
+// [ 3] HistogramCollector(const MetricId&, const vector<double>&, Alloc * =0);
+// [ 3] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 3] void loadAndReset(QuantileRecord *record);
+// [ 3] void reset();
+// [ 3] void update(bsls::Types::Int64 value);
+//
+// ACCESSORS
+// [ 3] void load(QuantileRecord *record) const;
+// [ 3] const MetricId& metricId() const;
+// [ 3] const bsl::vector<double>& quantiles() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] QUANTILE ACCURACY
+// [ 5] CONCURRENCY
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'update' VERSUS 'balm::IntegerCollector'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::QuantileRecord     QRec;
+typedef balm::MetricRecord       Rec;
+typedef balm::MetricId           Id;
+typedef balm::MetricDescription  Desc;
+typedef bsls::Types::Int64       Int64;
+
+const int NUM_BUCKETS = Obj::k_NUM_BUCKETS;
+const int NUM_EXACT   = 1 << Obj::k_PRECISION_BITS;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+double expectedQuantile(const bsl::vector<Int64>& sortedValues,
+                        double                    quantile)
+    // Return the value that a histogram collector is expected to report for
+    // the specified 'quantile' of the specified 'sortedValues': the value of
+    // rank 'ceil(quantile * N)' (at least 1) if that rank is 1 or 'N', and
+    // otherwise the midpoint of the bucket holding the value of that rank,
+    // limited to the range of 'sortedValues'.  The behavior is undefined
+    // unless 'sortedValues' is non-empty and sorted.
+{
+    const Int64 n    = static_cast<Int64>(sortedValues.size());
+    Int64       rank = static_cast<Int64>(
+                               bsl::ceil(quantile * static_cast<double>(n)));
+    rank = bsl::max<Int64>(1, rank);
+
+    if (1 == rank || n <= rank) {
+        return static_cast<double>(sortedValues[rank - 1]);           // RETURN
+    }
+
+    const int    index = Obj::bucketIndex(sortedValues[rank - 1]);
+    const Int64  lower = Obj::bucketLowerBound(index);
+    const Int64  upper = Obj::bucketUpperBound(index);
+    const double mid   = static_cast<double>(lower) +
+                                        static_cast<double>(upper - lower) / 2;
+
+    return bsl::max(static_cast<double>(sortedValues.front()),
+                    bsl::min(static_cast<double>(sortedValues.back()), mid));
+}
+
+Int64 nextRandom(bsls::Types::Uint64 *seed)
+    // Return a pseudo-random non-negative value, and update the specified
+    // 'seed'.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<Int64>(*seed >> 1);
+}
+
+struct UpdateJob {
+    // Wait on a barrier, then update a collector with the value 'd_value' a
+    // given number of times.
+
+    Obj            *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_numUpdates;
+    Int64           d_value;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numUpdates; ++i) {
+            d_obj_p->update(d_value);
+        }
+    }
+};
+
+template <class COLLECTOR>
+struct BenchmarkJob {
+    // Wait on a barrier, then update a collector a given number of times.
+
+    COLLECTOR      *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_numUpdates;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numUpdates; ++i) {
+            d_obj_p->update(i & 0xFFFF);
+        }
+    }
+};
+
+template <class COLLECTOR>
+double benchmark(COLLECTOR *obj, int numThreads, int numUpdates)
+    // Return the elapsed time, in seconds, for the specified 'numThreads'
+    // threads to each update the specified 'obj' the specified 'numUpdates'
+    // times.
+{
+    bslmt::Barrier                         barrier(numThreads + 1);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    BenchmarkJob<COLLECTOR> job = { obj, &barrier, numUpdates };
+
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], job));
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    balm::Category myCategory("MyCategory");
+    Desc           descA(&myCategory, "A");
+    const Id       ID_A(&descA);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording the Distribution of Request Latencies
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category          myCategory("MyCategory");
+    balm::MetricDescription description(&myCategory, "RequestLatency");
+    balm::MetricId          latencyId(&description);
+//..
+// Then, we create a histogram collector reporting the median and the 99th
+// percentile of the latencies:
+//..
+    bsl::vector<double> quantiles;
+    quantiles.push_back(0.5);
+    quantiles.push_back(0.99);
+
+    balm::HistogramCollector collector(latencyId, quantiles);
+//..
+// Next, we record the latencies, in microseconds, of 100 requests, 1 through
+// 100:
+//..
+    for (int latency = 1; latency <= 100; ++latency) {
+        collector.update(latency);
+    }
+//..
+// Finally, we load the recorded distribution into a 'balm::QuantileRecord'.
+// Note that the values up to 64 are counted exactly, but the value at the
+// 99th percentile (99) shares a bucket with 98, and is reported as the
+// midpoint of the bucket:
+//..
+    balm::QuantileRecord record;
+    collector.loadAndReset(&record);
+
+    ASSERT(latencyId == record.record().metricId());
+    ASSERT(100       == record.record().count());
+    ASSERT(5050      == record.record().total());
+    ASSERT(1         == record.record().min());
+    ASSERT(100       == record.record().max());
+
+    ASSERT(2         == record.numQuantiles());
+    ASSERT(0.5       == record.quantile(0));
+    ASSERT(50        == record.value(0));
+    ASSERT(0.99      == record.quantile(1));
+    ASSERT(98.5      == record.value(1));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently from several threads, including
+        //:   threads sharing a stripe, are neither lost nor counted twice.
+        //:
+        //: 2 'loadAndReset' invoked concurrently with 'update' reports each
+        //:   recorded value exactly once across successive calls.
+        //
+        // Plan:
+        //: 1 Start a number of threads, exceeding the number of stripes, that
+        //:   each record a distinct value many times, while the main thread
+        //:   repeatedly invokes 'load' and 'loadAndReset'.  Verify that the
+        //:   value at the quantile 1 is always a recorded value.  (C-2)
+        //:
+        //: 2 Verify that the sums of the counts and totals reported by
+        //:   'loadAndReset' equal the number and total of the recorded
+        //:   values.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const int NUM_THREADS = balm::StripedAccumulatorUtil::k_NUM_STRIPES
+                                                                          + 3;
+        const int NUM_UPDATES = 20000;
+
+        bsl::vector<double> quantiles(1, 1.0);
+        Obj mX(ID_A, quantiles);  const Obj& X = mX;
+
+        bslmt::Barrier                         barrier(NUM_THREADS + 1);
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS);
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            UpdateJob job = { &mX, &barrier, NUM_UPDATES, i + 1 };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], job));
+        }
+        barrier.wait();
+
+        Int64  sumCount = 0;
+        double sumTotal = 0;
+
+        QRec record;
+        for (int i = 0; i < 200; ++i) {
+            X.load(&record);
+            if (0 < record.record().count()) {
+                const double v = record.value(0);
+                ASSERTV(i, v, 1 <= v && v <= NUM_THREADS && v == (int)v);
+            }
+
+            mX.loadAndReset(&record);
+            sumCount += record.record().count();
+            sumTotal += record.record().total();
+        }
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        mX.loadAndReset(&record);
+        sumCount += record.record().count();
+        sumTotal += record.record().total();
+
+        const Int64  EXP_COUNT = static_cast<Int64>(NUM_THREADS) *
+                                                                   NUM_UPDATES;
+        const double EXP_TOTAL = static_cast<double>(NUM_UPDATES) *
+                                     NUM_THREADS * (NUM_THREADS + 1) / 2;
+
+        ASSERTV(EXP_COUNT, sumCount, EXP_COUNT == sumCount);
+        ASSERTV(EXP_TOTAL, sumTotal, EXP_TOTAL == sumTotal);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // QUANTILE ACCURACY
+        //
+        // Concerns:
+        //: 1 The value reported for a quantile is the midpoint of the bucket
+        //:   holding the value of the corresponding rank, limited to the
+        //:   range of the recorded values (or, for the first and last rank,
+        //:   the value itself).
+        //:
+        //: 2 The reported value is within the documented relative error of
+        //:   the value of the corresponding rank.
+        //:
+        //: 3 Quantiles 0 and 1 report the minimum and maximum.
+        //
+        // Plan:
+        //: 1 For sequences of pseudo-random values of various sizes and
+        //:   magnitudes, record the values, and compare the reported value at
+        //:   each of a set of quantiles to that computed from the sorted
+        //:   values.  (C-1..3)
+        //
+        // Testing:
+        //   QUANTILE ACCURACY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "QUANTILE ACCURACY" << endl
+                          << "=================" << endl;
+
+        const double QUANTILES[] = { 0.0, 0.001, 0.1, 0.25, 0.5, 0.75, 0.9,
+                                     0.99, 0.999, 1.0 };
+        const int    NUM_QUANTILES = sizeof QUANTILES / sizeof *QUANTILES;
+
+        const bsl::vector<double> quantiles(QUANTILES,
+                                            QUANTILES + NUM_QUANTILES);
+
+        const int NUM_SIZES         = 5;
+        const int SIZES[NUM_SIZES]  = { 1, 2, 10, 1000, 20000 };
+        const int SHIFTS[]          = { 4, 7, 20, 40, 62 };
+        const int NUM_SHIFTS        = sizeof SHIFTS / sizeof *SHIFTS;
+
+        bsls::Types::Uint64 seed = 12345;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int hi = 0; hi < NUM_SHIFTS; ++hi) {
+                const int SIZE  = SIZES[si];
+                const int SHIFT = SHIFTS[hi];
+
+                Obj mX(ID_A, quantiles);
+
+                bsl::vector<Int64> values;
+                for (int i = 0; i < SIZE; ++i) {
+                    const Int64 v = nextRandom(&seed) >> (63 - SHIFT);
+                    values.push_back(v);
+                    mX.update(v);
+                }
+                bsl::sort(values.begin(), values.end());
+
+                QRec record;
+                mX.loadAndReset(&record);
+
+                ASSERTV(SIZE, SHIFT, SIZE          == record.record().count());
+                ASSERTV(SIZE, SHIFT, NUM_QUANTILES == record.numQuantiles());
+
+                for (int q = 0; q < NUM_QUANTILES; ++q) {
+                    const double QUANTILE = QUANTILES[q];
+                    const double EXP      = expectedQuantile(values,
+                                                             QUANTILE);
+                    const double VALUE    = record.value(q);
+
+                    ASSERTV(SIZE, SHIFT, QUANTILE, EXP, VALUE, EXP == VALUE);
+
+                    Int64 rank = static_cast<Int64>(
+                                          bsl::ceil(QUANTILE * (double)SIZE));
+                    rank = bsl::max<Int64>(1, rank);
+                    const double EXACT = static_cast<double>(
+                                                           values[rank - 1]);
+
+                    const double MAX_ERROR = EXACT / NUM_EXACT;
+
+                    ASSERTV(SIZE, SHIFT, QUANTILE, EXACT, VALUE,
+                            bsl::fabs(VALUE - EXACT) <= MAX_ERROR);
+                }
+
+                const double MIN = static_cast<double>(values.front());
+                const double MAX = static_cast<double>(values.back());
+
+                ASSERTV(SIZE, SHIFT, MIN == record.value(0));
+                ASSERTV(SIZE, SHIFT, MAX == record.value(NUM_QUANTILES - 1));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS FROM A SINGLE THREAD
+        //
+        // Concerns:
+        //: 1 A newly created collector reports the supplied metric id and
+        //:   quantiles, or the default quantiles.
+        //:
+        //: 2 An empty collector reports a count and total of 0, the default
+        //:   minimum and maximum, and 0 at each quantile.
+        //:
+        //: 3 'update' increases the count and total, and widens the minimum
+        //:   and maximum.
+        //:
+        //: 4 'load' reports the recorded values without resetting them;
+        //:   'loadAndReset' and 'reset' discard them.
+        //:
+        //: 5 Quantile records are loaded with the metric id of the collector,
+        //:   and any quantiles previously in the record are replaced.
+        //:
+        //: 6 Memory is allocated from the supplied allocator (not the default
+        //:   allocator) only once a value is recorded, and is released on
+        //:   destruction.
+        //:
+        //: 7 Preconditions are asserted in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Create collectors with and without quantiles, and verify their
+        //:   attributes and the record loaded from them.  (C-1..2, 5)
+        //:
+        //: 2 Record a sequence of values, verifying the loaded record after
+        //:   each, then reset the collector using 'loadAndReset' and 'reset'.
+        //:   (C-3..4)
+        //:
+        //: 3 Use test allocators to verify memory use.  (C-6)
+        //:
+        //: 4 Verify that 'update' and the constructor assert on invalid input
+        //:   using 'BSLS_ASSERT' assertion handlers.  (C-7)
+        //
+        // Testing:
+        //   void defaultQuantiles(bsl::vector<double> *quantiles);
+        //   explicit HistogramCollector(const MetricId&, bslma::Allocator *);
+        //   HistogramCollector(const MetricId&, const vector<double>&, ...);
+        //   ~HistogramCollector();
+        //   void loadAndReset(QuantileRecord *record);
+        //   void reset();
+        //   void update(bsls::Types::Int64 value);
+        //   void load(QuantileRecord *record) const;
+        //   const MetricId& metricId() const;
+        //   const bsl::vector<double>& quantiles() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS FROM A SINGLE THREAD" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         oa("object",  veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        if (verbose) cout << "\tTesting default quantiles." << endl;
+        {
+            bsl::vector<double> defaults;
+            Obj::defaultQuantiles(&defaults);
+
+            ASSERT(4     == defaults.size());
+            ASSERT(0.5   == defaults[0]);
+            ASSERT(0.9   == defaults[1]);
+            ASSERT(0.99  == defaults[2]);
+            ASSERT(0.999 == defaults[3]);
+
+            Obj mX(ID_A, &oa);  const Obj& X = mX;
+            ASSERT(ID_A     == X.metricId());
+            ASSERT(defaults == X.quantiles());
+
+            QRec record;
+            X.load(&record);
+            ASSERT(Rec(ID_A) == record.record());
+            ASSERT(4         == record.numQuantiles());
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, defaults[i] == record.quantile(i));
+                ASSERTV(i, 0           == record.value(i));
+            }
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\tTesting 'update', 'load', and resets."
+                          << endl;
+        {
+            bsl::vector<double> quantiles;
+            quantiles.push_back(0);
+            quantiles.push_back(0.5);
+            quantiles.push_back(1);
+
+            const Int64 allocatedBefore = da.numBytesInUse();
+
+            Obj mX(ID_A, quantiles, &oa);  const Obj& X = mX;
+            ASSERT(quantiles == X.quantiles());
+
+            const Int64 emptyBytes = oa.numBytesInUse();
+
+            const Int64 VALUES[] = { 10, 3, 1000, 0, 1LL << 40, 70 };
+            const int   NUM      = sizeof VALUES / sizeof *VALUES;
+
+            QRec   record(&oa);
+            double total = 0;
+            Int64  min   = LLONG_MAX;
+            Int64  max   = 0;
+
+            for (int i = 0; i < NUM; ++i) {
+                mX.update(VALUES[i]);
+
+                total += static_cast<double>(VALUES[i]);
+                min    = bsl::min(min, VALUES[i]);
+                max    = bsl::max(max, VALUES[i]);
+
+                ASSERTV(i, emptyBytes < oa.numBytesInUse());
+
+                X.load(&record);
+                ASSERTV(i, ID_A         == record.record().metricId());
+                ASSERTV(i, i + 1        == record.record().count());
+                ASSERTV(i, total        == record.record().total());
+                ASSERTV(i, (double)min  == record.record().min());
+                ASSERTV(i, (double)max  == record.record().max());
+                ASSERTV(i, 3            == record.numQuantiles());
+                ASSERTV(i, (double)min  == record.value(0));
+                ASSERTV(i, (double)max  == record.value(2));
+            }
+
+            // 'load' does not reset.
+
+            X.load(&record);
+            ASSERT(NUM == record.record().count());
+
+            mX.loadAndReset(&record);
+            ASSERT(NUM == record.record().count());
+
+            X.load(&record);
+            ASSERT(0                  == record.record().count());
+            ASSERT(0                  == record.record().total());
+            ASSERT(Rec::k_DEFAULT_MIN == record.record().min());
+            ASSERT(Rec::k_DEFAULT_MAX == record.record().max());
+            ASSERT(3                  == record.numQuantiles());
+
+            mX.update(5);
+            mX.update(7);
+            X.load(&record);
+            ASSERT(2  == record.record().count());
+            ASSERT(12 == record.record().total());
+            ASSERT(5  == record.record().min());
+            ASSERT(7  == record.record().max());
+            ASSERT(5  == record.value(1));
+
+            mX.reset();
+            X.load(&record);
+            ASSERT(Rec(ID_A) == record.record());
+            ASSERT(0         == record.value(1));
+
+            ASSERT(allocatedBefore == da.numBytesInUse());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(ID_A);
+
+            ASSERT_PASS(mX.update(0));
+            ASSERT_PASS(mX.update(LLONG_MAX));
+            ASSERT_FAIL(mX.update(-1));
+
+            bsl::vector<double> quantiles(1, 1.0);
+            ASSERT_PASS(Obj(ID_A, quantiles));
+            quantiles[0] = 1.5;
+            ASSERT_FAIL(Obj(ID_A, quantiles));
+            quantiles[0] = -0.5;
+            ASSERT_FAIL(Obj(ID_A, quantiles));
+
+            ASSERT_FAIL(Obj::bucketIndex(-1));
+            ASSERT_FAIL(Obj::bucketLowerBound(-1));
+            ASSERT_FAIL(Obj::bucketUpperBound(NUM_BUCKETS));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKETS
+        //
+        // Concerns:
+        //: 1 Values less than '2^k_PRECISION_BITS' are each counted in their
+        //:   own bucket.
+        //:
+        //: 2 The buckets partition all non-negative 64-bit values, in
+        //:   increasing order, into 'k_NUM_BUCKETS' ranges.
+        //:
+        //: 3 'bucketIndex' maps every value in the range of a bucket, and no
+        //:   other value, to that bucket.
+        //:
+        //: 4 The width of every bucket is at most '2^(1 - k_PRECISION_BITS)'
+        //:   of its lower bound, so that the midpoint of the bucket is within
+        //:   '2^-k_PRECISION_BITS' of any value in the bucket.
+        //
+        // Plan:
+        //: 1 Verify 'bucketIndex' for each small value.  (C-1)
+        //:
+        //: 2 For each bucket, verify that its lower bound follows the upper
+        //:   bound of the previous bucket, that 'bucketIndex' maps both bounds
+        //:   (and the values next to them) to the bucket, and that the width
+        //:   of the bucket is within the documented limit.  Verify the bounds
+        //:   of the first and last buckets.  (C-2..4)
+        //
+        // Testing:
+        //   int bucketIndex(bsls::Types::Int64 value);
+        //   bsls::Types::Int64 bucketLowerBound(int index);
+        //   bsls::Types::Int64 bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUCKETS" << endl
+                          << "=======" << endl;
+
+        for (int v = 0; v < NUM_EXACT; ++v) {
+            ASSERTV(v, v == Obj::bucketIndex(v));
+            ASSERTV(v, v == Obj::bucketLowerBound(v));
+            ASSERTV(v, v == Obj::bucketUpperBound(v));
+        }
+
+        ASSERT(0         == Obj::bucketLowerBound(0));
+        ASSERT(LLONG_MAX == Obj::bucketUpperBound(NUM_BUCKETS - 1));
+        ASSERT(NUM_BUCKETS - 1 == Obj::bucketIndex(LLONG_MAX));
+
+        for (int i = 1; i < NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Obj::bucketLowerBound(i);
+            const Int64 UPPER = Obj::bucketUpperBound(i);
+
+            ASSERTV(i, Obj::bucketUpperBound(i - 1) + 1 == LOWER);
+            ASSERTV(i, LOWER <= UPPER);
+
+            ASSERTV(i, LOWER, i     == Obj::bucketIndex(LOWER));
+            ASSERTV(i, UPPER, i     == Obj::bucketIndex(UPPER));
+            ASSERTV(i, LOWER, i - 1 == Obj::bucketIndex(LOWER - 1));
+            if (i < NUM_BUCKETS - 1) {
+                ASSERTV(i, UPPER, i + 1 == Obj::bucketIndex(UPPER + 1));
+            }
+
+            if (NUM_EXACT <= i) {
+                const double WIDTH = static_cast<double>(UPPER - LOWER) + 1;
+                ASSERTV(i, WIDTH,
+                        WIDTH <= static_cast<double>(LOWER) / (NUM_EXACT / 2));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a collector, record values, and verify the loaded record.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(ID_A);  const Obj& X = mX;
+
+        for (int i = 1; i <= 10; ++i) {
+            mX.update(i);
+        }
+
+        QRec record;
+        X.load(&record);
+
+        if (veryVerbose) {
+            P(record);
+        }
+
+        ASSERT(10 == record.record().count());
+        ASSERT(55 == record.record().total());
+        ASSERT(1  == record.record().min());
+        ASSERT(10 == record.record().max());
+        ASSERT(4  == record.numQuantiles());
+        ASSERT(5  == record.value(0));
+        ASSERT(9  == record.value(1));
+        ASSERT(10 == record.value(2));
+
+        mX.loadAndReset(&record);
+        ASSERT(10 == record.record().count());
+
+        X.load(&record);
+        ASSERT(0  == record.record().count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'update' VERSUS 'balm::IntegerCollector'
+        //
+        // Concerns:
+        //: 1 Recording a value in a histogram from several threads costs
+        //:   about as much as updating a 'balm::IntegerCollector'.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, time the threads each updating a
+        //:   histogram collector, and then an integer collector, a fixed
+        //:   number of times, and report the time per update.
+        //
+        // Testing:
+        //   PERFORMANCE: 'update' VERSUS 'balm::IntegerCollector'
+        // --------------------------------------------------------------------
+
+        cout << endl
+            << "PERFORMANCE: 'update' VERSUS 'balm::IntegerCollector'" << endl
+            << "=====================================================" << endl;
+
+        const int NUM_UPDATES = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            Obj                     histogram(ID_A);
+            balm::IntegerCollector  integer(ID_A);
+
+            const double HISTOGRAM = benchmark(&histogram,
+                                               numThreads,
+                                               NUM_UPDATES);
+            const double INTEGER   = benchmark(&integer,
+                                               numThreads,
+                                               NUM_UPDATES);
+
+            const double PER_UPDATE = 1.0e9 / NUM_UPDATES;
+
+            cout << "threads: " << numThreads
+                 << "\thistogram: " << HISTOGRAM * PER_UPDATE << " ns"
+                 << "\tinteger: "   << INTEGER   * PER_UPDATE << " ns"
+                 << endl;
+        }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -31,6 +31,25 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
+
+// PRIVATE ACCESSORS
+void IntegerCollector::loadRecord(MetricRecord       *record,
+                                  int                 count,
+                                  bsls::Types::Int64  total,
+                                  int                 min,
+                                  int                 max) const
+{
+    record->metricId() = d_metricId;
+    record->count()    = count;
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : min;
+    record->max()      = (k_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : max;
+}
+
 // MANIPULATORS
 void IntegerCollector::loadAndReset(MetricRecord *records)
 {
@@ -38,28 +57,11 @@ void IntegerCollector::loadAndReset(MetricRecord *records)
     bsls::Types::Int64 total;
     int                min;
     int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
-    }
-    // Perform the conversion to double values outside of the lock.
-    records->metricId() = d_metricId;
-    records->count()    = count;
-    records->total()    = static_cast<double>(total);
-    records->min()      = (k_DEFAULT_MIN == min)
-                        ? MetricRecord::k_DEFAULT_MIN
-                        : min;
-    records->max()      = (k_DEFAULT_MAX == max)
-                        ? MetricRecord::k_DEFAULT_MAX
-                        : max;
+
+    d_accumulator.loadAndReset(&count, &total, &min, &max);
+
+    // Perform the conversion to double values outside of the locks.
+    loadRecord(records, count, total, min, max);
 }
 
 // ACCESSORS
@@ -70,24 +72,10 @@ void IntegerCollector::load(MetricRecord *record) const
     int                min;
     int                max;
 
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-    }
+    d_accumulator.load(&count, &total, &min, &max);
 
-    // Perform the conversion to double values outside of the lock.
-    record->metricId() = d_metricId;
-    record->count()    = count;
-    record->total()    = static_cast<double>(total);
-    record->min()      = (k_DEFAULT_MIN == min)
-                       ? MetricRecord::k_DEFAULT_MIN
-                       : min;
-    record->max()      = (k_DEFAULT_MAX == max)
-                       ? MetricRecord::k_DEFAULT_MAX
-                       : max;
+    // Perform the conversion to double values outside of the locks.
+    loadRecord(record, count, total, min, max);
 }
 
 }  // close package namespace
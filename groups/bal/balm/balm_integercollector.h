@@ -33,6 +33,18 @@ BSLS_IDENT("$Id: $")
 // finally a combined 'loadAndReset' method that performs both a load and a
 // reset in a single (atomic) operation.
 //
+///Performance
+///-----------
+// The aggregated values of a 'balm::IntegerCollector' are held in a
+// 'balm::StripedAccumulator', which divides them into stripes updated by
+// different threads (see 'balm_stripedaccumulator').  The 'update' and
+// 'accumulateCountTotalMinMax' methods therefore do not contend with one
+// another when invoked from different threads, making them suitable for
+// instrumenting frequently executed code.  The 'load', 'loadAndReset',
+// 'reset', and 'setCountTotalMinMax' methods merge or reset all stripes, and
+// are comparatively expensive; they are expected to be invoked when metrics
+// are published.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -79,15 +91,11 @@ BSLS_IDENT("$Id: $")
 //      assert(3        == record.max());
 //..
 
-#include <bsl_algorithm.h>
-
 #include <balscm_version.h>
 
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
-
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <balm_stripedaccumulator.h>
 
 #include <bsls_types.h>
 
@@ -109,17 +117,28 @@ class IntegerCollector {
     // for the maximum is 'k_DEFAULT_MAX'.
 
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId                                    d_metricId;
+                                                    // metric identifier
+
+    StripedAccumulator<int, bsls::Types::Int64> d_accumulator;
+                                                    // aggregated count,
+                                                    // total, min, and max
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE ACCESSORS
+    void loadRecord(MetricRecord       *record,
+                    int                 count,
+                    bsls::Types::Int64  total,
+                    int                 min,
+                    int                 max) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected and the specified 'count', 'total', 'min', and 'max',
+        // converting 'k_DEFAULT_MIN' and 'k_DEFAULT_MAX' to
+        // 'MetricRecord::k_DEFAULT_MIN' and 'MetricRecord::k_DEFAULT_MAX'.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -209,11 +228,7 @@ class IntegerCollector {
 inline
 IntegerCollector::IntegerCollector(const MetricId& metricId)
 : d_metricId(metricId)
-, d_count(0)
-, d_total(0)
-, d_min(k_DEFAULT_MIN)
-, d_max(k_DEFAULT_MAX)
-, d_mutex()
+, d_accumulator(k_DEFAULT_MIN, k_DEFAULT_MAX)
 {
 }
 
@@ -226,21 +241,13 @@ IntegerCollector::~IntegerCollector()
 inline
 void IntegerCollector::reset()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
+    d_accumulator.reset();
 }
 
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    d_accumulator.update(value);
 }
 
 inline
@@ -249,11 +256,7 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
+    d_accumulator.accumulateCountTotalMinMax(count, total, min, max);
 }
 
 inline
@@ -262,11 +265,7 @@ void IntegerCollector::setCountTotalMinMax(int count,
                                            int min,
                                            int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    d_accumulator.setCountTotalMinMax(count, total, min, max);
 }
 
 // ACCESSORS
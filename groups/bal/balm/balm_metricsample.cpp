@@ -42,6 +42,10 @@ MetricSampleGroup::print(bsl::ostream& stream,
         bdlb::Print::indent(stream, level + 2, spacesPerLevel);
         stream << *it << NL;
     }
+    for (int i = 0; i < d_numQuantileRecords; ++i) {
+        bdlb::Print::indent(stream, level + 2, spacesPerLevel);
+        stream << d_quantileRecords_p[i] << NL;
+    }
 
     bdlb::Print::indent(stream, level + 1, spacesPerLevel);
     stream << "]" << NL;
@@ -60,6 +64,7 @@ MetricSample::MetricSample(const MetricSample&  original,
 : d_timeStamp(original.d_timeStamp)
 , d_records(original.d_records, basicAllocator)
 , d_numRecords(original.d_numRecords)
+, d_numQuantileRecords(original.d_numQuantileRecords)
 {
 }
 
@@ -67,9 +72,10 @@ MetricSample::MetricSample(const MetricSample&  original,
 MetricSample& MetricSample::operator=(const MetricSample& rhs)
 {
     if (this != &rhs) {
-        d_records     = rhs.d_records;
-        d_timeStamp   = rhs.d_timeStamp;
-        d_numRecords  = rhs.d_numRecords;
+        d_records            = rhs.d_records;
+        d_timeStamp          = rhs.d_timeStamp;
+        d_numRecords         = rhs.d_numRecords;
+        d_numQuantileRecords = rhs.d_numQuantileRecords;
     }
     return *this;
 }
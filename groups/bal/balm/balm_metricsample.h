@@ -32,6 +32,12 @@ BSLS_IDENT("$Id: $")
 // object contains a timestamp value used to indicate when the sample was
 // taken.
 //
+// A 'balm::MetricSampleGroup' may additionally refer to a sequence of
+// (external) 'balm::QuantileRecord' objects, describing the distribution of
+// metrics recorded by 'balm::HistogramCollector' objects over the same time
+// period (see 'balm_histogramcollector').  Publishers that do not report
+// quantiles may ignore them.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -130,6 +136,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_metricrecord.h>
+#include <balm_quantilerecord.h>
 
 #include <bdlt_datetimetz.h>
 
@@ -153,16 +160,24 @@ class MetricSampleGroup {
     // This class provides an *in-core* value-semantic representation of a
     // group of metric record values.  This class contains the address of an
     // array of (externally managed) 'MetricRecord' objects, the number of
-    // records in that array, and an elapsed time value (used to indicate the
-    // time span over which the metric values were aggregated).
+    // records in that array, the address and length of an array of
+    // (externally managed) 'QuantileRecord' objects, and an elapsed time
+    // value (used to indicate the time span over which the metric values were
+    // aggregated).
 
     // DATA
-    const MetricRecord *d_records_p;   // array of records (held, not
-                                       // owned)
+    const MetricRecord   *d_records_p;          // array of records (held,
+                                                // not owned)
+
+    int                   d_numRecords;         // number of records in array
 
-    int                 d_numRecords;  // number of records in array
+    const QuantileRecord *d_quantileRecords_p;  // array of quantile records
+                                                // (held, not owned)
 
-    bsls::TimeInterval  d_elapsedTime; // interval described by records
+    int                   d_numQuantileRecords; // number of quantile records
+
+    bsls::TimeInterval    d_elapsedTime;        // interval described by
+                                                // records
 
   public:
     // PUBLIC TYPES
@@ -173,21 +188,22 @@ class MetricSampleGroup {
     // CREATORS
     MetricSampleGroup();
         // Create an empty sample group.  By default, the 'records()' address
-        // is 0, 'numRecords()' is 0, and the 'elapsedTime()' is the default-
-        // constructed 'bsls::TimeInterval'.
+        // is 0, 'numRecords()' is 0, the 'quantileRecords()' address is 0,
+        // 'numQuantileRecords()' is 0, and the 'elapsedTime()' is the
+        // default-constructed 'bsls::TimeInterval'.
 
     MetricSampleGroup(const MetricRecord             *records,
                            int                        numRecords,
                            const bsls::TimeInterval&  elapsedTime);
         // Create a sample group containing the specified sequence of
-        // 'records' of specified length 'numRecords', recorded over a period
-        // whose duration is the specified 'elapsedTime'.  The behavior is
-        // undefined unless '0 <= numRecords' and 'records' points to a
-        // contiguous sequence of (at least) 'numRecords' metric records.  Note
-        // that the contents of 'records' is *not* copied and the supplied
-        // array must remain valid for the productive lifetime of this object
-        // or until the records are set to a different sequence by calling the
-        // 'setRecords' manipulator.
+        // 'records' of specified length 'numRecords', and no quantile
+        // records, recorded over a period whose duration is the specified
+        // 'elapsedTime'.  The behavior is undefined unless '0 <= numRecords'
+        // and 'records' points to a contiguous sequence of (at least)
+        // 'numRecords' metric records.  Note that the contents of 'records' is
+        // *not* copied and the supplied array must remain valid for the
+        // productive lifetime of this object or until the records are set to
+        // a different sequence by calling the 'setRecords' manipulator.
 
     MetricSampleGroup(const MetricSampleGroup& original);
         // Create a sample group having the same (in-core) value as the
@@ -201,8 +217,9 @@ class MetricSampleGroup {
     MetricSampleGroup& operator=(const MetricSampleGroup& rhs);
         // Assign to this sample group the value of the specified 'rhs' sample
         // group, and return a reference to this modifiable sample group.
-        // Note that only the pointer to the 'MetricRecord' array and the
-        // length are copied, and not the records themselves.
+        // Note that only the pointers to the 'MetricRecord' and
+        // 'QuantileRecord' arrays and their lengths are copied, and not the
+        // records themselves.
 
     void setElapsedTime(const bsls::TimeInterval& elapsedTime);
         // Set the elapsed time (used to indicate the time span over which
@@ -219,6 +236,16 @@ class MetricSampleGroup {
         // or until the records are set to a different sequence by calling the
         // 'setRecords' manipulator.
 
+    void setQuantileRecords(const QuantileRecord *records, int numRecords);
+        // Set the sequence of quantile records referred to by this sample
+        // group to the specified sequence of 'records' of specified length
+        // 'numRecords'.  The behavior is undefined unless '0 <= numRecords',
+        // and 'records' refers to a contiguous sequence of (at least)
+        // 'numRecords'.  Note that the contents of 'records' is *not* copied
+        // and the supplied array must remain valid for the productive
+        // lifetime of this object or until the quantile records are set to a
+        // different sequence by calling the 'setQuantileRecords' manipulator.
+
     // ACCESSORS
     const MetricRecord *records() const;
         // Return the address of the contiguous sequence of non-modifiable
@@ -228,6 +255,14 @@ class MetricSampleGroup {
         // Return the number of records (referenced to by 'records()') in this
         // object.
 
+    const QuantileRecord *quantileRecords() const;
+        // Return the address of the contiguous sequence of non-modifiable
+        // quantile records of length 'numQuantileRecords()'.
+
+    int numQuantileRecords() const;
+        // Return the number of quantile records (referenced to by
+        // 'quantileRecords()') in this object.
+
     const bsls::TimeInterval& elapsedTime() const;
         // Return a reference to the non-modifiable elapsed time interval over
         // which this object's metric records were aggregated.
@@ -260,14 +295,16 @@ bool operator==(const MetricSampleGroup& lhs,
     // Return 'true' if the specified 'lhs' and 'rhs' sample groups have the
     // same value, and 'false' otherwise.  Two sample groups have the same
     // value if the respective record sequence-addresses, number of records,
-    // and elapsed time are the same.
+    // quantile record sequence-addresses, number of quantile records, and
+    // elapsed time are the same.
 
 bool operator!=(const MetricSampleGroup& lhs,
                 const MetricSampleGroup& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' sample groups do not
     // have the same value, and 'false' otherwise.  Two sample groups do not
     // have the same value if any of the respective record-sequence addresses,
-    // number of records, or elapsed time, are not the same.
+    // number of records, quantile record-sequence addresses, number of
+    // quantile records, or elapsed time, are not the same.
 
 bsl::ostream& operator<<(bsl::ostream&            stream,
                          const MetricSampleGroup& rhs);
@@ -304,6 +341,10 @@ class MetricSample {
 
     int                       d_numRecords;  // total number of records
 
+    int                       d_numQuantileRecords;
+                                             // total number of quantile
+                                             // records
+
     // FRIENDS
     friend bool operator==(const MetricSample& lhs,
                            const MetricSample& rhs);
@@ -354,13 +395,14 @@ class MetricSample {
 
     void appendGroup(const MetricSampleGroup& group);
         // Append the specified 'group' of records to the sequence of groups
-        // maintained by this sample.  If 'group.numRecords()' is 0 this method
-        // has no effect.  The behavior is undefined unless
+        // maintained by this sample.  If both 'group.numRecords()' and
+        // 'group.numQuantileRecords()' are 0 this method has no effect.  The
+        // behavior is undefined unless
         // 'group.elapsedTime() > bsls::TimeInterval(0, 0)'.  Note that the
-        // 'MetricRecord' objects referred to by 'records' are *not* copied:
-        // hence, the supplied array must remain valid for the productive
-        // lifetime of this object or until the group is removed by calling
-        // 'removeAllRecords()'.
+        // 'MetricRecord' and 'QuantileRecord' objects referred to by 'group'
+        // are *not* copied: hence, the supplied arrays must remain valid for
+        // the productive lifetime of this object or until the group is
+        // removed by calling 'removeAllRecords()'.
 
     void appendGroup(const MetricRecord        *records,
                      int                        numRecords,
@@ -413,6 +455,11 @@ class MetricSample {
         // Return the total number of records in this sample (i.e., the sum of
         // the lengths of all the appended record groups).
 
+    int numQuantileRecords() const;
+        // Return the total number of quantile records in this sample (i.e.,
+        // the sum of the numbers of quantile records of all the appended
+        // record groups).
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
                         int           spacesPerLevel = 4) const;
@@ -459,6 +506,8 @@ inline
 MetricSampleGroup::MetricSampleGroup()
 : d_records_p(0)
 , d_numRecords(0)
+, d_quantileRecords_p(0)
+, d_numQuantileRecords(0)
 , d_elapsedTime()
 {
 }
@@ -469,6 +518,8 @@ MetricSampleGroup::MetricSampleGroup(const MetricRecord        *records,
                                      const bsls::TimeInterval&  elapsedTime)
 : d_records_p(records)
 , d_numRecords(numRecords)
+, d_quantileRecords_p(0)
+, d_numQuantileRecords(0)
 , d_elapsedTime(elapsedTime)
 {
 }
@@ -477,6 +528,8 @@ inline
 MetricSampleGroup::MetricSampleGroup(const MetricSampleGroup& original)
 : d_records_p(original.d_records_p)
 , d_numRecords(original.d_numRecords)
+, d_quantileRecords_p(original.d_quantileRecords_p)
+, d_numQuantileRecords(original.d_numQuantileRecords)
 , d_elapsedTime(original.d_elapsedTime)
 {
 }
@@ -485,9 +538,11 @@ MetricSampleGroup::MetricSampleGroup(const MetricSampleGroup& original)
 inline
 MetricSampleGroup& MetricSampleGroup::operator=(const MetricSampleGroup& rhs)
 {
-    d_records_p   = rhs.d_records_p;
-    d_numRecords  = rhs.d_numRecords;
-    d_elapsedTime = rhs.d_elapsedTime;
+    d_records_p          = rhs.d_records_p;
+    d_numRecords         = rhs.d_numRecords;
+    d_quantileRecords_p  = rhs.d_quantileRecords_p;
+    d_numQuantileRecords = rhs.d_numQuantileRecords;
+    d_elapsedTime        = rhs.d_elapsedTime;
     return *this;
 }
 
@@ -505,6 +560,14 @@ void MetricSampleGroup::setRecords(const MetricRecord *records,
     d_numRecords = numRecords;
 }
 
+inline
+void MetricSampleGroup::setQuantileRecords(const QuantileRecord *records,
+                                           int                   numRecords)
+{
+    d_quantileRecords_p  = records;
+    d_numQuantileRecords = numRecords;
+}
+
 // ACCESSORS
 inline
 const MetricRecord *MetricSampleGroup::records() const
@@ -518,6 +581,18 @@ int MetricSampleGroup::numRecords() const
     return d_numRecords;
 }
 
+inline
+const QuantileRecord *MetricSampleGroup::quantileRecords() const
+{
+    return d_quantileRecords_p;
+}
+
+inline
+int MetricSampleGroup::numQuantileRecords() const
+{
+    return d_numQuantileRecords;
+}
+
 inline
 const bsls::TimeInterval& MetricSampleGroup::elapsedTime() const
 {
@@ -543,9 +618,11 @@ inline
 bool balm::operator==(const MetricSampleGroup& lhs,
                       const MetricSampleGroup& rhs)
 {
-    return lhs.records()     == rhs.records()
-        && lhs.numRecords()  == rhs.numRecords()
-        && lhs.elapsedTime() == rhs.elapsedTime();
+    return lhs.records()            == rhs.records()
+        && lhs.numRecords()         == rhs.numRecords()
+        && lhs.quantileRecords()    == rhs.quantileRecords()
+        && lhs.numQuantileRecords() == rhs.numQuantileRecords()
+        && lhs.elapsedTime()        == rhs.elapsedTime();
 }
 
 inline
@@ -573,6 +650,7 @@ MetricSample::MetricSample(bslma::Allocator *basicAllocator)
 : d_timeStamp()
 , d_records(basicAllocator)
 , d_numRecords(0)
+, d_numQuantileRecords(0)
 {
 }
 
@@ -591,9 +669,10 @@ void MetricSample::setTimeStamp(const bdlt::DatetimeTz& timeStamp)
 inline
 void MetricSample::appendGroup(const MetricSampleGroup& group)
 {
-    if (0 < group.numRecords()) {
+    if (0 < group.numRecords() || 0 < group.numQuantileRecords()) {
         d_records.push_back(group);
-        d_numRecords += group.numRecords();
+        d_numRecords         += group.numRecords();
+        d_numQuantileRecords += group.numQuantileRecords();
     }
 }
 
@@ -612,7 +691,8 @@ inline
 void MetricSample::removeAllRecords()
 {
     d_records.clear();
-    d_numRecords = 0;
+    d_numRecords         = 0;
+    d_numQuantileRecords = 0;
 }
 
 // ACCESSORS
@@ -651,6 +731,12 @@ int MetricSample::numRecords() const
 {
     return d_numRecords;
 }
+
+inline
+int MetricSample::numQuantileRecords() const
+{
+    return d_numQuantileRecords;
+}
 }  // close package namespace
 
 // FREE OPERATORS
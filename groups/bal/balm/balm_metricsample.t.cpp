@@ -21,6 +21,7 @@
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 #include <bsls_assert.h>
@@ -57,9 +58,12 @@ using bsl::flush;
 // [ 7]  balm::MetricSampleGroup& operator=(balm::MetricSampleGroup&);
 // [ 3]  void setElapsedTime(const bsls::TimeInterval& );
 // [ 3]  void setRecords(const balm::MetricRecord *, int );
+// [19]  void setQuantileRecords(const balm::QuantileRecord *, int );
 // ACCESSORS
 // [ 3]  const balm::MetricRecord *records() const;
 // [ 3]  int numRecords() const;
+// [19]  const balm::QuantileRecord *quantileRecords() const;
+// [19]  int numQuantileRecords() const;
 // [ 3]  const bsls::TimeInterval& elapsedTime() const;
 // [ 9]  const_iterator begin() const;
 // [ 9]  const_iterator end() const;
@@ -93,6 +97,7 @@ using bsl::flush;
 // [17]  const_iterator end() const;
 // [11]  int numGroups() const;
 // [11]  int numRecords() const;
+// [19]  int numQuantileRecords() const;
 // [15]   bsl::ostream& print(bsl::ostream&, int, int) const;
 // FREE OPERATORS
 // [12]  bool operator==(balm::MetricSample& , balm::MetricSample& );
@@ -102,7 +107,8 @@ using bsl::flush;
 // [ 1] BREATHING TEST: 'balm::MetricSampleGroup'
 // [ 2] BREATHING TEST: 'balm::MetricSample'
 // [ 2] HELPER TEST: 'gg'
-// [19] USAGE EXAMPLE
+// [19] TESTING: quantile records
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -149,6 +155,7 @@ typedef balm::MetricRecord                      Rec;
 typedef balm::MetricDescription                 Desc;
 typedef balm::MetricId                          Id;
 typedef bsl::vector<balm::MetricRecord>         RecVec;
+typedef balm::QuantileRecord                    QRec;
 
 // ============================================================================
 //                             Helper Functions
@@ -348,7 +355,7 @@ int main(int argc, char *argv[])
     recordBuffer.push_back(balm::MetricRecord( ID_A, 9, 9, 9, 9));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -450,6 +457,121 @@ int main(int argc, char *argv[])
 //  [ MyCategory.MetricC: 4 3 2 1 ]
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING: quantile records
+        //
+        // Concerns:
+        //: 1 A sample group refers to no quantile records by default, and
+        //:   'setQuantileRecords' sets the address and number of the quantile
+        //:   records without changing the other attributes.
+        //:
+        //: 2 The quantile records are part of the value of a sample group:
+        //:   they are copied, assigned, compared, and printed.
+        //:
+        //: 3 'balm::MetricSample::appendGroup' appends a group having either
+        //:   records or quantile records, and maintains the total number of
+        //:   quantile records, which is copied, assigned, and reset by
+        //:   'removeAllRecords'.
+        //
+        // Plan:
+        //: 1 Create sample groups referring to an array of quantile records,
+        //:   and verify their attributes, copies, and output.  (C-1..2)
+        //:
+        //: 2 Append groups with and without records and quantile records to
+        //:   a sample, and verify the number of groups and (quantile)
+        //:   records.  (C-3)
+        //
+        // Testing:
+        //   void setQuantileRecords(const balm::QuantileRecord *, int );
+        //   const balm::QuantileRecord *quantileRecords() const;
+        //   int numQuantileRecords() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: quantile records" << endl
+                          << "=========================" << endl;
+
+        QRec quantiles[2] = { QRec(ID_A, Z), QRec(ID_B, Z) };
+        quantiles[0].appendQuantile(0.5, 10);
+        quantiles[1].appendQuantile(0.9, 20);
+
+        const bsls::TimeInterval ONE(1, 0);
+
+        {
+            Group mX;  const Group& X = mX;
+            ASSERT(0 == X.quantileRecords());
+            ASSERT(0 == X.numQuantileRecords());
+
+            mX.setRecords(RECORD_BUFFER.data(), 2);
+            mX.setElapsedTime(ONE);
+            mX.setQuantileRecords(quantiles, 2);
+
+            ASSERT(RECORD_BUFFER.data() == X.records());
+            ASSERT(2                    == X.numRecords());
+            ASSERT(ONE                  == X.elapsedTime());
+            ASSERT(quantiles            == X.quantileRecords());
+            ASSERT(2                    == X.numQuantileRecords());
+
+            const Group Y(X);
+            ASSERT(X == Y);
+
+            Group mW(RECORD_BUFFER.data(), 2, ONE);  const Group& W = mW;
+            ASSERT(0 == W.quantileRecords());
+            ASSERT(X != W);
+
+            mW.setQuantileRecords(quantiles, 1);
+            ASSERT(X != W);
+
+            mW = X;
+            ASSERT(X == W);
+
+            bsl::ostringstream os;
+            X.print(os, 0, -1);
+            ASSERTV(os.str(),
+                    bsl::string::npos != os.str().find("0.5: 10"));
+            ASSERTV(os.str(),
+                    bsl::string::npos != os.str().find("0.9: 20"));
+        }
+        {
+            Obj mX(Z);  const Obj& X = mX;
+            ASSERT(0 == X.numQuantileRecords());
+
+            Group empty(0, 0, ONE);
+            mX.appendGroup(empty);
+            ASSERT(0 == X.numGroups());
+
+            Group quantileOnly(0, 0, ONE);
+            quantileOnly.setQuantileRecords(quantiles, 2);
+            mX.appendGroup(quantileOnly);
+            ASSERT(1 == X.numGroups());
+            ASSERT(0 == X.numRecords());
+            ASSERT(2 == X.numQuantileRecords());
+
+            Group both(RECORD_BUFFER.data(), 3, ONE);
+            both.setQuantileRecords(quantiles + 1, 1);
+            mX.appendGroup(both);
+            ASSERT(2 == X.numGroups());
+            ASSERT(3 == X.numRecords());
+            ASSERT(3 == X.numQuantileRecords());
+            ASSERT(both == X.sampleGroup(1));
+
+            Obj mY(X, Z);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(3 == Y.numQuantileRecords());
+
+            Obj mW(Z);  const Obj& W = mW;
+            mW = X;
+            ASSERT(X == W);
+            ASSERT(3 == W.numQuantileRecords());
+
+            mX.removeAllRecords();
+            ASSERT(0 == X.numGroups());
+            ASSERT(0 == X.numRecords());
+            ASSERT(0 == X.numQuantileRecords());
+        }
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // TESTING 'appendGroup(const balm::MetricRecord *, int, ...):
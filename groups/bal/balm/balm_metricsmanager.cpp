@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balm_metricsmanager_cpp,"$Id$ $CSID$")
 
 #include <balm_metricsample.h>
 #include <balm_publisher.h>
+#include <balm_quantilerecord.h>
 
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
@@ -56,19 +57,26 @@ namespace {
 
 struct SampleDescription {
     // This type is used by 'collectSample' to indirectly refer to a series of
-    // records in a vector (in case the vector is resized).
+    // records, and a series of quantile records, in vectors (in case the
+    // vectors are resized).
 
     // PUBLIC DATA
     int                d_beginIndex;
     int                d_size;
+    int                d_quantileBeginIndex;
+    int                d_quantileSize;
     bsls::TimeInterval d_elapsedTime;
 
     // CREATORS
     SampleDescription(int                       beginIndex,
                       int                       size,
+                      int                       quantileBeginIndex,
+                      int                       quantileSize,
                       const bsls::TimeInterval& elapsedTime)
     : d_beginIndex(beginIndex)
     , d_size(size)
+    , d_quantileBeginIndex(quantileBeginIndex)
+    , d_quantileSize(quantileSize)
     , d_elapsedTime(elapsedTime)
     {
     }
@@ -100,23 +108,28 @@ struct MetricsManager_PublicationHelper {
         // for 'publisher' in the 'sampleCache', create one and add it to the
         // 'sampleCache'.
 
-    static void collect(bsl::vector<MetricRecord> *records,
-                        bsls::TimeInterval        *elapsedTime,
-                        MetricsManager            *manager,
-                        const Category            *category,
-                        const bsls::TimeInterval&  now,
-                        bool                       resetFlag);
+    static void collect(bsl::vector<MetricRecord>   *records,
+                        bsl::vector<QuantileRecord> *quantileRecords,
+                        bsls::TimeInterval          *elapsedTime,
+                        MetricsManager              *manager,
+                        const Category              *category,
+                        const bsls::TimeInterval&    now,
+                        bool                         resetFlag);
         // Append to the specified 'records' the metrics collected from the
-        // specified 'manager' for the specified 'category', and load into
-        // specified 'elapsedTime' the time interval from when they were last
-        // reset to the specified 'currentTime'; if 'resetFlag' is 'true',
-        // reset the metrics to their default state.  This operation will
-        // collect aggregated metric record values from metric collection
-        // callbacks in 'manager.d_callbackRegistry' as well as from
-        // 'Collector' objects owned by 'manager.d_collectors', and if the
-        // 'resetFlag' is 'true', reset those collectors and callbacks to their
-        // default state.  If a 'category' has not been previously reset, then
-        // the 'elapsedTime' is computed from the creation of 'manager'.  Note
+        // specified 'manager' for the specified 'category', append to the
+        // specified 'quantileRecords' (if not 0) the quantile records
+        // collected from the histogram collectors registered with 'manager'
+        // for 'category', and load into specified 'elapsedTime' the time
+        // interval from when they were last reset to the specified
+        // 'currentTime'; if 'resetFlag' is 'true', reset the metrics to their
+        // default state.  This operation will collect aggregated metric record
+        // values from metric collection callbacks in
+        // 'manager.d_callbackRegistry' as well as from 'Collector' objects
+        // owned by 'manager.d_collectors', and if the 'resetFlag' is 'true',
+        // reset those collectors and callbacks to their default state.  If
+        // 'quantileRecords' is 0, histogram collectors are neither collected
+        // nor reset.  If a 'category' has not been previously reset, then the
+        // 'elapsedTime' is computed from the creation of 'manager'.  Note
         // that this operation does *not* test if 'category' is enabled.
 
     template <class ConstForwardCategoryIterator>
@@ -490,12 +503,13 @@ void MetricsManager_PublicationHelper::updateSampleCache(
 }
 
 void MetricsManager_PublicationHelper::collect(
-                                        bsl::vector<MetricRecord> *records,
-                                        bsls::TimeInterval        *elapsedTime,
-                                        MetricsManager            *manager,
-                                        const Category            *category,
-                                        const bsls::TimeInterval&  now,
-                                        bool                       resetFlag)
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  bsls::TimeInterval          *elapsedTime,
+                                  MetricsManager              *manager,
+                                  const Category              *category,
+                                  const bsls::TimeInterval&    now,
+                                  bool                         resetFlag)
 {
     typedef MetricsManager::RecordsCollectionCallback Callback;
     typedef bsl::vector<const Callback *>             CBVector;
@@ -517,6 +531,23 @@ void MetricsManager_PublicationHelper::collect(
         manager->d_collectors.collect(records, category);
     }
 
+    // Collect quantile records from the registered histogram collectors.
+    if (quantileRecords) {
+        typedef MetricsManager::HistogramRegistry::const_iterator HistogramIt;
+
+        HistogramIt hIt  = manager->d_histograms.lower_bound(category);
+        HistogramIt hEnd = manager->d_histograms.upper_bound(category);
+        for (; hIt != hEnd; ++hIt) {
+            quantileRecords->resize(quantileRecords->size() + 1);
+            if (resetFlag) {
+                hIt->second->loadAndReset(&quantileRecords->back());
+            }
+            else {
+                hIt->second->load(&quantileRecords->back());
+            }
+        }
+    }
+
     // Compute the elapsed time since the previous reset, and if 'resetFlag'
     // is 'true', update the last reset time to 'now'.
     MetricsManager::LastResetTimes::iterator tmIt =
@@ -547,11 +578,18 @@ void MetricsManager_PublicationHelper::publish(
     }
     typedef bsl::vector<bsl::shared_ptr<bsl::vector<MetricRecord> > >
                                                                   RecordBuffer;
+    typedef bsl::vector<bsl::shared_ptr<bsl::vector<QuantileRecord> > >
+                                                          QuantileRecordBuffer;
 
     // Iterate over the categories, storing their records in a 'RecordBuffer'
-    // and populating the samples in the 'SampleCache'.  The samples in the
-    // sample cache refer to records in the record buffer.
-    RecordBuffer recordBuffer;  // holds onto collected record vectors
+    // (and their quantile records in a 'QuantileRecordBuffer') and populating
+    // the samples in the 'SampleCache'.  The samples in the sample cache
+    // refer to records in the record buffers.
+    RecordBuffer         recordBuffer;    // holds onto collected record
+                                          // vectors
+
+    QuantileRecordBuffer quantileBuffer;  // holds onto collected quantile
+                                          // record vectors
 
     SampleCache  sampleCache;          // publisher -> sample (samples point to
                                        // records in the 'recordBuffer')
@@ -573,14 +611,23 @@ void MetricsManager_PublicationHelper::publish(
         bsl::shared_ptr<bsl::vector<MetricRecord> > records;
         records.createInplace();
 
+        bsl::shared_ptr<bsl::vector<QuantileRecord> > quantileRecords;
+        quantileRecords.createInplace();
+
         // Hold the elapsed time over which these metrics were collected.
         bsls::TimeInterval elapsedTime;
 
         // Collect the metrics.
-        collect(records.get(), &elapsedTime, manager, *catIt, now, resetFlag);
+        collect(records.get(),
+                quantileRecords.get(),
+                &elapsedTime,
+                manager,
+                *catIt,
+                now,
+                resetFlag);
 
         // If their are no collected records then this category can be ignored.
-        if (records->empty()) {
+        if (records->empty() && quantileRecords->empty()) {
             continue;
         }
 
@@ -592,9 +639,13 @@ void MetricsManager_PublicationHelper::publish(
 
         // Append the collected records to the buffer of records.
         recordBuffer.push_back(records);
+        quantileBuffer.push_back(quantileRecords);
         MetricSampleGroup sampleGroup(records->data(),
                                       static_cast<int>(records->size()),
                                       elapsedTime);
+        sampleGroup.setQuantileRecords(
+                                 quantileRecords->data(),
+                                 static_cast<int>(quantileRecords->size()));
 
         // Add 'sampleGroup' to all the general publishers and specific
         // publishers for 'category'.
@@ -971,6 +1022,7 @@ MetricsManager::MetricsManager(bslma::Allocator *basicAllocator)
 , d_publishers(0)
 , d_creationTime(bdlt::CurrentTime::now())
 , d_prevResetTimes(basicAllocator)
+, d_histograms(basicAllocator)
 , d_publishLock()
 , d_rwLock()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
@@ -1009,6 +1061,33 @@ void MetricsManager::collectSample(MetricSample              *sample,
                                    const Category * const     categories[],
                                    int                        numCategories,
                                    bool                       resetFlag)
+{
+    collectSample(sample, records, 0, categories, numCategories, resetFlag);
+}
+
+void MetricsManager::collectSample(
+                                  MetricSample                *sample,
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  bool                         resetFlag)
+{
+    bsl::vector<const Category *> allCategories;
+    d_metricRegistry.getAllCategories(&allCategories);
+    collectSample(sample,
+                  records,
+                  quantileRecords,
+                  allCategories.data(),
+                  static_cast<int>(allCategories.size()),
+                  resetFlag);
+}
+
+void MetricsManager::collectSample(
+                                  MetricSample                *sample,
+                                  bsl::vector<MetricRecord>   *records,
+                                  bsl::vector<QuantileRecord> *quantileRecords,
+                                  const Category * const       categories[],
+                                  int                          numCategories,
+                                  bool                         resetFlag)
 {
     bdlt::DatetimeTz   timeStamp(bdlt::CurrentTime::utc(), 0);
     bsls::TimeInterval now = bdlt::CurrentTime::now();
@@ -1016,7 +1095,7 @@ void MetricsManager::collectSample(MetricSample              *sample,
     sample->setTimeStamp(timeStamp);
 
     // We use an intermediate structure to hold indirect references into
-    // 'records' in case 'records' must be resized.
+    // 'records' and 'quantileRecords' in case they must be resized.
     bsl::vector<SampleDescription> samples;
     samples.reserve(numCategories);
 
@@ -1033,28 +1112,49 @@ void MetricsManager::collectSample(MetricSample              *sample,
         // Hold the elapsed time over which these metrics were collected.
         bsls::TimeInterval elapsedTime;
 
-        int beginIndex = static_cast<int>(records->size());
+        int beginIndex         = static_cast<int>(records->size());
+        int quantileBeginIndex = quantileRecords
+                               ? static_cast<int>(quantileRecords->size())
+                               : 0;
 
         // Collect the metrics.
-        MetricsManager_PublicationHelper::collect(
-                     records, &elapsedTime, this, *category, now, resetFlag);
-
-        int size = static_cast<int>(records->size()) - beginIndex;
+        MetricsManager_PublicationHelper::collect(records,
+                                                  quantileRecords,
+                                                  &elapsedTime,
+                                                  this,
+                                                  *category,
+                                                  now,
+                                                  resetFlag);
+
+        int size         = static_cast<int>(records->size()) - beginIndex;
+        int quantileSize = quantileRecords
+                         ? static_cast<int>(quantileRecords->size())
+                                                          - quantileBeginIndex
+                         : 0;
 
         // If their are no collected records then this category can be ignored.
-        if (0 < size) {
-            samples.push_back(
-                SampleDescription(beginIndex, size, elapsedTime));
+        if (0 < size || 0 < quantileSize) {
+            samples.push_back(SampleDescription(beginIndex,
+                                                size,
+                                                quantileBeginIndex,
+                                                quantileSize,
+                                                elapsedTime));
         }
     }
 
-    // Now the 'records' vector is full, we can add addresses into it to
-    // 'sample'.
+    // Now the 'records' and 'quantileRecords' vectors are full, we can add
+    // addresses into them to 'sample'.
     bsl::vector<SampleDescription>::const_iterator it = samples.begin();
     for (; it != samples.end(); ++it) {
-        sample->appendGroup(&(*records)[it->d_beginIndex],
-                            it->d_size,
-                            it->d_elapsedTime);
+        MetricSampleGroup group(records->data() + it->d_beginIndex,
+                                it->d_size,
+                                it->d_elapsedTime);
+        if (0 < it->d_quantileSize) {
+            group.setQuantileRecords(
+                           quantileRecords->data() + it->d_quantileBeginIndex,
+                           it->d_quantileSize);
+        }
+        sample->appendGroup(group);
     }
 }
 
@@ -1132,6 +1232,48 @@ int MetricsManager::removeCollectionCallback(CallbackHandle handle)
     return d_callbacks->removeCollectionCallback(handle);
 }
 
+bsl::shared_ptr<HistogramCollector>
+MetricsManager::addHistogramCollector(const MetricId& metricId)
+{
+    bsl::vector<double> quantiles(d_allocator_p);
+    HistogramCollector::defaultQuantiles(&quantiles);
+    return addHistogramCollector(metricId, quantiles);
+}
+
+bsl::shared_ptr<HistogramCollector>
+MetricsManager::addHistogramCollector(const MetricId&            metricId,
+                                      const bsl::vector<double>& quantiles)
+{
+    BSLS_ASSERT(metricId.isValid());
+
+    bsl::shared_ptr<HistogramCollector> collector;
+    collector.createInplace(d_allocator_p, metricId, quantiles, d_allocator_p);
+
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwLock);
+    d_histograms.insert(HistogramRegistry::value_type(metricId.category(),
+                                                      collector));
+    return collector;
+}
+
+int MetricsManager::removeHistogramCollector(
+                                          const HistogramCollector *collector)
+{
+    BSLS_ASSERT(collector);
+
+    const Category *category = collector->metricId().category();
+
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwLock);
+    HistogramRegistry::iterator it  = d_histograms.lower_bound(category);
+    HistogramRegistry::iterator end = d_histograms.upper_bound(category);
+    for (; it != end; ++it) {
+        if (it->second.get() == collector) {
+            d_histograms.erase(it);
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
 int MetricsManager::addGeneralPublisher(
                                    const bsl::shared_ptr<Publisher>& publisher)
 {
@@ -392,6 +392,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_collectorrepository.h>
+#include <balm_histogramcollector.h>
 #include <balm_metricregistry.h>
 
 #include <bslmt_rwmutex.h>
@@ -418,6 +419,7 @@ class Category;
 class Publisher;
 class MetricRecord;
 class MetricSample;
+class QuantileRecord;
 
 class MetricsManager_PublisherRegistry;   // defined in implementation
 class MetricsManager_CallbackRegistry;    // defined in implementation
@@ -437,6 +439,8 @@ class MetricsManager {
     // facilities and register a callback using this metric manager's
     // 'registerMetricsCallback' method; or (2) use the 'Collector' objects
     // available from the 'CollectorRepository' owned by this metrics manager.
+    // In addition, the distribution of a metric's values can be recorded
+    // using a 'HistogramCollector' obtained from 'addHistogramCollector'.
 
   public:
     // TYPES
@@ -463,6 +467,12 @@ class MetricsManager {
         // the interval since the epoch) of that category.  This is used to
         // compute the time interval over which a metric was collected.
 
+    typedef bsl::multimap<const Category *,
+                          bsl::shared_ptr<HistogramCollector> >
+                                                             HistogramRegistry;
+        // A mapping from a category to the histogram collectors recording
+        // metrics belonging to that category.
+
     // DATA
     MetricRegistry           d_metricRegistry;  // registry of metrics
 
@@ -483,6 +493,9 @@ class MetricsManager {
     LastResetTimes           d_prevResetTimes;  // time of a category's
                                                 // previous reset
 
+    HistogramRegistry        d_histograms;      // registered histogram
+                                                // collectors
+
     bslmt::Mutex             d_publishLock;     // lock for 'publish',
                                                 // acquired before 'd_rwLock'
 
@@ -567,6 +580,49 @@ class MetricsManager {
         // Remove the callback associated with the specified 'handle'.  Return
         // 0 on success, or a non-zero value if 'handle' cannot be found.
 
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                const char *categoryName,
+                                                const char *metricName);
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                     const char                 *categoryName,
+                                     const char                 *metricName,
+                                     const bsl::vector<double>&  quantiles);
+        // Create a histogram collector recording the distribution of values
+        // of the metric having the specified 'metricName' in the category
+        // having the specified 'categoryName', register it with this metrics
+        // manager, and return a shared pointer to the new collector.
+        // Optionally specify a sequence of 'quantiles' to report for the
+        // metric; if 'quantiles' is not specified, the quantiles returned by
+        // 'HistogramCollector::defaultQuantiles' are reported.  Each time the
+        // identified category is published or collected (see 'publish' and
+        // 'collectSample') the collector supplies a 'QuantileRecord' for the
+        // metric.  The behavior is undefined unless 'categoryName' and
+        // 'metricName' are null-terminated, and each value in 'quantiles' is
+        // in the range '[0 .. 1]'.  Note that a new collector is created on
+        // each call, even if a collector for the identified metric has already
+        // been registered.
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                    const MetricId& metricId);
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                        const MetricId&            metricId,
+                                        const bsl::vector<double>& quantiles);
+        // Create a histogram collector recording the distribution of values
+        // of the metric having the specified 'metricId', register it with
+        // this metrics manager, and return a shared pointer to the new
+        // collector.  Optionally specify a sequence of 'quantiles' to report
+        // for the metric; if 'quantiles' is not specified, the quantiles
+        // returned by 'HistogramCollector::defaultQuantiles' are reported.
+        // The behavior is undefined unless 'metricId' is a valid id supplied
+        // by 'metricRegistry()', and each value in 'quantiles' is in the range
+        // '[0 .. 1]'.
+
+    int removeHistogramCollector(const HistogramCollector *collector);
+        // Stop collecting the specified 'collector', and remove it from this
+        // metrics manager.  Return 0 on success, and a non-zero value if
+        // 'collector' cannot be found.  Note that 'collector' remains valid
+        // for as long as clients hold a shared pointer to it.
+
     int addGeneralPublisher(const bsl::shared_ptr<Publisher>& publisher);
         // Add the specified 'publisher' to the set of publishers that will be
         // used to propagate records for *every* category published by this
@@ -651,6 +707,32 @@ class MetricsManager {
         // *addresses* of the metric records appended to 'records', and
         // modifying 'records' after this call returns may invalidate 'sample'.
 
+    void collectSample(MetricSample                *sample,
+                       bsl::vector<MetricRecord>   *records,
+                       bsl::vector<QuantileRecord> *quantileRecords,
+                       bool                         resetFlag = false);
+    void collectSample(MetricSample                *sample,
+                       bsl::vector<MetricRecord>   *records,
+                       bsl::vector<QuantileRecord> *quantileRecords,
+                       const Category      * const  categories[],
+                       int                          numCategories,
+                       bool                         resetFlag = false);
+        // Load into the specified 'sample' a metric sample collected from the
+        // indicated categories, append to 'records' those collected records
+        // which are referred to by 'sample', and append to the specified
+        // 'quantileRecords' the records collected from registered histogram
+        // collectors which are referred to by 'sample'.  Optionally specify a
+        // sequence of 'categories' of length 'numCategories', and a
+        // 'resetFlag', having the same meaning as for the alternative
+        // 'collectSample' methods.  The behavior is undefined unless
+        // '0 <= numCategories', 'categories' refers to a contiguous sequence
+        // of (at least) 'numCategories', and each category in 'categories'
+        // appears only once.  Note that the alternative 'collectSample'
+        // methods neither collect nor reset histogram collectors.  Also note
+        // that 'sample' is loaded with the *addresses* of the records appended
+        // to 'records' and 'quantileRecords', and modifying either after this
+        // call returns may invalidate 'sample'.
+
     void publish(const Category *category, bool resetFlag = true);
         // Publish metrics associated with the specified 'category' if
         // 'category' is enabled; otherwise (if 'category' is not enabled)
@@ -862,6 +944,26 @@ MetricsManager::registerCollectionCallback(
                                 callback);
 }
 
+inline
+bsl::shared_ptr<HistogramCollector> MetricsManager::addHistogramCollector(
+                                                    const char *categoryName,
+                                                    const char *metricName)
+{
+    return addHistogramCollector(d_metricRegistry.getId(categoryName,
+                                                        metricName));
+}
+
+inline
+bsl::shared_ptr<HistogramCollector> MetricsManager::addHistogramCollector(
+                                     const char                 *categoryName,
+                                     const char                 *metricName,
+                                     const bsl::vector<double>&  quantiles)
+{
+    return addHistogramCollector(d_metricRegistry.getId(categoryName,
+                                                        metricName),
+                                 quantiles);
+}
+
 inline
 int MetricsManager::addSpecificPublisher(
                                const char                        *categoryName,
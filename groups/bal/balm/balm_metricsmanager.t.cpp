@@ -9,8 +9,10 @@
 
 #include <balm_metricsmanager.h>
 
+#include <balm_histogramcollector.h>
 #include <balm_metricsample.h>
 #include <balm_publisher.h>
+#include <balm_quantilerecord.h>
 
 #include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
@@ -89,6 +91,16 @@ using bsl::flush;
 // [ 6]  CallbackHandle registerCollectionCallback(const balm::Category *,
 //                                           RecordsCollectionCallback  );
 // [16]  int removeCollectionCallback(CallbackHandle );
+// [26]  shared_ptr<HistogramCollector> addHistogramCollector(const char *,
+//                                                           const char *);
+// [26]  shared_ptr<HistogramCollector> addHistogramCollector(const char *,
+//                                            const char *,
+//                                            const bsl::vector<double>& );
+// [26]  shared_ptr<HistogramCollector> addHistogramCollector(const MetricId&);
+// [26]  shared_ptr<HistogramCollector> addHistogramCollector(
+//                                            const MetricId&,
+//                                            const bsl::vector<double>& );
+// [26]  int removeHistogramCollector(const HistogramCollector *);
 // [ 7]  int addGeneralPublisher(bsl::shared_ptr<balm::Publisher>& );
 // [18]  int addSpecificPublisher(const char *,
 //                                bsl::shared_ptr<balm::Publisher>& );
@@ -106,6 +118,16 @@ using bsl::flush;
 //                          const balm::Category            *[],
 //                          int                             ,
 //                          bool                            );
+// [26]  void collectSample(balm::MetricSample                *,
+//                          bsl::vector<balm::MetricRecord>   *,
+//                          bsl::vector<balm::QuantileRecord> *,
+//                          bool                              );
+// [26]  void collectSample(balm::MetricSample                *,
+//                          bsl::vector<balm::MetricRecord>   *,
+//                          bsl::vector<balm::QuantileRecord> *,
+//                          const balm::Category              *[],
+//                          int                               ,
+//                          bool                              );
 // [10]  void publish(const balm::Category  *, const bsls::TimeInterval& );
 // [ 8]  void publish(const balm::Category *[], int, const TimeInterval& );
 // [ 9]  void publish(const bsl::set<const balm::Category *>& ,
@@ -136,7 +158,8 @@ using bsl::flush;
 // [21] BSLMA ALLOCATION EXCEPTION TEST: publish
 // [23] TESTING: 'publish' with 'resetFlag'
 // [25] CONCURRENCY TEST
-// [26] USAGE EXAMPLE
+// [26] TESTING: histogram collectors
+// [27] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -731,6 +754,87 @@ bool TestPublisher::contains(const balm::MetricId& id) const
     return indexOf(id) != -1;
 }
 
+                          // =======================
+                          // class QuantilePublisher
+                          // =======================
+
+class QuantilePublisher : public balm::Publisher {
+    // This class defines a test implementation of the 'balm::Publisher'
+    // protocol that records copies of the quantile records of the last
+    // published sample.  Note that the 'publish' method is *not*
+    // thread-safe.
+
+    // DATA
+    int                               d_numInvocations;  // # of invocations
+    int                               d_numRecords;      // # of records in
+                                                         // last sample
+    bsl::vector<balm::QuantileRecord> d_quantileRecords; // last sample's
+                                                         // quantile records
+
+    // NOT IMPLEMENTED
+    QuantilePublisher(const QuantilePublisher& );
+    QuantilePublisher& operator=(const QuantilePublisher& );
+
+  public:
+    // CREATORS
+    explicit QuantilePublisher(bslma::Allocator *allocator)
+        // Create a test publisher with 0 'invocations()' using the specified
+        // 'allocator' to supply memory.
+    : d_numInvocations(0)
+    , d_numRecords(0)
+    , d_quantileRecords(allocator)
+    {
+    }
+
+    virtual ~QuantilePublisher()
+        // Destroy this test publisher.
+    {
+    }
+
+    // MANIPULATORS
+    virtual void publish(const balm::MetricSample& sample)
+        // Increment the number of 'invocations()', and record the number of
+        // records and copies of the quantile records of the specified
+        // 'sample'.
+    {
+        ++d_numInvocations;
+        d_numRecords = sample.numRecords();
+        d_quantileRecords.clear();
+
+        int numQuantileRecords = 0;
+        balm::MetricSample::const_iterator it = sample.begin();
+        for (; it != sample.end(); ++it) {
+            d_quantileRecords.insert(d_quantileRecords.end(),
+                                     it->quantileRecords(),
+                                     it->quantileRecords() +
+                                                    it->numQuantileRecords());
+            numQuantileRecords += it->numQuantileRecords();
+        }
+        ASSERT(numQuantileRecords == sample.numQuantileRecords());
+    }
+
+    // ACCESSORS
+    int invocations() const
+        // Return the number of times 'publish' has been invoked.
+    {
+        return d_numInvocations;
+    }
+
+    int lastNumRecords() const
+        // Return the number of (non-quantile) records in the last published
+        // sample.
+    {
+        return d_numRecords;
+    }
+
+    const bsl::vector<balm::QuantileRecord>& lastQuantileRecords() const
+        // Return a reference to the non-modifiable copies of the quantile
+        // records of the last published sample.
+    {
+        return d_quantileRecords;
+    }
+};
+
                          // =========================
                          // class CombinationIterator
                          // =========================
@@ -1492,7 +1596,7 @@ int main(int argc, char *argv[])
     bdlt::CurrentTime::now();
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1585,6 +1689,234 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING: histogram collectors
+        //
+        // Concerns:
+        //: 1 'addHistogramCollector' creates a collector, for the identified
+        //:   metric and with the supplied (or default) quantiles, allocated
+        //:   using the allocator of the metrics manager.
+        //:
+        //: 2 Publishing a category publishes a quantile record for each
+        //:   histogram collector registered for that category (and only
+        //:   that category), even if the category has no other records.
+        //:
+        //: 3 Histogram collectors are reset only if 'resetFlag' is 'true',
+        //:   and are not published for a disabled category.
+        //:
+        //: 4 'removeHistogramCollector' stops publishing a collector, and
+        //:   fails for a collector that is not registered.
+        //:
+        //: 5 The 'collectSample' overloads taking quantile records collect
+        //:   histogram collectors, and the alternative overloads neither
+        //:   collect nor reset them.
+        //
+        // Plan:
+        //: 1 Register histogram collectors with each 'addHistogramCollector'
+        //:   overload, record values, and publish the categories to a
+        //:   'QuantilePublisher', verifying the published quantile records.
+        //:   (C-1..3)
+        //:
+        //: 2 Remove a collector, and verify it is no longer published.  (C-4)
+        //:
+        //: 3 Collect samples using each 'collectSample' overload, and verify
+        //:   the collected records and their reset.  (C-5)
+        //
+        // Testing:
+        //   shared_ptr<HistogramCollector> addHistogramCollector(...);
+        //   int removeHistogramCollector(const HistogramCollector *);
+        //   void collectSample(MetricSample *, vector<MetricRecord> *,
+        //                      vector<QuantileRecord> *, bool);
+        //   void collectSample(MetricSample *, vector<MetricRecord> *,
+        //                      vector<QuantileRecord> *,
+        //                      const Category *[], int, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: histogram collectors" << endl
+                          << "=============================" << endl;
+
+        typedef bsl::shared_ptr<balm::HistogramCollector> HistogramPtr;
+
+        balm::MetricsManager mX(Z);
+        balm::MetricRegistry& registry = mX.metricRegistry();
+
+        bsl::shared_ptr<QuantilePublisher> publisher(
+                                                new (*Z) QuantilePublisher(Z),
+                                                Z);
+        ASSERT(0 == mX.addGeneralPublisher(publisher));
+
+        const balm::Category *CAT_A = registry.getCategory("A");
+        const balm::Category *CAT_B = registry.getCategory("B");
+
+        bsl::vector<double> quantiles(1, 0.5);
+        quantiles.push_back(1.0);
+
+        const bsls::Types::Int64 bytesBefore = testAlloc.numBytesInUse();
+
+        HistogramPtr h1 = mX.addHistogramCollector("A", "Latency");
+        HistogramPtr h2 = mX.addHistogramCollector("A", "Size", quantiles);
+        HistogramPtr h3 = mX.addHistogramCollector(
+                                               registry.getId("B", "Latency"));
+        HistogramPtr h4 = mX.addHistogramCollector(
+                                                registry.getId("B", "Size"),
+                                                quantiles);
+
+        ASSERT(testAlloc.numBytesInUse() > bytesBefore);
+
+        bsl::vector<double> defaults;
+        balm::HistogramCollector::defaultQuantiles(&defaults);
+
+        ASSERT(registry.getId("A", "Latency") == h1->metricId());
+        ASSERT(registry.getId("A", "Size")    == h2->metricId());
+        ASSERT(registry.getId("B", "Latency") == h3->metricId());
+        ASSERT(registry.getId("B", "Size")    == h4->metricId());
+        ASSERT(defaults  == h1->quantiles());
+        ASSERT(quantiles == h2->quantiles());
+        ASSERT(defaults  == h3->quantiles());
+        ASSERT(quantiles == h4->quantiles());
+
+        for (int i = 1; i <= 10; ++i) {
+            h1->update(i);
+            h2->update(i * 100);
+            h3->update(i * 1000);
+        }
+
+        if (verbose) cout << "\tTesting 'publish'." << endl;
+        {
+            mX.publish(CAT_A, false);
+            ASSERT(1 == publisher->invocations());
+            ASSERT(0 == publisher->lastNumRecords());
+
+            const bsl::vector<balm::QuantileRecord>& records =
+                                             publisher->lastQuantileRecords();
+            ASSERT(2 == records.size());
+
+            const balm::QuantileRecord& r1 =
+                                  records[0].record().metricId() ==
+                                                           h1->metricId()
+                                  ? records[0]
+                                  : records[1];
+            const balm::QuantileRecord& r2 = &r1 == &records[0]
+                                           ? records[1]
+                                           : records[0];
+
+            ASSERT(h1->metricId() == r1.record().metricId());
+            ASSERT(10             == r1.record().count());
+            ASSERT(55             == r1.record().total());
+            ASSERT(4              == r1.numQuantiles());
+            ASSERT(5              == r1.value(0));
+
+            ASSERT(h2->metricId() == r2.record().metricId());
+            ASSERT(10             == r2.record().count());
+            ASSERT(2              == r2.numQuantiles());
+            ASSERT(1000           == r2.value(1));
+
+            // Not reset.
+
+            mX.publish(CAT_A, true);
+            ASSERT(2 == publisher->invocations());
+            ASSERT(2 == publisher->lastQuantileRecords().size());
+            ASSERT(10 ==
+                     publisher->lastQuantileRecords()[0].record().count());
+
+            // Reset.
+
+            mX.publish(CAT_A, true);
+            ASSERT(3 == publisher->invocations());
+            ASSERT(2 == publisher->lastQuantileRecords().size());
+            ASSERT(0 ==
+                     publisher->lastQuantileRecords()[0].record().count());
+            ASSERT(0 ==
+                     publisher->lastQuantileRecords()[1].record().count());
+
+            mX.publish(CAT_B);
+            ASSERT(4 == publisher->invocations());
+            ASSERT(2 == publisher->lastQuantileRecords().size());
+
+            mX.setCategoryEnabled(CAT_B, false);
+            mX.publish(CAT_B);
+            ASSERT(4 == publisher->invocations());
+            mX.setCategoryEnabled(CAT_B, true);
+        }
+
+        if (verbose) cout << "\tTesting 'removeHistogramCollector'."
+                          << endl;
+        {
+            ASSERT(0 == mX.removeHistogramCollector(h3.get()));
+            ASSERT(0 != mX.removeHistogramCollector(h3.get()));
+
+            h3->update(1);
+            h4->update(2);
+
+            mX.publish(CAT_B);
+            ASSERT(5 == publisher->invocations());
+            ASSERT(1 == publisher->lastQuantileRecords().size());
+            ASSERT(h4->metricId() ==
+                      publisher->lastQuantileRecords()[0].record().metricId());
+
+            balm::HistogramCollector unregistered(h3->metricId(), Z);
+            ASSERT(0 != mX.removeHistogramCollector(&unregistered));
+        }
+
+        if (verbose) cout << "\tTesting 'collectSample'." << endl;
+        {
+            h1->update(7);
+            h4->update(3);
+
+            balm::MetricSample                sample(Z);
+            bsl::vector<balm::MetricRecord>   records(Z);
+            bsl::vector<balm::QuantileRecord> quantileRecords(Z);
+
+            // The alternative overloads neither collect nor reset histograms.
+
+            mX.collectSample(&sample, &records, true);
+            ASSERT(0 == sample.numQuantileRecords());
+
+            mX.collectSample(&sample, &records, &CAT_A, 1, true);
+            ASSERT(0 == sample.numQuantileRecords());
+
+            sample.removeAllRecords();
+            records.clear();
+            mX.collectSample(&sample, &records, &quantileRecords, &CAT_A, 1);
+            ASSERT(2 == sample.numQuantileRecords());
+            ASSERT(2 == quantileRecords.size());
+            ASSERT(1 == sample.numGroups());
+            ASSERT(quantileRecords.data() ==
+                                      sample.sampleGroup(0).quantileRecords());
+
+            int count = 0;
+            for (bsl::size_t i = 0; i < quantileRecords.size(); ++i) {
+                count += quantileRecords[i].record().count();
+            }
+            ASSERT(1 == count);
+
+            sample.removeAllRecords();
+            records.clear();
+            quantileRecords.clear();
+            mX.collectSample(&sample, &records, &quantileRecords, true);
+            ASSERT(3 == sample.numQuantileRecords());
+            ASSERT(3 == quantileRecords.size());
+            ASSERT(2 == sample.numGroups());
+
+            count = 0;
+            for (bsl::size_t i = 0; i < quantileRecords.size(); ++i) {
+                count += quantileRecords[i].record().count();
+            }
+            ASSERT(2 == count);
+
+            sample.removeAllRecords();
+            records.clear();
+            quantileRecords.clear();
+            mX.collectSample(&sample, &records, &quantileRecords, false);
+            count = 0;
+            for (bsl::size_t i = 0; i < quantileRecords.size(); ++i) {
+                count += quantileRecords[i].record().count();
+            }
+            ASSERT(0 == count);
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
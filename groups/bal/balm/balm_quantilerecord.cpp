@@ -0,0 +1,50 @@
+// balm_quantilerecord.cpp                                            -*-C++-*-
+#include <balm_quantilerecord.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_quantilerecord_cpp,"$Id$ $CSID$")
+
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                            // --------------------
+                            // class QuantileRecord
+                            // --------------------
+
+// ACCESSORS
+bsl::ostream& QuantileRecord::print(bsl::ostream& stream) const
+{
+    const MetricRecord& record = d_record;
+
+    stream << "[ " << record.metricId() << ": " << record.count()
+           << " " << record.total()
+           << " " << record.min()
+           << " " << record.max()
+           << " {";
+    for (int i = 0; i < numQuantiles(); ++i) {
+        stream << " " << d_quantiles[i] << ": " << d_values[i];
+    }
+    stream << " } ]";
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
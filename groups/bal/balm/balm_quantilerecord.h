@@ -0,0 +1,367 @@
+// balm_quantilerecord.h                                              -*-C++-*-
+#ifndef INCLUDED_BALM_QUANTILERECORD
+#define INCLUDED_BALM_QUANTILERECORD
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an aggregated record of a metric including its quantiles.
+//
+//@CLASSES:
+//  balm::QuantileRecord: aggregated value of a metric, with quantiles
+//
+//@SEE_ALSO: balm_histogramcollector, balm_metricrecord, balm_metricsample
+//
+//@DESCRIPTION: This component implements an unconstrained, value-semantic
+// attribute class, 'balm::QuantileRecord', used to represent the aggregated
+// value of a metric whose distribution was recorded, for example by a
+// 'balm::HistogramCollector'.  A 'balm::QuantileRecord' holds a
+// 'balm::MetricRecord' (identifying the metric and holding the count, total,
+// minimum, and maximum of its values) and a sequence of (quantile, value)
+// pairs, each giving the value below which the indicated fraction of the
+// recorded values fall.  The attributes held by 'balm::QuantileRecord' are
+// given in the following table:
+//..
+//  Attribute    Type                  Description                   Default
+//  ---------    -------------------   ---------------------------   -------
+//  record       balm::MetricRecord    id, count, total, min, max    default
+//  quantiles    sequence of double    quantiles, each in [0 .. 1]   empty
+//  values       sequence of double    value at each quantile        empty
+//..
+// The 'quantiles' and 'values' sequences always have the same length.
+//
+///Thread Safety
+///-------------
+// 'balm::QuantileRecord' is *const* *thread-safe*, meaning that accessors may
+// be invoked concurrently from different threads, but it is not safe to
+// access or modify a 'balm::QuantileRecord' in one thread while another
+// thread modifies the same object.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Describing the Distribution of a Metric
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we measured the latencies, in microseconds, of 1000 requests, and
+// want to describe their distribution.  We start by creating a
+// 'balm::MetricId' object by hand, but in practice an id should be obtained
+// from a 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+//  balm::Category          myCategory("MyCategory");
+//  balm::MetricDescription description(&myCategory, "RequestLatency");
+//  balm::MetricId          latencyId(&description);
+//..
+// Then, we create a 'balm::QuantileRecord' for the metric, and set the count,
+// total, minimum, and maximum of the latencies:
+//..
+//  balm::QuantileRecord latency(latencyId);
+//
+//  latency.record().count() = 1000;
+//  latency.record().total() = 250000;
+//  latency.record().min()   = 40;
+//  latency.record().max()   = 9000;
+//..
+// Next, we append the median and the 99th percentile of the latencies:
+//..
+//  latency.appendQuantile(0.5,  180);
+//  latency.appendQuantile(0.99, 2100);
+//..
+// Finally, we verify the quantiles of the record:
+//..
+//  assert(2    == latency.numQuantiles());
+//  assert(0.5  == latency.quantile(0));
+//  assert(180  == latency.value(0));
+//  assert(0.99 == latency.quantile(1));
+//  assert(2100 == latency.value(1));
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricrecord.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                            // ====================
+                            // class QuantileRecord
+                            // ====================
+
+class QuantileRecord {
+    // Each instance of this class represents the aggregated value of a metric
+    // together with the values of the metric at a sequence of quantiles.  A
+    // quantile record contains a 'MetricRecord' (holding the id of the
+    // metric, and the count, total, minimum, and maximum of its values), and
+    // a sequence of (quantile, value) pairs.
+
+    // DATA
+    MetricRecord        d_record;     // id, count, total, min, and max
+
+    bsl::vector<double> d_quantiles;  // quantiles, each in '[0 .. 1]'
+
+    bsl::vector<double> d_values;     // value at each quantile
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(QuantileRecord, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit QuantileRecord(bslma::Allocator *basicAllocator = 0);
+        // Create a quantile record having the default 'MetricRecord' value
+        // and no quantiles.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    explicit QuantileRecord(const MetricId&   metricId,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a quantile record for the metric having the specified
+        // 'metricId', having a count of 0, a total of 0.0, a minimum of
+        // 'MetricRecord::k_DEFAULT_MIN', a maximum of
+        // 'MetricRecord::k_DEFAULT_MAX', and no quantiles.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    QuantileRecord(const QuantileRecord&  original,
+                   bslma::Allocator      *basicAllocator = 0);
+        // Create a quantile record having the same value as the specified
+        // 'original' record.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~QuantileRecord() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    QuantileRecord& operator=(const QuantileRecord& rhs);
+        // Assign to this record the value of the specified 'rhs' record, and
+        // return a reference to this modifiable record.
+
+    void appendQuantile(double quantile, double value);
+        // Append to the sequence of quantiles of this record the specified
+        // 'quantile', having the specified 'value'.  The behavior is undefined
+        // unless '0 <= quantile <= 1'.
+
+    MetricRecord& record();
+        // Return a reference to the modifiable metric record holding the id
+        // of the metric described by this record, and the count, total,
+        // minimum, and maximum of its values.
+
+    void removeAllQuantiles();
+        // Remove all quantiles from this record.
+
+    // ACCESSORS
+    int numQuantiles() const;
+        // Return the number of quantiles in this record.
+
+    double quantile(int index) const;
+        // Return the quantile at the specified 'index' in this record.  The
+        // behavior is undefined unless '0 <= index < numQuantiles()'.
+
+    const MetricRecord& record() const;
+        // Return a reference to the non-modifiable metric record holding the
+        // id of the metric described by this record, and the count, total,
+        // minimum, and maximum of its values.
+
+    double value(int index) const;
+        // Return the value of the metric at the quantile at the specified
+        // 'index' in this record.  The behavior is undefined unless
+        // '0 <= index < numQuantiles()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Print this record to the specified output 'stream' in some
+        // single-line human-readable form, and return a reference to the
+        // modifiable 'stream'.
+};
+
+// FREE OPERATORS
+bool operator==(const QuantileRecord& lhs, const QuantileRecord& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' records have the same
+    // value, and 'false' otherwise.  Two records have the same value if their
+    // 'record' attributes have the same value, and they have the same
+    // sequence of quantiles and values.
+
+bool operator!=(const QuantileRecord& lhs, const QuantileRecord& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' records do not have the
+    // same value, and 'false' otherwise.  Two records do not have the same
+    // value if their 'record' attributes do not have the same value, or they
+    // do not have the same sequence of quantiles and values.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const QuantileRecord& record);
+    // Write a description of the specified 'record' to the specified 'stream'
+    // and return a reference to the modifiable 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class QuantileRecord
+                            // --------------------
+
+// CREATORS
+inline
+QuantileRecord::QuantileRecord(bslma::Allocator *basicAllocator)
+: d_record()
+, d_quantiles(basicAllocator)
+, d_values(basicAllocator)
+{
+}
+
+inline
+QuantileRecord::QuantileRecord(const MetricId&   metricId,
+                               bslma::Allocator *basicAllocator)
+: d_record(metricId)
+, d_quantiles(basicAllocator)
+, d_values(basicAllocator)
+{
+}
+
+inline
+QuantileRecord::QuantileRecord(const QuantileRecord&  original,
+                               bslma::Allocator      *basicAllocator)
+: d_record(original.d_record)
+, d_quantiles(original.d_quantiles, basicAllocator)
+, d_values(original.d_values, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+QuantileRecord& QuantileRecord::operator=(const QuantileRecord& rhs)
+{
+    d_record    = rhs.d_record;
+    d_quantiles = rhs.d_quantiles;
+    d_values    = rhs.d_values;
+    return *this;
+}
+
+inline
+void QuantileRecord::appendQuantile(double quantile, double value)
+{
+    BSLS_ASSERT(0 <= quantile);
+    BSLS_ASSERT(1 >= quantile);
+
+    d_quantiles.push_back(quantile);
+    d_values.push_back(value);
+}
+
+inline
+MetricRecord& QuantileRecord::record()
+{
+    return d_record;
+}
+
+inline
+void QuantileRecord::removeAllQuantiles()
+{
+    d_quantiles.clear();
+    d_values.clear();
+}
+
+// ACCESSORS
+inline
+int QuantileRecord::numQuantiles() const
+{
+    return static_cast<int>(d_quantiles.size());
+}
+
+inline
+double QuantileRecord::quantile(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numQuantiles());
+
+    return d_quantiles[index];
+}
+
+inline
+const MetricRecord& QuantileRecord::record() const
+{
+    return d_record;
+}
+
+inline
+double QuantileRecord::value(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numQuantiles());
+
+    return d_values[index];
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *QuantileRecord::allocator() const
+{
+    return d_quantiles.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator==(const QuantileRecord& lhs, const QuantileRecord& rhs)
+{
+    if (lhs.record() != rhs.record()
+     || lhs.numQuantiles() != rhs.numQuantiles()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < lhs.numQuantiles(); ++i) {
+        if (lhs.quantile(i) != rhs.quantile(i)
+         || lhs.value(i)    != rhs.value(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+inline
+bool balm::operator!=(const QuantileRecord& lhs, const QuantileRecord& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& balm::operator<<(bsl::ostream&         stream,
+                               const QuantileRecord& record)
+{
+    return record.print(stream);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,551 @@
+// balm_quantilerecord.t.cpp                                          -*-C++-*-
+#include <balm_quantilerecord.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+#include <balm_metricid.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::QuantileRecord' is an unconstrained value-semantic attribute class
+// holding a 'balm::MetricRecord' and a sequence of (quantile, value) pairs.
+// We verify the primary manipulators and basic accessors, then the equality
+// operators, the copy constructor and assignment operator (including the
+// allocator used), and finally the output format.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit QuantileRecord(bslma::Allocator *basicAllocator = 0);
+// [ 2] QuantileRecord(const MetricId&, bslma::Allocator * = 0);
+// [ 4] QuantileRecord(const QuantileRecord&, bslma::Allocator * = 0);
+//
+// MANIPULATORS
+// [ 4] QuantileRecord& operator=(const QuantileRecord& rhs);
+// [ 2] void appendQuantile(double quantile, double value);
+// [ 2] MetricRecord& record();
+// [ 2] void removeAllQuantiles();
+//
+// ACCESSORS
+// [ 2] int numQuantiles() const;
+// [ 2] double quantile(int index) const;
+// [ 2] const MetricRecord& record() const;
+// [ 2] double value(int index) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 5] bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const QuantileRecord&, const QuantileRecord&);
+// [ 3] bool operator!=(const QuantileRecord&, const QuantileRecord&);
+// [ 5] bsl::ostream& operator<<(bsl::ostream&, const QuantileRecord&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::QuantileRecord    Obj;
+typedef balm::MetricRecord      Rec;
+typedef balm::MetricId          Id;
+typedef balm::MetricDescription Desc;
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    balm::Category myCategory("MyCategory");
+    Desc           descA(&myCategory, "A");
+    Desc           descB(&myCategory, "B");
+    const Id       ID_A(&descA);
+    const Id       ID_B(&descB);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Describing the Distribution of a Metric
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we measured the latencies, in microseconds, of 1000 requests, and
+// want to describe their distribution.  We start by creating a
+// 'balm::MetricId' object by hand, but in practice an id should be obtained
+// from a 'balm::MetricRegistry' object (such as the one owned by a
+// 'balm::MetricsManager'):
+//..
+    balm::Category          myCategory("MyCategory");
+    balm::MetricDescription description(&myCategory, "RequestLatency");
+    balm::MetricId          latencyId(&description);
+//..
+// Then, we create a 'balm::QuantileRecord' for the metric, and set the count,
+// total, minimum, and maximum of the latencies:
+//..
+    balm::QuantileRecord latency(latencyId);
+
+    latency.record().count() = 1000;
+    latency.record().total() = 250000;
+    latency.record().min()   = 40;
+    latency.record().max()   = 9000;
+//..
+// Next, we append the median and the 99th percentile of the latencies:
+//..
+    latency.appendQuantile(0.5,  180);
+    latency.appendQuantile(0.99, 2100);
+//..
+// Finally, we verify the quantiles of the record:
+//..
+    ASSERT(2    == latency.numQuantiles());
+    ASSERT(0.5  == latency.quantile(0));
+    ASSERT(180  == latency.value(0));
+    ASSERT(0.99 == latency.quantile(1));
+    ASSERT(2100 == latency.value(1));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING OUTPUT (<<) OPERATOR AND 'print'
+        //
+        // Concerns:
+        //: 1 'print' writes the metric id, count, total, minimum, and maximum
+        //:   followed by each (quantile, value) pair, on a single line.
+        //:
+        //: 2 'operator<<' produces the same output as 'print'.
+        //:
+        //: 3 Both return a reference to the supplied stream.
+        //
+        // Plan:
+        //: 1 For records having no quantiles and several quantiles, compare
+        //:   the output of 'print' and 'operator<<' to the expected string.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const QuantileRecord&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "TESTING OUTPUT (<<) OPERATOR AND 'print'" << endl
+                         << "========================================" << endl;
+
+        Obj mX(ID_A);  const Obj& X = mX;
+        mX.record().count() = 3;
+        mX.record().total() = 12;
+        mX.record().min()   = 1;
+        mX.record().max()   = 7;
+
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &X.print(os));
+            ASSERTV(os.str(), "[ MyCategory.A: 3 12 1 7 { } ]" == os.str());
+        }
+
+        mX.appendQuantile(0.5, 4);
+        mX.appendQuantile(0.9, 6.5);
+
+        const bsl::string EXP = "[ MyCategory.A: 3 12 1 7 { 0.5: 4 0.9: 6.5 }"
+                                " ]";
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &X.print(os));
+            ASSERTV(os.str(), EXP == os.str());
+        }
+        {
+            bsl::ostringstream os;
+            ASSERT(&os == &(os << X));
+            ASSERTV(os.str(), EXP == os.str());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY CONSTRUCTOR AND ASSIGNMENT OPERATOR
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the allocator
+        //:   supplied at construction (or the default allocator).
+        //:
+        //: 2 Assignment gives the target the value of the source, without
+        //:   changing the allocator of the target, and returns a reference to
+        //:   the target.
+        //:
+        //: 3 The source of a copy or assignment is not modified, and
+        //:   subsequent changes to either object do not affect the other.
+        //:
+        //: 4 Self-assignment has no effect on the value.
+        //
+        // Plan:
+        //: 1 Copy and assign records having 0, 1, and 3 quantiles, supplying
+        //:   a test allocator, and verify the value and allocator of the
+        //:   result, and the independence of the objects.  (C-1..4)
+        //
+        // Testing:
+        //   QuantileRecord(const QuantileRecord&, bslma::Allocator * = 0);
+        //   QuantileRecord& operator=(const QuantileRecord& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING COPY CONSTRUCTOR AND ASSIGNMENT OPERATOR" << endl
+                 << "================================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVerbose);
+
+        for (int n = 0; n <= 3; n += n ? 2 : 1) {
+            Obj mW(ID_A);  const Obj& W = mW;
+            mW.record().count() = n;
+            for (int i = 0; i < n; ++i) {
+                mW.appendQuantile(0.25 * (i + 1), i * 10);
+            }
+            const Obj Z(W);
+
+            {
+                Obj mX(W, &ta);  const Obj& X = mX;
+                ASSERTV(n, W   == X);
+                ASSERTV(n, &ta == X.allocator());
+
+                mX.appendQuantile(1, 99);
+                ASSERTV(n, Z == W);
+                ASSERTV(n, W != X);
+            }
+            {
+                const Obj X(W);
+                ASSERTV(n, W                 == X);
+                ASSERTV(n, &defaultAllocator == X.allocator());
+            }
+            {
+                Obj mX(ID_B, &ta);  const Obj& X = mX;
+                mX.appendQuantile(0.1, 1);
+
+                ASSERTV(n, &mX == &(mX = W));
+                ASSERTV(n, W   == X);
+                ASSERTV(n, Z   == W);
+                ASSERTV(n, &ta == X.allocator());
+
+                mX.record().count() = 100;
+                ASSERTV(n, Z == W);
+
+                mX = X;
+                ASSERTV(n, 100 == X.record().count());
+                ASSERTV(n, n   == X.numQuantiles());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING EQUALITY OPERATORS
+        //
+        // Concerns:
+        //: 1 Two records compare equal if and only if their metric records,
+        //:   numbers of quantiles, and each quantile and value are equal.
+        //:
+        //: 2 'operator!=' is the negation of 'operator=='.
+        //
+        // Plan:
+        //: 1 Build a table of records differing in a single attribute, and
+        //:   compare every pair of records in the table.  (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const QuantileRecord&, const QuantileRecord&);
+        //   bool operator!=(const QuantileRecord&, const QuantileRecord&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING EQUALITY OPERATORS" << endl
+                          << "==========================" << endl;
+
+        const int NUM_VALUES = 7;
+        Obj       values[NUM_VALUES];
+
+        values[1].record().metricId() = ID_A;
+        values[2].record().count()    = 1;
+        values[3].appendQuantile(0.5, 10);
+        values[4].appendQuantile(0.5, 11);
+        values[5].appendQuantile(0.6, 10);
+        values[6].appendQuantile(0.5, 10);
+        values[6].appendQuantile(0.9, 20);
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            for (int j = 0; j < NUM_VALUES; ++j) {
+                const Obj  U(values[i]);
+                const Obj& V = values[j];
+
+                ASSERTV(i, j, (i == j) == (U == V));
+                ASSERTV(i, j, (i != j) == (U != V));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed record has a default metric record and no
+        //:   quantiles; a record constructed from a metric id has that id.
+        //:
+        //: 2 'appendQuantile' appends the supplied quantile and value, in
+        //:   order, and 'removeAllQuantiles' removes them, without changing
+        //:   the metric record.
+        //:
+        //: 3 'record' returns a reference to the held metric record.
+        //:
+        //: 4 Memory is supplied by the allocator given at construction, or
+        //:   the default allocator, and 'allocator' returns that allocator.
+        //:
+        //: 5 'appendQuantile' asserts its precondition in appropriate build
+        //:   modes.
+        //
+        // Plan:
+        //: 1 Create records with and without a metric id and allocator, and
+        //:   verify their value and allocator.  (C-1, 4)
+        //:
+        //: 2 Append a sequence of quantiles, verifying the value of the record
+        //:   and the memory used after each append, then remove them.
+        //:   (C-2..4)
+        //:
+        //: 3 Verify that 'appendQuantile' asserts on a quantile outside
+        //:   '[0 .. 1]' using 'BSLS_ASSERT' assertion handlers.  (C-5)
+        //
+        // Testing:
+        //   explicit QuantileRecord(bslma::Allocator *basicAllocator = 0);
+        //   QuantileRecord(const MetricId&, bslma::Allocator * = 0);
+        //   void appendQuantile(double quantile, double value);
+        //   MetricRecord& record();
+        //   void removeAllQuantiles();
+        //   int numQuantiles() const;
+        //   double quantile(int index) const;
+        //   const MetricRecord& record() const;
+        //   double value(int index) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "================================================" << endl;
+
+        {
+            const Obj X;
+            ASSERT(Rec()             == X.record());
+            ASSERT(0                 == X.numQuantiles());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+
+        bslma::TestAllocator ta("object", veryVerbose);
+        {
+            Obj mX(ID_A, &ta);  const Obj& X = mX;
+            ASSERT(Rec(ID_A) == X.record());
+            ASSERT(0         == X.numQuantiles());
+            ASSERT(&ta       == X.allocator());
+            ASSERT(0         == ta.numBytesInUse());
+
+            const double QUANTILES[] = { 0.0, 0.5, 0.9, 0.99, 1.0 };
+            const int    NUM         = sizeof QUANTILES / sizeof *QUANTILES;
+
+            for (int i = 0; i < NUM; ++i) {
+                mX.appendQuantile(QUANTILES[i], i * 100 + 0.5);
+
+                ASSERTV(i, i + 1 == X.numQuantiles());
+                ASSERTV(i, 0     <  ta.numBytesInUse());
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, QUANTILES[j]    == X.quantile(j));
+                    ASSERTV(i, j, j * 100 + 0.5   == X.value(j));
+                }
+            }
+
+            mX.record().count() = 7;
+            mX.record().total() = 8;
+            ASSERT(Rec(ID_A, 7, 8, Rec::k_DEFAULT_MIN, Rec::k_DEFAULT_MAX)
+                                                               == X.record());
+            ASSERT(&X.record() == &mX.record());
+
+            mX.removeAllQuantiles();
+            ASSERT(0 == X.numQuantiles());
+            ASSERT(7 == X.record().count());
+
+            ASSERT(0 == defaultAllocator.numBytesInUse());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_PASS(mX.appendQuantile(0,  1));
+            ASSERT_PASS(mX.appendQuantile(1,  1));
+            ASSERT_FAIL(mX.appendQuantile(-0.1, 1));
+            ASSERT_FAIL(mX.appendQuantile(1.1,  1));
+
+            ASSERT_PASS(mX.quantile(1));
+            ASSERT_FAIL(mX.quantile(2));
+            ASSERT_FAIL(mX.value(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a record, append quantiles, copy, compare, and print it.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(ID_A);  const Obj& X = mX;
+        mX.record().count() = 2;
+        mX.appendQuantile(0.5, 3);
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.appendQuantile(0.9, 4);
+        ASSERT(X != Y);
+        ASSERT(2 == Y.numQuantiles());
+        ASSERT(4 == Y.value(1));
+
+        mY = X;
+        ASSERT(X == Y);
+
+        if (veryVerbose) {
+            P(X);
+        }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(balm_streampublisher_cpp,"$Id$ $CSID$")
 #include <balm_metricrecord.h>
 #include <balm_metricsample.h>
 #include <balm_metricid.h>
+#include <balm_quantilerecord.h>
 
 #include <bsls_timeinterval.h>
 #include <bsls_assert.h>
@@ -172,6 +173,29 @@ void publishRecord(bsl::ostream&             stream,
     stream << " ]\n";
 }
 
+void publishQuantileRecord(bsl::ostream&               stream,
+                           const balm::QuantileRecord& record)
+    // Publish, to the specified 'stream', the specified 'record'.
+{
+    const balm::MetricRecord& metricRecord = record.record();
+
+    stream << "\t\t" << metricRecord.metricId() << "[ "
+           << "count = " << metricRecord.count()
+           << ", total = " << metricRecord.total();
+    if (0 < metricRecord.count()) {
+        stream << ", min = " << metricRecord.min()
+               << ", max = " << metricRecord.max();
+    }
+    else {
+        stream << ", min = undefined, max = undefined";
+    }
+    for (int i = 0; i < record.numQuantiles(); ++i) {
+        stream << ", p" << record.quantile(i) * 100
+               << " = " << record.value(i);
+    }
+    stream << " ]\n";
+}
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -187,9 +211,12 @@ StreamPublisher::~StreamPublisher()
 // MANIPULATORS
 void StreamPublisher::publish(const MetricSample& metricValues)
 {
-    if (metricValues.numRecords() > 0) {
+    const int numRecords = metricValues.numRecords()
+                         + metricValues.numQuantileRecords();
+
+    if (numRecords > 0) {
         d_stream << metricValues.timeStamp() << " "
-                 << metricValues.numRecords() << " Records" << bsl::endl;
+                 << numRecords << " Records" << bsl::endl;
 
         MetricSample::const_iterator gIt = metricValues.begin();
         MetricSample::const_iterator prev = gIt;
@@ -205,6 +232,9 @@ void StreamPublisher::publish(const MetricSample& metricValues)
             for (; rIt != gIt->end(); ++rIt) {
                 publishRecord(d_stream, *rIt, elapsedTime);
             }
+            for (int i = 0; i < gIt->numQuantileRecords(); ++i) {
+                publishQuantileRecord(d_stream, gIt->quantileRecords()[i]);
+            }
             prev = gIt;
         }
     }
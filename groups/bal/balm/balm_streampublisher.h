@@ -35,6 +35,15 @@ BSLS_IDENT("$Id: $")
 // This implementation of the publisher protocol publishes records to an output
 // stream that is supplied at construction.
 //
+// Quantile records in a published sample (see 'balm_histogramcollector') are
+// written after the metric records of their group, with each quantile
+// labeled as a percentile, for example:
+//..
+//         MyCategory.Latency [ count = 100, total = 5050, min = 1, max = 100,
+//                              p50 = 50, p99 = 98.5 ]
+//..
+// (the quantile record is shown here on two lines, but is written on one).
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
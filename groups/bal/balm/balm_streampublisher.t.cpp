@@ -11,6 +11,7 @@
 
 #include <balm_metricsample.h>
 #include <balm_metricformat.h>
+#include <balm_quantilerecord.h>
 
 #include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
@@ -24,6 +25,7 @@
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_string.h>
 
 #include <bslim_testutil.h>
 
@@ -39,8 +41,12 @@ using bsl::flush;
 //                                 Overview
 //                                 --------
 // ----------------------------------------------------------------------------
+// MANIPULATORS
+// [ 2] void publish(const balm::MetricSample& );
 // ----------------------------------------------------------------------------
-// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] TESTING: publishing quantile records
+// [ 3] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -48,6 +54,28 @@ using bsl::flush;
 
 static int testStatus = 0;
 
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -70,7 +98,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -138,6 +166,101 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING: publishing quantile records
+        //
+        // Concerns:
+        //: 1 The quantile records of each group are written after the metric
+        //:   records of the group, with each quantile labeled as a
+        //:   percentile.
+        //:
+        //: 2 The number of records reported for a sample includes the
+        //:   quantile records.
+        //:
+        //: 3 A sample holding only quantile records is published.
+        //:
+        //: 4 The minimum and maximum of an empty quantile record are written
+        //:   as undefined.
+        //
+        // Plan:
+        //: 1 Publish, to a string stream, samples holding metric records and
+        //:   quantile records, and compare the output to the expected
+        //:   output.  (C-1..4)
+        //
+        // Testing:
+        //   void publish(const balm::MetricSample& );
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: publishing quantile records" << endl
+                          << "====================================" << endl;
+
+        balm::Category          myCategory("MyCategory");
+        balm::MetricDescription descA(&myCategory, "A");
+        balm::MetricDescription descL(&myCategory, "Latency");
+        balm::MetricId          metricA(&descA);
+        balm::MetricId          latency(&descL);
+
+        bdlt::DatetimeTz now(bdlt::CurrentTime::utc(), 0);
+
+        bsl::ostringstream timeStamp;
+        timeStamp << now;
+
+        balm::MetricRecord   record(metricA, 2, 10, 4, 6);
+        balm::QuantileRecord quantiles[2];
+
+        quantiles[0].record() = balm::MetricRecord(latency, 3, 60, 10, 30);
+        quantiles[0].appendQuantile(0.5,  20);
+        quantiles[0].appendQuantile(0.99, 30);
+        quantiles[1].record() = balm::MetricRecord(latency);
+        quantiles[1].appendQuantile(0.5,  0);
+
+        const bsl::string LINE_A   = "\t\tMyCategory.A[ count = 2, total = 10,"
+                                     " min = 4, max = 6 ]\n";
+        const bsl::string LINE_Q0  = "\t\tMyCategory.Latency[ count = 3,"
+                                     " total = 60, min = 10, max = 30,"
+                                     " p50 = 20, p99 = 30 ]\n";
+        const bsl::string LINE_Q1  = "\t\tMyCategory.Latency[ count = 0,"
+                                     " total = 0, min = undefined,"
+                                     " max = undefined, p50 = 0 ]\n";
+        {
+            balm::MetricSampleGroup group(&record, 1, bsls::TimeInterval(2));
+            group.setQuantileRecords(quantiles, 2);
+
+            balm::MetricSample sample;
+            sample.setTimeStamp(now);
+            sample.appendGroup(group);
+
+            bsl::ostringstream os;
+            Obj                mX(os);
+            mX.publish(sample);
+
+            const bsl::string EXP = timeStamp.str() + " 3 Records\n"
+                                  + "\tElapsed Time: 2s\n"
+                                  + LINE_A + LINE_Q0 + LINE_Q1;
+
+            ASSERTV(os.str(), EXP, EXP == os.str());
+        }
+        {
+            balm::MetricSampleGroup group(0, 0, bsls::TimeInterval(2));
+            group.setQuantileRecords(quantiles, 1);
+
+            balm::MetricSample sample;
+            sample.setTimeStamp(now);
+            sample.appendGroup(group);
+
+            bsl::ostringstream os;
+            Obj                mX(os);
+            mX.publish(sample);
+
+            const bsl::string EXP = timeStamp.str() + " 1 Records\n"
+                                  + "\tElapsed Time: 2s\n"
+                                  + LINE_Q0;
+
+            ASSERTV(os.str(), EXP, EXP == os.str());
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST:
@@ -0,0 +1,73 @@
+// balm_stripedaccumulator.cpp                                        -*-C++-*-
+#include <balm_stripedaccumulator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_stripedaccumulator_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace {
+
+bsls::AtomicInt g_nextStripeIndex(0);
+    // Index of the stripe to be assigned to the next thread.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_threadStripeIndex, -1);
+    // Index of the stripe assigned to the calling thread, or -1 if the
+    // calling thread has not yet been assigned a stripe.
+#endif
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                        // -----------------------------
+                        // struct StripedAccumulatorUtil
+                        // -----------------------------
+
+// CLASS METHODS
+int StripedAccumulatorUtil::stripeIndex()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (0 > g_threadStripeIndex) {
+        g_threadStripeIndex = static_cast<unsigned int>(
+                                        g_nextStripeIndex.addRelaxed(1) - 1)
+                            % k_NUM_STRIPES;
+    }
+    return g_threadStripeIndex;
+#else
+    // Without compiler-supported thread-local storage, derive the stripe from
+    // the thread id.  Distinct threads may then share a stripe even when
+    // there are fewer threads than stripes, which costs only contention.
+
+    bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    id ^= id >> 32;
+    id ^= id >> 16;
+    id ^= id >> 8;
+    return static_cast<int>(id % k_NUM_STRIPES);
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,452 @@
+// balm_stripedaccumulator.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_STRIPEDACCUMULATOR
+#define INCLUDED_BALM_STRIPEDACCUMULATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a count/total/min/max accumulator striped across threads.
+//
+//@CLASSES:
+//  balm::StripedAccumulator: count, total, min, and max striped by thread
+//  balm::StripedAccumulatorUtil: assignment of threads to stripes
+//
+//@SEE_ALSO: balm_collector, balm_integercollector
+//
+//@DESCRIPTION: This component provides a class template,
+// 'balm::StripedAccumulator', that aggregates the count, total, minimum, and
+// maximum of a series of values, and that can be updated from many threads
+// simultaneously without the updating threads contending with one another.
+// The accumulator is the storage underlying 'balm::Collector' and
+// 'balm::IntegerCollector'.
+//
+// The aggregate is divided into 'k_NUM_STRIPES' *stripes*, each occupying its
+// own cache line and guarded by its own spin lock.  The stripes are aligned to
+// cache-line boundaries within the accumulator, whatever the alignment of the
+// accumulator itself, so no stripe shares a cache line with another stripe
+// or with the data of any neighboring object.  Each thread is assigned a
+// stripe, by 'balm::StripedAccumulatorUtil::stripeIndex', the first time it
+// updates any accumulator, and it updates only that stripe thereafter.  So
+// long as there are no more updating threads than stripes, an update acquires
+// a spin lock that no other thread is holding, and touches a cache line that
+// no other thread is writing, which is far cheaper than acquiring a shared
+// mutex.  Operations that read or reset the aggregate ('load', 'loadAndReset',
+// 'reset', and 'setCountTotalMinMax') acquire the locks of all stripes (in
+// order) and merge them, so they remain atomic with respect to concurrent
+// updates, but they are correspondingly more expensive; these operations are
+// expected to be invoked only when metrics are published.
+//
+// Note that the total of a floating-point accumulator is summed per stripe
+// before the stripes are summed, so the total of values supplied from several
+// threads may differ, in its least significant bits, from the total obtained
+// by summing the same values in order.  Values supplied from a single thread
+// are summed in order.
+//
+///Thread Safety
+///-------------
+// 'balm::StripedAccumulator' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Accumulating Values from Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to record the latency, in microseconds, of requests handled
+// by a pool of threads.  We create an accumulator whose minimum and maximum
+// are initially 'INT_MAX' and 'INT_MIN' respectively:
+//..
+//  balm::StripedAccumulator<int, bsls::Types::Int64> latency(INT_MAX,
+//                                                            INT_MIN);
+//..
+// Then, each thread handling requests updates the accumulator:
+//..
+//  latency.update(120);
+//  latency.update(80);
+//  latency.update(100);
+//..
+// Finally, a publishing thread loads the aggregate and resets the
+// accumulator:
+//..
+//  int                count;
+//  bsls::Types::Int64 total;
+//  int                min;
+//  int                max;
+//  latency.loadAndReset(&count, &total, &min, &max);
+//
+//  assert(  3 == count);
+//  assert(300 == total);
+//  assert( 80 == min);
+//  assert(120 == max);
+//
+//  latency.load(&count, &total, &min, &max);
+//
+//  assert(      0 == count);
+//  assert(      0 == total);
+//  assert(INT_MAX == min);
+//  assert(INT_MIN == max);
+//..
+
+#include <balscm_version.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                        // =============================
+                        // struct StripedAccumulatorUtil
+                        // =============================
+
+struct StripedAccumulatorUtil {
+    // This 'struct' provides a namespace for the assignment of threads to the
+    // stripes of a 'StripedAccumulator'.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_NUM_STRIPES = 8,     // number of stripes in an accumulator
+
+        k_STRIPE_SIZE = 64     // size and alignment, in bytes, of a stripe
+                               // (the size of a cache line on supported
+                               // platforms)
+    };
+
+    // CLASS METHODS
+    static int stripeIndex();
+        // Return the index, in the range '[0 .. k_NUM_STRIPES)', of the
+        // stripe assigned to the calling thread.  Successive threads calling
+        // this function are assigned successive stripes, so that the first
+        // 'k_NUM_STRIPES' threads are assigned distinct stripes.  A thread is
+        // always assigned the same stripe.
+};
+
+                          // ========================
+                          // class StripedAccumulator
+                          // ========================
+
+template <class VALUE, class TOTAL>
+class StripedAccumulator {
+    // This class provides a mechanism for aggregating the count, total,
+    // minimum, and maximum of a series of values of the (template parameter)
+    // type 'VALUE', whose total is accumulated in the (template parameter)
+    // type 'TOTAL'.  The aggregate is divided into stripes updated by
+    // different threads, and merged when read.  'VALUE' and 'TOTAL' must be
+    // arithmetic types.
+
+    // PRIVATE TYPES
+    struct StripeData {
+        // Aggregate of the values supplied by the threads assigned to a
+        // stripe.
+
+        bsls::SpinLock d_lock;   // guards the data below
+        int            d_count;  // number of values
+        TOTAL          d_total;  // total of values
+        VALUE          d_min;    // minimum value
+        VALUE          d_max;    // maximum value
+    };
+
+    BSLMF_ASSERT(sizeof(StripeData) <=
+                                   StripedAccumulatorUtil::k_STRIPE_SIZE);
+
+    struct Stripe : StripeData {
+        // Aggregate of the values supplied by the threads assigned to a
+        // stripe, padded so that adjacent stripes do not share a cache line.
+
+        char d_padding[StripedAccumulatorUtil::k_STRIPE_SIZE -
+                                                          sizeof(StripeData)];
+    };
+
+    BSLMF_ASSERT(sizeof(Stripe) == StripedAccumulatorUtil::k_STRIPE_SIZE);
+
+    enum {
+        // The stripes are placed in a buffer having room for one more stripe,
+        // at the first address in the buffer aligned to 'k_STRIPE_SIZE'.
+
+        k_BUFFER_SIZE = (StripedAccumulatorUtil::k_NUM_STRIPES + 1) *
+                                          StripedAccumulatorUtil::k_STRIPE_SIZE
+    };
+
+    // DATA
+    bsls::AlignedBuffer<k_BUFFER_SIZE>
+                   d_buffer;                  // storage for the stripes
+
+    Stripe        *d_stripes_p;               // per-thread aggregates,
+                                              // aligned to 'k_STRIPE_SIZE'
+                                              // in 'd_buffer'
+
+    VALUE          d_defaultMin;              // minimum of no values
+
+    VALUE          d_defaultMax;              // maximum of no values
+
+    // NOT IMPLEMENTED
+    StripedAccumulator(const StripedAccumulator&);
+    StripedAccumulator& operator=(const StripedAccumulator&);
+
+    // PRIVATE MANIPULATORS
+    void lockAll() const;
+        // Acquire the locks of all stripes of this accumulator, in order.
+
+    void resetAll();
+        // Reset the aggregate of every stripe of this accumulator to its
+        // default state.  The behavior is undefined unless the calling thread
+        // holds the locks of all stripes.
+
+    void unlockAll() const;
+        // Release the locks of all stripes of this accumulator.  The behavior
+        // is undefined unless the calling thread holds the locks of all
+        // stripes.
+
+    // PRIVATE ACCESSORS
+    void merge(int *count, TOTAL *total, VALUE *min, VALUE *max) const;
+        // Load into the specified 'count', 'total', 'min', and 'max' the
+        // merged aggregate of all stripes of this accumulator.  The behavior
+        // is undefined unless the calling thread holds the locks of all
+        // stripes.
+
+  public:
+    // CREATORS
+    StripedAccumulator(VALUE defaultMin, VALUE defaultMax);
+        // Create an accumulator having a count of 0, a total of 0, and the
+        // specified 'defaultMin' and 'defaultMax' as its minimum and maximum.
+        // 'defaultMin' and 'defaultMax' are also the minimum and maximum of
+        // this accumulator after it is reset.
+
+    //! ~StripedAccumulator() = default;
+        // Destroy this object.  Note that the stripes are trivially
+        // destructible, so they need not be destroyed explicitly.
+
+    // MANIPULATORS
+    void accumulateCountTotalMinMax(int   count,
+                                    TOTAL total,
+                                    VALUE min,
+                                    VALUE max);
+        // Add the specified 'count' to the count of this accumulator, add the
+        // specified 'total' to its total, set its minimum to the lesser of its
+        // minimum and the specified 'min', and set its maximum to the greater
+        // of its maximum and the specified 'max'.
+
+    void loadAndReset(int *count, TOTAL *total, VALUE *min, VALUE *max);
+        // Load into the specified 'count', 'total', 'min', and 'max' the
+        // count, total, minimum, and maximum of this accumulator, then reset
+        // this accumulator to its default state, as a single atomic
+        // operation.
+
+    void reset();
+        // Reset the count and total of this accumulator to 0, and its minimum
+        // and maximum to the default values supplied at construction.
+
+    void setCountTotalMinMax(int count, TOTAL total, VALUE min, VALUE max);
+        // Set the count, total, minimum, and maximum of this accumulator to
+        // the specified 'count', 'total', 'min', and 'max' respectively.
+
+    void update(VALUE value);
+        // Increment the count of this accumulator by 1, add the specified
+        // 'value' to its total, set its minimum to the lesser of its minimum
+        // and 'value', and set its maximum to the greater of its maximum and
+        // 'value'.
+
+    // ACCESSORS
+    void load(int *count, TOTAL *total, VALUE *min, VALUE *max) const;
+        // Load into the specified 'count', 'total', 'min', and 'max' the
+        // count, total, minimum, and maximum of this accumulator.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class StripedAccumulator
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::lockAll() const
+{
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].d_lock.lock();
+    }
+}
+
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::resetAll()
+{
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        StripeData& stripe = d_stripes_p[i];
+
+        stripe.d_count = 0;
+        stripe.d_total = 0;
+        stripe.d_min   = d_defaultMin;
+        stripe.d_max   = d_defaultMax;
+    }
+}
+
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::unlockAll() const
+{
+    for (int i = StripedAccumulatorUtil::k_NUM_STRIPES - 1; 0 <= i; --i) {
+        d_stripes_p[i].d_lock.unlock();
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::merge(int   *count,
+                                             TOTAL *total,
+                                             VALUE *min,
+                                             VALUE *max) const
+{
+    *count = 0;
+    *total = 0;
+    *min   = d_defaultMin;
+    *max   = d_defaultMax;
+
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        const StripeData& stripe = d_stripes_p[i];
+
+        *count += stripe.d_count;
+        *total += stripe.d_total;
+        *min   =  bsl::min(*min, stripe.d_min);
+        *max   =  bsl::max(*max, stripe.d_max);
+    }
+}
+
+// CREATORS
+template <class VALUE, class TOTAL>
+StripedAccumulator<VALUE, TOTAL>::StripedAccumulator(VALUE defaultMin,
+                                                     VALUE defaultMax)
+: d_stripes_p(0)
+, d_defaultMin(defaultMin)
+, d_defaultMax(defaultMax)
+{
+    char *buffer = d_buffer.buffer();
+    buffer += bsls::AlignmentUtil::calculateAlignmentOffset(
+                                        buffer,
+                                        StripedAccumulatorUtil::k_STRIPE_SIZE);
+
+    d_stripes_p = reinterpret_cast<Stripe *>(buffer);
+
+    // Value-initializing each stripe leaves its spin lock unlocked.
+
+    for (int i = 0; i < StripedAccumulatorUtil::k_NUM_STRIPES; ++i) {
+        ::new (static_cast<void *>(d_stripes_p + i)) Stripe();
+
+        BSLS_ASSERT(0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                      d_stripes_p + i,
+                                      StripedAccumulatorUtil::k_STRIPE_SIZE));
+    }
+
+    resetAll();
+}
+
+// MANIPULATORS
+template <class VALUE, class TOTAL>
+inline
+void StripedAccumulator<VALUE, TOTAL>::accumulateCountTotalMinMax(int   count,
+                                                                  TOTAL total,
+                                                                  VALUE min,
+                                                                  VALUE max)
+{
+    StripeData& stripe = d_stripes_p[StripedAccumulatorUtil::stripeIndex()];
+
+    bsls::SpinLockGuard guard(&stripe.d_lock);
+    stripe.d_count += count;
+    stripe.d_total += total;
+    stripe.d_min   =  bsl::min(stripe.d_min, min);
+    stripe.d_max   =  bsl::max(stripe.d_max, max);
+}
+
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::loadAndReset(int   *count,
+                                                    TOTAL *total,
+                                                    VALUE *min,
+                                                    VALUE *max)
+{
+    lockAll();
+    merge(count, total, min, max);
+    resetAll();
+    unlockAll();
+}
+
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::reset()
+{
+    lockAll();
+    resetAll();
+    unlockAll();
+}
+
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::setCountTotalMinMax(int   count,
+                                                           TOTAL total,
+                                                           VALUE min,
+                                                           VALUE max)
+{
+    lockAll();
+    resetAll();
+
+    StripeData& stripe = d_stripes_p[0];
+
+    stripe.d_count = count;
+    stripe.d_total = total;
+    stripe.d_min   = min;
+    stripe.d_max   = max;
+
+    unlockAll();
+}
+
+template <class VALUE, class TOTAL>
+inline
+void StripedAccumulator<VALUE, TOTAL>::update(VALUE value)
+{
+    StripeData& stripe = d_stripes_p[StripedAccumulatorUtil::stripeIndex()];
+
+    bsls::SpinLockGuard guard(&stripe.d_lock);
+    ++stripe.d_count;
+    stripe.d_total += value;
+    stripe.d_min   =  bsl::min(stripe.d_min, value);
+    stripe.d_max   =  bsl::max(stripe.d_max, value);
+}
+
+// ACCESSORS
+template <class VALUE, class TOTAL>
+void StripedAccumulator<VALUE, TOTAL>::load(int   *count,
+                                            TOTAL *total,
+                                            VALUE *min,
+                                            VALUE *max) const
+{
+    lockAll();
+    merge(count, total, min, max);
+    unlockAll();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,930 @@
+// balm_stripedaccumulator.t.cpp                                      -*-C++-*-
+#include <balm_stripedaccumulator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::StripedAccumulator' is a mechanism aggregating the count, total,
+// minimum, and maximum of values supplied by many threads, each thread
+// updating its own stripe.  We first verify that
+// 'balm::StripedAccumulatorUtil::stripeIndex' assigns distinct stripes to
+// successive threads, then verify the value-semantic behavior of each method
+// of the accumulator from a single thread, then verify that the stripes
+// updated by several threads are merged correctly, and finally verify that
+// reading and resetting the accumulator is atomic with respect to concurrent
+// updates.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int StripedAccumulatorUtil::stripeIndex();
+//
+// CREATORS
+// [ 3] StripedAccumulator(VALUE defaultMin, VALUE defaultMax);
+//
+// MANIPULATORS
+// [ 3] void accumulateCountTotalMinMax(int, TOTAL, VALUE, VALUE);
+// [ 3] void loadAndReset(int *, TOTAL *, VALUE *, VALUE *);
+// [ 3] void reset();
+// [ 3] void setCountTotalMinMax(int, TOTAL, VALUE, VALUE);
+// [ 3] void update(VALUE value);
+//
+// ACCESSORS
+// [ 3] void load(int *, TOTAL *, VALUE *, VALUE *) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] MERGING STRIPES
+// [ 5] CONCURRENCY
+// [ 6] STRIPE PLACEMENT
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'update' VERSUS A MUTEX
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::StripedAccumulator<int, bsls::Types::Int64> Obj;
+typedef balm::StripedAccumulator<double, double>          DObj;
+typedef balm::StripedAccumulatorUtil                      Util;
+typedef bsls::Types::Int64                                Int64;
+
+const int NUM_STRIPES = Util::k_NUM_STRIPES;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct StripeIndexJob {
+    // Load, into the element of a vector at a given index, the stripe index
+    // of the thread invoking this job.
+
+    bsl::vector<int> *d_indices_p;
+    int               d_index;
+
+    void operator()() const
+    {
+        (*d_indices_p)[d_index] = Util::stripeIndex();
+        ASSERT((*d_indices_p)[d_index] == Util::stripeIndex());
+    }
+};
+
+struct UpdateJob {
+    // Update an accumulator with the values in a range.
+
+    Obj *d_obj_p;
+    int  d_begin;
+    int  d_end;
+
+    void operator()() const
+    {
+        for (int i = d_begin; i < d_end; ++i) {
+            d_obj_p->update(i);
+        }
+    }
+};
+
+struct ConcurrentUpdateJob {
+    // Wait on a barrier, then update an accumulator with the value 1 a given
+    // number of times, and then with the values 'd_value' and '-d_value'
+    // (whose total is given as 2, so that every total equals its count).
+
+    Obj             *d_obj_p;
+    bslmt::Barrier  *d_barrier_p;
+    int              d_numUpdates;
+    int              d_value;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numUpdates; ++i) {
+            d_obj_p->update(1);
+        }
+        d_obj_p->accumulateCountTotalMinMax(2, 2, -d_value, d_value);
+    }
+};
+
+struct MutexAccumulator {
+    // Count, total, minimum, and maximum guarded by a single mutex, as in
+    // 'balm::IntegerCollector' before it used 'balm::StripedAccumulator'.
+
+    bslmt::Mutex d_mutex;
+    int          d_count;
+    Int64        d_total;
+    int          d_min;
+    int          d_max;
+
+    MutexAccumulator()
+    : d_count(0)
+    , d_total(0)
+    , d_min(INT_MAX)
+    , d_max(INT_MIN)
+    {
+    }
+
+    void update(int value)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        ++d_count;
+        d_total += value;
+        d_min = bsl::min(d_min, value);
+        d_max = bsl::max(d_max, value);
+    }
+};
+
+template <class ACCUMULATOR>
+struct BenchmarkJob {
+    // Wait on a barrier, then update an accumulator a given number of times.
+
+    ACCUMULATOR    *d_obj_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_numUpdates;
+
+    void operator()() const
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < d_numUpdates; ++i) {
+            d_obj_p->update(i);
+        }
+    }
+};
+
+template <class ACCUMULATOR>
+double benchmark(ACCUMULATOR *obj, int numThreads, int numUpdates)
+    // Return the elapsed time, in seconds, for the specified 'numThreads'
+    // threads to each update the specified 'obj' the specified 'numUpdates'
+    // times.
+{
+    bslmt::Barrier                         barrier(numThreads + 1);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    BenchmarkJob<ACCUMULATOR> job = { obj, &barrier, numUpdates };
+
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], job));
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Accumulating Values from Several Threads
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to record the latency, in microseconds, of requests handled
+// by a pool of threads.  We create an accumulator whose minimum and maximum
+// are initially 'INT_MAX' and 'INT_MIN' respectively:
+//..
+    balm::StripedAccumulator<int, bsls::Types::Int64> latency(INT_MAX,
+                                                              INT_MIN);
+//..
+// Then, each thread handling requests updates the accumulator:
+//..
+    latency.update(120);
+    latency.update(80);
+    latency.update(100);
+//..
+// Finally, a publishing thread loads the aggregate and resets the
+// accumulator:
+//..
+    int                count;
+    bsls::Types::Int64 total;
+    int                min;
+    int                max;
+    latency.loadAndReset(&count, &total, &min, &max);
+
+    ASSERT(  3 == count);
+    ASSERT(300 == total);
+    ASSERT( 80 == min);
+    ASSERT(120 == max);
+
+    latency.load(&count, &total, &min, &max);
+
+    ASSERT(      0 == count);
+    ASSERT(      0 == total);
+    ASSERT(INT_MAX == min);
+    ASSERT(INT_MIN == max);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // STRIPE PLACEMENT
+        //
+        // Concerns:
+        //: 1 The stripes are aligned to 'k_STRIPE_SIZE' (which is checked by
+        //:   an assertion in the constructor) whatever the alignment of the
+        //:   accumulator itself.
+        //:
+        //: 2 The stripes lie entirely within the footprint of the
+        //:   accumulator, so that updating them does not overwrite adjacent
+        //:   memory.
+        //:
+        //: 3 The accumulator behaves correctly at every alignment.
+        //
+        // Plan:
+        //: 1 For every offset, from a cache-line boundary, at which an
+        //:   accumulator may be constructed, construct an accumulator at that
+        //:   offset in a buffer filled with a known byte value, so that the
+        //:   constructor asserts that its stripes are aligned.  (C-1)
+        //:
+        //: 2 Update, reset, and set the accumulator, all of which write to its
+        //:   stripes, and verify that the bytes of the buffer outside the
+        //:   footprint of the accumulator are unchanged.  (C-2)
+        //:
+        //: 3 Verify the values loaded from the accumulator.  (C-3)
+        //
+        // Testing:
+        //   STRIPE PLACEMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STRIPE PLACEMENT" << endl
+                          << "================" << endl;
+
+        const int  k_LINE_SIZE = Util::k_STRIPE_SIZE;
+        const int  k_ALIGNMENT = bsls::AlignmentFromType<Obj>::VALUE;
+        const char k_FILL      = static_cast<char>(0xA5);
+
+        bsls::AlignedBuffer<sizeof(Obj) + 3 * Util::k_STRIPE_SIZE> storage;
+
+        char *line = storage.buffer();
+        line += bsls::AlignmentUtil::calculateAlignmentOffset(line,
+                                                              k_LINE_SIZE);
+
+        for (int offset = 0; offset < k_LINE_SIZE; offset += k_ALIGNMENT) {
+            if (veryVerbose) { T_ P(offset) }
+
+            bsl::memset(storage.buffer(), k_FILL, sizeof storage);
+
+            char *address = line + offset;
+            Obj  *mX      = ::new (static_cast<void *>(address))
+                                                         Obj(INT_MAX, INT_MIN);
+
+            mX->update(5);
+            mX->update(-3);
+            mX->accumulateCountTotalMinMax(2, 10, 4, 6);
+
+            int   count;
+            Int64 total;
+            int   min;
+            int   max;
+            mX->load(&count, &total, &min, &max);
+
+            ASSERTV(offset, count, 4  == count);
+            ASSERTV(offset, total, 12 == total);
+            ASSERTV(offset, min,   -3 == min);
+            ASSERTV(offset, max,   6  == max);
+
+            mX->reset();
+            mX->setCountTotalMinMax(1, 7, 7, 7);
+            mX->loadAndReset(&count, &total, &min, &max);
+
+            ASSERTV(offset, count, 1 == count);
+            ASSERTV(offset, total, 7 == total);
+            ASSERTV(offset, min,   7 == min);
+            ASSERTV(offset, max,   7 == max);
+
+            mX->~Obj();
+
+            for (char *p = storage.buffer(); p < address; ++p) {
+                ASSERTV(offset, p - address, k_FILL == *p);
+            }
+            for (char *p = address + sizeof(Obj);
+                 p < storage.buffer() + sizeof storage;
+                 ++p) {
+                ASSERTV(offset, p - address, k_FILL == *p);
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Updates made concurrently from several threads are neither lost
+        //:   nor counted twice.
+        //:
+        //: 2 'load' and 'loadAndReset' observe each update either entirely
+        //:   or not at all, even while updates are made concurrently.
+        //
+        // Plan:
+        //: 1 Start a number of threads, exceeding the number of stripes, that
+        //:   each update an accumulator with the value 1 many times, while
+        //:   the main thread repeatedly invokes 'loadAndReset' and 'load'.
+        //:   Verify that every loaded total equals the loaded count.  (C-2)
+        //:
+        //: 2 Verify that the sum of the loaded counts equals the number of
+        //:   updates, and that the extreme minimum and maximum were
+        //:   observed.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const int NUM_THREADS = NUM_STRIPES + 3;
+        const int NUM_UPDATES = 20000;
+
+        Obj mX(INT_MAX, INT_MIN);  const Obj& X = mX;
+
+        bslmt::Barrier                         barrier(NUM_THREADS + 1);
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS);
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ConcurrentUpdateJob job = { &mX, &barrier, NUM_UPDATES, i + 1 };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], job));
+        }
+        barrier.wait();
+
+        Int64 sumCount = 0;
+        int   minMin   = INT_MAX;
+        int   maxMax   = INT_MIN;
+
+        for (int i = 0; i < 2000; ++i) {
+            int   count;
+            Int64 total;
+            int   min;
+            int   max;
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(i, count, total, count == total);
+
+            mX.loadAndReset(&count, &total, &min, &max);
+            ASSERTV(i, count, total, count == total);
+
+            sumCount += count;
+            minMin    = bsl::min(minMin, min);
+            maxMax    = bsl::max(maxMax, max);
+        }
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        int   count;
+        Int64 total;
+        int   min;
+        int   max;
+        mX.loadAndReset(&count, &total, &min, &max);
+
+        sumCount += count;
+        minMin    = bsl::min(minMin, min);
+        maxMax    = bsl::max(maxMax, max);
+
+        const Int64 EXP_COUNT = static_cast<Int64>(NUM_THREADS) *
+                                                          (NUM_UPDATES + 2);
+
+        ASSERTV(EXP_COUNT, sumCount, EXP_COUNT == sumCount);
+        ASSERTV(minMin, -NUM_THREADS == minMin);
+        ASSERTV(maxMax,  NUM_THREADS == maxMax);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MERGING STRIPES
+        //
+        // Concerns:
+        //: 1 Values supplied by threads assigned different stripes are merged
+        //:   into a single count, total, minimum, and maximum.
+        //:
+        //: 2 'reset', 'loadAndReset', and 'setCountTotalMinMax' reset every
+        //:   stripe, not only the stripe of the calling thread.
+        //
+        // Plan:
+        //: 1 Create more threads than stripes, one after another, each
+        //:   updating the accumulator with a distinct range of values, and
+        //:   verify the loaded aggregate.  (C-1)
+        //:
+        //: 2 Repeat P-1, then invoke each resetting method and verify the
+        //:   loaded aggregate.  (C-2)
+        //
+        // Testing:
+        //   MERGING STRIPES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MERGING STRIPES" << endl
+                          << "===============" << endl;
+
+        const int NUM_THREADS = NUM_STRIPES + 2;
+        const int RANGE       = 100;
+
+        for (int method = 0; method < 4; ++method) {
+            Obj mX(INT_MAX, INT_MIN);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::Handle handle;
+                UpdateJob job = { &mX, i * RANGE, (i + 1) * RANGE };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, job));
+                bslmt::ThreadUtil::join(handle);
+            }
+
+            const int   N         = NUM_THREADS * RANGE;
+            const Int64 EXP_TOTAL = static_cast<Int64>(N) * (N - 1) / 2;
+
+            int   count;
+            Int64 total;
+            int   min;
+            int   max;
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(method, count, N         == count);
+            ASSERTV(method, total, EXP_TOTAL == total);
+            ASSERTV(method, min,   0         == min);
+            ASSERTV(method, max,   N - 1     == max);
+
+            int expCount = 0;
+            int expMin   = INT_MAX;
+            int expMax   = INT_MIN;
+
+            switch (method) {
+              case 0: {
+                mX.reset();
+              } break;
+              case 1: {
+                mX.loadAndReset(&count, &total, &min, &max);
+                ASSERTV(method, N == count);
+              } break;
+              case 2: {
+                mX.setCountTotalMinMax(3, 4, 5, 6);
+                expCount = 3;
+                expMin   = 5;
+                expMax   = 6;
+              } break;
+              case 3: {
+                // The stripes are not reset by 'accumulateCountTotalMinMax'.
+
+                mX.accumulateCountTotalMinMax(1, 0, -1, N);
+                expCount = N + 1;
+                expMin   = -1;
+                expMax   = N;
+              } break;
+            }
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(method, count, expCount == count);
+            ASSERTV(method, min,   expMin   == min);
+            ASSERTV(method, max,   expMax   == max);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS FROM A SINGLE THREAD
+        //
+        // Concerns:
+        //: 1 A newly created accumulator has a count and total of 0, and the
+        //:   minimum and maximum supplied at construction.
+        //:
+        //: 2 'update' and 'accumulateCountTotalMinMax' increase the count and
+        //:   total, and widen the minimum and maximum.
+        //:
+        //: 3 'load' reports the aggregate without modifying it.
+        //:
+        //: 4 'reset' and 'loadAndReset' restore the default state, and
+        //:   'loadAndReset' reports the aggregate before the reset.
+        //:
+        //: 5 'setCountTotalMinMax' replaces the aggregate.
+        //:
+        //: 6 The template works for floating-point values.
+        //
+        // Plan:
+        //: 1 For each of a table of sequences of values, update an
+        //:   accumulator with each value in turn, and verify the loaded
+        //:   aggregate after each update.  (C-1..3)
+        //:
+        //: 2 Invoke 'loadAndReset', 'reset', 'accumulateCountTotalMinMax', and
+        //:   'setCountTotalMinMax', verifying the loaded aggregate after each.
+        //:   (C-2, 4..5)
+        //:
+        //: 3 Repeat P-1 for an accumulator of 'double'.  (C-6)
+        //
+        // Testing:
+        //   StripedAccumulator(VALUE defaultMin, VALUE defaultMax);
+        //   void accumulateCountTotalMinMax(int, TOTAL, VALUE, VALUE);
+        //   void loadAndReset(int *, TOTAL *, VALUE *, VALUE *);
+        //   void reset();
+        //   void setCountTotalMinMax(int, TOTAL, VALUE, VALUE);
+        //   void update(VALUE value);
+        //   void load(int *, TOTAL *, VALUE *, VALUE *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS FROM A SINGLE THREAD" << endl
+                          << "====================================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_values[4];
+            int d_numValues;
+        } DATA[] = {
+            //LINE  VALUES                       NUM
+            //----  ---------------------------  ---
+            { L_,   {  0,  0,  0,  0          },   0 },
+            { L_,   {  5,  0,  0,  0          },   1 },
+            { L_,   { -5,  5,  0,  0          },   2 },
+            { L_,   {  3,  1,  2,  0          },   3 },
+            { L_,   { INT_MAX, INT_MIN, 0, 0  },   2 },
+            { L_,   { INT_MAX, INT_MAX, INT_MAX, INT_MAX
+                                              },   4 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const int *VALUES = DATA[ti].d_values;
+            const int  NUM    = DATA[ti].d_numValues;
+
+            if (veryVerbose) { T_ P(LINE) }
+
+            Obj mX(INT_MAX, INT_MIN);  const Obj& X = mX;
+
+            int   count;
+            Int64 total;
+            int   min;
+            int   max;
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(LINE, 0       == count);
+            ASSERTV(LINE, 0       == total);
+            ASSERTV(LINE, INT_MAX == min);
+            ASSERTV(LINE, INT_MIN == max);
+
+            Int64 expTotal = 0;
+            int   expMin   = INT_MAX;
+            int   expMax   = INT_MIN;
+
+            for (int i = 0; i < NUM; ++i) {
+                mX.update(VALUES[i]);
+
+                expTotal += VALUES[i];
+                expMin    = bsl::min(expMin, VALUES[i]);
+                expMax    = bsl::max(expMax, VALUES[i]);
+
+                X.load(&count, &total, &min, &max);
+                ASSERTV(LINE, i, i + 1    == count);
+                ASSERTV(LINE, i, expTotal == total);
+                ASSERTV(LINE, i, expMin   == min);
+                ASSERTV(LINE, i, expMax   == max);
+            }
+
+            // 'load' does not modify the aggregate.
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(LINE, NUM == count);
+
+            mX.loadAndReset(&count, &total, &min, &max);
+            ASSERTV(LINE, NUM      == count);
+            ASSERTV(LINE, expTotal == total);
+            ASSERTV(LINE, expMin   == min);
+            ASSERTV(LINE, expMax   == max);
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(LINE, 0       == count);
+            ASSERTV(LINE, 0       == total);
+            ASSERTV(LINE, INT_MAX == min);
+            ASSERTV(LINE, INT_MIN == max);
+
+            mX.accumulateCountTotalMinMax(NUM, expTotal, expMin, expMax);
+            mX.accumulateCountTotalMinMax(1, 7, 7, 7);
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(LINE, NUM + 1                == count);
+            ASSERTV(LINE, expTotal + 7           == total);
+            ASSERTV(LINE, bsl::min(expMin, 7)    == min);
+            ASSERTV(LINE, bsl::max(expMax, 7)    == max);
+
+            mX.reset();
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(LINE, 0       == count);
+            ASSERTV(LINE, 0       == total);
+            ASSERTV(LINE, INT_MAX == min);
+            ASSERTV(LINE, INT_MIN == max);
+
+            mX.update(100);
+            mX.setCountTotalMinMax(NUM, expTotal, expMin, expMax);
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(LINE, NUM      == count);
+            ASSERTV(LINE, expTotal == total);
+            ASSERTV(LINE, expMin   == min);
+            ASSERTV(LINE, expMax   == max);
+        }
+
+        if (verbose) cout << "\tFloating-point values." << endl;
+        {
+            DObj mX(1.0e300, -1.0e300);  const DObj& X = mX;
+
+            mX.update(0.5);
+            mX.update(-2.25);
+            mX.update(4.0);
+
+            int    count;
+            double total;
+            double min;
+            double max;
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(count, 3     == count);
+            ASSERTV(total, 2.25  == total);
+            ASSERTV(min,   -2.25 == min);
+            ASSERTV(max,   4.0   == max);
+
+            mX.reset();
+
+            X.load(&count, &total, &min, &max);
+            ASSERTV(count, 0        == count);
+            ASSERTV(total, 0.0      == total);
+            ASSERTV(min,   1.0e300  == min);
+            ASSERTV(max,   -1.0e300 == max);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'stripeIndex'
+        //
+        // Concerns:
+        //: 1 'stripeIndex' returns a value in '[0 .. k_NUM_STRIPES)'.
+        //:
+        //: 2 'stripeIndex' returns the same value each time it is invoked by
+        //:   a thread.
+        //:
+        //: 3 Where thread-local storage is available, the first
+        //:   'k_NUM_STRIPES' threads to invoke 'stripeIndex' are assigned
+        //:   distinct stripes.
+        //
+        // Plan:
+        //: 1 Invoke 'stripeIndex' twice from the main thread and from a
+        //:   number of threads created one after another, and verify the
+        //:   results are in range and equal for each thread.  (C-1..2)
+        //:
+        //: 2 Where thread-local storage is available, verify that the indices
+        //:   of the first 'k_NUM_STRIPES' threads (including the main thread)
+        //:   are distinct.  (C-3)
+        //
+        // Testing:
+        //   int StripedAccumulatorUtil::stripeIndex();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'stripeIndex'" << endl
+                          << "==========================" << endl;
+
+        const int NUM_THREADS = 2 * NUM_STRIPES;
+
+        bsl::vector<int> indices(NUM_THREADS, -1);
+
+        indices[0] = Util::stripeIndex();
+        ASSERT(indices[0] == Util::stripeIndex());
+
+        for (int i = 1; i < NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::Handle handle;
+            StripeIndexJob            job = { &indices, i };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, job));
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            if (veryVerbose) { T_ P_(i) P(indices[i]) }
+
+            ASSERTV(i, indices[i], 0 <= indices[i]);
+            ASSERTV(i, indices[i], NUM_STRIPES > indices[i]);
+        }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        for (int i = 0; i < NUM_STRIPES; ++i) {
+            for (int j = 0; j < i; ++j) {
+                ASSERTV(i, j, indices[i] != indices[j]);
+            }
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an accumulator, update it, and load its aggregate.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(INT_MAX, INT_MIN);  const Obj& X = mX;
+
+        mX.update(1);
+        mX.update(3);
+
+        int   count;
+        Int64 total;
+        int   min;
+        int   max;
+
+        X.load(&count, &total, &min, &max);
+        ASSERT(2 == count);
+        ASSERT(4 == total);
+        ASSERT(1 == min);
+        ASSERT(3 == max);
+
+        mX.loadAndReset(&count, &total, &min, &max);
+        ASSERT(2 == count);
+
+        X.load(&count, &total, &min, &max);
+        ASSERT(0 == count);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'update' VERSUS A MUTEX
+        //
+        // Concerns:
+        //: 1 Updating a striped accumulator from several threads is cheaper
+        //:   than updating an aggregate guarded by a single mutex.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, time the threads each updating a
+        //:   striped accumulator, and then an aggregate guarded by a mutex,
+        //:   a fixed number of times, and report the time per update.
+        //
+        // Testing:
+        //   PERFORMANCE: 'update' VERSUS A MUTEX
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'update' VERSUS A MUTEX" << endl
+             << "====================================" << endl;
+
+        const int NUM_UPDATES = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            Obj              striped(INT_MAX, INT_MIN);
+            MutexAccumulator mutex;
+
+            const double STRIPED = benchmark(&striped,
+                                             numThreads,
+                                             NUM_UPDATES);
+            const double MUTEX   = benchmark(&mutex, numThreads, NUM_UPDATES);
+
+            const double PER_UPDATE = 1.0e9 / NUM_UPDATES;
+
+            cout << "threads: " << numThreads
+                 << "\tstriped: " << STRIPED * PER_UPDATE << " ns"
+                 << "\tmutex: "   << MUTEX   * PER_UPDATE << " ns"
+                 << endl;
+        }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -16,11 +16,24 @@
 #include <bsls_assert.h>
 #include <bsls_review.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>  // getenv
 #include <bsl_cstring.h>  // memcpy
 
 namespace BloombergLP {
+namespace {
+
+inline
+bsls::Types::Int64 microsecondsSinceFirstDay(const bdlt::Datetime& datetime)
+    // Return the number of microseconds from 0001/01/01_00:00:00 to the
+    // specified 'datetime'.
+{
+    return (datetime - bdlt::Datetime(1, 1, 1)).totalMicroseconds();
+}
+
+}  // close unnamed namespace
+
 namespace baltzo {
 
                          // --------------------------
@@ -42,6 +55,18 @@ int LocalTimeOffsetUtil::configureImp(const char            *timezone,
         return retval;                                                // RETURN
     }
     privateTimezone()->assign(timezone);
+
+    const LocalTimePeriod *localTimePeriod = privateLocalTimePeriod();
+
+    s_sequenceNumber.addAcqRel(1);
+    s_utcStartTime.storeRelease(
+                  microsecondsSinceFirstDay(localTimePeriod->utcStartTime()));
+    s_utcEndTime.storeRelease(
+                    microsecondsSinceFirstDay(localTimePeriod->utcEndTime()));
+    s_utcOffsetInSeconds.storeRelease(
+                           localTimePeriod->descriptor().utcOffsetInSeconds());
+    s_sequenceNumber.addAcqRel(1);
+
     ++s_updateCount;
     return retval;
 }
@@ -67,7 +92,11 @@ bsl::string *LocalTimeOffsetUtil::privateTimezone()
 }
 
 // CLASS DATA
-bsls::AtomicInt LocalTimeOffsetUtil::s_updateCount(0);
+bsls::AtomicInt   LocalTimeOffsetUtil::s_updateCount(0);
+bsls::AtomicInt   LocalTimeOffsetUtil::s_sequenceNumber(0);
+bsls::AtomicInt64 LocalTimeOffsetUtil::s_utcStartTime(0);
+bsls::AtomicInt64 LocalTimeOffsetUtil::s_utcEndTime(0);
+bsls::AtomicInt   LocalTimeOffsetUtil::s_utcOffsetInSeconds(0);
 
 // CLASS METHODS
 
@@ -87,6 +116,25 @@ void LocalTimeOffsetUtil::loadLocalTimeOffset(
 bsls::TimeInterval LocalTimeOffsetUtil::localTimeOffset(
                                              const bdlt::Datetime& utcDatetime)
 {
+    // Try the published period first: the period read is consistent if the
+    // sequence number is even and unchanged by the read.  Note that the
+    // published range is empty until a 'configure' method succeeds.
+
+    const bsls::Types::Int64 utcTime = microsecondsSinceFirstDay(utcDatetime);
+
+    const int sequenceNumber = s_sequenceNumber.loadAcquire();
+    if (0 == (sequenceNumber & 1)) {
+        const bsls::Types::Int64 utcStartTime = s_utcStartTime.loadAcquire();
+        const bsls::Types::Int64 utcEndTime   = s_utcEndTime.loadAcquire();
+        const int                offset = s_utcOffsetInSeconds.loadAcquire();
+
+        if (sequenceNumber == s_sequenceNumber.loadAcquire()
+         && utcStartTime   <= utcTime
+         && utcTime        <  utcEndTime) {
+            return bsls::TimeInterval(offset, 0);                     // RETURN
+        }
+    }
+
     bslmt::ReadLockGuard<bslmt::RWMutex> readLockGuard(privateLock());
 
     const LocalTimePeriod *localTimePeriod = privateLocalTimePeriod();
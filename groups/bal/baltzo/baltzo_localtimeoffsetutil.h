@@ -26,6 +26,14 @@ BSLS_IDENT("$Id: $")
 // cached information might be invalidated by updates to the Zoneinfo database;
 // however, those occur are also infrequent events.
 //
+// On a cache hit, 'localTimeOffset' does not acquire any lock: the range and
+// the offset of the cached local time period are also published in atomic
+// variables guarded by a sequence number (a "seqlock"), which is odd while
+// the cached information is being updated.  'localTimeOffset' reads these
+// variables, and falls back to acquiring a lock only if the sequence number
+// was odd or changed during the read, or if 'utcDatetime' lies outside of the
+// published range.
+//
 // A successful return from one of the 'configure' methods is a prerequisite to
 // the use of most of the other functions provided here.  Most methods are
 // thread-safe.  Refer to the function-level documentation for details.
@@ -133,6 +141,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 
 #include <bsls_atomic.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace baltzo {
@@ -148,15 +157,30 @@ struct LocalTimeOffsetUtil {
 
     // CLASS DATA
   private:
-    static bsls::AtomicInt s_updateCount;
+    static bsls::AtomicInt   s_updateCount;
+
+    static bsls::AtomicInt   s_sequenceNumber;      // odd while the published
+                                                    // period is being updated
+
+    static bsls::AtomicInt64 s_utcStartTime;        // published start of the
+                                                    // period (in microseconds
+                                                    // since 0001/01/01)
+
+    static bsls::AtomicInt64 s_utcEndTime;          // published end of the
+                                                    // period (in microseconds
+                                                    // since 0001/01/01)
+
+    static bsls::AtomicInt   s_utcOffsetInSeconds;  // published offset from
+                                                    // UTC of the period
 
     // PRIVATE CLASS METHODS
     static int configureImp(const char            *timezone,
                             const bdlt::Datetime&  utcDatetime);
         // Set the local time period information used by the 'localTimeOffset'
         // method according to the specified 'timezone' at the specified
-        // 'utcDatetime'.  Return 0 on success, and a non-zero value otherwise.
-        // This method is *not* thread-safe.
+        // 'utcDatetime', and publish that information for the lock-free read
+        // path of 'localTimeOffset'.  Return 0 on success, and a non-zero
+        // value otherwise.  This method is *not* thread-safe.
 
     static LocalTimePeriod *privateLocalTimePeriod();
         // Return the address of the current local time period information.
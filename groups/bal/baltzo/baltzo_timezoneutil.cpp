@@ -9,6 +9,7 @@ BSLS_IDENT_RCSID(baltzo_timezoneutil_cpp,"$Id$ $CSID$")
 #include <baltzo_localtimeperiod.h>
 #include <baltzo_testloader.h>                // for testing
 #include <baltzo_timezoneutilimp.h>
+#include <baltzo_zoneinfo.h>
 
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -63,6 +64,33 @@ int TimeZoneUtil::convertUtcToLocalTime(
     return 0;
 }
 
+int TimeZoneUtil::convertUtcToLocalTimeByHandle(
+                                   LocalDatetime         *result,
+                                   int                    targetTimeZoneHandle,
+                                   const bdlt::Datetime&  utcTime)
+{
+    BSLS_ASSERT(result);
+
+    bdlt::DatetimeTz resultTz;
+    const int rc = convertUtcToLocalTimeByHandle(&resultTz,
+                                                 targetTimeZoneHandle,
+                                                 utcTime);
+
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    const ZoneinfoCache *cache    = DefaultZoneinfoCache::defaultCache();
+    const Zoneinfo      *timeZone =
+                      cache->lookupZoneinfoByHandle(targetTimeZoneHandle);
+    BSLS_ASSERT(timeZone);
+
+    result->setDatetimeTz(resultTz);
+    result->setTimeZoneId(timeZone->identifier());
+
+    return 0;
+}
+
 int TimeZoneUtil::convertLocalToLocalTime(
                                        LocalDatetime         *result,
                                        const char            *targetTimeZoneId,
@@ -28,6 +28,18 @@ BSLS_IDENT("$Id: $")
 // process-wide cache of time-zone information (see
 // {'baltzo_defaultzoneinfocache'}).
 //
+///Converting Using Time-Zone Handles
+///----------------------------------
+// Converting a time value using a time-zone identifier requires looking up
+// that identifier in the process-wide cache, which is guarded by a lock.
+// Clients converting many time values to the same few time zones can instead
+// obtain, using 'loadTimeZoneHandle', an integer handle for each time zone
+// once, and supply that handle to 'convertUtcToLocalTimeByHandle'.  A
+// conversion using a handle neither looks up the time-zone identifier nor
+// acquires any lock (see {'baltzo_zoneinfocache'|Time-Zone Handles}).  Note
+// that a handle is meaningful only while the default cache that returned it
+// remains installed.
+//
 ///Valid, Ambiguous, and Invalid Local-Time Values
 ///-----------------------------------------------
 // There are intervals around each daylight-saving time transition where a
@@ -490,6 +502,28 @@ struct TimeZoneUtil {
         // operation would have been outside the range of values representable
         // by the 'result' type.
 
+    static int convertUtcToLocalTimeByHandle(
+                                   LocalDatetime         *result,
+                                   int                    targetTimeZoneHandle,
+                                   const bdlt::Datetime&  utcTime);
+    static int convertUtcToLocalTimeByHandle(
+                                   bdlt::DatetimeTz      *result,
+                                   int                    targetTimeZoneHandle,
+                                   const bdlt::Datetime&  utcTime);
+        // Load, into the specified 'result', the local date-time value (in the
+        // time zone indicated by the specified 'targetTimeZoneHandle')
+        // corresponding to the specified 'utcTime', without acquiring any
+        // lock.  The offset from UTC of the time zone is rounded down to
+        // minute precision.  Return 0 on success, and a non-zero value with no
+        // effect otherwise.  A return value of 'ErrorCode::k_UNSUPPORTED_ID'
+        // indicates that 'targetTimeZoneHandle' was not recognized, and a
+        // return value of 'ErrorCode::k_OUT_OF_RANGE' indicates that the
+        // result of the operation would have been outside the range of values
+        // representable by the 'result' type.  The behavior is undefined
+        // unless 'targetTimeZoneHandle' was loaded by 'loadTimeZoneHandle'
+        // while the currently installed default cache was installed, or is
+        // negative.
+
     static int convertLocalToLocalTime(LocalDatetime         *result,
                                        const char            *targetTimeZoneId,
                                        const LocalDatetime&   srcTime);
@@ -640,6 +674,16 @@ struct TimeZoneUtil {
         // otherwise.  A return value of 'ErrorCode::k_UNSUPPORTED_ID'
         // indicates that 'timeZoneId' was not recognized.
 
+    static int loadTimeZoneHandle(int *result, const char *timeZoneId);
+        // Load, into the specified 'result', the handle of the time zone
+        // indicated by the specified 'timeZoneId' in the process-wide cache
+        // of time-zone information, to be supplied to
+        // 'convertUtcToLocalTimeByHandle' (see {Converting Using Time-Zone
+        // Handles}).  Return 0 on success,
+        // and a non-zero value with no effect otherwise.  A return value of
+        // 'ErrorCode::k_UNSUPPORTED_ID' indicates that 'timeZoneId' was not
+        // recognized.
+
     static int now(bdlt::DatetimeTz *result, const char *timeZoneId);
     static int now(LocalDatetime *result, const char  *timeZoneId);
         // Load, into the specified 'result', the current local time value
@@ -702,6 +746,21 @@ int TimeZoneUtil::convertUtcToLocalTime(
                                          DefaultZoneinfoCache::defaultCache());
 }
 
+inline
+int TimeZoneUtil::convertUtcToLocalTimeByHandle(
+                                   bdlt::DatetimeTz      *result,
+                                   int                    targetTimeZoneHandle,
+                                   const bdlt::Datetime&  utcTime)
+{
+    BSLS_ASSERT(result);
+
+    return TimeZoneUtilImp::convertUtcToLocalTimeByHandle(
+                                         result,
+                                         targetTimeZoneHandle,
+                                         utcTime,
+                                         DefaultZoneinfoCache::defaultCache());
+}
+
 inline
 int TimeZoneUtil::convertLocalToLocalTime(
                                         LocalDatetime        *result,
@@ -819,6 +878,15 @@ int TimeZoneUtil::loadLocalTimePeriod(LocalTimePeriod         *result,
                                      localTime.utcDatetime());
 }
 
+inline
+int TimeZoneUtil::loadTimeZoneHandle(int *result, const char *timeZoneId)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(timeZoneId);
+
+    return DefaultZoneinfoCache::defaultCache()->getHandle(result, timeZoneId);
+}
+
 inline
 int TimeZoneUtil::now(bdlt::DatetimeTz *result, const char *timeZoneId)
 {
@@ -46,6 +46,8 @@ using namespace bsl;
 // CLASS METHODS
 // [ 6] convertUtcToLocalTime(LclDatetm *, const char *, const Datetm&);
 // [ 6] convertUtcToLocalTime(DatetmTz *, const char *, const Datetm&);
+// [12] convertUtcToLocalTimeByHandle(LclDatetm *, int, const Datetm&);
+// [12] convertUtcToLocalTimeByHandle(DatetmTz *, int, const Datetm&);
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const LclDatetm&)
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const DatetmTz&);
 // [ 8] convertLocalToLocalTime(DatetmTz *, const ch *, const LclDatetm&);
@@ -61,6 +63,7 @@ using namespace bsl;
 // [ 3] loadLocalTimePeriod(LclTmPeriod *, const LclDatetm&);
 // [ 3] loadLocalTimePeriod(LclTmPeriod *, const DatetmTz&, const ch *);
 // [ 2] loadLocalTimePeriodForUtc(LclTmPeriod *, const ch *, const Date...
+// [12] loadTimeZoneHandle(int *, const char *);
 // [ 7] addInterval(LclDatetm *, const LclDatetm&, const TimeInterval&);
 // [10] now(DatetmTz *, const ch *);
 // [10] now(LclDatetm *, const ch *);
@@ -68,7 +71,7 @@ using namespace bsl;
 // [ 9] validateLocalTime(bool * result, const DatetmTz&, const char *TZ);
 // ----------------------------------------------------------------------------
 // [11] TESTING TIME CONVERSION OUT OF RANGE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // ============================================================================
 
 // ============================================================================
@@ -920,7 +923,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&testCache);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1182,6 +1185,229 @@ int main(int argc, char *argv[])
         }
         ASSERT(0 == defaultAllocator.numBytesInUse());
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS 'loadTimeZoneHandle' AND 'convertUtcToLocalTimeBy...'
+        //
+        // Concerns:
+        //: 1 'loadTimeZoneHandle' returns the same handle for a time-zone
+        //:   identifier on every call, and different handles for different
+        //:   identifiers.
+        //:
+        //: 2 'loadTimeZoneHandle' returns 'ErrorCode::k_UNSUPPORTED_ID', with
+        //:   no effect on 'result', when given a bogus id.
+        //:
+        //: 3 'convertUtcToLocalTimeByHandle' returns the same result as
+        //:   'convertUtcToLocalTime' given the identifier of the time zone.
+        //:
+        //: 4 'convertUtcToLocalTimeByHandle' loads the identifier of the time
+        //:   zone into a 'LocalDatetime' result.
+        //:
+        //: 5 'convertUtcToLocalTimeByHandle' returns
+        //:   'ErrorCode::k_UNSUPPORTED_ID', with no effect on 'result', when
+        //:   given a handle that does not refer to a cached time zone.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Load the handles of several time zones twice, and verify that
+        //:   the handles match, and are distinct.  (C-1)
+        //:
+        //: 2 Load the handle of a time zone id that does not exist, and
+        //:   verify the returned status and that 'result' is unchanged.  (C-2)
+        //:
+        //: 3 For a table of UTC times, around and away from daylight-saving
+        //:   time transitions, and for each time zone, convert the UTC time
+        //:   using the handle of the time zone and using its identifier, and
+        //:   verify that the results are the same.  (C-3..4)
+        //:
+        //: 4 Convert a UTC time using negative handles, and a handle greater
+        //:   than any handle loaded, and verify the returned status and that
+        //:   'result' is unchanged.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid input (using the 'BSLS_ASSERTTEST_*'
+        //:   macros). (C-6)
+        //
+        // Testing:
+        //   loadTimeZoneHandle(int *, const char *);
+        //   convertUtcToLocalTimeByHandle(LclDatetm *, int, const Datetm&);
+        //   convertUtcToLocalTimeByHandle(DatetmTz *, int, const Datetm&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CLASS METHODS 'loadTimeZoneHandle' AND "
+                 << "'convertUtcToLocalTimeByHandle'" << endl
+                 << "======================================="
+                 << "===============================" << endl;
+
+        const char *TIME_ZONES[] = { NY, RY, SA, GMT, GP1, GM1 };
+        const int   NUM_TIME_ZONES = sizeof TIME_ZONES / sizeof *TIME_ZONES;
+
+        int handles[NUM_TIME_ZONES];
+
+        if (verbose) cout << "\nTesting 'loadTimeZoneHandle'." << endl;
+        {
+            for (int i = 0; i < NUM_TIME_ZONES; ++i) {
+                const char *TZ = TIME_ZONES[i];
+
+                int handle = -1;
+                ASSERTV(TZ, 0 == Obj::loadTimeZoneHandle(&handle, TZ));
+                ASSERTV(TZ, handle, 0 <= handle);
+
+                handles[i] = handle;
+
+                for (int j = 0; j < i; ++j) {
+                    ASSERTV(TZ, TIME_ZONES[j], handles[j] != handle);
+                }
+            }
+
+            for (int i = 0; i < NUM_TIME_ZONES; ++i) {
+                const char *TZ = TIME_ZONES[i];
+
+                int handle = -1;
+                ASSERTV(TZ, 0 == Obj::loadTimeZoneHandle(&handle, TZ));
+                ASSERTV(TZ, handles[i], handle, handles[i] == handle);
+            }
+
+            LogVerbosityGuard guard;
+
+            int handle = -1;
+            ASSERT(EUID == Obj::loadTimeZoneHandle(&handle, "bogusId"));
+            ASSERT(-1   == handle);
+        }
+
+        if (verbose) cout << "\nTesting 'convertUtcToLocalTimeByHandle'."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_utcTime;
+            } DATA[] = {
+                //LINE UTC TIME
+                //---- -----------------------
+                { L_,  "2010-01-01T00:00:00.000" },
+                { L_,  "2010-03-14T06:59:59.999" },
+                { L_,  "2010-03-14T07:00:00.000" },
+                { L_,  "2010-07-04T12:00:00.000" },
+                { L_,  "2010-11-07T05:59:59.999" },
+                { L_,  "2010-11-07T06:00:00.000" },
+                { L_,  "9999-12-30T00:00:00.000" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE = DATA[i].d_line;
+
+                bdlt::Datetime utcTime;
+                ASSERTV(LINE, 0 == bdlt::Iso8601Util::parse(
+                                            &utcTime,
+                                            DATA[i].d_utcTime,
+                                            bsl::strlen(DATA[i].d_utcTime)));
+
+                for (int j = 0; j < NUM_TIME_ZONES; ++j) {
+                    const char *TZ     = TIME_ZONES[j];
+                    const int   HANDLE = handles[j];
+
+                    bdlt::DatetimeTz expTz;
+                    ASSERTV(LINE, TZ, 0 == Obj::convertUtcToLocalTime(
+                                                                    &expTz,
+                                                                    TZ,
+                                                                    utcTime));
+
+                    bdlt::DatetimeTz      resultTz;
+                    baltzo::LocalDatetime resultLcl(Z);
+
+                    int rc = Obj::convertUtcToLocalTimeByHandle(&resultTz,
+                                                                HANDLE,
+                                                                utcTime);
+                    ASSERTV(LINE, TZ, rc, 0 == rc);
+
+                    rc = Obj::convertUtcToLocalTimeByHandle(&resultLcl,
+                                                            HANDLE,
+                                                            utcTime);
+                    ASSERTV(LINE, TZ, rc, 0 == rc);
+
+                    if (veryVerbose) {
+                        T_ P_(LINE) P_(TZ) P(resultTz)
+                    }
+
+                    ASSERTV(LINE, TZ, expTz, resultTz, expTz == resultTz);
+                    ASSERTV(LINE, TZ, expTz, resultLcl,
+                            expTz == resultLcl.datetimeTz());
+                    ASSERTV(LINE, TZ, resultLcl,
+                            TZ == resultLcl.timeZoneId());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting an invalid handle." << endl;
+        {
+            int maxHandle = 0;
+            for (int i = 0; i < NUM_TIME_ZONES; ++i) {
+                if (maxHandle < handles[i]) {
+                    maxHandle = handles[i];
+                }
+            }
+
+            const int INVALID_HANDLES[] = { -1000, -1, maxHandle + 1000 };
+            const int NUM_INVALID_HANDLES = sizeof  INVALID_HANDLES
+                                          / sizeof *INVALID_HANDLES;
+
+            const bdlt::DatetimeTz INITIAL(bdlt::Datetime(2000, 1, 1), 60);
+
+            for (int i = 0; i < NUM_INVALID_HANDLES; ++i) {
+                const int HANDLE = INVALID_HANDLES[i];
+
+                bdlt::DatetimeTz      resultTz(INITIAL);
+                baltzo::LocalDatetime resultLcl(INITIAL, "initial", Z);
+
+                ASSERTV(HANDLE, EUID == Obj::convertUtcToLocalTimeByHandle(
+                                                  &resultTz,
+                                                  HANDLE,
+                                                  bdlt::Datetime(2010, 1, 1)));
+                ASSERTV(HANDLE, EUID == Obj::convertUtcToLocalTimeByHandle(
+                                                  &resultLcl,
+                                                  HANDLE,
+                                                  bdlt::Datetime(2010, 1, 1)));
+
+                ASSERTV(HANDLE, INITIAL   == resultTz);
+                ASSERTV(HANDLE, INITIAL   == resultLcl.datetimeTz());
+                ASSERTV(HANDLE, "initial" == resultLcl.timeZoneId());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Datetime  UTC_TIME(2010, 1, 1);
+            const int             HANDLE = handles[0];
+            bdlt::DatetimeTz      resultTz;
+            baltzo::LocalDatetime resultLcl(Z);
+            int                   handle;
+
+            ASSERT_PASS(Obj::loadTimeZoneHandle(&handle, NY));
+            ASSERT_FAIL(Obj::loadTimeZoneHandle(0, NY));
+            ASSERT_FAIL(Obj::loadTimeZoneHandle(&handle, 0));
+
+            ASSERT_PASS(Obj::convertUtcToLocalTimeByHandle(&resultTz,
+                                                           HANDLE,
+                                                           UTC_TIME));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimeByHandle(
+                                                        (bdlt::DatetimeTz *)0,
+                                                        HANDLE,
+                                                        UTC_TIME));
+
+            ASSERT_PASS(Obj::convertUtcToLocalTimeByHandle(&resultLcl,
+                                                           HANDLE,
+                                                           UTC_TIME));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimeByHandle(
+                                                   (baltzo::LocalDatetime *)0,
+                                                   HANDLE,
+                                                   UTC_TIME));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 144183882
@@ -231,6 +231,28 @@ int TimeZoneUtilImp::convertUtcToLocalTime(
     return 0;
 }
 
+int TimeZoneUtilImp::convertUtcToLocalTimeByHandle(
+                                   bdlt::DatetimeTz      *result,
+                                   int                    resultTimeZoneHandle,
+                                   const bdlt::Datetime&  utcTime,
+                                   ZoneinfoCache         *cache)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(cache);
+
+    const Zoneinfo *timeZone =
+                           cache->lookupZoneinfoByHandle(resultTimeZoneHandle);
+    if (0 == timeZone) {
+        return ErrorCode::k_UNSUPPORTED_ID;                           // RETURN
+    }
+
+    Zoneinfo::TransitionConstIterator it;
+    return ZoneinfoUtil::convertUtcToLocalTime(result,
+                                               &it,
+                                               utcTime,
+                                               *timeZone);
+}
+
 int TimeZoneUtilImp::initLocalTime(bdlt::DatetimeTz        *result,
                                    LocalTimeValidity::Enum *resultValidity,
                                    const bdlt::Datetime&    localTime,
@@ -173,6 +173,23 @@ struct TimeZoneUtilImp {
         // indicates that an out of range value of 'result' would have
         // occurred.
 
+    static int convertUtcToLocalTimeByHandle(
+                                   bdlt::DatetimeTz      *result,
+                                   int                    resultTimeZoneHandle,
+                                   const bdlt::Datetime&  utcTime,
+                                   ZoneinfoCache         *cache);
+        // Load, into the specified 'result', the local date-time value, in the
+        // time zone indicated by the specified 'resultTimeZoneHandle',
+        // corresponding to the specified 'utcTime', using time zone
+        // information supplied by the specified 'cache' without acquiring any
+        // lock.  Return 0 on success, and a non-zero value otherwise.  A
+        // return status of 'ErrorCode::k_UNSUPPORTED_ID' indicates that
+        // 'resultTimeZoneHandle' is not recognized, and a return status of
+        // 'ErrorCode::k_OUT_OF_RANGE' indicates that an out of range value of
+        // 'result' would have occurred.  The behavior is undefined unless
+        // 'resultTimeZoneHandle' was returned by 'cache->getHandle', or is
+        // negative.
+
     static void createLocalTimePeriod(
                           LocalTimePeriod                          *result,
                           const Zoneinfo::TransitionConstIterator&  transition,
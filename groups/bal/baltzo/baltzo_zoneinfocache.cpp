@@ -17,6 +17,7 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 
 #include <bsls_log.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
 
@@ -27,22 +28,11 @@ namespace baltzo {
                             // class ZoneinfoCache
                             // -------------------
 
-// CREATORS
-ZoneinfoCache::~ZoneinfoCache()
+// PRIVATE MANIPULATORS
+int ZoneinfoCache::loadZoneinfo(int *handle, const char *timeZoneId)
 {
-    for (ZoneinfoMap::iterator it  = d_cache.begin();
-                               it != d_cache.end();
-                               ++it) {
-        BSLS_ASSERT(0 != it->second);
-        d_allocator.mechanism()->deleteObject(it->second);
-    }
-}
-
-// MANIPULATORS
-const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
-{
-    BSLS_ASSERT(0 != rc);
-    BSLS_ASSERT(0 != timeZoneId);
+    BSLS_ASSERT(handle);
+    BSLS_ASSERT(timeZoneId);
 
     enum {
         // Define the failure status value.
@@ -52,75 +42,146 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
     BSLMF_ASSERT(static_cast<int>(ErrorCode::k_UNSUPPORTED_ID) !=
                  static_cast<int>(FAILURE));
 
-    const Zoneinfo *result = lookupZoneinfo(timeZoneId);
-
-    if (0 != result) {
-        *rc = 0;
-        return result;                                                // RETURN
-    }
-
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
 
     // We use 'lower_bound' to return the position where the 'timeZoneId'
     // should be (even if it is not in the map), so that it can be used as an
     // insertion hint.
 
-    ZoneinfoMap::iterator it = d_cache.lower_bound(timeZoneId);
+    HandleMap::iterator it = d_cache.lower_bound(timeZoneId);
 
     if (d_cache.end() != it && !(d_cache.key_comp()(timeZoneId, it->first))) {
-        // 'timeZoneId' must have been added to the map between the call to
-        // 'lookupTimeZone', and the acquisition of the write-lock on 'd_lock'.
+        // 'timeZoneId' must have been added to the map between the lookup by
+        // the caller, and the acquisition of the write-lock on 'd_lock'.
 
-        BSLS_ASSERT(0 != it->second);
-        *rc    = 0;
-        result = it->second;
+        *handle = it->second;
+        return 0;                                                     // RETURN
     }
-    else {
-        // Create a proctor for the new time zone value.
 
-        Zoneinfo *newTimeZonePtr =
+    // Create a proctor for the new time zone value.
+
+    Zoneinfo *newTimeZonePtr =
             new (*(d_allocator.mechanism())) Zoneinfo(d_allocator.mechanism());
 
-        bslma::RawDeleterProctor<Zoneinfo, bslma::Allocator>  proctor(
+    bslma::RawDeleterProctor<Zoneinfo, bslma::Allocator>  proctor(
                                                       newTimeZonePtr,
                                                       d_allocator.mechanism());
 
-        *rc = d_loader_p->loadTimeZone(newTimeZonePtr, timeZoneId);
-        if (0 != *rc) {
-            if (ErrorCode::k_UNSUPPORTED_ID != *rc) {
-                BSLS_LOG_ERROR("Unexpected error code loading time zone "
-                               "%s : %d", timeZoneId, *rc);
-            }
-            return 0;                                                 // RETURN
+    int rc = d_loader_p->loadTimeZone(newTimeZonePtr, timeZoneId);
+    if (0 != rc) {
+        if (ErrorCode::k_UNSUPPORTED_ID != rc) {
+            BSLS_LOG_ERROR("Unexpected error code loading time zone "
+                           "%s : %d", timeZoneId, rc);
         }
-        if (!ZoneinfoUtil::isWellFormed(*newTimeZonePtr)) {
-            BSLS_LOG_ERROR("Loaded zone info object for %s is not well-formed",
-                           timeZoneId);
-            *rc = FAILURE;
-            return 0;                                                 // RETURN
+        return rc;                                                    // RETURN
+    }
+    if (!ZoneinfoUtil::isWellFormed(*newTimeZonePtr)) {
+        BSLS_LOG_ERROR("Loaded zone info object for %s is not well-formed",
+                       timeZoneId);
+        return FAILURE;                                               // RETURN
+    }
+
+    if (newTimeZonePtr->identifier() != timeZoneId) {
+        BSLS_LOG_ERROR("Loaded time zone id %s does not match "
+                       "request id: %s",
+                       newTimeZonePtr->identifier().c_str(),
+                       timeZoneId);
+        return FAILURE;                                               // RETURN
+    }
+
+    const int  newHandle = d_numZoneinfos.loadRelaxed();
+    Zoneinfo **zoneinfos = d_zoneinfos_p.loadRelaxed();
+
+    if (d_capacity == newHandle) {
+        // Publish a larger copy of the table.  The previous table may still
+        // be in use by readers, and is released only on destruction.
+
+        const int newCapacity = d_capacity ? 2 * d_capacity : 16;
+
+        d_tables.reserve(d_tables.size() + 1);
+
+        Zoneinfo **newZoneinfos = static_cast<Zoneinfo **>(
+                             d_allocator.mechanism()->allocate(
+                                       newCapacity * sizeof *newZoneinfos));
+        d_tables.push_back(newZoneinfos);
+
+        for (int i = 0; i < newHandle; ++i) {
+            newZoneinfos[i] = zoneinfos[i];
         }
 
-        if (newTimeZonePtr->identifier() != timeZoneId) {
-            BSLS_LOG_ERROR("Loaded time zone id %s does not match "
-                           "request id: %s",
-                           newTimeZonePtr->identifier().c_str(),
-                           timeZoneId);
-            *rc = FAILURE;
+        zoneinfos  = newZoneinfos;
+        d_capacity = newCapacity;
+        d_zoneinfos_p.storeRelease(zoneinfos);
+    }
+
+    d_cache.insert(it,
+                   HandleMap::value_type(newTimeZonePtr->identifier().c_str(),
+                                         newHandle));
+
+    // The pointer has been copied, so the proctor must release ownership.
+
+    zoneinfos[newHandle] = newTimeZonePtr;
+    proctor.release();
+
+    d_numZoneinfos.storeRelease(newHandle + 1);
+
+    *handle = newHandle;
+    return 0;
+}
+
+// CREATORS
+ZoneinfoCache::~ZoneinfoCache()
+{
+    Zoneinfo **zoneinfos = d_zoneinfos_p.loadRelaxed();
+
+    for (int i = 0; i < d_numZoneinfos.loadRelaxed(); ++i) {
+        BSLS_ASSERT(0 != zoneinfos[i]);
+        d_allocator.mechanism()->deleteObject(zoneinfos[i]);
+    }
+
+    for (bsl::size_t i = 0; i < d_tables.size(); ++i) {
+        d_allocator.mechanism()->deallocate(d_tables[i]);
+    }
+}
+
+// MANIPULATORS
+int ZoneinfoCache::getHandle(int *result, const char *timeZoneId)
+{
+    BSLS_ASSERT(0 != result);
+    BSLS_ASSERT(0 != timeZoneId);
+
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+
+        HandleMap::const_iterator it = d_cache.find(timeZoneId);
+        if (d_cache.end() != it) {
+            *result = it->second;
             return 0;                                                 // RETURN
         }
+    }
+
+    return loadZoneinfo(result, timeZoneId);
+}
+
+const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
+{
+    BSLS_ASSERT(0 != rc);
+    BSLS_ASSERT(0 != timeZoneId);
 
-        d_cache.insert(
-                  it,
-                  ZoneinfoMap::value_type(newTimeZonePtr->identifier().c_str(),
-                                          newTimeZonePtr));
-        result = newTimeZonePtr;
+    const Zoneinfo *result = lookupZoneinfo(timeZoneId);
 
-        // The pointer has been copied, so the proctor must release ownership.
+    if (0 != result) {
+        *rc = 0;
+        return result;                                                // RETURN
+    }
 
-        proctor.release();
+    int handle;
+    *rc = loadZoneinfo(&handle, timeZoneId);
+    if (0 != *rc) {
+        return 0;                                                     // RETURN
     }
 
-    return result;
+    return lookupZoneinfoByHandle(handle);
 }
 
 // ACCESSORS
@@ -130,9 +191,9 @@ const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
 
     bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
 
-    ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
+    HandleMap::const_iterator it = d_cache.find(timeZoneId);
     if (d_cache.end() != it) {
-        return it->second;                                            // RETURN
+        return d_zoneinfos_p.loadRelaxed()[it->second];               // RETURN
     }
     return 0;
 }
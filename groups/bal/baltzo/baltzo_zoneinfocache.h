@@ -22,11 +22,36 @@ BSLS_IDENT("$Id: $")
 // 'getZoneinfo' and 'lookupZoneinfo'.  Addresses returned by either of these
 // methods are valid for the lifetime of the cache.
 //
+///Time-Zone Handles
+///-----------------
+// Each time zone cached by a 'baltzo::ZoneinfoCache' is also assigned an
+// integer *handle*, unique within that cache, which is returned by the
+// 'getHandle' method.  The handles are assigned consecutively, starting at 0,
+// in the order in which the time zones are cached.  'lookupZoneinfoByHandle'
+// returns the cached information for a handle without looking up the
+// time-zone identifier and without acquiring any lock.  The cached objects are
+// held in a table indexed by handle, together with the number of handles
+// assigned.  Caching a time zone (under the write lock of the cache) writes
+// only the slot of the new handle, which no reader accesses until the number
+// of handles is incremented with release semantics after the slot is written;
+// readers load that number with acquire semantics before reading any slot
+// below it.  When the table is full, a larger copy holding the slots of all
+// assigned handles is published, with release semantics, before the slot of
+// the new handle is written, and the previous tables are released only when
+// the cache is destroyed, so that a slot, once readable, is never modified in
+// any table that a reader may hold.
+//
+// Clients converting many time values (e.g., see
+// 'baltzo::TimeZoneUtil::convertUtcToLocalTimeByHandle') can therefore obtain
+// the handle of a time zone once, and then use that handle instead of the
+// time-zone identifier.  Note that a handle is meaningful only for the cache
+// that returned it.
+//
 ///Thread Safety
 ///-------------
 // 'baltzo::ZoneinfoCache' is fully *thread-safe*, meaning that all non-creator
 // operations on an object can be safely invoked simultaneously from multiple
-// threads.
+// threads.  'lookupZoneinfoByHandle' is, in addition, *lock-free*.
 //
 ///Usage
 ///-----
@@ -143,6 +168,35 @@ BSLS_IDENT("$Id: $")
 //  assert(0 == cache.getZoneinfo(&rc, "badId"));
 //  assert(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
 //..
+//
+///Example 3: Accessing Time-Zone Information by Handle
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we obtain the handle of a time zone, and use it to access
+// the time zone information without looking up its identifier.
+//
+// First, we call 'getHandle' to obtain the handle of the New York time zone,
+// cached in the preceding example:
+//..
+//  int newYorkHandle;
+//  rc = cache.getHandle(&newYorkHandle, "America/New_York");
+//  assert(0 == rc);
+//..
+// Then, we verify that the handle refers to the time zone information returned
+// by 'getZoneinfo':
+//..
+//  assert(newYork == cache.lookupZoneinfoByHandle(newYorkHandle));
+//..
+// Finally, we verify that 'getHandle' fails for an unsupported time-zone
+// identifier, and that 'lookupZoneinfoByHandle' returns 0 for a value that is
+// not a handle returned by 'getHandle':
+//..
+//  int badHandle = -1;
+//  rc = cache.getHandle(&badHandle, "badId");
+//  assert(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+//  assert(-1                                  == badHandle);
+//  assert(0  == cache.lookupZoneinfoByHandle(-1));
+//  assert(0  == cache.lookupZoneinfoByHandle(1000));
+//..
 
 #include <balscm_version.h>
 
@@ -163,6 +217,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 
 #include <bsl_map.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace baltzo {
@@ -191,23 +246,53 @@ class ZoneinfoCache {
 
   private:
     // PRIVATE TYPES
-    typedef bsl::map<const char *, Zoneinfo *, bdlb::CStringLess> ZoneinfoMap;
+    typedef bsl::map<const char *, int, bdlb::CStringLess> HandleMap;
 
     // DATA
-    ZoneinfoMap             d_cache;      // cached time-zone info, indexed by
-                                          // time-zone id
+    HandleMap                       d_cache;          // handles of the cached
+                                                      // time-zone info,
+                                                      // indexed by time-zone
+                                                      // id
+
+    bsls::AtomicPointer<Zoneinfo *> d_zoneinfos_p;    // published table of
+                                                      // the cached time-zone
+                                                      // info, indexed by
+                                                      // handle
 
-    Loader                 *d_loader_p;   // loader used to obtain time-zone
-                                          // information (held, not owned)
+    bsls::AtomicInt                 d_numZoneinfos;   // number of published
+                                                      // entries in
+                                                      // 'd_zoneinfos_p'
 
-    mutable bslmt::RWMutex  d_lock;       // cache access synchronization
+    int                             d_capacity;       // capacity of the table
+                                                      // at 'd_zoneinfos_p'
 
-    allocator_type          d_allocator;  // allocator used to supply memory
+    bsl::vector<Zoneinfo **>        d_tables;         // tables allocated by
+                                                      // this object (owned)
+
+    Loader                         *d_loader_p;       // loader used to obtain
+                                                      // time-zone information
+                                                      // (held, not owned)
+
+    mutable bslmt::RWMutex          d_lock;           // cache access
+                                                      // synchronization
+
+    allocator_type                  d_allocator;      // allocator used to
+                                                      // supply memory
 
     // NOT IMPLEMENTED
     ZoneinfoCache(const ZoneinfoCache&);
     ZoneinfoCache& operator=(const ZoneinfoCache&);
 
+    // PRIVATE MANIPULATORS
+    int loadZoneinfo(int *handle, const char *timeZoneId);
+        // Load into the specified 'handle' the handle of the time zone
+        // identified by the specified 'timeZoneId', using the 'loader'
+        // supplied at construction to populate this object if that time zone
+        // is not already cached.  Return 0 on success,
+        // 'ErrorCode::k_UNSUPPORTED_ID' if the time-zone identifier is not
+        // supported, and a negative value if the operation does not succeed
+        // for any other reason, with no effect on 'handle'.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(ZoneinfoCache,
@@ -231,6 +316,17 @@ class ZoneinfoCache {
         // Destroy this object.
 
     // MANIPULATORS
+    int getHandle(int *result, const char *timeZoneId);
+        // Load into the specified 'result' the handle of the time zone
+        // identified by the specified 'timeZoneId' (see {Time-Zone Handles}).
+        // If the information for 'timeZoneId' has not been previously cached,
+        // then attempt to populate this object using the 'loader' supplied at
+        // construction.  Return 0 on success, 'ErrorCode::k_UNSUPPORTED_ID' if
+        // the time-zone identifier is not supported, and a negative value if
+        // the operation does not succeed for any other reason, with no effect
+        // on 'result'.  A handle loaded into 'result' remains valid for the
+        // lifetime of this object.
+
     const Zoneinfo *getZoneinfo(const char *timeZoneId);
     const Zoneinfo *getZoneinfo(int *rc, const char *timeZoneId);
         // Return the address of the non-modifiable 'Zoneinfo' object
@@ -259,6 +355,14 @@ class ZoneinfoCache {
         // 'ZoneinfoUtil::isWellFormed will return 'true' if called with the
         // returned value), and remain valid for the lifetime of this object.
 
+    const Zoneinfo *lookupZoneinfoByHandle(int handle) const;
+        // Return the address of the non-modifiable cached description of the
+        // time zone having the specified 'handle', and 0 if 'handle' was not
+        // returned by a call to 'getHandle' on this object.  If the returned
+        // address is non-zero, the Zoneinfo object returned is guaranteed to
+        // be well-formed, and remain valid for the lifetime of this object.
+        // Note that this method does not acquire any lock.
+
     allocator_type get_allocator() const;
         // Return the allocator used by this object to supply memory.  Note
         // that if no allocator was supplied at construction the default
@@ -277,6 +381,10 @@ class ZoneinfoCache {
 inline
 ZoneinfoCache::ZoneinfoCache(Loader *loader, const allocator_type&  allocator)
 : d_cache(allocator)
+, d_zoneinfos_p(0)
+, d_numZoneinfos(0)
+, d_capacity(0)
+, d_tables(allocator)
 , d_loader_p(loader)
 , d_allocator(allocator)
 {
@@ -293,6 +401,19 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(const char *timeZoneId)
     return getZoneinfo(&rc, timeZoneId);
 }
 
+// ACCESSORS
+inline
+const Zoneinfo *ZoneinfoCache::lookupZoneinfoByHandle(int handle) const
+{
+    // The table at 'd_zoneinfos_p' is published before 'd_numZoneinfos' is
+    // incremented, so that the table loaded below contains 'handle'.
+
+    if (handle < 0 || d_numZoneinfos.loadAcquire() <= handle) {
+        return 0;                                                     // RETURN
+    }
+    return d_zoneinfos_p.loadAcquire()[handle];
+}
+
 inline
 ZoneinfoCache::allocator_type ZoneinfoCache::get_allocator() const
 {
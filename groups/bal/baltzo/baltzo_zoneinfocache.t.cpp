@@ -27,11 +27,14 @@
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace std;
@@ -75,13 +78,15 @@ using namespace std;
 // MANIPULATORS
 // [ 6] const baltzo::Zoneinfo *getZoneinfo(const char *timeZoneId);
 // [ 5] const baltzo::Zoneinfo *getZoneinfo(int *rc, const char *timeZoneId);
+// [ 9] int getHandle(int *result, const char *timeZoneId);
 //
 // ACCESSORS
 // [ 6] const baltzo::Zoneinfo *lookupZoneinfo(const char *timeZoneId) const;
+// [ 9] const baltzo::Zoneinfo *lookupZoneinfoByHandle(int handle) const;
 // [ 4] allocator_type get_allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 8] CONCERN: All methods are thread-safe
 // [ 7] CONCERN: ACCESSOR methods are declared 'const'.
 // [ 6] CONCERN: CREATOR & MANIPULATOR parameters are declared 'const'.
@@ -513,6 +518,61 @@ extern "C" void *workerThread(void *arg)
 
 }  // close namespace BALTZO_ZONEINFOCACHE_CONCURRENCY
 
+// ============================================================================
+//                     HANDLE CONCERNS RELATED ENTRIES
+// ----------------------------------------------------------------------------
+
+namespace BALTZO_ZONEINFOCACHE_HANDLES {
+
+enum { k_NUM_IDS = 100 };  // number of time zones, exceeding the initial
+                           // capacity of the table of handles
+
+bsl::vector<bsl::string>    IDS;          // time-zone identifiers
+
+bsl::vector<bsls::AtomicInt> EXP_HANDLES(k_NUM_IDS);
+                                          // handle returned for each id, or -1
+
+struct ThreadData {
+    Obj            *d_cache_p;    // cache under test
+    bslmt::Barrier *d_barrier_p;  // testing barrier
+    int             d_start;      // index of the first id requested
+};
+
+extern "C" void *handleThread(void *arg)
+    // Request, from the cache in the 'ThreadData' at the specified 'arg', the
+    // handles of all the identifiers in 'IDS', starting at the index in that
+    // 'ThreadData', and verify that each handle refers to the expected time
+    // zone, and that all the threads observe the same handle for each id.
+{
+    ThreadData *p = static_cast<ThreadData *>(arg);
+
+    Obj &mX = *p->d_cache_p; const Obj &X = mX;
+
+    p->d_barrier_p->wait();
+
+    for (int j = 0; j < k_NUM_IDS; ++j) {
+        const int i = (p->d_start + j) % k_NUM_IDS;
+
+        int handle = -1;
+        ASSERTV(i, 0 == mX.getHandle(&handle, IDS[i].c_str()));
+
+        const int prevHandle = EXP_HANDLES[i].testAndSwap(-1, handle);
+        ASSERTV(i, handle, prevHandle, -1 == prevHandle
+                                                     || handle == prevHandle);
+
+        const Zone *zone = X.lookupZoneinfoByHandle(handle);
+        ASSERTV(i, handle, 0 != zone);
+        if (zone) {
+            ASSERTV(i, handle, IDS[i] == zone->identifier());
+        }
+    }
+
+    p->d_barrier_p->wait();
+    return 0;
+}
+
+}  // close namespace BALTZO_ZONEINFOCACHE_HANDLES
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -649,6 +709,191 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
       case 9: {
+        // --------------------------------------------------------------------
+        // TESTING: 'getHandle' AND 'lookupZoneinfoByHandle'
+        //
+        // Concerns:
+        //: 1 'getHandle' loads the time zone if it is not cached, and returns
+        //:   consecutive handles, starting at 0, in the order in which the
+        //:   time zones are cached, and the same handle for the same id.
+        //:
+        //: 2 'lookupZoneinfoByHandle' returns the address of the object
+        //:   returned by 'getZoneinfo' and 'lookupZoneinfo' for the id of the
+        //:   handle, and 0 for values that are not handles.
+        //:
+        //: 3 'getHandle' returns the same error codes as 'getZoneinfo', with
+        //:   no effect on the result, and without consuming a handle.
+        //:
+        //: 4 Handles remain valid as the cache grows, and no memory is
+        //:   leaked.
+        //:
+        //: 5 Concurrent calls to 'getHandle' and 'lookupZoneinfoByHandle'
+        //:   for overlapping sets of time zones observe the same handles.
+        //:
+        //: 6 Precondition violations are detected.
+        //
+        // Plan:
+        //: 1 Configure a test loader with more time zones than the initial
+        //:   capacity of the table of handles, some of which are invalid.
+        //:
+        //: 2 Request the handles of the valid time zones, interleaved with
+        //:   calls to 'getZoneinfo' and requests for invalid and unknown ids,
+        //:   and verify the handles, the return codes, and the addresses
+        //:   returned by 'lookupZoneinfoByHandle'.  (C-1..3)
+        //:
+        //: 3 Verify that all handles still refer to the expected objects,
+        //:   and that the test allocator has no memory in use once the cache
+        //:   is destroyed.  (C-4)
+        //:
+        //: 4 In several threads, request the handles of all the time zones,
+        //:   starting at different ids, and verify that each id is assigned a
+        //:   unique handle referring to that time zone.  (C-5)
+        //:
+        //: 5 Use ASSERT_PASS and ASSERT_FAIL to test assertions for null
+        //:   pointers.  (C-6)
+        //
+        // Testing:
+        //   int getHandle(int *result, const char *timeZoneId);
+        //   const Zoneinfo *lookupZoneinfoByHandle(int handle) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                     << endl
+                     << "TESTING: 'getHandle' AND 'lookupZoneinfoByHandle'\n"
+                     << "=================================================\n";
+
+        using namespace BALTZO_ZONEINFOCACHE_HANDLES;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int i = 0; i < k_NUM_IDS; ++i) {
+            char buffer[32];
+            bsl::sprintf(buffer, "Zone/%03d", i);
+            IDS.push_back(buffer);
+        }
+
+        if (verbose) cout << "\tTesting sequential requests." << endl;
+        {
+            TestDriverTestLoader testLoader(&ta);
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                testLoader.addTimeZone(IDS[i].c_str(), i, false, "Z");
+            }
+            testLoader.addTimeZone("Invalid", 0, false, 0);
+
+            Obj mX(&testLoader, &ta); const Obj& X = mX;
+
+            ASSERT(0 == X.lookupZoneinfoByHandle(0));
+            ASSERT(0 == X.lookupZoneinfoByHandle(-1));
+
+            bsl::vector<const Zone *> zones;
+
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                const char *ID = IDS[i].c_str();
+
+                if (veryVerbose) { T_ P(ID) }
+
+                // Alternate the ways the time zones are cached.
+
+                if (i % 2) {
+                    int rc;
+                    ASSERTV(i, 0 != mX.getZoneinfo(&rc, ID));
+                    ASSERTV(i, 0 == rc);
+                }
+
+                int handle = -1;
+                ASSERTV(i, 0 == mX.getHandle(&handle, ID));
+                ASSERTV(i, handle, i == handle);
+
+                const Zone *ZONE = X.lookupZoneinfoByHandle(handle);
+                ASSERTV(i, 0              != ZONE);
+                ASSERTV(i, X.lookupZoneinfo(ID) == ZONE);
+                ASSERTV(i, mX.getZoneinfo(ID)   == ZONE);
+                zones.push_back(ZONE);
+
+                int handle2 = -1;
+                ASSERTV(i, 0      == mX.getHandle(&handle2, ID));
+                ASSERTV(i, handle == handle2);
+
+                ASSERTV(i, 0 == X.lookupZoneinfoByHandle(i + 1));
+
+                // Failures have no effect, and do not consume a handle.
+
+                int badHandle = -2;
+                ASSERTV(i, UNSUPPORTED_ERR ==
+                                         mX.getHandle(&badHandle, "Unknown"));
+
+                if (k_NUM_IDS / 2 == i) {
+                    const int RC = mX.getHandle(&badHandle, "Invalid");
+                    ASSERTV(i, RC, 0 != RC && UNSUPPORTED_ERR != RC);
+                }
+                ASSERTV(i, -2 == badHandle);
+            }
+
+            // The handles remain valid as the cache grows.
+
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                ASSERTV(i, zones[i] == X.lookupZoneinfoByHandle(i));
+            }
+            ASSERT(0 == X.lookupZoneinfoByHandle(k_NUM_IDS));
+            ASSERT(0 == X.lookupZoneinfoByHandle(INT_MAX));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+        ASSERT(0 == defaultAllocator.numBytesInUse());
+
+        if (verbose) cout << "\tTesting concurrent requests." << endl;
+        {
+            enum { k_NUM_THREADS = 4 };
+
+            TestDriverTestLoader testLoader(&ta);
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                testLoader.addTimeZone(IDS[i].c_str(), i, false, "Z");
+                EXP_HANDLES[i] = -1;
+            }
+
+            Obj mX(&testLoader, &ta);
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            ThreadData                args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_cache_p   = &mX;
+                args[i].d_barrier_p = &barrier;
+                args[i].d_start     = i * k_NUM_IDS / k_NUM_THREADS;
+                ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                      handleThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(threads[i]);
+            }
+
+            // The handles are the integers in '[0 .. k_NUM_IDS)'.
+
+            bsl::set<int> handles;
+            for (int i = 0; i < k_NUM_IDS; ++i) {
+                const int HANDLE = EXP_HANDLES[i];
+                ASSERTV(i, HANDLE, 0 <= HANDLE && HANDLE < k_NUM_IDS);
+                handles.insert(HANDLE);
+            }
+            ASSERTV(handles.size(), k_NUM_IDS == handles.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting assertions." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            TestDriverTestLoader testLoader(&ta);
+            Obj mX(&testLoader, &ta);
+
+            int handle;
+            ASSERT_FAIL(mX.getHandle(&handle, (const char *)0));
+            ASSERT_FAIL(mX.getHandle((int *)0, "abc"));
+            ASSERT_PASS(mX.getHandle(&handle, "abc"));
+        }
+      } break;
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -780,6 +1025,35 @@ int main(int argc, char *argv[])
     ASSERT(0 == cache.getZoneinfo(&rc, "badId"));
     ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
 //..
+//
+///Example 3: Accessing Time-Zone Information by Handle
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we obtain the handle of a time zone, and use it to access
+// the time zone information without looking up its identifier.
+//
+// First, we call 'getHandle' to obtain the handle of the New York time zone,
+// cached in the preceding example:
+//..
+    int newYorkHandle;
+    rc = cache.getHandle(&newYorkHandle, "America/New_York");
+    ASSERT(0 == rc);
+//..
+// Then, we verify that the handle refers to the time zone information returned
+// by 'getZoneinfo':
+//..
+    ASSERT(newYork == cache.lookupZoneinfoByHandle(newYorkHandle));
+//..
+// Finally, we verify that 'getHandle' fails for an unsupported time-zone
+// identifier, and that 'lookupZoneinfoByHandle' returns 0 for a value that is
+// not a handle returned by 'getHandle':
+//..
+    int badHandle = -1;
+    rc = cache.getHandle(&badHandle, "badId");
+    ASSERT(baltzo::ErrorCode::k_UNSUPPORTED_ID == rc);
+    ASSERT(-1                                  == badHandle);
+    ASSERT(0  == cache.lookupZoneinfoByHandle(-1));
+    ASSERT(0  == cache.lookupZoneinfoByHandle(1000));
+//..
 
       } break;
       case 8: {
@@ -11,8 +11,8 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 #include <bslmf_assert.h>
 
 #include <bsls_alignmentfromtype.h>
-#include <bsls_annotation.h>
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_keyword.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
@@ -24,6 +24,22 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#if (defined(BSLS_PLATFORM_CMP_GNU)   && BSLS_PLATFORM_CMP_VERSION >= 80000) \
+ || (defined(BSLS_PLATFORM_CMP_CLANG) && BSLS_PLATFORM_CMP_VERSION >= 60000)
+#define U_X86_SIMD
+    // The vectorized kernels are compiled using function-level 'target'
+    // attributes, so that no special compiler options are needed and the same
+    // object code runs on processors lacking the extensions.  The compiler
+    // must support the AVX-512 VPOPCNTDQ intrinsics.
+#endif
+#endif
+
+#if defined(U_X86_SIMD)
+#include <immintrin.h>
+#endif
+
 using namespace BloombergLP;
 using bsl::size_t;
 using bsl::uint64_t;
@@ -50,8 +66,6 @@ enum { k_ALIGNMENT       = 4 };
 enum { k_ALIGNMENT       = bsls::AlignmentFromType<uint64_t>::VALUE };
 #endif
 
-#define FALLTHROUGH BSLS_ANNOTATION_FALLTHROUGH
-
 BSLMF_ASSERT(sizeof(uint64_t) * CHAR_BIT == k_BITS_PER_UINT64);
 BSLMF_ASSERT(0 == (k_BITS_PER_UINT64 & (k_BITS_PER_UINT64 - 1))); // power of 2
 
@@ -128,6 +142,595 @@ unsigned int u32(uint64_t value)
     return static_cast<unsigned int>(value);
 }
 
+                        // ==========================
+                        // Bulk Word Kernels (Scalar)
+                        // ==========================
+
+namespace {
+
+enum Operation {
+    // Enumerate the bitwise-logical operations applied by the bulk word
+    // kernels.
+
+    e_AND,
+    e_MINUS,
+    e_OR,
+    e_XOR
+};
+
+enum {
+    k_MIN_VECTOR_WORDS = 8  // shorter arrays of words are always handled by
+                            // the scalar kernels
+};
+
+template <int OPERATION>
+inline
+void applyWord(uint64_t *dstWord, uint64_t srcWord)
+    // Apply the bitwise-logical operation indicated by the (template
+    // parameter) 'OPERATION' between the specified '*dstWord' and the
+    // specified 'srcWord', and write the result to '*dstWord'.
+{
+    switch (OPERATION) {
+      case e_AND: {
+        Imp::andEqWord(dstWord, srcWord);
+      } break;
+      case e_MINUS: {
+        Imp::minusEqWord(dstWord, srcWord);
+      } break;
+      case e_OR: {
+        Imp::orEqWord(dstWord, srcWord);
+      } break;
+      default: {
+        Imp::xorEqWord(dstWord, srcWord);
+      } break;
+    }
+}
+
+template <int OPERATION>
+void applyWordsScalar(uint64_t       *dstWords,
+                      const uint64_t *srcWords,
+                      size_t          numWords)
+    // Apply the bitwise-logical operation indicated by the (template
+    // parameter) 'OPERATION' between each of the specified 'numWords' words
+    // of the specified 'dstWords' and the corresponding word of the specified
+    // 'srcWords', from the lowest to the highest address, writing the results
+    // to 'dstWords'.
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        applyWord<OPERATION>(&dstWords[ii], srcWords[ii]);
+    }
+}
+
+size_t findWordNotEqualScalar(const uint64_t *words,
+                              size_t          numWords,
+                              uint64_t        value)
+    // Return the index of the first of the specified 'numWords' words in the
+    // specified 'words' that is not equal to the specified 'value', or
+    // 'numWords' if there is no such word.
+{
+    size_t ii = 0;
+    while (ii < numWords && value == words[ii]) {
+        ++ii;
+    }
+    return ii;
+}
+
+size_t num1WordsScalar(const uint64_t *words, size_t numWords)
+    // Return the number of 1 bits in the specified 'numWords' words in the
+    // specified 'words'.
+{
+    size_t ret = 0;
+    size_t ii  = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        ret +=       BitUtil::numBitsSet(words[ii    ]);
+        ret +=       BitUtil::numBitsSet(words[ii + 1]);
+        ret +=       BitUtil::numBitsSet(words[ii + 2]);
+        ret +=       BitUtil::numBitsSet(words[ii + 3]);
+
+        ret +=       BitUtil::numBitsSet(words[ii + 4]);
+        ret +=       BitUtil::numBitsSet(words[ii + 5]);
+        ret +=       BitUtil::numBitsSet(words[ii + 6]);
+        ret +=       BitUtil::numBitsSet(words[ii + 7]);
+    }
+
+    for (; ii < numWords; ++ii) {
+        ret += BitUtil::numBitsSet(words[ii]);
+    }
+
+    return ret;
+}
+
+size_t num1AndWordsScalar(const uint64_t *words1,
+                          const uint64_t *words2,
+                          size_t          numWords)
+    // Return the number of 1 bits in the bitwise AND of each of the specified
+    // 'numWords' words in the specified 'words1' with the corresponding word
+    // in the specified 'words2'.
+{
+    size_t ret = 0;
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        ret += BitUtil::numBitsSet(words1[ii] & words2[ii]);
+    }
+    return ret;
+}
+
+}  // close unnamed namespace
+
+#if defined(U_X86_SIMD)
+
+                         // ========================
+                         // Bulk Word Kernels (AVX2)
+                         // ========================
+
+namespace {
+
+template <int OPERATION>
+__attribute__((target("avx2")))
+void applyWordsAvx2(uint64_t       *dstWords,
+                    const uint64_t *srcWords,
+                    size_t          numWords)
+    // Apply the bitwise-logical operation indicated by the (template
+    // parameter) 'OPERATION' between each of the specified 'numWords' words
+    // of the specified 'dstWords' and the corresponding word of the specified
+    // 'srcWords', from the lowest to the highest address, writing the results
+    // to 'dstWords', using AVX2 instructions.  Note that each group of 4 words
+    // is loaded before it is stored, so that 'dstWords' may overlap
+    // 'srcWords' from below.
+{
+    size_t ii = 0;
+
+    for (; ii + 4 <= numWords; ii += 4) {
+        __m256i       *dst = reinterpret_cast<__m256i *>(dstWords + ii);
+        const __m256i  d   = _mm256_loadu_si256(dst);
+        const __m256i  s   = _mm256_loadu_si256(
+                             reinterpret_cast<const __m256i *>(srcWords + ii));
+
+        switch (OPERATION) {
+          case e_AND: {
+            _mm256_storeu_si256(dst, _mm256_and_si256(d, s));
+          } break;
+          case e_MINUS: {
+            _mm256_storeu_si256(dst, _mm256_andnot_si256(s, d));
+          } break;
+          case e_OR: {
+            _mm256_storeu_si256(dst, _mm256_or_si256(d, s));
+          } break;
+          default: {
+            _mm256_storeu_si256(dst, _mm256_xor_si256(d, s));
+          } break;
+        }
+    }
+
+    applyWordsScalar<OPERATION>(dstWords + ii,
+                                srcWords + ii,
+                                numWords - ii);
+}
+
+__attribute__((target("avx2")))
+size_t findWordNotEqualAvx2(const uint64_t *words,
+                            size_t          numWords,
+                            uint64_t        value)
+    // Return the index of the first of the specified 'numWords' words in the
+    // specified 'words' that is not equal to the specified 'value', or
+    // 'numWords' if there is no such word, using AVX2 instructions.
+{
+    const __m256i pattern = _mm256_set1_epi64x(static_cast<Int64>(value));
+
+    // Skip 8 words at a time while they all equal 'value', then locate the
+    // first differing word, if any, with the scalar kernel.
+
+    size_t ii = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __m256i lo = _mm256_xor_si256(
+                 _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words
+                                                                      + ii)),
+                 pattern);
+        const __m256i hi = _mm256_xor_si256(
+                 _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words
+                                                                  + ii + 4)),
+                 pattern);
+        const __m256i diff = _mm256_or_si256(lo, hi);
+
+        if (!_mm256_testz_si256(diff, diff)) {
+            break;
+        }
+    }
+
+    return ii + findWordNotEqualScalar(words + ii, numWords - ii, value);
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i num1BytesAvx2(__m256i words)
+    // Return the number of 1 bits in each byte of the specified 'words'.
+{
+    // Look up the number of 1 bits in each nibble (see Mula, Kurz, and
+    // Lemire, "Faster Population Counts Using AVX2 Instructions", 2016).
+
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                            1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3,
+                                            1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+    const __m256i lo = _mm256_and_si256(words, nibble);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(words, 4), nibble);
+
+    return _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                           _mm256_shuffle_epi8(lookup, hi));
+}
+
+__attribute__((target("avx2")))
+inline
+size_t sumLanesAvx2(__m256i counts)
+    // Return the sum of the four 64-bit lanes of the specified 'counts'.
+{
+    const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(counts),
+                                      _mm256_extracti128_si256(counts, 1));
+
+    return static_cast<size_t>(_mm_cvtsi128_si64(sum)
+                             + _mm_extract_epi64(sum, 1));
+}
+
+__attribute__((target("avx2")))
+size_t num1WordsAvx2(const uint64_t *words, size_t numWords)
+    // Return the number of 1 bits in the specified 'numWords' words in the
+    // specified 'words', using AVX2 instructions.
+{
+    const __m256i zero   = _mm256_setzero_si256();
+    __m256i       counts = zero;
+    size_t        ii     = 0;
+
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i w = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(words + ii));
+
+        counts = _mm256_add_epi64(counts,
+                                  _mm256_sad_epu8(num1BytesAvx2(w), zero));
+    }
+
+    return sumLanesAvx2(counts) + num1WordsScalar(words + ii, numWords - ii);
+}
+
+__attribute__((target("avx2")))
+size_t num1AndWordsAvx2(const uint64_t *words1,
+                        const uint64_t *words2,
+                        size_t          numWords)
+    // Return the number of 1 bits in the bitwise AND of each of the specified
+    // 'numWords' words in the specified 'words1' with the corresponding word
+    // in the specified 'words2', using AVX2 instructions.
+{
+    const __m256i zero   = _mm256_setzero_si256();
+    __m256i       counts = zero;
+    size_t        ii     = 0;
+
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i w = _mm256_and_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words1
+                                                                     + ii)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words2
+                                                                     + ii)));
+
+        counts = _mm256_add_epi64(counts,
+                                  _mm256_sad_epu8(num1BytesAvx2(w), zero));
+    }
+
+    return sumLanesAvx2(counts) + num1AndWordsScalar(words1 + ii,
+                                                     words2 + ii,
+                                                     numWords - ii);
+}
+
+}  // close unnamed namespace
+
+                        // ===========================
+                        // Bulk Word Kernels (AVX-512)
+                        // ===========================
+
+namespace {
+
+#define U_AVX512_TARGET __attribute__((target("avx512f,avx512vpopcntdq")))
+
+inline U_AVX512_TARGET
+__mmask8 tailMask(size_t numWords)
+    // Return a mask selecting the low-order specified 'numWords' lanes of a
+    // 512-bit vector of words.  The behavior is undefined unless
+    // 'numWords < 8'.
+{
+    return static_cast<__mmask8>((1U << numWords) - 1);
+}
+
+inline U_AVX512_TARGET
+size_t sumLanesAvx512(__m512i counts)
+    // Return the sum of the eight 64-bit lanes of the specified 'counts'.
+{
+    uint64_t lanes[8];
+    _mm512_storeu_si512(lanes, counts);
+
+    return static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]
+                             + lanes[4] + lanes[5] + lanes[6] + lanes[7]);
+}
+
+template <int OPERATION>
+inline U_AVX512_TARGET
+__m512i applyAvx512(__m512i dst, __m512i src)
+    // Return the result of the bitwise-logical operation indicated by the
+    // (template parameter) 'OPERATION' between the specified 'dst' and the
+    // specified 'src'.
+{
+    switch (OPERATION) {
+      case e_AND: {
+        return _mm512_and_si512(dst, src);                            // RETURN
+      }
+      case e_MINUS: {
+        return _mm512_ternarylogic_epi64(dst, src, src, 0x30);  // a & ~b
+                                                                      // RETURN
+      }
+      case e_OR: {
+        return _mm512_or_si512(dst, src);                             // RETURN
+      }
+      default: {
+        return _mm512_xor_si512(dst, src);                            // RETURN
+      }
+    }
+}
+
+template <int OPERATION>
+U_AVX512_TARGET
+void applyWordsAvx512(uint64_t       *dstWords,
+                      const uint64_t *srcWords,
+                      size_t          numWords)
+    // Apply the bitwise-logical operation indicated by the (template
+    // parameter) 'OPERATION' between each of the specified 'numWords' words
+    // of the specified 'dstWords' and the corresponding word of the specified
+    // 'srcWords', from the lowest to the highest address, writing the results
+    // to 'dstWords', using AVX-512 instructions.  Note that each group of 8
+    // words is loaded before it is stored, so that 'dstWords' may overlap
+    // 'srcWords' from below.
+{
+    size_t ii = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __m512i d = _mm512_loadu_si512(dstWords + ii);
+        const __m512i s = _mm512_loadu_si512(srcWords + ii);
+
+        _mm512_storeu_si512(dstWords + ii, applyAvx512<OPERATION>(d, s));
+    }
+
+    if (ii < numWords) {
+        const __mmask8 mask = tailMask(numWords - ii);
+        const __m512i  d    = _mm512_maskz_loadu_epi64(mask, dstWords + ii);
+        const __m512i  s    = _mm512_maskz_loadu_epi64(mask, srcWords + ii);
+
+        _mm512_mask_storeu_epi64(dstWords + ii,
+                                 mask,
+                                 applyAvx512<OPERATION>(d, s));
+    }
+}
+
+U_AVX512_TARGET
+size_t findWordNotEqualAvx512(const uint64_t *words,
+                              size_t          numWords,
+                              uint64_t        value)
+    // Return the index of the first of the specified 'numWords' words in the
+    // specified 'words' that is not equal to the specified 'value', or
+    // 'numWords' if there is no such word, using AVX-512 instructions.
+{
+    const __m512i pattern = _mm512_set1_epi64(static_cast<Int64>(value));
+
+    size_t ii = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __m512i  diff = _mm512_xor_si512(
+                                           _mm512_loadu_si512(words + ii),
+                                           pattern);
+        const unsigned mask = _mm512_test_epi64_mask(diff, diff);
+
+        if (mask) {
+            return ii + __builtin_ctz(mask);                          // RETURN
+        }
+    }
+
+    if (ii < numWords) {
+        const __mmask8 tail = tailMask(numWords - ii);
+        const __m512i  diff = _mm512_xor_si512(
+                                  _mm512_maskz_loadu_epi64(tail, words + ii),
+                                  pattern);
+        const unsigned mask = _mm512_mask_test_epi64_mask(tail, diff, diff);
+
+        if (mask) {
+            return ii + __builtin_ctz(mask);                          // RETURN
+        }
+    }
+
+    return numWords;
+}
+
+U_AVX512_TARGET
+size_t num1WordsAvx512(const uint64_t *words, size_t numWords)
+    // Return the number of 1 bits in the specified 'numWords' words in the
+    // specified 'words', using AVX-512 instructions.
+{
+    __m512i counts = _mm512_setzero_si512();
+    size_t  ii     = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        counts = _mm512_add_epi64(
+                         counts,
+                         _mm512_popcnt_epi64(_mm512_loadu_si512(words + ii)));
+    }
+
+    if (ii < numWords) {
+        counts = _mm512_add_epi64(
+                    counts,
+                    _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(
+                                                    tailMask(numWords - ii),
+                                                    words + ii)));
+    }
+
+    return sumLanesAvx512(counts);
+}
+
+U_AVX512_TARGET
+size_t num1AndWordsAvx512(const uint64_t *words1,
+                          const uint64_t *words2,
+                          size_t          numWords)
+    // Return the number of 1 bits in the bitwise AND of each of the specified
+    // 'numWords' words in the specified 'words1' with the corresponding word
+    // in the specified 'words2', using AVX-512 instructions.
+{
+    __m512i counts = _mm512_setzero_si512();
+    size_t  ii     = 0;
+
+    for (; ii + 8 <= numWords; ii += 8) {
+        counts = _mm512_add_epi64(
+                     counts,
+                     _mm512_popcnt_epi64(
+                              _mm512_and_si512(_mm512_loadu_si512(words1 + ii),
+                                               _mm512_loadu_si512(words2
+                                                                  + ii))));
+    }
+
+    if (ii < numWords) {
+        const __mmask8 mask = tailMask(numWords - ii);
+
+        counts = _mm512_add_epi64(
+                   counts,
+                   _mm512_popcnt_epi64(
+                       _mm512_and_si512(
+                               _mm512_maskz_loadu_epi64(mask, words1 + ii),
+                               _mm512_maskz_loadu_epi64(mask, words2 + ii))));
+    }
+
+    return sumLanesAvx512(counts);
+}
+
+#undef U_AVX512_TARGET
+
+}  // close unnamed namespace
+
+#endif  // U_X86_SIMD
+
+                        // ============================
+                        // Bulk Word Kernels (Dispatch)
+                        // ============================
+
+namespace {
+
+typedef bdlb::BitStringUtil_Impl BitStringUtil_Impl;
+
+bsls::AtomicOperations::AtomicTypes::Int s_selectedKernel = { -1 };
+    // the kernel used by 'BitStringUtil', or -1 if not yet determined
+
+inline
+BitStringUtil_Impl::Kernel kernelFor(size_t numWords)
+    // Return the kernel to be used by 'BitStringUtil' to process the
+    // specified 'numWords' words.
+{
+    return numWords < k_MIN_VECTOR_WORDS
+           ? BitStringUtil_Impl::e_SCALAR
+           : BitStringUtil_Impl::selectedKernel();
+}
+
+inline
+size_t findWordNotEqual(const uint64_t *words,
+                        size_t          numWords,
+                        uint64_t        value)
+    // Return the index of the first of the specified 'numWords' words in the
+    // specified 'words' that is not equal to the specified 'value', or
+    // 'numWords' if there is no such word, using the kernel selected for
+    // 'BitStringUtil'.
+{
+    return BitStringUtil_Impl::findWordNotEqual(kernelFor(numWords),
+                                                words,
+                                                numWords,
+                                                value);
+}
+
+inline
+size_t num1Words(const uint64_t *words, size_t numWords)
+    // Return the number of 1 bits in the specified 'numWords' words in the
+    // specified 'words', using the kernel selected for 'BitStringUtil'.
+{
+    return BitStringUtil_Impl::num1Words(kernelFor(numWords), words, numWords);
+}
+
+template <int OPERATION>
+void applyWords(BitStringUtil_Impl::Kernel  kernel,
+                uint64_t                   *dstWords,
+                const uint64_t             *srcWords,
+                size_t                      numWords)
+    // Apply the bitwise-logical operation indicated by the (template
+    // parameter) 'OPERATION' between each of the specified 'numWords' words
+    // of the specified 'dstWords' and the corresponding word of the specified
+    // 'srcWords', from the lowest to the highest address, writing the results
+    // to 'dstWords', using the specified 'kernel'.
+{
+    switch (kernel) {
+#if defined(U_X86_SIMD)
+      case BitStringUtil_Impl::e_AVX512: {
+        applyWordsAvx512<OPERATION>(dstWords, srcWords, numWords);
+      } break;
+      case BitStringUtil_Impl::e_AVX2: {
+        applyWordsAvx2<OPERATION>(dstWords, srcWords, numWords);
+      } break;
+#endif
+      default: {
+        applyWordsScalar<OPERATION>(dstWords, srcWords, numWords);
+      } break;
+    }
+}
+
+template <void OPER_DO_ALIGNED_WORD(uint64_t *, uint64_t)>
+void doAlignedWords(uint64_t       *dstWords,
+                    const uint64_t *srcWords,
+                    size_t          numWords)
+    // Apply 'OPER_DO_ALIGNED_WORD' between each of the specified 'numWords'
+    // words of the specified 'dstWords' and the corresponding word of the
+    // specified 'srcWords', from the lowest to the highest address.  Note that
+    // this function is specialized below for the bitwise-logical operations,
+    // which use the kernel selected for 'BitStringUtil'.
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        OPER_DO_ALIGNED_WORD(&dstWords[ii], srcWords[ii]);
+    }
+}
+
+template <>
+void doAlignedWords<Imp::andEqWord>(uint64_t       *dstWords,
+                                    const uint64_t *srcWords,
+                                    size_t          numWords)
+{
+    applyWords<e_AND>(kernelFor(numWords), dstWords, srcWords, numWords);
+}
+
+template <>
+void doAlignedWords<Imp::minusEqWord>(uint64_t       *dstWords,
+                                      const uint64_t *srcWords,
+                                      size_t          numWords)
+{
+    applyWords<e_MINUS>(kernelFor(numWords), dstWords, srcWords, numWords);
+}
+
+template <>
+void doAlignedWords<Imp::orEqWord>(uint64_t       *dstWords,
+                                   const uint64_t *srcWords,
+                                   size_t          numWords)
+{
+    applyWords<e_OR>(kernelFor(numWords), dstWords, srcWords, numWords);
+}
+
+template <>
+void doAlignedWords<Imp::xorEqWord>(uint64_t       *dstWords,
+                                    const uint64_t *srcWords,
+                                    size_t          numWords)
+{
+    applyWords<e_XOR>(kernelFor(numWords), dstWords, srcWords, numWords);
+}
+
+}  // close unnamed namespace
+
 namespace {
 
                                 // ----------------
@@ -454,7 +1057,10 @@ class Mover {
     // result to '*dstWord'.  Note that a call to
     // 'OPER_DO_ALIGNED_WORD(dstWord, srcValue)' would have exactly the same
     // effect as 'OPER_DO_BITS(dstWord, 0, srcValue, k_BITS_PER_UINT64)', but
-    // 'OPER_DO_ALIGNED_WORD' is much more efficient in that case.
+    // 'OPER_DO_ALIGNED_WORD' is much more efficient in that case.  Also note
+    // that 'left' applies 'OPER_DO_ALIGNED_WORD' to runs of aligned words by
+    // calling 'doAlignedWords', which uses the vectorized kernels for the
+    // bitwise-logical operations.
 
     // PRIVATE CLASS METHODS
     static void doPartialWord(uint64_t *dstBitString,
@@ -679,10 +1285,14 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::left(
     else {
         // The source and destination locations are both aligned.
 
-        for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-            OPER_DO_ALIGNED_WORD(&dstBitString[dstIndex++],
-                                 srcBitString[ srcIndex++]);
-        }
+        const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+        doAlignedWords<OPER_DO_ALIGNED_WORD>(&dstBitString[dstIndex],
+                                             &srcBitString[ srcIndex],
+                                             numWords);
+        dstIndex += numWords;
+        srcIndex += numWords;
+        numBits  -= numWords * k_BITS_PER_UINT64;
     }
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
@@ -844,7 +1454,10 @@ void Mover<OPER_DO_BITS, OPER_DO_ALIGNED_WORD>::move(
     const BitPtr     src(srcBitString, srcIndex);
     const BitPtrDiff diff(dst - src);
 
-    if (diff > 0) {
+    // Prefer 'left', which can use the vectorized kernels, unless the
+    // destination range overlaps the source range from above.
+
+    if (diff > 0 && BitPtrDiff(numBits) > diff) {
         right(dstBitString,
               dstIndex,
               srcBitString,
@@ -1832,14 +2445,13 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
+    const size_t ii       = findWordNotEqual(bitString, lastWord, ~0ULL);
     uint64_t     value;
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
+    if (ii < lastWord) {
         value = ~bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+        return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
-        }
     }
 
     const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
@@ -1868,8 +2480,22 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = ~bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
+            return beginWord * k_BITS_PER_UINT64
+                                             + Imp::find1AtMinIndexRaw(value);
+                                                                      // RETURN
+        }
+
+        // Scan the full words between 'beginWord' and 'lastWord'.
+
+        const size_t ii = beginWord + 1 + findWordNotEqual(
+                                                     bitString + beginWord + 1,
+                                                     lastWord - beginWord - 1,
+                                                     ~0ULL);
+
+        value = ~bitString[ii];
+        if (ii < lastWord) {
             return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
@@ -1946,14 +2572,13 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
+    const size_t ii       = findWordNotEqual(bitString, lastWord, 0);
     uint64_t     value;
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
+    if (ii < lastWord) {
         value = bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+        return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
-        }
     }
 
     const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
@@ -1982,8 +2607,22 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
+            return beginWord * k_BITS_PER_UINT64
+                                             + Imp::find1AtMinIndexRaw(value);
+                                                                      // RETURN
+        }
+
+        // Scan the full words between 'beginWord' and 'lastWord'.
+
+        const size_t ii = beginWord + 1 + findWordNotEqual(
+                                                     bitString + beginWord + 1,
+                                                     lastWord - beginWord - 1,
+                                                     0);
+
+        value = bitString[ii];
+        if (ii < lastWord) {
             return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
@@ -2015,11 +2654,13 @@ bool BitStringUtil::isAny0(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-        if (~bitString[++idx]) {
-            return true;                                              // RETURN
-        }
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+    if (findWordNotEqual(bitString + idx + 1, numWords, ~0ULL) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2049,12 +2690,13 @@ bool BitStringUtil::isAny1(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    while (numBits >= k_BITS_PER_UINT64) {
-        if (bitString[++idx]) {
-            return true;                                              // RETURN
-        }
-        numBits -= k_BITS_PER_UINT64;
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+
+    if (findWordNotEqual(bitString + idx + 1, numWords, 0) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2091,61 +2733,43 @@ size_t BitStringUtil::num1(const uint64_t *bitString,
 
     // We have multiple words to traverse.  The first and last might be partial
     // words, so we have to mask them.  The words in between will all be full
-    // words.  Note that we are traversing from high-order to low-order words.
+    // words.
 
     const int endPos = u32(beginPos + numBits - 1) % k_BITS_PER_UINT64 + 1;
 
     size_t ret = BitUtil::numBitsSet(bitString[lastWord] &
                                                     BitMaskUtil::lt64(endPos));
 
-    // We now want to visit all the words not including the highest-order and
-    // lowest-order words in 'bitString'.  We set 'array' such that
-    // '&array[0] == &bitString[1]'.  The first word we will visit in this
-    // array (as we predecrement 'ii') will be
-    // 'array[lastWord - 2] == bitString[lastWord - 1]'.  The last element we
-    // will visit will be 'array[0] == bitString[1]'.  The initial value of
-    // 'ii' below will be the number of words between the first and last words
-    // that must be traversed, not including the first word or the last word.
+    // Count the full words between the lowest-order and highest-order words.
 
-    BSLS_ASSERT(lastWord >= 1);    // therefore 'ii' below is >= 0 and can
-                                        // be represented as a 'size_t'
+    ret += num1Words(bitString + 1, lastWord - 1);
 
-    const uint64_t *array = bitString + 1;
-    size_t          ii    = lastWord
-                                     - 1  // word before last word
-                                     - 1  // adjust from 'bitString' to 'array'
-                                     + 1; // preparation for pre-decrement
+    // And we are now ready to look at the lowest-order word.
 
-    while (ii >= 8) {
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
+    return ret + BitUtil::numBitsSet(bitString[0] & ge64Raw(beginPos));
+}
 
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-    }
+size_t BitStringUtil::num1And(const uint64_t *bitString1,
+                              const uint64_t *bitString2,
+                              size_t          numBits)
+{
+    BSLS_ASSERT(bitString1);
+    BSLS_ASSERT(bitString2);
 
-    BSLS_ASSERT(ii < 8);
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+    const int    lastPos  = u32(numBits) % k_BITS_PER_UINT64;
 
-    switch (ii) {
-      case 7: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 6: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 5: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 4: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 3: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 2: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      case 1: ret += BitUtil::numBitsSet(array[--ii]);             FALLTHROUGH;
-      default:                                                     break;
-    }
+    size_t ret = BitStringUtil_Impl::num1AndWords(kernelFor(numWords),
+                                                  bitString1,
+                                                  bitString2,
+                                                  numWords);
 
-    BSLS_ASSERT(0 == ii);
-
-    // And we are now ready to look at the lowest-order word.
+    if (lastPos) {
+        ret += BitUtil::numBitsSet(bitString1[numWords] &
+                                   bitString2[numWords] & lt64Raw(lastPos));
+    }
 
-    return ret + BitUtil::numBitsSet(bitString[0] & ge64Raw(beginPos));
+    return ret;
 }
 
 bsl::ostream& BitStringUtil::print(bsl::ostream&   stream,
@@ -2246,6 +2870,160 @@ bsl::ostream& BitStringUtil::print(bsl::ostream&   stream,
     return stream;
 }
 
+                         // -------------------------
+                         // struct BitStringUtil_Impl
+                         // -------------------------
+
+// CLASS METHODS
+bool BitStringUtil_Impl::isKernelSupported(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#if defined(U_X86_SIMD)
+      case e_AVX2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");                        // RETURN
+      }
+      case e_AVX512: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f")
+            && __builtin_cpu_supports("avx512vpopcntdq");             // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+BitStringUtil_Impl::Kernel BitStringUtil_Impl::selectedKernel()
+{
+    int kernel = bsls::AtomicOperations::getIntRelaxed(&s_selectedKernel);
+    if (kernel < 0) {
+        // Racing threads store the same value.
+
+        kernel = isKernelSupported(e_AVX512) ? e_AVX512
+               : isKernelSupported(e_AVX2)   ? e_AVX2
+               :                               e_SCALAR;
+
+        bsls::AtomicOperations::setIntRelaxed(&s_selectedKernel, kernel);
+    }
+
+    return static_cast<Kernel>(kernel);
+}
+
+void BitStringUtil_Impl::andEqWords(Kernel          kernel,
+                                    uint64_t       *dstWords,
+                                    const uint64_t *srcWords,
+                                    size_t          numWords)
+{
+    BSLS_ASSERT(dstWords || 0 == numWords);
+    BSLS_ASSERT(srcWords || 0 == numWords);
+
+    applyWords<e_AND>(kernel, dstWords, srcWords, numWords);
+}
+
+void BitStringUtil_Impl::minusEqWords(Kernel          kernel,
+                                      uint64_t       *dstWords,
+                                      const uint64_t *srcWords,
+                                      size_t          numWords)
+{
+    BSLS_ASSERT(dstWords || 0 == numWords);
+    BSLS_ASSERT(srcWords || 0 == numWords);
+
+    applyWords<e_MINUS>(kernel, dstWords, srcWords, numWords);
+}
+
+void BitStringUtil_Impl::orEqWords(Kernel          kernel,
+                                   uint64_t       *dstWords,
+                                   const uint64_t *srcWords,
+                                   size_t          numWords)
+{
+    BSLS_ASSERT(dstWords || 0 == numWords);
+    BSLS_ASSERT(srcWords || 0 == numWords);
+
+    applyWords<e_OR>(kernel, dstWords, srcWords, numWords);
+}
+
+void BitStringUtil_Impl::xorEqWords(Kernel          kernel,
+                                    uint64_t       *dstWords,
+                                    const uint64_t *srcWords,
+                                    size_t          numWords)
+{
+    BSLS_ASSERT(dstWords || 0 == numWords);
+    BSLS_ASSERT(srcWords || 0 == numWords);
+
+    applyWords<e_XOR>(kernel, dstWords, srcWords, numWords);
+}
+
+size_t BitStringUtil_Impl::findWordNotEqual(Kernel          kernel,
+                                            const uint64_t *words,
+                                            size_t          numWords,
+                                            uint64_t        value)
+{
+    BSLS_ASSERT(words || 0 == numWords);
+
+    switch (kernel) {
+#if defined(U_X86_SIMD)
+      case e_AVX512: {
+        return findWordNotEqualAvx512(words, numWords, value);        // RETURN
+      }
+      case e_AVX2: {
+        return findWordNotEqualAvx2(words, numWords, value);          // RETURN
+      }
+#endif
+      default: {
+        return findWordNotEqualScalar(words, numWords, value);        // RETURN
+      }
+    }
+}
+
+size_t BitStringUtil_Impl::num1Words(Kernel          kernel,
+                                     const uint64_t *words,
+                                     size_t          numWords)
+{
+    BSLS_ASSERT(words || 0 == numWords);
+
+    switch (kernel) {
+#if defined(U_X86_SIMD)
+      case e_AVX512: {
+        return num1WordsAvx512(words, numWords);                      // RETURN
+      }
+      case e_AVX2: {
+        return num1WordsAvx2(words, numWords);                        // RETURN
+      }
+#endif
+      default: {
+        return num1WordsScalar(words, numWords);                      // RETURN
+      }
+    }
+}
+
+size_t BitStringUtil_Impl::num1AndWords(Kernel          kernel,
+                                        const uint64_t *words1,
+                                        const uint64_t *words2,
+                                        size_t          numWords)
+{
+    BSLS_ASSERT(words1 || 0 == numWords);
+    BSLS_ASSERT(words2 || 0 == numWords);
+
+    switch (kernel) {
+#if defined(U_X86_SIMD)
+      case e_AVX512: {
+        return num1AndWordsAvx512(words1, words2, numWords);          // RETURN
+      }
+      case e_AVX2: {
+        return num1AndWordsAvx2(words1, words2, numWords);            // RETURN
+      }
+#endif
+      default: {
+        return num1AndWordsScalar(words1, words2, numWords);          // RETURN
+      }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 // bdlb::BitStringUtil: namespace for common bit-manipulation procedures
+// bdlb::BitStringUtil_Impl: alternative implementations of bulk operations
 //
 //@SEE_ALSO: bdlb_bitutil, bdlb_bitmaskutil, bdlb_bitstringimputil,
 //           bdlc_bitarray
@@ -199,15 +200,18 @@ BSLS_IDENT("$Id: $")
 //
 //                                     Count
 // +--------------------------------------------------------------------------+
-// | isAny0 | Return 'true' if any bit in a range is 0, and 'false'           |
-// |        | otherwise.                                                      |
+// | isAny0  | Return 'true' if any bit in a range is 0, and 'false'          |
+// |         | otherwise.                                                     |
 // +--------------------------------------------------------------------------+
-// | isAny1 | Return 'true' if any bit in a range is 1, and 'false'           |
-// |        | otherwise.                                                      |
+// | isAny1  | Return 'true' if any bit in a range is 1, and 'false'          |
+// |         | otherwise.                                                     |
 // +--------------------------------------------------------------------------+
-// | num0   | Return the number of 0 bits in a range.                         |
+// | num0    | Return the number of 0 bits in a range.                        |
 // +--------------------------------------------------------------------------+
-// | num1   | Return the number of 1 bits in a range.                         |
+// | num1    | Return the number of 1 bits in a range.                        |
+// +--------------------------------------------------------------------------+
+// | num1And | Return the number of 1 bits in the bitwise-AND of two bit      |
+// |         | strings, without materializing the intersection.               |
 // +--------------------------------------------------------------------------+
 //
 //
@@ -218,6 +222,24 @@ BSLS_IDENT("$Id: $")
 //
 //..
 //
+///Vectorized Implementations
+///--------------------------
+// The bulk of the work of the bitwise-logical operations ('andEqual',
+// 'minusEqual', 'orEqual', and 'xorEqual'), of the counting operations
+// ('isAny0', 'isAny1', 'num0', 'num1', and 'num1And'), and of the forward
+// searches ('find0AtMinIndex' and 'find1AtMinIndex') is done on whole,
+// aligned words.  On x86-64 processors, those words are processed with the
+// widest of the following instruction set extensions that the processor on
+// which the program is running supports, selected on first use:
+//: o AVX-512 (including VPOPCNTDQ, 8 words at a time) is used if available,
+//:   else
+//: o AVX2 (4 words at a time) is used if available, else
+//: o the portable, word-at-a-time implementation is used.
+// Bit strings of fewer than 8 words are always processed word at a time.  The
+// results are identical for all implementations.  This component additionally
+// defines the struct 'bdlb::BitStringUtil_Impl' to expose the individual
+// implementations; it should not be used other than to test and benchmark.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -755,6 +777,17 @@ struct BitStringUtil {
         // undefined unless 'bitString' has a length of at least
         // 'index + numBits'.
 
+    static bsl::size_t num1And(const bsl::uint64_t *bitString1,
+                               const bsl::uint64_t *bitString2,
+                               bsl::size_t          numBits);
+        // Return the number of 1 bits in the bitwise AND of the specified
+        // low-order 'numBits' in the specified 'bitString1' and the
+        // corresponding bits in the specified 'bitString2'.  The behavior is
+        // undefined unless both 'bitString1' and 'bitString2' have a length
+        // of at least 'numBits'.  Note that this function has the same result
+        // as, but is more efficient than, 'num1' applied to a copy of
+        // 'bitString1' that has been 'andEqual'ed with 'bitString2'.
+
                                 // Printing
 
     static bsl::ostream& print(bsl::ostream&        stream,
@@ -775,6 +808,93 @@ struct BitStringUtil {
         // that a trailing newline is provided in multiline mode only.
 };
 
+                         // =========================
+                         // struct BitStringUtil_Impl
+                         // =========================
+
+struct BitStringUtil_Impl {
+    // This 'struct' provides a namespace for the alternative implementations
+    // of the operations on whole words to which 'BitStringUtil' delegates the
+    // bulk of its work, which should not be used other than to test and
+    // benchmark.  Each function operates on arrays of 'uint64_t' words, rather
+    // than on bit strings addressed by bit index.
+
+    // TYPES
+    enum Kernel {
+        // Enumerate the implementations that may be selected.
+
+        e_SCALAR,   // portable, one word at a time
+        e_AVX2,     // x86 AVX2, 4 words at a time
+        e_AVX512    // x86 AVX-512 with VPOPCNTDQ, 8 words at a time
+    };
+
+    // CLASS METHODS
+    static bool isKernelSupported(Kernel kernel);
+        // Return 'true' if the specified 'kernel' is compiled into this
+        // library and supported by the processor on which this program is
+        // running, and 'false' otherwise.
+
+    static Kernel selectedKernel();
+        // Return the implementation used by the functions of 'BitStringUtil'
+        // running on this processor.
+
+    static void andEqWords(Kernel               kernel,
+                           bsl::uint64_t       *dstWords,
+                           const bsl::uint64_t *srcWords,
+                           bsl::size_t          numWords);
+    static void minusEqWords(Kernel               kernel,
+                             bsl::uint64_t       *dstWords,
+                             const bsl::uint64_t *srcWords,
+                             bsl::size_t          numWords);
+    static void orEqWords(Kernel               kernel,
+                          bsl::uint64_t       *dstWords,
+                          const bsl::uint64_t *srcWords,
+                          bsl::size_t          numWords);
+    static void xorEqWords(Kernel               kernel,
+                           bsl::uint64_t       *dstWords,
+                           const bsl::uint64_t *srcWords,
+                           bsl::size_t          numWords);
+        // Apply, using the specified 'kernel', the bitwise AND (respectively,
+        // MINUS, OR, and XOR) of each of the specified 'numWords' words of
+        // the specified 'dstWords' with the corresponding word of the
+        // specified 'srcWords', and write the result over the word of
+        // 'dstWords', proceeding from the lowest to the highest address.  The
+        // behavior is undefined unless 'isKernelSupported(kernel)' is 'true',
+        // 'dstWords' and 'srcWords' each refer to an array of at least
+        // 'numWords' words, and either 'dstWords' is not above 'srcWords' or
+        // the two arrays do not overlap.
+
+    static bsl::size_t findWordNotEqual(Kernel               kernel,
+                                        const bsl::uint64_t *words,
+                                        bsl::size_t          numWords,
+                                        bsl::uint64_t        value);
+        // Return, using the specified 'kernel', the index of the first of the
+        // specified 'numWords' words in the specified 'words' that is not
+        // equal to the specified 'value', or 'numWords' if there is no such
+        // word.  The behavior is undefined unless 'isKernelSupported(kernel)'
+        // is 'true' and 'words' refers to an array of at least 'numWords'
+        // words.
+
+    static bsl::size_t num1Words(Kernel               kernel,
+                                 const bsl::uint64_t *words,
+                                 bsl::size_t          numWords);
+        // Return, using the specified 'kernel', the number of 1 bits in the
+        // specified 'numWords' words in the specified 'words'.  The behavior
+        // is undefined unless 'isKernelSupported(kernel)' is 'true' and
+        // 'words' refers to an array of at least 'numWords' words.
+
+    static bsl::size_t num1AndWords(Kernel               kernel,
+                                    const bsl::uint64_t *words1,
+                                    const bsl::uint64_t *words2,
+                                    bsl::size_t          numWords);
+        // Return, using the specified 'kernel', the number of 1 bits in the
+        // bitwise AND of each of the specified 'numWords' words in the
+        // specified 'words1' with the corresponding word in the specified
+        // 'words2'.  The behavior is undefined unless
+        // 'isKernelSupported(kernel)' is 'true' and 'words1' and 'words2'
+        // each refer to an array of at least 'numWords' words.
+};
+
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
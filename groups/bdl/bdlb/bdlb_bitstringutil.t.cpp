@@ -8,12 +8,14 @@
 #include <bsls_alignmentfromtype.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstddef.h>     // 'bsl::size_t'
 #include <bsl_cstdlib.h>     // 'bsl::rand'
@@ -79,9 +81,22 @@ using bsl::flush;
 // [ 6] bool isAny1(const uint64_t *bitString, St index, St numBits);
 // [13] St num0(const uint64_t *bitString, St index, St numBits);
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
+// [23] St num1And(const U64 *bS1, const U64 *bS2, St numBits);
+//
+// CLASS METHODS: 'BitStringUtil_Impl'
+// [24] bool isKernelSupported(Kernel);
+// [24] Kernel selectedKernel();
+// [24] void andEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+// [24] void minusEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+// [24] void orEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+// [24] void xorEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+// [24] St findWordNotEqual(Kernel, const U64 *w, St nw, U64 value);
+// [24] St num1Words(Kernel, const U64 *w, St nw);
+// [24] St num1AndWords(Kernel, const U64 *w1, const U64 *w2, St nw);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
+// [-1] PERFORMANCE OF 'BitStringUtil_Impl' KERNELS
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -961,7 +976,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1126,482 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING 'BitStringUtil_Impl'
+        //
+        // Concerns:
+        //: 1 Every kernel reported as supported produces the same results as
+        //:   the scalar kernel for every function, for every number of words,
+        //:   including numbers of words that are not a multiple of the width
+        //:   of the kernel.
+        //:
+        //: 2 The bitwise-logical functions modify exactly the specified number
+        //:   of words, and produce the expected results when the destination
+        //:   array overlaps the source array from below, or is the source
+        //:   array.
+        //:
+        //: 3 'findWordNotEqual' locates the first differing word wherever it
+        //:   occurs relative to the blocks of words processed by the kernel.
+        //:
+        //: 4 The kernel used by 'BitStringUtil' is supported.
+        //:
+        //: 5 Long bit strings, processed by 'BitStringUtil' using the selected
+        //:   kernel, produce the same results as the oracles, including when
+        //:   the ranges of bits overlap.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each supported kernel, for every number of words up to
+        //:   several blocks of the widest kernel, apply each function to
+        //:   pseudo-random words, and compare the results with those of the
+        //:   scalar kernel, and with a simple loop.  Verify that words past
+        //:   the end of the destination are unchanged.  (C-1)
+        //:
+        //: 2 Repeat the bitwise-logical operations with the destination array
+        //:   at each of several offsets below the source array within the same
+        //:   buffer, and with the destination array being the source array,
+        //:   and compare with a word-at-a-time loop.  (C-2)
+        //:
+        //: 3 For each supported kernel, for every number of words, and for
+        //:   every position of the first differing word, and each of the
+        //:   values 0, ~0, and a pseudo-random value, verify the result of
+        //:   'findWordNotEqual'.  (C-3)
+        //:
+        //: 4 Verify that 'selectedKernel' is supported.  (C-4)
+        //:
+        //: 5 Apply the bitwise-logical, find, and count operations of
+        //:   'BitStringUtil' to pseudo-random bit strings of several dozen
+        //:   words, at pseudo-random indices, including overlapping ranges
+        //:   within a single bit string, and compare the results with the
+        //:   oracles.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values, but not triggered for
+        //:   adjacent valid ones (using the 'BSLS_ASSERTTEST_*' macros).
+        //:   (C-6)
+        //
+        // Testing:
+        //   bool isKernelSupported(Kernel);
+        //   Kernel selectedKernel();
+        //   void andEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+        //   void minusEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+        //   void orEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+        //   void xorEqWords(Kernel, U64 *dst, const U64 *src, St nw);
+        //   St findWordNotEqual(Kernel, const U64 *w, St nw, U64 value);
+        //   St num1Words(Kernel, const U64 *w, St nw);
+        //   St num1AndWords(Kernel, const U64 *w1, const U64 *w2, St nw);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'BitStringUtil_Impl'\n"
+                               "============================\n";
+
+        typedef bdlb::BitStringUtil_Impl Impl;
+
+        const Impl::Kernel KERNELS[] = { Impl::e_SCALAR,
+                                         Impl::e_AVX2,
+                                         Impl::e_AVX512 };
+        enum { NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+        typedef void (*OperationFn)(Impl::Kernel, uint64_t *,
+                                    const uint64_t *, size_t);
+
+        const OperationFn OPERATIONS[] = { &Impl::andEqWords,
+                                           &Impl::minusEqWords,
+                                           &Impl::orEqWords,
+                                           &Impl::xorEqWords };
+        enum { NUM_OPERATIONS = sizeof OPERATIONS / sizeof *OPERATIONS };
+
+        ASSERT(Impl::isKernelSupported(Impl::e_SCALAR));
+        ASSERT(Impl::isKernelSupported(Impl::selectedKernel()));
+
+        if (verbose) P(Impl::selectedKernel());
+
+        enum { k_MAX_WORDS = 40, k_PAD = 8 };
+
+        uint64_t src[k_MAX_WORDS + k_PAD];
+        uint64_t dst[k_MAX_WORDS + k_PAD];
+        uint64_t exp[k_MAX_WORDS + k_PAD];
+        uint64_t buf[k_MAX_WORDS + k_PAD];
+
+        if (verbose) cout << "Compare the kernels with simple loops.\n";
+
+        for (int ki = 0; ki < NUM_KERNELS; ++ki) {
+            const Impl::Kernel KERNEL = KERNELS[ki];
+
+            if (!Impl::isKernelSupported(KERNEL)) {
+                if (verbose) cout << "Kernel " << KERNEL << " unsupported\n";
+                continue;
+            }
+
+            for (size_t nw = 0; nw <= k_MAX_WORDS; ++nw) {
+                for (int oi = 0; oi < NUM_OPERATIONS; ++oi) {
+                    fillWithGarbage(src, sizeof(src));
+                    fillWithGarbage(dst, sizeof(dst));
+                    wordCpy(exp, dst, sizeof(exp));
+
+                    for (size_t ii = 0; ii < nw; ++ii) {
+                        switch (oi) {
+                          case 0: exp[ii] &=  src[ii]; break;
+                          case 1: exp[ii] &= ~src[ii]; break;
+                          case 2: exp[ii] |=  src[ii]; break;
+                          case 3: exp[ii] ^=  src[ii]; break;
+                        }
+                    }
+
+                    OPERATIONS[oi](KERNEL, dst, src, nw);
+                    ASSERTV(KERNEL, nw, oi,
+                            0 == wordCmp(dst, exp, sizeof(dst)));
+
+                    // Overlap the destination with the source from below.
+
+                    for (size_t offset = 0; offset <= 5; ++offset) {
+                        fillWithGarbage(buf, sizeof(buf));
+                        wordCpy(exp, buf, sizeof(exp));
+
+                        for (size_t ii = 0; ii < nw; ++ii) {
+                            const uint64_t s = exp[ii + offset];
+                            switch (oi) {
+                              case 0: exp[ii] &=  s; break;
+                              case 1: exp[ii] &= ~s; break;
+                              case 2: exp[ii] |=  s; break;
+                              case 3: exp[ii] ^=  s; break;
+                            }
+                        }
+
+                        OPERATIONS[oi](KERNEL, buf, buf + offset, nw);
+                        ASSERTV(KERNEL, nw, oi, offset,
+                                0 == wordCmp(buf, exp, sizeof(buf)));
+                    }
+                }
+
+                fillWithGarbage(src, sizeof(src));
+                fillWithGarbage(dst, sizeof(dst));
+
+                // Make some of the words sparse, so that the counts differ
+                // from their mean.
+
+                for (size_t ii = 0; ii < nw; ii += 3) {
+                    src[ii] &= src[ii] >> 7;
+                }
+
+                size_t expNum1    = 0;
+                size_t expNum1And = 0;
+                for (size_t ii = 0; ii < nw; ++ii) {
+                    expNum1    += countOnes(&src[ii], 0, k_BITS_PER_UINT64);
+                    const uint64_t both = src[ii] & dst[ii];
+                    expNum1And += countOnes(&both, 0, k_BITS_PER_UINT64);
+                }
+
+                ASSERTV(KERNEL, nw,
+                        expNum1 == Impl::num1Words(KERNEL, src, nw));
+                ASSERTV(KERNEL, nw,
+                        expNum1And == Impl::num1AndWords(KERNEL,
+                                                         src,
+                                                         dst,
+                                                         nw));
+                ASSERTV(KERNEL, nw,
+                        expNum1 == Impl::num1AndWords(KERNEL, src, src, nw));
+
+                // 'findWordNotEqual'
+
+                const uint64_t VALUES[] = { 0, ~0ULL, src[k_MAX_WORDS] };
+                enum { NUM_VALUES = sizeof VALUES / sizeof *VALUES };
+
+                for (int vi = 0; vi < NUM_VALUES; ++vi) {
+                    const uint64_t VALUE = VALUES[vi];
+
+                    bsl::fill(buf, buf + k_MAX_WORDS + k_PAD, VALUE);
+                    ASSERTV(KERNEL, nw, vi,
+                            nw == Impl::findWordNotEqual(KERNEL,
+                                                         buf,
+                                                         nw,
+                                                         VALUE));
+
+                    for (size_t pos = 0; pos < nw; ++pos) {
+                        buf[pos] = VALUE ^ (1ULL << (pos % 64));
+
+                        ASSERTV(KERNEL, nw, vi, pos,
+                                pos == Impl::findWordNotEqual(KERNEL,
+                                                              buf,
+                                                              nw,
+                                                              VALUE));
+
+                        // A second differing word does not matter.
+
+                        buf[nw - 1] = ~VALUE;
+                        ASSERTV(KERNEL, nw, vi, pos,
+                                pos == Impl::findWordNotEqual(KERNEL,
+                                                              buf,
+                                                              nw,
+                                                              VALUE));
+                        buf[nw - 1] = VALUE;
+                        buf[pos]    = VALUE;
+                    }
+
+                    // Words beyond 'nw' are not examined.
+
+                    buf[nw] = ~VALUE;
+                    ASSERTV(KERNEL, nw, vi,
+                            nw == Impl::findWordNotEqual(KERNEL,
+                                                         buf,
+                                                         nw,
+                                                         VALUE));
+                }
+            }
+        }
+
+        if (verbose) cout << "Long bit strings with the selected kernel.\n";
+        {
+            enum { k_NUM_WORDS = 3 * k_MAX_WORDS / 2 };
+
+            const size_t NUM_BITS = k_NUM_WORDS * k_BITS_PER_UINT64;
+
+            uint64_t control[k_NUM_WORDS];
+            uint64_t other[k_NUM_WORDS];
+            uint64_t bits[k_NUM_WORDS];
+            uint64_t expBits[k_NUM_WORDS];
+
+            for (int ti = 0; ti < 2000; ++ti) {
+                fillWithGarbage(control, sizeof(control));
+                fillWithGarbage(other,   sizeof(other));
+
+                // Make the bit strings mostly 0 (or mostly 1) in half of the
+                // iterations, so that the find operations scan far.
+
+                if (ti & 1) {
+                    const uint64_t FILL = ti & 2 ? ~0ULL : 0;
+                    for (size_t ii = 0; ii < k_NUM_WORDS; ++ii) {
+                        if (control[ii] % 16) {
+                            control[ii] = FILL;
+                        }
+                    }
+                }
+
+                const size_t IDX1 = control[0] % NUM_BITS;
+                const size_t IDX2 = other[0]   % NUM_BITS;
+                const size_t MAX  = NUM_BITS - bsl::max(IDX1, IDX2);
+                const size_t NB   = other[1] % (MAX + 1);
+                const int    OP   = ti % 4;
+
+                // Between two bit strings, at word-aligned indices in a
+                // quarter of the iterations.
+
+                const size_t DST_IDX = ti % 8 < 2 ? IDX1 & ~63ULL : IDX1;
+                const size_t SRC_IDX = ti % 8 < 2 ? IDX2 & ~63ULL : IDX2;
+
+                wordCpy(bits,    control, sizeof(bits));
+                wordCpy(expBits, control, sizeof(bits));
+
+                switch (OP) {
+                  case 0: {
+                    andOracle(expBits, DST_IDX, other, SRC_IDX, NB);
+                    Util::andEqual(bits, DST_IDX, other, SRC_IDX, NB);
+                  } break;
+                  case 1: {
+                    minusOracle(expBits, DST_IDX, other, SRC_IDX, NB);
+                    Util::minusEqual(bits, DST_IDX, other, SRC_IDX, NB);
+                  } break;
+                  case 2: {
+                    orOracle(expBits, DST_IDX, other, SRC_IDX, NB);
+                    Util::orEqual(bits, DST_IDX, other, SRC_IDX, NB);
+                  } break;
+                  case 3: {
+                    xorOracle(expBits, DST_IDX, other, SRC_IDX, NB);
+                    Util::xorEqual(bits, DST_IDX, other, SRC_IDX, NB);
+                  } break;
+                }
+                ASSERTV(ti, OP, DST_IDX, SRC_IDX, NB,
+                        0 == wordCmp(bits, expBits, sizeof(bits)));
+
+                // Within a single bit string, the source being a copy.
+
+                wordCpy(bits,    control, sizeof(bits));
+                wordCpy(expBits, control, sizeof(bits));
+
+                switch (OP) {
+                  case 0: {
+                    andOracle(expBits, DST_IDX, control, SRC_IDX, NB);
+                    Util::andEqual(bits, DST_IDX, bits, SRC_IDX, NB);
+                  } break;
+                  case 1: {
+                    minusOracle(expBits, DST_IDX, control, SRC_IDX, NB);
+                    Util::minusEqual(bits, DST_IDX, bits, SRC_IDX, NB);
+                  } break;
+                  case 2: {
+                    orOracle(expBits, DST_IDX, control, SRC_IDX, NB);
+                    Util::orEqual(bits, DST_IDX, bits, SRC_IDX, NB);
+                  } break;
+                  case 3: {
+                    xorOracle(expBits, DST_IDX, control, SRC_IDX, NB);
+                    Util::xorEqual(bits, DST_IDX, bits, SRC_IDX, NB);
+                  } break;
+                }
+                ASSERTV(ti, OP, DST_IDX, SRC_IDX, NB,
+                        0 == wordCmp(bits, expBits, sizeof(bits)));
+
+                // Find and count.
+
+                const size_t BEGIN = bsl::min(IDX1, IDX2);
+                const size_t END   = BEGIN + NB;
+
+                ASSERTV(ti, BEGIN, END,
+                        findAtMinOracle(control, BEGIN, END, true) ==
+                               Util::find1AtMinIndex(control, BEGIN, END));
+                ASSERTV(ti, BEGIN, END,
+                        findAtMinOracle(control, BEGIN, END, false) ==
+                               Util::find0AtMinIndex(control, BEGIN, END));
+                ASSERTV(ti, END,
+                        findAtMinOracle(control, 0, END, true) ==
+                                       Util::find1AtMinIndex(control, END));
+                ASSERTV(ti, END,
+                        findAtMinOracle(control, 0, END, false) ==
+                                       Util::find0AtMinIndex(control, END));
+
+                const size_t NUM1 = countOnes(control, BEGIN, NB);
+
+                ASSERTV(ti, BEGIN, NB,
+                        NUM1 == Util::num1(control, BEGIN, NB));
+                ASSERTV(ti, BEGIN, NB,
+                        (0 < NUM1) == Util::isAny1(control, BEGIN, NB));
+                ASSERTV(ti, BEGIN, NB,
+                        (NUM1 < NB) == Util::isAny0(control, BEGIN, NB));
+            }
+        }
+
+        if (verbose) cout << "Negative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Impl::Kernel K = Impl::e_SCALAR;
+
+            ASSERT_PASS(Impl::andEqWords(K, dst, src, 1));
+            ASSERT_FAIL(Impl::andEqWords(K,   0, src, 1));
+            ASSERT_FAIL(Impl::andEqWords(K, dst,   0, 1));
+            ASSERT_PASS(Impl::andEqWords(K,   0,   0, 0));
+
+            ASSERT_PASS(Impl::minusEqWords(K, dst, src, 1));
+            ASSERT_FAIL(Impl::minusEqWords(K,   0, src, 1));
+            ASSERT_FAIL(Impl::minusEqWords(K, dst,   0, 1));
+            ASSERT_PASS(Impl::minusEqWords(K,   0,   0, 0));
+
+            ASSERT_PASS(Impl::orEqWords(K, dst, src, 1));
+            ASSERT_FAIL(Impl::orEqWords(K,   0, src, 1));
+            ASSERT_FAIL(Impl::orEqWords(K, dst,   0, 1));
+            ASSERT_PASS(Impl::orEqWords(K,   0,   0, 0));
+
+            ASSERT_PASS(Impl::xorEqWords(K, dst, src, 1));
+            ASSERT_FAIL(Impl::xorEqWords(K,   0, src, 1));
+            ASSERT_FAIL(Impl::xorEqWords(K, dst,   0, 1));
+            ASSERT_PASS(Impl::xorEqWords(K,   0,   0, 0));
+
+            ASSERT_PASS(Impl::findWordNotEqual(K, src, 1, 0));
+            ASSERT_FAIL(Impl::findWordNotEqual(K,   0, 1, 0));
+            ASSERT_PASS(Impl::findWordNotEqual(K,   0, 0, 0));
+
+            ASSERT_PASS(Impl::num1Words(K, src, 1));
+            ASSERT_FAIL(Impl::num1Words(K,   0, 1));
+            ASSERT_PASS(Impl::num1Words(K,   0, 0));
+
+            ASSERT_PASS(Impl::num1AndWords(K, src, dst, 1));
+            ASSERT_FAIL(Impl::num1AndWords(K,   0, dst, 1));
+            ASSERT_FAIL(Impl::num1AndWords(K, src,   0, 1));
+            ASSERT_PASS(Impl::num1AndWords(K,   0,   0, 0));
+        }
+      } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING 'num1And'
+        //   Ensure the method returns the expected value.
+        //
+        // Concerns:
+        //: 1 The return value of 'num1And' is the number of 1 bits in the
+        //:   bitwise AND of the specified low-order bits of the two bit
+        //:   strings.
+        //:
+        //: 2 Bits beyond the specified number of bits do not affect the
+        //:   result.
+        //:
+        //: 3 The function operates correctly on bit strings longer than the
+        //:   minimum number of words processed by the vectorized kernels.
+        //:
+        //: 4 The bit strings are not modified, and may be the same bit string.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Iterate on garbage data, some of it sparse, of length longer
+        //:   than 8 words, over the number of bits.  Compare the result of
+        //:   'num1And' with that of 'countOnes' applied to a copy of the first
+        //:   bit string that has been AND-ed with the second by 'andOracle'.
+        //:   (C-1..3)
+        //:
+        //: 2 After each call, verify that the bit strings have not been
+        //:   modified, and verify that 'num1And' of a bit string with itself
+        //:   is 'num1' of that bit string.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-5)
+        //
+        // Testing:
+        //   St num1And(const U64 *bS1, const U64 *bS2, St numBits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'num1And'\n"
+                               "=================\n";
+
+        const int    MULTIPLE = 5;
+        const int    DIM      = SET_UP_ARRAY_DIM * MULTIPLE;
+        const size_t NUM_BITS = DIM * k_BITS_PER_UINT64;
+
+        uint64_t lhs[DIM], rhs[DIM], lhsControl[DIM], rhsControl[DIM];
+        uint64_t tmp[DIM];
+
+        for (int ii = 0; ii < 150; ++ii) {
+            fillWithGarbage(lhsControl, sizeof(lhsControl));
+            fillWithGarbage(rhsControl, sizeof(rhsControl));
+
+            if (ii & 1) {
+                for (int jj = 0; jj < DIM; ++jj) {
+                    lhsControl[jj] &= lhsControl[jj] >> (ii % 13);
+                }
+            }
+
+            wordCpy(lhs, lhsControl, sizeof(lhs));
+            wordCpy(rhs, rhsControl, sizeof(rhs));
+
+            if (veryVerbose) {
+                P_(ii);    P(pHex(lhs, NUM_BITS));
+            }
+            for (size_t numBits = 0; numBits <= NUM_BITS;
+                                                incSizeT(&numBits, NUM_BITS)) {
+                wordCpy(tmp, lhs, sizeof(tmp));
+                andOracle(tmp, 0, rhs, 0, numBits);
+
+                const size_t EXP = countOnes(tmp, 0, numBits);
+
+                ASSERTV(ii, numBits, EXP,
+                        EXP == Util::num1And(lhs, rhs, numBits));
+                ASSERTV(ii, numBits, EXP,
+                        EXP == Util::num1And(rhs, lhs, numBits));
+                ASSERT(0 == wordCmp(lhs, lhsControl, sizeof(lhs)));
+                ASSERT(0 == wordCmp(rhs, rhsControl, sizeof(rhs)));
+
+                ASSERTV(ii, numBits, Util::num1(lhs, 0, numBits) ==
+                                          Util::num1And(lhs, lhs, numBits));
+            }
+        }
+
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_PASS(Util::num1And(lhs, rhs, 0));
+            ASSERT_PASS(Util::num1And(lhs, rhs, NUM_BITS));
+            ASSERT_FAIL(Util::num1And(  0, rhs, 0));
+            ASSERT_FAIL(Util::num1And(lhs,   0, 0));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
@@ -6007,6 +6498,114 @@ int main(int argc, char *argv[])
 
         if (veryVerbose) P(k_ALIGNMENT);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF 'BitStringUtil_Impl' KERNELS
+        //
+        // Concerns:
+        //: 1 The vectorized kernels perform the bulk operations faster than
+        //:   the scalar kernel.
+        //
+        // Plan:
+        //: 1 For bit strings of several lengths, report the throughput of
+        //:   each supported kernel for 'andEqWords', 'findWordNotEqual',
+        //:   'num1Words', and 'num1AndWords'.
+        //
+        // Testing:
+        //   PERFORMANCE OF 'BitStringUtil_Impl' KERNELS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE OF 'BitStringUtil_Impl' KERNELS\n"
+                             "===========================================\n";
+
+        typedef bdlb::BitStringUtil_Impl Impl;
+
+        const Impl::Kernel KERNELS[] = { Impl::e_SCALAR,
+                                         Impl::e_AVX2,
+                                         Impl::e_AVX512 };
+        const char *const  NAMES[]   = { "scalar", "avx2", "avx512" };
+        enum { NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+        const size_t NUM_WORDS[] = { 16, 256, 4096, 1 << 16 };
+        enum { NUM_LENGTHS = sizeof NUM_WORDS / sizeof *NUM_WORDS };
+
+        const size_t TOTAL_WORDS = 1 << 27;
+
+        bsl::vector<uint64_t> lhs(NUM_WORDS[NUM_LENGTHS - 1]);
+        bsl::vector<uint64_t> rhs(NUM_WORDS[NUM_LENGTHS - 1], 0);
+        fillWithGarbage(lhs.data(), lhs.size() * sizeof(uint64_t));
+
+        // 'rhs' is all 0 except for its last word, so 'findWordNotEqual'
+        // scans the whole bit string.
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const size_t NW         = NUM_WORDS[li];
+            const size_t ITERATIONS = TOTAL_WORDS / NW;
+            const double MB         = static_cast<double>(TOTAL_WORDS) *
+                                              sizeof(uint64_t) / (1 << 20);
+
+            rhs[NW - 1] = 1;
+
+            cout << NW << " words:\n";
+
+            for (int ki = 0; ki < NUM_KERNELS; ++ki) {
+                const Impl::Kernel KERNEL = KERNELS[ki];
+
+                if (!Impl::isKernelSupported(KERNEL)) {
+                    continue;
+                }
+
+                size_t          sum = 0;
+                bsls::Stopwatch timer;
+
+                timer.start();
+                for (size_t ii = 0; ii < ITERATIONS; ++ii) {
+                    Impl::xorEqWords(KERNEL, lhs.data(), rhs.data(), NW);
+                }
+                timer.stop();
+                const double XOR_RATE = MB / timer.elapsedTime();
+
+                timer.reset();
+                timer.start();
+                for (size_t ii = 0; ii < ITERATIONS; ++ii) {
+                    sum += Impl::findWordNotEqual(KERNEL, rhs.data(), NW, 0);
+                }
+                timer.stop();
+                const double FIND_RATE = MB / timer.elapsedTime();
+                ASSERTV(ki, NW, (NW - 1) * ITERATIONS == sum);
+
+                sum = 0;
+                timer.reset();
+                timer.start();
+                for (size_t ii = 0; ii < ITERATIONS; ++ii) {
+                    sum += Impl::num1Words(KERNEL, lhs.data(), NW);
+                }
+                timer.stop();
+                const double NUM1_RATE = MB / timer.elapsedTime();
+
+                timer.reset();
+                timer.start();
+                for (size_t ii = 0; ii < ITERATIONS; ++ii) {
+                    sum += Impl::num1AndWords(KERNEL,
+                                              lhs.data(),
+                                              rhs.data(),
+                                              NW);
+                }
+                timer.stop();
+                const double NUM1_AND_RATE = MB / timer.elapsedTime();
+
+                ASSERTV(ki, NW, 0 < sum);
+
+                cout << "    " << NAMES[ki] << ":"
+                     << " xorEq " << XOR_RATE << " MB/s,"
+                     << " find " << FIND_RATE << " MB/s,"
+                     << " num1 " << NUM1_RATE << " MB/s,"
+                     << " num1And " << NUM1_AND_RATE << " MB/s\n";
+            }
+
+            rhs[NW - 1] = 0;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND.\n";
         testStatus = -1;
@@ -16,10 +16,13 @@ BSLS_IDENT_RCSID(bdlbb_blob_cpp, "$Id$ $CSID$")
 
 #include <bslalg_swaputil.h>
 
+#include <bslmf_assert.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 
@@ -31,8 +34,12 @@ BSLS_IDENT_RCSID(bdlbb_blob_cpp, "$Id$ $CSID$")
 namespace BloombergLP {
 namespace {
 
-typedef bsl::vector<bdlbb::BlobBuffer>::iterator       BlobBufferIterator;
-typedef bsl::vector<bdlbb::BlobBuffer>::const_iterator BlobBufferConstIterator;
+typedef bdlbb::Blob_BufferVector::iterator       BlobBufferIterator;
+typedef bdlbb::Blob_BufferVector::const_iterator BlobBufferConstIterator;
+
+// 'Blob_BufferVector' relocates its elements with 'memcpy' and 'memmove'.
+
+BSLMF_ASSERT(bslmf::IsBitwiseMoveable<bdlbb::BlobBuffer>::value);
 
                        // ==============================
                        // class InvalidBlobBufferFactory
@@ -170,6 +177,320 @@ bdlbb::swap(BlobBuffer& a, BlobBuffer& b)
 }
 
 
+namespace bdlbb {
+
+                          // -----------------------
+                          // class Blob_BufferVector
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+void Blob_BufferVector::destroyElements()
+{
+    BlobBuffer *elements = data();
+    for (int i = 0; i < d_size; ++i) {
+        elements[i].~BlobBuffer();
+    }
+    d_size = 0;
+}
+
+BlobBuffer *Blob_BufferVector::openGap(int index, int numElements)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= d_size);
+    BSLS_ASSERT(0 <= numElements);
+
+    const int newSize = d_size + numElements;
+
+    if (newSize <= d_capacity) {
+        BlobBuffer *elements = data();
+        bsl::memmove(static_cast<void *>(elements + index + numElements),
+                     static_cast<void *>(elements + index),
+                     (d_size - index) * sizeof(BlobBuffer));
+        d_size = newSize;
+        return elements + index;                                      // RETURN
+    }
+
+    int newCapacity = d_capacity * 2;
+    if (newCapacity < newSize) {
+        newCapacity = newSize;
+    }
+
+    BlobBuffer *newArray = static_cast<BlobBuffer *>(
+                          d_allocator_p->allocate(newCapacity *
+                                                  sizeof(BlobBuffer)));
+
+    BlobBuffer *elements = data();
+    bsl::memcpy(static_cast<void *>(newArray),
+                static_cast<void *>(elements),
+                index * sizeof(BlobBuffer));
+    bsl::memcpy(static_cast<void *>(newArray + index + numElements),
+                static_cast<void *>(elements + index),
+                (d_size - index) * sizeof(BlobBuffer));
+
+    if (d_array_p) {
+        d_allocator_p->deallocate(d_array_p);
+    }
+    d_array_p  = newArray;
+    d_capacity = newCapacity;
+    d_size     = newSize;
+    return newArray + index;
+}
+
+void Blob_BufferVector::moveFrom(Blob_BufferVector *original)
+{
+    BSLS_ASSERT(0 == d_size);
+
+    if (original->d_allocator_p != d_allocator_p) {
+        *this = *original;
+        return;                                                       // RETURN
+    }
+
+    if (original->d_array_p) {
+        if (d_array_p) {
+            d_allocator_p->deallocate(d_array_p);
+        }
+        d_array_p  = original->d_array_p;
+        d_size     = original->d_size;
+        d_capacity = original->d_capacity;
+
+        original->d_array_p  = 0;
+        original->d_size     = 0;
+        original->d_capacity = k_INLINE_CAPACITY;
+        return;                                                       // RETURN
+    }
+
+    // The elements are relocated bitwise, which moves them without touching
+    // their reference counts.  Inline elements always fit in the storage of
+    // this sequence, so this does not allocate.
+
+    BlobBuffer *elements = openGap(0, original->d_size);
+    bsl::memcpy(static_cast<void *>(elements),
+                static_cast<void *>(original->data()),
+                original->d_size * sizeof(BlobBuffer));
+    original->d_size = 0;
+}
+
+// CREATORS
+Blob_BufferVector::Blob_BufferVector(const BlobBuffer *first,
+                                     const BlobBuffer *last,
+                                     bslma::Allocator *basicAllocator)
+: d_array_p(0)
+, d_size(0)
+, d_capacity(k_INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(first <= last);
+
+    reserve(static_cast<int>(last - first));
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
+Blob_BufferVector::Blob_BufferVector(const Blob_BufferVector&  original,
+                                     bslma::Allocator         *basicAllocator)
+: d_array_p(0)
+, d_size(0)
+, d_capacity(k_INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    *this = original;
+}
+
+Blob_BufferVector::Blob_BufferVector(
+                                 bslmf::MovableRef<Blob_BufferVector> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_array_p(0)
+, d_size(0)
+, d_capacity(k_INLINE_CAPACITY)
+, d_allocator_p(bslmf::MovableRefUtil::access(original).d_allocator_p)
+{
+    moveFrom(&bslmf::MovableRefUtil::access(original));
+}
+
+Blob_BufferVector::Blob_BufferVector(
+                          bslmf::MovableRef<Blob_BufferVector>  original,
+                          bslma::Allocator                     *basicAllocator)
+: d_array_p(0)
+, d_size(0)
+, d_capacity(k_INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    moveFrom(&bslmf::MovableRefUtil::access(original));
+}
+
+Blob_BufferVector::~Blob_BufferVector()
+{
+    destroyElements();
+    if (d_array_p) {
+        d_allocator_p->deallocate(d_array_p);
+    }
+}
+
+// MANIPULATORS
+Blob_BufferVector& Blob_BufferVector::operator=(const Blob_BufferVector& rhs)
+{
+    if (this != &rhs) {
+        reserve(rhs.d_size);
+        destroyElements();
+
+        BlobBuffer       *elements    = data();
+        const BlobBuffer *rhsElements = rhs.begin();
+        for (; d_size < rhs.d_size; ++d_size) {
+            new (elements + d_size) BlobBuffer(rhsElements[d_size]);
+        }
+    }
+    return *this;
+}
+
+Blob_BufferVector& Blob_BufferVector::operator=(
+                                      bslmf::MovableRef<Blob_BufferVector> rhs)
+{
+    Blob_BufferVector& lvalue = rhs;
+
+    if (this != &lvalue) {
+        destroyElements();
+        moveFrom(&lvalue);
+    }
+    return *this;
+}
+
+void Blob_BufferVector::clear()
+{
+    destroyElements();
+}
+
+Blob_BufferVector::iterator Blob_BufferVector::erase(const_iterator position)
+{
+    return erase(position, position + 1);
+}
+
+Blob_BufferVector::iterator Blob_BufferVector::erase(const_iterator first,
+                                                     const_iterator last)
+{
+    BlobBuffer *elements = data();
+
+    BSLS_ASSERT(elements <= first);
+    BSLS_ASSERT(first <= last);
+    BSLS_ASSERT(last <= elements + d_size);
+
+    const int index       = static_cast<int>(first - elements);
+    const int numElements = static_cast<int>(last - first);
+
+    for (int i = index; i < index + numElements; ++i) {
+        elements[i].~BlobBuffer();
+    }
+    bsl::memmove(static_cast<void *>(elements + index),
+                 static_cast<void *>(elements + index + numElements),
+                 (d_size - index - numElements) * sizeof(BlobBuffer));
+    d_size -= numElements;
+
+    return elements + index;
+}
+
+Blob_BufferVector::iterator
+Blob_BufferVector::insert(const_iterator position, const BlobBuffer& value)
+{
+    // 'value' may be an element of this sequence, so copy it before the
+    // elements are shifted.
+
+    BlobBuffer copy(value);
+    return insert(position, bslmf::MovableRefUtil::move(copy));
+}
+
+Blob_BufferVector::iterator
+Blob_BufferVector::insert(const_iterator                position,
+                          bslmf::MovableRef<BlobBuffer> value)
+{
+    const int index = static_cast<int>(position - begin());
+
+    BlobBuffer *element = openGap(index, 1);
+    new (element) BlobBuffer(bslmf::MovableRefUtil::move(value));
+    return element;
+}
+
+Blob_BufferVector::iterator
+Blob_BufferVector::insert(const_iterator    position,
+                          int               numElements,
+                          const BlobBuffer& value)
+{
+    BSLS_ASSERT(0 <= numElements);
+
+    const BlobBuffer copy(value);
+    const int        index = static_cast<int>(position - begin());
+
+    BlobBuffer *elements = openGap(index, numElements);
+    for (int i = 0; i < numElements; ++i) {
+        new (elements + i) BlobBuffer(copy);
+    }
+    return elements;
+}
+
+void Blob_BufferVector::reserve(int numElements)
+{
+    BSLS_ASSERT(0 <= numElements);
+
+    if (numElements > d_capacity) {
+        BlobBuffer *newArray = static_cast<BlobBuffer *>(
+                          d_allocator_p->allocate(numElements *
+                                                  sizeof(BlobBuffer)));
+        bsl::memcpy(static_cast<void *>(newArray),
+                    static_cast<void *>(data()),
+                    d_size * sizeof(BlobBuffer));
+        if (d_array_p) {
+            d_allocator_p->deallocate(d_array_p);
+        }
+        d_array_p  = newArray;
+        d_capacity = numElements;
+    }
+}
+
+void Blob_BufferVector::resize(int numElements)
+{
+    BSLS_ASSERT(0 <= numElements);
+
+    if (numElements < d_size) {
+        erase(begin() + numElements, end());
+    }
+    else {
+        insert(end(), numElements - d_size, BlobBuffer());
+    }
+}
+
+void Blob_BufferVector::swap(Blob_BufferVector& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    // This class is bitwise moveable, so the objects can be exchanged
+    // byte-wise, which exchanges the inline elements along with the rest.
+
+    bsls::AlignedBuffer<sizeof(Blob_BufferVector)> temp;
+    bsl::memcpy(temp.buffer(),
+                static_cast<void *>(this),
+                sizeof(Blob_BufferVector));
+    bsl::memcpy(static_cast<void *>(this),
+                static_cast<void *>(&other),
+                sizeof(Blob_BufferVector));
+    bsl::memcpy(static_cast<void *>(&other),
+                temp.buffer(),
+                sizeof(Blob_BufferVector));
+}
+}  // close package namespace
+
+// FREE OPERATORS
+bool bdlbb::operator==(const Blob_BufferVector& lhs,
+                       const Blob_BufferVector& rhs)
+{
+    return lhs.size() == rhs.size()
+        && bsl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+bool bdlbb::operator!=(const Blob_BufferVector& lhs,
+                       const Blob_BufferVector& rhs)
+{
+    return !(lhs == rhs);
+}
+
 namespace bdlbb {
 
                           // =======================
@@ -269,7 +590,7 @@ void Blob::slowSetLength(int length)
     while (length > d_totalSize) {
         BlobBuffer buf;
         d_bufferFactory_p->allocate(&buf);
-        appendBuffer(buf);
+        appendBuffer(MoveUtil::move(buf));
     }
 
     if (1 == d_buffers.size()) {
@@ -455,9 +776,23 @@ void Blob::appendBuffer(const BlobBuffer& buffer)
     d_totalSize += buffer.size();
 }
 
+void Blob::appendBuffer(bslmf::MovableRef<BlobBuffer> buffer)
+{
+    const int bufferSize = MoveUtil::access(buffer).size();
+
+    d_buffers.push_back(MoveUtil::move(buffer));
+    d_totalSize += bufferSize;
+}
+
 void Blob::appendDataBuffer(const BlobBuffer& buffer)
 {
-    const int bufferSize    = buffer.size();
+    BlobBuffer copy(buffer);
+    appendDataBuffer(MoveUtil::move(copy));
+}
+
+void Blob::appendDataBuffer(bslmf::MovableRef<BlobBuffer> buffer)
+{
+    const int bufferSize    = MoveUtil::access(buffer).size();
     const int oldDataLength = d_dataLength;
 
     d_totalSize += bufferSize;
@@ -470,7 +805,7 @@ void Blob::appendDataBuffer(const BlobBuffer& buffer)
         BSLS_ASSERT(d_dataIndex == (int)d_buffers.size() - 1 ||
                          (0 == d_dataIndex && 0 == d_buffers.size()));
 
-        d_buffers.push_back(buffer);
+        d_buffers.push_back(MoveUtil::move(buffer));
         d_preDataIndexLength = oldDataLength;
         d_dataIndex          = static_cast<int>(d_buffers.size()) - 1;
     }
@@ -482,7 +817,7 @@ void Blob::appendDataBuffer(const BlobBuffer& buffer)
         BSLS_ASSERT(0 == d_dataIndex);
         BSLS_ASSERT(0 == d_preDataIndexLength);
 
-        d_buffers.insert(d_buffers.begin(), buffer);
+        d_buffers.insert(d_buffers.begin(), MoveUtil::move(buffer));
     }
     else {
         // Complicated case -- at the start, buffer(s) with data were present,
@@ -492,7 +827,7 @@ void Blob::appendDataBuffer(const BlobBuffer& buffer)
 
         BSLS_ASSERT(d_dataLength > bufferSize);
         BSLS_ASSERT(d_dataLength < d_totalSize);
-        BSLS_ASSERT((unsigned)d_dataIndex < d_buffers.size());
+        BSLS_ASSERT(d_dataIndex < d_buffers.size());
         BSLS_ASSERT(oldDataLength >= d_preDataIndexLength);
 
         BlobBuffer&    prevBuf        = d_buffers[d_dataIndex];
@@ -504,7 +839,8 @@ void Blob::appendDataBuffer(const BlobBuffer& buffer)
         prevBuf.setSize(newPrevBufSize);
 
         ++d_dataIndex;
-        d_buffers.insert(d_buffers.begin() + d_dataIndex, buffer);
+        d_buffers.insert(d_buffers.begin() + d_dataIndex,
+                         MoveUtil::move(buffer));
         d_preDataIndexLength = oldDataLength;
         d_totalSize -= trim;
     }
@@ -659,7 +995,7 @@ void Blob::swap(Blob& other)
 {
     BSLS_ASSERT(this->allocator() == other.allocator());
 
-    bslalg::SwapUtil::swap(&this->d_buffers, &other.d_buffers);
+    d_buffers.swap(other.d_buffers);
     bslalg::SwapUtil::swap(&this->d_totalSize, &other.d_totalSize);
     bslalg::SwapUtil::swap(&this->d_dataLength, &other.d_dataLength);
     bslalg::SwapUtil::swap(&this->d_dataIndex, &other.d_dataIndex);
@@ -72,6 +72,23 @@ BSLS_IDENT("$Id: $")
 // versus the added cost of shared ownership for each individual buffer and
 // random access to the buffer.
 //
+///Buffer Storage
+///--------------
+// A 'bdlbb::Blob' stores the first 'Blob_BufferVector::k_INLINE_CAPACITY'
+// (currently 3) of its 'bdlbb::BlobBuffer' objects within the blob object
+// itself, and allocates an array from its allocator only when it holds more
+// buffers.  Therefore, creating, copying, and growing a blob having few
+// buffers (e.g., a message consisting of a header buffer and one or two
+// payload buffers) allocates no memory other than that of the buffers
+// themselves.  Note that 'reserveBufferCapacity' for more than the inline
+// capacity does allocate.
+//
+// Copying a blob buffer into a blob increments the (atomic) reference count of
+// its shared buffer.  Where the caller no longer needs its 'BlobBuffer', the
+// overloads of 'appendBuffer' and 'appendDataBuffer' taking a
+// 'bslmf::MovableRef<BlobBuffer>' transfer ownership without touching the
+// reference count.
+//
 ///Thread Safety
 ///-------------
 // Different instances of the classes defined in this component can be
@@ -376,16 +393,20 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bslma_allocator.h>
+#include <bslma_default.h>
 
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_movableref.h>
 
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
 #include <bsls_keyword.h>
 #include <bsls_review.h>
 
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
+#include <bsl_new.h>
 #include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
@@ -549,6 +570,208 @@ class BlobBufferFactory {
         // into the specified 'buffer'.
 };
 
+                          // =======================
+                          // class Blob_BufferVector
+                          // =======================
+
+class Blob_BufferVector {
+    // This component-private class provides a sequence of 'BlobBuffer'
+    // objects, having the subset of the interface of 'bsl::vector' used by
+    // 'Blob', that stores up to 'k_INLINE_CAPACITY' elements within the
+    // object itself and allocates an array only for longer sequences.  Since
+    // the inline elements are located relative to the address of the object
+    // (and not through a pointer), this class is bitwise moveable.  Iterators
+    // are pointers to the elements, and are invalidated by any operation that
+    // changes the size or capacity.
+
+  public:
+    // TYPES
+    typedef BlobBuffer       *iterator;
+    typedef const BlobBuffer *const_iterator;
+
+    enum {
+        k_INLINE_CAPACITY = 3  // number of elements stored inline
+    };
+
+  private:
+    // DATA
+    bsls::AlignedBuffer<k_INLINE_CAPACITY * sizeof(BlobBuffer),
+                        bsls::AlignmentFromType<BlobBuffer>::VALUE>
+                      d_inlineBuffer;   // storage for inline elements
+
+    BlobBuffer       *d_array_p;        // allocated array, or 0 if the
+                                        // elements are stored inline (owned)
+
+    int               d_size;           // number of elements
+
+    int               d_capacity;       // number of elements that can be held
+                                        // without reallocation
+
+    bslma::Allocator *d_allocator_p;    // memory allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    BlobBuffer *data();
+        // Return the address of the first element of this sequence.
+
+    void destroyElements();
+        // Destroy the elements of this sequence, and set its size to 0.  The
+        // capacity is unchanged.
+
+    BlobBuffer *openGap(int index, int numElements);
+        // Shift the elements at the specified 'index' and higher positions up
+        // by the specified 'numElements' positions, growing the capacity if
+        // necessary, increase the size by 'numElements', and return the
+        // address of the (uninitialized) storage at 'index'.  The behavior is
+        // undefined unless '0 <= index <= size()' and '0 <= numElements'.
+        // Note that the caller must construct 'numElements' elements at the
+        // returned address.
+
+    void moveFrom(Blob_BufferVector *original);
+        // Load the elements of the specified 'original' into this empty
+        // sequence.  If 'original' uses the same allocator as this sequence,
+        // take ownership of its array if it has one, and relocate its inline
+        // elements otherwise, leaving 'original' empty; if the allocators
+        // differ, copy the elements, leaving 'original' unchanged.  The
+        // behavior is undefined unless this sequence is empty.
+
+  private:
+    // NOT IMPLEMENTED
+    Blob_BufferVector(const Blob_BufferVector&);
+
+  public:
+    // CREATORS
+    explicit Blob_BufferVector(bslma::Allocator *basicAllocator = 0);
+        // Create an empty sequence.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    Blob_BufferVector(const BlobBuffer *first,
+                      const BlobBuffer *last,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create a sequence holding copies of the elements in the specified
+        // range '[first, last)'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    Blob_BufferVector(const Blob_BufferVector&  original,
+                      bslma::Allocator         *basicAllocator);
+        // Create a sequence holding copies of the elements of the specified
+        // 'original' sequence, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    Blob_BufferVector(bslmf::MovableRef<Blob_BufferVector> original)
+                                                        BSLS_KEYWORD_NOEXCEPT;
+        // Create a sequence holding the elements of the specified 'original'
+        // sequence, and using its allocator, leaving 'original' empty.
+
+    Blob_BufferVector(bslmf::MovableRef<Blob_BufferVector>  original,
+                      bslma::Allocator                     *basicAllocator);
+        // Create a sequence holding the elements of the specified 'original'
+        // sequence, using the specified 'basicAllocator' to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  If 'basicAllocator' is the allocator of 'original', the
+        // elements are moved, leaving 'original' empty; otherwise, they are
+        // copied, leaving 'original' unchanged.
+
+    ~Blob_BufferVector();
+        // Destroy this sequence.
+
+    // MANIPULATORS
+    Blob_BufferVector& operator=(const Blob_BufferVector& rhs);
+        // Assign to this sequence copies of the elements of the specified
+        // 'rhs' sequence, and return a reference providing modifiable access
+        // to this sequence.
+
+    Blob_BufferVector& operator=(bslmf::MovableRef<Blob_BufferVector> rhs);
+        // Assign to this sequence the elements of the specified 'rhs'
+        // sequence, and return a reference providing modifiable access to
+        // this sequence.  If 'rhs' uses the same allocator as this sequence,
+        // the elements are moved, leaving 'rhs' empty; otherwise, they are
+        // copied, leaving 'rhs' unchanged.
+
+    iterator begin();
+        // Return an iterator to the first element of this sequence.
+
+    iterator end();
+        // Return an iterator one past the last element of this sequence.
+
+    void clear();
+        // Remove all elements from this sequence.  The capacity is unchanged.
+
+    iterator erase(const_iterator position);
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the element at the specified 'position', or the elements in
+        // the specified range '[first, last)', from this sequence, and return
+        // an iterator to the element following those removed.
+
+    iterator insert(const_iterator position, const BlobBuffer& value);
+    iterator insert(const_iterator                position,
+                    bslmf::MovableRef<BlobBuffer> value);
+        // Insert the specified 'value' at the specified 'position' in this
+        // sequence, and return an iterator to the inserted element.
+
+    iterator insert(const_iterator    position,
+                    int               numElements,
+                    const BlobBuffer& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // at the specified 'position' in this sequence, and return an
+        // iterator to the first inserted element.
+
+    BlobBuffer& operator[](int index);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'index'.
+
+    void push_back(const BlobBuffer& value);
+    void push_back(bslmf::MovableRef<BlobBuffer> value);
+        // Append the specified 'value' to this sequence.
+
+    void reserve(int numElements);
+        // Ensure that this sequence can hold at least the specified
+        // 'numElements' elements without reallocation.
+
+    void resize(int numElements);
+        // Set the size of this sequence to the specified 'numElements',
+        // removing elements from, or appending default-constructed elements
+        // to, its end.
+
+    void swap(Blob_BufferVector& other);
+        // Exchange the elements of this sequence with those of the specified
+        // 'other' sequence.  The behavior is undefined unless this sequence
+        // and 'other' use the same allocator.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator to the first element of this sequence.
+
+    const_iterator end() const;
+        // Return an iterator one past the last element of this sequence.
+
+    const BlobBuffer& operator[](int index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index'.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this sequence to supply memory.
+
+    int capacity() const;
+        // Return the number of elements this sequence can hold without
+        // reallocation.
+
+    int size() const;
+        // Return the number of elements of this sequence.
+};
+
+// FREE OPERATORS
+bool operator==(const Blob_BufferVector& lhs, const Blob_BufferVector& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sequences have the same
+    // number of elements, and elements at each index have the same value, and
+    // 'false' otherwise.
+
+bool operator!=(const Blob_BufferVector& lhs, const Blob_BufferVector& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sequences do not have
+    // the same value, and 'false' otherwise.
+
                                  // ==========
                                  // class Blob
                                  // ==========
@@ -565,7 +788,7 @@ class Blob {
         // Used in move construction and assignment to make lines shorter.
 
     // DATA
-    bsl::vector<BlobBuffer>  d_buffers;             // buffer sequence
+    Blob_BufferVector        d_buffers;             // buffer sequence
 
     int                      d_totalSize;           // capacity of blob
                                                     // (in bytes)
@@ -672,14 +895,20 @@ class Blob {
         // but unspecified state.
 
     void appendBuffer(const BlobBuffer& buffer);
+    void appendBuffer(bslmf::MovableRef<BlobBuffer> buffer);
         // Append the specified 'buffer' after the last buffer of this blob.
-        // The length of this blob is unaffected.  Note that this operation is
+        // The length of this blob is unaffected.  If 'buffer' is passed as a
+        // movable reference, its contents are moved to this blob, and it is
+        // left in a valid but unspecified state.  Note that this operation is
         // equivalent to 'insert(numBuffers(), buffer)', but is more efficient.
 
     void appendDataBuffer(const BlobBuffer& buffer);
+    void appendDataBuffer(bslmf::MovableRef<BlobBuffer> buffer);
         // Append the specified 'buffer' after the last *data* buffer of this
         // blob; the last data buffer is trimmed, if necessary.  The length of
-        // this blob is incremented by the size of 'buffer'.  The behavior is
+        // this blob is incremented by the size of 'buffer'.  If 'buffer' is
+        // passed as a movable reference, its contents are moved to this blob,
+        // and it is left in a valid but unspecified state.  The behavior is
         // undefined unless '0 < buffer.size()'.  Note that this operation is
         // equivalent to:
         //..
@@ -824,9 +1053,14 @@ class Blob {
 
 namespace bslmf {
 
+template <>
+struct IsBitwiseMoveable<BloombergLP::bdlbb::Blob_BufferVector>
+: IsBitwiseMoveable<BloombergLP::bdlbb::BlobBuffer>::type {
+};
+
 template <>
 struct IsBitwiseMoveable<BloombergLP::bdlbb::Blob>
-: IsBitwiseMoveable<bsl::vector<BloombergLP::bdlbb::BlobBuffer> >::type {
+: IsBitwiseMoveable<BloombergLP::bdlbb::Blob_BufferVector>::type {
 };
 }  // close namespace bslmf
 
@@ -952,6 +1186,116 @@ bool bdlbb::operator!=(const BlobBuffer& lhs, const BlobBuffer& rhs)
 
 namespace bdlbb {
 
+                          // -----------------------
+                          // class Blob_BufferVector
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+inline
+BlobBuffer *Blob_BufferVector::data()
+{
+    return d_array_p ? d_array_p
+                     : reinterpret_cast<BlobBuffer *>(d_inlineBuffer.buffer());
+}
+
+// CREATORS
+inline
+Blob_BufferVector::Blob_BufferVector(bslma::Allocator *basicAllocator)
+: d_array_p(0)
+, d_size(0)
+, d_capacity(k_INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+// MANIPULATORS
+inline
+Blob_BufferVector::iterator Blob_BufferVector::begin()
+{
+    return data();
+}
+
+inline
+Blob_BufferVector::iterator Blob_BufferVector::end()
+{
+    return data() + d_size;
+}
+
+inline
+BlobBuffer& Blob_BufferVector::operator[](int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return data()[index];
+}
+
+inline
+void Blob_BufferVector::push_back(const BlobBuffer& value)
+{
+    if (d_size < d_capacity) {
+        new (data() + d_size) BlobBuffer(value);
+        ++d_size;
+    }
+    else {
+        insert(end(), value);
+    }
+}
+
+inline
+void Blob_BufferVector::push_back(bslmf::MovableRef<BlobBuffer> value)
+{
+    if (d_size < d_capacity) {
+        new (data() + d_size) BlobBuffer(bslmf::MovableRefUtil::move(value));
+        ++d_size;
+    }
+    else {
+        insert(end(), bslmf::MovableRefUtil::move(value));
+    }
+}
+
+// ACCESSORS
+inline
+Blob_BufferVector::const_iterator Blob_BufferVector::begin() const
+{
+    return d_array_p
+        ? d_array_p
+        : reinterpret_cast<const BlobBuffer *>(d_inlineBuffer.buffer());
+}
+
+inline
+Blob_BufferVector::const_iterator Blob_BufferVector::end() const
+{
+    return begin() + d_size;
+}
+
+inline
+const BlobBuffer& Blob_BufferVector::operator[](int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return begin()[index];
+}
+
+inline
+bslma::Allocator *Blob_BufferVector::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+int Blob_BufferVector::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+int Blob_BufferVector::size() const
+{
+    return d_size;
+}
+
                                  // ==========
                                  // class Blob
                                  // ==========
@@ -969,7 +1313,7 @@ void Blob::reserveBufferCapacity(int numBuffers)
 inline
 bslma::Allocator *Blob::allocator() const
 {
-    return d_buffers.get_allocator().mechanism();
+    return d_buffers.allocator();
 }
 
 inline
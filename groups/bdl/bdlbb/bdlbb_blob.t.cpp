@@ -101,6 +101,8 @@ using bsl::cerr;
 // [ 7] void bdlbb::Blob::removeUnusedBuffers();
 // [ 8] void bdlbb::Blob::prependDataBuffer(buffer);
 // [ 8] void bdlbb::Blob::appendDataBuffer(buffer)
+// [16] void bdlbb::Blob::appendBuffer(MovableRef<BlobBuffer> buffer);
+// [16] void bdlbb::Blob::appendDataBuffer(MovableRef<BlobBuffer> buffer);
 // [ 9] void bdlbb::Blob::moveBuffers(bdlbb::Blob *srcBlob);
 // [10] void bdlbb::Blob::swapBufferRaw(int index, BlobBuffer *srcBuffer);
 // [11] void bdlbb::Blob::moveDataBuffers(bdlbb::Blob *srcBlob);
@@ -112,7 +114,8 @@ using bsl::cerr;
 // [13] IMPLICIT TRIM
 // [14] MOVE OPERATIONS
 // [15] SWAP
-// [16] USAGE EXAMPLE
+// [16] INLINE BUFFER STORAGE
+// [17] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -699,7 +702,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -848,6 +851,228 @@ int main(int argc, char *argv[])
         ASSERT(5                             == blob.numBuffers());
     }
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // INLINE BUFFER STORAGE
+        //
+        // Concerns:
+        //: 1 A blob holding up to 'k_INLINE_CAPACITY' buffers allocates no
+        //:   memory from its allocator, whether created, copied, moved, or
+        //:   grown, and a blob holding more buffers does.
+        //:
+        //: 2 The value of a blob is correct as its buffers move between
+        //:   inline and allocated storage, through insertion, removal,
+        //:   assignment, move, and swap.
+        //:
+        //: 3 Moving a blob to a blob using a different allocator copies its
+        //:   buffers, leaving the original unchanged.
+        //:
+        //: 4 The movable-reference overloads of 'appendBuffer' and
+        //:   'appendDataBuffer' transfer the shared buffer without changing
+        //:   its reference count.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Create blobs having 0 to 8 buffers, and check the number of
+        //:   allocations made from the allocator of the blob when the blob is
+        //:   created, copied, and moved.  (C-1)
+        //:
+        //: 2 For each number of buffers, and each position, insert and remove
+        //:   a buffer, and compare the buffers with those of an equivalent
+        //:   'bsl::vector'.  Swap, assign, and move blobs having various
+        //:   numbers of buffers, and verify their values.  (C-2)
+        //:
+        //: 3 Move-construct a blob using a different allocator, and verify
+        //:   both blobs.  (C-3)
+        //:
+        //: 4 Append buffers using the movable-reference overloads, and verify
+        //:   the 'use_count' of the shared buffers.  (C-4)
+        //:
+        //: 5 Use a test allocator and verify that all memory is released.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void bdlbb::Blob::appendBuffer(MovableRef<BlobBuffer> buffer);
+        //   void bdlbb::Blob::appendDataBuffer(MovableRef<BlobBuffer> buffer);
+        //   INLINE BUFFER STORAGE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nINLINE BUFFER STORAGE"
+                          << "\n=====================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        const int INLINE = bdlbb::Blob_BufferVector::k_INLINE_CAPACITY;
+        const int SIZE   = 16;
+
+        bslma::TestAllocator fa("factory", veryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVerbose);
+        bslma::TestAllocator ta2("other",  veryVeryVerbose);
+
+        SimpleBlobBufferFactory factory(SIZE, &fa);
+
+        if (verbose) cout << "\tAllocation." << endl;
+
+        for (int numBuffers = 0; numBuffers <= 2 * INLINE + 2; ++numBuffers) {
+            const bool EXP_ALLOC = numBuffers > INLINE;
+
+            bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+
+            mX.setLength(numBuffers * SIZE);
+            ASSERTV(numBuffers, numBuffers == X.numBuffers());
+            ASSERTV(numBuffers, EXP_ALLOC == (0 < ta.numBlocksInUse()));
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                bdlbb::Blob mY(X, &ta);  const bdlbb::Blob& Y = mY;
+                ASSERTV(numBuffers, X == Y);
+                ASSERTV(numBuffers, EXP_ALLOC == tam.isTotalUp());
+
+                bdlbb::Blob mZ(MoveUtil::move(mY));
+                ASSERTV(numBuffers, X == mZ);
+                ASSERTV(numBuffers, 0 == Y.numBuffers());
+                ASSERTV(numBuffers, EXP_ALLOC ==
+                                           (1 == tam.numBlocksTotalChange()));
+            }
+
+            mX.removeAll();
+            ASSERTV(numBuffers, 0 == X.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tInsertion and removal." << endl;
+
+        for (int numBuffers = 0; numBuffers <= 2 * INLINE; ++numBuffers) {
+            for (int index = 0; index <= numBuffers; ++index) {
+                bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+
+                bsl::vector<bdlbb::BlobBuffer> expected(&ta);
+
+                for (int i = 0; i < numBuffers; ++i) {
+                    bdlbb::BlobBuffer buffer;
+                    factory.allocate(&buffer);
+                    mX.appendBuffer(buffer);
+                    expected.push_back(buffer);
+                }
+
+                bdlbb::BlobBuffer buffer;
+                factory.allocate(&buffer);
+                mX.insertBuffer(index, buffer);
+                expected.insert(expected.begin() + index, buffer);
+
+                ASSERTV(numBuffers, index,
+                        numBuffers + 1 == X.numBuffers());
+                for (int i = 0; i < X.numBuffers(); ++i) {
+                    ASSERTV(numBuffers, index, i, expected[i] == X.buffer(i));
+                }
+
+                // Insert a buffer of the blob itself.
+
+                mX.insertBuffer(index, X.buffer(numBuffers));
+                expected.insert(expected.begin() + index,
+                                expected[numBuffers]);
+                for (int i = 0; i < X.numBuffers(); ++i) {
+                    ASSERTV(numBuffers, index, i, expected[i] == X.buffer(i));
+                }
+
+                mX.removeBuffer(index);
+                mX.removeBuffers(index, 1);
+                expected.erase(expected.begin() + index,
+                               expected.begin() + index + 2);
+
+                ASSERTV(numBuffers, index, numBuffers == X.numBuffers());
+                for (int i = 0; i < X.numBuffers(); ++i) {
+                    ASSERTV(numBuffers, index, i, expected[i] == X.buffer(i));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tSwap, assignment, and move." << endl;
+
+        for (int i = 0; i <= 2 * INLINE; ++i) {
+            for (int j = 0; j <= 2 * INLINE; ++j) {
+                bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+                bdlbb::Blob mY(&factory, &ta);  const bdlbb::Blob& Y = mY;
+
+                mX.setLength(i * SIZE);
+                mY.setLength(j * SIZE - (j ? 1 : 0));
+
+                const bdlbb::Blob XX(X, &ta);
+                const bdlbb::Blob YY(Y, &ta);
+
+                mX.swap(mY);
+                ASSERTV(i, j, YY == X);
+                ASSERTV(i, j, XX == Y);
+
+                mX = XX;
+                ASSERTV(i, j, XX == X);
+
+                mY = MoveUtil::move(mX);
+                ASSERTV(i, j, XX == Y);
+                ASSERTV(i, j, 0 == X.numBuffers());
+
+                mX = YY;
+                mX = MoveUtil::move(mX);
+                ASSERTV(i, j, YY == X);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tMove to a different allocator." << endl;
+
+        for (int numBuffers = 0; numBuffers <= 2 * INLINE; ++numBuffers) {
+            bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+            mX.setLength(numBuffers * SIZE);
+
+            const bdlbb::Blob XX(X, &ta);
+
+            bdlbb::Blob mY(MoveUtil::move(mX), &ta2);
+            ASSERTV(numBuffers, XX == mY);
+            ASSERTV(numBuffers, XX == X);
+            ASSERTV(numBuffers, &ta2 == mY.allocator());
+
+            bdlbb::Blob mZ(&ta2);
+            mZ = MoveUtil::move(mX);
+            ASSERTV(numBuffers, XX == mZ);
+            ASSERTV(numBuffers, XX == X);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == ta2.numBlocksInUse());
+
+        if (verbose) cout << "\tMovable-reference overloads." << endl;
+        {
+            bdlbb::Blob mX(&factory, &ta);  const bdlbb::Blob& X = mX;
+
+            for (int i = 0; i < 2 * INLINE; ++i) {
+                bdlbb::BlobBuffer buffer;
+                factory.allocate(&buffer);
+
+                const bdlbb::BlobBuffer COPY(buffer);
+                ASSERTV(i, 2 == COPY.buffer().use_count());
+
+                int index;
+                if (i % 2) {
+                    mX.appendBuffer(MoveUtil::move(buffer));
+                    index = X.numBuffers() - 1;
+                }
+                else {
+                    mX.appendDataBuffer(MoveUtil::move(buffer));
+                    index = X.numDataBuffers() - 1;
+                }
+
+                ASSERTV(i, 0 == buffer.data());
+                ASSERTV(i, 2 == COPY.buffer().use_count());
+                ASSERTV(i, COPY == X.buffer(index));
+            }
+            ASSERT(2 * INLINE * SIZE == X.totalSize());
+            ASSERT(INLINE     * SIZE == X.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == fa.numBlocksInUse());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING SWAP
@@ -1144,8 +1369,9 @@ int main(int argc, char *argv[])
             bslma::TestAllocatorMonitor tam(&ta);
             bdlbb::Blob autoMoved(bdlbb::Blob(bufs, bufn, &factory, &ta));
 
-            // Was it really a move?  We allocated just once, so yes:
-            ASSERT(tam.numBlocksTotalChange() == 1);
+            // Was it really a move?  The two buffers are stored inline, so
+            // neither the construction nor the move allocated:
+            ASSERT(tam.numBlocksTotalChange() == 0);
 
             // Was the data moved?  (No way to add length in the constructor.)
             ASSERT(autoMoved.lastDataBufferLength() == 0);
@@ -1224,8 +1450,9 @@ int main(int argc, char *argv[])
             bslma::TestAllocatorMonitor tam(&ta);
             autoMoved = bdlbb::Blob(bufs, bufn, &factory, &ta);
 
-            // Was it really a move?  We allocated just once, so yes:
-            ASSERT(tam.numBlocksTotalChange() == 1);
+            // Was it really a move?  The two buffers are stored inline, so
+            // neither the construction nor the move allocated:
+            ASSERT(tam.numBlocksTotalChange() == 0);
 
             // Was the data moved?  (No way to add length in the constructor.)
             ASSERT(autoMoved.lastDataBufferLength() == 0);
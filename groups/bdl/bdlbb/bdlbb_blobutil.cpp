@@ -17,13 +17,20 @@ BSLS_IDENT_RCSID(bdlbb_blobutil_cpp, "$Id$ $CSID$")
 #include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 
 #include <bsl_c_ctype.h>
+#include <bsl_climits.h>
 #include <bsl_iostream.h>
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <errno.h>
+#include <sys/uio.h>
+#endif
+
 namespace BloombergLP {
 namespace {
 
@@ -471,6 +478,115 @@ char *BlobUtil::getContiguousDataBuffer(Blob              *blob,
     return blob->buffer(index).data() + offset;
 }
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+int BlobUtil::loadIovecs(::iovec      *iovecs,
+                         int           maxNumIovecs,
+                         const Blob&   source,
+                         int           offset,
+                         int           length)
+{
+    BSLS_ASSERT(iovecs || 0 == maxNumIovecs);
+    BSLS_ASSERT(0 <= maxNumIovecs);
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= source.length() - length);
+
+    if (0 == length || 0 == maxNumIovecs) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::pair<int, int> place = findBufferIndexAndOffset(source,
+                                                               offset);
+
+    int numIovecs    = 0;
+    int bufferIndex  = place.first;
+    int bufferOffset = place.second;
+    while (0 < length && numIovecs < maxNumIovecs) {
+        const BlobBuffer& buffer = source.buffer(bufferIndex);
+        const int         size   = bsl::min(buffer.size() - bufferOffset,
+                                            length);
+        if (0 < size) {
+            iovecs[numIovecs].iov_base = buffer.data() + bufferOffset;
+            iovecs[numIovecs].iov_len  = size;
+            ++numIovecs;
+            length -= size;
+        }
+        ++bufferIndex;
+        bufferOffset = 0;
+    }
+    return numIovecs;
+}
+
+int BlobUtil::readv(Blob *dest, int fileDescriptor, int maxNumBytes)
+{
+    BSLS_ASSERT(dest);
+    BSLS_ASSERT(0 < maxNumBytes);
+    BSLS_ASSERT(maxNumBytes <= INT_MAX - dest->length());
+
+    const int length = dest->length();
+
+    // Grow 'dest', allocating from its factory if necessary, so that the
+    // capacity to read into is part of its data while the iovecs are loaded.
+
+    dest->setLength(length + maxNumBytes);
+
+    ::iovec   iovecs[k_MAX_NUM_IOVECS];
+    const int numIovecs = loadIovecs(iovecs,
+                                     k_MAX_NUM_IOVECS,
+                                     *dest,
+                                     length,
+                                     maxNumBytes);
+
+    ssize_t rc;
+    do {
+        rc = ::readv(fileDescriptor, iovecs, numIovecs);
+    } while (rc < 0 && EINTR == errno);
+
+    dest->setLength(length + (0 < rc ? static_cast<int>(rc) : 0));
+
+    return static_cast<int>(rc);
+}
+
+int BlobUtil::writev(int         fileDescriptor,
+                     const Blob& source,
+                     int         offset,
+                     int         length)
+{
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(offset <= source.length() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    ::iovec   iovecs[k_MAX_NUM_IOVECS];
+    const int numIovecs = loadIovecs(iovecs,
+                                     k_MAX_NUM_IOVECS,
+                                     source,
+                                     offset,
+                                     length);
+
+    ssize_t rc;
+    do {
+        rc = ::writev(fileDescriptor, iovecs, numIovecs);
+    } while (rc < 0 && EINTR == errno);
+
+    return static_cast<int>(rc);
+}
+
+int BlobUtil::writevAndErase(int fileDescriptor, Blob *blob)
+{
+    BSLS_ASSERT(blob);
+
+    const int rc = writev(fileDescriptor, *blob, 0, blob->length());
+    if (0 < rc) {
+        erase(blob, 0, rc);
+    }
+    return rc;
+}
+#endif
+
 bsl::ostream& BlobUtil::asciiDump(bsl::ostream& stream, const Blob& source)
 {
     int numBytes = source.length();
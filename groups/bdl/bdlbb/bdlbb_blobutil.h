@@ -18,6 +18,23 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'bdlbb::Blob'
 // objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions, and
 // streaming functions.
+//
+///Scatter/Gather I/O
+///------------------
+// On Unix platforms, 'bdlbb::BlobUtil' provides functions that transfer data
+// directly between the buffers of a blob and a file descriptor (typically a
+// socket) using the 'writev' and 'readv' system calls, avoiding the copy
+// through an intermediate contiguous buffer (or a stream buffer such as
+// 'bdlbb::BlobStreamBuf').  'loadIovecs' describes a range of the data of a
+// blob as an array of 'iovec' structures; 'writev' writes a range of the data
+// of a blob; 'writevAndErase' writes the data of a blob and erases the bytes
+// written from its front, which is convenient when draining an output queue
+// to a non-blocking socket; and 'readv' reads into the capacity following
+// the data of a blob, first growing the blob using its blob buffer factory.
+// Each of 'writev', 'writevAndErase', and 'readv' makes at most one
+// successful system call (retrying only if interrupted by a signal), so may
+// transfer fewer bytes than requested, and describes at most
+// 'BlobUtil::k_MAX_NUM_IOVECS' buffers per call.
 
 #include <bdlscm_version.h>
 
@@ -27,6 +44,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 #include <bsls_review.h>
 
 #include <bsl_algorithm.h>
@@ -34,6 +52,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_iosfwd.h>
 #include <bsl_utility.h>
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+struct iovec;
+#endif
+
 namespace BloombergLP {
 namespace bdlbb {
 
@@ -45,6 +67,14 @@ struct BlobUtil {
     // This 'struct' is a namespace for a collection of static methods used
     // for manipulating and accessing 'Blob' objects.
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+    // CONSTANTS
+    enum {
+        k_MAX_NUM_IOVECS = 64  // maximum number of buffers described to a
+                               // single 'readv' or 'writev' system call
+    };
+#endif
+
     // CLASS METHODS
     static void append(Blob *dest, const Blob& source, int offset, int length);
         // Append the specified 'length' bytes from the specified 'offset' in
@@ -170,6 +200,66 @@ struct BlobUtil {
         // 'factory->allocate()', if called, yields a block of memory of a size
         // at least as large as 'addLength'.
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+    static int loadIovecs(::iovec      *iovecs,
+                          int           maxNumIovecs,
+                          const Blob&   source,
+                          int           offset,
+                          int           length);
+        // Load into the specified 'iovecs' array descriptions of the
+        // specified 'length' bytes of data starting at the specified 'offset'
+        // in the specified 'source', using at most the specified
+        // 'maxNumIovecs' elements, and return the number of elements loaded.
+        // If the range spans more than 'maxNumIovecs' buffers, only the data
+        // in the first 'maxNumIovecs' buffers of the range is described.  The
+        // behavior is undefined unless '0 <= maxNumIovecs', 'iovecs' has room
+        // for 'maxNumIovecs' elements, '0 <= offset', '0 <= length', and
+        // 'offset + length <= source.length()'.  Note that the elements refer
+        // to the buffers of 'source', and are invalidated by any change to
+        // those buffers.
+
+    static int readv(Blob *dest, int fileDescriptor, int maxNumBytes);
+        // Read at most the specified 'maxNumBytes' from the specified
+        // 'fileDescriptor' and append them to the data of the specified
+        // 'dest' using a single 'readv' system call that reads directly into
+        // the buffers of 'dest'.  If 'dest' does not have capacity for
+        // 'maxNumBytes' following its data, first grow it using its blob
+        // buffer factory.  Return the number of bytes read, 0 on end of file,
+        // and a negative value (with 'errno' set by the system call)
+        // otherwise.  On return, the length of 'dest' is increased by the
+        // number of bytes read, but the capacity obtained to perform the read
+        // is retained.  The behavior is undefined unless '0 < maxNumBytes',
+        // and 'dest' either has capacity for 'maxNumBytes' following its data
+        // or was created with a blob buffer factory.  Note that fewer than
+        // 'maxNumBytes' may be read even if more are available, in particular
+        // if the range spans more than 'k_MAX_NUM_IOVECS' buffers.
+
+    static int writev(int fileDescriptor, const Blob& source);
+    static int writev(int         fileDescriptor,
+                      const Blob& source,
+                      int         offset,
+                      int         length);
+        // Write the data of the specified 'source' or, if specified, the
+        // 'length' bytes starting at the specified 'offset' in 'source', to
+        // the specified 'fileDescriptor' using a single 'writev' system call
+        // over the buffers of 'source'.  Return the number of bytes written,
+        // and a negative value (with 'errno' set by the system call)
+        // otherwise.  The behavior is undefined unless '0 <= offset',
+        // '0 <= length', and 'offset + length <= source.length()'.  Note that
+        // fewer bytes than requested may be written, for example to a
+        // non-blocking socket, or if the data spans more than
+        // 'k_MAX_NUM_IOVECS' buffers.
+
+    static int writevAndErase(int fileDescriptor, Blob *blob);
+        // Write the data of the specified 'blob' to the specified
+        // 'fileDescriptor' using a single 'writev' system call over the
+        // buffers of 'blob', and erase the bytes written from the front of
+        // 'blob'.  Return the number of bytes written, and a negative value
+        // (with 'errno' set by the system call) otherwise, in which case
+        // 'blob' is unchanged.  Note that a blob whose data has been fully
+        // written has a length of 0.
+#endif
+
     static bsl::ostream& asciiDump(bsl::ostream& stream, const Blob& source);
         // Write to the specified 'stream' an ascii dump of the specified
         // 'source', and return a reference to the modifiable 'stream'.
@@ -379,6 +469,14 @@ void BlobUtil::insert(Blob *dest, int destOffset, const Blob& source)
     insert(dest, destOffset, source, 0, source.length());
 }
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+inline
+int BlobUtil::writev(int fileDescriptor, const Blob& source)
+{
+    return writev(fileDescriptor, source, 0, source.length());
+}
+#endif
+
 inline
 bsl::ostream& BlobUtil::hexDump(bsl::ostream& stream, const Blob& source)
 {
@@ -35,6 +35,14 @@
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -42,6 +50,11 @@ using namespace bsl;  // automatically added by script
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// [13] int loadIovecs(iovec *, int, const Blob&, int, int);
+// [13] int readv(Blob *dest, int fileDescriptor, int maxNumBytes);
+// [13] int writev(int fileDescriptor, const Blob& source);
+// [13] int writev(int fileDescriptor, const Blob&, int, int);
+// [13] int writevAndErase(int fileDescriptor, Blob *blob);
 // [12] padToAlignment(Blob *, int, char = 0);
 // [10] Testing copy to a blob
 // [ 9] Testing getContiguousRangeOrCopy
@@ -387,6 +400,282 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING SCATTER/GATHER I/O
+        //
+        // Concerns:
+        //: 1 'loadIovecs' describes exactly the specified range of data,
+        //:   skipping zero-size buffers, starting within a buffer, ending
+        //:   within a buffer (including the last data buffer), and using at
+        //:   most the specified number of elements.
+        //:
+        //: 2 'writev' writes the specified range of data, and reports errors.
+        //:
+        //: 3 'readv' appends the data read to the blob, growing the blob
+        //:   using its factory, reports end of file and errors, and leaves
+        //:   the length of the blob unchanged on error.
+        //:
+        //: 4 'writevAndErase' erases exactly the bytes written, including
+        //:   after a partial write to a non-blocking descriptor.
+        //:
+        //: 5 No more than 'k_MAX_NUM_IOVECS' buffers are used per call.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For blobs having various buffer sizes, including a zero-size
+        //:   buffer, and every valid offset and length, load iovecs and
+        //:   compare their concatenation with the expected substring.  (C-1)
+        //:
+        //: 2 Write blobs to a pipe, read the pipe, and compare.  Write to a
+        //:   closed descriptor.  (C-2)
+        //:
+        //: 3 Read from a pipe into blobs having small buffers, and compare.
+        //:   Read after the write end is closed, and from a closed
+        //:   descriptor.  (C-3)
+        //:
+        //: 4 Drain a blob larger than the pipe buffer into a non-blocking
+        //:   pipe, emptying the pipe into another blob whenever 'EAGAIN' is
+        //:   reported, and compare the result.  (C-4..5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int loadIovecs(iovec *, int, const Blob&, int, int);
+        //   int readv(Blob *dest, int fileDescriptor, int maxNumBytes);
+        //   int writev(int fileDescriptor, const Blob& source);
+        //   int writev(int fileDescriptor, const Blob&, int, int);
+        //   int writevAndErase(int fileDescriptor, Blob *blob);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING SCATTER/GATHER I/O"
+                          << "\n==========================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'loadIovecs'." << endl;
+        {
+            const int BUFFER_SIZES[] = { 1, 3, 8 };
+            const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES /
+                                                          sizeof *BUFFER_SIZES;
+
+            for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+                const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+                Blob blob(&factory, &ta);
+
+                const bsl::string DATA = g(20);
+                copyStringToBlob(&blob, DATA.substr(0, 7));
+
+                // Insert a zero-size buffer, and leave capacity following
+                // the data.
+
+                bdlbb::BlobBuffer empty;
+                blob.insertBuffer(1, empty);
+                Util::append(&blob, DATA.data() + 7, 13);
+                blob.setLength(blob.length() + 5);
+                blob.setLength(20);
+
+                ::iovec iovecs[32];
+
+                for (int offset = 0; offset <= 20; ++offset) {
+                    for (int length = 0; length <= 20 - offset; ++length) {
+                        const int n = Util::loadIovecs(iovecs,
+                                                       32,
+                                                       blob,
+                                                       offset,
+                                                       length);
+
+                        bsl::string result;
+                        for (int i = 0; i < n; ++i) {
+                            ASSERTV(BUFFER_SIZE, offset, length, i,
+                                    0 < iovecs[i].iov_len);
+                            result.append(
+                                       static_cast<char *>(iovecs[i].iov_base),
+                                       iovecs[i].iov_len);
+                        }
+                        ASSERTV(BUFFER_SIZE, offset, length, result,
+                                DATA.substr(offset, length) == result);
+
+                        // Limit the number of elements.
+
+                        if (1 < n) {
+                            const int m = Util::loadIovecs(iovecs,
+                                                           n - 1,
+                                                           blob,
+                                                           offset,
+                                                           length);
+                            ASSERTV(BUFFER_SIZE, offset, length, m,
+                                    n - 1 == m);
+                        }
+                        ASSERTV(0 == Util::loadIovecs(iovecs,
+                                                      0,
+                                                      blob,
+                                                      offset,
+                                                      length));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'writev' and 'readv'." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(7, &ta);
+
+            const bsl::string DATA = g(100);
+
+            Blob source(&factory, &ta);
+            copyStringToBlob(&source, DATA);
+
+            for (int offset = 0; offset <= 100; offset += 9) {
+                for (int length = 0; length <= 100 - offset; length += 11) {
+                    int fds[2];
+                    ASSERT(0 == ::pipe(fds));
+
+                    ASSERTV(offset, length,
+                            length == Util::writev(fds[1],
+                                                   source,
+                                                   offset,
+                                                   length));
+                    ASSERT(0 == ::close(fds[1]));
+
+                    bdlbb::SimpleBlobBufferFactory smallFactory(3, &ta);
+
+                    Blob dest(&smallFactory, &ta);
+                    copyStringToBlob(&dest, "xy");
+
+                    int rc;
+                    do {
+                        rc = Util::readv(&dest, fds[0], 5);
+                        ASSERTV(offset, length, rc, 0 <= rc && rc <= 5);
+                    } while (0 < rc);
+
+                    ASSERT(0 == ::close(fds[0]));
+
+                    bsl::string result;
+                    copyBlobToString(&result, dest);
+                    ASSERTV(offset, length, result,
+                            "xy" + DATA.substr(offset, length) == result);
+                }
+            }
+
+            int fds[2];
+            ASSERT(0 == ::pipe(fds));
+            ASSERT(100 == Util::writev(fds[1], source));
+            ASSERT(0 == ::close(fds[1]));
+
+            Blob dest(&factory, &ta);
+            ASSERT(100 == Util::readv(&dest, fds[0], 1000));
+            ASSERT(100 == dest.length());
+            ASSERT(0   == Util::readv(&dest, fds[0], 1000));
+            ASSERT(100 == dest.length());
+            ASSERT(0 == ::close(fds[0]));
+
+            bsl::string result;
+            copyBlobToString(&result, dest);
+            ASSERT(DATA == result);
+
+            if (verbose) cout << "\t\tErrors." << endl;
+
+            ASSERT(0 > Util::writev(fds[1], source));
+            ASSERT(EBADF == errno);
+            ASSERT(0 > Util::readv(&dest, fds[0], 10));
+            ASSERT(EBADF == errno);
+            ASSERT(100 == dest.length());
+        }
+
+        if (verbose) cout << "\tTesting 'writevAndErase'." << endl;
+        {
+            enum { k_LENGTH = 300 * 1024 };
+
+            bdlbb::SimpleBlobBufferFactory factory(1000, &ta);
+
+            bsl::string DATA;
+            gg(&DATA, k_LENGTH);
+
+            Blob source(&factory, &ta);
+            copyStringToBlob(&source, DATA);
+
+            Blob dest(&factory, &ta);
+
+            int fds[2];
+            ASSERT(0 == ::pipe(fds));
+            ASSERT(0 == ::fcntl(fds[1], F_SETFL, O_NONBLOCK));
+            ASSERT(0 == ::fcntl(fds[0], F_SETFL, O_NONBLOCK));
+
+            int numWrites = 0;
+            while (0 < source.length()) {
+                const int length = source.length();
+                const int rc     = Util::writevAndErase(fds[1], &source);
+
+                if (0 < rc) {
+                    ++numWrites;
+                    ASSERTV(rc, rc <= Util::k_MAX_NUM_IOVECS * 1000);
+                    ASSERTV(rc, length - rc == source.length());
+                }
+                else {
+                    ASSERTV(rc, errno,
+                            EAGAIN == errno || EWOULDBLOCK == errno);
+                    ASSERTV(length == source.length());
+                }
+
+                if (0 >= rc || 0 == source.length()) {
+                    while (0 < Util::readv(&dest, fds[0], 64 * 1024)) {
+                        ;  // drain the pipe
+                    }
+                    ASSERTV(errno, EAGAIN == errno || EWOULDBLOCK == errno);
+                }
+            }
+
+            if (veryVerbose) { P(numWrites) }
+
+            ASSERTV(numWrites, k_LENGTH / (Util::k_MAX_NUM_IOVECS * 1000) <
+                                                                    numWrites);
+            ASSERT(0 == Util::writevAndErase(fds[1], &source));
+
+            ASSERT(0 == ::close(fds[0]));
+            ASSERT(0 == ::close(fds[1]));
+
+            bsl::string result;
+            copyBlobToString(&result, dest);
+            ASSERT(DATA == result);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(4, &ta);
+
+            Blob blob(&factory, &ta);
+            blob.setLength(10);
+
+            ::iovec iovecs[4];
+
+            ASSERT_PASS(Util::loadIovecs(iovecs, 4, blob, 0, 10));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 4, blob, 0, 11));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 4, blob, -1, 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, -1, blob, 0, 1));
+            ASSERT_FAIL(Util::loadIovecs(0, 1, blob, 0, 1));
+            ASSERT_PASS(Util::loadIovecs(0, 0, blob, 0, 1));
+
+            ASSERT_FAIL(Util::writev(-1, blob, 1, 10));
+            ASSERT_FAIL(Util::writev(-1, blob, 0, -1));
+
+            ASSERT_FAIL(Util::readv(0, -1, 1));
+            ASSERT_FAIL(Util::readv(&blob, -1, 0));
+
+            ASSERT_FAIL(Util::writevAndErase(-1, 0));
+        }
+#else
+        if (verbose) cout << "\tSkipped: not a Unix platform." << endl;
+#endif
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING PADTOALIGNMENT
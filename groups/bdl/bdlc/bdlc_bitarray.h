@@ -444,6 +444,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
 #include <bsl_climits.h>
@@ -451,10 +452,6 @@ BSLS_IDENT("$Id: $")
 #include <bsl_iosfwd.h>
 #include <bsl_vector.h>
 
-#ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
-#include <bsl_algorithm.h>
-#endif // BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
-
 namespace BloombergLP {
 namespace bdlc {
 
@@ -966,6 +963,14 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bsl::size_t num1And(const BitArray& other) const;
+        // Return the number of indices at which the bits of both this array
+        // and the specified 'other' array have a value of 1, considering
+        // only the indices less than 'bsl::min(length(), other.length())'.
+        // Note that the result is the value of '(*this & other).num1()' for
+        // arrays of equal length, computed without creating a temporary
+        // array.
+
                                 // Aspects
 
     bslma::Allocator *allocator() const;
@@ -1786,6 +1791,14 @@ bsl::size_t BitArray::num1(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::num1(data(), begin, end - begin);
 }
 
+inline
+bsl::size_t BitArray::num1And(const BitArray& other) const
+{
+    return bdlb::BitStringUtil::num1And(data(),
+                                        other.data(),
+                                        bsl::min(d_length, other.d_length));
+}
+
                                 // Aspects
 
 inline
@@ -142,6 +142,7 @@ using bsl::uint64_t;
 // [30] size_t num0(size_t begin, size_t end);
 // [ 4] size_t num1() const;
 // [30] size_t num1(size_t begin, size_t end);
+// [31] size_t num1And(const BitArray& other) const;
 // [ 4] bslma::Allocator *allocator() const();
 // [10] STREAM& bdexStreamOut(STREAM& stream, version) const;
 // [ 5] ostream& print(ostream& stream, int level, int spacesPerLevel);
@@ -157,7 +158,7 @@ using bsl::uint64_t;
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -1418,6 +1419,66 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'num1And'
+        //
+        // Concerns:
+        //: 1 'num1And' returns the number of indices at which both arrays
+        //:   have a 1 bit, considering only the indices of the shorter array.
+        //:
+        //: 2 The method works for arrays long enough to be processed by the
+        //:   vectorized kernels of 'bdlb::BitStringUtil'.
+        //:
+        //: 3 The method works when 'other' is the object itself.
+        //
+        // Plan:
+        //: 1 For a sequence of pairs of lengths, including lengths spanning
+        //:   many words, generate random specs, create bit arrays from them,
+        //:   and compare the result of 'num1And' with that of a bit-by-bit
+        //:   loop, and, for arrays of the same length, with
+        //:   '(X & Y).num1()'.  (C-1..2)
+        //:
+        //: 2 Verify that 'X.num1And(X)' is 'X.num1()'.  (C-3)
+        //
+        // Testing:
+        //   size_t num1And(const BitArray& other) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'num1And'\n"
+                               "=================\n";
+
+        const size_t LENGTHS[] = { 0, 1, 63, 64, 65, 207, 511, 512, 513,
+                                   1000, 2049 };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            for (int lj = 0; lj < NUM_LENGTHS; ++lj) {
+                const size_t LENGTH_X = LENGTHS[li];
+                const size_t LENGTH_Y = LENGTHS[lj];
+                const size_t MIN      = bsl::min(LENGTH_X, LENGTH_Y);
+
+                for (int ti = 0; ti < 4; ++ti) {
+                    const Obj& X = gDispatch(randSpec(LENGTH_X).c_str());
+                    const Obj& Y = gDispatch(randSpec(LENGTH_Y).c_str());
+
+                    size_t exp = 0;
+                    for (size_t ii = 0; ii < MIN; ++ii) {
+                        exp += X[ii] && Y[ii];
+                    }
+
+                    ASSERTV(LENGTH_X, LENGTH_Y, exp == X.num1And(Y));
+                    ASSERTV(LENGTH_X, LENGTH_Y, exp == Y.num1And(X));
+
+                    if (LENGTH_X == LENGTH_Y) {
+                        ASSERTV(LENGTH_X, (X & Y).num1() == X.num1And(Y));
+                    }
+
+                    ASSERTV(LENGTH_X, X.num1() == X.num1And(X));
+                }
+            }
+        }
+      } break;
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
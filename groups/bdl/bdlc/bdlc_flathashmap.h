@@ -0,0 +1,1003 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', that implements an open-addressed unordered map of
+// items with unique keys.  Unlike 'bsl::unordered_map', which allocates a
+// node for each element and chains the nodes of each bucket, a
+// 'bdlc::FlatHashMap' stores its elements directly in a single contiguous
+// array, and uses a parallel array of one-byte control values, searched 16
+// at a time with SSE2 instructions where available, to locate them (see
+// 'bdlc_flathashtable').  Compared to 'bsl::unordered_map', a lookup
+// typically touches one cache line of control values and one element, and an
+// insertion allocates memory only when the map grows.
+//
+// The interface of 'bdlc::FlatHashMap' is a subset of that of
+// 'bsl::unordered_map', with the following differences:
+//
+//: o The 'value_type' is 'bsl::pair<KEY, VALUE>' (not
+//:   'bsl::pair<const KEY, VALUE>'), so that elements can be moved when the
+//:   map grows.  Modifying the key of an element through an iterator has
+//:   undefined behavior.
+//:
+//: o The map is not node-based: any insertion that rehashes the map (i.e.,
+//:   that grows it, or that purges the slots left by erased elements), and
+//:   any call to 'rehash', 'reserve', or 'reset', invalidates all
+//:   iterators, pointers, and references to its elements.
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   0.875.
+//
+// The 'HASH' functor need not distribute its values well: the hash value is
+// mixed before use, so the default 'bsl::hash<KEY>' (which is the identity
+// function for integral keys) performs well, as does 'bslh::Hash<>'.
+//
+// Elements that are bitwise moveable (see 'bslmf::IsBitwiseMoveable') are
+// relocated with 'memcpy' when the map grows; other elements are moved (using
+// the allocator of the map) and the originals destroyed.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Gathering Document Statistics
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose one wished to gather statistics on the words appearing in a large
+// set of documents on disk or in a database.  Gathering those statistics is
+// intrusive (as one is searching for all occurrences of a given word) and
+// could require a large number of lookups.  A 'bdlc::FlatHashMap' is a
+// natural choice for such an index.
+//
+// First, we define an abbreviation for the type of our container:
+//..
+//  typedef bdlc::FlatHashMap<bsl::string, int> WordTally;
+//..
+// Then, we define an array of documents, each a short string:
+//..
+//  const char *documents[] = {
+//      "It was the best of times,",
+//      "it was the worst of times,",
+//      "it was the age of wisdom,",
+//      "it was the age of foolishness,",
+//  };
+//  const bsl::size_t numDocuments = sizeof documents / sizeof *documents;
+//..
+// Next, we create a 'WordTally' object, and reserve space for the words we
+// expect to see, so that the map does not grow while we count:
+//..
+//  WordTally wordTally;
+//  wordTally.reserve(32);
+//..
+// Then, we split each document into words and count the occurrences of each
+// word, using 'operator[]' to insert a zero count for a word the first time
+// it is seen:
+//..
+//  for (bsl::size_t i = 0; i < numDocuments; ++i) {
+//      const char *p = documents[i];
+//
+//      while (*p) {
+//          while (*p && !isalpha(static_cast<unsigned char>(*p))) {
+//              ++p;
+//          }
+//
+//          const char *start = p;
+//
+//          while (*p && isalpha(static_cast<unsigned char>(*p))) {
+//              ++p;
+//          }
+//
+//          if (p != start) {
+//              ++wordTally[bsl::string(start, p)];
+//          }
+//      }
+//  }
+//..
+// Finally, we verify some of the counts:
+//..
+//  assert(11 == wordTally.size());
+//  assert( 4 == wordTally["was"]);
+//  assert( 2 == wordTally["age"]);
+//  assert( 1 == wordTally["It"]);
+//  assert( 3 == wordTally["it"]);
+//  assert(wordTally.end() == wordTally.find("epoch"));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslalg_constructorproxy.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_stdexcept.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ===========================
+                        // struct FlatHashMap_EntryUtil
+                        // ===========================
+
+template <class KEY, class VALUE, class ENTRY>
+struct FlatHashMap_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY', as required by
+    // 'FlatHashTable'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Create an entry at the specified 'entry' having the specified 'key'
+        // and a default-constructed value, using the specified 'allocator' to
+        // supply memory.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of uniquely-keyed values of the (template parameter)
+    // type 'VALUE', indexed by the (template parameter) type 'KEY', whose
+    // elements are stored in a single open-addressed array (see
+    // 'bdlc_flathashtable').  The (template parameter) types 'HASH' and
+    // 'EQUAL' are the hash and key-equality functor types.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          bsl::pair<KEY, VALUE>,
+                          FlatHashMap_EntryUtil<KEY,
+                                                VALUE,
+                                                bsl::pair<KEY, VALUE> >,
+                          HASH,
+                          EQUAL> ImplType;
+        // This is the underlying implementation class.
+
+    typedef bslmf::MovableRefUtil  MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying flat hash table used by this map
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                      key_type;
+    typedef VALUE                                    mapped_type;
+    typedef bsl::pair<KEY, VALUE>                    value_type;
+    typedef bsl::size_t                              size_type;
+    typedef bsl::ptrdiff_t                           difference_type;
+    typedef HASH                                     hasher;
+    typedef EQUAL                                    key_equal;
+    typedef value_type&                              reference;
+    typedef const value_type&                        const_reference;
+    typedef value_type*                              pointer;
+    typedef const value_type*                        const_pointer;
+    typedef typename ImplType::iterator              iterator;
+    typedef typename ImplType::const_iterator        const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'FlatHashMap' object.  Optionally specify a
+        // 'capacity' indicating the minimum initial number of slots (rounded
+        // up to a power of 2 that is at least 16, or 0 if 'capacity' is 0, in
+        // which case no memory is allocated).  Optionally specify a 'hash'
+        // functor used to generate the hash values associated with the keys
+        // of elements; if 'hash' is not supplied, a default-constructed object
+        // of the (template parameter) type 'HASH' is used.  Optionally specify
+        // an 'equal' functor used to check the equality of two keys; if
+        // 'equal' is not supplied, a default-constructed object of the
+        // (template parameter) type 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatHashMap' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'capacity', 'hash', 'equal', and 'basicAllocator' as for the
+        // constructors above.  If a key appears more than once in the range,
+        // only the first element having that key is inserted.  The behavior
+        // is undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'FlatHashMap' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap> original);
+        // Create a 'FlatHashMap' object having the same value, hasher,
+        // equality comparator, and allocator as the specified 'original'
+        // object.  The contents of 'original' are moved (in constant time) to
+        // this object, and 'original' is left empty.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'FlatHashMap' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object, using the
+        // specified 'basicAllocator' to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  The contents
+        // of 'original' are moved (in constant time) to this object if the
+        // allocators are the same (leaving 'original' empty), and are
+        // move-inserted otherwise (leaving 'original' valid but unspecified).
+
+    //! ~FlatHashMap() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this object the value, hasher, and equality functor of the
+        // specified 'rhs' object, and return a reference providing modifiable
+        // access to this object.
+
+    FlatHashMap& operator=(bslmf::MovableRef<FlatHashMap> rhs);
+        // Assign to this object the value, hasher, and equality comparator of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.  The contents of 'rhs' are moved
+        // (in constant time) to this object if the allocators are the same
+        // (leaving 'rhs' empty), and are copied otherwise.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element
+        // having 'key' and a default-constructed 'VALUE', and return a
+        // reference to the newly mapped value.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map, if such an entry
+        // exists; otherwise throw a 'std::out_of_range' exception.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity is not
+        // changed.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element having the specified 'key', if it
+        // exists, and return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this map.  The behavior is undefined unless 'position' refers to
+        // an element in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this map or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the iteration sequence provided by this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element in this map having the
+        // specified 'key', or 'end()' if no such entry exists.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if the key of
+        // 'value' does not already exist in this map.  Return a pair whose
+        // 'first' member is an iterator referring to the element in this map
+        // having the key of 'value' and whose 'second' member is 'true' if a
+        // new element was inserted, and 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value);
+        // Move the specified 'value' into this map if the key of 'value' does
+        // not already exist in this map.  Return a pair whose 'first' member
+        // is an iterator referring to the element in this map having the key
+        // of 'value' and whose 'second' member is 'true' if a new element was
+        // inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each element in the input
+        // iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last') whose key is not already in this map.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to at least the specified
+        // 'minimumCapacity' (and at least enough to hold the elements of this
+        // map without exceeding the maximum load factor), and redistribute
+        // all the contained elements.  Note that a 'minimumCapacity' of 0 on
+        // an empty map releases all memory.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this map, if needed, so that it can hold at
+        // least the specified 'numEntries' elements without growing.
+
+    void reset();
+        // Remove all elements from this map and release all memory.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element in the sequence of
+        // modifiable elements maintained by this map, or the 'end' iterator
+        // if this map is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end element in the sequence of
+        // modifiable elements maintained by this map.
+
+                          // Aspects
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, hasher, and equality functor of this object with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the mapped
+        // value associated with the specified 'key' in this map, if such an
+        // entry exists; otherwise throw a 'std::out_of_range' exception.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this map could hold if the load
+        // factor were 1.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified 'key'
+        // (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this map
+        // having the specified 'key', or 'end()' if no such entry exists.
+
+    HASH hash_function() const;
+        // Return (a copy of) the unary hash functor used by this map to
+        // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the binary key-equality functor that returns
+        // 'true' if the value of two 'KEY' objects is the same, and 'false'
+        // otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the number of elements in this
+        // container and its capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this map.  Note that if
+        // an insert operation would cause the load factor to exceed the
+        // 'max_load_factor', that same insert operation will increase the
+        // capacity and rehash the entries of the container.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this map, or the 'end' iterator if this map
+        // is empty.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the sequence of
+        // elements maintained by this map, or the 'end' iterator if this map
+        // is empty.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this map.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' to the past-the-end element in the
+        // sequence of elements maintained by this map.
+
+                          // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this flat hash map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashMap' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to an element of the other.  The hash and equality functors are
+    // not involved in the comparison.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashMap' objects do not
+    // have the same value if their sizes are different or one contains an
+    // element that is not equal to any element of the other.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the value, the hasher, and the key-equality functor of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the
+    // same allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct FlatHashMap_EntryUtil
+                        // ---------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::constructFromKey(
+                                                   ENTRY            *entry,
+                                                   bslma::Allocator *allocator,
+                                                   const KEY&        key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    // Construct the value with the allocator of the map, so that moving it
+    // into the entry does not allocate.
+
+    bslalg::ConstructorProxy<VALUE> defaultValue(allocator);
+
+    bslma::ConstructionUtil::construct(
+                                      entry,
+                                      allocator,
+                                      key,
+                       bslmf::MovableRefUtil::move(defaultValue.object()));
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bsl::size_t       capacity,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                           const FlatHashMap&  original,
+                                           bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                       bslmf::MovableRef<FlatHashMap> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                               bslmf::MovableRef<FlatHashMap>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<FlatHashMap> rhs)
+{
+    FlatHashMap& lvalue = rhs;
+
+    d_impl = MoveUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.try_emplace(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        BSLS_THROW(std::out_of_range("FlatHashMap::at: key not found"));
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    // Note that this overload is necessary to avoid ambiguity when the key is
+    // a table iterator.
+
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                           bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insert(MoveUtil::move(MoveUtil::access(value)));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+                          // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        BSLS_THROW(std::out_of_range("FlatHashMap::at: key not found"));
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+                          // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
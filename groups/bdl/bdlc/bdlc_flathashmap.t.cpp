@@ -0,0 +1,915 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cctype.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container that forwards to
+// 'bdlc::FlatHashTable', which is thoroughly tested in its own component.  We
+// therefore verify that each method forwards its arguments and results
+// correctly, that the map-specific methods ('operator[]', 'at', and the
+// entry-construction utility) behave as specified, and that the allocator of
+// the map is propagated to the keys and mapped values of its elements.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] FlatHashMap(bslma::Allocator *);
+// [ 2] FlatHashMap(size_t);
+// [ 2] FlatHashMap(size_t, bslma::Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, bslma::Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 3] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+// [ 3] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ...);
+// [ 4] FlatHashMap(const FlatHashMap&, bslma::Allocator *);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap>);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 4] FlatHashMap& operator=(const FlatHashMap&);
+// [ 4] FlatHashMap& operator=(MovableRef<FlatHashMap>);
+// [ 2] VALUE& operator[](const KEY&);
+// [ 2] VALUE& at(const KEY&);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY&);
+// [ 3] iterator erase(const_iterator);
+// [ 3] iterator erase(iterator);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 2] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const value_type&);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void rehash(size_t);
+// [ 3] void reserve(size_t);
+// [ 3] void reset();
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 4] void swap(FlatHashMap&);
+//
+// ACCESSORS
+// [ 2] const VALUE& at(const KEY&) const;
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashMap&, const FlatHashMap&);
+// [ 4] bool operator!=(const FlatHashMap&, const FlatHashMap&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashMap&, FlatHashMap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'
+// [ *] CONCERN: PRECONDITION VIOLATIONS ARE DETECTED WHEN ENABLED.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashMap<int, int>                 Obj;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringObj;
+typedef bslmf::MovableRefUtil                       MoveUtil;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bsl::string makeString(int value, bslma::Allocator *basicAllocator)
+    // Return a string, long enough to allocate memory, that is unique for the
+    // specified 'value', using the specified 'basicAllocator' to supply
+    // memory.
+{
+    bsl::string result("a string long enough to allocate memory: ",
+                       basicAllocator);
+
+    do {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+
+    return result;
+}
+
+template <class MAP>
+static
+void timeMap(const char *name, const bsl::vector<int>& keys)
+    // Print to 'cout' the time taken, per operation, by an object of the
+    // (template parameter) type 'MAP' to insert the first half of the
+    // specified 'keys', to find each of them, to fail to find each key of the
+    // second half, and to erase each key of the first half, labeled with the
+    // specified 'name'.  The behavior is undefined unless 'keys' has an even
+    // number of elements.
+{
+    const bsl::size_t N = keys.size() / 2;
+
+    MAP                mX;
+    bsls::Types::Int64 checksum = 0;
+    bsls::Stopwatch    timer;
+
+    timer.start();
+    for (bsl::size_t i = 0; i < N; ++i) {
+        mX[keys[i]] = static_cast<int>(i);
+    }
+    timer.stop();
+
+    const double insertTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < N; ++i) {
+        checksum += mX.find(keys[i])->second;
+    }
+    timer.stop();
+
+    const double hitTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = N; i < 2 * N; ++i) {
+        checksum += mX.end() == mX.find(keys[i]);
+    }
+    timer.stop();
+
+    const double missTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < N; ++i) {
+        checksum += mX.erase(keys[i]);
+    }
+    timer.stop();
+
+    const double eraseTime = timer.accumulatedWallTime();
+
+    const double scale = 1.0e9 / static_cast<double>(N);
+
+    cout << name << " (" << N << " keys, checksum " << checksum << "):\n"
+         << "\tinsert: " << insertTime * scale << " ns/op\n"
+         << "\thit:    " << hitTime    * scale << " ns/op\n"
+         << "\tmiss:   " << missTime   * scale << " ns/op\n"
+         << "\terase:  " << eraseTime  * scale << " ns/op" << endl;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: No memory is leaked from the default allocator.
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Gathering Document Statistics
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose one wished to gather statistics on the words appearing in a large
+// set of documents on disk or in a database.  Gathering those statistics is
+// intrusive (as one is searching for all occurrences of a given word) and
+// could require a large number of lookups.  A 'bdlc::FlatHashMap' is a
+// natural choice for such an index.
+//
+// First, we define an abbreviation for the type of our container:
+//..
+    typedef bdlc::FlatHashMap<bsl::string, int> WordTally;
+//..
+// Then, we define an array of documents, each a short string:
+//..
+    const char *documents[] = {
+        "It was the best of times,",
+        "it was the worst of times,",
+        "it was the age of wisdom,",
+        "it was the age of foolishness,",
+    };
+    const bsl::size_t numDocuments = sizeof documents / sizeof *documents;
+//..
+// Next, we create a 'WordTally' object, and reserve space for the words we
+// expect to see, so that the map does not grow while we count:
+//..
+    WordTally wordTally;
+    wordTally.reserve(32);
+//..
+// Then, we split each document into words and count the occurrences of each
+// word, using 'operator[]' to insert a zero count for a word the first time
+// it is seen:
+//..
+    for (bsl::size_t i = 0; i < numDocuments; ++i) {
+        const char *p = documents[i];
+
+        while (*p) {
+            while (*p && !isalpha(static_cast<unsigned char>(*p))) {
+                ++p;
+            }
+
+            const char *start = p;
+
+            while (*p && isalpha(static_cast<unsigned char>(*p))) {
+                ++p;
+            }
+
+            if (p != start) {
+                ++wordTally[bsl::string(start, p)];
+            }
+        }
+    }
+//..
+// Finally, we verify some of the counts:
+//..
+    ASSERT(11 == wordTally.size());
+    ASSERT( 4 == wordTally["was"]);
+    ASSERT( 2 == wordTally["age"]);
+    ASSERT( 1 == wordTally["It"]);
+    ASSERT( 3 == wordTally["it"]);
+    ASSERT(wordTally.end() == wordTally.find("epoch"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Each copy, move, and swap operation forwards to the underlying
+        //:   table, so that the resulting values and allocators are as
+        //:   specified.
+        //:
+        //: 2 Equality compares both keys and mapped values.
+        //
+        // Plan:
+        //: 1 Apply each operation to maps of 'bsl::string' and verify the
+        //:   values and allocators of the results.  (C-1)
+        //:
+        //: 2 Compare maps that differ only in a mapped value.  (C-2)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap&, bslma::Allocator *);
+        //   FlatHashMap(MovableRef<FlatHashMap>);
+        //   FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+        //   FlatHashMap& operator=(const FlatHashMap&);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap>);
+        //   void swap(FlatHashMap&);
+        //   bool operator==(const FlatHashMap&, const FlatHashMap&);
+        //   bool operator!=(const FlatHashMap&, const FlatHashMap&);
+        //   void swap(FlatHashMap&, FlatHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        StringObj mX(&oa);  const StringObj& X = mX;
+
+        for (int i = 0; i < 40; ++i) {
+            mX[makeString(i, &oa)] = makeString(i * i, &oa);
+        }
+
+        {
+            const StringObj Y(X, &sa);
+
+            ASSERT(X == Y);
+            ASSERT(&sa == Y.allocator());
+            ASSERT(&sa == Y.begin()->first.get_allocator().mechanism());
+            ASSERT(&sa == Y.begin()->second.get_allocator().mechanism());
+        }
+
+        {
+            StringObj mY(X, &oa);  const StringObj& Y = mY;
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+            const StringObj Z(MoveUtil::move(mY));
+
+            ASSERT(X == Z);
+            ASSERT(Y.empty());
+            ASSERT(numAllocations == oa.numAllocations());
+
+            StringObj mW(X, &oa);
+
+            const StringObj V(MoveUtil::move(mW), &sa);
+
+            ASSERT(X == V);
+            ASSERT(&sa == V.allocator());
+        }
+
+        {
+            StringObj mY(&sa);  const StringObj& Y = mY;
+
+            mY = X;
+
+            ASSERT(X == Y);
+            ASSERT(&sa == Y.allocator());
+
+            mY[makeString(0, &oa)] = makeString(1, &oa);
+
+            ASSERT(X.size() == Y.size());
+            ASSERT(X != Y);
+
+            StringObj mZ(X, &oa);
+
+            mY = MoveUtil::move(mZ);
+
+            ASSERT(X == Y);
+        }
+
+        {
+            StringObj mY(&oa);  const StringObj& Y = mY;
+
+            mY[makeString(1000, &oa)];
+
+            const StringObj YY(Y, &oa);
+            const StringObj XX(X, &oa);
+
+            mY.swap(mX);
+
+            ASSERT(X == YY);
+            ASSERT(Y == XX);
+
+            StringObj mZ(&sa);  const StringObj& Z = mZ;
+
+            swap(mY, mZ);
+
+            ASSERT(Z == XX);
+            ASSERT(Y.empty());
+            ASSERT(&sa == Z.allocator());
+
+            swap(mX, mZ);
+
+            ASSERT(X == XX);
+            ASSERT(Z == YY);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mY(&oa);
+            Obj mZ(&oa);
+            Obj mW(&sa);
+
+            ASSERT_SAFE_PASS(mY.swap(mZ));
+            ASSERT_SAFE_FAIL(mY.swap(mW));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE OPERATIONS, ERASURE, AND CAPACITY
+        //
+        // Concerns:
+        //: 1 The range constructors and range 'insert' insert the first
+        //:   element having each key.
+        //:
+        //: 2 Each 'erase' overload removes the specified elements.
+        //:
+        //: 3 'clear', 'rehash', 'reserve', and 'reset' forward to the
+        //:   underlying table.
+        //
+        // Plan:
+        //: 1 Build maps from a vector of pairs having duplicate keys, and
+        //:   verify their contents.  (C-1)
+        //:
+        //: 2 Erase elements using each overload and verify the contents.
+        //:   (C-2)
+        //:
+        //: 3 Exercise the capacity manipulators and verify the capacity and
+        //:   contents.  (C-3)
+        //
+        // Testing:
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ...);
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "RANGE OPERATIONS, ERASURE, AND CAPACITY" << endl
+                      << "=======================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        bsl::vector<bsl::pair<int, int> > values(&oa);
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(bsl::pair<int, int>(i % 60, i));
+        }
+
+        {
+            const Obj X(values.begin(), values.end(), &oa);
+
+            ASSERT(60 == X.size());
+            for (int i = 0; i < 60; ++i) {
+                ASSERTV(i, i == X.at(i));
+            }
+
+            const Obj Y(values.begin(),
+                        values.end(),
+                        256,
+                        bsl::hash<int>(),
+                        bsl::equal_to<int>(),
+                        &oa);
+
+            ASSERT(X == Y);
+            ASSERT(256 == Y.capacity());
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+
+            mZ[5] = 500;
+            mZ.insert(values.begin(), values.end());
+
+            ASSERT(60 == Z.size());
+            ASSERT(500 == Z.at(5));
+        }
+
+        {
+            Obj mX(values.begin(), values.end(), &oa);  const Obj& X = mX;
+
+            ASSERT(1 == mX.erase(7));
+            ASSERT(0 == mX.erase(7));
+            ASSERT(!X.contains(7));
+
+            Obj::iterator it = mX.find(8);
+            mX.erase(it);
+
+            ASSERT(!X.contains(8));
+
+            Obj::const_iterator cit = X.find(9);
+            mX.erase(cit);
+
+            ASSERT(!X.contains(9));
+            ASSERT(57 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+
+        {
+            Obj mX(values.begin(), values.end(), &oa);  const Obj& X = mX;
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.reserve(1000);
+
+            ASSERT(1000 <= X.capacity() - X.capacity() / 8);
+
+            mX.insert(values.begin(), values.end());
+            mX.rehash(0);
+
+            ASSERT(capacity == X.capacity());
+            ASSERT(60 == X.size());
+
+            mX.reset();
+
+            ASSERT(0 == X.capacity());
+        }
+        ASSERT(1 == oa.numBlocksInUse());  // 'values'
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty map having the specified
+        //:   capacity, functors, and allocator.
+        //:
+        //: 2 'operator[]' inserts a default-constructed mapped value, using
+        //:   the allocator of the map, when the key is absent.
+        //:
+        //: 3 'at' throws 'std::out_of_range' when the key is absent.
+        //:
+        //: 4 Each insertion and lookup method forwards to the underlying
+        //:   table.
+        //
+        // Plan:
+        //: 1 Create maps using each constructor and verify their attributes.
+        //:   (C-1)
+        //:
+        //: 2 Insert elements using 'operator[]' and 'insert', and verify the
+        //:   results using the accessors.  (C-2..4)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   FlatHashMap(bslma::Allocator *);
+        //   FlatHashMap(size_t);
+        //   FlatHashMap(size_t, bslma::Allocator *);
+        //   FlatHashMap(size_t, const HASH&, bslma::Allocator *);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   VALUE& operator[](const KEY&);
+        //   VALUE& at(const KEY&);
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator begin();
+        //   iterator end();
+        //   const VALUE& at(const KEY&) const;
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC MANIPULATORS AND ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        if (verbose) cout << "\nConstructors." << endl;
+        {
+            const Obj A;
+            const Obj B(&oa);
+            const Obj C(100);
+            const Obj D(100, &oa);
+            const Obj E(100, bsl::hash<int>(), &oa);
+            const Obj F(100, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+
+            ASSERT(&da == A.allocator());
+            ASSERT(&oa == B.allocator());
+            ASSERT(&da == C.allocator());
+            ASSERT(&oa == D.allocator());
+            ASSERT(&oa == E.allocator());
+            ASSERT(&oa == F.allocator());
+
+            ASSERT(  0 == A.capacity());
+            ASSERT(  0 == B.capacity());
+            ASSERT(128 == C.capacity());
+            ASSERT(128 == D.capacity());
+            ASSERT(128 == E.capacity());
+            ASSERT(128 == F.capacity());
+
+            ASSERT(A.empty());
+            ASSERT(F.empty());
+            ASSERT(0 == F.load_factor());
+            ASSERT(0.875f == F.max_load_factor());
+            ASSERT(F.begin() == F.end());
+            ASSERT(F.cbegin() == F.cend());
+            ASSERT(F.key_eq()(3, 3));
+            ASSERT(F.hash_function()(3) == bsl::hash<int>()(3));
+
+            ASSERT(1 == da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\n'operator[]', 'insert', and 'at'." << endl;
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string key   = makeString(i, &oa);
+                const bsl::string value = makeString(i + 1000, &oa);
+
+                switch (i % 3) {
+                  case 0: {
+                    bsl::string& v = mX[key];
+
+                    ASSERTV(i, v.empty());
+                    ASSERTV(i, &oa == v.get_allocator().mechanism());
+
+                    v = value;
+                  } break;
+                  case 1: {
+                    const StringObj::value_type entry(key, value);
+
+                    bsl::pair<StringObj::iterator, bool> result =
+                                                             mX.insert(entry);
+
+                    ASSERTV(i, result.second);
+                    ASSERTV(i, key   == result.first->first);
+                    ASSERTV(i, value == result.first->second);
+                  } break;
+                  default: {
+                    StringObj::value_type entry(key, value, &oa);
+
+                    bsl::pair<StringObj::iterator, bool> result =
+                                          mX.insert(MoveUtil::move(entry));
+
+                    ASSERTV(i, result.second);
+                    ASSERTV(i, value == result.first->second);
+                  } break;
+                }
+
+                ASSERTV(i, !mX.insert(StringObj::value_type(key, key)).second);
+                ASSERTV(i, value == mX[key]);
+                ASSERTV(i, value == mX.at(key));
+                ASSERTV(i, value == X.at(key));
+                ASSERTV(i, value == mX.find(key)->second);
+                ASSERTV(i, value == X.find(key)->second);
+                ASSERTV(i, X.contains(key));
+                ASSERTV(i, 1 == X.count(key));
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+                ASSERTV(i, &oa == X.find(key)->first.get_allocator()
+                                                                .mechanism());
+                ASSERTV(i, &oa == X.find(key)->second.get_allocator()
+                                                                .mechanism());
+            }
+
+            const bsl::string absent = makeString(-1, &oa);
+
+            ASSERT(!X.contains(absent));
+            ASSERT(0 == X.count(absent));
+            ASSERT(X.end() == X.find(absent));
+            ASSERT(mX.end() == mX.find(absent));
+
+            bsl::size_t numVisited = 0;
+            for (StringObj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second.append("!");
+                ++numVisited;
+            }
+            ASSERT(100 == numVisited);
+
+            for (StringObj::const_iterator it = X.cbegin(); it != X.cend();
+                 ++it) {
+                ASSERT('!' == it->second[it->second.size() - 1]);
+            }
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.at(absent);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(absent);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\n'bslh::Hash'." << endl;
+        {
+            bdlc::FlatHashMap<int, int, bslh::Hash<> > mX(&oa);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX[i] = -i;
+            }
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, -i == mX.at(i));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+
+        mX[1] = 10;
+        mX[2] = 20;
+
+        ASSERT(2  == X.size());
+        ASSERT(10 == X.at(1));
+        ASSERT(20 == X.at(2));
+        ASSERT(!X.contains(3));
+
+        ASSERT(!mX.insert(bsl::make_pair(1, 11)).second);
+        ASSERT(10 == X.at(1));
+
+        ASSERT(1 == mX.erase(1));
+        ASSERT(!X.contains(1));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mY[2] = 21;
+
+        ASSERT(X != Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'
+        //   Compare the time taken to insert, find, and erase integer keys in
+        //   a 'bdlc::FlatHashMap' with that taken for a 'bsl::unordered_map'.
+        //
+        // Concerns:
+        //: 1 Lookups in a 'bdlc::FlatHashMap' are faster than in a
+        //:   'bsl::unordered_map'.
+        //
+        // Plan:
+        //: 1 Time the insertion of 'N' pseudo-random keys, 'N' successful and
+        //:   'N' unsuccessful lookups, and the erasure of all the keys, for
+        //:   each container type, and report the results.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "PERFORMANCE TEST: COMPARISON WITH 'bsl::unordered_map'"
+              << endl
+              << "======================================================"
+              << endl;
+
+        const int N = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bsl::vector<int> keys;
+        keys.reserve(2 * N);
+
+        unsigned state = 12345;
+        for (int i = 0; i < 2 * N; ++i) {
+            state = state * 1103515245u + 12345u;
+            keys.push_back(static_cast<int>(state));
+        }
+
+        timeMap<bsl::unordered_map<int, int> >("bsl::unordered_map", keys);
+        timeMap<Obj>("bdlc::FlatHashMap", keys);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory is leaked from the default allocator.
+
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
@@ -0,0 +1,620 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container that forwards to
+// 'bdlc::FlatHashTable', which is thoroughly tested in its own component.  We
+// therefore verify that each method forwards its arguments and results
+// correctly, and that the allocator of the set is propagated to its elements.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] FlatHashSet(bslma::Allocator *);
+// [ 2] FlatHashSet(size_t);
+// [ 2] FlatHashSet(size_t, bslma::Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, bslma::Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 2] FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+// [ 3] FlatHashSet(const FlatHashSet&, bslma::Allocator *);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet>);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 3] FlatHashSet& operator=(const FlatHashSet&);
+// [ 3] FlatHashSet& operator=(MovableRef<FlatHashSet>);
+// [ 2] void clear();
+// [ 2] size_t erase(const KEY&);
+// [ 2] iterator erase(const_iterator);
+// [ 2] iterator erase(const_iterator, const_iterator);
+// [ 2] pair<iterator, bool> insert(const KEY&);
+// [ 2] pair<iterator, bool> insert(MovableRef<KEY>);
+// [ 2] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 2] void rehash(size_t);
+// [ 2] void reserve(size_t);
+// [ 2] void reset();
+// [ 3] void swap(FlatHashSet&);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const FlatHashSet&, const FlatHashSet&);
+// [ 3] bool operator!=(const FlatHashSet&, const FlatHashSet&);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatHashSet&, FlatHashSet&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ *] CONCERN: PRECONDITION VIOLATIONS ARE DETECTED WHEN ENABLED.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<int>         Obj;
+typedef bdlc::FlatHashSet<bsl::string> StringObj;
+typedef bslmf::MovableRefUtil          MoveUtil;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bsl::string makeString(int value, bslma::Allocator *basicAllocator)
+    // Return a string, long enough to allocate memory, that is unique for the
+    // specified 'value', using the specified 'basicAllocator' to supply
+    // memory.
+{
+    bsl::string result("a string long enough to allocate memory: ",
+                       basicAllocator);
+
+    do {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+
+    return result;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: No memory is leaked from the default allocator.
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Removing Duplicate Identifiers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a sequence of security identifiers, possibly with
+// repetitions, and wish to process each distinct identifier only once.
+//
+// First, we define the identifiers we receive:
+//..
+    const int received[] = { 17, 42, 17, 5, 42, 99, 5, 17 };
+    const bsl::size_t numReceived = sizeof received / sizeof *received;
+//..
+// Then, we create a 'bdlc::FlatHashSet' to record the identifiers already
+// seen:
+//..
+    bdlc::FlatHashSet<int> seen;
+//..
+// Next, we visit the identifiers, counting those seen for the first time,
+// using the 'second' member of the value returned by 'insert' to determine
+// whether the identifier was newly inserted:
+//..
+    int numDistinct = 0;
+    for (bsl::size_t i = 0; i < numReceived; ++i) {
+        if (seen.insert(received[i]).second) {
+            ++numDistinct;
+        }
+    }
+//..
+// Finally, we verify the result:
+//..
+    ASSERT(4 == numDistinct);
+    ASSERT(4 == seen.size());
+    ASSERT(seen.contains(99));
+    ASSERT(!seen.contains(3));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Each copy, move, and swap operation forwards to the underlying
+        //:   table, so that the resulting values and allocators are as
+        //:   specified.
+        //:
+        //: 2 Equality does not depend on the order of insertion.
+        //
+        // Plan:
+        //: 1 Apply each operation to sets of 'bsl::string' and verify the
+        //:   values and allocators of the results.  (C-1..2)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet&, bslma::Allocator *);
+        //   FlatHashSet(MovableRef<FlatHashSet>);
+        //   FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+        //   FlatHashSet& operator=(const FlatHashSet&);
+        //   FlatHashSet& operator=(MovableRef<FlatHashSet>);
+        //   void swap(FlatHashSet&);
+        //   bool operator==(const FlatHashSet&, const FlatHashSet&);
+        //   bool operator!=(const FlatHashSet&, const FlatHashSet&);
+        //   void swap(FlatHashSet&, FlatHashSet&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        StringObj mX(&oa);  const StringObj& X = mX;
+        StringObj mY(&oa);  const StringObj& Y = mY;
+
+        for (int i = 0; i < 40; ++i) {
+            mX.insert(makeString(i, &oa));
+            mY.insert(makeString(39 - i, &oa));
+        }
+
+        ASSERT(X == Y);
+        ASSERT(!(X != Y));
+
+        {
+            const StringObj Z(X, &sa);
+
+            ASSERT(X == Z);
+            ASSERT(&sa == Z.allocator());
+            ASSERT(&sa == Z.begin()->get_allocator().mechanism());
+        }
+
+        {
+            StringObj mW(X, &oa);  const StringObj& W = mW;
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+            const StringObj Z(MoveUtil::move(mW));
+
+            ASSERT(X == Z);
+            ASSERT(W.empty());
+            ASSERT(numAllocations == oa.numAllocations());
+
+            StringObj mV(X, &oa);
+
+            const StringObj U(MoveUtil::move(mV), &sa);
+
+            ASSERT(X == U);
+            ASSERT(&sa == U.allocator());
+        }
+
+        {
+            StringObj mZ(&sa);  const StringObj& Z = mZ;
+
+            mZ = X;
+
+            ASSERT(X == Z);
+            ASSERT(&sa == Z.allocator());
+
+            mZ.erase(makeString(0, &oa));
+            mZ.insert(makeString(100, &oa));
+
+            ASSERT(X.size() == Z.size());
+            ASSERT(X != Z);
+
+            StringObj mW(X, &oa);
+
+            mZ = MoveUtil::move(mW);
+
+            ASSERT(X == Z);
+        }
+
+        {
+            StringObj mW(&oa);  const StringObj& W = mW;
+
+            mW.insert(makeString(1000, &oa));
+
+            const StringObj WW(W, &oa);
+
+            mW.swap(mX);
+
+            ASSERT(X == WW);
+            ASSERT(W == Y);
+
+            StringObj mZ(&sa);  const StringObj& Z = mZ;
+
+            swap(mW, mZ);
+
+            ASSERT(Z == Y);
+            ASSERT(W.empty());
+            ASSERT(&sa == Z.allocator());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mA(&oa);
+            Obj mB(&oa);
+            Obj mC(&sa);
+
+            ASSERT_SAFE_PASS(mA.swap(mB));
+            ASSERT_SAFE_FAIL(mA.swap(mC));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty set having the specified
+        //:   capacity, functors, and allocator.
+        //:
+        //: 2 Each manipulator and accessor forwards to the underlying table.
+        //:
+        //: 3 The elements use the allocator of the set.
+        //
+        // Plan:
+        //: 1 Create sets using each constructor and verify their attributes.
+        //:   (C-1)
+        //:
+        //: 2 Insert, find, and erase elements using each method and verify
+        //:   the results using the accessors.  (C-2..3)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   FlatHashSet(bslma::Allocator *);
+        //   FlatHashSet(size_t);
+        //   FlatHashSet(size_t, bslma::Allocator *);
+        //   FlatHashSet(size_t, const HASH&, bslma::Allocator *);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   pair<iterator, bool> insert(const KEY&);
+        //   pair<iterator, bool> insert(MovableRef<KEY>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC MANIPULATORS AND ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        if (verbose) cout << "\nConstructors." << endl;
+        {
+            const Obj A;
+            const Obj B(&oa);
+            const Obj C(100);
+            const Obj D(100, &oa);
+            const Obj E(100, bsl::hash<int>(), &oa);
+            const Obj F(100, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+
+            ASSERT(&da == A.allocator());
+            ASSERT(&oa == B.allocator());
+            ASSERT(&da == C.allocator());
+            ASSERT(&oa == D.allocator());
+            ASSERT(&oa == E.allocator());
+            ASSERT(&oa == F.allocator());
+
+            ASSERT(  0 == A.capacity());
+            ASSERT(  0 == B.capacity());
+            ASSERT(128 == C.capacity());
+            ASSERT(128 == D.capacity());
+            ASSERT(128 == E.capacity());
+            ASSERT(128 == F.capacity());
+
+            ASSERT(F.empty());
+            ASSERT(0 == F.load_factor());
+            ASSERT(0.875f == F.max_load_factor());
+            ASSERT(F.begin() == F.end());
+            ASSERT(F.cbegin() == F.cend());
+            ASSERT(F.key_eq()(3, 3));
+            ASSERT(F.hash_function()(3) == bsl::hash<int>()(3));
+
+            const int DATA[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+
+            const Obj G(DATA, DATA + sizeof DATA / sizeof *DATA, &oa);
+
+            ASSERT(7 == G.size());
+            ASSERT(&oa == G.allocator());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nInsertion, lookup, and erasure." << endl;
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::string key = makeString(i, &oa);
+
+                bsl::pair<StringObj::iterator, bool> result;
+                if (i % 2) {
+                    result = mX.insert(key);
+                }
+                else {
+                    bsl::string temp(key, &oa);
+
+                    result = mX.insert(MoveUtil::move(temp));
+                }
+
+                ASSERTV(i, result.second);
+                ASSERTV(i, key == *result.first);
+                ASSERTV(i, &oa == result.first->get_allocator().mechanism());
+                ASSERTV(i, !mX.insert(key).second);
+                ASSERTV(i, X.contains(key));
+                ASSERTV(i, 1 == X.count(key));
+                ASSERTV(i, key == *X.find(key));
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+                ASSERTV(i, X.load_factor() <= X.max_load_factor());
+            }
+
+            const bsl::string absent = makeString(-1, &oa);
+
+            ASSERT(!X.contains(absent));
+            ASSERT(0 == X.count(absent));
+            ASSERT(X.end() == X.find(absent));
+
+            bsl::size_t numVisited = 0;
+            for (StringObj::const_iterator it = X.cbegin(); it != X.cend();
+                 ++it) {
+                ++numVisited;
+            }
+            ASSERT(100 == numVisited);
+
+            ASSERT(1 == mX.erase(makeString(7, &oa)));
+            ASSERT(0 == mX.erase(makeString(7, &oa)));
+            ASSERT(!X.contains(makeString(7, &oa)));
+
+            mX.erase(X.find(makeString(8, &oa)));
+
+            ASSERT(!X.contains(makeString(8, &oa)));
+            ASSERT(98 == X.size());
+
+            const bsl::size_t capacity = X.capacity();
+
+            bsl::vector<bsl::string> all(X.begin(), X.end(), &oa);
+
+            mX.clear();
+
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.insert(all.begin(), all.end());
+
+            ASSERT(98 == X.size());
+
+            mX.reserve(1000);
+
+            ASSERT(1000 <= X.capacity() - X.capacity() / 8);
+
+            mX.rehash(0);
+
+            ASSERT(capacity == X.capacity());
+            ASSERT(98 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+
+            mX.reset();
+
+            ASSERT(0 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(1).second);
+        ASSERT( mX.insert(2).second);
+        ASSERT(!mX.insert(1).second);
+
+        ASSERT(2 == X.size());
+        ASSERT(X.contains(1));
+        ASSERT(!X.contains(3));
+
+        ASSERT(1 == mX.erase(1));
+        ASSERT(!X.contains(1));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mY.insert(3);
+
+        ASSERT(X != Y);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory is leaked from the default allocator.
+
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
@@ -0,0 +1,1609 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table like Abseil 'flat_hash_map'.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table like Abseil 'flat_hash_map'
+//  bdlc::FlatHashTable_IteratorImp: iterator implementation for the table
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides the class template
+// 'bdlc::FlatHashTable', which implements an open-addressed hash table in
+// which the entries are stored directly in a single contiguous array (rather
+// than in individually allocated nodes, as 'bsl::unordered_map' does), and a
+// parallel array of one-byte control values records the state of each slot.
+// The design follows the "Swiss table" of the Abseil library: the control
+// values are organized in groups of 16 (see 'bdlc_flathashtable_groupcontrol')
+// so that a single group of slots can be searched for a key with a handful of
+// SSE2 instructions, and the probe sequence advances a group, not a slot, at a
+// time.  This component is the implementation of 'bdlc::FlatHashMap' and
+// 'bdlc::FlatHashSet', and is not intended for direct use.
+//
+// 'bdlc::FlatHashTable' is parameterized by the 'KEY' type, the 'ENTRY' type
+// stored in the table, an 'ENTRY_UTIL' type that extracts the key from an
+// entry and constructs an entry from a key, and the 'HASH' and 'EQUAL'
+// functor types.  'ENTRY_UTIL' must provide the following static member
+// functions:
+//..
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Create an entry at the specified 'entry' having the specified 'key'
+//      // (and a default-constructed value, if any), using the specified
+//      // 'allocator' to supply memory.
+//
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a reference to the key of the specified 'entry'.
+//..
+//
+///Hash Values and Probing
+///-----------------------
+// The value returned by 'HASH' for a key is first mixed by multiplying by a
+// large odd constant, so that functors with poor distribution (e.g.,
+// 'bsl::hash<int>', the identity function) may be used safely.  The
+// high-order bits of the mixed hash value select the group at which the probe
+// sequence for the key starts, and the low-order seven bits are stored as the
+// control value of the key's slot.  A lookup examines, for each group of the
+// probe sequence, only those slots whose control value matches, and stops at
+// the first group having an empty slot.  Successive groups of a probe
+// sequence are at triangular-number offsets from the first, which visits
+// every group of the table (whose number of groups is always a power of 2).
+//
+///Capacity and Load Factor
+///------------------------
+// The capacity of a table (the number of slots) is either 0, in which case no
+// memory is allocated, or a power of 2 that is at least 16.  Erasing an entry
+// marks its slot as erased (or as empty, if no probe sequence can pass through
+// its group); an erased slot is reused by a later insertion and purged by
+// 'rehash'.  Since erased slots, like slots in use, do not end a probe
+// sequence, they count against the maximum load factor ('max_load_factor()',
+// 0.875) along with the entries: whenever an insertion would make the number
+// of entries and erased slots exceed that load, the table is rehashed, at the
+// same capacity if at most half of that load is in use by entries, and at
+// twice its capacity otherwise.  Therefore, a table whose size stays constant
+// under repeated insertions and erasures keeps a constant capacity, and its
+// probe sequences stay short.
+//
+///Exception Safety
+///----------------
+// Each manipulator provides the strong exception guarantee, except that, if
+// the hash functor or the move constructor of 'ENTRY' throws while the table
+// is being rehashed, the table is left empty (the entries not yet moved are
+// destroyed).  Note that neither hashing a 'bsl::string' nor moving a
+// 'bsl::string' within the same allocator can throw.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any operation that rehashes the table (i.e., an insertion that grows the
+// table or purges its erased slots, or a call to 'rehash', 'reserve', or
+// 'reset') invalidates all iterators, pointers, and references to the entries
+// of the table.  Erasing an entry invalidates only the iterators, pointers,
+// and references to that entry.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashmap' and
+// 'bdlc_flathashset', and is *not* intended for direct client use.  It is
+// subject to change without notice.  As such, a usage example is not provided.
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_iterator.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ===============================
+                     // class FlatHashTable_IteratorImp
+                     // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class implements the methods required by 'bslstl::ForwardIterator'
+    // to provide forward iterators over the entries of a 'FlatHashTable'.  A
+    // default-constructed object represents the end of every table.
+
+    // DATA
+    ENTRY              *d_entry_p;            // current entry, or 0 at end
+    const bsl::uint8_t *d_control_p;          // control value of current
+                                              // entry
+
+    bsl::size_t         d_additionalLength;   // number of slots after the
+                                              // current one
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator implementation representing the end of every
+        // table.
+
+    FlatHashTable_IteratorImp(ENTRY              *entry,
+                              const bsl::uint8_t *control,
+                              bsl::size_t         additionalLength);
+        // Create an iterator implementation referring to the specified
+        // 'entry', whose control value is at the specified 'control', and
+        // followed by the specified 'additionalLength' slots.  The behavior is
+        // undefined unless 'entry' is in use.
+
+    //! FlatHashTable_IteratorImp(const FlatHashTable_IteratorImp&) = default;
+    //! ~FlatHashTable_IteratorImp() = default;
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                         const FlatHashTable_IteratorImp&) = default;
+
+    void operator++();
+        // Advance this iterator implementation to the next entry in use, or
+        // to the end if there is none.  The behavior is undefined unless this
+        // object does not represent the end.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this object.  The
+        // behavior is undefined unless this object does not represent the end.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to the same entry
+    // (or both represent the end), and 'false' otherwise.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed, "Swiss table" hash
+    // table storing entries of the (template parameter) type 'ENTRY', which
+    // are identified by a key of the (template parameter) type 'KEY' extracted
+    // by the (template parameter) type 'ENTRY_UTIL', and hashed and compared
+    // using the (template parameter) types 'HASH' and 'EQUAL'.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+    typedef bslmf::MovableRefUtil      MoveUtil;
+
+    // DATA
+    ENTRY            *d_entries_p;     // array of slots, followed by the array
+                                       // of control values, in one block
+
+    bsl::uint8_t     *d_controls_p;    // array of control values
+
+    bsl::size_t       d_size;          // number of entries in use
+
+    bsl::size_t       d_numErased;     // number of slots marked erased
+
+    bsl::size_t       d_capacity;      // number of slots (0 or a power of 2
+                                       // that is at least 'k_SIZE')
+
+    int               d_groupShift;    // right shift of a mixed hash value
+                                       // that yields its first group
+
+    HASH              d_hasher;        // hash functor
+
+    EQUAL             d_equal;         // key-equality functor
+
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Uint64 mix(bsl::size_t hashValue);
+        // Return the result of mixing the bits of the specified 'hashValue' so
+        // that both its high-order and its low-order bits are well
+        // distributed.
+
+    static bsl::size_t capacityForSize(bsl::size_t numEntries);
+        // Return the minimum capacity of a table that can hold the specified
+        // 'numEntries' without exceeding the maximum load factor.
+
+    // PRIVATE MANIPULATORS
+    void allocateArrays(bsl::size_t capacity);
+        // Set the capacity of this table to the specified 'capacity', and
+        // allocate its slots and control values, all marked empty.  The
+        // behavior is undefined unless this table owns no memory, and
+        // 'capacity' is 0 or a power of 2 that is at least 'k_SIZE'.
+
+    void copyEntries(const FlatHashTable& original);
+        // Copy-construct the entries of the specified 'original' table into
+        // the same slots of this table.  If an exception is thrown, the
+        // entries of this table are left unconstructed.  The behavior is
+        // undefined unless this table is empty and has the same capacity as
+        // 'original'.
+
+    void destroyEntries();
+        // Destroy the entries of this table, without changing its control
+        // values.
+
+    void markErased(bsl::size_t index);
+        // Mark the slot at the specified 'index' as erased, or as empty if no
+        // probe sequence can pass through its group.  The behavior is
+        // undefined unless the slot is marked in use.
+
+    void releaseArrays();
+        // Deallocate the slots and control values of this table, and set its
+        // capacity to 0.  The behavior is undefined unless this table has no
+        // constructed entries.
+
+    void rehashRaw(bsl::size_t newCapacity);
+        // Move the entries of this table into newly-allocated arrays having
+        // the specified 'newCapacity' and deallocate the old arrays.  The
+        // behavior is undefined unless 'newCapacity' is 0 or a power of 2 that
+        // is at least 'k_SIZE', and the maximum load factor would not be
+        // exceeded.
+
+    bsl::size_t prepareInsert(bsls::Types::Uint64 mixedHash);
+        // Mark as in use the first available slot of the probe sequence for
+        // the specified 'mixedHash' and return its index, first rehashing the
+        // table if inserting an entry would make the number of entries and
+        // erased slots exceed the maximum load factor.  The
+        // behavior is undefined unless there is no entry having a key with
+        // the hash value indicated by 'mixedHash' in this table.  Note that
+        // the caller must construct the entry in the returned slot (or call
+        // 'unprepareInsert' if it cannot).
+
+    void unprepareInsert(bsl::size_t index);
+        // Undo the effect of 'prepareInsert', which returned the specified
+        // 'index'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findKey(const KEY& key, bsls::Types::Uint64 mixedHash) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key', whose mixed hash value is the specified 'mixedHash', if one
+        // exists, and 'd_capacity' otherwise.
+
+    bsl::size_t findAvailable(bsls::Types::Uint64 mixedHash) const;
+        // Return the index of the first available slot of the probe sequence
+        // for the specified 'mixedHash'.  The behavior is undefined unless
+        // this table has an available slot.
+
+    bsl::size_t firstGroup(bsls::Types::Uint64 mixedHash) const;
+        // Return the index of the first group of the probe sequence for the
+        // specified 'mixedHash'.  The behavior is undefined unless
+        // '0 < d_capacity'.
+
+  public:
+    // TYPES
+    typedef bslstl::ForwardIterator<ENTRY, FlatHashTable_IteratorImp<ENTRY> >
+                                                                      iterator;
+    typedef bslstl::ForwardIterator<const ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                                const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    static const bsl::size_t k_MIN_CAPACITY = GroupControl::k_SIZE;
+        // minimum non-zero capacity of a table
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity',
+        // that will use the specified 'hash' to generate hash values for the
+        // keys of its entries and the specified 'equal' to compare keys.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'capacity' is 0, no memory is allocated.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, hasher, key-equality
+        // comparator, and allocator as the specified 'original' by moving the
+        // contents of 'original' to the new table.  'original' is left empty
+        // (with a capacity of 0).
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original', using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The contents of
+        // 'original' are moved to the new table if the allocators are the
+        // same (leaving 'original' empty), and are move-inserted into the new
+        // table otherwise (leaving 'original' valid but unspecified).
+
+    ~FlatHashTable();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher, and key-equality comparator
+        // of the specified 'rhs', and return a reference providing modifiable
+        // access to this object.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this object the value, hasher, and key-equality comparator
+        // of the specified 'rhs', and return a reference providing modifiable
+        // access to this object.  The contents of 'rhs' are moved to this
+        // table if the allocators are the same (leaving 'rhs' empty), and are
+        // copied otherwise (leaving 'rhs' unchanged).
+
+    void clear();
+        // Destroy all entries of this table, retaining its capacity.
+
+    bsl::size_t erase(const KEY& key);
+        // Destroy the entry having the specified 'key', if it exists.  Return
+        // the number of entries destroyed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Destroy the entry at the specified 'position', and return an
+        // iterator referring to the entry following it (or the end iterator
+        // if there is none).  The behavior is undefined unless 'position'
+        // refers to an entry of this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Destroy the entries in the range '[first, last)', and return
+        // 'last'.  The behavior is undefined unless 'first' and 'last' are
+        // iterators into this table and 'first' does not follow 'last'.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if there is
+        // no entry having an equivalent key.  Return a pair whose 'first'
+        // member refers to the entry having the key of 'entry' and whose
+        // 'second' member is 'true' if a new entry was inserted, and 'false'
+        // otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Move the specified 'entry' into this table if there is no entry
+        // having an equivalent key.  Return a pair whose 'first' member
+        // refers to the entry having the key of 'entry' and whose 'second'
+        // member is 'true' if a new entry was inserted, and 'false' otherwise.
+        // If no entry is inserted, 'entry' is unchanged.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the least capacity that is at
+        // least the specified 'minimumCapacity' and can hold the entries of
+        // this table without exceeding the maximum load factor, and purge
+        // all erased slots.  Note that a 'minimumCapacity' of 0 releases all
+        // memory if the table is empty.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this table, if needed, so that it can hold
+        // at least the specified 'numEntries' without rehashing.
+
+    void reset();
+        // Destroy all entries of this table, and release all memory.
+
+    bsl::pair<iterator, bool> try_emplace(const KEY& key);
+        // Insert an entry having the specified 'key' (and a default-
+        // constructed value, if any) into this table if there is no entry
+        // having an equivalent key.  Return a pair whose 'first' member refers
+        // to the entry having 'key' and whose 'second' member is 'true' if a
+        // new entry was inserted, and 'false' otherwise.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the end iterator if this table is empty.
+
+    iterator end();
+        // Return the end iterator of this table.
+
+                          // Aspects
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, and key-equality comparator of this
+        // object with those of the specified 'other' object.  This method
+        // provides the no-throw exception-safety guarantee if the hasher and
+        // comparator can be swapped without throwing.  The behavior is
+        // undefined unless this object was created with the same allocator as
+        // 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified 'key',
+        // and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the end iterator if there is no such entry.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this table.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this table.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries of this table to its
+        // capacity, or 0 if its capacity is 0.
+
+    float max_load_factor() const;
+        // Return the load factor above which this table is grown.
+
+    bsl::size_t size() const;
+        // Return the number of entries of this table.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the end iterator if this table is empty.
+
+    const_iterator end() const;
+        // Return the end iterator of this table.
+
+                          // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and for each entry of 'lhs' there is an
+    // entry of 'rhs' having an equivalent key that compares equal to it.  Note
+    // that this operator requires 'ENTRY' to provide 'operator=='.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' tables.  This function
+    // provides the no-throw exception-safety guarantee if the two objects
+    // were created with the same allocator, and the basic guarantee
+    // otherwise.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class FlatHashTable_IteratorImp
+                     // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entry_p(0)
+, d_control_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                          ENTRY              *entry,
+                                          const bsl::uint8_t *control,
+                                          bsl::size_t         additionalLength)
+: d_entry_p(entry)
+, d_control_p(control)
+, d_additionalLength(additionalLength)
+{
+    BSLS_ASSERT_SAFE(entry);
+    BSLS_ASSERT_SAFE(control);
+    BSLS_ASSERT_SAFE(0 == (*control & FlatHashTable_GroupControl::k_EMPTY));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entry_p);
+
+    while (d_additionalLength) {
+        --d_additionalLength;
+        ++d_entry_p;
+        ++d_control_p;
+
+        if (0 == (*d_control_p & FlatHashTable_GroupControl::k_EMPTY)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_entry_p   = 0;
+    d_control_p = 0;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entry_p);
+
+    return *d_entry_p;
+}
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entry_p == rhs.d_entry_p;
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PUBLIC CONSTANTS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+const bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::k_MIN_CAPACITY;
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mix(bsl::size_t hashValue)
+{
+    // Multiplying by the odd constant closest to '2^64 / phi' (Fibonacci
+    // hashing) propagates every bit of 'hashValue' into the high-order bits.
+
+    return static_cast<bsls::Types::Uint64>(hashValue)
+                                                      * 0x9E3779B97F4A7C15ULL;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacityForSize(
+                                                        bsl::size_t numEntries)
+{
+    if (0 == numEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t result = k_MIN_CAPACITY;
+
+    // The maximum load factor is 7/8.
+
+    while (result - result / 8 < numEntries) {
+        result *= 2;
+    }
+
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateArrays(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_entries_p);
+    BSLS_ASSERT_SAFE(0 == capacity || k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+
+    d_numErased = 0;
+
+    if (0 == capacity) {
+        d_capacity   = 0;
+        d_groupShift = 0;
+        return;                                                       // RETURN
+    }
+
+    // Allocate the slots and control values in a single block, the control
+    // values (which have no alignment requirement) following the slots.
+
+    d_entries_p  = static_cast<ENTRY *>(
+                 d_allocator_p->allocate(capacity * (sizeof(ENTRY) + 1)));
+    d_controls_p = reinterpret_cast<bsl::uint8_t *>(d_entries_p + capacity);
+    d_capacity   = capacity;
+
+    bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+
+    // The first group of a probe sequence is given by the high-order
+    // 'log2(capacity / k_SIZE)' bits of the mixed hash value.  A table having
+    // a single group uses a shift of 63 (and the group mask discards the
+    // remaining bit).
+
+    const int numGroupBits = bdlb::BitUtil::log2(
+                 static_cast<bsl::uint64_t>(capacity / GroupControl::k_SIZE));
+
+    d_groupShift = 64 - (numGroupBits ? numGroupBits : 1);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::copyEntries(
+                                                 const FlatHashTable& original)
+{
+    BSLS_ASSERT_SAFE(0 == d_size);
+    BSLS_ASSERT_SAFE(d_capacity == original.d_capacity);
+
+    bsl::size_t i = 0;
+
+    BSLS_TRY {
+        for (; i < d_capacity; ++i) {
+            if (0 == (original.d_controls_p[i] & GroupControl::k_EMPTY)) {
+                bslma::ConstructionUtil::construct(d_entries_p + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        while (i) {
+            --i;
+            if (0 == (original.d_controls_p[i] & GroupControl::k_EMPTY)) {
+                bslma::DestructionUtil::destroy(d_entries_p + i);
+            }
+        }
+        BSLS_RETHROW;
+    }
+
+    bsl::memcpy(d_controls_p, original.d_controls_p, d_capacity);
+    d_size      = original.d_size;
+    d_numErased = original.d_numErased;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+            bslma::DestructionUtil::destroy(d_entries_p + i);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::markErased(
+                                                             bsl::size_t index)
+{
+    const bsl::size_t base = index & ~(GroupControl::k_SIZE - 1);
+
+    // If the group of the slot has an empty slot, no probe sequence has ever
+    // passed through the group, so the slot can be marked empty.
+
+    if (GroupControl(d_controls_p + base).neverFull()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::releaseArrays()
+{
+    if (d_entries_p) {
+        d_allocator_p->deallocate(d_entries_p);
+    }
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+    d_size       = 0;
+    d_numErased  = 0;
+    d_capacity   = 0;
+    d_groupShift = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                       bsl::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_size <= newCapacity - newCapacity / 8);
+
+    ENTRY        *oldEntries  = d_entries_p;
+    bsl::uint8_t *oldControls = d_controls_p;
+    bsl::size_t   oldCapacity = d_capacity;
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+
+    BSLS_TRY {
+        allocateArrays(newCapacity);
+    }
+    BSLS_CATCH(...) {
+        d_entries_p  = oldEntries;
+        d_controls_p = oldControls;
+        BSLS_RETHROW;
+    }
+
+    bsl::size_t i = 0;
+
+    BSLS_TRY {
+        for (; i < oldCapacity; ++i) {
+            if (0 == (oldControls[i] & GroupControl::k_EMPTY)) {
+                const bsls::Types::Uint64 mixedHash = mix(
+                             d_hasher(ENTRY_UTIL::key(oldEntries[i])));
+                const bsl::size_t         index     =
+                                                     findAvailable(mixedHash);
+
+                bslma::ConstructionUtil::destructiveMove(d_entries_p + index,
+                                                         d_allocator_p,
+                                                         oldEntries + i);
+                d_controls_p[index] = static_cast<bsl::uint8_t>(
+                                                             mixedHash & 0x7F);
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        // Destroy the entries moved so far and those not yet moved (including
+        // the one whose move failed, which is left intact), leaving this
+        // table empty.
+
+        destroyEntries();
+        d_allocator_p->deallocate(d_entries_p);
+
+        for (; i < oldCapacity; ++i) {
+            if (0 == (oldControls[i] & GroupControl::k_EMPTY)) {
+                bslma::DestructionUtil::destroy(oldEntries + i);
+            }
+        }
+        d_allocator_p->deallocate(oldEntries);
+
+        d_entries_p  = 0;
+        d_controls_p = 0;
+        releaseArrays();
+        BSLS_RETHROW;
+    }
+
+    if (oldEntries) {
+        d_allocator_p->deallocate(oldEntries);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareInsert(
+                                                 bsls::Types::Uint64 mixedHash)
+{
+    const bsl::size_t maxLoad = d_capacity - d_capacity / 8;
+
+    if (d_size + d_numErased + 1 > maxLoad) {
+        // Purge the erased slots, at the same capacity if they account for at
+        // least half of the maximum load, so that a table whose size is
+        // stable does not grow.
+
+        bsl::size_t newCapacity = 2 * d_capacity;
+
+        if (0 == d_capacity) {
+            newCapacity = k_MIN_CAPACITY;
+        }
+        else if (d_size + 1 <= maxLoad / 2) {
+            newCapacity = d_capacity;
+        }
+
+        rehashRaw(newCapacity);
+    }
+
+    const bsl::size_t index = findAvailable(mixedHash);
+
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    d_controls_p[index] = static_cast<bsl::uint8_t>(mixedHash & 0x7F);
+
+    return index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::unprepareInsert(
+                                                             bsl::size_t index)
+{
+    // The slot was available, so no probe sequence passes through it other
+    // than ones that already passed through it when it was available.
+
+    markErased(index);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::firstGroup(
+                                           bsls::Types::Uint64 mixedHash) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    return static_cast<bsl::size_t>(mixedHash >> d_groupShift)
+                                   & (d_capacity / GroupControl::k_SIZE - 1);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                     const KEY&          key,
+                                     bsls::Types::Uint64 mixedHash) const
+{
+    if (0 == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t  numGroups = d_capacity / GroupControl::k_SIZE;
+    const bsl::uint8_t h2        = static_cast<bsl::uint8_t>(mixedHash & 0x7F);
+
+    bsl::size_t group = firstGroup(mixedHash);
+
+    for (bsl::size_t step = 1; step <= numGroups; ++step) {
+        const bsl::size_t  base = group * GroupControl::k_SIZE;
+        const GroupControl control(d_controls_p + base);
+
+        bsl::uint32_t candidates = control.match(h2);
+        while (candidates) {
+            const bsl::size_t index = base
+                            + bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            if (d_equal(ENTRY_UTIL::key(d_entries_p[index]), key)) {
+                return index;                                         // RETURN
+            }
+            candidates &= candidates - 1;
+        }
+
+        if (control.neverFull()) {
+            break;
+        }
+
+        group = (group + step) & (numGroups - 1);
+    }
+
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                           bsls::Types::Uint64 mixedHash) const
+{
+    BSLS_ASSERT_SAFE(d_size < d_capacity);
+
+    const bsl::size_t numGroups = d_capacity / GroupControl::k_SIZE;
+
+    bsl::size_t group = firstGroup(mixedHash);
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t   base      = group * GroupControl::k_SIZE;
+        const bsl::uint32_t available =
+                               GroupControl(d_controls_p + base).available();
+
+        if (available) {
+            return base + bdlb::BitUtil::numTrailingUnsetBits(available);
+                                                                      // RETURN
+        }
+
+        group = (group + step) & (numGroups - 1);
+    }
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        bsl::size_t newCapacity = k_MIN_CAPACITY;
+        while (newCapacity < capacity) {
+            newCapacity *= 2;
+        }
+        allocateArrays(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                         const FlatHashTable&  original,
+                                         bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    allocateArrays(original.d_capacity);
+
+    if (d_capacity) {
+        BSLS_TRY {
+            copyEntries(original);
+        }
+        BSLS_CATCH(...) {
+            releaseArrays();
+            BSLS_RETHROW;
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(MoveUtil::access(original).d_entries_p)
+, d_controls_p(MoveUtil::access(original).d_controls_p)
+, d_size(MoveUtil::access(original).d_size)
+, d_numErased(MoveUtil::access(original).d_numErased)
+, d_capacity(MoveUtil::access(original).d_capacity)
+, d_groupShift(MoveUtil::access(original).d_groupShift)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    FlatHashTable& lvalue = original;
+
+    lvalue.d_entries_p  = 0;
+    lvalue.d_controls_p = 0;
+    lvalue.d_size       = 0;
+    lvalue.d_numErased  = 0;
+    lvalue.d_capacity   = 0;
+    lvalue.d_groupShift = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                             bslmf::MovableRef<FlatHashTable>  original,
+                             bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        d_entries_p  = lvalue.d_entries_p;
+        d_controls_p = lvalue.d_controls_p;
+        d_size       = lvalue.d_size;
+        d_numErased  = lvalue.d_numErased;
+        d_capacity   = lvalue.d_capacity;
+        d_groupShift = lvalue.d_groupShift;
+
+        lvalue.d_entries_p  = 0;
+        lvalue.d_controls_p = 0;
+        lvalue.d_size       = 0;
+        lvalue.d_numErased  = 0;
+        lvalue.d_capacity   = 0;
+        lvalue.d_groupShift = 0;
+    }
+    else {
+        allocateArrays(lvalue.d_capacity);
+
+        bsl::size_t i = 0;
+
+        BSLS_TRY {
+            for (; i < d_capacity; ++i) {
+                if (0 == (lvalue.d_controls_p[i] & GroupControl::k_EMPTY)) {
+                    bslma::ConstructionUtil::construct(
+                                     d_entries_p + i,
+                                     d_allocator_p,
+                                     MoveUtil::move(lvalue.d_entries_p[i]));
+                }
+            }
+        }
+        BSLS_CATCH(...) {
+            while (i) {
+                --i;
+                if (0 == (lvalue.d_controls_p[i] & GroupControl::k_EMPTY)) {
+                    bslma::DestructionUtil::destroy(d_entries_p + i);
+                }
+            }
+            releaseArrays();
+            BSLS_RETHROW;
+        }
+
+        if (d_capacity) {
+            bsl::memcpy(d_controls_p, lvalue.d_controls_p, d_capacity);
+        }
+        d_size      = lvalue.d_size;
+        d_numErased = lvalue.d_numErased;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    destroyEntries();
+    releaseArrays();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+
+        swap(other);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        if (d_allocator_p == lvalue.d_allocator_p) {
+            FlatHashTable other(MoveUtil::move(lvalue));
+
+            swap(other);
+        }
+        else {
+            FlatHashTable other(lvalue, d_allocator_p);
+
+            swap(other);
+        }
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    if (d_capacity) {
+        destroyEntries();
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+        d_size      = 0;
+        d_numErased = 0;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findKey(key, mix(d_hasher(key)));
+
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    markErased(index);
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const bsl::size_t index = &*position - d_entries_p;
+
+    iterator result(FlatHashTable_IteratorImp<ENTRY>(
+                                                 d_entries_p + index,
+                                                 d_controls_p + index,
+                                                 d_capacity - index - 1));
+    ++result;
+
+    markErased(index);
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    const bsl::size_t index = last == end() ? d_capacity
+                                            : &*last - d_entries_p;
+
+    if (first != last) {
+        for (bsl::size_t i = &*first - d_entries_p; i < index; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                markErased(i);
+
+                bslma::DestructionUtil::destroy(d_entries_p + i);
+                --d_size;
+            }
+        }
+    }
+
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p + index,
+                                                     d_controls_p + index,
+                                                     d_capacity - index - 1));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    const bsl::size_t index = findKey(key, mix(d_hasher(key)));
+
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+
+    return iterator(FlatHashTable_IteratorImp<ENTRY>(d_entries_p + index,
+                                                     d_controls_p + index,
+                                                     d_capacity - index - 1));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&                key       = ENTRY_UTIL::key(entry);
+    const bsls::Types::Uint64 mixedHash = mix(d_hasher(key));
+
+    bsl::size_t index = findKey(key, mixedHash);
+
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(
+                 iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                   d_entries_p + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1)),
+                 false);                                              // RETURN
+    }
+
+    index = prepareInsert(mixedHash);
+
+    BSLS_TRY {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           entry);
+    }
+    BSLS_CATCH(...) {
+        unprepareInsert(index);
+        BSLS_RETHROW;
+    }
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(
+                 iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                   d_entries_p + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1)),
+                 true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&                    lvalue    = entry;
+    const KEY&                key       = ENTRY_UTIL::key(lvalue);
+    const bsls::Types::Uint64 mixedHash = mix(d_hasher(key));
+
+    bsl::size_t index = findKey(key, mixedHash);
+
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(
+                 iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                   d_entries_p + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1)),
+                 false);                                              // RETURN
+    }
+
+    index = prepareInsert(mixedHash);
+
+    BSLS_TRY {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           MoveUtil::move(lvalue));
+    }
+    BSLS_CATCH(...) {
+        unprepareInsert(index);
+        BSLS_RETHROW;
+    }
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(
+                 iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                   d_entries_p + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1)),
+                 true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t newCapacity = capacityForSize(d_size);
+
+    if (minimumCapacity > newCapacity) {
+        if (0 == newCapacity) {
+            newCapacity = k_MIN_CAPACITY;
+        }
+        while (newCapacity < minimumCapacity) {
+            newCapacity *= 2;
+        }
+    }
+
+    rehashRaw(newCapacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    const bsl::size_t newCapacity = capacityForSize(numEntries);
+
+    if (newCapacity > d_capacity) {
+        rehashRaw(newCapacity);
+    }
+    else if (numEntries + d_numErased > d_capacity - d_capacity / 8) {
+        // Purge the erased slots, so that inserting up to 'numEntries'
+        // entries does not rehash.
+
+        rehashRaw(d_capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    destroyEntries();
+    releaseArrays();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+        typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+        bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::try_emplace(
+                                                                const KEY& key)
+{
+    const bsls::Types::Uint64 mixedHash = mix(d_hasher(key));
+
+    bsl::size_t index = findKey(key, mixedHash);
+
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(
+                 iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                   d_entries_p + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1)),
+                 false);                                              // RETURN
+    }
+
+    index = prepareInsert(mixedHash);
+
+    BSLS_TRY {
+        ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+    }
+    BSLS_CATCH(...) {
+        unprepareInsert(index);
+        BSLS_RETHROW;
+    }
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(
+                 iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                   d_entries_p + index,
+                                                   d_controls_p + index,
+                                                   d_capacity - index - 1)),
+                 true);
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+            return iterator(FlatHashTable_IteratorImp<ENTRY>(
+                                                       d_entries_p + i,
+                                                       d_controls_p + i,
+                                                       d_capacity - i - 1));
+                                                                      // RETURN
+        }
+    }
+
+    return end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator();
+}
+
+                          // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,  &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_groupShift, &other.d_groupShift);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return d_capacity != findKey(key, mix(d_hasher(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_cast<FlatHashTable *>(this)->find(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                                             / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor()
+                                                                          const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator();
+}
+
+                          // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                    const_iterator Iterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (Iterator it = lhs.begin(); it != lhs.end(); ++it) {
+        const Iterator match = rhs.find(ENTRY_UTIL::key(*it));
+
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureA(b,
+                                                               a.allocator());
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureB(a,
+                                                               b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
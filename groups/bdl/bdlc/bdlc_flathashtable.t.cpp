@@ -0,0 +1,1199 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container whose behavior is
+// a subset of that of 'bsl::unordered_set' (for an 'ENTRY' that is its own
+// key).  We therefore verify each manipulator against a 'bsl::unordered_set'
+// oracle, for long sequences of pseudo-random operations, using both a
+// well-distributed hash functor and a degenerate one that maps every key to
+// the same probe sequence (so that probing across groups, and erasure in
+// full groups, are exercised).  The memory-related concerns are verified
+// with 'bslma::TestAllocator' objects and an entry type ('bsl::string') that
+// allocates.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 5] FlatHashTable(const FlatHashTable&, Allocator *);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+// [ 2] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 5] FlatHashTable& operator=(const FlatHashTable&);
+// [ 5] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 4] void clear();
+// [ 3] size_t erase(const KEY&);
+// [ 3] iterator erase(const_iterator);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 3] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const ENTRY&);
+// [ 2] pair<iterator, bool> insert(MovableRef<ENTRY>);
+// [ 4] void rehash(size_t);
+// [ 4] void reserve(size_t);
+// [ 4] void reset();
+// [ 2] pair<iterator, bool> try_emplace(const KEY&);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 5] void swap(FlatHashTable&);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 5] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatHashTable&, FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: PSEUDO-RANDOM OPERATIONS AGREE WITH 'bsl::unordered_set'
+// [ 6] CONCERN: INSERTION PROVIDES THE STRONG EXCEPTION GUARANTEE
+// [ 7] CONCERN: ERASED SLOTS DO NOT DEGRADE PROBING UNDER CHURN
+// [ *] CONCERN: PRECONDITION VIOLATIONS ARE DETECTED WHEN ENABLED.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct IntEntryUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' operations for an 'int' entry
+    // that is its own key.
+
+    static void constructFromKey(int              *entry,
+                                 bslma::Allocator *,
+                                 const int&        key)
+        // Create at the specified 'entry' a copy of the specified 'key'.
+    {
+        *entry = key;
+    }
+
+    static const int& key(const int& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+struct StringEntryUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' operations for a 'bsl::string'
+    // entry that is its own key.
+
+    static void constructFromKey(bsl::string        *entry,
+                                 bslma::Allocator   *allocator,
+                                 const bsl::string&  key)
+        // Create at the specified 'entry' a copy of the specified 'key' using
+        // the specified 'allocator' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+
+    static const bsl::string& key(const bsl::string& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+struct DegenerateHash {
+    // This functor returns the same hash value for every key, so that all
+    // keys share a single probe sequence.
+
+    bsl::size_t operator()(int) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            bsl::hash<int>,
+                            bsl::equal_to<int> >            Obj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            DegenerateHash,
+                            bsl::equal_to<int> >            DegenerateObj;
+
+struct CountingEqual {
+    // This functor compares two 'int' keys for equality, and counts the
+    // comparisons, so that the lengths of probe sequences can be measured.
+
+    static bsl::size_t s_numCalls;  // number of comparisons
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs == rhs' for the specified 'lhs' and 'rhs', and increment
+        // 's_numCalls'.
+    {
+        ++s_numCalls;
+        return lhs == rhs;
+    }
+};
+
+bsl::size_t CountingEqual::s_numCalls = 0;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            bsl::hash<int>,
+                            CountingEqual>                  CountingObj;
+
+static int scrambledKey(int index)
+    // Return a key that is a one-to-one function of the specified 'index',
+    // and is not correlated with it, so that consecutive indices do not yield
+    // evenly distributed hash values.
+{
+    bsl::uint32_t value = static_cast<bsl::uint32_t>(index);
+
+    value ^= value >> 16;
+    value *= 0x85ebca6b;
+    value ^= value >> 13;
+    value *= 0xc2b2ae35;
+    value ^= value >> 16;
+
+    return static_cast<int>(value);
+}
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            StringEntryUtil,
+                            bsl::hash<bsl::string>,
+                            bsl::equal_to<bsl::string> >    StringObj;
+
+typedef bslmf::MovableRefUtil                               MoveUtil;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bsl::string makeString(int value)
+    // Return a string, long enough to allocate memory, that is unique for the
+    // specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+
+    do {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+
+    return result;
+}
+
+template <class TABLE>
+static
+bool isSame(const TABLE& table, const bsl::unordered_set<int>& oracle)
+    // Return 'true' if the specified 'table' contains exactly the elements of
+    // the specified 'oracle', and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t n = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++n;
+    }
+
+    return n == oracle.size();
+}
+
+template <class TABLE, class HASH>
+static
+void testRandomOperations(int numKeys, int numOperations, unsigned seed)
+    // Apply the specified 'numOperations' pseudo-random insertions and
+    // erasures of keys in the range '[0 .. numKeys)', derived from the
+    // specified 'seed', to an object of the (template parameter) type 'TABLE'
+    // using a hash functor of the (template parameter) type 'HASH', and to a
+    // 'bsl::unordered_set', and verify that they agree after each operation.
+{
+    bslma::TestAllocator     oa("object", false);
+    TABLE                    mX(0, HASH(), bsl::equal_to<int>(), &oa);
+    const TABLE&             X = mX;
+    bsl::unordered_set<int>  oracle;
+
+    unsigned state = seed;
+
+    for (int i = 0; i < numOperations; ++i) {
+        state = state * 1103515245u + 12345u;
+
+        const int key = static_cast<int>((state >> 8) % numKeys);
+        const int op  = static_cast<int>((state >> 4) % 8);
+
+        switch (op) {
+          case 0:
+          case 1:
+          case 2: {
+            const bool inserted = mX.insert(key).second;
+            ASSERTV(i, key, inserted == oracle.insert(key).second);
+          } break;
+          case 3: {
+            typename TABLE::iterator it = mX.try_emplace(key).first;
+            ASSERTV(i, key, key == *it);
+            oracle.insert(key);
+          } break;
+          case 4:
+          case 5: {
+            ASSERTV(i, key, oracle.erase(key) == mX.erase(key));
+          } break;
+          case 6: {
+            typename TABLE::iterator it = mX.find(key);
+            if (it != mX.end()) {
+                mX.erase(it);
+                oracle.erase(key);
+            }
+            else {
+                ASSERTV(i, key, 0 == oracle.count(key));
+            }
+          } break;
+          default: {
+            ASSERTV(i, key, oracle.count(key) == X.count(key));
+            ASSERTV(i, key, (0 != oracle.count(key)) == X.contains(key));
+          } break;
+        }
+
+        ASSERTV(i, oracle.size() == X.size());
+        ASSERTV(i, X.size() <= X.capacity() - X.capacity() / 8);
+
+        if (0 == i % 97) {
+            ASSERTV(i, isSame(X, oracle));
+        }
+    }
+
+    ASSERT(isSame(X, oracle));
+
+    for (int key = 0; key < numKeys; ++key) {
+        ASSERTV(key, (0 != oracle.count(key)) == (X.find(key) != X.end()));
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // ERASED SLOTS UNDER CHURN
+        //
+        // Concerns:
+        //: 1 Repeatedly erasing and inserting entries at a constant size does
+        //:   not grow the table without bound: the capacity becomes stable.
+        //:
+        //: 2 Erased slots left by the churn do not lengthen probe sequences:
+        //:   looking up absent keys compares few keys.
+        //:
+        //: 3 The entries are unaffected by the rehashing that purges erased
+        //:   slots.
+        //:
+        //: 4 After 'reserve(n)', inserting entries up to a size of 'n' does
+        //:   not rehash, even if the table has erased slots.
+        //
+        // Plan:
+        //: 1 For sizes of about 40%, 80%, and 87% of the initial capacity,
+        //:   fill a table with scrambled keys, then repeatedly erase its
+        //:   oldest key and insert a new key, verifying that the capacity does
+        //:   not change during the second half of the churn.  (C-1)
+        //:
+        //: 2 Using an equality functor that counts its calls, look up many
+        //:   absent keys, and verify that fewer comparisons than lookups are
+        //:   made.  (C-2)
+        //:
+        //: 3 Verify that exactly the expected keys are present.  (C-3)
+        //:
+        //: 4 Churn a table again, call 'reserve' for a few more entries,
+        //:   and verify that inserting them does not allocate.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: ERASED SLOTS DO NOT DEGRADE PROBING UNDER CHURN
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASED SLOTS UNDER CHURN" << endl
+                          << "========================" << endl;
+
+        const int SIZES[]   = { 400, 800, 890 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const int k_NUM_CHURNS = 200000;
+        const int k_NUM_MISSES = 10000;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            CountingObj mX(1024, bsl::hash<int>(), CountingEqual(), &oa);
+            const CountingObj& X = mX;
+
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(scrambledKey(i));
+            }
+
+            bsl::size_t capacity = 0;
+            for (int i = 0; i < k_NUM_CHURNS; ++i) {
+                ASSERTV(SIZE, i, 1 == mX.erase(scrambledKey(i)));
+                ASSERTV(SIZE, i, mX.insert(scrambledKey(SIZE + i)).second);
+
+                if (k_NUM_CHURNS / 2 == i) {
+                    capacity = X.capacity();
+                }
+                else if (k_NUM_CHURNS / 2 < i) {
+                    ASSERTV(SIZE, i, capacity == X.capacity());
+                }
+            }
+
+            if (veryVerbose) { T_ P_(SIZE) P(X.capacity()) }
+
+            ASSERTV(SIZE, static_cast<bsl::size_t>(SIZE) == X.size());
+            ASSERTV(SIZE, X.capacity(), 2048 >= X.capacity());
+
+            CountingEqual::s_numCalls = 0;
+            for (int i = -1; i >= -k_NUM_MISSES; --i) {
+                ASSERTV(SIZE, i, !X.contains(scrambledKey(i)));
+            }
+
+            if (veryVerbose) { T_ P(CountingEqual::s_numCalls) }
+
+            ASSERTV(SIZE, CountingEqual::s_numCalls,
+                    CountingEqual::s_numCalls
+                                 < static_cast<bsl::size_t>(k_NUM_MISSES));
+
+            for (int i = 0; i < k_NUM_CHURNS + SIZE; ++i) {
+                ASSERTV(SIZE, i,
+                        (k_NUM_CHURNS <= i) == X.contains(scrambledKey(i)));
+            }
+
+            // Churn a little more, so that there are erased slots, then
+            // reserve room for more entries.
+
+            for (int i = k_NUM_CHURNS; i < k_NUM_CHURNS + 1000; ++i) {
+                mX.erase(scrambledKey(i));
+                mX.insert(scrambledKey(SIZE + i));
+            }
+
+            const int MORE = SIZE / 4;
+            mX.reserve(SIZE + MORE);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            for (int i = 0; i < MORE; ++i) {
+                ASSERTV(SIZE, i, mX.insert(scrambledKey(-1 - i)).second);
+            }
+
+            ASSERTV(SIZE, NUM_ALLOCATIONS == oa.numAllocations());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an insertion that grows the table throws, the table is
+        //:   unchanged and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Using the standard 'bslma' exception-testing macros, insert
+        //:   'bsl::string' entries (which allocate) into tables of various
+        //:   sizes, and verify that the table is unchanged when an allocation
+        //:   fails.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: INSERTION PROVIDES THE STRONG EXCEPTION GUARANTEE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        for (int n = 0; n < 40; ++n) {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            StringObj mX(0,
+                         bsl::hash<bsl::string>(),
+                         bsl::equal_to<bsl::string>(),
+                         &oa);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            const StringObj    W(X, &oa);
+            const bsl::string  value(makeString(n), &oa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                if (veryVerbose) { T_ P_(n) P(X.size()) }
+
+                ASSERTV(n, W == X);
+
+                ASSERTV(n, mX.insert(value).second);
+
+                ASSERTV(n, W != X);
+
+                mX.erase(value);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, W == X);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   specified allocator.
+        //:
+        //: 2 Move construction takes the memory of the original (which is left
+        //:   empty) without allocating; move construction with a different
+        //:   allocator copies the entries.
+        //:
+        //: 3 Copy and move assignment give the target the value of the source.
+        //:
+        //: 4 'swap' exchanges values without allocating when the allocators
+        //:   are the same, and the free 'swap' also works when they differ.
+        //:
+        //: 5 Equality depends only on the set of entries, not on their order,
+        //:   the capacity, or the allocator.
+        //
+        // Plan:
+        //: 1 Create tables of 'bsl::string' of various sizes, and apply each
+        //:   operation, verifying the values and the allocators used.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, Allocator *);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   void swap(FlatHashTable&);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        //   void swap(FlatHashTable&, FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        const bsl::hash<bsl::string>     HF;
+        const bsl::equal_to<bsl::string> EQ;
+
+        for (int n = 0; n < 50; n += 7) {
+            bslma::TestAllocator oa("object", veryVerbose);
+            bslma::TestAllocator sa("supplied", veryVerbose);
+
+            StringObj mX(0, HF, EQ, &oa);  const StringObj& X = mX;
+            StringObj mY(0, HF, EQ, &oa);  const StringObj& Y = mY;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            // Insert in the reverse order, into a larger table.
+
+            mY.reserve(4 * n);
+            for (int i = n - 1; 0 <= i; --i) {
+                mY.insert(makeString(i));
+            }
+
+            ASSERTV(n, X == Y);
+            ASSERTV(n, !(X != Y));
+            ASSERTV(n, 0 == n || X.capacity() < Y.capacity());
+
+            // copy construction
+
+            {
+                const StringObj Z(X, &sa);
+
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &sa == Z.allocator());
+                ASSERTV(n, (0 == n) == (0 == sa.numBlocksInUse()));
+            }
+
+            // move construction, same allocator
+
+            {
+                StringObj       mW(X, &oa);
+                const StringObj& W = mW;
+
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                const StringObj Z(MoveUtil::move(mW));
+
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, W.empty());
+                ASSERTV(n, 0 == W.capacity());
+                ASSERTV(n, numAllocations == oa.numAllocations());
+            }
+
+            // move construction, different allocator
+
+            {
+                StringObj mW(X, &oa);
+
+                const StringObj Z(MoveUtil::move(mW), &sa);
+
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &sa == Z.allocator());
+            }
+            ASSERTV(n, 0 == sa.numBlocksInUse());
+
+            // copy assignment
+
+            {
+                StringObj mZ(0, HF, EQ, &sa);  const StringObj& Z = mZ;
+
+                mZ.insert(makeString(1000));
+
+                mZ = X;
+
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &sa == Z.allocator());
+
+                mZ = Z;                                     // self-assignment
+
+                ASSERTV(n, X == Z);
+            }
+
+            // move assignment, same and different allocators
+
+            {
+                StringObj mW(X, &oa);
+                StringObj mZ(0, HF, EQ, &oa);  const StringObj& Z = mZ;
+
+                mZ.insert(makeString(1000));
+
+                mZ = MoveUtil::move(mW);
+
+                ASSERTV(n, X == Z);
+
+                StringObj mV(X, &oa);
+                StringObj mU(0, HF, EQ, &sa);  const StringObj& U = mU;
+
+                mU = MoveUtil::move(mV);
+
+                ASSERTV(n, X == U);
+                ASSERTV(n, &sa == U.allocator());
+            }
+
+            // member and free swap
+
+            {
+                StringObj mW(0, HF, EQ, &oa);  const StringObj& W = mW;
+
+                mW.insert(makeString(1000));
+
+                const StringObj WW(W, &oa);
+
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                mW.swap(mX);
+
+                ASSERTV(n, X == WW);
+                ASSERTV(n, W == Y);
+                ASSERTV(n, numAllocations == oa.numAllocations());
+
+                swap(mW, mX);
+
+                ASSERTV(n, X == Y);
+                ASSERTV(n, W == WW);
+
+                StringObj mZ(0, HF, EQ, &sa);  const StringObj& Z = mZ;
+
+                swap(mX, mZ);
+
+                ASSERTV(n, Z == Y);
+                ASSERTV(n, X.empty());
+                ASSERTV(n, &sa == Z.allocator());
+                ASSERTV(n, &oa == X.allocator());
+
+                swap(mX, mZ);
+
+                ASSERTV(n, X == Y);
+            }
+
+            // inequality
+
+            if (n) {
+                mY.erase(makeString(0));
+
+                ASSERTV(n, X != Y);
+
+                mY.insert(makeString(n));
+
+                ASSERTV(n, X.size() == Y.size());
+                ASSERTV(n, X != Y);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator oa("object", veryVerbose);
+            bslma::TestAllocator sa("supplied", veryVerbose);
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            Obj mY(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            Obj mZ(0, bsl::hash<int>(), bsl::equal_to<int>(), &sa);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 The capacity is 0 or a power of 2 that is at least 16.
+        //:
+        //: 2 'reserve(n)' makes room for 'n' entries without growing, and
+        //:   does not shrink the table.
+        //:
+        //: 3 'rehash' retains the entries, purges erased slots, and releases
+        //:   all memory when given 0 on an empty table.
+        //:
+        //: 4 'clear' retains the capacity and 'reset' releases all memory.
+        //
+        // Plan:
+        //: 1 For a range of sizes, exercise each manipulator and verify the
+        //:   capacity, the entries, and the memory in use.  (C-1..4)
+        //
+        // Testing:
+        //   void clear();
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANIPULATORS" << endl
+                          << "=====================" << endl;
+
+        for (int n = 0; n < 300; n = n * 2 + 1) {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            mX.reserve(n);
+
+            const bsl::size_t capacity = X.capacity();
+
+            ASSERTV(n, (0 == n) == (0 == capacity));
+            ASSERTV(n, 0 == (capacity & (capacity - 1)));
+            ASSERTV(n, 0 == capacity || 16 <= capacity);
+            ASSERTV(n, static_cast<bsl::size_t>(n) <= capacity - capacity / 8);
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(i);
+            }
+
+            ASSERTV(n, capacity == X.capacity());
+            ASSERTV(n, numAllocations == oa.numAllocations());
+
+            mX.reserve(0);
+
+            ASSERTV(n, capacity == X.capacity());
+
+            // Erase half of the entries, then purge them by rehashing.
+
+            for (int i = 0; i < n; i += 2) {
+                mX.erase(i);
+            }
+
+            mX.rehash(0);
+
+            ASSERTV(n, X.size() == static_cast<bsl::size_t>(n / 2));
+            for (int i = 0; i < n; ++i) {
+                ASSERTV(n, i, (1 == i % 2) == X.contains(i));
+            }
+
+            mX.rehash(4 * capacity);
+
+            ASSERTV(n, 4 * capacity <= X.capacity());
+            for (int i = 0; i < n; ++i) {
+                ASSERTV(n, i, (1 == i % 2) == X.contains(i));
+            }
+
+            const bsl::size_t bigCapacity = X.capacity();
+
+            mX.clear();
+
+            ASSERTV(n, X.empty());
+            ASSERTV(n, bigCapacity == X.capacity());
+            ASSERTV(n, X.begin() == X.end());
+
+            mX.insert(7);
+
+            ASSERTV(n, 1 == X.size());
+
+            mX.reset();
+
+            ASSERTV(n, X.empty());
+            ASSERTV(n, 0 == X.capacity());
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+
+            mX.insert(7);
+            mX.erase(7);
+            mX.rehash(0);
+
+            ASSERTV(n, 0 == X.capacity());
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nRepeated insert/erase does not grow." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            DegenerateObj mX(0, DegenerateHash(), bsl::equal_to<int>(), &oa);
+            const DegenerateObj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+
+            const bsl::size_t capacity = X.capacity();
+
+            for (int i = 10; i < 10000; ++i) {
+                mX.insert(i);
+                mX.erase(i - 10);
+
+                ASSERTV(i, 10 == X.size());
+            }
+
+            ASSERTV(X.capacity(), capacity * 4 >= X.capacity());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PSEUDO-RANDOM OPERATIONS
+        //
+        // Concerns:
+        //: 1 Every sequence of insertions and erasures leaves the table with
+        //:   the same set of keys as a 'bsl::unordered_set' subjected to the
+        //:   same sequence.
+        //:
+        //: 2 Probe sequences that cross many groups, and erasure from groups
+        //:   that have been full, are handled correctly.
+        //:
+        //: 3 Erasing through iterators, including ranges, visits and removes
+        //:   exactly the intended entries.
+        //
+        // Plan:
+        //: 1 Apply long pseudo-random sequences of operations to tables with a
+        //:   good and a degenerate hash functor, verifying them against the
+        //:   oracle.  (C-1..2)
+        //:
+        //: 2 Erase every other entry while iterating, and erase ranges, and
+        //:   verify the remaining entries.  (C-3)
+        //
+        // Testing:
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator find(const KEY&);
+        //   CONCERN: PSEUDO-RANDOM OPERATIONS AGREE WITH 'bsl::unordered_set'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PSEUDO-RANDOM OPERATIONS" << endl
+                          << "========================" << endl;
+
+        if (verbose) cout << "\nWell-distributed hash." << endl;
+        {
+            const int NUM_KEYS[] = { 5, 17, 100, 1000, 5000 };
+            const int NUM_DATA   = sizeof NUM_KEYS / sizeof *NUM_KEYS;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                testRandomOperations<Obj, bsl::hash<int> >(NUM_KEYS[ti],
+                                                           20000,
+                                                           1 + ti);
+            }
+        }
+
+        if (verbose) cout << "\nDegenerate hash." << endl;
+        {
+            const int NUM_KEYS[] = { 5, 17, 100, 300 };
+            const int NUM_DATA   = sizeof NUM_KEYS / sizeof *NUM_KEYS;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                testRandomOperations<DegenerateObj, DegenerateHash>(
+                                                                  NUM_KEYS[ti],
+                                                                  5000,
+                                                                  7 + ti);
+            }
+        }
+
+        if (verbose) cout << "\nErasing while iterating." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+            }
+
+            bsl::size_t numVisited = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++numVisited) {
+                const Obj::iterator position(it);
+                const int           key = *position;
+
+                ++it;
+
+                if (0 == key % 2) {
+                    ASSERTV(key, it == mX.erase(position));
+                }
+            }
+
+            ASSERTV(numVisited, 1000 == numVisited);
+            ASSERTV(X.size(), 500 == X.size());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, (1 == i % 2) == X.contains(i));
+            }
+
+            Obj::const_iterator first = X.begin();
+            Obj::const_iterator last  = first;
+            for (int i = 0; i < 100; ++i) {
+                ++last;
+            }
+
+            bsl::vector<int> erased(first, last);
+
+            ASSERT(last == mX.erase(first, last));
+            ASSERTV(X.size(), 400 == X.size());
+            for (bsl::size_t i = 0; i < erased.size(); ++i) {
+                ASSERTV(erased[i], !X.contains(erased[i]));
+            }
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 An empty table allocates no memory and has a capacity of 0.
+        //:
+        //: 2 Each insertion adds an entry exactly when its key is absent, and
+        //:   returns an iterator to the entry having the key.
+        //:
+        //: 3 The table grows as needed, retaining all of its entries, and
+        //:   never exceeds the maximum load factor.
+        //:
+        //: 4 Iteration visits each entry exactly once.
+        //:
+        //: 5 Memory comes from the supplied allocator, and entries are given
+        //:   the allocator of the table.
+        //:
+        //: 6 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Insert 'bsl::string' entries using each insertion method,
+        //:   verifying the return values and the accessors after each
+        //:   insertion.  (C-1..5)
+        //:
+        //: 2 Verify that the test allocator has no blocks in use after the
+        //:   table is destroyed.  (C-6)
+        //
+        // Testing:
+        //   FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   ~FlatHashTable();
+        //   pair<iterator, bool> insert(const ENTRY&);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY>);
+        //   pair<iterator, bool> try_emplace(const KEY&);
+        //   iterator begin();
+        //   iterator end();
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                  << "========================================" << endl;
+
+        const int N = 500;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        {
+            StringObj mX(0,
+                         bsl::hash<bsl::string>(),
+                         bsl::equal_to<bsl::string>(),
+                         &oa);
+            const StringObj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(&oa == X.allocator());
+            ASSERT(0 == oa.numAllocations());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(makeString(0)));
+            ASSERT(!X.contains(makeString(0)));
+            ASSERT(X.key_eq()(makeString(1), makeString(1)));
+            ASSERT(X.hash_function()(makeString(1)) ==
+                                      bsl::hash<bsl::string>()(makeString(1)));
+
+            for (int i = 0; i < N; ++i) {
+                const bsl::string key = makeString(i);
+
+                bsl::pair<StringObj::iterator, bool> result;
+
+                switch (i % 3) {
+                  case 0: {
+                    result = mX.insert(key);
+                  } break;
+                  case 1: {
+                    bsl::string temp(key, &oa);
+
+                    result = mX.insert(MoveUtil::move(temp));
+                  } break;
+                  default: {
+                    result = mX.try_emplace(key);
+                  } break;
+                }
+
+                ASSERTV(i, result.second);
+                ASSERTV(i, key == *result.first);
+                ASSERTV(i, &oa == result.first->get_allocator().mechanism());
+
+                ASSERTV(i, key == *mX.insert(key).first);
+                ASSERTV(i, !mX.insert(key).second);
+                ASSERTV(i, !mX.try_emplace(key).second);
+
+                ASSERTV(i, X.size() == static_cast<bsl::size_t>(i + 1));
+                ASSERTV(i, !X.empty());
+                ASSERTV(i, X.load_factor() <= X.max_load_factor());
+                ASSERTV(i, X.load_factor() ==
+                           static_cast<float>(X.size()) /
+                                           static_cast<float>(X.capacity()));
+
+                if (0 == i % 50) {
+                    for (int j = 0; j <= i + 1; ++j) {
+                        const bsl::string k = makeString(j);
+
+                        ASSERTV(i, j, (j <= i) == X.contains(k));
+                        ASSERTV(i, j, (j <= i) == X.count(k));
+                        ASSERTV(i, j, (j <= i) == (X.find(k) != X.end()));
+                    }
+                }
+            }
+
+            ASSERT(0 < oa.numBlocksInUse());
+
+            bsl::size_t numVisited = 0;
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                 ++it) {
+                ASSERT(X.contains(*it));
+                ++numVisited;
+            }
+            ASSERT(static_cast<bsl::size_t>(N) == numVisited);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+        const Obj& X = mX;
+
+        ASSERT(0 == X.size());
+        ASSERT(0 == X.capacity());
+
+        ASSERT( mX.insert(1).second);
+        ASSERT( mX.insert(2).second);
+        ASSERT(!mX.insert(1).second);
+
+        ASSERT(2  == X.size());
+        ASSERT(16 == X.capacity());
+        ASSERT(X.contains(1));
+        ASSERT(X.contains(2));
+        ASSERT(!X.contains(3));
+
+        for (int i = 3; i <= 100; ++i) {
+            ASSERTV(i, mX.insert(i).second);
+        }
+
+        ASSERT(100 == X.size());
+        ASSERT(128 == X.capacity());
+
+        ASSERT(1 == mX.erase(50));
+        ASSERT(0 == mX.erase(50));
+        ASSERT(!X.contains(50));
+        ASSERT(99 == X.size());
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mY.insert(50);
+
+        ASSERT(X != Y);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
@@ -0,0 +1,254 @@
+// bdlc_flathashtable_groupcontrol.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide inquiries to a flat hash table group of control values.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//
+//@SEE_ALSO: bdlc_flathashtable
+//
+//@DESCRIPTION: This component implements the class,
+// 'bdlc::FlatHashTable_GroupControl', which provides query methods to a group
+// of flat hash table control values.  Note that the possible inquiries are
+// highly customized for the needs of 'bdlc_flathashtable'.
+//
+// A flat hash table stores its elements in a single contiguous array of
+// slots, and maintains a parallel array of one-byte control values, one per
+// slot.  The control values are organized in groups of 'k_SIZE' (16)
+// consecutive bytes.  The control value for a slot is 'k_EMPTY' if the slot
+// has never held an element (since the table was last cleared or rehashed),
+// 'k_ERASED' if the slot held an element that has since been erased, and a
+// value in the range '[0 .. 127]' (the low-order seven bits of the hash value
+// of the element's key) if the slot is in use.  A 'FlatHashTable_GroupControl'
+// object answers, for an entire group at once, which slots are in use, which
+// are available, and which are in use with a given seven-bit hash value.  Each
+// answer is a bit mask in which bit 'i' corresponds to the slot 'i' of the
+// group.
+//
+// On platforms supporting SSE2, each inquiry is implemented with a small,
+// constant number of vector instructions.  On other platforms, a portable
+// implementation processing one control value at a time is used.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashtable' and is
+// *not* intended for direct client use.  It is subject to change without
+// notice.  As such, a usage example is not provided.
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2) &&                                        \
+   (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                      // ================================
+                      // class FlatHashTable_GroupControl
+                      // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides methods for making inquiries into the state of a
+    // group of control values for a flat hash table.
+
+    // DATA
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
+    __m128i             d_value;     // control values of the group
+#else
+    bsls::Types::Uint64 d_value[2];  // control values of the group
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // PUBLIC CONSTANTS
+    static const bsl::uint8_t k_EMPTY  = 0x80;
+    static const bsl::uint8_t k_ERASED = 0xC0;
+    static const bsl::size_t  k_SIZE   = 16;
+
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        // Create a group control object that refers to the 'k_SIZE' control
+        // values starting at the specified 'data'.  The behavior is undefined
+        // unless 'data' refers to at least 'k_SIZE' control values.
+
+    //! ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    bsl::uint32_t available() const;
+        // Return a bit mask of the slots of this group that are available
+        // (i.e., whose control value is 'k_EMPTY' or 'k_ERASED').  Bit 'i' of
+        // the result is set if and only if slot 'i' is available.
+
+    bsl::uint32_t inUse() const;
+        // Return a bit mask of the slots of this group that are in use (i.e.,
+        // whose control value is neither 'k_EMPTY' nor 'k_ERASED').  Bit 'i'
+        // of the result is set if and only if slot 'i' is in use.
+
+    bsl::uint32_t match(bsl::uint8_t value) const;
+        // Return a bit mask of the slots of this group whose control value
+        // equals the specified 'value'.  Bit 'i' of the result is set if and
+        // only if slot 'i' has the control value 'value'.  The behavior is
+        // undefined unless '0x80 > value'.
+
+    bool neverFull() const;
+        // Return 'true' if this group has a slot whose control value is
+        // 'k_EMPTY', and 'false' otherwise.  Note that a probe sequence for a
+        // key that reaches a group that has never been full can stop at that
+        // group.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class FlatHashTable_GroupControl
+                      // --------------------------------
+
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                      const bsl::uint8_t *data)
+: d_value(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)))
+{
+    BSLS_ASSERT_SAFE(data);
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::available() const
+{
+    // The available control values are exactly those with the high-order bit
+    // set.
+
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(d_value));
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xFFFFu;
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(
+                     _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(value)),
+                                    d_value)));
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    return 0 != _mm_movemask_epi8(
+                 _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(k_EMPTY)),
+                                d_value));
+}
+
+#else
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                      const bsl::uint8_t *data)
+{
+    BSLS_ASSERT_SAFE(data);
+
+    bsl::memcpy(d_value, data, k_SIZE);
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::available() const
+{
+    const bsl::uint8_t *data = reinterpret_cast<const bsl::uint8_t *>(d_value);
+
+    bsl::uint32_t result = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        result |= static_cast<bsl::uint32_t>(data[i] >> 7) << i;
+    }
+    return result;
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xFFFFu;
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+    const bsl::uint8_t *data = reinterpret_cast<const bsl::uint8_t *>(d_value);
+
+    bsl::uint32_t result = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        result |= static_cast<bsl::uint32_t>(value == data[i]) << i;
+    }
+    return result;
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    const bsl::uint8_t *data = reinterpret_cast<const bsl::uint8_t *>(d_value);
+
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        if (k_EMPTY == data[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+#endif
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
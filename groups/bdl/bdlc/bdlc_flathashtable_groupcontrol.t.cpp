@@ -0,0 +1,420 @@
+// bdlc_flathashtable_groupcontrol.t.cpp                              -*-C++-*-
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a set of inquiries into a group of
+// control values.  Each inquiry is a pure function of the 'k_SIZE' control
+// values and (for 'match') its argument, so the inquiries are verified
+// against a simple per-byte oracle for a table of control groups and for a
+// large number of pseudo-random control groups.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable_GroupControl(const bsl::uint8_t *data);
+//
+// ACCESSORS
+// [ 2] bsl::uint32_t available() const;
+// [ 2] bsl::uint32_t inUse() const;
+// [ 2] bsl::uint32_t match(bsl::uint8_t value) const;
+// [ 2] bool neverFull() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: PSEUDO-RANDOM CONTROL GROUPS
+// [ 4] CONCERN: UNALIGNED CONTROL VALUES
+// [ *] CONCERN: PRECONDITION VIOLATIONS ARE DETECTED WHEN ENABLED.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl Obj;
+
+const bsl::uint8_t EM = Obj::k_EMPTY;
+const bsl::uint8_t ER = Obj::k_ERASED;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bsl::uint32_t expectedAvailable(const bsl::uint8_t *data)
+    // Return the expected result of 'available' for the group of control
+    // values at the specified 'data'.
+{
+    bsl::uint32_t result = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (EM == data[i] || ER == data[i]) {
+            result |= 1u << i;
+        }
+    }
+    return result;
+}
+
+static
+bsl::uint32_t expectedMatch(const bsl::uint8_t *data, bsl::uint8_t value)
+    // Return the expected result of 'match(value)' for the group of control
+    // values at the specified 'data' and the specified 'value'.
+{
+    bsl::uint32_t result = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (value == data[i]) {
+            result |= 1u << i;
+        }
+    }
+    return result;
+}
+
+static
+bool expectedNeverFull(const bsl::uint8_t *data)
+    // Return the expected result of 'neverFull' for the group of control
+    // values at the specified 'data'.
+{
+    for (int i = 0; i < 16; ++i) {
+        if (EM == data[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+static
+void verifyGroup(int line, const bsl::uint8_t *data)
+    // Verify every inquiry of a group control object created from the
+    // specified 'data' against the expected results, reporting failures with
+    // the specified 'line'.
+{
+    const Obj X(data);
+
+    const bsl::uint32_t EXP_AVAILABLE = expectedAvailable(data);
+
+    ASSERTV(line, X.available(), EXP_AVAILABLE == X.available());
+    ASSERTV(line, X.inUse(), (~EXP_AVAILABLE & 0xFFFFu) == X.inUse());
+    ASSERTV(line, expectedNeverFull(data) == X.neverFull());
+
+    for (int v = 0; v < 0x80; ++v) {
+        const bsl::uint8_t VALUE = static_cast<bsl::uint8_t>(v);
+
+        ASSERTV(line, v, expectedMatch(data, VALUE) == X.match(VALUE));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: UNALIGNED CONTROL VALUES
+        //
+        // Concerns:
+        //: 1 A group control object may be created from control values at
+        //:   any address.
+        //
+        // Plan:
+        //: 1 Create group control objects from each offset within a buffer
+        //:   and verify the inquiries against the oracle.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: UNALIGNED CONTROL VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: UNALIGNED CONTROL VALUES" << endl
+                          << "=================================" << endl;
+
+        bsl::uint8_t buffer[64];
+        for (int i = 0; i < 64; ++i) {
+            buffer[i] = 0 == i % 5 ? EM
+                      : 0 == i % 7 ? ER
+                      : static_cast<bsl::uint8_t>((i * 37) & 0x7F);
+        }
+
+        for (int offset = 0; offset < 48; ++offset) {
+            if (veryVerbose) { T_ P(offset) }
+
+            verifyGroup(offset, buffer + offset);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: PSEUDO-RANDOM CONTROL GROUPS
+        //
+        // Concerns:
+        //: 1 The inquiries are correct for arbitrary mixtures of empty,
+        //:   erased, and in-use control values.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random control groups, each control value being
+        //:   'k_EMPTY', 'k_ERASED', or an in-use value drawn from a small
+        //:   range (so that 'match' finds repeated values), and verify the
+        //:   inquiries against the oracle.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: PSEUDO-RANDOM CONTROL GROUPS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PSEUDO-RANDOM CONTROL GROUPS" << endl
+                          << "=====================================" << endl;
+
+        bsl::uint32_t seed = 12345;
+
+        for (int ti = 0; ti < 2000; ++ti) {
+            bsl::uint8_t data[16];
+
+            for (int i = 0; i < 16; ++i) {
+                seed = seed * 1103515245u + 12345u;
+
+                const bsl::uint32_t r = (seed >> 16) % 10;
+
+                data[i] = 0 == r ? EM
+                        : 1 == r ? ER
+                        : static_cast<bsl::uint8_t>((seed >> 8) & 0x7);
+            }
+            if (ti % 3) {
+                data[(seed >> 4) & 15] = 0x7F;
+            }
+
+            verifyGroup(ti, data);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor captures the 'k_SIZE' control values at the
+        //:   supplied address.
+        //:
+        //: 2 'available' and 'inUse' return complementary masks of the empty
+        //:   or erased slots and of the remaining slots, respectively.
+        //:
+        //: 3 'match' returns the mask of slots having exactly the supplied
+        //:   value, and never reports an empty or erased slot.
+        //:
+        //: 4 'neverFull' is 'true' if and only if a slot is empty; erased
+        //:   slots do not count.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of control
+        //:   groups, and verify each inquiry against the oracle.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        //   bsl::uint32_t available() const;
+        //   bsl::uint32_t inUse() const;
+        //   bsl::uint32_t match(bsl::uint8_t value) const;
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTOR AND ACCESSORS" << endl
+                          << "=========================" << endl;
+
+        static const struct {
+            int          d_line;       // source line number
+            bsl::uint8_t d_data[16];   // control values
+        } DATA[] = {
+            //LINE  CONTROL VALUES
+            //----  ------------------------------------------------------
+            { L_,   { EM, EM, EM, EM, EM, EM, EM, EM,
+                      EM, EM, EM, EM, EM, EM, EM, EM } },
+            { L_,   { ER, ER, ER, ER, ER, ER, ER, ER,
+                      ER, ER, ER, ER, ER, ER, ER, ER } },
+            { L_,   {  0,  0,  0,  0,  0,  0,  0,  0,
+                       0,  0,  0,  0,  0,  0,  0,  0 } },
+            { L_,   { 127, 127, 127, 127, 127, 127, 127, 127,
+                      127, 127, 127, 127, 127, 127, 127, 127 } },
+            { L_,   {  0,  1,  2,  3,  4,  5,  6,  7,
+                       8,  9, 10, 11, 12, 13, 14, 15 } },
+            { L_,   { EM,  1,  2,  3,  4,  5,  6,  7,
+                       8,  9, 10, 11, 12, 13, 14, 15 } },
+            { L_,   {  0,  1,  2,  3,  4,  5,  6,  7,
+                       8,  9, 10, 11, 12, 13, 14, EM } },
+            { L_,   { ER,  1,  2,  3,  4,  5,  6,  7,
+                       8,  9, 10, 11, 12, 13, 14, ER } },
+            { L_,   { EM, ER,  5, EM, ER,  5, EM, ER,
+                       5, EM, ER,  5, EM, ER,  5, 64 } },
+            { L_,   { 42, ER, 42, ER, 42, ER, 42, ER,
+                      42, ER, 42, ER, 42, ER, 42, ER } },
+            { L_,   { 0x40, 0x41, 0x7E, 0x7F, 0x3F, 0x01, 0x00, 0x20,
+                      0x40, 0x41, 0x7E, 0x7F, 0x3F, 0x01, 0x00, 0x20 } },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            if (veryVerbose) { T_ P(LINE) }
+
+            verifyGroup(LINE, DATA[ti].d_data);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::uint8_t data[16] = { 0 };
+
+            const Obj X(data);
+
+            ASSERT_SAFE_PASS(X.match(0x7F));
+            ASSERT_SAFE_FAIL(X.match(0x80));
+            ASSERT_SAFE_FAIL(X.match(EM));
+            ASSERT_SAFE_FAIL(X.match(ER));
+
+            ASSERT_SAFE_FAIL(Obj(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a group control object for a simple group and invoke each
+        //:   inquiry.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::uint8_t data[16] = { 3, EM, ER, 3,  7, EM, EM, EM,
+                                        EM, EM, EM, EM, EM, EM, EM, EM };
+
+        const Obj X(data);
+
+        ASSERT(0xFFE6u == X.available());
+        ASSERT(0x0019u == X.inUse());
+        ASSERT(0x0009u == X.match(3));
+        ASSERT(0x0010u == X.match(7));
+        ASSERT(0x0000u == X.match(4));
+        ASSERT(true    == X.neverFull());
+
+        const bsl::uint8_t full[16] = { 1, 2, 3, 4, 5, 6, 7, 8,
+                                        ER, ER, ER, ER, ER, ER, ER, ER };
+
+        const Obj Y(full);
+
+        ASSERT(0xFF00u == Y.available());
+        ASSERT(false   == Y.neverFull());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,62 @@
+// bdlcc_concurrentskiplist.cpp                                       -*-C++-*-
+
+#include <bdlcc_concurrentskiplist.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_concurrentskiplist_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                   // -------------------------------------
+                   // class ConcurrentSkipList_EpochManager
+                   // -------------------------------------
+
+// CREATORS
+ConcurrentSkipList_EpochManager::ConcurrentSkipList_EpochManager()
+: d_epoch(1)
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes[i].d_numReaders[0].storeRelaxed(0);
+        d_stripes[i].d_numReaders[1].storeRelaxed(0);
+    }
+}
+
+// MANIPULATORS
+bool ConcurrentSkipList_EpochManager::tryAdvance()
+{
+    const bsls::Types::Uint64 epoch     = d_epoch.load();
+    const int                 oldParity = static_cast<int>((epoch + 1) & 1);
+
+    // Readers of the epoch preceding 'epoch' share the parity of the next
+    // epoch; no reader of the next epoch can have registered yet.
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        if (0 != d_stripes[i].d_numReaders[oldParity].load()) {
+            return false;                                             // RETURN
+        }
+    }
+
+    d_epoch.store(epoch + 1);
+
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
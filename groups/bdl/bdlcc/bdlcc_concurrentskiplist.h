@@ -0,0 +1,1230 @@
+// bdlcc_concurrentskiplist.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLCC_CONCURRENTSKIPLIST
+#define INCLUDED_BDLCC_CONCURRENTSKIPLIST
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a skip list whose readers never block.
+//
+//@CLASSES:
+//  bdlcc::ConcurrentSkipList: thread-safe ordered map with lock-free readers
+//
+//@SEE_ALSO: bdlcc_skiplist
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlcc::ConcurrentSkipList', implementing a thread-safe ordered map from
+// unique values of a 'KEY' type to values of a 'DATA' type, in which lookups
+// ('find', 'findLowerBound', 'exists', 'front') and iteration ('visit',
+// 'visitFrom') acquire no locks and never wait for other threads.  Writers
+// ('add', 'remove', 'popFront') lock only the handful of nodes adjacent to
+// the element being added or removed, so that writers operating on different
+// parts of the list proceed in parallel.
+//
+///Comparison with 'bdlcc::SkipList'
+///---------------------------------
+// 'bdlcc::SkipList' serializes every operation, including lookups, through a
+// single mutex, and provides a rich interface: duplicate keys, reverse ("R")
+// searches, reference-counted handles to elements, and in-place key updates.
+// 'bdlcc::ConcurrentSkipList' provides a deliberately smaller interface
+// (unique keys; elements are accessed by copying their key and data) in
+// exchange for lookups that scale with the number of reading threads.  It is
+// intended for read-mostly indexes, such as the price levels of an order book,
+// that are consulted by many threads and modified by few.
+//
+///Algorithm
+///---------
+// The list is the "lazy" skip list of Herlihy, Lev, Luchangco, and Shavit
+// ("A Simple Optimistic Skiplist Algorithm", 2007).  Each node carries a spin
+// lock and two flags: 'fullyLinked', set once the node is linked at all of
+// its levels, and 'marked', set when the node is logically removed.  A writer
+// locates the predecessors of a key without locking, locks them (in an order
+// that precludes deadlock), validates that they are still adjacent to the
+// expected successors, and then links or unlinks the node.  A reader simply
+// traverses the list, and treats a node as present if and only if it is fully
+// linked and not marked.
+//
+///Memory Reclamation
+///------------------
+// A node that has been unlinked may still be in use by a reader that reached
+// it before it was unlinked, so its memory cannot be released immediately.
+// Removed nodes are instead "retired", and released once every reader that
+// could have observed them has finished, using epoch-based reclamation: each
+// reader registers itself with the current epoch on entry (in one of a number
+// of cache-line-separated counters, selected by thread, so that readers do not
+// contend with each other) and deregisters on exit, and the epoch is advanced
+// (releasing the nodes retired two epochs earlier) only when no reader of the
+// previous epoch remains.  Reclamation is attempted by writers, in batches,
+// and never blocks.
+//
+// Note that a visitor supplied to 'visit' or 'visitFrom' is invoked while the
+// calling thread is registered as a reader; a visitor that takes a long time
+// therefore delays (but does not prevent) the release of removed nodes.
+//
+///Template Requirements
+///---------------------
+// Both 'KEY' and 'DATA' must be copy-constructible, and 'KEY' must provide an
+// 'operator<' that defines a strict weak ordering.  If 'KEY' or 'DATA'
+// declares the 'bslma::UsesBslmaAllocator' trait, the elements stored in the
+// list use the allocator of the list.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::ConcurrentSkipList' is fully thread-safe: all of its methods, other
+// than the destructor, may be invoked concurrently from any number of threads.
+// 'find', 'findLowerBound', 'exists', 'front', 'isEmpty', 'length', 'visit',
+// and 'visitFrom' are lock-free.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An Order Book Price Level Index
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain, for one side of an order book, an index from price (in
+// ticks) to the total quantity available at that price.  Many threads consult
+// the best price and the depth of the book, and a single thread applies
+// updates from the exchange.
+//
+// First, we define the index type:
+//..
+//  typedef bdlcc::ConcurrentSkipList<int, int> PriceLevels;
+//..
+// Then, we create an index and, acting as the update thread, add some price
+// levels:
+//..
+//  PriceLevels asks;
+//
+//  int rc = asks.add(10050, 300);
+//  assert(0 == rc);
+//  rc = asks.add(10025, 100);
+//  assert(0 == rc);
+//  rc = asks.add(10075, 500);
+//  assert(0 == rc);
+//..
+// Next, a reading thread finds the best (lowest) ask and its quantity, and
+// the quantity available at a given price:
+//..
+//  int bestPrice, bestQuantity;
+//  rc = asks.front(&bestPrice, &bestQuantity);
+//  assert(0     == rc);
+//  assert(10025 == bestPrice);
+//  assert(100   == bestQuantity);
+//
+//  int quantity;
+//  rc = asks.find(&quantity, 10050);
+//  assert(0   == rc);
+//  assert(300 == quantity);
+//..
+// Then, a reading thread computes the quantity available at or below a limit
+// price by visiting the levels in order:
+//..
+//  struct DepthAccumulator {
+//      int  d_limit;
+//      int *d_total_p;
+//
+//      bool operator()(const int& price, const int& quantity) const
+//      {
+//          if (price > d_limit) {
+//              return false;                                         // RETURN
+//          }
+//          *d_total_p += quantity;
+//          return true;
+//      }
+//  };
+//
+//  int              total = 0;
+//  DepthAccumulator depth = { 10060, &total };
+//  asks.visit(depth);
+//  assert(400 == total);
+//..
+// Finally, the update thread removes the best level once it is exhausted:
+//..
+//  rc = asks.remove(10025);
+//  assert(0 == rc);
+//
+//  rc = asks.front(&bestPrice, &bestQuantity);
+//  assert(0     == rc);
+//  assert(10050 == bestPrice);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructorproctor.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                   // =====================================
+                   // class ConcurrentSkipList_EpochManager
+                   // =====================================
+
+class ConcurrentSkipList_EpochManager {
+    // This class implements the epoch-based reclamation used by
+    // 'ConcurrentSkipList'.  Readers bracket each traversal with 'enter' and
+    // 'leave'; a writer calls 'tryAdvance' to advance the epoch, which
+    // succeeds only if no reader that entered during the epoch preceding the
+    // current one remains.  Memory retired during epoch 'e' may be released
+    // once the epoch has been advanced from 'e + 1'.
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_STRIPES = 16  // number of reader counter pairs; a power of 2
+    };
+
+    struct Stripe {
+        // This 'struct' holds, on its own cache line, the number of readers
+        // of each epoch parity registered in one stripe.
+
+        bsls::AtomicInt d_numReaders[2];
+        char            d_pad[bslmt::Platform::e_CACHE_LINE_SIZE
+                              - 2 * sizeof(bsls::AtomicInt)];
+    };
+
+    // DATA
+    bsls::AtomicUint64 d_epoch;                    // current epoch
+
+    char               d_epochPad[bslmt::Platform::e_CACHE_LINE_SIZE
+                                  - sizeof(bsls::AtomicUint64)];
+                                                   // padding
+
+    Stripe             d_stripes[k_NUM_STRIPES];   // reader counters
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentSkipList_EpochManager(const ConcurrentSkipList_EpochManager&);
+    ConcurrentSkipList_EpochManager& operator=(
+                                       const ConcurrentSkipList_EpochManager&);
+
+  public:
+    // CREATORS
+    ConcurrentSkipList_EpochManager();
+        // Create an epoch manager having an epoch of 1 and no readers.
+
+    //! ~ConcurrentSkipList_EpochManager() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int enter();
+        // Register the calling thread as a reader of the current epoch, and
+        // return a token that must be supplied to 'leave'.
+
+    void leave(int token);
+        // Deregister the reader identified by the specified 'token'.  The
+        // behavior is undefined unless 'token' was returned by a call to
+        // 'enter' on this object that has not yet been matched by a call to
+        // 'leave'.
+
+    bool tryAdvance();
+        // Advance the epoch of this object and return 'true' if no reader
+        // that entered during the epoch preceding the current one remains;
+        // otherwise return 'false' with no effect.  The behavior is undefined
+        // if this method is invoked concurrently from more than one thread.
+
+    // ACCESSORS
+    bsls::Types::Uint64 epoch() const;
+        // Return the current epoch of this object.
+};
+
+                     // ==================================
+                     // class ConcurrentSkipList_ReadGuard
+                     // ==================================
+
+class ConcurrentSkipList_ReadGuard {
+    // This class implements a scoped guard that registers the calling thread
+    // as a reader with an epoch manager on construction, and deregisters it
+    // on destruction.
+
+    // DATA
+    ConcurrentSkipList_EpochManager *d_manager_p;  // manager (held)
+    int                              d_token;      // reader token
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentSkipList_ReadGuard(const ConcurrentSkipList_ReadGuard&);
+    ConcurrentSkipList_ReadGuard& operator=(
+                                          const ConcurrentSkipList_ReadGuard&);
+
+  public:
+    // CREATORS
+    explicit ConcurrentSkipList_ReadGuard(
+                                    ConcurrentSkipList_EpochManager *manager);
+        // Create a guard that registers the calling thread as a reader with
+        // the specified 'manager'.
+
+    ~ConcurrentSkipList_ReadGuard();
+        // Deregister the calling thread as a reader with the manager supplied
+        // at construction, and destroy this object.
+};
+
+                       // =============================
+                       // struct ConcurrentSkipList_Node
+                       // =============================
+
+template <class KEY, class DATA>
+struct ConcurrentSkipList_Node {
+    // This 'struct' is a node of a 'ConcurrentSkipList'.  The node is
+    // allocated with room for 'd_level + 1' links; the key and data are not
+    // constructed in the head node of a list.
+
+    // TYPES
+    typedef bsls::AtomicPointer<ConcurrentSkipList_Node> Link;
+
+    // PUBLIC DATA
+    bsls::ObjectBuffer<KEY>   d_key;            // key (unset in head)
+
+    bsls::ObjectBuffer<DATA>  d_data;           // data (unset in head)
+
+    ConcurrentSkipList_Node  *d_retiredNext_p;  // next retired node
+
+    bsls::SpinLock            d_lock;           // writer lock
+
+    bsls::AtomicBool          d_marked;         // logically removed
+
+    bsls::AtomicBool          d_fullyLinked;    // linked at all levels
+
+    int                       d_level;          // index of top link
+
+    Link                      d_next[1];        // links, 'd_level + 1'
+                                                // of them
+
+    // ACCESSORS
+    const KEY& key() const;
+        // Return a reference providing non-modifiable access to the key of
+        // this node.  The behavior is undefined if this node is the head of
+        // a list.
+
+    const DATA& data() const;
+        // Return a reference providing non-modifiable access to the data of
+        // this node.  The behavior is undefined if this node is the head of
+        // a list.
+};
+
+                         // ========================
+                         // class ConcurrentSkipList
+                         // ========================
+
+template <class KEY, class DATA>
+class ConcurrentSkipList {
+    // This class template implements a thread-safe ordered map from unique
+    // 'KEY' values to 'DATA' values whose lookups and iteration are lock-free.
+    // See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef ConcurrentSkipList_Node<KEY, DATA> Node;
+    typedef typename Node::Link                Link;
+
+    enum {
+        k_MAX_LEVEL         = 24,  // maximum number of levels
+        k_RECLAIM_THRESHOLD = 64   // retired nodes before reclamation is
+                                   // attempted
+    };
+
+    // DATA
+    Node                            *d_head_p;           // head sentinel
+
+    bsls::AtomicInt                  d_maxLevel;         // highest level in
+                                                         // use
+
+    bsls::AtomicInt                  d_length;           // number of
+                                                         // elements
+
+    bsls::AtomicUint64               d_randomState;      // level generator
+
+    mutable
+    ConcurrentSkipList_EpochManager  d_epochManager;     // reader epochs
+
+    bslmt::Mutex                     d_retireMutex;      // guards retired
+                                                         // lists
+
+    Node                            *d_retired_p[2];     // nodes retired in
+                                                         // even and odd
+                                                         // epochs
+
+    int                              d_numRetired;       // size of
+                                                         // 'd_retired_p'
+                                                         // lists
+
+    bslma::Allocator                *d_allocator_p;      // memory allocator
+                                                         // (held)
+
+  private:
+    // NOT IMPLEMENTED
+    ConcurrentSkipList(const ConcurrentSkipList&);
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&);
+
+    // PRIVATE MANIPULATORS
+    Node *allocateNode(int level);
+        // Allocate and return a node having the specified 'level', whose
+        // links are null and whose key and data are not constructed.
+
+    void deallocateNode(Node *node);
+        // Release the memory of the specified 'node' without destroying its
+        // key or data.
+
+    void destroyNode(Node *node);
+        // Destroy the key and data of the specified 'node' and release its
+        // memory.
+
+    void freeRetired(Node *list);
+        // Destroy each node of the specified retired 'list'.
+
+    int randomLevel();
+        // Return a pseudo-random level in the range '[0 .. k_MAX_LEVEL - 1]'
+        // in which each level is one fourth as likely as the one below it.
+
+    void retire(Node *node);
+        // Retire the specified 'node', which has been unlinked from this list,
+        // so that it is destroyed once no reader can refer to it, and
+        // attempt to reclaim previously retired nodes if enough have
+        // accumulated.
+
+    bool unlink(Node *victim);
+        // Remove the specified 'victim' from this list and return 'true', or
+        // return 'false' if another thread removed 'victim' first.  The
+        // behavior is undefined unless the calling thread is registered as a
+        // reader and 'victim' is a node of this list.
+
+    // PRIVATE ACCESSORS
+    int findNode(Node **preds, Node **succs, const KEY& key, int level) const;
+        // Load into the specified 'preds' and 'succs' arrays, for each level
+        // in the range '[0 .. max(level, d_maxLevel)]' (where 'level' is the
+        // specified 'level'), the last node whose key is less than the
+        // specified 'key' and the node following it (or 0), and return the
+        // highest level at which a node having 'key' was found, or -1 if no
+        // such node was found.  The behavior is undefined unless the calling
+        // thread is registered as a reader.
+
+    Node *findFirstNotLess(const KEY& key) const;
+        // Return the first node of this list that is present and whose key
+        // is not less than the specified 'key', or 0 if there is no such
+        // node.  The behavior is undefined unless the calling thread is
+        // registered as a reader.
+
+    Node *firstPresent(Node *node) const;
+        // Return the specified 'node' if it is present (i.e., fully linked and
+        // not marked), and otherwise the first present node following it at
+        // level 0, or 0 if there is no such node.  The behavior is undefined
+        // unless the calling thread is registered as a reader.
+
+    static bool isPresent(const Node *node);
+        // Return 'true' if the specified 'node' is fully linked and not
+        // marked, and 'false' otherwise.
+
+  public:
+    // TYPES
+    typedef bsl::function<bool(const KEY&, const DATA&)> Visitor;
+        // 'Visitor' is the type of functor invoked by 'visit' and 'visitFrom'
+        // for each element visited; returning 'false' stops the visit.
+
+    enum {
+        e_NOT_FOUND = 1,
+        e_DUPLICATE = 2
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ConcurrentSkipList,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ConcurrentSkipList(bslma::Allocator *basicAllocator = 0);
+        // Create an empty list.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~ConcurrentSkipList();
+        // Destroy this list and each of its elements.  The behavior is
+        // undefined if any other method of this object is invoked
+        // concurrently.
+
+    // MANIPULATORS
+    int add(const KEY& key, const DATA& data);
+        // Add the specified 'key' / 'data' pair to this list.  Return 0 on
+        // success, and 'e_DUPLICATE' (with no effect) if 'key' is already in
+        // this list.
+
+    int popFront(KEY *key = 0, DATA *data = 0);
+        // Remove the first element of this list and load its key into the
+        // optionally specified 'key' and its data into the optionally
+        // specified 'data'.  Return 0 on success, and 'e_NOT_FOUND' (with no
+        // effect) if this list is empty.
+
+    int remove(const KEY& key, DATA *data = 0);
+        // Remove the element having the specified 'key' from this list and
+        // load its data into the optionally specified 'data'.  Return 0 on
+        // success, and 'e_NOT_FOUND' (with no effect) if 'key' is not in this
+        // list.
+
+    int removeAll();
+        // Remove all elements from this list, and return the number of
+        // elements removed.  Note that elements added concurrently may or may
+        // not be removed.
+
+    // ACCESSORS
+    bool exists(const KEY& key) const;
+        // Return 'true' if this list contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    int find(DATA *data, const KEY& key) const;
+        // Load into the specified 'data' the data of the element of this list
+        // having the specified 'key'.  Return 0 on success, and 'e_NOT_FOUND'
+        // (with no effect) if 'key' is not in this list.
+
+    int findLowerBound(KEY *key, DATA *data, const KEY& lowerBound) const;
+        // Load into the specified 'key' and 'data' the key and data of the
+        // first element of this list whose key is not less than the specified
+        // 'lowerBound'.  Return 0 on success, and 'e_NOT_FOUND' (with no
+        // effect) if there is no such element.
+
+    int front(KEY *key, DATA *data) const;
+        // Load into the specified 'key' and 'data' the key and data of the
+        // first element of this list.  Return 0 on success, and 'e_NOT_FOUND'
+        // (with no effect) if this list is empty.
+
+    bool isEmpty() const;
+        // Return 'true' if this list has no elements, and 'false' otherwise.
+
+    int length() const;
+        // Return the number of elements in this list.  Note that the value
+        // returned may be immediately out of date if other threads modify
+        // this list.
+
+    int visit(const Visitor& visitor) const;
+        // Invoke the specified 'visitor' on the key and data of each element
+        // of this list in ascending key order until 'visitor' returns 'false'
+        // or there are no more elements, and return the number of invocations
+        // of 'visitor'.  Elements added or removed concurrently may or may not
+        // be visited.
+
+    int visitFrom(const KEY& lowerBound, const Visitor& visitor) const;
+        // Invoke the specified 'visitor' on the key and data of each element
+        // of this list whose key is not less than the specified 'lowerBound',
+        // in ascending key order, until 'visitor' returns 'false' or there are
+        // no more elements, and return the number of invocations of
+        // 'visitor'.  Elements added or removed concurrently may or may not
+        // be visited.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this list to supply memory.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class ConcurrentSkipList_EpochManager
+                   // -------------------------------------
+
+// MANIPULATORS
+inline
+int ConcurrentSkipList_EpochManager::enter()
+{
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * 0x9E3779B97F4A7C15ULL;
+    const int                 stripe = static_cast<int>(hash >> 32)
+                                     & (k_NUM_STRIPES - 1);
+
+    while (true) {
+        const bsls::Types::Uint64 epoch  = d_epoch.load();
+        const int                 parity = static_cast<int>(epoch & 1);
+
+        d_stripes[stripe].d_numReaders[parity].add(1);
+
+        // A writer advancing the epoch reads the counters after storing the
+        // new epoch; if the epoch is unchanged after registering, any such
+        // writer will observe this reader.
+
+        if (epoch == d_epoch.load()) {
+            return stripe * 2 + parity;                               // RETURN
+        }
+
+        d_stripes[stripe].d_numReaders[parity].add(-1);
+    }
+}
+
+inline
+void ConcurrentSkipList_EpochManager::leave(int token)
+{
+    BSLS_ASSERT_SAFE(0 <= token && token < 2 * k_NUM_STRIPES);
+
+    d_stripes[token / 2].d_numReaders[token % 2].add(-1);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Uint64 ConcurrentSkipList_EpochManager::epoch() const
+{
+    return d_epoch.load();
+}
+
+                     // ----------------------------------
+                     // class ConcurrentSkipList_ReadGuard
+                     // ----------------------------------
+
+// CREATORS
+inline
+ConcurrentSkipList_ReadGuard::ConcurrentSkipList_ReadGuard(
+                                     ConcurrentSkipList_EpochManager *manager)
+: d_manager_p(manager)
+, d_token(manager->enter())
+{
+}
+
+inline
+ConcurrentSkipList_ReadGuard::~ConcurrentSkipList_ReadGuard()
+{
+    d_manager_p->leave(d_token);
+}
+
+                       // -----------------------------
+                       // struct ConcurrentSkipList_Node
+                       // -----------------------------
+
+// ACCESSORS
+template <class KEY, class DATA>
+inline
+const KEY& ConcurrentSkipList_Node<KEY, DATA>::key() const
+{
+    return d_key.object();
+}
+
+template <class KEY, class DATA>
+inline
+const DATA& ConcurrentSkipList_Node<KEY, DATA>::data() const
+{
+    return d_data.object();
+}
+
+                         // ------------------------
+                         // class ConcurrentSkipList
+                         // ------------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class DATA>
+typename ConcurrentSkipList<KEY, DATA>::Node *
+ConcurrentSkipList<KEY, DATA>::allocateNode(int level)
+{
+    BSLS_ASSERT_SAFE(0 <= level && level < k_MAX_LEVEL);
+
+    Node *node = static_cast<Node *>(
+              d_allocator_p->allocate(sizeof(Node) + level * sizeof(Link)));
+
+    // The members other than the key and data are trivially destructible, and
+    // are therefore constructed in place but never destroyed.
+
+    node->d_retiredNext_p = 0;
+    new (&node->d_lock) bsls::SpinLock(bsls::SpinLock::s_unlocked);
+    new (&node->d_marked) bsls::AtomicBool(false);
+    new (&node->d_fullyLinked) bsls::AtomicBool(false);
+    node->d_level = level;
+    for (int i = 0; i <= level; ++i) {
+        new (&node->d_next[i]) Link(0);
+    }
+
+    return node;
+}
+
+template <class KEY, class DATA>
+inline
+void ConcurrentSkipList<KEY, DATA>::deallocateNode(Node *node)
+{
+    d_allocator_p->deallocate(node);
+}
+
+template <class KEY, class DATA>
+void ConcurrentSkipList<KEY, DATA>::destroyNode(Node *node)
+{
+    bslma::DestructionUtil::destroy(node->d_data.address());
+    bslma::DestructionUtil::destroy(node->d_key.address());
+    deallocateNode(node);
+}
+
+template <class KEY, class DATA>
+void ConcurrentSkipList<KEY, DATA>::freeRetired(Node *list)
+{
+    while (list) {
+        Node *next = list->d_retiredNext_p;
+        destroyNode(list);
+        list = next;
+    }
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::randomLevel()
+{
+    // Concurrent writers may race on the state; the result is still a
+    // pseudo-random sequence, which is all that is required.
+
+    bsls::Types::Uint64 x = d_randomState.loadRelaxed();
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    d_randomState.storeRelaxed(x);
+
+    int level = 0;
+    while ((x & 3) == 0 && level < k_MAX_LEVEL - 1) {
+        ++level;
+        x >>= 2;
+    }
+    return level;
+}
+
+template <class KEY, class DATA>
+void ConcurrentSkipList<KEY, DATA>::retire(Node *node)
+{
+    Node *reclaimed = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retireMutex);
+
+        // 'node' was unlinked before the current epoch can next be advanced,
+        // so it is released after the epoch has been advanced twice more.
+
+        const int parity = static_cast<int>(d_epochManager.epoch() & 1);
+
+        node->d_retiredNext_p = d_retired_p[parity];
+        d_retired_p[parity]   = node;
+        ++d_numRetired;
+
+        if (d_numRetired >= k_RECLAIM_THRESHOLD
+         && d_epochManager.tryAdvance()) {
+            // The nodes retired during the epoch preceding the one just left
+            // are now unreachable; they share the parity of the new epoch.
+
+            const int newParity = parity ^ 1;
+
+            reclaimed                = d_retired_p[newParity];
+            d_retired_p[newParity]   = 0;
+
+            for (Node *p = reclaimed; p; p = p->d_retiredNext_p) {
+                --d_numRetired;
+            }
+        }
+    }
+
+    freeRetired(reclaimed);
+}
+
+template <class KEY, class DATA>
+bool ConcurrentSkipList<KEY, DATA>::unlink(Node *victim)
+{
+    while (!victim->d_fullyLinked.loadAcquire()) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    victim->d_lock.lockWithBackoff();
+
+    if (victim->d_marked.loadRelaxed()) {
+        victim->d_lock.unlock();
+        return false;                                                 // RETURN
+    }
+
+    // Once 'victim' is marked (under its lock), no node can be linked after
+    // it, so its links are stable.
+
+    victim->d_marked.storeRelease(true);
+
+    const int  top = victim->d_level;
+    Node      *preds[k_MAX_LEVEL];
+    Node      *succs[k_MAX_LEVEL];
+
+    while (true) {
+        findNode(preds, succs, victim->key(), top);
+
+        // Lock the predecessors bottom-up (i.e., in descending key order),
+        // validating that each is unmarked and still precedes 'victim'.
+
+        int  highestLocked = -1;
+        bool valid         = true;
+        for (int level = 0; valid && level <= top; ++level) {
+            Node *pred = preds[level];
+            if (0 == level || pred != preds[level - 1]) {
+                pred->d_lock.lockWithBackoff();
+            }
+            highestLocked = level;
+            valid = !pred->d_marked.loadRelaxed()
+                 && pred->d_next[level].loadRelaxed() == victim;
+        }
+
+        if (valid) {
+            for (int level = top; 0 <= level; --level) {
+                preds[level]->d_next[level].storeRelease(
+                                       victim->d_next[level].loadRelaxed());
+            }
+        }
+
+        for (int level = highestLocked; 0 <= level; --level) {
+            if (0 == level || preds[level] != preds[level - 1]) {
+                preds[level]->d_lock.unlock();
+            }
+        }
+
+        if (valid) {
+            break;
+        }
+    }
+
+    victim->d_lock.unlock();
+
+    d_length.addRelaxed(-1);
+
+    return true;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::findNode(Node       **preds,
+                                            Node       **succs,
+                                            const KEY&   key,
+                                            int          level) const
+{
+    int top = d_maxLevel.loadAcquire();
+    if (top < level) {
+        top = level;
+    }
+
+    int   found = -1;
+    Node *pred  = d_head_p;
+
+    for (int l = top; 0 <= l; --l) {
+        Node *curr = pred->d_next[l].loadAcquire();
+        while (curr && curr->key() < key) {
+            pred = curr;
+            curr = pred->d_next[l].loadAcquire();
+        }
+
+        if (-1 == found && curr && !(key < curr->key())) {
+            found = l;
+        }
+
+        preds[l] = pred;
+        succs[l] = curr;
+    }
+
+    return found;
+}
+
+template <class KEY, class DATA>
+typename ConcurrentSkipList<KEY, DATA>::Node *
+ConcurrentSkipList<KEY, DATA>::findFirstNotLess(const KEY& key) const
+{
+    Node *pred = d_head_p;
+    Node *curr = 0;
+
+    for (int l = d_maxLevel.loadAcquire(); 0 <= l; --l) {
+        curr = pred->d_next[l].loadAcquire();
+        while (curr && curr->key() < key) {
+            pred = curr;
+            curr = pred->d_next[l].loadAcquire();
+        }
+    }
+
+    return curr ? firstPresent(curr) : 0;
+}
+
+template <class KEY, class DATA>
+inline
+typename ConcurrentSkipList<KEY, DATA>::Node *
+ConcurrentSkipList<KEY, DATA>::firstPresent(Node *node) const
+{
+    while (node && !isPresent(node)) {
+        node = node->d_next[0].loadAcquire();
+    }
+    return node;
+}
+
+template <class KEY, class DATA>
+inline
+bool ConcurrentSkipList<KEY, DATA>::isPresent(const Node *node)
+{
+    return node->d_fullyLinked.loadAcquire() && !node->d_marked.loadAcquire();
+}
+
+// CREATORS
+template <class KEY, class DATA>
+ConcurrentSkipList<KEY, DATA>::ConcurrentSkipList(
+                                              bslma::Allocator *basicAllocator)
+: d_head_p(0)
+, d_maxLevel(0)
+, d_length(0)
+, d_randomState(0x2545F4914F6CDD1DULL)
+, d_epochManager()
+, d_retireMutex()
+, d_numRetired(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_retired_p[0] = 0;
+    d_retired_p[1] = 0;
+
+    d_head_p = allocateNode(k_MAX_LEVEL - 1);
+    d_head_p->d_fullyLinked.storeRelaxed(true);
+}
+
+template <class KEY, class DATA>
+ConcurrentSkipList<KEY, DATA>::~ConcurrentSkipList()
+{
+    freeRetired(d_retired_p[0]);
+    freeRetired(d_retired_p[1]);
+
+    Node *node = d_head_p->d_next[0].loadRelaxed();
+    while (node) {
+        Node *next = node->d_next[0].loadRelaxed();
+        destroyNode(node);
+        node = next;
+    }
+
+    deallocateNode(d_head_p);
+}
+
+// MANIPULATORS
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::add(const KEY& key, const DATA& data)
+{
+    const int  top  = randomLevel();
+    Node      *node = allocateNode(top);
+
+    // Construct the key and data before taking any lock, so that a throwing
+    // copy constructor leaves the list unchanged.
+
+    {
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(node,
+                                                            d_allocator_p);
+
+        bslma::ConstructionUtil::construct(node->d_key.address(),
+                                           d_allocator_p,
+                                           key);
+
+        bslma::DestructorProctor<KEY> keyProctor(node->d_key.address());
+
+        bslma::ConstructionUtil::construct(node->d_data.address(),
+                                           d_allocator_p,
+                                           data);
+
+        keyProctor.release();
+        proctor.release();
+    }
+
+    Node *preds[k_MAX_LEVEL];
+    Node *succs[k_MAX_LEVEL];
+
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    while (true) {
+        const int found = findNode(preds, succs, key, top);
+
+        if (-1 != found) {
+            Node *existing = succs[found];
+            if (!existing->d_marked.loadAcquire()) {
+                // Wait for a concurrent insertion of 'key' to complete, so
+                // that a subsequent lookup by this thread finds it.
+
+                while (!existing->d_fullyLinked.loadAcquire()) {
+                    bslmt::ThreadUtil::yield();
+                }
+                destroyNode(node);
+                return e_DUPLICATE;                                   // RETURN
+            }
+
+            // 'existing' is being removed; retry once it is unlinked.
+
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        int  highestLocked = -1;
+        bool valid         = true;
+        for (int level = 0; valid && level <= top; ++level) {
+            Node *pred = preds[level];
+            Node *succ = succs[level];
+            if (0 == level || pred != preds[level - 1]) {
+                pred->d_lock.lockWithBackoff();
+            }
+            highestLocked = level;
+            valid = !pred->d_marked.loadRelaxed()
+                 && (0 == succ || !succ->d_marked.loadRelaxed())
+                 && pred->d_next[level].loadRelaxed() == succ;
+        }
+
+        if (valid) {
+            for (int level = 0; level <= top; ++level) {
+                node->d_next[level].storeRelaxed(succs[level]);
+            }
+
+            // Make the levels searched by readers cover the new node before
+            // linking it at its upper levels.
+
+            int maxLevel = d_maxLevel.loadRelaxed();
+            while (maxLevel < top) {
+                maxLevel = d_maxLevel.testAndSwap(maxLevel, top);
+            }
+
+            for (int level = 0; level <= top; ++level) {
+                preds[level]->d_next[level].storeRelease(node);
+            }
+
+            node->d_fullyLinked.storeRelease(true);
+        }
+
+        for (int level = highestLocked; 0 <= level; --level) {
+            if (0 == level || preds[level] != preds[level - 1]) {
+                preds[level]->d_lock.unlock();
+            }
+        }
+
+        if (valid) {
+            d_length.addRelaxed(1);
+            return 0;                                                 // RETURN
+        }
+    }
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::popFront(KEY *key, DATA *data)
+{
+    Node *victim = 0;
+    {
+        ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+        while (true) {
+            victim = firstPresent(d_head_p->d_next[0].loadAcquire());
+            if (!victim) {
+                return e_NOT_FOUND;                                   // RETURN
+            }
+            if (unlink(victim)) {
+                break;
+            }
+        }
+
+        if (key) {
+            *key = victim->key();
+        }
+        if (data) {
+            *data = victim->data();
+        }
+    }
+
+    retire(victim);
+
+    return 0;
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::remove(const KEY& key, DATA *data)
+{
+    Node *preds[k_MAX_LEVEL];
+    Node *succs[k_MAX_LEVEL];
+    Node *victim = 0;
+    {
+        ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+        const int found = findNode(preds, succs, key, 0);
+        if (-1 == found) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+
+        victim = succs[found];
+
+        // A node found at a level other than its top is not yet fully linked
+        // (or is being unlinked); 'unlink' waits for the former and fails for
+        // the latter.
+
+        if (!unlink(victim)) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+
+        if (data) {
+            *data = victim->data();
+        }
+    }
+
+    retire(victim);
+
+    return 0;
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::removeAll()
+{
+    int count = 0;
+    while (0 == popFront()) {
+        ++count;
+    }
+    return count;
+}
+
+// ACCESSORS
+template <class KEY, class DATA>
+bool ConcurrentSkipList<KEY, DATA>::exists(const KEY& key) const
+{
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    const Node *node = findFirstNotLess(key);
+
+    return node && !(key < node->key());
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::find(DATA *data, const KEY& key) const
+{
+    BSLS_ASSERT(data);
+
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    const Node *node = findFirstNotLess(key);
+
+    if (!node || key < node->key()) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *data = node->data();
+
+    return 0;
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::findLowerBound(
+                                               KEY        *key,
+                                               DATA       *data,
+                                               const KEY&  lowerBound) const
+{
+    BSLS_ASSERT(key);
+    BSLS_ASSERT(data);
+
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    const Node *node = findFirstNotLess(lowerBound);
+
+    if (!node) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *key  = node->key();
+    *data = node->data();
+
+    return 0;
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::front(KEY *key, DATA *data) const
+{
+    BSLS_ASSERT(key);
+    BSLS_ASSERT(data);
+
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    const Node *node = firstPresent(d_head_p->d_next[0].loadAcquire());
+
+    if (!node) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *key  = node->key();
+    *data = node->data();
+
+    return 0;
+}
+
+template <class KEY, class DATA>
+bool ConcurrentSkipList<KEY, DATA>::isEmpty() const
+{
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    return 0 == firstPresent(d_head_p->d_next[0].loadAcquire());
+}
+
+template <class KEY, class DATA>
+inline
+int ConcurrentSkipList<KEY, DATA>::length() const
+{
+    return d_length.loadRelaxed();
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::visit(const Visitor& visitor) const
+{
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    int count = 0;
+    for (Node *node = firstPresent(d_head_p->d_next[0].loadAcquire());
+         node;
+         node = firstPresent(node->d_next[0].loadAcquire())) {
+        ++count;
+        if (!visitor(node->key(), node->data())) {
+            break;
+        }
+    }
+    return count;
+}
+
+template <class KEY, class DATA>
+int ConcurrentSkipList<KEY, DATA>::visitFrom(const KEY&     lowerBound,
+                                             const Visitor& visitor) const
+{
+    ConcurrentSkipList_ReadGuard guard(&d_epochManager);
+
+    int count = 0;
+    for (Node *node = findFirstNotLess(lowerBound);
+         node;
+         node = firstPresent(node->d_next[0].loadAcquire())) {
+        ++count;
+        if (!visitor(node->key(), node->data())) {
+            break;
+        }
+    }
+    return count;
+}
+
+                                  // Aspects
+
+template <class KEY, class DATA>
+inline
+bslma::Allocator *ConcurrentSkipList<KEY, DATA>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
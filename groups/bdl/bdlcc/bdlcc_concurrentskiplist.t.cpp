@@ -0,0 +1,1440 @@
+// bdlcc_concurrentskiplist.t.cpp                                     -*-C++-*-
+
+#include <bdlcc_concurrentskiplist.h>
+
+#include <bdlcc_skiplist.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ConcurrentSkipList',
+// providing a thread-safe ordered map whose readers take no locks, and whose
+// removed nodes are reclaimed using the epochs maintained by the
+// component-private class 'bdlcc::ConcurrentSkipList_EpochManager', which is
+// tested first and independently.
+//
+// The single-threaded behavior of the list is verified against a 'bsl::map'
+// oracle under a pseudo-random sequence of operations.  Memory reclamation is
+// verified by observing that the memory in use remains bounded under a long
+// sequence of insertions and removals.  Thread safety is verified by stress
+// tests whose outcome can be checked exactly after the threads are joined.
+//
+// In addition to positive test cases, a negative test case -1 compares the
+// throughput of this list with that of 'bdlcc::SkipList' over a range of
+// reader/writer ratios.
+// ----------------------------------------------------------------------------
+// ConcurrentSkipList_EpochManager
+// [ 2] ConcurrentSkipList_EpochManager();
+// [ 2] int enter();
+// [ 2] void leave(int token);
+// [ 2] bool tryAdvance();
+// [ 2] bsls::Types::Uint64 epoch() const;
+//
+// ConcurrentSkipList_ReadGuard
+// [ 2] explicit ConcurrentSkipList_ReadGuard(manager);
+// [ 2] ~ConcurrentSkipList_ReadGuard();
+//
+// ConcurrentSkipList
+// [ 3] explicit ConcurrentSkipList(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~ConcurrentSkipList();
+// [ 3] int add(const KEY& key, const DATA& data);
+// [ 3] int popFront(KEY *key = 0, DATA *data = 0);
+// [ 3] int remove(const KEY& key, DATA *data = 0);
+// [ 3] int removeAll();
+// [ 3] bool exists(const KEY& key) const;
+// [ 3] int find(DATA *data, const KEY& key) const;
+// [ 3] int findLowerBound(KEY *key, DATA *data, const KEY& lowerBound) const;
+// [ 3] int front(KEY *key, DATA *data) const;
+// [ 3] bool isEmpty() const;
+// [ 3] int length() const;
+// [ 3] int visit(const Visitor& visitor) const;
+// [ 3] int visitFrom(const KEY& lowerBound, const Visitor& visitor) const;
+// [ 4] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] MEMORY RECLAMATION AND ALLOCATOR PROPAGATION
+// [ 5] THREAD SAFETY
+// [ 6] USAGE EXAMPLE
+// [-1] THROUGHPUT COMPARISON WITH 'bdlcc::SkipList'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::ConcurrentSkipList<int, int>     Obj;
+typedef bdlcc::ConcurrentSkipList_EpochManager  EpochManager;
+typedef bdlcc::ConcurrentSkipList_ReadGuard     ReadGuard;
+typedef bsl::pair<int, int>                     Element;
+typedef bsl::map<int, int>                      Oracle;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class Recorder {
+    // This class provides a visitor that records the elements it visits, and
+    // stops the visit once a specified number of elements has been recorded.
+
+    // DATA
+    bsl::vector<Element> *d_elements_p;  // recorded elements (held)
+    int                   d_limit;       // number of elements to record
+
+  public:
+    // CREATORS
+    Recorder(bsl::vector<Element> *elements, int limit)
+    : d_elements_p(elements)
+    , d_limit(limit)
+        // Create a visitor appending to the specified 'elements' that stops
+        // the visit once 'elements' holds the specified 'limit' elements.
+    {
+    }
+
+    // MANIPULATORS
+    bool operator()(const int& key, const int& data)
+        // Append the specified 'key' and 'data' to the recorded elements, and
+        // return 'true' if fewer than the limit have been recorded.
+    {
+        d_elements_p->push_back(Element(key, data));
+        return static_cast<int>(d_elements_p->size()) < d_limit;
+    }
+};
+
+void verifyList(const Obj& X, const Oracle& oracle, int line)
+    // Verify, using the 'visit' and 'length' methods of the specified 'X',
+    // that 'X' holds exactly the elements of the specified 'oracle', in
+    // order, and report failures using the specified 'line'.
+{
+    bsl::vector<Element> elements(X.allocator());
+
+    const int count = X.visit(Recorder(&elements, INT_MAX));
+
+    ASSERTV(line, count == static_cast<int>(oracle.size()));
+    ASSERTV(line, X.length() == static_cast<int>(oracle.size()));
+    ASSERTV(line, X.isEmpty() == oracle.empty());
+    ASSERTV(line, elements.size() == oracle.size());
+
+    Oracle::const_iterator it = oracle.begin();
+    for (bsl::size_t i = 0; i < elements.size() && it != oracle.end();
+                                                                  ++i, ++it) {
+        ASSERTV(line, i, elements[i].first  == it->first);
+        ASSERTV(line, i, elements[i].second == it->second);
+    }
+}
+
+inline
+int dataForKey(int key)
+    // Return the data associated with the specified 'key' by the stress
+    // tests.
+{
+    return key * 7 + 1;
+}
+
+struct DisjointStressTest {
+    // This 'struct' provides the thread functions and shared state of a
+    // stress test in which each writer owns a disjoint subset of the keys,
+    // so that the final content of the list is known exactly.
+
+    enum { k_NUM_KEYS = 1000 };
+
+    // DATA
+    Obj                 *d_list_p;        // list under test
+    int                  d_numWriters;    // number of writer threads
+    int                  d_numIters;      // iterations per writer
+    bsls::AtomicInt      d_writersDone;   // number of finished writers
+    char                 d_present[k_NUM_KEYS];
+                                          // final presence of each key
+
+    // MANIPULATORS
+    void reader(int threadIndex)
+        // Repeatedly look up and visit the list until every writer has
+        // finished, and verify that the data observed matches the keys, using
+        // the specified 'threadIndex' to vary the sequence of keys.
+    {
+        unsigned int state = 3 + threadIndex;
+        while (d_writersDone.load() < d_numWriters) {
+            state = state * 1103515245 + 12345;
+            const int key = static_cast<int>((state >> 8) % k_NUM_KEYS);
+
+            int data = -1;
+            if (0 == d_list_p->find(&data, key)) {
+                ASSERTV(key, data, dataForKey(key) == data);
+            }
+
+            int foundKey = -1;
+            if (0 == d_list_p->findLowerBound(&foundKey, &data, key)) {
+                ASSERTV(key, foundKey, key <= foundKey);
+                ASSERTV(foundKey, data, dataForKey(foundKey) == data);
+            }
+
+            bsl::vector<Element> elements(d_list_p->allocator());
+            d_list_p->visitFrom(key, Recorder(&elements, 50));
+            for (bsl::size_t i = 0; i < elements.size(); ++i) {
+                ASSERTV(key, elements[i].first, key <= elements[i].first);
+                ASSERTV(elements[i].first,
+                        dataForKey(elements[i].first) == elements[i].second);
+                if (i) {
+                    ASSERTV(elements[i - 1].first < elements[i].first);
+                }
+            }
+        }
+    }
+
+    void writer(int threadIndex)
+        // Add and remove pseudo-random keys owned by the writer having the
+        // specified 'threadIndex', and record which of them are present at
+        // the end.
+    {
+        unsigned int state = 11 + threadIndex;
+        for (int i = 0; i < d_numIters; ++i) {
+            state = state * 1103515245 + 12345;
+            const int slot = static_cast<int>(
+                       (state >> 8) % (k_NUM_KEYS / d_numWriters));
+            const int key  = slot * d_numWriters + threadIndex;
+
+            if (d_present[key]) {
+                int data = -1;
+                const int rc = d_list_p->remove(key, &data);
+                ASSERTV(key, rc, 0 == rc);
+                ASSERTV(key, data, dataForKey(key) == data);
+                d_present[key] = 0;
+            }
+            else {
+                const int rc = d_list_p->add(key, dataForKey(key));
+                ASSERTV(key, rc, 0 == rc);
+                d_present[key] = 1;
+            }
+        }
+        ++d_writersDone;
+    }
+};
+
+struct ContendedStressTest {
+    // This 'struct' provides the thread function and shared state of a
+    // stress test in which all threads add and remove the same few keys.
+
+    enum { k_NUM_KEYS = 16 };
+
+    // DATA
+    Obj             *d_list_p;      // list under test
+    int              d_numIters;    // iterations per thread
+    bsls::AtomicInt  d_numAdded;    // number of successful 'add' calls
+    bsls::AtomicInt  d_numRemoved;  // number of successful removals
+
+    // MANIPULATORS
+    void run(int threadIndex)
+        // Add, remove, and pop pseudo-random keys, using the specified
+        // 'threadIndex' to vary the sequence of keys, and count the
+        // successful operations.
+    {
+        unsigned int state = 5 + threadIndex;
+        for (int i = 0; i < d_numIters; ++i) {
+            state = state * 1103515245 + 12345;
+            const int key = static_cast<int>((state >> 8) % k_NUM_KEYS);
+            const int op  = static_cast<int>((state >> 20) % 8);
+
+            if (op < 4) {
+                const int rc = d_list_p->add(key, dataForKey(key));
+                if (0 == rc) {
+                    ++d_numAdded;
+                }
+                else {
+                    ASSERTV(rc, Obj::e_DUPLICATE == rc);
+                }
+            }
+            else if (op < 7) {
+                int data = -1;
+                if (0 == d_list_p->remove(key, &data)) {
+                    ASSERTV(key, data, dataForKey(key) == data);
+                    ++d_numRemoved;
+                }
+            }
+            else {
+                int foundKey = -1, data = -1;
+                if (0 == d_list_p->popFront(&foundKey, &data)) {
+                    ASSERTV(foundKey, data, dataForKey(foundKey) == data);
+                    ++d_numRemoved;
+                }
+            }
+        }
+    }
+};
+
+void popAll(Obj *list, bsl::vector<int> *keys, bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier', then pop elements from the specified
+    // 'list' until it is empty, appending their keys to the specified 'keys'.
+{
+    barrier->wait();
+
+    int key, data;
+    while (0 == list->popFront(&key, &data)) {
+        ASSERTV(key, data, dataForKey(key) == data);
+        keys->push_back(key);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace PERFORMANCE {
+
+typedef bdlcc::SkipList<int, int> LockedList;
+
+bool lookup(Obj *list, int key)
+    // Return 'true' if the specified 'key' is in the specified 'list'.
+{
+    int data;
+    return 0 == list->find(&data, key);
+}
+
+bool lookup(LockedList *list, int key)
+    // Return 'true' if the specified 'key' is in the specified 'list'.
+{
+    LockedList::PairHandle handle;
+    return 0 == list->find(&handle, key);
+}
+
+void toggle(Obj *list, int key)
+    // Add the specified 'key' to the specified 'list' if it is absent, and
+    // remove it otherwise.
+{
+    if (0 != list->add(key, key)) {
+        list->remove(key);
+    }
+}
+
+void toggle(LockedList *list, int key)
+    // Add the specified 'key' to the specified 'list' if it is absent, and
+    // remove it otherwise.
+{
+    if (0 != list->addUnique(key, key)) {
+        LockedList::PairHandle handle;
+        if (0 == list->find(&handle, key)) {
+            list->remove(handle);
+        }
+    }
+}
+
+template <class LIST>
+struct Reader {
+    // This 'struct' provides the run function of a benchmark thread that
+    // looks up keys in a list of (template parameter) type 'LIST'.
+
+    static void run(LIST *list, int numKeys, int batchSize, int threadIndex)
+        // Look up the specified 'batchSize' pseudo-random keys in the range
+        // '[0 .. numKeys)' in the specified 'list', using the specified
+        // 'threadIndex' to vary the sequence of keys.
+    {
+        unsigned int state = 1 + threadIndex * 7919;
+        int          hits  = 0;
+        for (int i = 0; i < batchSize; ++i) {
+            state = state * 1103515245 + 12345;
+            hits += lookup(list, static_cast<int>((state >> 8) % numKeys));
+        }
+        ASSERT(0 <= hits);
+    }
+};
+
+template <class LIST>
+struct Writer {
+    // This 'struct' provides the run function of a benchmark thread that adds
+    // and removes keys in a list of (template parameter) type 'LIST'.
+
+    static void run(LIST *list, int numKeys, int batchSize, int threadIndex)
+        // Add or remove the specified 'batchSize' pseudo-random keys in the
+        // range '[0 .. numKeys)' in the specified 'list', using the specified
+        // 'threadIndex' to vary the sequence of keys.
+    {
+        unsigned int state = 7 + threadIndex;
+        for (int i = 0; i < batchSize; ++i) {
+            state = state * 1103515245 + 12345;
+            toggle(list, static_cast<int>((state >> 8) % numKeys));
+        }
+    }
+};
+
+template <class LIST>
+void runBenchmark(const char *name,
+                  LIST       *list,
+                  int         numKeys,
+                  int         numReaders,
+                  int         numWriters,
+                  int         millisecondsPerSample,
+                  int         numSamples)
+    // Populate the specified 'list' with every other key in the range
+    // '[0 .. numKeys)' for the specified 'numKeys', then run a throughput
+    // benchmark having the specified 'numReaders' and 'numWriters' threads,
+    // for the specified 'numSamples' samples of the specified
+    // 'millisecondsPerSample' duration, and print a CSV line labeled with the
+    // specified 'name' holding the median lookup and update throughputs.
+{
+    const int k_BATCH_SIZE = 1000;
+
+    for (int key = 0; key < numKeys; key += 2) {
+        toggle(list, key);
+    }
+
+    bslmt::ThroughputBenchmark       benchmark;
+    bslmt::ThroughputBenchmarkResult result;
+
+    int readerGroup = -1, writerGroup = -1;
+    if (numReaders) {
+        readerGroup = benchmark.addThreadGroup(
+                                  bdlf::BindUtil::bind(&Reader<LIST>::run,
+                                                       list,
+                                                       numKeys,
+                                                       k_BATCH_SIZE,
+                                                       bdlf::PlaceHolders::_1),
+                                  numReaders,
+                                  0);
+    }
+    if (numWriters) {
+        writerGroup = benchmark.addThreadGroup(
+                                  bdlf::BindUtil::bind(&Writer<LIST>::run,
+                                                       list,
+                                                       numKeys,
+                                                       k_BATCH_SIZE,
+                                                       bdlf::PlaceHolders::_1),
+                                  numWriters,
+                                  0);
+    }
+
+    benchmark.execute(&result, millisecondsPerSample, numSamples);
+
+    double reads = 0, writes = 0;
+    if (0 <= readerGroup) {
+        result.getMedian(&reads, readerGroup);
+    }
+    if (0 <= writerGroup) {
+        result.getMedian(&writes, writerGroup);
+    }
+
+    cout << name       << ","
+         << numReaders << ","
+         << numWriters << ","
+         << numKeys    << ","
+         << fixed << setprecision(0) << reads * k_BATCH_SIZE << ","
+         << writes * k_BATCH_SIZE
+         << endl;
+}
+
+}  // close namespace PERFORMANCE
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An Order Book Price Level Index
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain, for one side of an order book, an index from price (in
+// ticks) to the total quantity available at that price.  Many threads consult
+// the best price and the depth of the book, and a single thread applies
+// updates from the exchange.
+//
+// First, we define the index type:
+//..
+    typedef bdlcc::ConcurrentSkipList<int, int> PriceLevels;
+//..
+
+    struct DepthAccumulator {
+        int  d_limit;
+        int *d_total_p;
+
+        bool operator()(const int& price, const int& quantity) const
+        {
+            if (price > d_limit) {
+                return false;                                         // RETURN
+            }
+            *d_total_p += quantity;
+            return true;
+        }
+    };
+
+void example1(bslma::Allocator *allocator)
+    // Run the usage example using the specified 'allocator'.
+{
+// Then, we create an index and, acting as the update thread, add some price
+// levels:
+//..
+    PriceLevels asks(allocator);
+
+    int rc = asks.add(10050, 300);
+    ASSERT(0 == rc);
+    rc = asks.add(10025, 100);
+    ASSERT(0 == rc);
+    rc = asks.add(10075, 500);
+    ASSERT(0 == rc);
+//..
+// Next, a reading thread finds the best (lowest) ask and its quantity, and
+// the quantity available at a given price:
+//..
+    int bestPrice, bestQuantity;
+    rc = asks.front(&bestPrice, &bestQuantity);
+    ASSERT(0     == rc);
+    ASSERT(10025 == bestPrice);
+    ASSERT(100   == bestQuantity);
+
+    int quantity;
+    rc = asks.find(&quantity, 10050);
+    ASSERT(0   == rc);
+    ASSERT(300 == quantity);
+//..
+// Then, a reading thread computes the quantity available at or below a limit
+// price by visiting the levels in order:
+//..
+    int              total = 0;
+    DepthAccumulator depth = { 10060, &total };
+    asks.visit(depth);
+    ASSERT(400 == total);
+//..
+// Finally, the update thread removes the best level once it is exhausted:
+//..
+    rc = asks.remove(10025);
+    ASSERT(0 == rc);
+
+    rc = asks.front(&bestPrice, &bestQuantity);
+    ASSERT(0     == rc);
+    ASSERT(10050 == bestPrice);
+//..
+}
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("usage", veryVeryVeryVerbose);
+
+        USAGE_EXAMPLE::example1(&ta);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Readers running concurrently with writers observe only elements
+        //:   that were added, with the data they were added with, in
+        //:   ascending key order.
+        //:
+        //: 2 Writers operating on different keys do not interfere: the final
+        //:   content of the list is exactly that implied by each writer's
+        //:   own operations.
+        //:
+        //: 3 Writers contending on the same keys succeed exactly once per
+        //:   change: the number of successful additions less the number of
+        //:   successful removals equals the final length.
+        //:
+        //: 4 Concurrent 'popFront' calls remove each element exactly once,
+        //:   and each thread pops its elements in ascending order.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Run reader threads checking the data of every element they
+        //:   observe, concurrently with writer threads that each add and
+        //:   remove a disjoint subset of the keys, and compare the final
+        //:   content with the union of the writers' records.  (C-1..2)
+        //:
+        //: 2 Run threads adding, removing, and popping a small set of keys,
+        //:   count the successful operations, and compare the net count with
+        //:   the final length and the number of elements visited.  (C-3)
+        //:
+        //: 3 Pop a populated list empty from several threads, and verify
+        //:   that the union of the keys popped is the original set, with no
+        //:   duplicates.  (C-4)
+        //:
+        //: 4 Use a test allocator, and verify that all memory is released.
+        //:   (C-5)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        const int NUM_THREADS = 4;
+
+        if (verbose) cout << "\tDisjoint writers with readers." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                DisjointStressTest st;
+                st.d_list_p     = &mX;
+                st.d_numWriters = NUM_THREADS;
+                st.d_numIters   = 20000;
+                bsl::fill(st.d_present,
+                          st.d_present + DisjointStressTest::k_NUM_KEYS,
+                          0);
+
+                bslmt::ThreadGroup tg(&ta);
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    tg.addThread(
+                              bdlf::BindUtil::bind(&DisjointStressTest::reader,
+                                                   &st,
+                                                   i));
+                    tg.addThread(
+                              bdlf::BindUtil::bind(&DisjointStressTest::writer,
+                                                   &st,
+                                                   i));
+                }
+                tg.joinAll();
+
+                Oracle oracle(&ta);
+                for (int key = 0; key < DisjointStressTest::k_NUM_KEYS;
+                                                                      ++key) {
+                    if (st.d_present[key]) {
+                        oracle[key] = dataForKey(key);
+                    }
+                }
+                verifyList(X, oracle, L_);
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tContended writers." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ContendedStressTest st;
+                st.d_list_p   = &mX;
+                st.d_numIters = 50000;
+
+                bslmt::ThreadGroup tg(&ta);
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    tg.addThread(
+                                bdlf::BindUtil::bind(&ContendedStressTest::run,
+                                                     &st,
+                                                     i));
+                }
+                tg.joinAll();
+
+                const int NET = st.d_numAdded - st.d_numRemoved;
+
+                bsl::vector<Element> elements(&ta);
+                const int count = X.visit(Recorder(&elements, INT_MAX));
+
+                if (veryVerbose) {
+                    P_(st.d_numAdded) P_(st.d_numRemoved) P(NET)
+                }
+
+                ASSERTV(NET, X.length(), NET == X.length());
+                ASSERTV(NET, count,      NET == count);
+                for (bsl::size_t i = 0; i < elements.size(); ++i) {
+                    ASSERTV(dataForKey(elements[i].first) ==
+                                                          elements[i].second);
+                    if (i) {
+                        ASSERTV(elements[i - 1].first < elements[i].first);
+                    }
+                }
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tConcurrent 'popFront'." << endl;
+        {
+            const int NUM_KEYS = 20000;
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                for (int key = 0; key < NUM_KEYS; ++key) {
+                    mX.add(key, dataForKey(key));
+                }
+
+                bsl::vector<bsl::vector<int> > popped(NUM_THREADS, &ta);
+                bslmt::Barrier                 barrier(NUM_THREADS);
+
+                bslmt::ThreadGroup tg(&ta);
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    tg.addThread(bdlf::BindUtil::bind(&popAll,
+                                                      &mX,
+                                                      &popped[i],
+                                                      &barrier));
+                }
+                tg.joinAll();
+
+                ASSERT(X.isEmpty());
+                ASSERT(0 == X.length());
+
+                bsl::vector<int> seen(NUM_KEYS, 0, &ta);
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    for (bsl::size_t j = 0; j < popped[i].size(); ++j) {
+                        const int key = popped[i][j];
+                        ++seen[key];
+                        if (j) {
+                            ASSERTV(i, j, popped[i][j - 1] < key);
+                        }
+                    }
+                }
+                for (int key = 0; key < NUM_KEYS; ++key) {
+                    ASSERTV(key, seen[key], 1 == seen[key]);
+                }
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MEMORY RECLAMATION AND ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        //: 1 The list, its nodes, and the keys and data of its elements use
+        //:   the allocator supplied at construction, which 'allocator'
+        //:   returns.
+        //:
+        //: 2 A list constructed without an allocator uses the default
+        //:   allocator.
+        //:
+        //: 3 'add' is exception-neutral: if an allocation fails, the list is
+        //:   unchanged and no memory is leaked.
+        //:
+        //: 4 The memory of removed elements is reclaimed while the list is in
+        //:   use, so that the memory in use remains bounded under a long
+        //:   sequence of additions and removals.
+        //:
+        //: 5 The destructor releases all memory, including that of elements
+        //:   removed but not yet reclaimed.
+        //
+        // Plan:
+        //: 1 Create lists of 'bsl::string' to 'bsl::string' with and without
+        //:   an allocator, add elements whose key and data are too long for
+        //:   the short-string buffer, and verify the source of the memory
+        //:   used.  (C-1..2)
+        //:
+        //: 2 Invoke 'add' in the exception-test loop, and verify the content
+        //:   of the list after each exception.  (C-3)
+        //:
+        //: 3 Add and remove 100000 elements one by one, and verify that the
+        //:   number of blocks in use remains below a small bound.  (C-4)
+        //:
+        //: 4 Destroy lists holding elements, and removed elements awaiting
+        //:   reclamation, and verify that all memory is released.  (C-5)
+        //
+        // Testing:
+        //   bslma::Allocator *allocator() const;
+        //   MEMORY RECLAMATION AND ALLOCATOR PROPAGATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "MEMORY RECLAMATION AND ALLOCATOR PROPAGATION"
+                        << endl
+                        << "============================================"
+                        << endl;
+
+        typedef bdlcc::ConcurrentSkipList<bsl::string, bsl::string> StrObj;
+
+        bslma::TestAllocator ca("constants", veryVeryVeryVerbose);
+
+        const bsl::string LONG_KEY("a key too long for the short buffer",
+                                   &ca);
+        const bsl::string LONG_DATA("data too long for the short buffer",
+                                    &ca);
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+            {
+                bslma::TestAllocatorMonitor dam2(&defaultAllocator);
+
+                StrObj mX(&ta);  const StrObj& X = mX;
+                ASSERT(&ta == X.allocator());
+
+                const bsls::Types::Int64 BEFORE = ta.numBlocksInUse();
+
+                ASSERT(0 == mX.add(LONG_KEY, LONG_DATA));
+                ASSERTV(ta.numBlocksInUse(),
+                        BEFORE + 3 == ta.numBlocksInUse());
+
+                bsl::string data(&sa);
+                ASSERT(0 == X.find(&data, LONG_KEY));
+                ASSERT(LONG_DATA == data);
+                ASSERT(&sa == data.get_allocator().mechanism());
+
+                ASSERT(dam2.isTotalSame());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+            {
+                StrObj mX;  const StrObj& X = mX;
+                ASSERT(&da == X.allocator());
+
+                ASSERT(0 == mX.add(LONG_KEY, LONG_DATA));
+                ASSERTV(da.numBlocksInUse(), 4 == da.numBlocksInUse());
+            }
+            ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tException neutrality of 'add'." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                StrObj mX(&ta);  const StrObj& X = mX;
+
+                ASSERT(0 == mX.add("", ""));
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    ASSERTV(X.length(), 1 == X.length());
+                    ASSERT(!X.exists(LONG_KEY));
+
+                    ASSERT(0 == mX.add(LONG_KEY, LONG_DATA));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(X.length(), 2 == X.length());
+                ASSERT(X.exists(LONG_KEY));
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tBounded memory under churn." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                bsls::Types::Int64 maxBlocks = 0;
+                for (int i = 0; i < 100000; ++i) {
+                    ASSERT(0 == mX.add(i, i));
+                    ASSERT(0 == mX.remove(i));
+                    if (maxBlocks < ta.numBlocksInUse()) {
+                        maxBlocks = ta.numBlocksInUse();
+                    }
+                }
+                if (veryVerbose) { P(maxBlocks) }
+
+                // The head, the node being added, and at most two batches of
+                // retired nodes awaiting reclamation.
+
+                ASSERTV(maxBlocks, maxBlocks <= 2 + 2 * 64);
+                ASSERT(X.isEmpty());
+
+                // Leave removed nodes awaiting reclamation at destruction.
+
+                for (int i = 0; i < 10; ++i) {
+                    ASSERT(0 == mX.add(i, i));
+                }
+                ASSERT(10 == mX.removeAll());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'add' adds an element if and only if its key is not in the list,
+        //:   and returns 'e_DUPLICATE' otherwise.
+        //:
+        //: 2 'remove' and 'popFront' remove the requested element, load its
+        //:   key and data if requested, and return 'e_NOT_FOUND' if there is
+        //:   no such element.
+        //:
+        //: 3 'removeAll' empties the list and returns the number of elements
+        //:   removed.
+        //:
+        //: 4 The accessors report the content of the list, in ascending key
+        //:   order, and 'find', 'findLowerBound', and 'front' do not modify
+        //:   their output arguments on failure.
+        //:
+        //: 5 'visit' and 'visitFrom' stop when the visitor returns 'false',
+        //:   and return the number of elements visited.
+        //
+        // Plan:
+        //: 1 Apply a long pseudo-random sequence of operations over a small
+        //:   key range to a list and to a 'bsl::map' oracle, compare the
+        //:   result of each operation with that implied by the oracle, and
+        //:   periodically compare the full content.  (C-1..5)
+        //
+        // Testing:
+        //   explicit ConcurrentSkipList(bslma::Allocator *basicAllocator = 0);
+        //   ~ConcurrentSkipList();
+        //   int add(const KEY& key, const DATA& data);
+        //   int popFront(KEY *key = 0, DATA *data = 0);
+        //   int remove(const KEY& key, DATA *data = 0);
+        //   int removeAll();
+        //   bool exists(const KEY& key) const;
+        //   int find(DATA *data, const KEY& key) const;
+        //   int findLowerBound(KEY *key, DATA *data, const KEY& lb) const;
+        //   int front(KEY *key, DATA *data) const;
+        //   bool isEmpty() const;
+        //   int length() const;
+        //   int visit(const Visitor& visitor) const;
+        //   int visitFrom(const KEY& lowerBound, const Visitor& v) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        const int NUM_KEYS  = 200;
+        const int NUM_ITERS = 50000;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj    mX(&ta);  const Obj& X = mX;
+            Oracle oracle(&ta);
+
+            unsigned int state = 1;
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                state = state * 1103515245 + 12345;
+                const int KEY  = static_cast<int>((state >> 8) % NUM_KEYS);
+                const int DATA = static_cast<int>(state >> 16);
+                const int OP   = static_cast<int>((state >> 4) % 16);
+
+                Oracle::iterator it = oracle.lower_bound(KEY);
+
+                const bool FOUND = it != oracle.end() && it->first == KEY;
+
+                switch (OP) {
+                  case 0:
+                  case 1:
+                  case 2:
+                  case 3: {
+                    const int rc = mX.add(KEY, DATA);
+                    ASSERTV(i, KEY, rc,
+                            (FOUND ? int(Obj::e_DUPLICATE) : 0) == rc);
+                    if (!FOUND) {
+                        oracle[KEY] = DATA;
+                    }
+                  } break;
+                  case 4:
+                  case 5: {
+                    int data = -1;
+                    const int rc = mX.remove(KEY, &data);
+                    ASSERTV(i, KEY, rc,
+                            (FOUND ? 0 : int(Obj::e_NOT_FOUND)) == rc);
+                    if (FOUND) {
+                        ASSERTV(i, KEY, data, it->second == data);
+                        oracle.erase(it);
+                    }
+                    else {
+                        ASSERTV(i, data, -1 == data);
+                    }
+                  } break;
+                  case 6: {
+                    const int rc = mX.remove(KEY);
+                    ASSERTV(i, KEY, rc,
+                            (FOUND ? 0 : int(Obj::e_NOT_FOUND)) == rc);
+                    if (FOUND) {
+                        oracle.erase(it);
+                    }
+                  } break;
+                  case 7: {
+                    int key = -1, data = -1;
+                    const int rc = (state & 0x10000)
+                                   ? mX.popFront(&key, &data)
+                                   : mX.popFront();
+                    ASSERTV(i, rc,
+                            (oracle.empty() ? int(Obj::e_NOT_FOUND) : 0)
+                                                                       == rc);
+                    if (!oracle.empty()) {
+                        if (state & 0x10000) {
+                            ASSERTV(i, key,  oracle.begin()->first  == key);
+                            ASSERTV(i, data, oracle.begin()->second == data);
+                        }
+                        oracle.erase(oracle.begin());
+                    }
+                  } break;
+                  case 8: {
+                    int data = -1;
+                    const int rc = X.find(&data, KEY);
+                    ASSERTV(i, KEY, rc,
+                            (FOUND ? 0 : int(Obj::e_NOT_FOUND)) == rc);
+                    ASSERTV(i, KEY, data, (FOUND ? it->second : -1) == data);
+                    ASSERTV(i, KEY, FOUND == X.exists(KEY));
+                  } break;
+                  case 9: {
+                    int key = -1, data = -1;
+                    const int rc = X.findLowerBound(&key, &data, KEY);
+                    const bool HAS = it != oracle.end();
+                    ASSERTV(i, KEY, rc,
+                            (HAS ? 0 : int(Obj::e_NOT_FOUND)) == rc);
+                    ASSERTV(i, KEY, key,  (HAS ? it->first  : -1) == key);
+                    ASSERTV(i, KEY, data, (HAS ? it->second : -1) == data);
+                  } break;
+                  case 10: {
+                    int key = -1, data = -1;
+                    const int  rc  = X.front(&key, &data);
+                    const bool HAS = !oracle.empty();
+                    ASSERTV(i, rc, (HAS ? 0 : int(Obj::e_NOT_FOUND)) == rc);
+                    ASSERTV(i, key,
+                            (HAS ? oracle.begin()->first : -1) == key);
+                    ASSERTV(i, data,
+                            (HAS ? oracle.begin()->second : -1) == data);
+                    ASSERTV(i, HAS == !X.isEmpty());
+                  } break;
+                  case 11: {
+                    const int LIMIT = static_cast<int>((state >> 24) % 8) + 1;
+
+                    bsl::vector<Element> elements(&ta);
+                    const int count = X.visitFrom(KEY,
+                                                  Recorder(&elements, LIMIT));
+                    ASSERTV(i, count, elements.size() == bsl::size_t(count));
+                    ASSERTV(i, count, count <= LIMIT);
+
+                    Oracle::const_iterator jt = it;
+                    for (int j = 0; j < count; ++j, ++jt) {
+                        ASSERTV(i, j, jt != oracle.end());
+                        if (jt == oracle.end()) {
+                            break;
+                        }
+                        ASSERTV(i, j, jt->first  == elements[j].first);
+                        ASSERTV(i, j, jt->second == elements[j].second);
+                    }
+                    ASSERTV(i, count, count == LIMIT || jt == oracle.end());
+                  } break;
+                  case 12: {
+                    const int LIMIT = static_cast<int>((state >> 24) % 8) + 1;
+
+                    bsl::vector<Element> elements(&ta);
+                    const int count = X.visit(Recorder(&elements, LIMIT));
+                    const int EXPECTED = bsl::min(
+                                       LIMIT, static_cast<int>(oracle.size()));
+                    ASSERTV(i, count, EXPECTED == count);
+                  } break;
+                  case 13: {
+                    if (0 == (state & 0xf00)) {
+                        const int count = mX.removeAll();
+                        ASSERTV(i, count, int(oracle.size()) == count);
+                        oracle.clear();
+                    }
+                  } break;
+                  default: {
+                    verifyList(X, oracle, i);
+                  }
+                }
+            }
+            verifyList(X, oracle, L_);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // EPOCH MANAGER
+        //
+        // Concerns:
+        //: 1 A new manager has epoch 1 and no readers.
+        //:
+        //: 2 'tryAdvance' succeeds if and only if no reader of the epoch
+        //:   preceding the current one remains registered, and increments
+        //:   the epoch on success.
+        //:
+        //: 3 A reader registered in the current epoch does not prevent the
+        //:   epoch from being advanced once, but does prevent it from being
+        //:   advanced twice.
+        //:
+        //: 4 'leave' deregisters the reader identified by its token, and the
+        //:   read guard calls 'enter' and 'leave'.
+        //
+        // Plan:
+        //: 1 Register readers with 'enter', and with read guards, in various
+        //:   epochs, and verify the result of 'tryAdvance' and the epoch
+        //:   after each step.  (C-1..4)
+        //
+        // Testing:
+        //   ConcurrentSkipList_EpochManager();
+        //   int enter();
+        //   void leave(int token);
+        //   bool tryAdvance();
+        //   bsls::Types::Uint64 epoch() const;
+        //   explicit ConcurrentSkipList_ReadGuard(manager);
+        //   ~ConcurrentSkipList_ReadGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EPOCH MANAGER" << endl
+                          << "=============" << endl;
+
+        EpochManager mX;  const EpochManager& X = mX;
+
+        ASSERT(1 == X.epoch());
+
+        ASSERT(mX.tryAdvance());
+        ASSERT(2 == X.epoch());
+        ASSERT(mX.tryAdvance());
+        ASSERT(3 == X.epoch());
+
+        if (verbose) cout << "\tReader of the current epoch." << endl;
+        {
+            const int token = mX.enter();
+
+            ASSERT(mX.tryAdvance());
+            ASSERT(4 == X.epoch());
+
+            ASSERT(!mX.tryAdvance());
+            ASSERT(!mX.tryAdvance());
+            ASSERT(4 == X.epoch());
+
+            // A reader entering now belongs to epoch 4, and does not block
+            // the advance from 4.
+
+            const int token2 = mX.enter();
+            ASSERT(!mX.tryAdvance());
+
+            mX.leave(token);
+
+            ASSERT(mX.tryAdvance());
+            ASSERT(5 == X.epoch());
+            ASSERT(!mX.tryAdvance());
+
+            mX.leave(token2);
+
+            ASSERT(mX.tryAdvance());
+            ASSERT(6 == X.epoch());
+        }
+
+        if (verbose) cout << "\tRead guard." << endl;
+        {
+            {
+                ReadGuard guard(&mX);
+
+                ASSERT(mX.tryAdvance());
+                ASSERT(!mX.tryAdvance());
+                ASSERT(7 == X.epoch());
+            }
+            ASSERT(mX.tryAdvance());
+            ASSERT(8 == X.epoch());
+        }
+
+        if (verbose) cout << "\tReaders in several threads' stripes." << endl;
+        {
+            // Registrations from the same thread share a stripe; verify that
+            // the counts of nested registrations are maintained.
+
+            int tokens[10];
+            for (int i = 0; i < 10; ++i) {
+                tokens[i] = mX.enter();
+            }
+            ASSERT(mX.tryAdvance());
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, !mX.tryAdvance());
+                mX.leave(tokens[i]);
+            }
+            ASSERT(mX.tryAdvance());
+            ASSERT(10 == X.epoch());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add, look up, visit, and remove a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.length());
+
+            ASSERT(0 == mX.add(3, 30));
+            ASSERT(0 == mX.add(1, 10));
+            ASSERT(0 == mX.add(2, 20));
+            ASSERT(Obj::e_DUPLICATE == mX.add(2, 21));
+
+            ASSERT(!X.isEmpty());
+            ASSERT(3 == X.length());
+
+            int key, data;
+            ASSERT(0 == X.find(&data, 2));
+            ASSERT(20 == data);
+            ASSERT(Obj::e_NOT_FOUND == X.find(&data, 4));
+
+            ASSERT(0 == X.front(&key, &data));
+            ASSERT(1 == key);
+            ASSERT(10 == data);
+
+            ASSERT(0 == X.findLowerBound(&key, &data, 2));
+            ASSERT(2 == key);
+            ASSERT(Obj::e_NOT_FOUND == X.findLowerBound(&key, &data, 4));
+
+            bsl::vector<Element> elements(&ta);
+            ASSERT(3 == X.visit(Recorder(&elements, INT_MAX)));
+            ASSERT(3 == elements.size());
+            ASSERT(Element(1, 10) == elements[0]);
+            ASSERT(Element(2, 20) == elements[1]);
+            ASSERT(Element(3, 30) == elements[2]);
+
+            ASSERT(0 == mX.remove(2, &data));
+            ASSERT(20 == data);
+            ASSERT(Obj::e_NOT_FOUND == mX.remove(2));
+            ASSERT(!X.exists(2));
+
+            ASSERT(0 == mX.popFront(&key, &data));
+            ASSERT(1 == key);
+            ASSERT(10 == data);
+
+            ASSERT(1 == mX.removeAll());
+            ASSERT(X.isEmpty());
+            ASSERT(Obj::e_NOT_FOUND == mX.popFront());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT COMPARISON WITH 'bdlcc::SkipList'
+        //
+        // Concerns:
+        //: 1 Compare the lookup and update throughput of
+        //:   'bdlcc::ConcurrentSkipList' with that of 'bdlcc::SkipList' over
+        //:   a range of reader/writer ratios.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', run a group of reader
+        //:   threads and a group of writer threads against each list type,
+        //:   for each split of a fixed number of threads between readers and
+        //:   writers.  Print one CSV line per configuration:
+        //:   'list,readers,writers,keys,lookupsPerSecond,updatesPerSecond'.
+        //:
+        //: 2 The total number of threads and the number of keys may be
+        //:   specified as the arguments 3 and 4 on the command line.
+        //
+        // Testing:
+        //   THROUGHPUT COMPARISON WITH 'bdlcc::SkipList'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "THROUGHPUT COMPARISON WITH 'bdlcc::SkipList'"
+                        << endl
+                        << "============================================"
+                        << endl;
+
+        using namespace PERFORMANCE;
+
+        // Measure with the allocator production code would use.
+
+        bslma::DefaultAllocatorGuard perfGuard(
+                                     &bslma::NewDeleteAllocator::singleton());
+
+        const int numThreads = argc > 3 ? atoi(argv[3]) : 8;
+        const int numKeys    = argc > 4 ? atoi(argv[4]) : 100000;
+
+        const int MILLISECONDS = 200;
+        const int NUM_SAMPLES  = 5;
+
+        cout << "list,readers,writers,keys,lookupsPerSecond,updatesPerSecond"
+             << endl;
+
+        for (int numWriters = 0; numWriters <= numThreads;
+                                   numWriters = numWriters ? numWriters * 2
+                                                           : 1) {
+            const int numReaders = numThreads - numWriters;
+            {
+                LockedList list;
+                runBenchmark("SkipList",
+                             &list,
+                             numKeys,
+                             numReaders,
+                             numWriters,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+            }
+            {
+                Obj list;
+                runBenchmark("ConcurrentSkipList",
+                             &list,
+                             numKeys,
+                             numReaders,
+                             numWriters,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,162 @@
+// bdlcc_shardedcache.cpp                                             -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_shardedcache_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace {
+
+const bsls::Types::Uint64 k_SEEDS[] = {
+    // Odd multipliers selecting independent hash functions, one per row of
+    // the sketch.
+
+    0x9e3779b97f4a7c15ULL,
+    0xc2b2ae3d27d4eb4fULL,
+    0x165667b19e3779f9ULL,
+    0x27d4eb2f165667c5ULL
+};
+
+}  // close unnamed namespace
+
+namespace bdlcc {
+
+                     // ----------------------------------
+                     // class ShardedCache_FrequencySketch
+                     // ----------------------------------
+
+// PRIVATE MANIPULATORS
+void ShardedCache_FrequencySketch::age()
+{
+    // Halve each of the 16 4-bit counters of a word at once: shift right and
+    // clear the bit shifted in from the neighboring counter.
+
+    const bsls::Types::Uint64 k_MASK = 0x7777777777777777ULL;
+
+    for (bsl::size_t i = 0; i <= d_tableMask; ++i) {
+        bsls::Types::Uint64 word = d_table_p[i].loadRelaxed();
+        while (true) {
+            const bsls::Types::Uint64 prev =
+                       d_table_p[i].testAndSwap(word, (word >> 1) & k_MASK);
+            if (prev == word) {
+                break;
+            }
+            word = prev;
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+bsl::size_t ShardedCache_FrequencySketch::indexOf(bsl::size_t hash,
+                                                  int         row) const
+{
+    bsls::Types::Uint64 h = (hash + k_SEEDS[row]) * k_SEEDS[row];
+    h ^= h >> 32;
+    return static_cast<bsl::size_t>(h) & (d_tableMask * 16 + 15);
+}
+
+// CREATORS
+ShardedCache_FrequencySketch::ShardedCache_FrequencySketch(
+                                            bsl::size_t       expectedNumItems,
+                                            bslma::Allocator *basicAllocator)
+: d_table_p(0)
+, d_tableMask(0)
+, d_numAccesses(0)
+, d_sampleSize(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Provide about 4 counters per row for each expected item, and enough
+    // counters that collisions are rare for small caches.
+
+    bsl::size_t numWords = k_MIN_NUM_WORDS;
+    while (numWords < expectedNumItems && numWords < (1u << 20)) {
+        numWords <<= 1;
+    }
+
+    d_tableMask  = numWords - 1;
+    d_sampleSize = static_cast<bsls::Types::Int64>(expectedNumItems) *
+                                                                k_SAMPLE_RATIO;
+
+    d_table_p = static_cast<bsls::AtomicUint64 *>(
+                   d_allocator_p->allocate(numWords * sizeof *d_table_p));
+    for (bsl::size_t i = 0; i < numWords; ++i) {
+        new (d_table_p + i) bsls::AtomicUint64(0);
+    }
+}
+
+ShardedCache_FrequencySketch::~ShardedCache_FrequencySketch()
+{
+    // 'bsls::AtomicUint64' is trivially destructible.
+
+    d_allocator_p->deallocate(d_table_p);
+}
+
+// MANIPULATORS
+void ShardedCache_FrequencySketch::clear()
+{
+    for (bsl::size_t i = 0; i <= d_tableMask; ++i) {
+        d_table_p[i].storeRelaxed(0);
+    }
+    d_numAccesses.storeRelaxed(0);
+}
+
+void ShardedCache_FrequencySketch::increment(bsl::size_t hash)
+{
+    for (int row = 0; row < k_NUM_ROWS; ++row) {
+        const bsl::size_t         index = indexOf(hash, row);
+        bsls::AtomicUint64&       word  = d_table_p[index >> 4];
+        const int                 shift = static_cast<int>(index & 15) * 4;
+        const bsls::Types::Uint64 word0 = word.loadRelaxed();
+
+        if (((word0 >> shift) & 15) != 15) {
+            // Lose the increment, rather than retry, on contention.
+
+            word.testAndSwap(word0,
+                             word0 + (static_cast<bsls::Types::Uint64>(1)
+                                                                   << shift));
+        }
+    }
+
+    if (d_numAccesses.addRelaxed(1) == d_sampleSize) {
+        // Only the thread reaching the sample size ages the sketch.
+
+        age();
+        d_numAccesses.addRelaxed(-d_sampleSize / 2);
+    }
+}
+
+// ACCESSORS
+int ShardedCache_FrequencySketch::frequency(bsl::size_t hash) const
+{
+    int result = 15;
+    for (int row = 0; row < k_NUM_ROWS; ++row) {
+        const bsl::size_t index = indexOf(hash, row);
+        const int         shift = static_cast<int>(index & 15) * 4;
+        const int         count = static_cast<int>(
+                    (d_table_p[index >> 4].loadRelaxed() >> shift) & 15);
+        if (count < result) {
+            result = count;
+        }
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
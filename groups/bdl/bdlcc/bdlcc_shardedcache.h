@@ -0,0 +1,1452 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded in-process cache with CLOCK eviction.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: sharded in-process key-value cache
+//  bdlcc::ShardedCacheAdmissionPolicy: namespace for admission policy 'enum'
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// that partitions its items across a number of independently locked shards,
+// and that approximates LRU eviction using the CLOCK (second-chance)
+// algorithm.  'bdlcc::ShardedCache' provides the same 'insert',
+// 'tryGetValue', 'popFront', 'erase', and 'visit' interface as 'bdlcc::Cache',
+// including the post-eviction callback, and is intended for read-mostly
+// caches accessed from many threads.
+//
+// 'bdlcc::ShardedCache' uses the same template parameters as 'bdlcc::Cache':
+// the key type ('KEY'), the value type ('VALUE'), the optional hash function
+// ('HASH'), and the optional equal function ('EQUAL').
+//
+///Comparison with 'bdlcc::Cache'
+///------------------------------
+// 'bdlcc::Cache' protects a single hash table and a single eviction queue
+// with one reader-writer lock.  With the LRU eviction policy, each successful
+// 'tryGetValue' must move the accessed item to the back of the eviction queue
+// and therefore acquires the write lock, so that concurrent readers of a
+// 'bdlcc::Cache' are serialized.
+//
+// 'bdlcc::ShardedCache' differs in two respects:
+//
+//: o Items are distributed, by the hash value of their keys, over a number of
+//:   shards, each having its own reader-writer lock, hash table, and eviction
+//:   queue.  Operations on keys that map to different shards do not contend.
+//:
+//: o Eviction is CLOCK-based: each item holds a "referenced" flag that is set
+//:   by 'tryGetValue' while holding only a *read* lock on the item's shard.
+//:   When an item must be evicted, the shard's queue is scanned from the
+//:   front, and items having the flag set are given a second chance (their
+//:   flag is cleared and they are moved to the back of the queue) until an
+//:   item having the flag clear is found and evicted.
+//
+// Consequently, 'tryGetValue' never acquires a write lock, and the eviction
+// order only approximates LRU order.  In particular, 'popFront' removes the
+// next CLOCK victim of one of the shards, chosen in round-robin order, rather
+// than the globally least-recently used item.
+//
+///Size Limits
+///-----------
+// As with 'bdlcc::Cache', the cache size is controlled by a low watermark and
+// a high watermark.  Both watermarks are divided evenly (rounding up) among
+// the shards, and each shard evicts its items independently: eviction of
+// items in a shard starts when the size of that shard reaches its high
+// watermark and continues until the size of the shard is less than its low
+// watermark.  Therefore, the total size of the cache may momentarily exceed
+// 'highWatermark()' by less than 'numShards()' items, and eviction may start
+// before the total size reaches 'highWatermark()' if keys are not evenly
+// distributed over the shards.  The number of shards is rounded up to a power
+// of two, and should be kept well below 'lowWatermark()'.
+//
+///Admission Policy
+///----------------
+// Optionally, a cache can be configured with the TinyLFU admission policy
+// ('bdlcc::ShardedCacheAdmissionPolicy::e_TINY_LFU').  Each shard then
+// maintains a compact, approximate, and periodically aged count of the
+// accesses of each key hash.  Every 'insert' and every 'tryGetValue' that
+// misses is counted; a 'tryGetValue' that hits is counted only if it sets the
+// "referenced" flag of the item, so that repeated lookups of a hot item do not
+// write to shared memory.  When inserting a *new* key into a shard that is
+// full (i.e., the insertion would trigger eviction), the estimated access
+// frequency of the new key is compared with that of the CLOCK victim, and the
+// new item is admitted only if its key was accessed more frequently; otherwise
+// the cache is not modified.  This policy protects the frequently used items
+// from being flushed by scans or by one-off lookups.  Note that, when a new
+// item is rejected, the post-eviction callback is *not* invoked for it.  The
+// admission policy has no effect if the high watermark is not limited.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+///Thread Contention
+///-----------------
+// 'tryGetValue' acquires a read lock on a single shard, and modifier methods
+// acquire a write lock on a single shard, except 'clear' and
+// 'setPostEvictionCallback', which acquire the write lock of every shard in
+// turn.  'size' acquires, in turn, the read lock of every shard.
+//
+// The 'visit' method acquires, in turn, the read lock of each shard and calls
+// the supplied visitor for every item in that shard, until the visitor returns
+// 'false'.  The set of visited items is therefore not a consistent snapshot of
+// the whole cache.  As for 'bdlcc::Cache', the 'visit' method should be used
+// judiciously.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// When an item is evicted or erased from the cache, the previously set
+// post-eviction callback (via the 'setPostEvictionCallback' method) will be
+// invoked within the calling thread, supplying a pointer to the item being
+// removed.
+//
+// The cache object itself should not be used in a post-eviction callback;
+// otherwise, a deadlock may result.  Since a write lock on a shard is held
+// during the call to the callback, invoking any operation on the cache that
+// acquires a lock inside the callback may lead to a deadlock.
+//
+///Runtime Complexity
+///------------------
+//..
+// +----------------------------------------------------+--------------------+
+// | Operation                                          | Complexity         |
+// +====================================================+====================+
+// | insert                                             | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
+// +----------------------------------------------------+--------------------+
+// | tryGetValue                                        | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | popFront                                           | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
+// +----------------------------------------------------+--------------------+
+// | erase                                              | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | visit                                              | O[n]               |
+// +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows some basic usage of the sharded cache.  First, we define
+// a custom post-eviction callback function, 'myPostEvictionCallback', that
+// counts the evicted items:
+//..
+//  static int numEvicted = 0;
+//
+//  void myPostEvictionCallback(const bsl::shared_ptr<bsl::string>&)
+//  {
+//      ++numEvicted;
+//  }
+//..
+// Then, we define a 'bdlcc::ShardedCache' object, 'myCache', that maps 'int'
+// to 'bsl::string' using a single shard, so that the eviction order is easy
+// to follow, and that holds at most 4 items:
+//..
+//  bdlcc::ShardedCache<int, bsl::string> myCache(
+//                               3,
+//                               4,
+//                               1,
+//                               bdlcc::ShardedCacheAdmissionPolicy::e_ALWAYS,
+//                               &talloc);
+//  myCache.setPostEvictionCallback(&myPostEvictionCallback);
+//..
+// Next, we insert 4 items into the cache and access the first one, which sets
+// its "referenced" flag:
+//..
+//  myCache.insert(0, "Alex");
+//  myCache.insert(1, "John");
+//  myCache.insert(2, "Rob");
+//  myCache.insert(3, "Jim");
+//  assert(myCache.size() == 4);
+//
+//  bsl::shared_ptr<bsl::string> value;
+//  int rc = myCache.tryGetValue(&value, 0);
+//  assert(rc == 0);
+//  assert(*value == "Alex");
+//..
+// Now, we insert another item, which triggers eviction down to 2 items (below
+// the low watermark) before the new item is inserted:
+//..
+//  myCache.insert(4, "Jeff");
+//  assert(myCache.size()  == 3);
+//  assert(numEvicted      == 2);
+//..
+// Finally, we observe that "Alex" was given a second chance, and that "John"
+// and "Rob" were evicted instead:
+//..
+//  assert(0 == myCache.tryGetValue(&value, 0));
+//  assert(1 == myCache.tryGetValue(&value, 1));
+//  assert(1 == myCache.tryGetValue(&value, 2));
+//  assert(0 == myCache.tryGetValue(&value, 3));
+//  assert(0 == myCache.tryGetValue(&value, 4));
+//..
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_list.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // ==================================
+                     // struct ShardedCacheAdmissionPolicy
+                     // ==================================
+
+struct ShardedCacheAdmissionPolicy {
+    // This 'struct' provides a namespace for enumerating the admission
+    // policies supported by 'ShardedCache'.
+
+    // TYPES
+    enum Enum {
+        // Enumeration of supported cache admission policies.
+
+        e_ALWAYS,   // always admit new items
+        e_TINY_LFU  // admit a new item into a full shard only if it is
+                    // accessed more frequently than the eviction victim
+    };
+};
+
+                     // ==================================
+                     // class ShardedCache_FrequencySketch
+                     // ==================================
+
+class ShardedCache_FrequencySketch {
+    // This component-private class implements a thread-safe count-min sketch
+    // of 4-bit saturating counters estimating the access frequency of hash
+    // values.  All counters are halved once the number of recorded accesses
+    // reaches a sample size proportional to the expected number of distinct
+    // items, so that the estimates favor recent accesses.  Concurrent
+    // increments may be lost; this only lowers the accuracy of the estimates.
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_ROWS      = 4,   // number of hash functions
+
+        k_MIN_NUM_WORDS = 64,  // minimum number of words in the table
+
+        k_SAMPLE_RATIO  = 10   // number of accesses, per expected item,
+                               // between agings
+    };
+
+    // DATA
+    bsls::AtomicUint64 *d_table_p;     // counters, 16 per word
+
+    bsl::size_t         d_tableMask;   // number of words in 'd_table_p',
+                                       // less one
+
+    bsls::AtomicInt64   d_numAccesses; // accesses since last aging
+
+    bsls::Types::Int64  d_sampleSize;  // accesses between agings
+
+    bslma::Allocator   *d_allocator_p; // memory allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void age();
+        // Halve every counter in this sketch.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t indexOf(bsl::size_t hash, int row) const;
+        // Return the index of the counter, in the range
+        // '[0 .. 16 * (d_tableMask + 1))', corresponding to the specified
+        // 'hash' in the specified 'row'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_FrequencySketch(const ShardedCache_FrequencySketch&);
+    ShardedCache_FrequencySketch& operator=(
+                                          const ShardedCache_FrequencySketch&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache_FrequencySketch(
+                                     bsl::size_t       expectedNumItems,
+                                     bslma::Allocator *basicAllocator = 0);
+        // Create a frequency sketch sized for the specified
+        // 'expectedNumItems' distinct items.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~ShardedCache_FrequencySketch();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Reset every counter of this sketch to 0.
+
+    void increment(bsl::size_t hash);
+        // Record an access to the item having the specified 'hash'.
+
+    // ACCESSORS
+    int frequency(bsl::size_t hash) const;
+        // Return the estimated number, in the range '[0 .. 15]', of recent
+        // accesses to the item having the specified 'hash'.
+};
+
+                      // ===============================
+                      // class ShardedCache_QueueProctor
+                      // ===============================
+
+template <class KEY>
+class ShardedCache_QueueProctor {
+    // This component-private class implements a proctor that, on
+    // destruction, removes the last element of a queue unless 'release' has
+    // been called.
+
+    // DATA
+    bsl::list<KEY> *d_queue_p;  // queue (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_QueueProctor(const ShardedCache_QueueProctor&);
+    ShardedCache_QueueProctor& operator=(const ShardedCache_QueueProctor&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache_QueueProctor(bsl::list<KEY> *queue);
+        // Create a proctor guarding the last element of the specified
+        // 'queue'.
+
+    ~ShardedCache_QueueProctor();
+        // Destroy this proctor, removing the last element of the guarded
+        // queue unless 'release' has been called.
+
+    // MANIPULATORS
+    void release();
+        // Release the guarded queue, so that it will not be modified on the
+        // destruction of this proctor.
+};
+
+                         // ========================
+                         // class ShardedCache_Shard
+                         // ========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class ShardedCache_Shard {
+    // This component-private class holds the state of one shard of a
+    // 'ShardedCache': a reader-writer lock, the hash table of the items, the
+    // CLOCK eviction queue, and the optional frequency sketch.  The lock is
+    // placed on its own cache line to avoid false sharing between shards.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                  ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::list<KEY>                          QueueType;
+        // Eviction queue type.
+
+    class MapValue {
+        // This class holds the value of an item, the position of its key in
+        // the eviction queue, and its CLOCK "referenced" flag.
+
+      public:
+        // PUBLIC DATA
+        ValuePtrType                  d_value;       // cached value
+
+        typename QueueType::iterator  d_queueIt;     // position in queue
+
+        mutable bsls::AtomicBool      d_referenced;  // CLOCK flag, set on
+                                                     // access under a read
+                                                     // lock
+
+        // CREATORS
+        MapValue(const ValuePtrType&                 value,
+                 const typename QueueType::iterator& queueIt);
+            // Create a 'MapValue' having the specified 'value' and 'queueIt',
+            // and a clear "referenced" flag.
+
+        MapValue(const MapValue& original);
+            // Create a 'MapValue' having the same value as the specified
+            // 'original'.
+    };
+
+    typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL> MapType;
+        // Hash map type.
+
+    typedef bslmt::ReaderWriterMutex                       LockType;
+
+    // PUBLIC DATA
+    mutable LockType                              d_lock;      // shard lock
+
+    char                                          d_lockPad[
+                                        bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                         sizeof(LockType) %
+                                        bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                               // padding
+
+    MapType                                       d_map;       // items
+
+    QueueType                                     d_queue;     // CLOCK
+                                                               // queue; the
+                                                               // hand is at
+                                                               // the front
+
+    bslma::ManagedPtr<ShardedCache_FrequencySketch>
+                                                  d_sketch;    // access
+                                                               // frequencies,
+                                                               // or empty
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Shard(const ShardedCache_Shard&);
+    ShardedCache_Shard& operator=(const ShardedCache_Shard&);
+
+  public:
+    // CREATORS
+    ShardedCache_Shard(const HASH&       hashFunction,
+                       const EQUAL&      equalFunction,
+                       bsl::size_t       sketchSize,
+                       bslma::Allocator *basicAllocator);
+        // Create an empty shard using the specified 'hashFunction' and
+        // 'equalFunction'.  If the specified 'sketchSize' is not 0, create a
+        // frequency sketch for 'sketchSize' items.  Use the specified
+        // 'basicAllocator' to supply memory.
+
+    // MANIPULATORS
+    typename MapType::iterator nextVictim();
+        // Advance the CLOCK hand of this shard, giving a second chance to
+        // each item having its "referenced" flag set, and return an iterator
+        // to the first item having the flag clear.  The behavior is undefined
+        // unless this shard is not empty and is locked for writing.
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store partitioned into
+    // independently locked shards, using CLOCK eviction and, optionally,
+    // TinyLFU admission.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                   ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef bsl::pair<KEY, ValuePtrType>             KVType;
+        // Value type of a bulk insert entry.
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL> Shard;
+    typedef typename Shard::MapType                     MapType;
+    typedef typename Shard::MapValue                    MapValue;
+    typedef typename Shard::QueueType                   QueueType;
+    typedef typename Shard::LockType                    LockType;
+
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16   // number of shards if unspecified
+    };
+
+    // DATA
+    bslma::Allocator                   *d_allocator_p;   // memory allocator
+                                                         // (held, not owned)
+
+    HASH                                d_hashFunction;  // key hash
+
+    EQUAL                               d_equalFunction; // key equality
+
+    bsl::vector<bsl::shared_ptr<Shard> > d_shards;       // shards
+
+    bsl::size_t                         d_shardMask;     // number of shards,
+                                                         // less one
+
+    bsl::size_t                         d_lowWatermark;  // total low
+                                                         // watermark
+
+    bsl::size_t                         d_highWatermark; // total high
+                                                         // watermark
+
+    bsl::size_t                         d_shardLowWatermark;
+                                                         // per-shard low
+                                                         // watermark
+
+    bsl::size_t                         d_shardHighWatermark;
+                                                         // per-shard high
+                                                         // watermark
+
+    ShardedCacheAdmissionPolicy::Enum   d_admissionPolicy;
+                                                         // admission policy
+
+    bsls::AtomicUint                    d_nextPopShard;  // round-robin index
+                                                         // for 'popFront'
+
+    PostEvictionCallback                d_postEvictionCallback;
+                                                         // the function to
+                                                         // call after a value
+                                                         // has been evicted
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t mixHash(bsl::size_t hash);
+        // Return a well-distributed transformation of the specified 'hash'.
+
+    // PRIVATE MANIPULATORS
+    void enforceHighWatermark(Shard *shard);
+        // Evict items from the specified 'shard' if its size is at least the
+        // per-shard high watermark, until its size is less than the per-shard
+        // low watermark.  Invoke the post-eviction callback for each item
+        // evicted.  The behavior is undefined unless 'shard' is locked for
+        // writing.
+
+    void evictItem(Shard *shard, const typename MapType::iterator& mapIt);
+        // Evict the item at the specified 'mapIt' from the specified 'shard'
+        // and invoke the post-eviction callback for that item.
+
+    void init(bsl::size_t numShards);
+        // Create the specified 'numShards' shards (rounded up to a power of
+        // two), and compute the per-shard watermarks.
+
+    bool insertValuePtrMoveImp(KEY          *key_p,
+                               bool          moveKey,
+                               ValuePtrType *valuePtr_p,
+                               bool          moveValuePtr);
+        // Add a node with the specified '*key_p' and the specified
+        // '*valuePtr_p' to the cache.  If an entry already exists for
+        // '*key_p', override its value with '*valuePtr_p'.  If the specified
+        // 'moveKey' is 'true', move '*key_p', and if the specified
+        // 'moveValuePtr' is 'true', move '*valuePtr_p'.  Return 'true' if
+        // '*key_p' was not previously in the cache and was admitted, and
+        // 'false' otherwise.
+
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::false_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::false_type);
+        // Allocate a footprint for the specified 'value', copy or move 'value'
+        // into the footprint and load the specified '*dst' with a pointer to
+        // the value.
+
+    // PRIVATE ACCESSORS
+    Shard& shardFor(bsl::size_t hash) const;
+        // Return a reference to the shard holding the keys having the
+        // specified (mixed) 'hash'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShardedCache, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty cache having no size limit, a default number of
+        // shards, and the 'e_ALWAYS' admission policy.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ShardedCache(bsl::size_t       lowWatermark,
+                 bsl::size_t       highWatermark,
+                 bslma::Allocator *basicAllocator = 0);
+        // Create an empty cache using the specified 'lowWatermark' and
+        // 'highWatermark', a default number of shards, and the 'e_ALWAYS'
+        // admission policy.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark' and '1 <= lowWatermark'.
+
+    ShardedCache(bsl::size_t                        lowWatermark,
+                 bsl::size_t                        highWatermark,
+                 bsl::size_t                        numShards,
+                 ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                 bslma::Allocator                  *basicAllocator = 0);
+    ShardedCache(bsl::size_t                        lowWatermark,
+                 bsl::size_t                        highWatermark,
+                 bsl::size_t                        numShards,
+                 ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                 const HASH&                        hashFunction,
+                 const EQUAL&                       equalFunction,
+                 bslma::Allocator                  *basicAllocator = 0);
+        // Create an empty cache using the specified 'lowWatermark',
+        // 'highWatermark', 'numShards' (rounded up to a power of two), and
+        // 'admissionPolicy'.  Optionally specify a 'hashFunction' used to
+        // generate the hash values for a given key, and an 'equalFunction'
+        // used to determine whether two keys have the same value.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= numShards'.
+
+    //! ~ShardedCache() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Insert the specified 'key' and its associated 'value' into this
+        // cache, subject to the admission policy.  If 'key' already exists,
+        // then its value will be replaced with 'value'.  Note that all the
+        // methods that take moved objects provide the 'basic' but not the
+        // 'strong' exception guarantee.  Also note that 'key' must be
+        // copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache, subject to the admission policy.  If 'key' already exists,
+        // then its value will be replaced with 'valuePtr'.  Note that 'key'
+        // must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache, subject to the admission policy.  If a key already exists,
+        // then its value will be replaced with the value.  Return the number
+        // of new items inserted.
+
+    int popFront();
+        // Remove the next CLOCK eviction victim of the first non-empty shard,
+        // in round-robin order.  Invoke the post-eviction callback for the
+        // removed item.  Return 0 on success, and 1 if this cache is empty.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true', mark the item as referenced, so
+        // that it survives the next CLOCK sweep, and record the access for
+        // the admission policy (see {Admission Policy}).  Return 0 on
+        // success, and 1 if 'key' does not exist in this cache.  Note that
+        // only a read lock is acquired.
+
+    // ACCESSORS
+    ShardedCacheAdmissionPolicy::Enum admissionPolicy() const;
+        // Return the admission policy used by this cache.
+
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache.
+
+    bsl::size_t numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // shard by shard and in the order of each shard's eviction queue,
+        // until 'visitor' returns 'false'.  The 'VISITOR' type must be a
+        // callable object that can be invoked in the same way as the function
+        // 'bool (const KEY&, const VALUE&)'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this cache to supply memory.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class ShardedCache_QueueProctor
+                      // -------------------------------
+
+// CREATORS
+template <class KEY>
+inline
+ShardedCache_QueueProctor<KEY>::ShardedCache_QueueProctor(
+                                                         bsl::list<KEY> *queue)
+: d_queue_p(queue)
+{
+}
+
+template <class KEY>
+inline
+ShardedCache_QueueProctor<KEY>::~ShardedCache_QueueProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->pop_back();
+    }
+}
+
+// MANIPULATORS
+template <class KEY>
+inline
+void ShardedCache_QueueProctor<KEY>::release()
+{
+    d_queue_p = 0;
+}
+
+                     // ----------------------------------
+                     // class ShardedCache_Shard::MapValue
+                     // ----------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::MapValue::MapValue(
+                                   const ValuePtrType&                 value,
+                                   const typename QueueType::iterator& queueIt)
+: d_value(value)
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::MapValue::MapValue(
+                                                      const MapValue& original)
+: d_value(original.d_value)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+                         // ------------------------
+                         // class ShardedCache_Shard
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                                           const HASH&       hashFunction,
+                                           const EQUAL&      equalFunction,
+                                           bsl::size_t       sketchSize,
+                                           bslma::Allocator *basicAllocator)
+: d_lock()
+, d_map(0, hashFunction, equalFunction, basicAllocator)
+, d_queue(basicAllocator)
+, d_sketch()
+{
+    if (sketchSize) {
+        d_sketch.load(new (*basicAllocator) ShardedCache_FrequencySketch(
+                                                              sketchSize,
+                                                              basicAllocator),
+                      basicAllocator);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::nextVictim()
+{
+    BSLS_ASSERT(!d_queue.empty());
+
+    // Each iteration either returns or clears a flag, so at most
+    // 'd_queue.size() + 1' iterations are performed.
+
+    while (true) {
+        typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (!mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+
+        mapIt->second.d_referenced.storeRelaxed(false);
+        d_queue.splice(d_queue.end(), d_queue, d_queue.begin());
+    }
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::mixHash(bsl::size_t hash)
+{
+    // Finalizer of MurmurHash3, applied to the (possibly identity) user hash
+    // so that shard selection and the frequency sketch see well-distributed
+    // bits.
+
+    bsls::Types::Uint64 h = hash;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<bsl::size_t>(h);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark(Shard *shard)
+{
+    if (shard->d_map.size() < d_shardHighWatermark) {
+        return;                                                       // RETURN
+    }
+
+    while (shard->d_map.size() >= d_shardLowWatermark &&
+           shard->d_map.size() > 0) {
+        evictItem(shard, shard->nextVictim());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::evictItem(
+                                      Shard                             *shard,
+                                      const typename MapType::iterator&  mapIt)
+{
+    ValuePtrType value = mapIt->second.d_value;
+
+    shard->d_queue.erase(mapIt->second.d_queueIt);
+    shard->d_map.erase(mapIt);
+
+    if (d_postEvictionCallback) {
+        d_postEvictionCallback(value);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::init(bsl::size_t numShards)
+{
+    BSLS_REVIEW(d_lowWatermark <= d_highWatermark);
+    BSLS_REVIEW(1 <= d_lowWatermark);
+    BSLS_ASSERT(1 <= numShards);
+
+    bsl::size_t n = 1;
+    while (n < numShards) {
+        n <<= 1;
+    }
+    d_shardMask = n - 1;
+
+    const bsl::size_t unlimited = bsl::numeric_limits<bsl::size_t>::max();
+
+    d_shardLowWatermark  = d_lowWatermark == unlimited
+                         ? unlimited
+                         : (d_lowWatermark + n - 1) / n;
+    d_shardHighWatermark = d_highWatermark == unlimited
+                         ? unlimited
+                         : (d_highWatermark + n - 1) / n;
+
+    const bsl::size_t sketchSize =
+                 ShardedCacheAdmissionPolicy::e_TINY_LFU == d_admissionPolicy
+              && d_shardHighWatermark != unlimited
+                 ? d_shardHighWatermark
+                 : 0;
+
+    d_shards.reserve(n);
+    for (bsl::size_t i = 0; i < n; ++i) {
+        bsl::shared_ptr<Shard> shard;
+        shard.createInplace(d_allocator_p,
+                            d_hashFunction,
+                            d_equalFunction,
+                            sketchSize,
+                            d_allocator_p);
+        d_shards.push_back(shard);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ShardedCache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
+                                                    KEY          *key_p,
+                                                    bool          moveKey,
+                                                    ValuePtrType *valuePtr_p,
+                                                    bool          moveValuePtr)
+{
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    enum { k_RVALUE_ASSIGN = true };
+#else
+    enum { k_RVALUE_ASSIGN = false };
+#endif
+
+    KEY&          key      = *key_p;
+    ValuePtrType& valuePtr = *valuePtr_p;
+
+    const bsl::size_t hash  = mixHash(d_hashFunction(key));
+    Shard&            shard = shardFor(hash);
+
+    bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+    if (shard.d_sketch) {
+        shard.d_sketch->increment(hash);
+    }
+
+    typename MapType::iterator mapIt = shard.d_map.find(key);
+    if (mapIt != shard.d_map.end()) {
+        if (k_RVALUE_ASSIGN && moveValuePtr) {
+            mapIt->second.d_value = bslmf::MovableRefUtil::move(valuePtr);
+        }
+        else {
+            mapIt->second.d_value = valuePtr;
+        }
+        mapIt->second.d_referenced.storeRelaxed(true);
+
+        return false;                                                 // RETURN
+    }
+
+    if (shard.d_sketch && shard.d_map.size() >= d_shardHighWatermark) {
+        typename MapType::iterator victimIt = shard.nextVictim();
+        const bsl::size_t victimHash =
+                                  mixHash(d_hashFunction(victimIt->first));
+
+        if (shard.d_sketch->frequency(hash) <=
+                                      shard.d_sketch->frequency(victimHash)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    enforceHighWatermark(&shard);
+
+    shard.d_queue.push_back(key);
+    typename QueueType::iterator queueIt = shard.d_queue.end();
+    --queueIt;
+
+    ShardedCache_QueueProctor<KEY> proctor(&shard.d_queue);
+
+    if (moveKey) {
+        shard.d_map.emplace(bslmf::MovableRefUtil::move(key),
+                            MapValue(valuePtr, queueIt));
+    }
+    else {
+        shard.d_map.emplace(key, MapValue(valuePtr, queueIt));
+    }
+
+    proctor.release();
+
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                       ValuePtrType *dst,
+                                                       const VALUE&  value,
+                                                       bsl::true_type)
+{
+    dst->createInplace(d_allocator_p, value, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                       ValuePtrType *dst,
+                                                       const VALUE&  value,
+                                                       bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::true_type)
+{
+    dst->createInplace(d_allocator_p,
+                       bslmf::MovableRefUtil::move(value),
+                       d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, bslmf::MovableRefUtil::move(value));
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardFor(bsl::size_t hash) const
+{
+    return *d_shards[hash & d_shardMask];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction()
+, d_equalFunction()
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_shardLowWatermark(0)
+, d_shardHighWatermark(0)
+, d_admissionPolicy(ShardedCacheAdmissionPolicy::e_ALWAYS)
+, d_nextPopShard(0)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    init(k_DEFAULT_NUM_SHARDS);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bsl::size_t       lowWatermark,
+                                              bsl::size_t       highWatermark,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction()
+, d_equalFunction()
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_shardLowWatermark(0)
+, d_shardHighWatermark(0)
+, d_admissionPolicy(ShardedCacheAdmissionPolicy::e_ALWAYS)
+, d_nextPopShard(0)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    init(k_DEFAULT_NUM_SHARDS);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                          bsl::size_t                        lowWatermark,
+                          bsl::size_t                        highWatermark,
+                          bsl::size_t                        numShards,
+                          ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                          bslma::Allocator                  *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction()
+, d_equalFunction()
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_shardLowWatermark(0)
+, d_shardHighWatermark(0)
+, d_admissionPolicy(admissionPolicy)
+, d_nextPopShard(0)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    init(numShards);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                          bsl::size_t                        lowWatermark,
+                          bsl::size_t                        highWatermark,
+                          bsl::size_t                        numShards,
+                          ShardedCacheAdmissionPolicy::Enum  admissionPolicy,
+                          const HASH&                        hashFunction,
+                          const EQUAL&                       equalFunction,
+                          bslma::Allocator                  *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hashFunction(hashFunction)
+, d_equalFunction(equalFunction)
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_shardLowWatermark(0)
+, d_shardHighWatermark(0)
+, d_admissionPolicy(admissionPolicy)
+, d_nextPopShard(0)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    init(numShards);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard&                          shard = *d_shards[i];
+        bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+        shard.d_map.clear();
+        shard.d_queue.clear();
+        if (shard.d_sketch) {
+            shard.d_sketch->clear();
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    Shard& shard = shardFor(mixHash(d_hashFunction(key)));
+
+    bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+    const typename MapType::iterator mapIt = shard.d_map.find(key);
+    if (mapIt == shard.d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictItem(&shard, mapIt);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        count += 0 == erase(keys[i]);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    KEY          *key_p = const_cast<KEY *>(&key);
+    ValuePtrType  valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+                                                                 // might throw
+
+    insertValuePtrMoveImp(key_p, false, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              const KEY&               key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    KEY          *key_p = const_cast<KEY *>(&key);
+    ValuePtrType  valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+                                    // might throw, but BEFORE 'value' is moved
+
+    insertValuePtrMoveImp(key_p, false, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<KEY> key,
+                                                const VALUE&           value)
+{
+    KEY& localKey = key;
+
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+                                                                 // might throw
+
+    insertValuePtrMoveImp(&localKey, true, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+                                    // might throw, but BEFORE 'value' is moved
+
+    insertValuePtrMoveImp(&localKey, true, &valuePtr, true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    KEY          *key_p      = const_cast<KEY *>(&key);
+    ValuePtrType *valuePtr_p = const_cast<ValuePtrType *>(&valuePtr);
+
+    insertValuePtrMoveImp(key_p, false, valuePtr_p, false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    KEY&          localKey   = key;
+    ValuePtrType *valuePtr_p = const_cast<ValuePtrType *>(&valuePtr);
+
+    insertValuePtrMoveImp(&localKey, true, valuePtr_p, false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        KEY          *key_p      = const_cast<KEY *>(         &data[i].first);
+        ValuePtrType *valuePtr_p = const_cast<ValuePtrType *>(&data[i].second);
+
+        count += insertValuePtrMoveImp(key_p, false, valuePtr_p, false);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    const bsl::size_t start = d_nextPopShard.addRelaxed(1);
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard& shard = *d_shards[(start + i) & d_shardMask];
+
+        bslmt::WriteLockGuard<LockType> guard(&shard.d_lock);
+
+        if (!shard.d_map.empty()) {
+            evictItem(&shard, shard.nextVictim());
+            return 0;                                                 // RETURN
+        }
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    // Evictions read the callback while holding the write lock of a shard, so
+    // holding every shard lock excludes all of them.
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->d_lock.lockWrite();
+    }
+
+    d_postEvictionCallback = postEvictionCallback;
+
+    for (bsl::size_t i = d_shards.size(); i > 0; --i) {
+        d_shards[i - 1]->d_lock.unlock();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    const bsl::size_t hash  = mixHash(d_hashFunction(key));
+    Shard&            shard = shardFor(hash);
+
+    bslmt::ReadLockGuard<LockType> guard(&shard.d_lock);
+
+    typename MapType::const_iterator mapIt = shard.d_map.find(key);
+    if (mapIt == shard.d_map.end()) {
+        if (modifyEvictionQueue && shard.d_sketch) {
+            shard.d_sketch->increment(hash);
+        }
+        return 1;                                                     // RETURN
+    }
+
+    *value = mapIt->second.d_value;
+
+    // Write to the shared cache lines of the item and of the sketch only if
+    // the flag is not already set, so that repeated hits on a hot item are
+    // read-only.
+
+    if (modifyEvictionQueue && !mapIt->second.d_referenced.loadRelaxed()) {
+        mapIt->second.d_referenced.storeRelaxed(true);
+        if (shard.d_sketch) {
+            shard.d_sketch->increment(hash);
+        }
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCacheAdmissionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::admissionPolicy() const
+{
+    return d_admissionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_equalFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        bslmt::ReadLockGuard<LockType> guard(&d_shards[i]->d_lock);
+        result += d_shards[i]->d_map.size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const Shard&                   shard = *d_shards[i];
+        bslmt::ReadLockGuard<LockType> guard(&shard.d_lock);
+
+        for (typename QueueType::const_iterator queueIt =
+                                                        shard.d_queue.begin();
+             queueIt != shard.d_queue.end();
+             ++queueIt) {
+            const KEY&                             key   = *queueIt;
+            const typename MapType::const_iterator mapIt =
+                                                         shard.d_map.find(key);
+            BSLS_ASSERT(mapIt != shard.d_map.end());
+
+            if (!visitor(key, *mapIt->second.d_value)) {
+                return;                                               // RETURN
+            }
+        }
+    }
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *ShardedCache<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
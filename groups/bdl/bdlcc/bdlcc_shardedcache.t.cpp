@@ -0,0 +1,1337 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// provides an in-memory key-value cache partitioned into independently locked
+// shards, using CLOCK eviction and optional TinyLFU admission.  The
+// component-private class 'bdlcc::ShardedCache_FrequencySketch', which
+// implements the frequency estimates used by the admission policy, is tested
+// first and independently.
+//
+// Since keys are distributed over the shards by hash value, the tests
+// verifying the eviction order use a single shard.  Thread-safety is achieved
+// using one reader-writer lock per shard, so a concurrent stress test with
+// invariant checks is sufficient.
+//
+// In addition to positive test cases, a negative test case -1 compares the
+// read-mostly throughput of this cache with that of 'bdlcc::Cache'.
+// ----------------------------------------------------------------------------
+// ShardedCache_FrequencySketch
+// [ 2] ShardedCache_FrequencySketch(bsl::size_t, Allocator *ba = 0);
+// [ 2] ~ShardedCache_FrequencySketch();
+// [ 2] void clear();
+// [ 2] void increment(bsl::size_t hash);
+// [ 2] int frequency(bsl::size_t hash) const;
+//
+// ShardedCache
+// [ 3] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 3] ShardedCache(lowWatermark, highWatermark, basicAllocator);
+// [ 3] ShardedCache(low, high, numShards, admissionPolicy, alloc);
+// [ 3] ShardedCache(low, high, numShards, policy, hash, equal, alloc);
+// [ 4] void insert(const KEY& key, const VALUE& value);
+// [ 4] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 4] void insert(MovableRef<KEY> key, const VALUE& value);
+// [ 4] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 4] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 4] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 4] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] int tryGetValue(value, key, modifyEvictionQueue);
+// [ 4] int erase(const KEY& key);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 4] void clear();
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 5] int popFront();
+// [ 3] ShardedCacheAdmissionPolicy::Enum admissionPolicy() const;
+// [ 3] EQUAL equalFunction() const;
+// [ 3] HASH hashFunction() const;
+// [ 3] bsl::size_t highWatermark() const;
+// [ 3] bsl::size_t lowWatermark() const;
+// [ 3] bsl::size_t numShards() const;
+// [ 4] bsl::size_t size() const;
+// [ 4] void visit(VISITOR& visitor) const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CLOCK EVICTION
+// [ 6] TINYLFU ADMISSION
+// [ 7] THREAD SAFETY
+// [ 8] USAGE EXAMPLE
+// [-1] READ-MOSTLY THROUGHPUT COMPARISON WITH 'bdlcc::Cache'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::ShardedCache<int, bsl::string> Obj;
+typedef bdlcc::ShardedCache_FrequencySketch   Sketch;
+typedef bdlcc::ShardedCacheAdmissionPolicy    Policy;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct ModuloHash {
+    // This 'struct' provides a hash functor returning its 'int' argument
+    // modulo a non-zero 'd_modulus'.
+
+    int d_modulus;
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' modulo 'd_modulus'.
+    {
+        return static_cast<bsl::size_t>(key % d_modulus);
+    }
+};
+
+struct ModuloEqual {
+    // This 'struct' provides an equality functor comparing 'int' keys modulo
+    // a non-zero 'd_modulus'.
+
+    int d_modulus;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal modulo
+        // 'd_modulus', and 'false' otherwise.
+    {
+        return lhs % d_modulus == rhs % d_modulus;
+    }
+};
+
+class EvictionRecorder {
+    // This class records the values for which the post-eviction callback of a
+    // cache is invoked.
+
+    // DATA
+    bsl::vector<bsl::string> d_evicted;  // evicted values, in order
+
+  public:
+    // CREATORS
+    explicit EvictionRecorder(bslma::Allocator *basicAllocator)
+    : d_evicted(basicAllocator)
+        // Create an empty recorder using the specified 'basicAllocator'.
+    {
+    }
+
+    // MANIPULATORS
+    void record(const bsl::shared_ptr<bsl::string>& value)
+        // Append the specified 'value' to the recorded values.
+    {
+        d_evicted.push_back(*value);
+    }
+
+    // ACCESSORS
+    const bsl::vector<bsl::string>& evicted() const
+        // Return the recorded values.
+    {
+        return d_evicted;
+    }
+};
+
+struct KeyCollector {
+    // This 'struct' provides a visitor that collects the visited keys until
+    // 'd_limit' keys have been collected.
+
+    bsl::vector<int> d_keys;   // visited keys
+    bsl::size_t      d_limit;  // maximum number of keys to visit
+
+    explicit KeyCollector(bsl::size_t limit, bslma::Allocator *basicAllocator)
+    : d_keys(basicAllocator)
+    , d_limit(limit)
+        // Create a collector visiting at most the specified 'limit' keys, and
+        // using the specified 'basicAllocator'.
+    {
+    }
+
+    bool operator()(int key, const bsl::string&)
+        // Record the specified 'key' and return 'true' if fewer than 'd_limit'
+        // keys have been recorded, and 'false' otherwise.
+    {
+        d_keys.push_back(key);
+        return d_keys.size() < d_limit;
+    }
+};
+
+bsl::string makeValue(int key, bslma::Allocator *basicAllocator = 0)
+    // Return a string, long enough to allocate memory, computed from the
+    // specified 'key'.  Optionally specify a 'basicAllocator' used to supply
+    // memory.  If 'basicAllocator' is 0, the currently installed default
+    // allocator is used.
+{
+    bsl::string result("value of a moderately long cache item: ",
+                       basicAllocator);
+    result += static_cast<char>('a' + key % 26);
+    return result;
+}
+
+struct StressTest {
+    // This 'struct' holds the state and the thread functions of the thread
+    // safety test.
+
+    Obj              *d_cache_p;     // cache under test
+    bslma::Allocator *d_allocator_p; // allocator for temporaries
+    int               d_numKeys;     // key range
+    int               d_numIters;    // number of operations per thread
+    bsls::AtomicInt   d_numErrors;   // number of wrong values observed
+    bsls::AtomicInt   d_numEvicted;  // number of post-eviction callbacks
+
+    void onEvict(const bsl::shared_ptr<bsl::string>&)
+        // Count an eviction.
+    {
+        ++d_numEvicted;
+    }
+
+    void reader(int seed)
+        // Repeatedly look up keys, seeded by the specified 'seed', and check
+        // the consistency of the found values.
+    {
+        unsigned int                 state = seed * 7919 + 1;
+        bsl::shared_ptr<bsl::string> value;
+        for (int i = 0; i < d_numIters; ++i) {
+            state = state * 1103515245 + 12345;
+            const int key = static_cast<int>((state >> 8) % d_numKeys);
+            if (0 == d_cache_p->tryGetValue(&value, key) &&
+                                  *value != makeValue(key, d_allocator_p)) {
+                ++d_numErrors;
+            }
+        }
+    }
+
+    void writer(int seed)
+        // Repeatedly insert, erase, and pop keys, seeded by the specified
+        // 'seed'.
+    {
+        unsigned int state = seed * 104729 + 1;
+        for (int i = 0; i < d_numIters; ++i) {
+            state = state * 1103515245 + 12345;
+            const int key = static_cast<int>((state >> 8) % d_numKeys);
+            switch ((state >> 4) % 8) {
+              case 0: {
+                d_cache_p->erase(key);
+              } break;
+              case 1: {
+                d_cache_p->popFront();
+              } break;
+              default: {
+                d_cache_p->insert(key, makeValue(key, d_allocator_p));
+              } break;
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+                           // ======================
+                           // namespace PERFORMANCE
+                           // ======================
+
+namespace PERFORMANCE {
+
+template <class CACHE>
+struct Reader {
+    // This 'struct' provides the run function of a benchmark thread that
+    // looks up keys in a cache of (template parameter) type 'CACHE'.
+
+    static void run(CACHE *cache, int numKeys, int batchSize, int threadIndex)
+        // Look up the specified 'batchSize' pseudo-random keys in the range
+        // '[0 .. numKeys)' in the specified 'cache', using the specified
+        // 'threadIndex' to vary the sequence of keys.
+    {
+        static bsls::AtomicUint         s_seed(1);
+        unsigned int                    state = s_seed.addRelaxed(
+                                                   2654435761u + threadIndex);
+        bsl::shared_ptr<bsl::string>    value;
+        for (int i = 0; i < batchSize; ++i) {
+            state = state * 1103515245 + 12345;
+            cache->tryGetValue(&value,
+                               static_cast<int>((state >> 8) % numKeys));
+        }
+    }
+};
+
+template <class CACHE>
+struct Writer {
+    // This 'struct' provides the run function of a benchmark thread that
+    // inserts keys into a cache of (template parameter) type 'CACHE'.
+
+    static void run(CACHE *cache, int numKeys, int batchSize, int threadIndex)
+        // Insert the specified 'batchSize' pseudo-random keys in the range
+        // '[0 .. numKeys)' into the specified 'cache', using the specified
+        // 'threadIndex' to vary the sequence of keys.
+    {
+        unsigned int state = 7 + threadIndex;
+        for (int i = 0; i < batchSize; ++i) {
+            state = state * 1103515245 + 12345;
+            const int key = static_cast<int>((state >> 8) % numKeys);
+            cache->insert(key, makeValue(key));
+        }
+    }
+};
+
+template <class CACHE>
+void runBenchmark(const char *name,
+                  CACHE      *cache,
+                  int         numKeys,
+                  int         numReaders,
+                  int         numWriters,
+                  int         millisecondsPerSample,
+                  int         numSamples)
+    // Populate the specified 'cache' with the specified 'numKeys' keys, then
+    // run a throughput benchmark having the specified 'numReaders' and
+    // 'numWriters' threads, for the specified 'numSamples' samples of the
+    // specified 'millisecondsPerSample' duration, and print a CSV line
+    // labeled with the specified 'name' holding the median lookup
+    // throughput.
+{
+    const int k_BATCH_SIZE = 1000;
+
+    for (int key = 0; key < numKeys; ++key) {
+        cache->insert(key, makeValue(key));
+    }
+
+    bslmt::ThroughputBenchmark       benchmark;
+    bslmt::ThroughputBenchmarkResult result;
+
+    benchmark.addThreadGroup(bdlf::BindUtil::bind(&Reader<CACHE>::run,
+                                                  cache,
+                                                  numKeys,
+                                                  k_BATCH_SIZE,
+                                                  bdlf::PlaceHolders::_1),
+                             numReaders,
+                             0);
+    if (numWriters) {
+        benchmark.addThreadGroup(bdlf::BindUtil::bind(&Writer<CACHE>::run,
+                                                      cache,
+                                                      numKeys,
+                                                      k_BATCH_SIZE / 10,
+                                                      bdlf::PlaceHolders::_1),
+                                 numWriters,
+                                 0);
+    }
+
+    benchmark.execute(&result, millisecondsPerSample, numSamples);
+
+    double median;
+    result.getMedian(&median, 0);
+
+    cout << name        << ","
+         << numReaders  << ","
+         << numWriters  << ","
+         << numKeys     << ","
+         << fixed << setprecision(0) << median * k_BATCH_SIZE
+         << endl;
+}
+
+}  // close namespace PERFORMANCE
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows some basic usage of the sharded cache.  First, we define
+// a custom post-eviction callback function, 'myPostEvictionCallback', that
+// counts the evicted items:
+//..
+    static int numEvicted = 0;
+
+    void myPostEvictionCallback(const bsl::shared_ptr<bsl::string>&)
+    {
+        ++numEvicted;
+    }
+//..
+
+void example1(bslma::Allocator *allocator)
+    // Run the usage example using the specified 'allocator'.
+{
+    bslma::Allocator& talloc = *allocator;
+
+// Then, we define a 'bdlcc::ShardedCache' object, 'myCache', that maps 'int'
+// to 'bsl::string' using a single shard, so that the eviction order is easy
+// to follow, and that holds at most 4 items:
+//..
+    bdlcc::ShardedCache<int, bsl::string> myCache(
+                                 3,
+                                 4,
+                                 1,
+                                 bdlcc::ShardedCacheAdmissionPolicy::e_ALWAYS,
+                                 &talloc);
+    myCache.setPostEvictionCallback(&myPostEvictionCallback);
+//..
+// Next, we insert 4 items into the cache and access the first one, which sets
+// its "referenced" flag:
+//..
+    myCache.insert(0, "Alex");
+    myCache.insert(1, "John");
+    myCache.insert(2, "Rob");
+    myCache.insert(3, "Jim");
+    ASSERT(myCache.size() == 4);
+
+    bsl::shared_ptr<bsl::string> value;
+    int rc = myCache.tryGetValue(&value, 0);
+    ASSERT(rc == 0);
+    ASSERT(*value == "Alex");
+//..
+// Now, we insert another item, which triggers eviction down to 2 items (below
+// the low watermark) before the new item is inserted:
+//..
+    myCache.insert(4, "Jeff");
+    ASSERT(myCache.size()  == 3);
+    ASSERT(numEvicted      == 2);
+//..
+// Finally, we observe that "Alex" was given a second chance, and that "John"
+// and "Rob" were evicted instead:
+//..
+    ASSERT(0 == myCache.tryGetValue(&value, 0));
+    ASSERT(1 == myCache.tryGetValue(&value, 1));
+    ASSERT(1 == myCache.tryGetValue(&value, 2));
+    ASSERT(0 == myCache.tryGetValue(&value, 3));
+    ASSERT(0 == myCache.tryGetValue(&value, 4));
+//..
+}
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("usage", veryVeryVerbose);
+
+        USAGE_EXAMPLE::example1(&ta);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent lookups, insertions, erasures, and pops on a sharded
+        //:   cache do not corrupt it, and lookups return the values that were
+        //:   inserted.
+        //:
+        //: 2 The per-shard watermarks bound the size of the cache.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Run reader and writer threads over a small key range on caches
+        //:   with and without the TinyLFU admission policy, and verify that
+        //:   no wrong value is observed.  (C-1)
+        //:
+        //: 2 Verify the size bound after the threads are joined, and that
+        //:   'visit' and 'size' agree.  (C-2)
+        //:
+        //: 3 Use a test allocator, and verify that all memory is released.
+        //:   (C-3)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        const int NUM_READERS = 6;
+        const int NUM_WRITERS = 3;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const Policy::Enum POLICY = ti ? Policy::e_TINY_LFU
+                                           : Policy::e_ALWAYS;
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(200, 256, 8, POLICY, &ta);
+
+                StressTest st;
+                st.d_cache_p     = &mX;
+                st.d_allocator_p = &ta;
+                st.d_numKeys     = 1000;
+                st.d_numIters    = 20000;
+
+                mX.setPostEvictionCallback(
+                                bdlf::BindUtil::bind(&StressTest::onEvict,
+                                                     &st,
+                                                     bdlf::PlaceHolders::_1));
+
+                bslmt::ThreadGroup tg(&ta);
+                for (int i = 0; i < NUM_READERS; ++i) {
+                    tg.addThread(bdlf::BindUtil::bind(&StressTest::reader,
+                                                      &st,
+                                                      i));
+                }
+                for (int i = 0; i < NUM_WRITERS; ++i) {
+                    tg.addThread(bdlf::BindUtil::bind(&StressTest::writer,
+                                                      &st,
+                                                      i));
+                }
+                tg.joinAll();
+
+                ASSERTV(ti, st.d_numErrors, 0 == st.d_numErrors);
+                ASSERTV(ti, mX.size(), mX.size() <= 256);
+
+                KeyCollector collector(1000000, &ta);
+                mX.visit(collector);
+                ASSERTV(ti, mX.size() == collector.d_keys.size());
+
+                if (veryVerbose) {
+                    P_(ti) P_(mX.size()) P(st.d_numEvicted);
+                }
+            }
+            ASSERTV(ti, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TINYLFU ADMISSION
+        //
+        // Concerns:
+        //: 1 With the 'e_TINY_LFU' policy, a new key is not admitted into a
+        //:   full shard unless it is accessed more frequently than the CLOCK
+        //:   victim, and the cache is not modified when it is rejected.
+        //:
+        //: 2 A key that is accessed frequently (including lookups that miss)
+        //:   is eventually admitted.
+        //:
+        //: 3 Replacing the value of an existing key is not subject to
+        //:   admission.
+        //:
+        //: 4 A one-off scan of new keys does not flush the frequently used
+        //:   items.
+        //:
+        //: 5 Without watermarks, the policy has no effect.
+        //
+        // Plan:
+        //: 1 Fill a single-shard cache with frequently accessed keys, then
+        //:   insert new keys and verify the outcome.  (C-1..4)
+        //:
+        //: 2 Insert many keys into an unlimited cache.  (C-5)
+        //
+        // Testing:
+        //   TINYLFU ADMISSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TINYLFU ADMISSION" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj              mX(4, 4, 1, Policy::e_TINY_LFU, &ta);
+            EvictionRecorder recorder(&ta);
+
+            mX.setPostEvictionCallback(
+                                bdlf::BindUtil::bind(&EvictionRecorder::record,
+                                                     &recorder,
+                                                     bdlf::PlaceHolders::_1));
+
+            bsl::shared_ptr<bsl::string> value;
+            for (int key = 0; key < 4; ++key) {
+                mX.insert(key, makeValue(key, &ta));
+                for (int i = 0; i < 5; ++i) {
+                    ASSERTV(key, 0 == mX.tryGetValue(&value, key));
+                }
+            }
+            ASSERT(4 == mX.size());
+
+            // A new key, seen once, is rejected.
+
+            mX.insert(100, makeValue(100, &ta));
+            ASSERT(4 == mX.size());
+            ASSERT(1 == mX.tryGetValue(&value, 100));
+            ASSERT(recorder.evicted().empty());
+
+            // Replacing an existing value is not subject to admission.
+
+            mX.insert(2, bsl::string("replaced", &ta));
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            ASSERT("replaced" == *value);
+
+            // A scan of new keys does not flush the frequently used items.
+
+            for (int key = 200; key < 210; ++key) {
+                mX.insert(key, makeValue(key, &ta));
+            }
+            for (int key = 0; key < 4; ++key) {
+                ASSERTV(key, 0 == mX.tryGetValue(&value, key));
+            }
+            ASSERT(recorder.evicted().empty());
+
+            // A key that is requested often enough is admitted.
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(1 == mX.tryGetValue(&value, 100));
+            }
+            mX.insert(100, makeValue(100, &ta));
+            ASSERT(0 == mX.tryGetValue(&value, 100));
+            ASSERT(4 == mX.size());
+            ASSERT(1 == recorder.evicted().size());
+        }
+        {
+            Obj mX(&ta);
+            ASSERT(Policy::e_ALWAYS == mX.admissionPolicy());
+
+            Obj mY(bsl::numeric_limits<bsl::size_t>::max(),
+                   bsl::numeric_limits<bsl::size_t>::max(),
+                   4,
+                   Policy::e_TINY_LFU,
+                   &ta);
+            for (int key = 0; key < 1000; ++key) {
+                mY.insert(key, makeValue(key, &ta));
+            }
+            ASSERT(1000 == mY.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION
+        //
+        // Concerns:
+        //: 1 Eviction starts when the size of a shard reaches its high
+        //:   watermark and stops below its low watermark.
+        //:
+        //: 2 Referenced items are given a second chance, and the other items
+        //:   are evicted in insertion order.
+        //:
+        //: 3 'tryGetValue' with 'modifyEvictionQueue == false' does not set
+        //:   the "referenced" flag.
+        //:
+        //: 4 'popFront' removes the CLOCK victim, invokes the callback, and
+        //:   returns 1 once all shards are empty.
+        //
+        // Plan:
+        //: 1 Using a single-shard cache and a recording callback, verify the
+        //:   eviction order for a sequence of insertions and lookups.
+        //:   (C-1..3)
+        //:
+        //: 2 Call 'popFront' on single and multi-shard caches until they are
+        //:   empty.  (C-4)
+        //
+        // Testing:
+        //   int popFront();
+        //   CLOCK EVICTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj              mX(5, 6, 1, Policy::e_ALWAYS, &ta);
+            EvictionRecorder recorder(&ta);
+
+            mX.setPostEvictionCallback(
+                                bdlf::BindUtil::bind(&EvictionRecorder::record,
+                                                     &recorder,
+                                                     bdlf::PlaceHolders::_1));
+
+            for (int key = 0; key < 6; ++key) {
+                mX.insert(key, makeValue(key, &ta));
+            }
+            ASSERT(6 == mX.size());
+            ASSERT(recorder.evicted().empty());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));
+
+            // Evicts 1 and 3 (0 and 2 get a second chance).
+
+            mX.insert(6, makeValue(6, &ta));
+            ASSERTV(mX.size(), 5 == mX.size());
+            ASSERT(2 == recorder.evicted().size());
+            ASSERT(1 == mX.tryGetValue(&value, 1, false));
+            ASSERT(1 == mX.tryGetValue(&value, 3, false));
+
+            KeyCollector collector(100, &ta);
+            mX.visit(collector);
+            ASSERTV(collector.d_keys.size(), 5 == collector.d_keys.size());
+            const int EXP[] = { 4, 5, 0, 2, 6 };
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, collector.d_keys[i], EXP[i] == collector.d_keys[i]);
+            }
+
+            // 'popFront' follows the CLOCK order.
+
+            ASSERT(0 == mX.tryGetValue(&value, 4));
+            ASSERT(0 == mX.popFront());
+            ASSERT(1 == mX.tryGetValue(&value, 5, false));
+            ASSERT(0 == mX.tryGetValue(&value, 4, false));
+            ASSERT(3 == recorder.evicted().size());
+
+            while (0 == mX.popFront()) {
+            }
+            ASSERT(0 == mX.size());
+            ASSERT(7 == recorder.evicted().size());
+            ASSERT(1 == mX.popFront());
+        }
+        {
+            Obj   mX(&ta);
+            int   numEvicted = 0;
+            ASSERT(1 == mX.popFront());
+
+            for (int key = 0; key < 100; ++key) {
+                mX.insert(key, makeValue(key, &ta));
+            }
+            ASSERT(100 == mX.size());
+
+            while (0 == mX.popFront()) {
+                ++numEvicted;
+            }
+            ASSERTV(numEvicted, 100 == numEvicted);
+            ASSERT(0 == mX.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND 'size', 'visit'
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload adds a new item, or replaces the value of
+        //:   an existing item without changing the size.
+        //:
+        //: 2 'tryGetValue' finds exactly the inserted items.
+        //:
+        //: 3 'erase', 'eraseBulk', and 'clear' remove items; the first two
+        //:   invoke the post-eviction callback, and 'clear' does not.
+        //:
+        //: 4 'insertBulk' returns the number of new items.
+        //:
+        //: 5 'visit' visits every item once, and stops when the visitor
+        //:   returns 'false'.
+        //:
+        //: 6 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator on a multi-shard cache and verify the
+        //:   result with 'size', 'tryGetValue', and 'visit'.  (C-1..6)
+        //
+        // Testing:
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   int erase(const KEY& key);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void clear();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   bsl::size_t size() const;
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND 'size', 'visit'" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj              mX(&ta);  const Obj& X = mX;
+            EvictionRecorder recorder(&ta);
+
+            mX.setPostEvictionCallback(
+                                bdlf::BindUtil::bind(&EvictionRecorder::record,
+                                                     &recorder,
+                                                     bdlf::PlaceHolders::_1));
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(1 == mX.tryGetValue(&value, 0));
+
+            // 'insert' overloads
+
+            {
+                mX.insert(0, bsl::string("zero", &ta));
+
+                bsl::string v1("one", &ta);
+                mX.insert(1, bslmf::MovableRefUtil::move(v1));
+
+                int k2 = 2;
+                mX.insert(bslmf::MovableRefUtil::move(k2),
+                          bsl::string("two", &ta));
+
+                int         k3 = 3;
+                bsl::string v3("three", &ta);
+                mX.insert(bslmf::MovableRefUtil::move(k3),
+                          bslmf::MovableRefUtil::move(v3));
+
+                Obj::ValuePtrType p4;
+                p4.createInplace(&ta, "four", &ta);
+                mX.insert(4, p4);
+
+                int               k5 = 5;
+                Obj::ValuePtrType p5;
+                p5.createInplace(&ta, "five", &ta);
+                mX.insert(bslmf::MovableRefUtil::move(k5), p5);
+            }
+            ASSERT(6 == X.size());
+
+            const char *NAMES[] = { "zero", "one", "two", "three", "four",
+                                    "five" };
+            for (int key = 0; key < 6; ++key) {
+                ASSERTV(key, 0 == mX.tryGetValue(&value, key));
+                ASSERTV(key, NAMES[key] == *value);
+            }
+
+            // Replacing a value does not change the size.
+
+            mX.insert(0, bsl::string("ZERO", &ta));
+            ASSERT(6 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT("ZERO" == *value);
+
+            // 'insertBulk'
+
+            bsl::vector<Obj::KVType> data(&ta);
+            for (int key = 5; key < 10; ++key) {
+                Obj::ValuePtrType p;
+                p.createInplace(&ta, makeValue(key, &ta), &ta);
+                data.push_back(Obj::KVType(key, p));
+            }
+            ASSERT(4 == mX.insertBulk(data));
+            ASSERT(10 == X.size());
+
+            // 'visit'
+
+            {
+                KeyCollector collector(1000, &ta);
+                X.visit(collector);
+                ASSERT(10 == collector.d_keys.size());
+
+                bsl::map<int, int> counts(&ta);
+                for (bsl::size_t i = 0; i < collector.d_keys.size(); ++i) {
+                    ++counts[collector.d_keys[i]];
+                }
+                ASSERT(10 == counts.size());
+                ASSERT(0  == counts.begin()->first);
+                ASSERT(9  == counts.rbegin()->first);
+
+                KeyCollector limited(3, &ta);
+                X.visit(limited);
+                ASSERT(3 == limited.d_keys.size());
+            }
+
+            // 'erase', 'eraseBulk'
+
+            ASSERT(0 == mX.erase(4));
+            ASSERT(1 == mX.erase(4));
+            ASSERT(9 == X.size());
+            ASSERT(1 == recorder.evicted().size());
+            ASSERT("four" == recorder.evicted()[0]);
+
+            bsl::vector<int> keys(&ta);
+            keys.push_back(1);
+            keys.push_back(4);
+            keys.push_back(7);
+            ASSERT(2 == mX.eraseBulk(keys));
+            ASSERT(7 == X.size());
+            ASSERT(3 == recorder.evicted().size());
+            ASSERT(1 == mX.tryGetValue(&value, 1));
+            ASSERT(1 == mX.tryGetValue(&value, 7));
+
+            // 'clear'
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(3 == recorder.evicted().size());
+            ASSERT(1 == mX.tryGetValue(&value, 0));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty cache having the specified
+        //:   attributes, and uses the specified (or default) allocator.
+        //:
+        //: 2 The number of shards is rounded up to a power of two.
+        //:
+        //: 3 The specified hash and equality functors are used.
+        //
+        // Plan:
+        //: 1 Create caches with each constructor and verify the accessors.
+        //:   (C-1..2)
+        //:
+        //: 2 Use an equality functor comparing modulo 10, and verify that
+        //:   keys equal modulo 10 are treated as the same key.  (C-3)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(lowWatermark, highWatermark, basicAllocator);
+        //   ShardedCache(low, high, numShards, admissionPolicy, alloc);
+        //   ShardedCache(low, high, numShards, policy, hash, equal, alloc);
+        //   ShardedCacheAdmissionPolicy::Enum admissionPolicy() const;
+        //   EQUAL equalFunction() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        const bsl::size_t MAX = bsl::numeric_limits<bsl::size_t>::max();
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            const Obj X(&ta);
+            ASSERT(&ta              == X.allocator());
+            ASSERT(MAX              == X.lowWatermark());
+            ASSERT(MAX              == X.highWatermark());
+            ASSERT(16               == X.numShards());
+            ASSERT(Policy::e_ALWAYS == X.admissionPolicy());
+            ASSERT(0                == X.size());
+            ASSERT(0 <  ta.numBlocksInUse());
+        }
+        {
+            bslma::TestAllocatorMonitor  dm(&defaultAllocator);
+            bslma::DefaultAllocatorGuard guard(&ta);
+
+            const Obj X(10, 20);
+            ASSERT(&ta              == X.allocator());
+            ASSERT(10               == X.lowWatermark());
+            ASSERT(20               == X.highWatermark());
+            ASSERT(16               == X.numShards());
+            ASSERT(dm.isTotalSame());
+        }
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_numShards;
+                bsl::size_t d_expShards;
+            } DATA[] = {
+                { L_,   1,   1 },
+                { L_,   2,   2 },
+                { L_,   3,   4 },
+                { L_,   5,   8 },
+                { L_,  64,  64 },
+                { L_,  65, 128 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const bsl::size_t N    = DATA[ti].d_numShards;
+                const bsl::size_t EXP  = DATA[ti].d_expShards;
+
+                const Obj X(100, 200, N, Policy::e_TINY_LFU, &ta);
+                ASSERTV(LINE, EXP == X.numShards());
+                ASSERTV(LINE, 100 == X.lowWatermark());
+                ASSERTV(LINE, 200 == X.highWatermark());
+                ASSERTV(LINE, Policy::e_TINY_LFU == X.admissionPolicy());
+            }
+        }
+        {
+            typedef bdlcc::ShardedCache<int,
+                                        bsl::string,
+                                        ModuloHash,
+                                        ModuloEqual> ModObj;
+
+            ModuloHash  hash  = { 10 };
+            ModuloEqual equal = { 10 };
+            ModObj      mX(MAX, MAX, 4, Policy::e_ALWAYS, hash, equal, &ta);
+
+            ASSERT(10 == mX.equalFunction().d_modulus);
+            ASSERT(2  == mX.hashFunction()(42));
+
+            mX.insert(3, bsl::string("three", &ta));
+            mX.insert(13, bsl::string("thirteen", &ta));
+            ASSERT(1 == mX.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 23));
+            ASSERT("thirteen" == *value);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'ShardedCache_FrequencySketch'
+        //
+        // Concerns:
+        //: 1 A new sketch estimates 0 for every hash.
+        //:
+        //: 2 Estimates are never lower than the true count (up to 15) before
+        //:   aging.
+        //:
+        //: 3 Counters saturate at 15.
+        //:
+        //: 4 Aging halves the counters once the sample size is reached.
+        //:
+        //: 5 'clear' resets every counter.
+        //:
+        //: 6 Memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Increment a set of hashes a known number of times and verify the
+        //:   estimates.  (C-1..3, 5..6)
+        //:
+        //: 2 Increment a single hash enough times to trigger aging, and verify
+        //:   that its estimate dropped.  (C-4)
+        //
+        // Testing:
+        //   ShardedCache_FrequencySketch(bsl::size_t, Allocator *ba = 0);
+        //   ~ShardedCache_FrequencySketch();
+        //   void clear();
+        //   void increment(bsl::size_t hash);
+        //   int frequency(bsl::size_t hash) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'ShardedCache_FrequencySketch'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Sketch mX(1000, &ta);  const Sketch& X = mX;
+            ASSERT(1 == ta.numBlocksInUse());
+
+            for (bsl::size_t h = 0; h < 100; ++h) {
+                ASSERTV(h, 0 == X.frequency(h * 0x9e3779b9));
+            }
+
+            for (bsl::size_t h = 0; h < 100; ++h) {
+                for (bsl::size_t i = 0; i < h % 20; ++i) {
+                    mX.increment(h * 0x9e3779b9);
+                }
+            }
+            for (bsl::size_t h = 0; h < 100; ++h) {
+                const int EXP = static_cast<int>(h % 20 < 15 ? h % 20 : 15);
+                ASSERTV(h, X.frequency(h * 0x9e3779b9),
+                        EXP <= X.frequency(h * 0x9e3779b9));
+            }
+
+            mX.clear();
+            for (bsl::size_t h = 0; h < 100; ++h) {
+                ASSERTV(h, 0 == X.frequency(h * 0x9e3779b9));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            // The sample size is 10 accesses per expected item.
+
+            Sketch mX(10, &ta);  const Sketch& X = mX;
+
+            for (int i = 0; i < 99; ++i) {
+                mX.increment(12345);
+            }
+            ASSERTV(X.frequency(12345), 15 == X.frequency(12345));
+
+            mX.increment(12345);
+            ASSERTV(X.frequency(12345), 7 == X.frequency(12345));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, erase, and evict a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(200, 400, 4, Policy::e_ALWAYS, &ta);
+
+            for (int key = 0; key < 80; ++key) {
+                mX.insert(key, makeValue(key, &ta));
+            }
+            ASSERT(80 == mX.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 7));
+            ASSERT(makeValue(7, &ta) == *value);
+            ASSERT(1 == mX.tryGetValue(&value, 80));
+
+            ASSERT(0 == mX.erase(7));
+            ASSERT(1 == mX.tryGetValue(&value, 7));
+            ASSERT(79 == mX.size());
+
+            for (int key = 80; key < 1000; ++key) {
+                mX.insert(key, makeValue(key, &ta));
+            }
+            ASSERTV(mX.size(), mX.size() <= 400);
+            ASSERT(0 == mX.tryGetValue(&value, 999));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ-MOSTLY THROUGHPUT COMPARISON WITH 'bdlcc::Cache'
+        //
+        // Concerns:
+        //: 1 Compare the lookup throughput of 'bdlcc::ShardedCache' with that
+        //:   of 'bdlcc::Cache' (LRU policy) under a read-mostly load.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', run a group of reader
+        //:   threads, and optionally a group of writer threads, against each
+        //:   cache type.  Print one CSV line per configuration:
+        //:   'cache,readers,writers,keys,lookupsPerSecond'.
+        //:
+        //: 2 The maximum number of readers, the number of writers, and the
+        //:   number of keys may be specified as the arguments 3, 4, and 5 on
+        //:   the command line.
+        //
+        // Testing:
+        //   READ-MOSTLY THROUGHPUT COMPARISON WITH 'bdlcc::Cache'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "READ-MOSTLY THROUGHPUT COMPARISON WITH 'bdlcc::Cache'"
+                    << endl
+                    << "====================================================="
+                    << endl;
+
+        using namespace PERFORMANCE;
+
+        // Measure with the allocator production code would use.
+
+        bslma::DefaultAllocatorGuard perfGuard(
+                                     &bslma::NewDeleteAllocator::singleton());
+
+        const int maxReaders = argc > 3 ? atoi(argv[3]) : 8;
+        const int numWriters = argc > 4 ? atoi(argv[4]) : 1;
+        const int numKeys    = argc > 5 ? atoi(argv[5]) : 100000;
+
+        const int MILLISECONDS = 200;
+        const int NUM_SAMPLES  = 5;
+
+        cout << "cache,readers,writers,keys,lookupsPerSecond" << endl;
+
+        for (int numReaders = 1; numReaders <= maxReaders; numReaders *= 2) {
+            {
+                bdlcc::Cache<int, bsl::string> cache(
+                                             bdlcc::CacheEvictionPolicy::e_LRU,
+                                             numKeys,
+                                             numKeys + 1);
+                runBenchmark("Cache",
+                             &cache,
+                             numKeys,
+                             numReaders,
+                             numWriters,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+            }
+            {
+                Obj cache(numKeys, numKeys + 1);
+                runBenchmark("ShardedCache",
+                             &cache,
+                             numKeys,
+                             numReaders,
+                             numWriters,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+            }
+            {
+                Obj cache(numKeys, numKeys + 1, 16, Policy::e_TINY_LFU);
+                runBenchmark("ShardedCache/TinyLFU",
+                             &cache,
+                             numKeys,
+                             numReaders,
+                             numWriters,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
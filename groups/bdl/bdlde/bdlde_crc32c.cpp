@@ -5,6 +5,8 @@
 BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 
 // BDE
+#include <bdlbb_blob.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_iostream.h>
@@ -33,6 +35,16 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 #include <cpuid.h>
 #endif
 
+#if defined(LIKE_X86_GCC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+#if (defined(BSLS_PLATFORM_CMP_GNU)   && BSLS_PLATFORM_CMP_VERSION >= 80000) \
+ || (defined(BSLS_PLATFORM_CMP_CLANG) && BSLS_PLATFORM_CMP_VERSION >= 60000)
+#define LIKE_X86_GCC_VPCLMUL
+    // The compiler supports the AVX-512 VPCLMULQDQ intrinsics, which are
+    // enabled for individual functions using the 'target' attribute.
+#include <immintrin.h>
+#endif
+#endif
+
 // #define BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION
     // The Sparc hardware optimization is implemented in a third-party library
     // provided by Oracle.  For the time being we remove optimized crc32
@@ -666,6 +678,61 @@ const unsigned int k_CRC_TABLE_IL8_O88[256] =
     0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5
 };
 
+const unsigned int k_CRC32C_POLYNOMIAL = 0x82F63B78;
+    // The Castagnoli polynomial, bit-reflected, without its x^32 term.
+
+const unsigned int k_X2N_PERIOD = 31;
+    // The period of the sequence x^(2^k) modulo the Castagnoli polynomial:
+    // x^(2^(k + 31)) == x^(2^k) for all 'k'.
+
+const unsigned int k_X2N_TABLE[k_X2N_PERIOD] = {
+    // 'k_X2N_TABLE[k]' is x^(2^k) modulo the Castagnoli polynomial,
+    // bit-reflected.
+
+    0x40000000, 0x20000000, 0x08000000, 0x00800000,
+    0x00008000, 0x82F63B78, 0x6EA2D55C, 0x18B8EA18,
+    0x510AC59A, 0xB82BE955, 0xB8FDB1E7, 0x88E56F72,
+    0x74C360A4, 0xE4172B16, 0x0D65762A, 0x35D73A62,
+    0x28461564, 0xBF455269, 0xE2EA32DC, 0xFE7740E6,
+    0xF946610B, 0x3C204F8F, 0x538586E3, 0x59726915,
+    0x734D5309, 0xBC1AC763, 0x7D0722CC, 0xD289CABE,
+    0xE94CA9BC, 0x05B74F3F, 0xA51E1F42
+};
+
+unsigned int multiplyModulo(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b' polynomials modulo the
+    // Castagnoli polynomial, all of which are bit-reflected.
+{
+    unsigned int mask    = 1U << 31;
+    unsigned int product = 0;
+
+    while (true) {
+        if (a & mask) {
+            product ^= b;
+            if (0 == (a & (mask - 1))) {
+                break;
+            }
+        }
+        mask >>= 1;
+        b = b & 1 ? (b >> 1) ^ k_CRC32C_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+unsigned int xPow8nModulo(bsl::size_t n)
+    // Return x^(8 * n) modulo the Castagnoli polynomial, bit-reflected; that
+    // is, the factor by which appending the specified 'n' zero bytes to a
+    // message multiplies its (unconditioned) CRC.
+{
+    unsigned int result = 1U << 31;  // x^0
+    for (unsigned int k = 3; n; n >>= 1, ++k) {
+        if (n & 1) {
+            result = multiplyModulo(k_X2N_TABLE[k % k_X2N_PERIOD], result);
+        }
+    }
+    return result;
+}
+
                         //=======================
                         // class Crc32cCalculator
                         //=======================
@@ -1205,6 +1272,186 @@ unsigned int crc32cHardwareSerial(const unsigned char *data,
 
 #endif  // LIKE_X86_GCC
 
+#if defined(LIKE_X86_GCC_VPCLMUL)
+
+// The folding constants below are, for a fold over a distance of 'D' bits,
+// x^(D + 63) and x^(D - 1) modulo the Castagnoli polynomial, bit-reflected and
+// stored in the upper half of a 64-bit lane (the exponents are reduced by one
+// to compensate for the carry-less product of bit-reflected operands being
+// shifted by one bit).  See Intel White Paper: "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction".
+
+const bsls::Types::Uint64 k_FOLD_256_LO = 0xE9A5D8BE00000000ULL;
+const bsls::Types::Uint64 k_FOLD_256_HI = 0x1426A81500000000ULL;
+const bsls::Types::Uint64 k_FOLD_64_LO  = 0x1C19243B00000000ULL;
+const bsls::Types::Uint64 k_FOLD_64_HI  = 0x75BBA45B00000000ULL;
+const bsls::Types::Uint64 k_FOLD_48_LO  = 0xA46EF4AA00000000ULL;
+const bsls::Types::Uint64 k_FOLD_48_HI  = 0x6051243F00000000ULL;
+const bsls::Types::Uint64 k_FOLD_32_LO  = 0x33CCBBBC00000000ULL;
+const bsls::Types::Uint64 k_FOLD_32_HI  = 0xA2158B3400000000ULL;
+const bsls::Types::Uint64 k_FOLD_16_LO  = 0x3743F7BD00000000ULL;
+const bsls::Types::Uint64 k_FOLD_16_HI  = 0x3171D43000000000ULL;
+    // folding constants for distances of 256, 64, 48, 32, and 16 bytes
+
+bool isVpclmulSupported()
+    // Return 'true' if the running processor and operating system support the
+    // AVX-512 foundation and VPCLMULQDQ instructions, and 'false' otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || !(ecx & (1U << 27))) {  // OSXSAVE
+        return false;                                                 // RETURN
+    }
+
+    // The operating system must save the SSE, AVX, and AVX-512 (opmask and
+    // both halves of the ZMM registers) state.
+
+    unsigned int xcr0Lo, xcr0Hi;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+    if (0xE6 != (xcr0Lo & 0xE6)) {
+        return false;                                                 // RETURN
+    }
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;                                                 // RETURN
+    }
+    return (ebx & (1U << 16))      // AVX512F
+        && (ecx & (1U << 10));     // VPCLMULQDQ
+}
+
+__attribute__((target("avx512f,vpclmulqdq,pclmul,sse4.2")))
+inline
+__m512i fold512(__m512i accumulator, __m512i constants, __m512i data)
+    // Return the specified 'accumulator', each 128-bit lane of which is
+    // folded (multiplied) using the specified 'constants', XOR-ed with the
+    // specified 'data'.
+{
+    return _mm512_ternarylogic_epi64(
+                     _mm512_clmulepi64_epi128(accumulator, constants, 0x00),
+                     _mm512_clmulepi64_epi128(accumulator, constants, 0x11),
+                     data,
+                     0x96);  // a ^ b ^ c
+}
+
+__attribute__((target("avx512f,vpclmulqdq,pclmul,sse4.2")))
+unsigned int crc32cVpclmul(const unsigned char *data,
+                           bsl::size_t          length,
+                           unsigned int         crc)
+    // Calculate the CRC32-C value (using AVX-512 VPCLMULQDQ intrinsics) for
+    // the specified 'data' over the specified 'length' number of bytes, using
+    // the specified 'crc' value as the starting point for the calculation.
+    // The behavior is undefined unless '256 <= length'.
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(256 <= length);
+
+    // Fold 256 bytes at a time into four 512-bit accumulators, the initial
+    // CRC being XOR-ed into the first 4 bytes of data.
+
+    const __m512i fold256 = _mm512_set_epi64(k_FOLD_256_HI, k_FOLD_256_LO,
+                                             k_FOLD_256_HI, k_FOLD_256_LO,
+                                             k_FOLD_256_HI, k_FOLD_256_LO,
+                                             k_FOLD_256_HI, k_FOLD_256_LO);
+    const __m512i fold64  = _mm512_set_epi64(k_FOLD_64_HI,  k_FOLD_64_LO,
+                                             k_FOLD_64_HI,  k_FOLD_64_LO,
+                                             k_FOLD_64_HI,  k_FOLD_64_LO,
+                                             k_FOLD_64_HI,  k_FOLD_64_LO);
+
+    __m512i x0 = _mm512_xor_si512(
+                     _mm512_loadu_si512(data),
+                     _mm512_inserti32x4(_mm512_setzero_si512(),
+                                        _mm_cvtsi32_si128(~crc),
+                                        0));
+    __m512i x1 = _mm512_loadu_si512(data +  64);
+    __m512i x2 = _mm512_loadu_si512(data + 128);
+    __m512i x3 = _mm512_loadu_si512(data + 192);
+
+    data   += 256;
+    length -= 256;
+
+    for (; length >= 256; data += 256, length -= 256) {
+        x0 = fold512(x0, fold256, _mm512_loadu_si512(data));
+        x1 = fold512(x1, fold256, _mm512_loadu_si512(data +  64));
+        x2 = fold512(x2, fold256, _mm512_loadu_si512(data + 128));
+        x3 = fold512(x3, fold256, _mm512_loadu_si512(data + 192));
+    }
+
+    // Fold the four accumulators into one, then the remaining 64-byte blocks.
+
+    x1 = fold512(x0, fold64, x1);
+    x2 = fold512(x1, fold64, x2);
+    x0 = fold512(x2, fold64, x3);
+
+    for (; length >= 64; data += 64, length -= 64) {
+        x0 = fold512(x0, fold64, _mm512_loadu_si512(data));
+    }
+
+    // Fold the first three 128-bit lanes onto the last one, over 48, 32, and
+    // 16 bytes, respectively.
+
+    const __m512i foldLanes = _mm512_set_epi64(0,             0,
+                                               k_FOLD_16_HI,  k_FOLD_16_LO,
+                                               k_FOLD_32_HI,  k_FOLD_32_LO,
+                                               k_FOLD_48_HI,  k_FOLD_48_LO);
+
+    x0 = fold512(x0, foldLanes, _mm512_maskz_mov_epi64(0xC0, x0));
+
+    // Sum the lanes through memory: the lane-extraction intrinsics trigger
+    // spurious '-Wuninitialized' warnings with some versions of GCC.
+
+    __m128i lanes[4];
+    _mm512_storeu_si512(lanes, x0);
+
+    __m128i r = _mm_xor_si128(_mm_xor_si128(lanes[0], lanes[1]),
+                              _mm_xor_si128(lanes[2], lanes[3]));
+
+    // Fold the remaining 16-byte blocks.
+
+    const __m128i fold16 = _mm_set_epi64x(k_FOLD_16_HI, k_FOLD_16_LO);
+
+    for (; length >= 16; data += 16, length -= 16) {
+        r = _mm_xor_si128(
+               _mm_xor_si128(_mm_clmulepi64_si128(r, fold16, 0x00),
+                             _mm_clmulepi64_si128(r, fold16, 0x11)),
+               _mm_loadu_si128(reinterpret_cast<const __m128i *>(data)));
+    }
+
+    // The folded 128 bits have the same (unconditioned) CRC as the data
+    // processed so far; use the CRC32 instruction to reduce them, and to
+    // process the remaining bytes.
+
+    bsls::Types::Uint64 sum = _mm_crc32_u64(0, _mm_cvtsi128_si64(r));
+    sum = _mm_crc32_u64(sum, _mm_extract_epi64(r, 1));
+
+    unsigned int result = static_cast<unsigned int>(sum);
+    for (; length; ++data, --length) {
+        result = _mm_crc32_u8(result, *data);
+    }
+
+    return ~result;
+}
+
+unsigned int crc32cSse64bitVpclmul(const unsigned char *data,
+                                   bsl::size_t          length,
+                                   unsigned int         crc)
+    // Calculate the CRC32-C value for the specified 'data' over the specified
+    // 'length' number of bytes, using the specified 'crc' value as the
+    // starting point for the calculation, using AVX-512 VPCLMULQDQ intrinsics
+    // for inputs of at least 'Crc32c_Impl::k_VECTOR_THRESHOLD' bytes, and
+    // 'crc32cSse64bit' otherwise.  Note that the 'data' is permitted to be
+    // null if the 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    if (length >= Crc32c_Impl::k_VECTOR_THRESHOLD) {
+        return crc32cVpclmul(data, length, crc);                      // RETURN
+    }
+    return crc32cSse64bit(data, length, crc);
+}
+
+#endif  // LIKE_X86_GCC_VPCLMUL
+
                         //-----------------------
                         // class Crc32cCalculator
                         //-----------------------
@@ -1227,7 +1474,19 @@ Crc32cCalculator::Crc32cCalculator()
 
     if (ecx & BDLDE_SSE4_2) { // SSE 4.2 Support for CRC32-C
 
-#ifdef BSLS_PLATFORM_CPU_64_BIT
+#if defined(LIKE_X86_GCC_VPCLMUL)
+        if (isVpclmulSupported()) {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 and AVX-512 VPCLMULQDQ instructions "
+                          "available, 64-bit mode)");
+            s_crc32cFn = crc32cSse64bitVpclmul;
+        }
+        else {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 instructions available, 64-bit mode)");
+            s_crc32cFn = crc32cSse64bit;
+        }
+#elif defined(BSLS_PLATFORM_CPU_64_BIT)
         BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
                       "(SSE4.2 instructions available, 64-bit mode)");
         s_crc32cFn = crc32cSse64bit;
@@ -1315,10 +1574,40 @@ unsigned int Crc32c::calculate(const void   *data,
     return calculator(static_cast<const unsigned char *>(data), length, crc);
 }
 
+unsigned int Crc32c::calculate(const bdlbb::Blob& data, unsigned int crc)
+{
+    const int numDataBuffers = data.numDataBuffers();
+
+    for (int i = 0; i < numDataBuffers; ++i) {
+        const bdlbb::BlobBuffer& buffer = data.buffer(i);
+        const int                length = i == numDataBuffers - 1
+                                        ? data.lastDataBufferLength()
+                                        : buffer.size();
+
+        crc = calculate(buffer.data(), length, crc);
+    }
+    return crc;
+}
+
+unsigned int Crc32c::combine(unsigned int crcA,
+                             unsigned int crcB,
+                             bsl::size_t  lengthB)
+{
+    // Appending 'lengthB' bytes to a message multiplies the CRC of the message
+    // by x^(8 * lengthB), and the CRC of the concatenation is the sum of that
+    // product and the CRC of the appended bytes.  Note that the pre- and
+    // post-conditioning of 'crcA' and 'crcB' (complementing) cancel out.
+
+    return multiplyModulo(xPow8nModulo(lengthB), crcA) ^ crcB;
+}
+
                              // ------------------
                              // struct Crc32c_Impl
                              // ------------------
 
+// CLASS DATA
+const bsl::size_t Crc32c_Impl::k_VECTOR_THRESHOLD;
+
 unsigned int Crc32c_Impl::calculateSoftware(const void   *data,
                                             bsl::size_t   length,
                                             unsigned int  crc)
@@ -1358,6 +1647,37 @@ unsigned int Crc32c_Impl::calculateHardwareSerial(const void   *data,
 #endif // BSLS_PLATFORM_CMP_GNU || BSLS_PLATFORM_CMP_CLANG
 }
 
+unsigned int Crc32c_Impl::calculateHardwareVector(const void   *data,
+                                                  bsl::size_t   length,
+                                                  unsigned int  crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(   (data || !length)
+                     && "If 'data' is 0, then 'length' also must be 0");
+
+#if defined(LIKE_X86_GCC_VPCLMUL)
+    if (length >= k_VECTOR_THRESHOLD && isHardwareVectorSupported()) {
+        return crc32cVpclmul(static_cast<const unsigned char *>(data),
+                             length,
+                             crc);                                    // RETURN
+    }
+#endif
+    return Crc32c::calculate(data, length, crc);
+}
+
+bool Crc32c_Impl::isHardwareVectorSupported()
+{
+#if defined(LIKE_X86_GCC_VPCLMUL)
+    // The initialization of function-scope statics is thread-safe with the
+    // compilers supporting 'LIKE_X86_GCC_VPCLMUL'.
+
+    static const bool isSupported = isVpclmulSupported();
+    return isSupported;
+#else
+    return false;
+#endif
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -20,10 +20,16 @@ BSLS_IDENT("$Id$")
 // implementation if supported or a software implementation otherwise.  It
 // additionally defines the struct 'bdlde::Crc32c_Impl' to expose alternative
 // implementations that should not be used other than to test and benchmark.
-// Note that a CRC32-C checksum is a strong and fast technique for determining
-// whether or not a message was received without errors.  Also note that a
-// CRC-32 checksum does not aid in error correction and is not naively useful
-// in any sort of cryptography application.
+// The checksum of data held in the (possibly many) buffers of a 'bdlbb::Blob'
+// can be calculated directly, without first copying the data into one
+// contiguous buffer.  The checksums of two consecutive sequences of bytes
+// can be combined, knowing only the length of the second sequence, into the
+// checksum of their concatenation, so that the checksum of a large buffer may
+// be calculated by checksumming parts of it independently (e.g., in parallel
+// by several threads).  Note that a CRC32-C checksum is a strong and fast
+// technique for determining whether or not a message was received without
+// errors.  Also note that a CRC-32 checksum does not aid in error correction
+// and is not naively useful in any sort of cryptography application.
 //
 ///Thread Safety
 ///-------------
@@ -38,6 +44,12 @@ BSLS_IDENT("$Id$")
 //: o x86:   SSE4.2 instructions are required
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
+// In addition, on x86-64 processors supporting AVX-512 and the VPCLMULQDQ
+// (vectorized carry-less multiplication) instructions, and when building with
+// a compiler supporting them (GCC 8 or Clang 6 and later), inputs of at least
+// 'Crc32c_Impl::k_VECTOR_THRESHOLD' bytes are processed 256 bytes at a time
+// by folding four 512-bit accumulators, which is considerably faster than
+// using the CRC32 instruction for large inputs.
 //
 ///Performance
 ///-----------
@@ -76,12 +88,44 @@ BSLS_IDENT("$Id$")
 //                                      newChunk.size(),
 //                                      checksum);
 //..
+//
+///Example 2: Checksumming a large buffer in parts
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// The following code illustrates how the checksum of a large buffer can be
+// calculated from the checksums of its parts, which may have been calculated
+// independently, for example by several threads.
+//
+// First, prepare a buffer and split it into two parts:
+//..
+//  bsl::vector<char> buffer(100000, 'x');
+//
+//  const bsl::size_t lengthA = 60000;
+//  const bsl::size_t lengthB = buffer.size() - lengthA;
+//..
+// Then, calculate the checksum of each part independently:
+//..
+//  const unsigned int crcA = bdlde::Crc32c::calculate(buffer.data(),
+//                                                     lengthA);
+//  const unsigned int crcB = bdlde::Crc32c::calculate(
+//                                                     buffer.data() + lengthA,
+//                                                     lengthB);
+//..
+// Finally, combine the two checksums and verify that the result is the
+// checksum of the whole buffer:
+//..
+//  const unsigned int crc = bdlde::Crc32c::combine(crcA, crcB, lengthB);
+//
+//  assert(bdlde::Crc32c::calculate(buffer.data(), buffer.size()) == crc);
+//..
 
 #include <bdlscm_version.h>
 
 #include <bsl_cstddef.h>
 
 namespace BloombergLP {
+
+namespace bdlbb { class Blob; }
+
 namespace bdlde {
 
                                // =============
@@ -106,6 +150,22 @@ struct Crc32c {
         // the specified 'length' number of bytes, using the optionally
         // specified 'crc' value as the starting point for the calculation.
         // Note that if 'data' is 0, then 'length' also must be 0.
+
+    static unsigned int calculate(const bdlbb::Blob& data,
+                                  unsigned int       crc = k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the data bytes of the
+        // specified 'data' blob, using the optionally specified 'crc' value as
+        // the starting point for the calculation.  The data buffers of 'data'
+        // are processed in place, without being copied.
+
+    static unsigned int combine(unsigned int crcA,
+                                unsigned int crcB,
+                                bsl::size_t  lengthB);
+        // Return the CRC32-C value of the concatenation of a sequence of bytes
+        // having the specified 'crcA' CRC32-C value with a sequence of the
+        // specified 'lengthB' bytes having the specified 'crcB' CRC32-C value
+        // (calculated using 'k_NULL_CRC32C' as the starting point).  The
+        // complexity of this operation is logarithmic in 'lengthB'.
 };
 
                              // ==================
@@ -117,6 +177,12 @@ struct Crc32c_Impl {
     // calculate a CRC32-C checksum.
 
   public:
+    // CLASS DATA
+    static const bsl::size_t k_VECTOR_THRESHOLD = 256;
+        // Minimum length (in bytes) of an input for which 'Crc32c::calculate'
+        // uses the implementation of 'calculateHardwareVector', when it is
+        // supported.
+
     // CLASS METHODS
     static
     unsigned int calculateSoftware(const void   *data,
@@ -143,6 +209,26 @@ struct Crc32c_Impl {
         // fall back to the software version when running on unsupported
         // platforms.  Also note that if 'data' is 0, then 'length' must also
         // be 0.
+
+    static
+    unsigned int calculateHardwareVector(
+                                    const void   *data,
+                                    bsl::size_t   length,
+                                    unsigned int  crc = Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the specified 'data' over
+        // the specified 'length' number of bytes, using the optionally
+        // specified 'crc' value as the starting point for the calculation.
+        // This utilizes a hardware-based implementation that, for inputs of
+        // at least 'k_VECTOR_THRESHOLD' bytes, folds 256 bytes at a time
+        // using AVX-512 carry-less multiplication (VPCLMULQDQ).  Note that
+        // this function will fall back to the implementation of
+        // 'Crc32c::calculate' when running on unsupported platforms (see
+        // 'isHardwareVectorSupported').  Also note that if 'data' is 0, then
+        // 'length' must also be 0.
+
+    static bool isHardwareVectorSupported();
+        // Return 'true' if 'calculateHardwareVector' uses carry-less
+        // multiplication on the running platform, and 'false' otherwise.
 };
 
 }  // close package namespace
@@ -4,6 +4,10 @@
 // BDE
 #include <bdlde_crc32.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlf_bind.h>
 
 #include <bsl_algorithm.h>
@@ -229,14 +233,19 @@ using namespace bsl;
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] int Crc32c::calculate(const bdlbb::Blob&, unsigned int);
+// [8] int Crc32c::combine(unsigned int, unsigned int, size_t);
+// [9] int Crc32c_Impl::calculateHardwareVector(const void *, size_t, uint);
+// [9] bool Crc32c_Impl::isHardwareVectorSupported();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
 // [-4] DEFAULT & FOLLY PERFORMANCE TEST
 // [-5] PERFORMANCE TEST ON USER INPUT
+// [-6] DEFAULT & HARDWARE VECTOR PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -465,6 +474,45 @@ void printTable(bsl::ostream&                   out,
     printTableRows(out, tableRecords, headerCols);
 }
 
+static
+unsigned int slowMultiplyModulo(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b' polynomials modulo the
+    // Castagnoli polynomial, all of which are bit-reflected (i.e., the most
+    // significant bit holds the coefficient of x^0).  This function
+    // multiplies one bit at a time, and is independent of the implementation
+    // under test.
+{
+    unsigned int product = 0;
+    for (int i = 0; i < 32; ++i) {
+        if ((a >> (31 - i)) & 1) {
+            product ^= b;
+        }
+        b = b & 1 ? (b >> 1) ^ 0x82F63B78 : b >> 1;  // 'b *= x'
+    }
+    return product;
+}
+
+static
+unsigned int slowCombine(unsigned int crcA,
+                         unsigned int crcB,
+                         bsl::size_t  lengthB)
+    // Return the CRC32-C value of the concatenation of a sequence of bytes
+    // having the specified 'crcA' CRC32-C value with a sequence of the
+    // specified 'lengthB' bytes having the specified 'crcB' CRC32-C value,
+    // calculating x^(8 * lengthB) by repeated squaring of x^8, without any
+    // precomputed table.
+{
+    unsigned int power  = 1U << 31;        // x^0
+    unsigned int square = 1U << (31 - 8);  // x^8
+    for (; lengthB; lengthB >>= 1) {
+        if (lengthB & 1) {
+            power = slowMultiplyModulo(power, square);
+        }
+        square = slowMultiplyModulo(square, square);
+    }
+    return slowMultiplyModulo(power, crcA) ^ crcB;
+}
+
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
@@ -1315,6 +1363,326 @@ void test6_multithreadedCrc32cSoftware()
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
 
+void test7_calculateOnBlob()
+    // ------------------------------------------------------------------------
+    // CALCULATE CRC32-C ON BLOB
+    //
+    // Concerns:
+    //: 1 Calculating CRC32-C on a blob yields the same result as calculating
+    //:   it on a contiguous buffer holding the same data, regardless of the
+    //:   sizes of the buffers of the blob.
+    //:
+    //: 2 Only the data bytes of the blob are considered; the capacity of the
+    //:   last data buffer beyond the length of the blob, and any buffers
+    //:   beyond the last data buffer, are ignored.
+    //:
+    //: 3 The optionally specified 'crc' is used as the starting point.
+    //:
+    //: 4 No memory is allocated.
+    //
+    // Plan:
+    //: 1 For blobs of various buffer sizes and lengths, including empty blobs
+    //:   and blobs having extra capacity, compare the CRC32-C calculated on
+    //:   the blob with the CRC32-C calculated by the software implementation
+    //:   on the same data, with and without a starting 'crc'.  (C-1..3)
+    //:
+    //: 2 Verify that the default allocator is not used.  (C-4)
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const bdlbb::Blob&, unsigned int);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "CALCULATE CRC32-C ON BLOB" << bsl::endl
+                           << "=========================" << bsl::endl;
+
+    const int BUFFER_SIZES[] = { 1, 3, 8, 64, 1000, 4096 };
+    const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES;
+
+    const int LENGTHS[] = { 0, 1, 2, 7, 8, 9, 63, 64, 65, 999, 1000, 1001,
+                            4095, 4096, 5000, 20000 };
+    const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    bsl::vector<char> data(20000, 0, pa);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(bsl::rand());
+    }
+
+    for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+        const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+        bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, pa);
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int LENGTH = LENGTHS[li];
+
+            if (veryVerbose) {
+                T_ P_(BUFFER_SIZE) P(LENGTH);
+            }
+
+            bdlbb::Blob blob(&factory, pa);
+            bdlbb::BlobUtil::append(&blob, data.data(), LENGTH);
+
+            // Add capacity beyond the data, possibly in extra buffers.
+
+            blob.setLength(LENGTH + BUFFER_SIZE + 1);
+            bsl::memset(blob.buffer(blob.numDataBuffers() - 1).data(),
+                        'Z',
+                        blob.lastDataBufferLength());
+            blob.setLength(LENGTH);
+
+            const unsigned int EXPECTED =
+                        Crc32c_Impl::calculateSoftware(data.data(), LENGTH);
+            const unsigned int EXPECTED_WITH_CRC =
+                        Crc32c_Impl::calculateSoftware(data.data(),
+                                                       LENGTH,
+                                                       0xDEADBEEF);
+
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            const unsigned int crc        = Crc32c::calculate(blob);
+            const unsigned int crcWithCrc = Crc32c::calculate(blob,
+                                                              0xDEADBEEF);
+
+            ASSERTV(BUFFER_SIZE, LENGTH, crc, EXPECTED, EXPECTED == crc);
+            ASSERTV(BUFFER_SIZE, LENGTH, crcWithCrc, EXPECTED_WITH_CRC,
+                    EXPECTED_WITH_CRC == crcWithCrc);
+            ASSERTV(BUFFER_SIZE, LENGTH, 0 == da.numBlocksTotal());
+        }
+    }
+}
+
+void test8_combine()
+    // ------------------------------------------------------------------------
+    // COMBINE CRC32-C VALUES
+    //
+    // Concerns:
+    //: 1 Combining the CRC32-C values of two buffers yields the CRC32-C value
+    //:   of their concatenation, for every split of a buffer.
+    //:
+    //: 2 Combining with the CRC32-C value of an empty buffer yields the
+    //:   other value.
+    //:
+    //: 3 Combining works for lengths too large to be calculated in a test,
+    //:   e.g., beyond 4GB.
+    //:
+    //: 4 Combining works for every bit of the length, including lengths of
+    //:   2^29 bytes and more, for which x^(8 * lengthB) is formed from
+    //:   powers x^(2^k) with 'k >= 32'.
+    //
+    // Plan:
+    //: 1 For buffers of various lengths of random data, calculate the
+    //:   CRC32-C of every prefix and suffix, and verify that combining them
+    //:   yields the CRC32-C of the whole buffer.  (C-1..2)
+    //:
+    //: 2 Verify, for large lengths, that 'combine' is associative, and that
+    //:   it agrees with the definition for lengths that are sums of large
+    //:   powers of two, using buffers of zeros, whose CRC32-C values can be
+    //:   built up by combining smaller ones.  (C-3)
+    //:
+    //: 3 Compare 'combine' with 'slowCombine', which does not use the table
+    //:   of powers of the implementation, for lengths 2^k - 1, 2^k, and
+    //:   2^k + 1 for every 'k', and for pseudo-random lengths.  Also verify
+    //:   the combination with 2^29 zero bytes against a CRC32-C value
+    //:   calculated directly, 1MB at a time.  (C-4)
+    //
+    // Testing:
+    //   bdlde::Crc32c::combine(unsigned int, unsigned int, size_t);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "COMBINE CRC32-C VALUES" << bsl::endl
+                           << "======================" << bsl::endl;
+
+    bsl::vector<char> data(3000, 0, pa);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(bsl::rand());
+    }
+
+    const bsl::size_t LENGTHS[] = { 0, 1, 5, 16, 100, 1023, 3000 };
+    const int         NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    for (int li = 0; li < NUM_LENGTHS; ++li) {
+        const bsl::size_t  LENGTH   = LENGTHS[li];
+        const unsigned int EXPECTED = Crc32c::calculate(data.data(), LENGTH);
+
+        for (bsl::size_t split = 0; split <= LENGTH; ++split) {
+            const unsigned int crcA = Crc32c::calculate(data.data(), split);
+            const unsigned int crcB = Crc32c::calculate(data.data() + split,
+                                                        LENGTH - split);
+            const unsigned int crc  = Crc32c::combine(crcA,
+                                                      crcB,
+                                                      LENGTH - split);
+
+            ASSERTV(LENGTH, split, crc, EXPECTED, EXPECTED == crc);
+        }
+
+        ASSERTV(LENGTH, EXPECTED == Crc32c::combine(EXPECTED, 0, 0));
+        ASSERTV(LENGTH, EXPECTED == Crc32c::combine(0, EXPECTED, LENGTH));
+    }
+
+    // The CRC32-C of 2^(k + 1) zero bytes is the combination of the CRC32-C
+    // of 2^k zero bytes with itself.
+
+    const bsl::size_t  k_BLOCK = 1024;
+    const bsl::vector<char> zeros(k_BLOCK, 0, pa);
+
+    unsigned int zeroCrc[64];
+    zeroCrc[10] = Crc32c::calculate(zeros.data(), k_BLOCK);
+    for (int k = 11; k < 64; ++k) {
+        zeroCrc[k] = Crc32c::combine(zeroCrc[k - 1],
+                                     zeroCrc[k - 1],
+                                     static_cast<bsl::size_t>(1) << (k - 1));
+    }
+    for (int k = 10; k < 13; ++k) {
+        // Verify the doubling directly where feasible.
+
+        const bsl::size_t length = static_cast<bsl::size_t>(1) << k;
+        unsigned int      crc    = 0;
+        for (bsl::size_t i = 0; i < length; i += k_BLOCK) {
+            crc = Crc32c::calculate(zeros.data(), k_BLOCK, crc);
+        }
+        ASSERTV(k, crc, zeroCrc[k], zeroCrc[k] == crc);
+    }
+
+    const unsigned int crcA = Crc32c::calculate(data.data(), 1000);
+    const unsigned int crcB = Crc32c::calculate(data.data() + 1000, 1000);
+    const unsigned int crcC = Crc32c::calculate(data.data() + 2000, 1000);
+
+    for (int k = 30; k < 40; ++k) {
+        // 'crcA', then 2^k zero bytes, then 'crcB'.
+
+        const bsl::size_t LARGE = static_cast<bsl::size_t>(1) << k;
+
+        const unsigned int crcAZ   = Crc32c::combine(crcA, zeroCrc[k], LARGE);
+        const unsigned int crcAZB  = Crc32c::combine(crcAZ, crcB, 1000);
+        const unsigned int crcZB   = Crc32c::combine(zeroCrc[k], crcB, 1000);
+        const unsigned int crcAZB2 = Crc32c::combine(crcA,
+                                                     crcZB,
+                                                     LARGE + 1000);
+        ASSERTV(k, crcAZB, crcAZB2, crcAZB == crcAZB2);
+
+        const unsigned int crcAZBC  = Crc32c::combine(crcAZB, crcC, 1000);
+        const unsigned int crcBC    = Crc32c::combine(crcB, crcC, 1000);
+        const unsigned int crcAZBC2 = Crc32c::combine(crcAZ, crcBC, 2000);
+        ASSERTV(k, crcAZBC, crcAZBC2, crcAZBC == crcAZBC2);
+    }
+
+    if (verbose) bsl::cout << "Compare with a slow reference." << bsl::endl;
+
+    for (bsl::size_t i = 1; i < data.size(); ++i) {
+        ASSERTV(i, slowCombine(crcA, crcB, i) == Crc32c::combine(crcA,
+                                                                 crcB,
+                                                                 i));
+    }
+
+    const int k_BITS = static_cast<int>(sizeof(bsl::size_t) * 8);
+    for (int k = 0; k < k_BITS; ++k) {
+        const bsl::size_t POWER = static_cast<bsl::size_t>(1) << k;
+
+        ASSERTV(k, slowCombine(crcA, crcB, POWER - 1) ==
+                                    Crc32c::combine(crcA, crcB, POWER - 1));
+        ASSERTV(k, slowCombine(crcA, crcB, POWER) ==
+                                        Crc32c::combine(crcA, crcB, POWER));
+        ASSERTV(k, slowCombine(crcA, crcB, POWER + 1) ==
+                                    Crc32c::combine(crcA, crcB, POWER + 1));
+    }
+
+    bsls::Types::Uint64 seed = 0x9E3779B9;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        const bsl::size_t length = static_cast<bsl::size_t>(seed >> 1);
+
+        ASSERTV(length, slowCombine(crcA, crcB, length) ==
+                                       Crc32c::combine(crcA, crcB, length));
+    }
+
+    if (verbose) bsl::cout << "Combine with 2^29 zero bytes." << bsl::endl;
+    {
+        const bsl::size_t       k_CHUNK = 1 << 20;
+        const bsl::size_t       LARGE   = static_cast<bsl::size_t>(1) << 29;
+        const bsl::vector<char> bigZeros(k_CHUNK, 0, pa);
+
+        unsigned int crcZ  = 0;
+        unsigned int crcAZ = crcA;
+        for (bsl::size_t i = 0; i < LARGE; i += k_CHUNK) {
+            crcZ  = Crc32c::calculate(bigZeros.data(), k_CHUNK, crcZ);
+            crcAZ = Crc32c::calculate(bigZeros.data(), k_CHUNK, crcAZ);
+        }
+
+        ASSERTV(crcZ, zeroCrc[29], zeroCrc[29] == crcZ);
+        ASSERTV(crcAZ, crcAZ == Crc32c::combine(crcA, crcZ, LARGE));
+    }
+}
+
+void test9_calculateHardwareVector()
+    // ------------------------------------------------------------------------
+    // CALCULATE CRC32-C USING HARDWARE VECTOR INSTRUCTIONS
+    //
+    // Concerns:
+    //: 1 'calculateHardwareVector' yields the same result as the software
+    //:   implementation for all lengths, including lengths that are not
+    //:   multiples of the sizes of the blocks folded at a time, and for data
+    //:   that is not aligned.
+    //:
+    //: 2 The optionally specified 'crc' is used as the starting point.
+    //:
+    //: 3 'Crc32c::calculate' yields the same result around
+    //:   'k_VECTOR_THRESHOLD'.
+    //
+    // Plan:
+    //: 1 For every length up to several times the size of the main loop
+    //:   block, and for several misalignments, compare the results of
+    //:   'calculateHardwareVector' and 'Crc32c::calculate' with those of
+    //:   'calculateSoftware', with various starting 'crc' values.  (C-1..3)
+    //
+    // Testing:
+    //   bdlde::Crc32c_Impl::calculateHardwareVector(const void *,size_t,uint);
+    //   bool bdlde::Crc32c_Impl::isHardwareVectorSupported();
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+       << bsl::endl
+       << "CALCULATE CRC32-C USING HARDWARE VECTOR INSTRUCTIONS" << bsl::endl
+       << "====================================================" << bsl::endl;
+
+    if (verbose) {
+        P(Crc32c_Impl::isHardwareVectorSupported());
+    }
+
+    const bsl::size_t k_MAX_LENGTH = 3 * Crc32c_Impl::k_VECTOR_THRESHOLD;
+
+    bsl::vector<char> data(k_MAX_LENGTH + 8, 0, pa);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<char>(bsl::rand());
+    }
+
+    const unsigned int CRCS[] = { 0, 1, 0xFFFFFFFF, 0x12345678 };
+    const int          NUM_CRCS = sizeof CRCS / sizeof *CRCS;
+
+    for (bsl::size_t offset = 0; offset < 8; offset += 3) {
+        for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+            const char         *BUFFER = data.data() + offset;
+            const unsigned int  CRC    = CRCS[length % NUM_CRCS];
+
+            const unsigned int EXPECTED =
+                        Crc32c_Impl::calculateSoftware(BUFFER, length, CRC);
+
+            const unsigned int crcVector =
+                  Crc32c_Impl::calculateHardwareVector(BUFFER, length, CRC);
+            const unsigned int crcDefault =
+                                    Crc32c::calculate(BUFFER, length, CRC);
+
+            ASSERTV(offset, length, crcVector, EXPECTED,
+                    EXPECTED == crcVector);
+            ASSERTV(offset, length, crcDefault, EXPECTED,
+                    EXPECTED == crcDefault);
+        }
+    }
+}
+
 void testN1_performanceDefault()
     // ------------------------------------------------------------------------
     // PERFORMANCE: CALCULATE CRC32-C ON BUFFER DEFAULT
@@ -1831,6 +2199,86 @@ void testN5_performanceDefaultUserInput()
          << "\n\n";
 }
 
+void testN6_calculateHardwareVector()
+    // ------------------------------------------------------------------------
+    // PERFORMANCE: CALCULATE CRC32-C DEFAULT & HARDWARE VECTOR
+    //
+    // Concerns:
+    //: 1 Test the performance of
+    //:   'bdlde::Crc32c::calculate(const void *, size_t length)'
+    //:   and compare it to the performance of
+    //:   'bdlde::Crc32c_Impl::calculateHardwareVector(const void *, size_t)',
+    //:   in particular around 'Crc32c_Impl::k_VECTOR_THRESHOLD'.
+    //
+    // Plan:
+    //: 1 Time a large number of crc32c calculations for buffers of varying
+    //:   sizes, single threaded.
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
+    //   bdlde::Crc32c_Impl::calculateHardwareVector(const void *,size_t,uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+              << bsl::endl
+              << "PERFORMANCE: CALCULATE CRC32-C DEFAULT & HARDWARE VECTOR\n"
+              << "========================================================\n";
+
+    bsl::cout << "Hardware vector supported: "
+              << Crc32c_Impl::isHardwareVectorSupported() << bsl::endl;
+
+    bsl::vector<int> bufferLengths(pa);
+    const int        k_MAX_SIZE = populateBufferLengthsSorted(&bufferLengths);
+
+    char *buffer = static_cast<char *>(pa->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    bsl::vector<TableRecord> tableRecords(pa);
+    for (unsigned i = 0; i < bufferLengths.size(); ++i) {
+        const int length = bufferLengths[i];
+
+        // Keep the total amount of data checksummed roughly constant.
+
+        const int k_NUM_ITERS = bsl::max(10, (1 << 28) / (length + 64));
+
+        unsigned int crcDefault = 0;
+        bsls::Types::Int64 startDef = bsls::TimeUtil::getTimer();
+        for (int k = 0; k < k_NUM_ITERS; ++k) {
+            crcDefault = Crc32c::calculate(buffer, length);
+        }
+        bsls::Types::Int64 endDef = bsls::TimeUtil::getTimer();
+
+        unsigned int crcVector = 0;
+        bsls::Types::Int64 startVec = bsls::TimeUtil::getTimer();
+        for (int k = 0; k < k_NUM_ITERS; ++k) {
+            crcVector = Crc32c_Impl::calculateHardwareVector(buffer, length);
+        }
+        bsls::Types::Int64 endVec = bsls::TimeUtil::getTimer();
+
+        ASSERTV(length, crcDefault, crcVector, crcDefault == crcVector);
+
+        TableRecord record;
+        record.d_size    = length;
+        record.d_timeOne = (endDef - startDef) / k_NUM_ITERS;
+        record.d_timeTwo = (endVec - startVec) / k_NUM_ITERS;
+        record.d_ratio   =  static_cast<double>(record.d_timeOne)
+                          / static_cast<double>(bsl::max<bsls::Types::Int64>(
+                                                         record.d_timeTwo, 1));
+
+        tableRecords.push_back(record);
+    }
+
+    bsl::vector<bsl::string> headerCols(pa);
+    headerCols.emplace_back("Size(B)");
+    headerCols.emplace_back("Default time(ns)");
+    headerCols.emplace_back("Vector time(ns)");
+    headerCols.emplace_back("Ratio(Default / Vector)");
+
+    printTable(bsl::cout, headerCols, tableRecords);
+
+    pa->deallocate(buffer);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1864,20 +2312,20 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 10: {
         // --------------------------------------------------------------------
-        // TESTING USAGE EXAMPLE 1
+        // TESTING USAGE EXAMPLES
         //
         // Concerns:
-        //   The usage example provided in the component header file must
+        //   The usage examples provided in the component header file must
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example 1
+        //   Run the usage examples 1 and 2
         // --------------------------------------------------------------------
 
-        if (verbose) cout << "\nTesting Usage Example 1"
-                          << "\n=======================" << endl;
+        if (verbose) cout << "\nTesting Usage Examples"
+                          << "\n======================" << endl;
 
 ///Example 1: Computing and updating a checksum
 /// - - - - - - - - - - - - - - - - - - - - - -
@@ -1906,6 +2354,44 @@ int main(int argc, char* argv[])
                                             newChunk.size(),
                                             checksum);
 //..
+//
+///Example 2: Checksumming a large buffer in parts
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// The following code illustrates how the checksum of a large buffer can be
+// calculated from the checksums of its parts, which may have been calculated
+// independently, for example by several threads.
+//
+// First, prepare a buffer and split it into two parts:
+//..
+        bsl::vector<char> buffer(100000, 'x');
+
+        const bsl::size_t lengthA = 60000;
+        const bsl::size_t lengthB = buffer.size() - lengthA;
+//..
+// Then, calculate the checksum of each part independently:
+//..
+        const unsigned int crcA = bdlde::Crc32c::calculate(buffer.data(),
+                                                           lengthA);
+        const unsigned int crcB = bdlde::Crc32c::calculate(
+                                                       buffer.data() + lengthA,
+                                                       lengthB);
+//..
+// Finally, combine the two checksums and verify that the result is the
+// checksum of the whole buffer:
+//..
+        const unsigned int crc = bdlde::Crc32c::combine(crcA, crcB, lengthB);
+
+        ASSERT(bdlde::Crc32c::calculate(buffer.data(), buffer.size()) == crc);
+//..
+      } break;
+      case  9: {
+        test9_calculateHardwareVector();
+      } break;
+      case  8: {
+        test8_combine();
+      } break;
+      case  7: {
+        test7_calculateOnBlob();
       } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
@@ -1940,6 +2426,9 @@ int main(int argc, char* argv[])
       case -5: {
         testN5_performanceDefaultUserInput();
       } break;
+      case -6: {
+        testN6_calculateHardwareVector();
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -14,7 +14,9 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -25,6 +27,20 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
 #define LIKELY(  EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_LIKELY(EXPRESSION)
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define U_X86_SIMD
+    // The vectorized implementations are compiled using function-level
+    // 'target' attributes, so that no special compiler options are needed and
+    // the same object code runs on processors lacking the extensions.
+#endif
+#endif
+
+#if defined(U_X86_SIMD)
+#include <immintrin.h>
+#endif
+
 // LOCAL CONSTANTS
 
 namespace {
@@ -543,6 +559,585 @@ static int validateAndCountCodePoints(const char             **invalidString,
 }
 
 
+                       // -----------------------------
+                       // Vectorized Validation Kernels
+                       // -----------------------------
+
+// The vectorized kernels implement the "lookup" algorithm described in
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser and
+// Lemire, 2021): each byte is classified, together with the byte preceding
+// it, using three 16-entry tables indexed by nibbles, where every bit of a
+// table entry denotes one kind of error.  A byte pair is invalid if the
+// classes of its three nibbles share an error bit, except that the 'k_TWO_C'
+// bit must be set exactly for the 3rd and 4th bytes of multi-byte sequences.
+//
+// The kernels only *detect* errors.  On detecting an error in a block, they
+// back up to the start of a code point preceding that block and let the
+// scalar implementation, which is at most a few bytes behind the error,
+// determine the exact position and kind of the error, so that the results of
+// all implementations are identical.
+
+enum {
+    k_TOO_SHORT = 1 << 0,  // lead byte followed by non-continuation
+    k_TOO_LONG  = 1 << 1,  // ASCII followed by continuation
+    k_OVER_3    = 1 << 2,  // overlong 3-byte sequence
+    k_TOO_LARGE = 1 << 3,  // value larger than 0x10ffff
+    k_SURR      = 1 << 4,  // surrogate
+    k_OVER_2    = 1 << 5,  // overlong 2-byte sequence
+    k_LARGE_1K  = 1 << 6,  // value larger than 0x10ffff (with 'k_TOO_LARGE')
+    k_OVER_4    = 1 << 6,  // overlong 4-byte sequence
+    k_TWO_C     = 1 << 7,  // continuation followed by continuation
+    k_CARRY     = k_TOO_SHORT | k_TOO_LONG | k_TWO_C
+};
+
+#define U_BYTE_1_HIGH                                                         \
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,                           \
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,                           \
+    k_TWO_C, k_TWO_C, k_TWO_C, k_TWO_C,                                       \
+    k_TOO_SHORT | k_OVER_2,                                                   \
+    k_TOO_SHORT,                                                              \
+    k_TOO_SHORT | k_OVER_3 | k_SURR,                                          \
+    k_TOO_SHORT | k_TOO_LARGE | k_LARGE_1K | k_OVER_4
+    // error classes of the high nibble of the first byte of a pair
+
+#define U_BYTE_1_LOW                                                          \
+    k_CARRY | k_OVER_3 | k_OVER_2 | k_OVER_4,                                 \
+    k_CARRY | k_OVER_2,                                                       \
+    k_CARRY,                                                                  \
+    k_CARRY,                                                                  \
+    k_CARRY | k_TOO_LARGE,                                                    \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K | k_SURR,                              \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K,                                       \
+    k_CARRY | k_TOO_LARGE | k_LARGE_1K
+    // error classes of the low nibble of the first byte of a pair
+
+#define U_BYTE_2_HIGH                                                         \
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,                       \
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,                       \
+    k_TOO_LONG | k_OVER_2 | k_TWO_C | k_OVER_3 | k_LARGE_1K | k_OVER_4,       \
+    k_TOO_LONG | k_OVER_2 | k_TWO_C | k_OVER_3 | k_TOO_LARGE,                 \
+    k_TOO_LONG | k_OVER_2 | k_TWO_C | k_SURR   | k_TOO_LARGE,                 \
+    k_TOO_LONG | k_OVER_2 | k_TWO_C | k_SURR   | k_TOO_LARGE,                 \
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT
+    // error classes of the high nibble of the second byte of a pair
+
+static
+Utf8Util::IntPtr resumeScalar(const char             **invalidString,
+                              const char              *string,
+                              bsls::Types::size_type   length,
+                              const char              *block,
+                              Utf8Util::IntPtr         numContinuations)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if it is valid UTF-8, and a negative
+    // value, loading the address of the first invalid sequence into the
+    // specified 'invalidString', otherwise, given that the specified 'block'
+    // is the address within 'string' of the first block in which a vectorized
+    // kernel detected an error, and that the specified 'numContinuations' is
+    // the number of continuation bytes preceding 'block'.  The behavior is
+    // undefined unless all code points ending more than 3 bytes before
+    // 'block' are valid.
+{
+    // Back up to the first code point starting in the 3 bytes preceding
+    // 'block'; any code point starting before it ends before it and was
+    // validated.
+
+    const char *pc = block - string > 3 ? block - 3 : string;
+    while (pc < block && !isNotContinuation(*pc)) {
+        ++pc;
+    }
+    for (const char *pi = pc; pi < block; ++pi) {
+        numContinuations -= !isNotContinuation(*pi);
+    }
+
+    const int rc = validateAndCountCodePoints(invalidString,
+                                              pc,
+                                              length - (pc - string));
+    if (rc < 0) {
+        return rc;                                                    // RETURN
+    }
+    return (pc - string) - numContinuations + rc;
+}
+
+#if defined(U_X86_SIMD)
+
+static inline __attribute__((target("sse4.2,popcnt")))
+__m128i sse42Lookup(__m128i table, __m128i nibbles)
+    // Return the bytes of the specified 'table' indexed by the corresponding
+    // bytes of the specified 'nibbles', each of which must be in '[0 .. 15]'.
+{
+    return _mm_shuffle_epi8(table, nibbles);
+}
+
+static inline __attribute__((target("sse4.2,popcnt")))
+__m128i sse42High(__m128i input)
+    // Return the high nibble of each byte in the specified 'input'.
+{
+    return _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0f));
+}
+
+static inline __attribute__((target("sse4.2,popcnt")))
+int sse42NumContinuations(__m128i input)
+    // Return the number of continuation bytes in the specified 'input'.
+{
+    // A continuation byte, in '[0x80 .. 0xbf]', is less than -64 as a signed
+    // byte.
+
+    return __builtin_popcount(_mm_movemask_epi8(
+                                  _mm_cmpgt_epi8(_mm_set1_epi8(-64), input)));
+}
+
+static __attribute__((target("sse4.2,popcnt")))
+Utf8Util::IntPtr validateAndCountSse42(const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if 'string' contains valid UTF-8, and a
+    // negative value, loading the address of the first invalid sequence into
+    // the specified 'invalidString', otherwise, using SSE4.2 instructions.
+{
+    const __m128i byte1High = _mm_setr_epi8(U_BYTE_1_HIGH);
+    const __m128i byte1Low  = _mm_setr_epi8(U_BYTE_1_LOW);
+    const __m128i byte2High = _mm_setr_epi8(U_BYTE_2_HIGH);
+    const __m128i maxTail   = _mm_setr_epi8(
+                                  -1, -1, -1, -1, -1, -1, -1, -1,
+                                  -1, -1, -1, -1, -1,
+                                  static_cast<char>(0xf0 - 1),
+                                  static_cast<char>(0xe0 - 1),
+                                  static_cast<char>(0xc0 - 1));
+    const __m128i thirdByte  = _mm_set1_epi8(static_cast<char>(0xe0 - 0x80));
+    const __m128i fourthByte = _mm_set1_epi8(static_cast<char>(0xf0 - 0x80));
+    const __m128i highBit    = _mm_set1_epi8(static_cast<char>(0x80));
+
+    const char *const end              = string + length;
+    const char       *pc               = string;
+    Utf8Util::IntPtr  numContinuations = 0;
+    __m128i           prevInput        = _mm_setzero_si128();
+    __m128i           prevIncomplete   = _mm_setzero_si128();
+
+    while (pc < end) {
+        __m128i input;
+        if (end - pc >= 16) {
+            input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pc));
+        }
+        else {
+            char tail[16] = { 0 };
+            bsl::memcpy(tail, pc, end - pc);
+            input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tail));
+        }
+
+        __m128i error;
+        if (0 == _mm_movemask_epi8(input)) {
+            // All ASCII: only a sequence left incomplete by the previous
+            // block can be in error.
+
+            error = prevIncomplete;
+        }
+        else {
+            const __m128i prev1 = _mm_alignr_epi8(input, prevInput, 15);
+            const __m128i prev2 = _mm_alignr_epi8(input, prevInput, 14);
+            const __m128i prev3 = _mm_alignr_epi8(input, prevInput, 13);
+
+            const __m128i special = _mm_and_si128(
+                _mm_and_si128(
+                    sse42Lookup(byte1High, sse42High(prev1)),
+                    sse42Lookup(byte1Low,
+                                _mm_and_si128(prev1, _mm_set1_epi8(0x0f)))),
+                sse42Lookup(byte2High, sse42High(input)));
+
+            // Exactly the 3rd and 4th bytes of a sequence must have the
+            // 'k_TWO_C' bit set.
+
+            const __m128i must23 = _mm_or_si128(
+                                           _mm_subs_epu8(prev2, thirdByte),
+                                           _mm_subs_epu8(prev3, fourthByte));
+
+            error = _mm_xor_si128(_mm_and_si128(must23, highBit), special);
+
+            prevIncomplete = _mm_subs_epu8(input, maxTail);
+        }
+
+        if (UNLIKELY(!_mm_testz_si128(error, error))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            return resumeScalar(invalidString,
+                                string,
+                                length,
+                                pc,
+                                numContinuations);                    // RETURN
+        }
+
+        numContinuations += sse42NumContinuations(input);
+        prevInput         = input;
+        pc               += end - pc >= 16 ? 16 : end - pc;
+    }
+
+    if (UNLIKELY(!_mm_testz_si128(prevIncomplete, prevIncomplete))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return resumeScalar(invalidString,
+                            string,
+                            length,
+                            end,
+                            numContinuations);                        // RETURN
+    }
+
+    return length - numContinuations;
+}
+
+static __attribute__((target("sse4.2,popcnt")))
+Utf8Util::IntPtr numContinuationsSse42(const char             *string,
+                                       bsls::Types::size_type  length)
+    // Return the number of continuation bytes in the specified 'string'
+    // having the specified 'length', using SSE4.2 instructions.
+{
+    const char *const end    = string + length;
+    Utf8Util::IntPtr  result = 0;
+
+    for (; end - string >= 16; string += 16) {
+        result += sse42NumContinuations(
+                  _mm_loadu_si128(reinterpret_cast<const __m128i *>(string)));
+    }
+    for (; string < end; ++string) {
+        result += !isNotContinuation(*string);
+    }
+
+    return result;
+}
+
+static inline __attribute__((target("avx2,popcnt")))
+__m256i avx2Lookup(__m256i table, __m256i nibbles)
+    // Return the bytes of the specified 'table' indexed by the corresponding
+    // bytes of the specified 'nibbles', each of which must be in '[0 .. 15]'.
+    // Note that 'table' must hold the same 16 entries in both of its lanes.
+{
+    return _mm256_shuffle_epi8(table, nibbles);
+}
+
+static inline __attribute__((target("avx2,popcnt")))
+__m256i avx2High(__m256i input)
+    // Return the high nibble of each byte in the specified 'input'.
+{
+    return _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                            _mm256_set1_epi8(0x0f));
+}
+
+static inline __attribute__((target("avx2,popcnt")))
+int avx2NumContinuations(__m256i input)
+    // Return the number of continuation bytes in the specified 'input'.
+{
+    return __builtin_popcount(static_cast<unsigned int>(
+                _mm256_movemask_epi8(
+                     _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), input))));
+}
+
+static __attribute__((target("avx2,popcnt")))
+Utf8Util::IntPtr validateAndCountAvx2(const char             **invalidString,
+                                      const char              *string,
+                                      bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if 'string' contains valid UTF-8, and a
+    // negative value, loading the address of the first invalid sequence into
+    // the specified 'invalidString', otherwise, using AVX2 instructions.
+{
+    const __m256i byte1High = _mm256_setr_epi8(U_BYTE_1_HIGH, U_BYTE_1_HIGH);
+    const __m256i byte1Low  = _mm256_setr_epi8(U_BYTE_1_LOW,  U_BYTE_1_LOW);
+    const __m256i byte2High = _mm256_setr_epi8(U_BYTE_2_HIGH, U_BYTE_2_HIGH);
+    const __m256i maxTail   = _mm256_setr_epi8(
+                                  -1, -1, -1, -1, -1, -1, -1, -1,
+                                  -1, -1, -1, -1, -1, -1, -1, -1,
+                                  -1, -1, -1, -1, -1, -1, -1, -1,
+                                  -1, -1, -1, -1, -1,
+                                  static_cast<char>(0xf0 - 1),
+                                  static_cast<char>(0xe0 - 1),
+                                  static_cast<char>(0xc0 - 1));
+    const __m256i thirdByte  = _mm256_set1_epi8(
+                                           static_cast<char>(0xe0 - 0x80));
+    const __m256i fourthByte = _mm256_set1_epi8(
+                                           static_cast<char>(0xf0 - 0x80));
+    const __m256i highBit    = _mm256_set1_epi8(static_cast<char>(0x80));
+
+    const char *const end              = string + length;
+    const char       *pc               = string;
+    Utf8Util::IntPtr  numContinuations = 0;
+    __m256i           prevInput        = _mm256_setzero_si256();
+    __m256i           prevIncomplete   = _mm256_setzero_si256();
+
+    while (pc < end) {
+        __m256i input;
+        if (end - pc >= 32) {
+            input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pc));
+        }
+        else {
+            char tail[32] = { 0 };
+            bsl::memcpy(tail, pc, end - pc);
+            input = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(tail));
+        }
+
+        __m256i error;
+        if (0 == _mm256_movemask_epi8(input)) {
+            error = prevIncomplete;
+        }
+        else {
+            // Shifting across the two 128-bit lanes requires the upper lane
+            // of the previous block next to the lower lane of this one.
+
+            const __m256i carried = _mm256_permute2x128_si256(prevInput,
+                                                              input,
+                                                              0x21);
+            const __m256i prev1 = _mm256_alignr_epi8(input, carried, 15);
+            const __m256i prev2 = _mm256_alignr_epi8(input, carried, 14);
+            const __m256i prev3 = _mm256_alignr_epi8(input, carried, 13);
+
+            const __m256i special = _mm256_and_si256(
+                _mm256_and_si256(
+                    avx2Lookup(byte1High, avx2High(prev1)),
+                    avx2Lookup(byte1Low,
+                               _mm256_and_si256(prev1,
+                                                _mm256_set1_epi8(0x0f)))),
+                avx2Lookup(byte2High, avx2High(input)));
+
+            const __m256i must23 = _mm256_or_si256(
+                                        _mm256_subs_epu8(prev2, thirdByte),
+                                        _mm256_subs_epu8(prev3, fourthByte));
+
+            error = _mm256_xor_si256(_mm256_and_si256(must23, highBit),
+                                     special);
+
+            prevIncomplete = _mm256_subs_epu8(input, maxTail);
+        }
+
+        if (UNLIKELY(!_mm256_testz_si256(error, error))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            return resumeScalar(invalidString,
+                                string,
+                                length,
+                                pc,
+                                numContinuations);                    // RETURN
+        }
+
+        numContinuations += avx2NumContinuations(input);
+        prevInput         = input;
+        pc               += end - pc >= 32 ? 32 : end - pc;
+    }
+
+    if (UNLIKELY(!_mm256_testz_si256(prevIncomplete, prevIncomplete))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return resumeScalar(invalidString,
+                            string,
+                            length,
+                            end,
+                            numContinuations);                        // RETURN
+    }
+
+    return length - numContinuations;
+}
+
+static __attribute__((target("avx2,popcnt")))
+Utf8Util::IntPtr numContinuationsAvx2(const char             *string,
+                                      bsls::Types::size_type  length)
+    // Return the number of continuation bytes in the specified 'string'
+    // having the specified 'length', using AVX2 instructions.
+{
+    const char *const end    = string + length;
+    Utf8Util::IntPtr  result = 0;
+
+    for (; end - string >= 32; string += 32) {
+        result += avx2NumContinuations(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(string)));
+    }
+    for (; string < end; ++string) {
+        result += !isNotContinuation(*string);
+    }
+
+    return result;
+}
+
+#endif  // U_X86_SIMD
+
+#undef U_BYTE_1_HIGH
+#undef U_BYTE_1_LOW
+#undef U_BYTE_2_HIGH
+
+typedef bdlde::Utf8Util_Impl Utf8Util_Impl;
+
+enum {
+    k_MIN_VECTOR_LENGTH = 16  // shorter strings are always handled by the
+                              // scalar implementation
+};
+
+static bsls::AtomicOperations::AtomicTypes::Int s_selectedKernel = { -1 };
+    // the kernel used by 'Utf8Util', or -1 if not yet determined
+
+static inline
+Utf8Util_Impl::Kernel detectedKernel()
+    // Return the widest kernel supported by the running processor.
+{
+    int kernel = bsls::AtomicOperations::getIntRelaxed(&s_selectedKernel);
+    if (UNLIKELY(kernel < 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Racing threads store the same value.
+
+        kernel = Utf8Util_Impl::isKernelSupported(Utf8Util_Impl::e_AVX2)
+               ? Utf8Util_Impl::e_AVX2
+               : Utf8Util_Impl::isKernelSupported(Utf8Util_Impl::e_SSE4_2)
+               ? Utf8Util_Impl::e_SSE4_2
+               : Utf8Util_Impl::e_SCALAR;
+
+        bsls::AtomicOperations::setIntRelaxed(&s_selectedKernel, kernel);
+    }
+
+    return static_cast<Utf8Util_Impl::Kernel>(kernel);
+}
+
+static
+Utf8Util::IntPtr validateAndCount(Utf8Util_Impl::Kernel    kernel,
+                                  const char             **invalidString,
+                                  const char              *string,
+                                  bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if 'string' contains valid UTF-8, and a
+    // negative value, loading the address of the first invalid sequence into
+    // the specified 'invalidString', otherwise, using the specified 'kernel'.
+{
+    switch (kernel) {
+#if defined(U_X86_SIMD)
+      case Utf8Util_Impl::e_AVX2: {
+        return validateAndCountAvx2(invalidString, string, length);
+                                                                      // RETURN
+      }
+      case Utf8Util_Impl::e_SSE4_2: {
+        return validateAndCountSse42(invalidString, string, length);
+                                                                      // RETURN
+      }
+#endif
+      default: {
+        return validateAndCountCodePoints(invalidString, string, length);
+                                                                      // RETURN
+      }
+    }
+}
+
+static
+Utf8Util::IntPtr numContinuations(Utf8Util_Impl::Kernel   kernel,
+                                  const char             *string,
+                                  bsls::Types::size_type  length)
+    // Return the number of continuation bytes in the specified 'string'
+    // having the specified 'length' using the specified 'kernel'.
+{
+    switch (kernel) {
+#if defined(U_X86_SIMD)
+      case Utf8Util_Impl::e_AVX2: {
+        return numContinuationsAvx2(string, length);                  // RETURN
+      }
+      case Utf8Util_Impl::e_SSE4_2: {
+        return numContinuationsSse42(string, length);                 // RETURN
+      }
+#endif
+      default: {
+        Utf8Util::IntPtr result = 0;
+        for (const char *end = string + length; string < end; ++string) {
+            result += !isNotContinuation(*string);
+        }
+        return result;                                                // RETURN
+      }
+    }
+}
+
+static inline
+bool isAsciiWord(const char *string)
+    // Return 'true' if none of the 8 bytes starting at the specified 'string'
+    // has its high bit set, and 'false' otherwise.
+{
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, string, sizeof word);
+    return 0 == (word & 0x8080808080808080ULL);
+}
+
+static
+Utf8Util::IntPtr countCodePointsRaw(const char             *string,
+                                    bsls::Types::size_type  length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length', which must contain valid UTF-8, one code
+    // point at a time.
+{
+    Utf8Util::IntPtr count = 0;
+
+    // Note that since we assume the string contains valid UTF-8, our work is
+    // very simple.
+
+    const char *const end = string + length;
+
+    while (string < end) {
+        switch (static_cast<unsigned char>(*string) >> 4) {
+          case 0: BSLA_FALLTHROUGH;
+          case 1: BSLA_FALLTHROUGH;
+          case 2: BSLA_FALLTHROUGH;
+          case 3: BSLA_FALLTHROUGH;
+          case 4: BSLA_FALLTHROUGH;
+          case 5: BSLA_FALLTHROUGH;
+          case 6: BSLA_FALLTHROUGH;
+          case 7: {
+            ++string;
+          } break;
+          case 0xc: BSLA_FALLTHROUGH;
+          case 0xd: {
+            BSLS_ASSERT(2 <= end - string);
+            string += 2;
+          } break;
+          case 0xe: {
+            BSLS_ASSERT(3 <= end - string);
+            string += 3;
+          } break;
+          default: {
+            BSLS_ASSERT(4 <= end - string);
+            string += 4;
+          } break;
+        }
+
+        ++count;
+    }
+
+    return count;
+}
+
+static
+Utf8Util::IntPtr validateAndCountNullTerminated(const char **invalidString,
+                                                const char  *string)
+    // Return the number of Unicode code points in the specified
+    // null-terminated 'string' if it contains valid UTF-8, and a negative
+    // value, loading the address of the first invalid sequence into the
+    // specified 'invalidString', otherwise.
+{
+    if (Utf8Util_Impl::e_SCALAR != detectedKernel()) {
+        // Finding the terminating null byte first and validating a known
+        // length is considerably faster than validating byte by byte.  Note
+        // that a sequence truncated by the null byte is reported identically
+        // by both approaches.
+
+        const bsls::Types::size_type length = bsl::strlen(string);
+        if (length >= k_MIN_VECTOR_LENGTH) {
+            return validateAndCount(detectedKernel(),
+                                    invalidString,
+                                    string,
+                                    length);                          // RETURN
+        }
+    }
+    return validateAndCountCodePoints(invalidString, string);
+}
+
+
 namespace BloombergLP {
 
 namespace bdlde {
@@ -813,6 +1408,18 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
           case 0x7: {
             // binary: 0xxxxxxx: ASCII and possible '\0'
 
+            // Skip whole words of ASCII starting at word boundaries, which
+            // makes long runs of ASCII cheap without slowing down text where
+            // ASCII and multi-byte code points are interspersed.
+
+            if (0 == (reinterpret_cast<bsls::Types::UintPtr>(next) & 7)) {
+                while (endOfInput - next >= 8
+                    && numCodePoints - ret > 8
+                    && isAsciiWord(next)) {
+                    ret  += 8;
+                    next += 8;
+                }
+            }
           } continue;
 
           case 0x8: BSLA_FALLTHROUGH;
@@ -1203,7 +1810,7 @@ bool Utf8Util::isValid(const char **invalidString, const char *string)
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string) >= 0;
+    return validateAndCountNullTerminated(invalidString, string) >= 0;
 }
 
 bool Utf8Util::isValid(const char **invalidString,
@@ -1214,6 +1821,12 @@ bool Utf8Util::isValid(const char **invalidString,
     BSLS_ASSERT(string || 0 == length);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
+    if (length >= k_MIN_VECTOR_LENGTH) {
+        return validateAndCount(detectedKernel(),
+                                invalidString,
+                                string,
+                                length) >= 0;                         // RETURN
+    }
     return validateAndCountCodePoints(invalidString, string, length) >= 0;
 }
 
@@ -1246,7 +1859,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string);
+    return validateAndCountNullTerminated(invalidString, string);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1257,6 +1870,12 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(string || 0 == length);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
+    if (length >= k_MIN_VECTOR_LENGTH) {
+        return validateAndCount(detectedKernel(),
+                                invalidString,
+                                string,
+                                length);                              // RETURN
+    }
     return validateAndCountCodePoints(invalidString, string, length);
 }
 
@@ -1314,44 +1933,18 @@ Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string,
 {
     BSLS_ASSERT(string || 0 == length);
 
-    IntPtr count = 0;
-
-    // Note that since we assume the string contains valid UTF-8, our work is
-    // very simple.
-
-    const char *const end = string + length;
+    if (length >= k_MIN_VECTOR_LENGTH) {
+        const Utf8Util_Impl::Kernel kernel = detectedKernel();
+        if (Utf8Util_Impl::e_SCALAR != kernel) {
+            // Every code point has exactly one byte that is not a
+            // continuation byte.
 
-    while (string < end) {
-        switch (static_cast<unsigned char>(*string) >> 4) {
-          case 0: BSLA_FALLTHROUGH;
-          case 1: BSLA_FALLTHROUGH;
-          case 2: BSLA_FALLTHROUGH;
-          case 3: BSLA_FALLTHROUGH;
-          case 4: BSLA_FALLTHROUGH;
-          case 5: BSLA_FALLTHROUGH;
-          case 6: BSLA_FALLTHROUGH;
-          case 7: {
-            ++string;
-          } break;
-          case 0xc: BSLA_FALLTHROUGH;
-          case 0xd: {
-            BSLS_ASSERT(2 <= end - string);
-            string += 2;
-          } break;
-          case 0xe: {
-            BSLS_ASSERT(3 <= end - string);
-            string += 3;
-          } break;
-          default: {
-            BSLS_ASSERT(4 <= end - string);
-            string += 4;
-          } break;
+            return length - numContinuations(kernel, string, length);
+                                                                      // RETURN
         }
-
-        ++count;
     }
 
-    return count;
+    return countCodePointsRaw(string, length);
 }
 
 Utf8Util::size_type Utf8Util::readIfValid(int            *status,
@@ -1559,6 +2152,66 @@ const char *Utf8Util::toAscii(IntPtr value)
 #undef  U_ASCII_CASE
 }
 
+                            // --------------------
+                            // struct Utf8Util_Impl
+                            // --------------------
+
+// CLASS METHODS
+bool Utf8Util_Impl::isKernelSupported(Kernel kernel)
+{
+    switch (kernel) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+#if defined(U_X86_SIMD)
+      case e_SSE4_2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2")
+            && __builtin_cpu_supports("popcnt");                      // RETURN
+      }
+      case e_AVX2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2")
+            && __builtin_cpu_supports("popcnt");                      // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+Utf8Util_Impl::IntPtr Utf8Util_Impl::numCodePointsIfValid(
+                                                Kernel       kernel,
+                                                const char **invalidString,
+                                                const char  *string,
+                                                size_type    length)
+{
+    BSLS_ASSERT(invalidString);
+    BSLS_ASSERT(string || 0 == length);
+    BSLS_ASSERT(isKernelSupported(kernel));
+
+    return validateAndCount(kernel, invalidString, string, length);
+}
+
+Utf8Util_Impl::IntPtr Utf8Util_Impl::numCodePointsRaw(Kernel      kernel,
+                                                      const char *string,
+                                                      size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+    BSLS_ASSERT(isKernelSupported(kernel));
+
+    if (e_SCALAR == kernel) {
+        return countCodePointsRaw(string, length);                    // RETURN
+    }
+    return length - numContinuations(kernel, string, length);
+}
+
+Utf8Util_Impl::Kernel Utf8Util_Impl::selectedKernel()
+{
+    return detectedKernel();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
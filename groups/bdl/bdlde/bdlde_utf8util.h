@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Utf8Util: namespace for utilities for UTF-8 encodings
+//  bdlde::Utf8Util_Impl: alternative implementations of 'Utf8Util' functions
 //
 //@DESCRIPTION: This component provides, within the 'bdlde::Utf8Util' 'struct',
 // a suite of static functions supporting UTF-8 encoded strings.  Two
@@ -78,6 +79,25 @@ BSLS_IDENT("$Id: $")
 // counterpart that takes a lone pointer to a null-terminated (C-style) string.
 // The behavior is always undefined if 0 is supplied for that lone pointer.
 //
+///Support for Hardware Acceleration
+///---------------------------------
+// Validating a string of known length and counting its code points
+// ('isValid', 'numCodePointsIfValid', and 'numCodePointsRaw') examine many
+// bytes at a time using vector instructions when building for x86-64 with a
+// compatible compiler (GCC or Clang).  The widest instruction set supported
+// by the running processor is detected at runtime, so the same binary runs
+// (using the portable implementation) on processors lacking the required
+// extensions:
+//: o AVX2 (32 bytes at a time) is used if available, else
+//: o SSE4.2 (16 bytes at a time) is used if available, else
+//: o the portable implementation is used.
+// Functions taking a null-terminated string determine its length first when a
+// vectorized implementation is in use.  The results, including the position
+// reported for invalid input, are identical for all implementations.  This
+// component additionally defines the struct 'bdlde::Utf8Util_Impl' to expose
+// the individual implementations; it should not be used other than to test
+// and benchmark.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -710,6 +730,61 @@ struct Utf8Util {
         // this utility.  See 'ErrorStatus'.
 };
 
+                            // ====================
+                            // struct Utf8Util_Impl
+                            // ====================
+
+struct Utf8Util_Impl {
+    // This 'struct' provides a namespace for the alternative implementations
+    // of the validating and counting functions of 'Utf8Util', which should
+    // not be used other than to test and benchmark.
+
+    // TYPES
+    typedef Utf8Util::size_type size_type;
+    typedef Utf8Util::IntPtr    IntPtr;
+
+    enum Kernel {
+        // Enumerate the implementations that may be selected.
+
+        e_SCALAR,   // portable, one code point at a time
+        e_SSE4_2,   // x86 SSE4.2, 16 bytes at a time
+        e_AVX2      // x86 AVX2, 32 bytes at a time
+    };
+
+    // CLASS METHODS
+    static bool isKernelSupported(Kernel kernel);
+        // Return 'true' if the specified 'kernel' is compiled into this
+        // library and supported by the processor on which this program is
+        // running, and 'false' otherwise.
+
+    static IntPtr numCodePointsIfValid(Kernel       kernel,
+                                       const char **invalidString,
+                                       const char  *string,
+                                       size_type    length);
+        // Return the number of Unicode code points in the specified 'string'
+        // having the specified 'length' (in bytes) if 'string' contains valid
+        // UTF-8, using the specified 'kernel', with no effect on the specified
+        // 'invalidString'.  Otherwise, return a negative value and load into
+        // 'invalidString' the address of the first byte of the first invalid
+        // sequence encountered.  The behavior is the same as that of
+        // 'Utf8Util::numCodePointsIfValid' taking a length.  The behavior is
+        // undefined unless 'isKernelSupported(kernel)' is 'true' and 'string'
+        // refers to an array of at least 'length' bytes.
+
+    static IntPtr numCodePointsRaw(Kernel      kernel,
+                                   const char *string,
+                                   size_type   length);
+        // Return the number of Unicode code points in the specified 'string'
+        // having the specified 'length' (in bytes), using the specified
+        // 'kernel'.  The behavior is undefined unless
+        // 'isKernelSupported(kernel)' is 'true' and 'string' contains valid
+        // UTF-8.
+
+    static Kernel selectedKernel();
+        // Return the implementation used by the functions of 'Utf8Util'
+        // running on this processor.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
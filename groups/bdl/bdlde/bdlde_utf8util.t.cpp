@@ -17,6 +17,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_log.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -83,7 +84,11 @@ using bsl::size_t;
 //:
 //: o Test case 14 is negative testing.
 //:
-//: o Test cases 15, 16, and 17 are USAGE EXAMPLES.
+//: o Test case 15 compares the vectorized implementations exposed by
+//:   'Utf8Util_Impl' with the scalar implementation on random valid and
+//:   corrupted strings.
+//:
+//: o Test cases 16, 17, and 18 are USAGE EXAMPLES.
 //
 //-----------------------------------------------------------------------------
 // To fit functions on one line, 'typedef const char cchar'.
@@ -147,15 +152,22 @@ using bsl::size_t;
 // [ 8] size_t readIfValid(int *, char *, size_t, streambuf *);
 // [ 9] IntPtr readIfValid(int *, cchar *, size_t, streambuf *);
 // [13] const char *toAscii(IntPtr);
+//
+// 'Utf8Util_Impl' class methods:
+// [15] bool isKernelSupported(Kernel);
+// [15] IntPtr numCodePointsIfValid(Kernel, cchar **, cchar *, size_t);
+// [15] IntPtr numCodePointsRaw(Kernel, cchar *, size_t);
+// [15] Kernel selectedKernel();
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
 // [14] NEGATIVE TESTING
-// [15] USAGE EXAMPLE 1
-// [16] USAGE EXAMPLE 2
-// [17] USAGE EXAMPLE 3
+// [16] USAGE EXAMPLE 1
+// [17] USAGE EXAMPLE 2
+// [18] USAGE EXAMPLE 3
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE OF 'Utf8Util_Impl' KERNELS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3026,7 +3038,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
         //
@@ -3108,7 +3120,7 @@ int main(int argc, char *argv[])
         ASSERT(out.length() == validLen);
         ASSERT(validChineseUtf8 == out);
       } break;
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -3221,7 +3233,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3341,6 +3353,147 @@ int main(int argc, char *argv[])
     ASSERT(invalidPosition == stringWithOverlong.data() + string.length());
 //..
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'Utf8Util_Impl'
+        //
+        // Concerns:
+        //: 1 Every kernel reported as supported returns, for valid input, the
+        //:   same number of code points as the scalar kernel.
+        //:
+        //: 2 Every kernel reported as supported returns, for invalid input,
+        //:   the same error status and the same address of the first invalid
+        //:   sequence as the scalar kernel, wherever in the input (relative to
+        //:   the block boundaries of the kernel) the error occurs.
+        //:
+        //: 3 Input that is truncated in the middle of a sequence, including at
+        //:   the end of a block, is reported as such.
+        //:
+        //: 4 'numCodePointsRaw' agrees with the scalar kernel on valid input.
+        //:
+        //: 5 The kernel used by 'Utf8Util' is supported.
+        //
+        // Plan:
+        //: 1 For each supported kernel, generate strings of random code points
+        //:   of all sizes, and of mostly ASCII code points, of lengths up to
+        //:   several blocks of the widest kernel, and compare the results of
+        //:   each kernel with those of the scalar kernel.  (C-1, 4)
+        //:
+        //: 2 For each such string, overwrite each byte in turn with each of a
+        //:   set of bytes likely to create invalid sequences, and compare the
+        //:   results, including the reported address, with those of the
+        //:   scalar kernel.  (C-2)
+        //:
+        //: 3 For each such string, compare the results on every prefix of the
+        //:   string.  (C-3)
+        //:
+        //: 4 Verify that 'selectedKernel' is supported.  (C-5)
+        //
+        // Testing:
+        //   bool isKernelSupported(Kernel);
+        //   IntPtr numCodePointsIfValid(Kernel, cchar **, cchar *, size_t);
+        //   IntPtr numCodePointsRaw(Kernel, cchar *, size_t);
+        //   Kernel selectedKernel();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Utf8Util_Impl'\n"
+                             "=======================\n";
+
+        typedef bdlde::Utf8Util_Impl Impl;
+
+        const Impl::Kernel KERNELS[] = { Impl::e_SSE4_2, Impl::e_AVX2 };
+        enum { NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+        const char CORRUPT[] = { '\x00', '\x7f', '\x80', '\xbf', '\xc0',
+                                 '\xc1', '\xc2', '\xdf', '\xe0', '\xed',
+                                 '\xef', '\xf0', '\xf4', '\xf5', '\xff' };
+        enum { NUM_CORRUPT = sizeof CORRUPT / sizeof *CORRUPT };
+
+        ASSERT(Impl::isKernelSupported(Impl::e_SCALAR));
+        ASSERT(Impl::isKernelSupported(Impl::selectedKernel()));
+
+        if (verbose) P(Impl::selectedKernel());
+
+        randAccum = 0;
+
+        for (int ki = 0; ki < NUM_KERNELS; ++ki) {
+            const Impl::Kernel KERNEL = KERNELS[ki];
+
+            if (!Impl::isKernelSupported(KERNEL)) {
+                if (verbose) cout << "Kernel " << KERNEL << " unsupported\n";
+                continue;
+            }
+
+            for (int ti = 0; ti < 400; ++ti) {
+                // Alternate between code points of all sizes and mostly
+                // ASCII, exercising the all-ASCII block path.
+
+                const bool  ASCII = ti & 1;
+                const int   NUM   = ti % 50 + 1;
+                bsl::string str;
+                for (int ii = 0; ii < NUM; ++ii) {
+                    str += utf8Encode(ASCII && randVal() % 8
+                                      ? randVal8(true)
+                                      : randValue(true, true));
+                }
+                const size_t LEN = str.length();
+
+                for (size_t len = 0; len <= LEN; ++len) {
+                    const char *expInvalid = 0;
+                    const char *invalid    = 0;
+
+                    const Obj::IntPtr EXP = Impl::numCodePointsIfValid(
+                                                                Impl::e_SCALAR,
+                                                                &expInvalid,
+                                                                str.data(),
+                                                                len);
+                    const Obj::IntPtr RESULT = Impl::numCodePointsIfValid(
+                                                                    KERNEL,
+                                                                    &invalid,
+                                                                    str.data(),
+                                                                    len);
+                    ASSERTV(KERNEL, ti, len, EXP, RESULT, EXP == RESULT);
+                    ASSERTV(KERNEL, ti, len, expInvalid == invalid);
+
+                    if (LEN == len) {
+                        ASSERTV(KERNEL, ti, 0 <= RESULT);
+                        ASSERTV(KERNEL, ti, EXP ==
+                                   Impl::numCodePointsRaw(KERNEL,
+                                                          str.data(),
+                                                          len));
+                        ASSERTV(KERNEL, ti, EXP ==
+                                   Impl::numCodePointsRaw(Impl::e_SCALAR,
+                                                          str.data(),
+                                                          len));
+                    }
+                }
+
+                for (size_t pos = 0; pos < LEN; ++pos) {
+                    for (int ci = 0; ci < NUM_CORRUPT; ++ci) {
+                        bsl::string corrupt(str);
+                        corrupt[pos] = CORRUPT[ci];
+
+                        const char *expInvalid = 0;
+                        const char *invalid    = 0;
+
+                        const Obj::IntPtr EXP = Impl::numCodePointsIfValid(
+                                                                Impl::e_SCALAR,
+                                                                &expInvalid,
+                                                                corrupt.data(),
+                                                                LEN);
+                        const Obj::IntPtr RESULT = Impl::numCodePointsIfValid(
+                                                                KERNEL,
+                                                                &invalid,
+                                                                corrupt.data(),
+                                                                LEN);
+                        ASSERTV(KERNEL, ti, pos, ci, EXP, RESULT,
+                                EXP == RESULT);
+                        ASSERTV(KERNEL, ti, pos, ci, expInvalid == invalid);
+                    }
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // NEGATIVE TESTING
@@ -6232,6 +6385,113 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF 'Utf8Util_Impl' KERNELS
+        //
+        // Concerns:
+        //: 1 The vectorized kernels validate and count code points faster than
+        //:   the scalar kernel for text in various scripts.
+        //
+        // Plan:
+        //: 1 Build corpora of ASCII text, of Latin text with occasional
+        //:   2-byte code points, of the multi-language prose in
+        //:   'utf8MultiLang', and of CJK text, and report the throughput of
+        //:   each supported kernel on each, and of 'Utf8Util' itself.
+        //
+        // Testing:
+        //   PERFORMANCE OF 'Utf8Util_Impl' KERNELS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE OF 'Utf8Util_Impl' KERNELS\n"
+                             "======================================\n";
+
+        typedef bdlde::Utf8Util_Impl Impl;
+
+        const Impl::Kernel KERNELS[] = { Impl::e_SCALAR,
+                                         Impl::e_SSE4_2,
+                                         Impl::e_AVX2 };
+        const char *const  NAMES[]   = { "scalar", "sse4.2", "avx2" };
+        enum { NUM_KERNELS = sizeof KERNELS / sizeof *KERNELS };
+
+        const size_t CORPUS_LENGTH = 1 << 20;
+
+        bsl::string ascii, latin, multi, cjk;
+        randAccum = 0;
+        while (ascii.length() < CORPUS_LENGTH) {
+            ascii += utf8Encode(' ' + randVal() % 95);
+        }
+        while (latin.length() < CORPUS_LENGTH) {
+            latin += utf8Encode(randVal() % 16 ? ' ' + randVal() % 95
+                                               : 0xc0 + randVal() % 0x40);
+        }
+        while (multi.length() < CORPUS_LENGTH) {
+            multi.append(reinterpret_cast<const char *>(utf8MultiLang),
+                         sizeof(utf8MultiLang) - 1);
+        }
+        while (cjk.length() < CORPUS_LENGTH) {
+            cjk += utf8Encode(0x4e00 + randVal() % 0x5000);
+        }
+
+        const struct {
+            const char        *d_name_p;
+            const bsl::string *d_corpus_p;
+        } CORPORA[] = {
+            { "ASCII",       &ascii },
+            { "Latin",       &latin },
+            { "multi-lang",  &multi },
+            { "CJK",         &cjk   }
+        };
+        enum { NUM_CORPORA = sizeof CORPORA / sizeof *CORPORA };
+
+        const int ITERATIONS = 200;
+
+        for (int ci = 0; ci < NUM_CORPORA; ++ci) {
+            const bsl::string& CORPUS = *CORPORA[ci].d_corpus_p;
+            const double       MB     = static_cast<double>(CORPUS.length()) *
+                                                       ITERATIONS / (1 << 20);
+
+            cout << CORPORA[ci].d_name_p << ":\n";
+
+            Obj::IntPtr expected = -1;
+            for (int ki = 0; ki < NUM_KERNELS; ++ki) {
+                if (!Impl::isKernelSupported(KERNELS[ki])) {
+                    continue;
+                }
+
+                Obj::IntPtr     result = 0;
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int ii = 0; ii < ITERATIONS; ++ii) {
+                    const char *invalid = 0;
+                    result = Impl::numCodePointsIfValid(KERNELS[ki],
+                                                        &invalid,
+                                                        CORPUS.data(),
+                                                        CORPUS.length());
+                }
+                timer.stop();
+
+                ASSERTV(ki, 0 < result);
+                ASSERTV(ki, expected, result, -1 == expected ||
+                                                         expected == result);
+                expected = result;
+
+                cout << "    " << NAMES[ki] << ": "
+                     << MB / timer.elapsedTime() << " MB/s\n";
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int ii = 0; ii < ITERATIONS; ++ii) {
+                const char *invalid = 0;
+                ASSERT(expected == Obj::numCodePointsIfValid(&invalid,
+                                                             CORPUS.c_str()));
+            }
+            timer.stop();
+            cout << "    null-terminated: " << MB / timer.elapsedTime()
+                 << " MB/s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -58,7 +58,12 @@ BSLS_IDENT("$Id: $")
 ///Thread Safety
 ///-------------
 // 'bdlma::ConcurrentMultipool' is *fully thread-safe*, meaning any operation
-// on the same object can be safely invoked from any thread.
+// on the same object can be safely invoked from any thread.  Each internal
+// 'bdlma::ConcurrentPool' caches free blocks for the threads using it once
+// they have contended on its free list (see
+// {'bdlma_concurrentpool'|Thread Caching}), so that threads allocating and
+// deallocating blocks concurrently rarely contend for the same free list,
+// while the pools of idle block sizes allocate no cache.
 //
 ///Configuration at Construction
 ///-----------------------------
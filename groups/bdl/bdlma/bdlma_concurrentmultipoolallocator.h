@@ -62,7 +62,9 @@ BSLS_IDENT("$Id: $")
 // non-virtual 'allocate' method on a 'bdlma::ConcurrentMultipool'.  However,
 // since 'bslma::Allocator *' is widely used across BDE interfaces,
 // 'bdlma::ConcurrentMultipoolAllocator' is more general purposed than a
-// 'bdlma::ConcurrentMultipool'.
+// 'bdlma::ConcurrentMultipool'.  Note that, as with a
+// 'bdlma::ConcurrentMultipool', free blocks are cached for the threads using
+// each internal pool (see {'bdlma_concurrentpool'|Thread Caching}).
 //
 ///Configuration at Construction
 ///-----------------------------
@@ -13,10 +13,13 @@
 BSLS_IDENT_RCSID(bdlma_concurrentpool_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_spinlock.h>
 
 #include <bslma_testallocator.h>  // for testing purpose only
 
@@ -56,6 +59,15 @@ enum {
                                // 'd_numObjects' becomes positive
 };
 
+bsls::AtomicInt g_nextMagazineIndex(0);
+    // Index of the magazine to be assigned to the next thread.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_threadMagazineIndex, -1);
+    // Index of the magazine assigned to the calling thread, or -1 if the
+    // calling thread has not yet been assigned a magazine.
+#endif
+
 }  // close unnamed namespace
 
 // implementation details of private support functions
@@ -136,83 +148,48 @@ namespace bdlma {
                            // class ConcurrentPool
                            // --------------------
 
-// PRIVATE MANIPULATORS
-void ConcurrentPool::replenish()
+// PRIVATE TYPES
+ConcurrentPool::Magazine::Magazine()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_numLoaded(0)
+, d_loaded_p(0)
+, d_full_p(0)
 {
-    replenishImp(reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
-                 &d_blockList,
-                 d_internalBlockSize,
-                 d_chunkSize);
-
-    if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
-     && d_chunkSize < d_maxBlocksPerChunk) {
-
-        if (d_chunkSize * 2 <= d_maxBlocksPerChunk) {
-            d_chunkSize = d_chunkSize * 2;
-        }
-        else {
-            d_chunkSize = d_maxBlocksPerChunk;
-        }
-    }
 }
 
-// CREATORS
-ConcurrentPool::ConcurrentPool(bsls::Types::size_type  blockSize,
-                               bslma::Allocator       *basicAllocator)
-: d_blockSize(blockSize)
-, d_chunkSize(k_INITIAL_CHUNK_SIZE)
-, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
-, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
-, d_freeList(0)
-, d_blockList(basicAllocator)
+ConcurrentPool::Cache::Cache()
+: d_depotBegin(0)
+, d_depotLength(0)
+, d_depotLock(bsls::SpinLock::s_unlocked)
 {
-    BSLS_ASSERT(1 <= blockSize);
-
-    d_internalBlockSize = computeInternalBlockSize(blockSize);
 }
 
-ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
-                               bsls::BlockGrowth::Strategy  growthStrategy,
-                               bslma::Allocator            *basicAllocator)
-: d_blockSize(blockSize)
-, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
-              ? k_MAX_CHUNK_SIZE : k_INITIAL_CHUNK_SIZE)
-, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
-, d_growthStrategy(growthStrategy)
-, d_freeList(0)
-, d_blockList(basicAllocator)
+// PRIVATE CLASS METHODS
+int ConcurrentPool::magazineIndex()
 {
-    BSLS_ASSERT(1 <= blockSize);
-
-    d_internalBlockSize = computeInternalBlockSize(blockSize);
-}
-
-ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
-                               bsls::BlockGrowth::Strategy  growthStrategy,
-                               int                          maxBlocksPerChunk,
-                               bslma::Allocator            *basicAllocator)
-: d_blockSize(blockSize)
-, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
-              ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
-, d_maxBlocksPerChunk(maxBlocksPerChunk)
-, d_growthStrategy(growthStrategy)
-, d_freeList(0)
-, d_blockList(basicAllocator)
-{
-    BSLS_ASSERT(1 <= blockSize);
-    BSLS_ASSERT(1 <= maxBlocksPerChunk);
-
-    d_internalBlockSize = computeInternalBlockSize(blockSize);
-}
-
-ConcurrentPool::~ConcurrentPool()
-{
-    BSLS_ASSERT(static_cast<int>(sizeof(LLink)) <= d_internalBlockSize);
-    BSLS_ASSERT(0 != d_chunkSize);
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (0 > g_threadMagazineIndex) {
+        g_threadMagazineIndex = static_cast<unsigned int>(
+                                      g_nextMagazineIndex.addRelaxed(1) - 1)
+                              % k_NUM_MAGAZINES;
+    }
+    return g_threadMagazineIndex;
+#else
+    // Without compiler-supported thread-local storage, derive the magazine
+    // from the thread id.  Distinct threads may then share a magazine even
+    // when there are fewer threads than magazines, which costs only
+    // contention on the lock of the magazine.
+
+    bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    id ^= id >> 32;
+    id ^= id >> 16;
+    id ^= id >> 8;
+    return static_cast<int>(id % k_NUM_MAGAZINES);
+#endif
 }
 
-// MANIPULATORS
-void *ConcurrentPool::allocate()
+// PRIVATE MANIPULATORS
+void *ConcurrentPool::allocateShared()
 {
     Link *p;
     for (;;) {
@@ -274,6 +251,8 @@ void *ConcurrentPool::allocate()
         }
 
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_isContended.storeRelaxed(true);
+
         for (;;) {
             int refCount = bsls::AtomicOperations::getInt(&p->d_refCount);
 
@@ -303,44 +282,314 @@ void *ConcurrentPool::allocate()
     return static_cast<void *>(const_cast<Link **>(&p->d_next_p));
 }
 
-void ConcurrentPool::deallocate(void *address)
+void ConcurrentPool::deallocateShared(Link *first, Link *last)
 {
-    Link *p = static_cast<Link *>(static_cast<void *>(
-                     static_cast<char *>(address) - offsetof(Link, d_next_p)));
-    int refCount = bsls::AtomicOperations::getIntRelaxed(&p->d_refCount);
+    Link *old = d_freeList.loadRelaxed();
+    for (;;) {
+        last->d_next_p = old;
+        const Link * const swap = old;
+        old = d_freeList.testAndSwap(old, first);  // release
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
+            break;
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_isContended.storeRelaxed(true);
+    }
+}
+
+ConcurrentPool::Cache *ConcurrentPool::createCache()
+{
+    bslma::Allocator *allocator = d_blockList.allocator();
+
+    Cache *cache    = new (*allocator) Cache();
+    Cache *previous = d_cache_p.testAndSwap(0, cache);
+
+    if (previous) {
+        // Another thread allocated the cache first.
+
+        allocator->deleteObject(cache);
+        return previous;                                              // RETURN
+    }
+
+    return cache;
+}
+
+bool ConcurrentPool::makeFree(Link *link)
+{
+    int refCount = bsls::AtomicOperations::getIntRelaxed(&link->d_refCount);
     for (;;) {
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
-                                                              2,
-                                                              0);
+            refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                            &link->d_refCount,
+                                                            2,
+                                                            0);
             if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
+                return true;                                          // RETURN
             }
         }
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
         const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(&p->d_refCount,
+        refCount = bsls::AtomicOperations::testAndSwapInt(&link->d_refCount,
                                                           refCount,
                                                           refCount - 1);
         if (oldRefCount == refCount) {
             // Someone else is still trying to pop this item.  Just let them
             // have it.
 
-            return;                                                   // RETURN
+            return false;                                             // RETURN
         }
     }
+}
 
-    Link *old = d_freeList.loadRelaxed();
-    for (;;) {
-        p->d_next_p = old;
-        const Link * const swap = old;
-        old = d_freeList.testAndSwap(old, p);  // release
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(swap == old)) {
-            break;
+ConcurrentPool::Link *ConcurrentPool::popDepot(Cache *cache)
+{
+    bsls::SpinLockGuard guard(&cache->d_depotLock);
+
+    int& length = cache->d_depotLength;
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    --length;
+    return cache->d_depot[(cache->d_depotBegin + length) % k_DEPOT_CAPACITY];
+}
+
+void ConcurrentPool::pushDepot(Cache *cache, Link *round)
+{
+    Link *evicted = 0;
+    {
+        bsls::SpinLockGuard guard(&cache->d_depotLock);
+
+        int& begin  = cache->d_depotBegin;
+        int& length = cache->d_depotLength;
+
+        if (k_DEPOT_CAPACITY == length) {
+            // Evict the oldest round, so that the blocks most recently
+            // deallocated are the first to be reused.
+
+            evicted = cache->d_depot[begin];
+            begin   = (begin + 1) % k_DEPOT_CAPACITY;
+            --length;
+        }
+
+        cache->d_depot[(begin + length) % k_DEPOT_CAPACITY] = round;
+        ++length;
+    }
+
+    if (evicted) {
+        Link *last = evicted;
+        while (last->d_next_p) {
+            last = last->d_next_p;
+        }
+        deallocateShared(evicted, last);
+    }
+}
+
+void ConcurrentPool::replenish()
+{
+    replenishImp(reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
+                 &d_blockList,
+                 d_internalBlockSize,
+                 d_chunkSize);
+
+    if (bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
+     && d_chunkSize < d_maxBlocksPerChunk) {
+
+        if (d_chunkSize * 2 <= d_maxBlocksPerChunk) {
+            d_chunkSize = d_chunkSize * 2;
         }
+        else {
+            d_chunkSize = d_maxBlocksPerChunk;
+        }
+    }
+}
+
+// CREATORS
+ConcurrentPool::ConcurrentPool(bsls::Types::size_type  blockSize,
+                               bslma::Allocator       *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
+, d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
+, d_freeList(0)
+, d_blockList(basicAllocator)
+, d_cache_p(0)
+, d_isContended(false)
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    d_internalBlockSize = computeInternalBlockSize(blockSize);
+}
+
+ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? k_MAX_CHUNK_SIZE : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
+, d_growthStrategy(growthStrategy)
+, d_freeList(0)
+, d_blockList(basicAllocator)
+, d_cache_p(0)
+, d_isContended(false)
+{
+    BSLS_ASSERT(1 <= blockSize);
+
+    d_internalBlockSize = computeInternalBlockSize(blockSize);
+}
+
+ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               bslma::Allocator            *basicAllocator)
+: d_blockSize(blockSize)
+, d_chunkSize(bsls::BlockGrowth::BSLS_CONSTANT == growthStrategy
+              ? maxBlocksPerChunk : k_INITIAL_CHUNK_SIZE)
+, d_maxBlocksPerChunk(maxBlocksPerChunk)
+, d_growthStrategy(growthStrategy)
+, d_freeList(0)
+, d_blockList(basicAllocator)
+, d_cache_p(0)
+, d_isContended(false)
+{
+    BSLS_ASSERT(1 <= blockSize);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    d_internalBlockSize = computeInternalBlockSize(blockSize);
+}
+
+ConcurrentPool::~ConcurrentPool()
+{
+    BSLS_ASSERT(static_cast<int>(sizeof(LLink)) <= d_internalBlockSize);
+    BSLS_ASSERT(0 != d_chunkSize);
+
+    Cache *cache = d_cache_p.loadRelaxed();
+    if (cache) {
+        d_blockList.allocator()->deleteObject(cache);
+    }
+}
+
+// MANIPULATORS
+void *ConcurrentPool::allocate()
+{
+    Cache *cache = d_cache_p.loadAcquire();
+
+    if (!cache) {
+        if (!d_isContended.loadRelaxed()) {
+            return allocateShared();                                  // RETURN
+        }
+        cache = createCache();
+    }
+
+    Magazine& magazine = cache->d_magazines[magazineIndex()];
+
+    Link *p = 0;
+    {
+        bsls::SpinLockGuard guard(&magazine.d_lock);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == magazine.d_numLoaded)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            if (magazine.d_full_p) {
+                magazine.d_loaded_p = magazine.d_full_p;
+                magazine.d_full_p   = 0;
+            }
+            else {
+                magazine.d_loaded_p = popDepot(cache);
+            }
+            if (magazine.d_loaded_p) {
+                magazine.d_numLoaded = k_ROUND_SIZE;
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < magazine.d_numLoaded)) {
+            p                   = magazine.d_loaded_p;
+            magazine.d_loaded_p = p->d_next_p;
+            --magazine.d_numLoaded;
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return allocateShared();                                      // RETURN
+    }
+
+    // Take the reference to 'p' as 'allocateShared' does, as a thread that
+    // loaded 'p' from the shared free list before 'p' was cached may still
+    // be releasing its own reference (see 'makeFree').
+
+    bsls::AtomicOperations::addInt(&p->d_refCount, 2);
+
+    return static_cast<void *>(const_cast<Link **>(&p->d_next_p));
+}
+
+void ConcurrentPool::deallocate(void *address)
+{
+    Link *p = static_cast<Link *>(static_cast<void *>(
+                     static_cast<char *>(address) - offsetof(Link, d_next_p)));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!makeFree(p))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
     }
+
+    Cache *cache = d_cache_p.loadAcquire();
+
+    if (!cache) {
+        deallocateShared(p, p);
+        return;                                                       // RETURN
+    }
+
+    Magazine& magazine = cache->d_magazines[magazineIndex()];
+
+    Link *round = 0;
+    {
+        bsls::SpinLockGuard guard(&magazine.d_lock);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                   k_ROUND_SIZE == magazine.d_numLoaded)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            round                = magazine.d_full_p;
+            magazine.d_full_p    = magazine.d_loaded_p;
+            magazine.d_loaded_p  = 0;
+            magazine.d_numLoaded = 0;
+        }
+
+        p->d_next_p         = magazine.d_loaded_p;
+        magazine.d_loaded_p = p;
+        ++magazine.d_numLoaded;
+    }
+
+    if (round) {
+        pushDepot(cache, round);
+    }
+}
+
+void ConcurrentPool::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Cache *cache = d_cache_p.loadAcquire();
+    if (cache) {
+        for (int i = 0; i < k_NUM_MAGAZINES; ++i) {
+            Magazine&           magazine = cache->d_magazines[i];
+            bsls::SpinLockGuard magazineGuard(&magazine.d_lock);
+
+            magazine.d_numLoaded = 0;
+            magazine.d_loaded_p  = 0;
+            magazine.d_full_p    = 0;
+        }
+
+        bsls::SpinLockGuard depotGuard(&cache->d_depotLock);
+
+        cache->d_depotBegin  = 0;
+        cache->d_depotLength = 0;
+    }
+
+    d_freeList = (Link*)0;
+    d_blockList.release();
 }
 
 void ConcurrentPool::reserveCapacity(int numBlocks)
@@ -82,6 +82,35 @@ BSLS_IDENT("$Id: $")
 // currently installed default allocator at the time the
 // 'bdlma::ConcurrentPool' was created.
 //
+///Thread Caching
+///--------------
+// Free blocks are shared among threads through a lock-free list, whose head
+// is modified by every 'allocate' and 'deallocate' invoked on the shared
+// list.  To avoid contention on the head of the list when many threads use
+// the same pool, a 'bdlma::ConcurrentPool' caches free blocks in a small,
+// fixed number of *magazines*, each holding up to two *rounds* of blocks and
+// used by the threads assigned to it (each thread is assigned a magazine the
+// first time it uses any pool, and successive threads are assigned successive
+// magazines).  'allocate' and 'deallocate' are satisfied from the magazine of
+// the calling thread when possible, and whole rounds are moved between the
+// magazines and a *depot* shared by all threads, so that a thread
+// deallocating the blocks allocated by another thread passes them back a
+// round at a time.  Only when the depot is empty (or, on deallocation, full)
+// is the shared list used.  Blocks are always reused in last-in, first-out
+// order by a single thread.  Note that the free blocks cached in a magazine
+// are not available to threads assigned other magazines until a full round
+// is returned to the depot, and that 'reserveCapacity' reserves blocks in the
+// shared list only.
+//
+// The magazines and the depot are not part of the footprint of a
+// 'bdlma::ConcurrentPool': they are allocated from the allocator of the pool
+// the first time an 'allocate' follows an operation that had to retry
+// updating the shared list because another thread updated it concurrently.
+// Until then, all blocks are allocated from and deallocated to the shared
+// list, so that a pool that is idle, or used by one thread at a time, costs
+// no more memory than a pool without thread caching.  Once allocated, the
+// magazines and the depot are kept until the pool is destroyed.
+//
 ///Overloaded Global Operator 'new'
 ///--------------------------------
 // This component overloads the global 'operator new' to allow convenient
@@ -268,6 +297,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomicoperations.h>
 #include <bsls_blockgrowth.h>
 #include <bsls_platform.h>
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
@@ -304,6 +334,72 @@ class ConcurrentPool {
         Link  *volatile d_next_p;   // pointer to next link
     };
 
+    enum {
+        k_NUM_MAGAZINES   = 16,  // number of magazines caching free blocks
+                                 // for the threads using this pool
+
+        k_ROUND_SIZE      = 16,  // number of blocks moved at once between a
+                                 // magazine and the depot
+
+        k_DEPOT_CAPACITY  = 16,  // maximum number of rounds held in the
+                                 // depot
+
+        k_CACHE_LINE_SIZE = 64   // size, in bytes, of a padded magazine (the
+                                 // size of a cache line on supported
+                                 // platforms)
+    };
+
+    struct Magazine {
+        // This 'struct' caches free blocks for the threads assigned to it, in
+        // two lists linked through 'Link::d_next_p': a *loaded* list of up to
+        // 'k_ROUND_SIZE' blocks, from which blocks are allocated and to which
+        // they are deallocated, and an optional *full* list holding exactly
+        // 'k_ROUND_SIZE' blocks.
+
+        bsls::SpinLock  d_lock;        // protects the lists of this magazine
+
+        int             d_numLoaded;   // number of blocks in 'd_loaded_p'
+
+        Link           *d_loaded_p;    // list of blocks to allocate
+
+        Link           *d_full_p;      // list of 'k_ROUND_SIZE' blocks, or 0
+
+        // CREATORS
+        Magazine();
+            // Create a magazine holding no blocks.
+    };
+
+    struct PaddedMagazine : Magazine {
+        // This 'struct' pads a 'Magazine' so that the magazines of a pool do
+        // not share cache lines.
+
+        char d_padding[k_CACHE_LINE_SIZE - sizeof(Magazine)];
+    };
+
+    struct Cache {
+        // This 'struct' holds the magazines and the depot of a pool, which
+        // are allocated only once threads contend on the shared free list.
+
+        PaddedMagazine  d_magazines[k_NUM_MAGAZINES];
+                                         // free blocks cached for the
+                                         // threads using the pool
+
+        Link           *d_depot[k_DEPOT_CAPACITY];
+                                         // circular buffer of rounds, each a
+                                         // list of 'k_ROUND_SIZE' free blocks
+
+        int             d_depotBegin;    // index in 'd_depot' of the oldest
+                                         // round
+
+        int             d_depotLength;   // number of rounds in 'd_depot'
+
+        bsls::SpinLock  d_depotLock;     // protects the depot
+
+        // CREATORS
+        Cache();
+            // Create a cache holding no blocks.
+    };
+
     // DATA
     bsls::Types::size_type d_blockSize;  // size of each allocated memory block
                                          // returned to client
@@ -331,7 +427,53 @@ class ConcurrentPool {
 
     bslmt::Mutex      d_mutex;           // protects access to the block list
 
+    bsls::AtomicPointer<Cache>
+                      d_cache_p;         // magazines and depot caching free
+                                         // blocks for the threads using this
+                                         // pool (owned), or 0 if not yet
+                                         // allocated
+
+    bsls::AtomicBool  d_isContended;     // 'true' if an update of
+                                         // 'd_freeList' has been retried
+                                         // because of a concurrent update
+
+    // PRIVATE CLASS METHODS
+    static int magazineIndex();
+        // Return the index, in the range '[0 .. k_NUM_MAGAZINES)', of the
+        // magazine assigned to the calling thread.  A thread is always
+        // assigned the same magazine.
+
     // PRIVATE MANIPULATORS
+    void *allocateShared();
+        // Return the address of a block removed from the free list shared by
+        // all threads, replenishing the list if it is empty.
+
+    void deallocateShared(Link *first, Link *last);
+        // Prepend the list of free blocks starting at the specified 'first'
+        // block and ending at the specified 'last' block to the free list
+        // shared by all threads.
+
+    Cache *createCache();
+        // Allocate the cache of this pool unless another thread has already
+        // done so, and return its address.
+
+    bool makeFree(Link *link);
+        // Release the reference to the specified 'link' held by the client to
+        // which it was allocated.  Return 'true' if the calling thread now
+        // owns 'link' as a free block, and 'false' if 'link' was handed over
+        // to another thread concurrently attempting to remove it from the
+        // shared free list.
+
+    Link *popDepot(Cache *cache);
+        // Remove the most recently added round from the depot of the
+        // specified 'cache', and return the address of its first block, or 0
+        // if the depot is empty.
+
+    void pushDepot(Cache *cache, Link *round);
+        // Add the specified 'round' of 'k_ROUND_SIZE' free blocks to the
+        // depot of the specified 'cache'.  If the depot is full, first move
+        // its oldest round to the free list shared by all threads.
+
     void replenish();
         // Dynamically allocate a new chunk using the pool's underlying growth
         // strategy, and use the chunk to replenish the free memory list of
@@ -522,15 +664,6 @@ void ConcurrentPool::deleteObjectRaw(const TYPE *object)
     bslma::DeleterHelper::deleteObjectRaw(object, this);
 }
 
-inline
-void ConcurrentPool::release()
-{
-    d_mutex.lock();
-    d_freeList = (Link*)0;
-    d_blockList.release();
-    d_mutex.unlock();
-}
-
 // ACCESSORS
 inline
 bsls::Types::size_type ConcurrentPool::blockSize() const
@@ -19,6 +19,8 @@
 #include <bslma_testallocatorexception.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_qlock.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
@@ -29,8 +31,10 @@
 
 #include <bsl_cmath.h>       // 'log'
 #include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_algorithm.h>   // 'sort'
 #include <bsl_cstring.h>     // 'memcpy'
 #include <bsl_new.h>         // 'bad_alloc'
+#include <bsl_utility.h>     // 'pair'
 #include <bsl_vector.h>
 #include <bsl_iostream.h>
 
@@ -81,7 +85,8 @@ using namespace bsl;  // automatically added by script
 // [ 9] template<typename TYPE> void deleteObject(TYPE *object)
 // [13] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
+// [17] THREAD CACHING TEST
 // [16] ORIGINAL USAGE EXAMPLE
 // [15] PERFORMANCE TEST
 // [14] CONCURRENCY TEST
@@ -611,6 +616,115 @@ void *workerThread(void *arg) {
     return arg;
 }
 
+//=============================================================================
+//                  HELPER FUNCTIONS FOR THREAD CACHING TEST
+//-----------------------------------------------------------------------------
+
+namespace caching {
+
+enum {
+    k_NUM_THREADS = 4,
+    k_NUM_ROUNDS  = 200,
+    k_NUM_BLOCKS  = 100
+};
+
+typedef bsl::pair<int *, int> Stamped;
+    // A block allocated from the pool, and the value stamped into it.
+
+struct Mailbox {
+    // This 'struct' holds the blocks passed from one thread to another, each
+    // thread deallocating blocks allocated by another.
+
+    Obj                  *d_pool_p;      // pool shared by the threads
+    bslmt::Mutex          d_mutex;       // protects 'd_blocks'
+    bsl::vector<Stamped>  d_blocks;      // blocks allocated by one thread, to
+                                         // be deallocated by another
+    bsls::AtomicInt       d_nextStamp;   // next value to stamp into a block
+};
+
+extern "C"
+void *exchangeThread(void *arg)
+    // Repeatedly allocate blocks from the pool of the 'Mailbox' at the
+    // specified 'arg' address, stamp each with a distinct value, exchange
+    // them for the blocks in the mailbox, and deallocate the received blocks
+    // after verifying their stamps.
+{
+    Mailbox *mailbox = static_cast<Mailbox *>(arg);
+    Obj     *pool    = mailbox->d_pool_p;
+
+    bsl::vector<Stamped> blocks;
+
+    for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            int *block = static_cast<int *>(pool->allocate());
+            int  stamp = mailbox->d_nextStamp.add(1);
+
+            block[0] = stamp;
+            block[1] = ~stamp;
+            blocks.push_back(Stamped(block, stamp));
+        }
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&mailbox->d_mutex);
+            mailbox->d_blocks.swap(blocks);
+        }
+
+        for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+            int *block = blocks[i].first;
+            int  stamp = blocks[i].second;
+
+            // A block dispensed twice is overwritten by its other owner.
+
+            LOOP2_ASSERT(round, i,  stamp == block[0]);
+            LOOP2_ASSERT(round, i, ~stamp == block[1]);
+
+            pool->deallocate(block);
+        }
+        blocks.clear();
+    }
+    return arg;
+}
+
+extern "C"
+void *allocatingThread(void *arg)
+    // Allocate 'k_NUM_BLOCKS' blocks from the pool of the 'Mailbox' at the
+    // specified 'arg' address, and store them in the mailbox.
+{
+    Mailbox *mailbox = static_cast<Mailbox *>(arg);
+
+    for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+        mailbox->d_blocks.push_back(Stamped(
+                          static_cast<int *>(mailbox->d_pool_p->allocate()),
+                          i));
+    }
+    return arg;
+}
+
+extern "C"
+void *churningThread(void *arg)
+    // Repeatedly allocate 'k_NUM_BLOCKS' blocks from the pool of the
+    // 'Mailbox' at the specified 'arg' address and deallocate them, so that
+    // threads running this function concurrently contend on the free list of
+    // the pool.
+{
+    Mailbox *mailbox = static_cast<Mailbox *>(arg);
+    Obj     *pool    = mailbox->d_pool_p;
+
+    void *blocks[k_NUM_BLOCKS];
+
+    for (int round = 0; round < k_NUM_ROUNDS * 10; ++round) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            blocks[i] = pool->allocate();
+        }
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            pool->deallocate(blocks[i]);
+        }
+    }
+    return arg;
+}
+
+}  // close namespace caching
+
 //=============================================================================
 //                              BENCHMARKS
 //-----------------------------------------------------------------------------
@@ -695,7 +809,7 @@ int main(int argc, char *argv[]) {
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Make sure main usage example compiles and works.
@@ -729,6 +843,185 @@ int main(int argc, char *argv[]) {
         array.removeAll();
         ASSERT(0 == array.length());
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // THREAD CACHING TEST
+        //
+        // Concerns:
+        //: 1 Blocks deallocated by a thread are reused, in last-in, first-out
+        //:   order, by that thread, however many blocks are deallocated.
+        //:
+        //: 2 Blocks deallocated by a thread are available to other threads,
+        //:   except for the few cached for the deallocating thread.
+        //:
+        //: 3 No block is dispensed twice when blocks are allocated and
+        //:   deallocated by different threads concurrently.
+        //:
+        //: 4 'release' discards the blocks cached for each thread.
+        //:
+        //: 5 The cache is neither part of the footprint of a pool nor
+        //:   allocated while the pool is used by one thread at a time, and
+        //:   'release' retains only the cache.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate many blocks from a single thread, and
+        //:   verify the blocks are reused in reverse order of deallocation
+        //:   without allocating memory from the underlying allocator.  (C-1)
+        //:
+        //: 2 Allocate blocks in one thread, deallocate them in the main
+        //:   thread, and allocate most of them in a third thread, verifying
+        //:   no memory is allocated from the underlying allocator.  (C-2)
+        //:
+        //: 3 Have several threads repeatedly allocate and deallocate blocks,
+        //:   so that they contend on the free list and the cache is
+        //:   allocated.  Then have them allocate and stamp blocks, and
+        //:   exchange them with each other for deallocation, verifying each
+        //:   received block still holds its stamp.  (C-3)
+        //:
+        //: 4 Invoke 'release' after deallocating blocks, and verify that the
+        //:   next allocation replenishes the pool.  (C-4)
+        //:
+        //: 5 Verify that a pool is smaller than its cache would be, that no
+        //:   memory remains allocated after 'release' in P-1 and P-4, and that
+        //:   at most one block remains allocated after 'release' in P-3.
+        //:   (C-5)
+        //
+        // Testing:
+        //   THREAD CACHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "THREAD CACHING TEST" << endl
+                                  << "===================" << endl;
+
+        using namespace caching;
+
+        enum { k_NUM_BLOCKS_SINGLE = 1000 };
+
+        if (verbose) cout << "\nFootprint of a pool." << endl;
+        {
+            if (veryVerbose) { P(sizeof(Obj)); }
+
+            // The cache holds 16 magazines of 64 bytes each.
+
+            ASSERT(16 * 64 > sizeof(Obj));
+        }
+
+        if (verbose) cout << "\nReuse by a single thread." << endl;
+        {
+            bslma::TestAllocator ta("supplied", veryVeryVerbose);
+            Obj                  mX(sizeof(int) * 2, &ta);
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < k_NUM_BLOCKS_SINGLE; ++i) {
+                blocks.push_back(mX.allocate());
+            }
+
+            bsl::vector<void *> sorted(blocks);
+            bsl::sort(sorted.begin(), sorted.end());
+            ASSERT(sorted.end() == bsl::adjacent_find(sorted.begin(),
+                                                      sorted.end()));
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int i = 0; i < k_NUM_BLOCKS_SINGLE; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+                for (int i = k_NUM_BLOCKS_SINGLE - 1; 0 <= i; --i) {
+                    LOOP2_ASSERT(pass, i, blocks[i] == mX.allocate());
+                }
+                LOOP_ASSERT(pass, NUM_ALLOCATIONS == ta.numAllocations());
+            }
+
+            if (verbose) cout << "\tTesting 'release'." << endl;
+
+            for (int i = 0; i < k_NUM_BLOCKS_SINGLE; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.release();
+            ASSERT(0 == ta.numBytesInUse());
+
+            mX.allocate();
+            ASSERT(NUM_ALLOCATIONS + 1 == ta.numAllocations());
+        }
+
+        if (verbose) cout << "\nReuse by another thread." << endl;
+        {
+            bslma::TestAllocator ta("supplied", veryVeryVerbose);
+            Obj                  mX(sizeof(int) * 2, &ta);
+
+            Mailbox mailbox;
+            mailbox.d_pool_p = &mX;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  allocatingThread,
+                                                  &mailbox));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(k_NUM_BLOCKS == mailbox.d_blocks.size());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(mailbox.d_blocks[i].first);
+            }
+            mailbox.d_blocks.clear();
+
+            // The main thread may keep a few of the deallocated blocks.
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  allocatingThread,
+                                                  &mailbox));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            if (veryVerbose) {
+                P_(NUM_ALLOCATIONS) P(ta.numAllocations());
+            }
+            ASSERT(NUM_ALLOCATIONS + 2 >= ta.numAllocations());
+        }
+
+        if (verbose) cout << "\nConcurrent exchange of blocks." << endl;
+        {
+            bslma::TestAllocator ta("supplied", veryVeryVerbose);
+            Obj                  mX(sizeof(int) * 2, &ta);
+
+            Mailbox mailbox;
+            mailbox.d_pool_p = &mX;
+
+            bslmt::ThreadUtil::Handle handles[caching::k_NUM_THREADS];
+            for (int i = 0; i < caching::k_NUM_THREADS; ++i) {
+                LOOP_ASSERT(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                              churningThread,
+                                                              &mailbox));
+            }
+            for (int i = 0; i < caching::k_NUM_THREADS; ++i) {
+                LOOP_ASSERT(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            for (int i = 0; i < caching::k_NUM_THREADS; ++i) {
+                LOOP_ASSERT(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                              exchangeThread,
+                                                              &mailbox));
+            }
+            for (int i = 0; i < caching::k_NUM_THREADS; ++i) {
+                LOOP_ASSERT(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            for (bsl::size_t i = 0; i < mailbox.d_blocks.size(); ++i) {
+                const Stamped& block = mailbox.d_blocks[i];
+
+                LOOP_ASSERT(i,  block.second == block.first[0]);
+                LOOP_ASSERT(i, ~block.second == block.first[1]);
+                mX.deallocate(block.first);
+            }
+
+            mX.release();
+
+            if (veryVerbose) { P(ta.numBlocksInUse()); }
+
+            ASSERT(1 >= ta.numBlocksInUse());
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // ORIGINAL USAGE EXAMPLE
@@ -0,0 +1,346 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetSystemInfo', 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>  // 'mmap', 'madvise', 'munmap'
+#include <unistd.h>    // 'sysconf'
+
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                     // ==================================
+                     // struct HugePageAllocator::Mapping
+                     // ==================================
+
+struct HugePageAllocator::Mapping {
+    // This 'struct' describes a mapping, and is stored in the header at the
+    // start of the mapping.
+
+    Mapping     *d_next_p;    // next retained mapping, if retained
+    bsl::size_t  d_size;      // size of the mapping (in bytes)
+};
+
+}  // close package namespace
+
+namespace {
+
+enum {
+    k_MAX_ALIGNMENT    = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+
+    k_HEADER_SIZE      = (2 * sizeof(void *) + k_MAX_ALIGNMENT - 1)
+                       / k_MAX_ALIGNMENT * k_MAX_ALIGNMENT,
+                                  // size of the header preceding each block,
+                                  // holding a 'HugePageAllocator::Mapping'
+                                  // and padded to the maximum alignment
+
+    k_MAX_REUSE_FACTOR = 2        // a retained mapping is reused only if its
+                                  // size is at most this multiple of the
+                                  // size of a new mapping for the request
+};
+
+bsl::size_t systemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<bsl::size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MAP_HUGETLB)
+
+int hugeTlbFlags(bsl::size_t pageSize)
+    // Return the 'mmap' flags requesting a mapping from the pool of huge
+    // pages of the specified 'pageSize'.
+{
+    // The base-2 logarithm of the huge page size is encoded in the bits of
+    // the flags starting at 'MAP_HUGE_SHIFT'.
+
+    enum { k_MAP_HUGE_SHIFT = 26 };
+
+    int log2 = 0;
+    while ((static_cast<bsl::size_t>(1) << log2) < pageSize) {
+        ++log2;
+    }
+    return MAP_HUGETLB | (log2 << k_MAP_HUGE_SHIFT);
+}
+
+#endif
+
+void *mapHugePages(bsl::size_t size, bsl::size_t pageSize, bool prefault)
+    // Return the address of a new mapping of the specified 'size' (in bytes),
+    // aligned to, and backed where possible by huge pages of, the specified
+    // 'pageSize', and pre-faulted if the specified 'prefault' is 'true'.
+    // Return 0 if the memory cannot be mapped.  The behavior is undefined
+    // unless 'size' is a multiple of 'pageSize'.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    // Large pages require a privilege that processes typically lack; map
+    // ordinary memory.
+
+    (void)pageSize;
+
+    void *address = VirtualAlloc(0,
+                                 size,
+                                 MEM_COMMIT | MEM_RESERVE,
+                                 PAGE_READWRITE);
+    if (address && prefault) {
+        const bsl::size_t step = systemPageSize();
+        for (bsl::size_t offset = 0; offset < size; offset += step) {
+            static_cast<volatile char *>(address)[offset] = 0;
+        }
+    }
+    return address;
+
+#else
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MAP_HUGETLB)
+    {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | hugeTlbFlags(pageSize);
+        if (prefault) {
+            flags |= MAP_POPULATE;
+        }
+
+        void *address = ::mmap(0, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (MAP_FAILED != address) {
+            return address;                                           // RETURN
+        }
+    }
+#endif
+
+    // Map ordinary memory, over-allocating by one huge page to align the
+    // mapping to the huge page size, and trim the excess.
+
+    const bsl::size_t mappedSize = size + pageSize;
+
+    char *mapped = static_cast<char *>(::mmap(0,
+                                              mappedSize,
+                                              PROT_READ | PROT_WRITE,
+                                              MAP_PRIVATE | MAP_ANON,
+                                              -1,
+                                              0));
+    if (MAP_FAILED == static_cast<void *>(mapped)) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::UintPtr start =
+                                     reinterpret_cast<bsls::Types::UintPtr>(
+                                                                      mapped);
+    const bsl::size_t head =
+           static_cast<bsl::size_t>((pageSize - start % pageSize) % pageSize);
+
+    char *address = mapped + head;
+
+    if (0 != head) {
+        ::munmap(mapped, head);
+    }
+    if (pageSize != head) {
+        ::munmap(address + size, pageSize - head);
+    }
+
+#ifdef MADV_HUGEPAGE
+    ::madvise(address, size, MADV_HUGEPAGE);
+#endif
+
+    if (prefault) {
+        const bsl::size_t step = systemPageSize();
+        for (bsl::size_t offset = 0; offset < size; offset += step) {
+            static_cast<volatile char *>(address)[offset] = 0;
+        }
+    }
+    return address;
+
+#endif
+}
+
+void unmapHugePages(void *address, bsl::size_t size)
+    // Return to the system the mapping of the specified 'size' (in bytes) at
+    // the specified 'address'.  The behavior is undefined unless 'address'
+    // and 'size' describe a mapping returned by 'mapHugePages'.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    (void)size;
+    VirtualFree(address, 0, MEM_RELEASE);
+#else
+    ::munmap(static_cast<char *>(address), size);
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(PageSize pageSize, bool prefault)
+: d_pageSize(e_HUGE_PAGE_1GB == pageSize ? 1 << 30 : 2 << 20)
+, d_prefault(prefault)
+, d_retained_p(0)
+, d_numBytesInUse(0)
+, d_numBytesRetained(0)
+{
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    BSLS_ASSERT(0 == d_numBytesInUse);
+
+    releaseRetained();
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t required    = k_HEADER_SIZE + size;
+    const bsl::size_t mappingSize = (required + d_pageSize - 1)
+                                  / d_pageSize * d_pageSize;
+    const bsl::size_t maxReused   = k_MAX_REUSE_FACTOR * mappingSize;
+
+    Mapping *mapping = 0;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        // Reuse the smallest sufficient retained mapping, if any, unless it
+        // is so much larger than the request that reusing it would strand
+        // most of its memory in a small block.
+
+        Mapping **best = 0;
+        for (Mapping **link = &d_retained_p; *link; link = &(*link)->d_next_p)
+        {
+            if ((*link)->d_size >= required
+             && (*link)->d_size <= maxReused
+             && (!best || (*link)->d_size < (*best)->d_size)) {
+                best = link;
+            }
+        }
+
+        if (best) {
+            mapping             = *best;
+            *best               = mapping->d_next_p;
+            d_numBytesRetained -= mapping->d_size;
+            d_numBytesInUse    += mapping->d_size;
+        }
+    }
+
+    if (!mapping) {
+        void *address = mapHugePages(mappingSize, d_pageSize, d_prefault);
+        if (!address) {
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+
+        mapping         = static_cast<Mapping *>(address);
+        mapping->d_size = mappingSize;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_numBytesInUse += mappingSize;
+    }
+
+    mapping->d_next_p = 0;
+    return reinterpret_cast<char *>(mapping) + k_HEADER_SIZE;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    Mapping *mapping = reinterpret_cast<Mapping *>(
+                                 static_cast<char *>(address) - k_HEADER_SIZE);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT(mapping->d_size <= d_numBytesInUse);
+
+    mapping->d_next_p   = d_retained_p;
+    d_retained_p        = mapping;
+    d_numBytesInUse    -= mapping->d_size;
+    d_numBytesRetained += mapping->d_size;
+}
+
+void HugePageAllocator::releaseRetained()
+{
+    Mapping *retained;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        retained           = d_retained_p;
+        d_retained_p       = 0;
+        d_numBytesRetained = 0;
+    }
+
+    while (retained) {
+        Mapping *next = retained->d_next_p;
+        unmapHugePages(retained, retained->d_size);
+        retained = next;
+    }
+}
+
+// ACCESSORS
+bsls::Types::size_type HugePageAllocator::numBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesInUse;
+}
+
+bsls::Types::size_type HugePageAllocator::numBytesRetained() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesRetained;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,266 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator supplying blocks backed by huge pages.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: thread-safe allocator of huge-page backed blocks
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_guardingallocator
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bslma::Allocator' protocol
+// and supplies each block from a separate mapping of memory backed, where the
+// platform supports it, by *huge* pages (of 2MB or 1GB, as specified at
+// construction) rather than by pages of the system page size (typically 4KB).
+// A single huge page is mapped by a single TLB entry, so that accessing a
+// large region of memory backed by huge pages incurs far fewer TLB misses.
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         releaseRetained
+//               |         numBytesInUse
+//               |         numBytesRetained
+//               |         pageSize
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//..
+// As the size of each mapping is a multiple of the huge page size, every
+// block, however small, occupies at least one whole huge page: a block of 100
+// bytes consumes 2MB of memory (or 1GB, if pages of 1GB are specified).  A
+// 'bdlma::HugePageAllocator' is therefore intended to serve as the underlying
+// allocator of allocators obtaining large blocks of memory, such as a
+// 'bdlma::SequentialAllocator' (or 'bdlma::SequentialPool') whose initial
+// buffer size is a multiple of the huge page size, and not to supply small
+// blocks directly.  Note that, unlike many other BDE allocators, a
+// 'bslma::Allocator *' cannot be supplied upon construction of a
+// 'HugePageAllocator'; instead, memory is obtained directly from the system.
+//
+///Huge Page Mappings
+///------------------
+// On Linux, each mapping is first requested from the pool of huge pages
+// reserved by the system administrator ('MAP_HUGETLB'); if no such page is
+// available, the mapping is obtained as ordinary memory aligned to the huge
+// page size, and the kernel is asked to back it by transparent huge pages
+// ('madvise(MADV_HUGEPAGE)').  On other platforms, ordinary memory is mapped.
+// Note that the memory supplied is always usable, whether or not it could be
+// backed by huge pages.
+//
+// Optionally, a 'HugePageAllocator' may be constructed to *pre-fault* each
+// new mapping, so that the cost of the page faults is incurred upon
+// allocation rather than upon first access.
+//
+///Retained Memory
+///---------------
+// The mapping of a deallocated block is not returned to the system, but is
+// retained by the allocator and reused (without incurring page faults) to
+// satisfy subsequent allocation requests of at most its size, the smallest
+// retained mapping sufficient for a request being used.  In particular, an
+// arena allocator supplied by a 'HugePageAllocator' and repeatedly released
+// and refilled reuses the same mappings.  Retained mappings are returned to
+// the system by 'releaseRetained' and by the destructor.
+//
+// A retained mapping is not reused for a request whose new mapping would be
+// less than half its size, so that, e.g., a retained mapping of 1GB is not
+// consumed by a request for a few bytes; such a request is supplied from a
+// new mapping instead.
+//
+// Each block is preceded by a header, the size of the maximum alignment,
+// describing its mapping; blocks are maximally aligned.
+//
+///Thread Safety
+///-------------
+// 'bdlma::HugePageAllocator' is *fully thread-safe*, meaning any operation on
+// the same object can be safely invoked from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Arena by Huge Pages
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we process a series of requests, each of which builds large
+// containers in an arena released once the request completes, and we want
+// the arena to be backed by huge pages to reduce TLB misses.
+//
+// First, we create a 'bdlma::HugePageAllocator', and a
+// 'bdlma::SequentialAllocator' obtaining its buffers, whose sizes are
+// multiples of the huge page size, from it:
+//..
+//  bdlma::HugePageAllocator   hugePageAllocator;
+//  bdlma::SequentialAllocator arena(hugePageAllocator.pageSize(),
+//                                   &hugePageAllocator);
+//..
+// Then, we process each request using the arena, releasing the arena after
+// each request:
+//..
+//  for (int request = 0; request < 3; ++request) {
+//      {
+//          bsl::vector<int> values(&arena);
+//
+//          for (int i = 0; i < 1000000; ++i) {
+//              values.push_back(i);
+//          }
+//          assert(1000000 == values.size());
+//      }
+//      arena.release();
+//..
+// Finally, we observe that, once released, the memory of the arena is
+// retained by the huge page allocator for the next request, rather than being
+// returned to the system:
+//..
+//      assert(0 == hugePageAllocator.numBytesInUse());
+//      assert(0 <  hugePageAllocator.numBytesRetained());
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator supplying each
+    // block from a separate mapping backed, where possible, by huge pages,
+    // and retaining the mappings of deallocated blocks for reuse.
+
+  public:
+    // TYPES
+    enum PageSize {
+        // Enumerate the sizes of huge pages that may back the mappings.
+
+        e_HUGE_PAGE_2MB,  // pages of 2MB
+        e_HUGE_PAGE_1GB   // pages of 1GB
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Mapping;
+        // header of each mapping, defined in the implementation
+
+    // DATA
+    bsls::Types::size_type  d_pageSize;          // size of a huge page
+
+    bool                    d_prefault;          // 'true' if new mappings
+                                                 // are pre-faulted
+
+    mutable bslmt::Mutex    d_mutex;             // protects the following
+
+    Mapping                *d_retained_p;        // retained mappings
+
+    bsls::Types::size_type  d_numBytesInUse;     // bytes of mappings in use
+
+    bsls::Types::size_type  d_numBytesRetained;  // bytes of retained
+                                                 // mappings
+
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+  public:
+    // CREATORS
+    explicit HugePageAllocator(PageSize pageSize = e_HUGE_PAGE_2MB,
+                               bool     prefault = false);
+        // Create a huge page allocator.  Optionally specify the 'pageSize' of
+        // the huge pages backing the mappings; if 'pageSize' is not
+        // specified, pages of 2MB are used.  Optionally specify whether to
+        // 'prefault' each new mapping; if 'prefault' is not specified,
+        // mappings are not pre-faulted.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator, returning retained mappings to the system.
+        // The behavior is undefined unless all memory allocated from this
+        // object has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), supplied from the
+        // smallest sufficient retained mapping of at most twice the size of a
+        // new mapping for 'size' if any, and from a new mapping whose size is
+        // the smallest sufficient multiple of 'pageSize()' otherwise.  If
+        // 'size' is 0, no memory is allocated and 0 is returned.  If the
+        // memory cannot be mapped, a 'bsl::bad_alloc' exception is thrown (or
+        // 0 is returned if exceptions are not enabled).
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Retain the mapping of the memory block at the specified 'address'
+        // for reuse by subsequent allocations.  If 'address' is 0, this
+        // method has no effect.  The behavior is undefined unless 'address'
+        // was allocated using this allocator object and has not already been
+        // deallocated.
+
+    void releaseRetained();
+        // Return all retained mappings to the system.
+
+    // ACCESSORS
+    bsls::Types::size_type numBytesInUse() const;
+        // Return the number of bytes of the mappings of blocks currently
+        // allocated from this object.
+
+    bsls::Types::size_type numBytesRetained() const;
+        // Return the number of bytes of the mappings currently retained by
+        // this object for reuse.
+
+    bsls::Types::size_type pageSize() const;
+        // Return the size (in bytes) of the huge pages backing the mappings of
+        // this object.  Note that the size of each mapping is a multiple of
+        // this size.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+bsls::Types::size_type HugePageAllocator::pageSize() const
+{
+    return d_pageSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,638 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>        // 'atoi'
+#include <bsl_cstring.h>        // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HugePageAllocator' supplies each block from a mapping whose size is
+// a multiple of the huge page size, and retains the mappings of deallocated
+// blocks for reuse.  Whether the mappings are actually backed by huge pages
+// depends on the configuration of the test host, and is not observable
+// portably; the tests therefore verify the sizes and alignment of the
+// mappings, the accounting of the memory in use and retained, and the reuse
+// of retained mappings, including by a 'bdlma::SequentialAllocator'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] HugePageAllocator(PageSize pageSize = 2MB, bool prefault = false);
+// [ 1] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 2] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void releaseRetained();
+//
+// ACCESSORS
+// [ 2] bsls::Types::size_type numBytesInUse() const;
+// [ 3] bsls::Types::size_type numBytesRetained() const;
+// [ 1] bsls::Types::size_type pageSize() const;
+//-----------------------------------------------------------------------------
+// [ 4] CONCURRENCY TEST
+// [ 5] USAGE EXAMPLE
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::UintPtr     UintPtr;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+const size_type k_2MB = 2 << 20;
+const size_type k_1GB = 1 << 30;
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static size_type roundUp(size_type size, size_type pageSize)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'pageSize'.
+{
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+static size_type offsetInPage(const void *address, size_type pageSize)
+    // Return the offset of the specified 'address' within the page of the
+    // specified 'pageSize' holding it.
+{
+    return static_cast<size_type>(reinterpret_cast<UintPtr>(address)
+                                                                 % pageSize);
+}
+
+namespace concurrency {
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_ITERATIONS = 200
+};
+
+extern "C" void *threadFunction(void *arg)
+    // Repeatedly allocate, write, and deallocate blocks of various sizes
+    // using the 'Obj' at the specified 'arg'.
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const size_type size = 2 + (i % 5) * (k_2MB / 2);
+
+        char *block = static_cast<char *>(mX.allocate(size));
+        ASSERTV(i, block);
+
+        block[0]        = 'a';
+        block[size - 1] = 'z';
+        ASSERTV(i, 'a' == block[0] && 'z' == block[size - 1]);
+
+        mX.deallocate(block);
+    }
+    return 0;
+}
+
+}  // close namespace concurrency
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Arena by Huge Pages
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we process a series of requests, each of which builds large
+// containers in an arena released once the request completes, and we want
+// the arena to be backed by huge pages to reduce TLB misses.
+//
+// First, we create a 'bdlma::HugePageAllocator', and a
+// 'bdlma::SequentialAllocator' obtaining its buffers, whose sizes are
+// multiples of the huge page size, from it:
+//..
+    bdlma::HugePageAllocator   hugePageAllocator;
+    bdlma::SequentialAllocator arena(hugePageAllocator.pageSize(),
+                                     &hugePageAllocator);
+//..
+// Then, we process each request using the arena, releasing the arena after
+// each request:
+//..
+    for (int request = 0; request < 3; ++request) {
+        {
+            bsl::vector<int> values(&arena);
+
+            for (int i = 0; i < 1000000; ++i) {
+                values.push_back(i);
+            }
+            ASSERT(1000000 == values.size());
+        }
+        arena.release();
+//..
+// Finally, we observe that, once released, the memory of the arena is
+// retained by the huge page allocator for the next request, rather than being
+// returned to the system:
+//..
+        ASSERT(0 == hugePageAllocator.numBytesInUse());
+        ASSERT(0 <  hugePageAllocator.numBytesRetained());
+    }
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Blocks may be allocated and deallocated concurrently by several
+        //:   threads.
+        //
+        // Plan:
+        //: 1 Have several threads repeatedly allocate, write, and deallocate
+        //:   blocks of various sizes, and verify the accounting once the
+        //:   threads complete.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY TEST\n"
+                             "================\n";
+
+        using namespace concurrency;
+
+        Obj mX;  const Obj& X = mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  threadFunction,
+                                                  &mX));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        if (veryVerbose) { P(X.numBytesRetained()) }
+
+        ASSERT(0 == X.numBytesInUse());
+        ASSERT(0 <  X.numBytesRetained());
+        ASSERT(X.numBytesRetained() <= k_NUM_THREADS * 6 * k_2MB);
+
+        mX.releaseRetained();
+
+        ASSERT(0 == X.numBytesRetained());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'deallocate' AND 'releaseRetained'
+        //
+        // Concerns:
+        //: 1 The mapping of a deallocated block is retained, and accounted as
+        //:   such.
+        //:
+        //: 2 A retained mapping is reused for a subsequent allocation of at
+        //:   most its size, the smallest sufficient mapping being used.
+        //:
+        //: 3 A new mapping is made when no retained mapping is sufficient.
+        //:
+        //: 4 'deallocate' has no effect if the address is 0.
+        //:
+        //: 5 'releaseRetained' returns all retained mappings, and does not
+        //:   affect blocks in use.
+        //:
+        //: 6 A sequential allocator repeatedly released and refilled reuses
+        //:   the same mappings.
+        //:
+        //: 7 A retained mapping more than twice the size of a new mapping for
+        //:   a request is not reused for that request.
+        //
+        // Plan:
+        //: 1 Allocate blocks of one, two, and three pages, deallocate them,
+        //:   and verify the accounting.  (C-1)
+        //:
+        //: 2 Allocate blocks fitting in one and two pages, and verify that
+        //:   the addresses of the corresponding retained mappings are
+        //:   returned.  (C-2)
+        //:
+        //: 3 Allocate a block larger than any retained mapping, and verify
+        //:   that a new mapping is made.  (C-3)
+        //:
+        //: 4 Deallocate 0.  (C-4)
+        //:
+        //: 5 Call 'releaseRetained' with blocks in use, and verify the
+        //:   accounting and that the blocks remain usable.  (C-5)
+        //:
+        //: 6 Fill, release, and refill a sequential allocator supplied by an
+        //:   object, and verify that no memory is mapped by the refill.  (C-6)
+        //:
+        //: 7 Retain a mapping of eight pages, allocate blocks requiring one,
+        //:   three, and four pages, and verify that only the last reuses the
+        //:   retained mapping.  (C-7)
+        //
+        // Testing:
+        //   void deallocate(void *address);
+        //   void releaseRetained();
+        //   bsls::Types::size_type numBytesRetained() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'deallocate' AND 'releaseRetained'\n"
+                             "==========================================\n";
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            char *a1 = static_cast<char *>(mX.allocate(k_2MB / 2));
+            char *a2 = static_cast<char *>(mX.allocate(k_2MB + 1));
+            char *a3 = static_cast<char *>(mX.allocate(2 * k_2MB + 1));
+
+            ASSERT(6 * k_2MB == X.numBytesInUse());
+            ASSERT(0         == X.numBytesRetained());
+
+            mX.deallocate(a2);
+
+            ASSERT(4 * k_2MB == X.numBytesInUse());
+            ASSERT(2 * k_2MB == X.numBytesRetained());
+
+            mX.deallocate(a3);
+            mX.deallocate(a1);
+
+            ASSERT(0         == X.numBytesInUse());
+            ASSERT(6 * k_2MB == X.numBytesRetained());
+
+            mX.deallocate(0);
+
+            ASSERT(0         == X.numBytesInUse());
+            ASSERT(6 * k_2MB == X.numBytesRetained());
+
+            // Best fit: the one-page mapping, then the two-page mapping.
+
+            ASSERT(a1 == mX.allocate(100));
+            ASSERT(a2 == mX.allocate(k_2MB / 2));
+
+            ASSERT(3 * k_2MB == X.numBytesInUse());
+            ASSERT(3 * k_2MB == X.numBytesRetained());
+
+            char *a4 = static_cast<char *>(mX.allocate(3 * k_2MB));
+
+            ASSERT(a4 != a1 && a4 != a2 && a4 != a3);
+            ASSERT(7 * k_2MB == X.numBytesInUse());
+            ASSERT(3 * k_2MB == X.numBytesRetained());
+
+            mX.releaseRetained();
+
+            ASSERT(7 * k_2MB == X.numBytesInUse());
+            ASSERT(0         == X.numBytesRetained());
+
+            bsl::memset(a1, 1, 100);
+            bsl::memset(a2, 2, k_2MB / 2);
+            bsl::memset(a4, 4, 3 * k_2MB);
+
+            mX.deallocate(a1);
+            mX.deallocate(a2);
+            mX.deallocate(a4);
+
+            ASSERT(0         == X.numBytesInUse());
+            ASSERT(7 * k_2MB == X.numBytesRetained());
+        }
+
+        if (verbose) cout << "\tReuse limited to twice the size.\n";
+        {
+            Obj mX;  const Obj& X = mX;
+
+            char *a1 = static_cast<char *>(mX.allocate(8 * k_2MB - 100));
+
+            mX.deallocate(a1);
+
+            ASSERT(0         == X.numBytesInUse());
+            ASSERT(8 * k_2MB == X.numBytesRetained());
+
+            char *a2 = static_cast<char *>(mX.allocate(100));
+            char *a3 = static_cast<char *>(mX.allocate(3 * k_2MB - 100));
+
+            ASSERT(a2 != a1);
+            ASSERT(a3 != a1);
+            ASSERT(4 * k_2MB == X.numBytesInUse());
+            ASSERT(8 * k_2MB == X.numBytesRetained());
+
+            char *a4 = static_cast<char *>(mX.allocate(3 * k_2MB + 1));
+
+            ASSERT(a4 == a1);
+            ASSERT(12 * k_2MB == X.numBytesInUse());
+            ASSERT( 0         == X.numBytesRetained());
+
+            mX.deallocate(a2);
+            mX.deallocate(a3);
+            mX.deallocate(a4);
+        }
+
+        if (verbose) cout << "\tReuse by a sequential allocator.\n";
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bdlma::SequentialAllocator sa(X.pageSize(), &mX);
+
+            for (int i = 0; i < 40; ++i) {
+                bsl::memset(sa.allocate(k_2MB / 4), i, k_2MB / 4);
+            }
+
+            const size_type IN_USE = X.numBytesInUse();
+
+            if (veryVerbose) { P(IN_USE) }
+
+            ASSERT(0 < IN_USE);
+            ASSERT(0 == X.numBytesRetained());
+
+            for (int pass = 0; pass < 3; ++pass) {
+                sa.release();
+
+                ASSERTV(pass, 0      == X.numBytesInUse());
+                ASSERTV(pass, IN_USE == X.numBytesRetained());
+
+                for (int i = 0; i < 40; ++i) {
+                    bsl::memset(sa.allocate(k_2MB / 4), i, k_2MB / 4);
+                }
+
+                ASSERTV(pass, IN_USE == X.numBytesInUse());
+                ASSERTV(pass, 0      == X.numBytesRetained());
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned memory of at least the
+        //:   requested size, at the start of a mapping aligned to the page
+        //:   size.
+        //:
+        //: 2 The size of each mapping is the smallest multiple of the page
+        //:   size holding the block and its header.
+        //:
+        //: 3 'allocate' returns 0 if the size is 0.
+        //:
+        //: 4 Pre-faulted mappings are usable, and zero-initialized.
+        //
+        // Plan:
+        //: 1 For both page sizes and pre-faulting options, allocate blocks of
+        //:   various sizes, and verify their alignment and the number of bytes
+        //:   in use; write to each block.  (C-1, 2, 4)
+        //:
+        //: 2 Allocate 0 bytes.  (C-3)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   bsls::Types::size_type numBytesInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'allocate'\n"
+                             "==================\n";
+
+        static const struct {
+            int       d_line;
+            size_type d_size;      // requested size
+            size_type d_numPages;  // expected number of 2MB pages
+        } DATA[] = {
+            { L_,               1, 1 },
+            { L_,              64, 1 },
+            { L_,      k_2MB - 64, 1 },
+            { L_,           k_2MB, 2 },
+            { L_,       k_2MB + 1, 2 },
+            { L_,   2 * k_2MB - 64, 2 },
+            { L_,   5 * k_2MB + 7, 6 },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int prefault = 0; prefault < 2; ++prefault) {
+            if (veryVerbose) { P(prefault) }
+
+            Obj mX(Obj::e_HUGE_PAGE_2MB, prefault);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numBytesInUse());
+
+            size_type expected = 0;
+
+            bsl::vector<char *> blocks;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE  = DATA[ti].d_line;
+                const size_type SIZE  = DATA[ti].d_size;
+                const size_type PAGES = DATA[ti].d_numPages;
+
+                char *block = static_cast<char *>(mX.allocate(SIZE));
+
+                ASSERTV(LINE, block);
+                ASSERTV(LINE, 0 == offsetInPage(block, k_MAX_ALIGN));
+                ASSERTV(LINE, offsetInPage(block, k_2MB) <= 2 * k_MAX_ALIGN);
+
+                expected += PAGES * k_2MB;
+                ASSERTV(LINE, X.numBytesInUse(), expected,
+                        expected == X.numBytesInUse());
+                ASSERTV(LINE, roundUp(SIZE + offsetInPage(block, k_2MB),
+                                      k_2MB) == PAGES * k_2MB);
+
+                if (prefault) {
+                    ASSERTV(LINE, 0 == block[0] && 0 == block[SIZE - 1]);
+                }
+                bsl::memset(block, 0x5a, SIZE);
+
+                blocks.push_back(block);
+            }
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == X.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tWith 1GB pages.\n";
+        {
+            Obj mX(Obj::e_HUGE_PAGE_1GB);  const Obj& X = mX;
+
+            char *block = static_cast<char *>(mX.allocate(100));
+
+            ASSERT(block);
+            ASSERT(offsetInPage(block, k_1GB) <= 2 * k_MAX_ALIGN);
+            ASSERT(k_1GB == X.numBytesInUse());
+
+            bsl::memset(block, 0x5a, 100);
+
+            mX.deallocate(block);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The constructor creates an allocator for the requested page size,
+        //:   2MB by default.
+        //:
+        //: 2 Allocated memory is usable, and returned on destruction.
+        //
+        // Plan:
+        //: 1 Create objects for each page size, and verify 'pageSize'.  (C-1)
+        //:
+        //: 2 Allocate, write, and deallocate a block.  (C-2)
+        //
+        // Testing:
+        //   HugePageAllocator(PageSize pageSize = 2MB, bool prefault = false);
+        //   ~HugePageAllocator();
+        //   bsls::Types::size_type pageSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(k_2MB == X.pageSize());
+            ASSERT(0     == X.numBytesInUse());
+            ASSERT(0     == X.numBytesRetained());
+
+            char *block = static_cast<char *>(mX.allocate(1000));
+            ASSERT(block);
+
+            bsl::memset(block, 'x', 1000);
+
+            ASSERT(k_2MB == X.numBytesInUse());
+
+            mX.deallocate(block);
+
+            ASSERT(0     == X.numBytesInUse());
+            ASSERT(k_2MB == X.numBytesRetained());
+        }
+        {
+            const Obj X(Obj::e_HUGE_PAGE_2MB, true);
+            ASSERT(k_2MB == X.pageSize());
+        }
+        {
+            const Obj X(Obj::e_HUGE_PAGE_1GB);
+            ASSERT(k_1GB == X.pageSize());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,244 @@
+// bdlma_numaallocator.cpp                                            -*-C++-*-
+#include <bdlma_numaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_numaallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_concurrentmultipool.h>
+#include <bdlma_numautil.h>
+
+#include <bslma_default.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                      // =================================
+                      // class NumaAllocator_NodeAllocator
+                      // =================================
+
+class NumaAllocator_NodeAllocator : public bslma::Allocator {
+    // This component-private class provides an allocator supplying memory
+    // obtained from an underlying allocator, and requesting that the pages of
+    // that memory be placed on a NUMA node.
+
+    // DATA
+    int               d_node;         // node on which to place memory, or -1
+                                      // if memory is not placed
+
+    bslma::Allocator *d_allocator_p;  // underlying allocator (held, not
+                                      // owned)
+
+    // NOT IMPLEMENTED
+    NumaAllocator_NodeAllocator(const NumaAllocator_NodeAllocator&);
+    NumaAllocator_NodeAllocator& operator=(
+                                           const NumaAllocator_NodeAllocator&);
+
+  public:
+    // CREATORS
+    NumaAllocator_NodeAllocator(int node, bslma::Allocator *basicAllocator);
+        // Create an allocator supplying memory obtained from the specified
+        // 'basicAllocator', and placed on the specified NUMA 'node' if 'node'
+        // is not negative.
+
+    virtual ~NumaAllocator_NodeAllocator();
+        // Destroy this allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a block of memory of (at least) the specified
+        // 'size' (in bytes) obtained from the underlying allocator, having
+        // requested that its pages be placed on the node of this allocator.
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' to the underlying
+        // allocator.
+};
+
+                          // ========================
+                          // class NumaAllocator_Node
+                          // ========================
+
+class NumaAllocator_Node {
+    // This component-private class provides the multipool of a NUMA node.
+
+    // DATA
+    NumaAllocator_NodeAllocator d_nodeAllocator;  // supplies node memory
+    ConcurrentMultipool         d_multipool;      // pools node memory
+
+    // NOT IMPLEMENTED
+    NumaAllocator_Node(const NumaAllocator_Node&);
+    NumaAllocator_Node& operator=(const NumaAllocator_Node&);
+
+  public:
+    // CREATORS
+    NumaAllocator_Node(int node, bslma::Allocator *basicAllocator);
+        // Create a multipool supplying memory obtained from the specified
+        // 'basicAllocator', and placed on the specified NUMA 'node' if 'node'
+        // is not negative.
+
+    // MANIPULATORS
+    ConcurrentMultipool& multipool();
+        // Return a reference providing modifiable access to the multipool of
+        // this node.
+};
+
+                      // ---------------------------------
+                      // class NumaAllocator_NodeAllocator
+                      // ---------------------------------
+
+// CREATORS
+NumaAllocator_NodeAllocator::NumaAllocator_NodeAllocator(
+                                              int               node,
+                                              bslma::Allocator *basicAllocator)
+: d_node(node)
+, d_allocator_p(basicAllocator)
+{
+}
+
+NumaAllocator_NodeAllocator::~NumaAllocator_NodeAllocator()
+{
+}
+
+// MANIPULATORS
+void *NumaAllocator_NodeAllocator::allocate(size_type size)
+{
+    void *address = d_allocator_p->allocate(size);
+
+    if (0 <= d_node && address) {
+        // Placement is a hint: should it fail, the memory is still usable.
+
+        NumaUtil::bindMemoryToNode(address, size, d_node);
+    }
+    return address;
+}
+
+void NumaAllocator_NodeAllocator::deallocate(void *address)
+{
+    d_allocator_p->deallocate(address);
+}
+
+                          // ------------------------
+                          // class NumaAllocator_Node
+                          // ------------------------
+
+// CREATORS
+NumaAllocator_Node::NumaAllocator_Node(int               node,
+                                       bslma::Allocator *basicAllocator)
+: d_nodeAllocator(node, basicAllocator)
+, d_multipool(&d_nodeAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+ConcurrentMultipool& NumaAllocator_Node::multipool()
+{
+    return d_multipool;
+}
+
+                            // -------------------
+                            // class NumaAllocator
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+void NumaAllocator::initialize(int numNodes)
+{
+    BSLS_ASSERT(1 <= numNodes);
+
+    // Memory is placed on nodes only on a NUMA host whose nodes are those of
+    // this allocator.
+
+    const bool placeMemory = 1 < numNodes && NumaUtil::numNodes() == numNodes;
+
+    d_nodes.reserve(numNodes);
+    for (int i = 0; i < numNodes; ++i) {
+        d_nodes.push_back(new (*d_allocator_p) NumaAllocator_Node(
+                                                      placeMemory ? i : -1,
+                                                      d_allocator_p));
+    }
+}
+
+// CREATORS
+NumaAllocator::NumaAllocator(bslma::Allocator *basicAllocator)
+: d_nodes(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(NumaUtil::numNodes());
+}
+
+NumaAllocator::NumaAllocator(int numNodes, bslma::Allocator *basicAllocator)
+: d_nodes(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(numNodes);
+}
+
+NumaAllocator::~NumaAllocator()
+{
+    for (bsl::size_t i = 0; i < d_nodes.size(); ++i) {
+        d_allocator_p->deleteObject(d_nodes[i]);
+    }
+}
+
+// MANIPULATORS
+void *NumaAllocator::allocate(size_type size)
+{
+    return allocateOnNode(size, NumaUtil::currentNode() % numNodes());
+}
+
+void *NumaAllocator::allocateOnNode(size_type size, int node)
+{
+    BSLS_ASSERT(0 <= node);
+    BSLS_ASSERT(node < numNodes());
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    ConcurrentMultipool& multipool = d_nodes[node]->multipool();
+
+    Header *header = static_cast<Header *>(
+                                  multipool.allocate(sizeof(Header) + size));
+    header->d_header.d_node = node;
+    return header + 1;
+}
+
+void NumaAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    BSLS_ASSERT(0 <= header->d_header.d_node);
+    BSLS_ASSERT(header->d_header.d_node < numNodes());
+
+    d_nodes[header->d_header.d_node]->multipool().deallocate(header);
+}
+
+void NumaAllocator::release()
+{
+    for (bsl::size_t i = 0; i < d_nodes.size(); ++i) {
+        d_nodes[i]->multipool().release();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,299 @@
+// bdlma_numaallocator.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMA_NUMAALLOCATOR
+#define INCLUDED_BDLMA_NUMAALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe allocator pooling memory per NUMA node.
+//
+//@CLASSES:
+//  bdlma::NumaAllocator: thread-safe allocator with a multipool per NUMA node
+//
+//@SEE_ALSO: bdlma_numautil, bdlma_concurrentmultipool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::NumaAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and maintains a separate 'bdlma::ConcurrentMultipool' for each
+// NUMA node of the host (see 'bdlma_numautil').  Each allocation request is
+// satisfied from the multipool of the node of the calling thread (as returned
+// by 'bdlma::NumaUtil::currentNode'), or from the multipool of a node
+// specified explicitly using 'allocateOnNode'.  A block may be deallocated by
+// any thread, and is always returned to the multipool from which it was
+// allocated.  Both the 'release' method and the destructor of a
+// 'bdlma::NumaAllocator' release all memory currently allocated via the
+// object.
+//..
+//   ,--------------------.
+//  ( bdlma::NumaAllocator )
+//   `--------------------'
+//              |         ctor/dtor
+//              |         allocateOnNode
+//              |         numNodes
+//              |         nodeOf
+//              V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//              |         release
+//              V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                        allocate
+//                        deallocate
+//..
+// The multipool of each node obtains its memory from the allocator supplied at
+// construction, and, where the host has more than one node, requests that the
+// pages of each block so obtained be placed on that node (see
+// 'bdlma::NumaUtil::bindMemoryToNode').  Note that the memory supplied by the
+// underlying allocator is placed on the requested node only if it was not
+// already accessed (which is typically the case for the large blocks obtained
+// by a multipool), and that, as memory is by default placed on the node of the
+// thread first accessing it, threads allocating memory from a
+// 'bdlma::NumaAllocator' should be bound to their nodes (see
+// 'bdlma::NumaUtil::bindCurrentThreadToNode') for the node of the calling
+// thread to be stable.
+//
+// A 'bdlma::NumaAllocator' may also be supplied as the underlying allocator of
+// other allocators, such as a 'bdlma::SequentialAllocator' used by a thread
+// bound to a node, so that the memory they manage is local to that node.
+//
+// Each block allocated by a 'bdlma::NumaAllocator' is preceded by a header,
+// the size of the maximum alignment, identifying its node.
+//
+///Thread Safety
+///-------------
+// 'bdlma::NumaAllocator' is *fully thread-safe*, meaning any operation on the
+// same object can be safely invoked from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Node-Local Memory in a Thread Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we process messages in worker threads spread over the NUMA nodes of
+// the host, and want the memory for each message to be local to the worker
+// processing it.
+//
+// First, we define the function run by each worker, which binds the worker to
+// a node and then allocates its messages from a 'bdlma::NumaAllocator' shared
+// by all workers:
+//..
+//  struct WorkerArgs {
+//      bdlma::NumaAllocator *d_allocator_p;  // allocator shared by workers
+//      int                   d_node;         // node of the worker
+//  };
+//
+//  extern "C" void *numaWorker(void *arg)
+//  {
+//      WorkerArgs *args = static_cast<WorkerArgs *>(arg);
+//
+//      bdlma::NumaUtil::bindCurrentThreadToNode(args->d_node);
+//
+//      for (int i = 0; i < 100; ++i) {
+//          char *message = static_cast<char *>(
+//                                          args->d_allocator_p->allocate(64));
+//..
+// Then, where the worker could be bound to its node, we verify that the
+// messages are allocated from the multipool of that node:
+//..
+//          if (args->d_node == bdlma::NumaUtil::currentNode()) {
+//              assert(args->d_node == args->d_allocator_p->nodeOf(message));
+//          }
+//
+//          // ... process 'message' ...
+//
+//          args->d_allocator_p->deallocate(message);
+//      }
+//      return 0;
+//  }
+//..
+// Finally, we create the allocator, and start a worker for each node:
+//..
+//  bdlma::NumaAllocator allocator;
+//
+//  const int numNodes = allocator.numNodes();
+//
+//  bsl::vector<WorkerArgs>                args(numNodes);
+//  bsl::vector<bslmt::ThreadUtil::Handle> handles(numNodes);
+//
+//  for (int i = 0; i < numNodes; ++i) {
+//      args[i].d_allocator_p = &allocator;
+//      args[i].d_node        = i;
+//      bslmt::ThreadUtil::create(&handles[i], numaWorker, &args[i]);
+//  }
+//  for (int i = 0; i < numNodes; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+// Note that the worker threads of a 'bdlmt::FixedThreadPool' can be bound to
+// nodes in the same way, by supplying the pool with a thread start functor
+// invoking 'bdlma::NumaUtil::bindCurrentThreadToNode'.
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class NumaAllocator_Node;
+
+                            // ===================
+                            // class NumaAllocator
+                            // ===================
+
+class NumaAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a
+    // thread-safe allocator maintaining a 'ConcurrentMultipool' for each NUMA
+    // node of the host, and satisfying each allocation request from the
+    // multipool of the node of the calling thread.
+
+    // PRIVATE TYPES
+    struct Header {
+        // This 'struct' provides the header preceding each allocated block,
+        // identifying the node from which the block was allocated.
+
+        union {
+            int                                 d_node;   // node of block
+            bsls::AlignmentUtil::MaxAlignedType d_dummy;  // force alignment
+        } d_header;
+    };
+
+    // DATA
+    bsl::vector<NumaAllocator_Node *>  d_nodes;        // node multipools,
+                                                       // owned
+
+    bslma::Allocator                  *d_allocator_p;  // memory allocator
+                                                       // (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void initialize(int numNodes);
+        // Create the multipools of the specified 'numNodes' nodes.
+
+    // NOT IMPLEMENTED
+    NumaAllocator(const NumaAllocator&);
+    NumaAllocator& operator=(const NumaAllocator&);
+
+  public:
+    // CREATORS
+    explicit NumaAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit NumaAllocator(int numNodes, bslma::Allocator *basicAllocator = 0);
+        // Create an allocator maintaining a multipool for each NUMA node.
+        // Optionally specify the 'numNodes' for which multipools are
+        // maintained; if 'numNodes' is not specified,
+        // 'NumaUtil::numNodes()' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numNodes'.  Note that, if 'numNodes' differs
+        // from 'NumaUtil::numNodes()', each thread allocates from the
+        // multipool 'NumaUtil::currentNode() % numNodes', and the memory of
+        // the multipools is not bound to nodes (which is useful for testing).
+
+    virtual ~NumaAllocator();
+        // Destroy this allocator, releasing all memory allocated via this
+        // object.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), allocated from the
+        // multipool of the NUMA node of the calling thread (see
+        // 'NumaUtil::currentNode').  If 'size' is 0, no memory is allocated
+        // and 0 is returned.
+
+    void *allocateOnNode(size_type size, int node);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes), allocated from the
+        // multipool of the specified NUMA 'node'.  If 'size' is 0, no memory
+        // is allocated and 0 is returned.  The behavior is undefined unless
+        // '0 <= node < numNodes()'.
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' to the multipool
+        // from which it was allocated.  If 'address' is 0, this method has no
+        // effect.  The behavior is undefined unless 'address' was allocated
+        // using this allocator object and has not already been deallocated.
+
+    virtual void release() BSLS_KEYWORD_OVERRIDE;
+        // Release all memory currently allocated through this allocator.
+
+    // ACCESSORS
+    int nodeOf(const void *address) const;
+        // Return the index of the NUMA node from whose multipool the block at
+        // the specified 'address' was allocated.  The behavior is undefined
+        // unless 'address' was allocated using this allocator object and has
+        // not been deallocated.
+
+    int numNodes() const;
+        // Return the number of NUMA nodes for which this allocator maintains a
+        // multipool.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class NumaAllocator
+                            // -------------------
+
+// ACCESSORS
+inline
+int NumaAllocator::nodeOf(const void *address) const
+{
+    BSLS_ASSERT(address);
+
+    return (static_cast<const Header *>(address) - 1)->d_header.d_node;
+}
+
+inline
+int NumaAllocator::numNodes() const
+{
+    return static_cast<int>(d_nodes.size());
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *NumaAllocator::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,588 @@
+// bdlma_numaallocator.t.cpp                                          -*-C++-*-
+
+#include <bdlma_numaallocator.h>
+
+#include <bdlma_numautil.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>        // 'atoi'
+#include <bsl_cstring.h>        // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::NumaAllocator' is a managed allocator maintaining a multipool for
+// each NUMA node.  As the test host typically has a single node, the
+// allocator is tested mostly using the constructor taking the number of
+// nodes, which maintains that many multipools regardless of the topology of
+// the host.  The concerns are that each block is allocated from the multipool
+// of the intended node, is returned to that multipool from any thread, and
+// that all memory is released by 'release' and the destructor.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] NumaAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] NumaAllocator(int numNodes, bslma::Allocator *basicAllocator = 0);
+// [ 1] ~NumaAllocator();
+//
+// MANIPULATORS
+// [ 1] void *allocate(size_type size);
+// [ 2] void *allocateOnNode(size_type size, int node);
+// [ 2] void deallocate(void *address);
+// [ 2] void release();
+//
+// ACCESSORS
+// [ 2] int nodeOf(const void *address) const;
+// [ 1] int numNodes() const;
+// [ 1] bslma::Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 3] CONCURRENCY TEST
+// [ 4] USAGE EXAMPLE
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::NumaAllocator Obj;
+
+enum { k_MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT };
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace concurrency {
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_NODES      = 3,
+    k_NUM_BLOCKS     = 500,
+    k_NUM_ITERATIONS = 20
+};
+
+struct ThreadArgs {
+    // This 'struct' provides the arguments of 'threadFunction'.
+
+    Obj                 *d_allocator_p;  // allocator under test
+    bslmt::Barrier      *d_barrier_p;    // synchronizes the threads
+    bsl::vector<char *> *d_blocks_p;     // blocks handed between threads
+    int                  d_index;        // index of the thread
+};
+
+extern "C" void *threadFunction(void *arg)
+    // Repeatedly allocate blocks on the nodes of the allocator of the
+    // 'ThreadArgs' at the specified 'arg', then, after the threads have
+    // synchronized, verify and deallocate the blocks allocated by another
+    // thread.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+
+    Obj&                 mX      = *args->d_allocator_p;
+    bsl::vector<char *>& blocks  = args->d_blocks_p[args->d_index];
+    bsl::vector<char *>& victims = args->d_blocks_p[(args->d_index + 1)
+                                                            % k_NUM_THREADS];
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            const int node = (args->d_index + j) % k_NUM_NODES;
+            const int size = 1 + (j * 7) % 300;
+
+            char *block = static_cast<char *>(mX.allocateOnNode(size, node));
+            bsl::memset(block, node, size);
+            blocks[j] = block;
+        }
+
+        args->d_barrier_p->wait();
+
+        for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+            const int node = ((args->d_index + 1) % k_NUM_THREADS + j)
+                                                                 % k_NUM_NODES;
+            const int size = 1 + (j * 7) % 300;
+
+            ASSERTV(j, node == mX.nodeOf(victims[j]));
+            ASSERTV(j, node == victims[j][size - 1]);
+
+            mX.deallocate(victims[j]);
+        }
+
+        args->d_barrier_p->wait();
+    }
+    return 0;
+}
+
+}  // close namespace concurrency
+
+//=============================================================================
+//                               USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Node-Local Memory in a Thread Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we process messages in worker threads spread over the NUMA nodes of
+// the host, and want the memory for each message to be local to the worker
+// processing it.
+//
+// First, we define the function run by each worker, which binds the worker to
+// a node and then allocates its messages from a 'bdlma::NumaAllocator' shared
+// by all workers:
+//..
+    struct WorkerArgs {
+        bdlma::NumaAllocator *d_allocator_p;  // allocator shared by workers
+        int                   d_node;         // node of the worker
+    };
+
+    extern "C" void *numaWorker(void *arg)
+    {
+        WorkerArgs *args = static_cast<WorkerArgs *>(arg);
+
+        bdlma::NumaUtil::bindCurrentThreadToNode(args->d_node);
+
+        for (int i = 0; i < 100; ++i) {
+            char *message = static_cast<char *>(
+                                            args->d_allocator_p->allocate(64));
+//..
+// Then, where the worker could be bound to its node, we verify that the
+// messages are allocated from the multipool of that node:
+//..
+            if (args->d_node == bdlma::NumaUtil::currentNode()) {
+                ASSERT(args->d_node == args->d_allocator_p->nodeOf(message));
+            }
+
+            // ... process 'message' ...
+
+            args->d_allocator_p->deallocate(message);
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+        using namespace USAGE_EXAMPLE;
+
+// Finally, we create the allocator, and start a worker for each node:
+//..
+    bdlma::NumaAllocator allocator;
+
+    const int numNodes = allocator.numNodes();
+
+    bsl::vector<WorkerArgs>                args(numNodes);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numNodes);
+
+    for (int i = 0; i < numNodes; ++i) {
+        args[i].d_allocator_p = &allocator;
+        args[i].d_node        = i;
+        bslmt::ThreadUtil::create(&handles[i], numaWorker, &args[i]);
+    }
+    for (int i = 0; i < numNodes; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Blocks may be allocated on any node concurrently by several
+        //:   threads.
+        //:
+        //: 2 Blocks may be deallocated by a thread other than the allocating
+        //:   thread, and are returned to the multipool of their node.
+        //
+        // Plan:
+        //: 1 Using an allocator for several nodes, have several threads
+        //:   allocate blocks on each node, then, after synchronizing, verify
+        //:   and deallocate the blocks of another thread, verifying their node
+        //:   and contents.  Repeat, and verify that all memory is released on
+        //:   destruction.  (C-1, 2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENCY TEST\n"
+                             "================\n";
+
+        using namespace concurrency;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(k_NUM_NODES, &ta);
+
+            bslmt::Barrier      barrier(k_NUM_THREADS);
+            bsl::vector<char *> blocks[k_NUM_THREADS];
+            ThreadArgs          args[k_NUM_THREADS];
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                blocks[i].resize(k_NUM_BLOCKS);
+
+                args[i].d_allocator_p = &mX;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_blocks_p    = blocks;
+                args[i].d_index       = i;
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      threadFunction,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocateOnNode', 'deallocate', 'nodeOf', AND 'release'
+        //
+        // Concerns:
+        //: 1 The constructor taking a number of nodes creates an allocator
+        //:   for that number of nodes, regardless of the host.
+        //:
+        //: 2 'allocateOnNode' returns maximally-aligned memory of the
+        //:   requested size from the multipool of the requested node, as
+        //:   reported by 'nodeOf'.
+        //:
+        //: 3 'allocateOnNode' returns 0 if the size is 0.
+        //:
+        //: 4 'deallocate' returns a block to the multipool of its node, from
+        //:   which it is reused by a subsequent allocation on that node.
+        //:
+        //: 5 'deallocate' has no effect if the address is 0.
+        //:
+        //: 6 'release' and the destructor release all memory.
+        //:
+        //: 7 The allocator can supply memory to other allocators.
+        //
+        // Plan:
+        //: 1 Create allocators for a range of numbers of nodes, and verify
+        //:   'numNodes'.  (C-1)
+        //:
+        //: 2 Allocate blocks of various sizes on each node; verify their
+        //:   alignment and node, and write to them.  (C-2)
+        //:
+        //: 3 Allocate 0 bytes on each node.  (C-3)
+        //:
+        //: 4 Deallocate a block and verify that the next allocation of the
+        //:   same size on the same node returns the same block, while
+        //:   allocations on other nodes do not.  (C-4)
+        //:
+        //: 5 Deallocate 0.  (C-5)
+        //:
+        //: 6 Verify that a test allocator supplying the object has no memory
+        //:   in use after 'release' and after destruction.  (C-6)
+        //:
+        //: 7 Supply a 'bdlma::SequentialAllocator' with an allocator under
+        //:   test.  (C-7)
+        //
+        // Testing:
+        //   NumaAllocator(int numNodes, bslma::Allocator *basicAllocator = 0);
+        //   void *allocateOnNode(size_type size, int node);
+        //   void deallocate(void *address);
+        //   void release();
+        //   int nodeOf(const void *address) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'allocateOnNode', 'deallocate', "
+                             "'nodeOf', AND 'release'\n"
+                             "========================================"
+                             "=======================\n";
+
+        static const int SIZES[] = { 1, 2, 7, 8, 15, 16, 33, 100, 1000, 5000 };
+        enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+        for (int numNodes = 1; numNodes <= 5; ++numNodes) {
+            if (veryVerbose) { P(numNodes) }
+
+            bslma::TestAllocator ta("test", veryVerbose);
+            {
+                Obj mX(numNodes, &ta);  const Obj& X = mX;
+
+                ASSERTV(numNodes, numNodes == X.numNodes());
+                ASSERTV(numNodes, &ta == X.allocator());
+
+                for (int node = 0; node < numNodes; ++node) {
+                    ASSERTV(numNodes, node, 0 == mX.allocateOnNode(0, node));
+
+                    for (int i = 0; i < NUM_SIZES; ++i) {
+                        const int SIZE = SIZES[i];
+
+                        char *block = static_cast<char *>(
+                                                mX.allocateOnNode(SIZE, node));
+
+                        ASSERTV(numNodes, node, SIZE, block);
+                        const int OFFSET = bsls::AlignmentUtil::
+                                                      calculateAlignmentOffset(
+                                                                  block,
+                                                                  k_MAX_ALIGN);
+                        ASSERTV(numNodes, node, SIZE, 0 == OFFSET);
+                        ASSERTV(numNodes, node, SIZE, node == X.nodeOf(block));
+
+                        bsl::memset(block, 0xa5, SIZE);
+                    }
+                }
+
+                for (int node = 0; node < numNodes; ++node) {
+                    void *block = mX.allocateOnNode(24, node);
+                    mX.deallocate(block);
+
+                    for (int other = 0; other < numNodes; ++other) {
+                        if (other != node) {
+                            void *otherBlock = mX.allocateOnNode(24, other);
+                            ASSERTV(numNodes, node, other,
+                                    block != otherBlock);
+                            ASSERTV(numNodes, node, other,
+                                    other == X.nodeOf(otherBlock));
+                        }
+                    }
+
+                    ASSERTV(numNodes, node,
+                            block == mX.allocateOnNode(24, node));
+                    ASSERTV(numNodes, node, node == X.nodeOf(block));
+                }
+
+                mX.deallocate(0);
+
+                ASSERTV(numNodes, 0 < ta.numBytesInUse());
+
+                const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+                mX.release();
+
+                ASSERTV(numNodes, NUM_BLOCKS > ta.numBlocksInUse());
+                ASSERTV(numNodes, 0 < ta.numBlocksInUse());
+
+                for (int node = 0; node < numNodes; ++node) {
+                    void *block = mX.allocateOnNode(64, node);
+                    ASSERTV(numNodes, node, node == X.nodeOf(block));
+                }
+
+                {
+                    bdlma::SequentialAllocator sa(&mX);
+
+                    for (int i = 0; i < 100; ++i) {
+                        bsl::memset(sa.allocate(100), i, 100);
+                    }
+                }
+            }
+            ASSERTV(numNodes, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The default constructor creates an allocator for each node of
+        //:   the host, supplied by the default allocator.
+        //:
+        //: 2 'allocate' returns memory from the multipool of a node of the
+        //:   allocator, and 'deallocate' returns it.
+        //:
+        //: 3 'allocate' returns 0 if the size is 0.
+        //:
+        //: 4 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create allocators with the default constructor, with and without
+        //:   an allocator, and verify 'numNodes' and 'allocator'.  (C-1)
+        //:
+        //: 2 Allocate and deallocate blocks, verifying their node.  (C-2, 3)
+        //:
+        //: 3 Verify that no memory is in use after destruction.  (C-4)
+        //
+        // Testing:
+        //   NumaAllocator(bslma::Allocator *basicAllocator = 0);
+        //   ~NumaAllocator();
+        //   void *allocate(size_type size);
+        //   int numNodes() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(bdlma::NumaUtil::numNodes() == X.numNodes());
+            ASSERT(&da == X.allocator());
+
+            void *block = mX.allocate(100);
+            ASSERT(block);
+            ASSERT(0 <= X.nodeOf(block) && X.nodeOf(block) < X.numNodes());
+            ASSERT(0 < da.numBlocksInUse());
+
+            mX.deallocate(block);
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        bslma::TestAllocator ta("test", veryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(bdlma::NumaUtil::numNodes() == X.numNodes());
+            ASSERT(&ta == X.allocator());
+
+            ASSERT(0 == mX.allocate(0));
+
+            bsl::vector<void *> blocks;
+            for (int i = 1; i < 200; ++i) {
+                void *block = mX.allocate(i);
+                ASSERTV(i, block);
+                ASSERTV(i, 0 <= X.nodeOf(block));
+                ASSERTV(i, X.nodeOf(block) < X.numNodes());
+
+                bsl::memset(block, i, i);
+                blocks.push_back(block);
+            }
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,298 @@
+// bdlma_numautil.cpp                                                 -*-C++-*-
+#include <bdlma_numautil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_numautil_cpp,"$Id$ $CSID$")
+
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+#include <fcntl.h>        // 'open'
+#include <sched.h>        // 'sched_getcpu'
+#include <sys/syscall.h>  // 'SYS_mbind', 'SYS_sched_setaffinity'
+#include <unistd.h>       // 'read', 'close', 'syscall', 'sysconf'
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_MAX_NODES     = 1024,  // maximum number of nodes supported
+
+    k_MAX_CPUS      = 4096,  // maximum number of CPUs supported
+
+    k_BITS_PER_WORD = static_cast<int>(sizeof(unsigned long) * CHAR_BIT),
+
+    k_MPOL_PREFERRED = 1     // Linux memory policy placing pages on a
+                             // preferred node, falling back to other nodes
+};
+
+int g_numNodes = 1;
+    // number of nodes of the host, set once by 'loadTopology'
+
+short g_cpuToNode[k_MAX_CPUS];
+    // node of each CPU, set once by 'loadTopology'
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_boundNode, -1);
+    // Node to which the calling thread was bound by
+    // 'NumaUtil::bindCurrentThreadToNode', or -1 if it is not bound.
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+int parseList(unsigned long *mask, int numBits, const char *list)
+    // Set in the specified 'mask', of the specified 'numBits' bits, the bits
+    // identified by the specified 'list', having the format of the node and
+    // CPU lists of the Linux 'sysfs' file system (for example, "0-3,8,10-11"),
+    // ignoring indices not less than 'numBits'.  Return the greatest index
+    // set, or -1 if none is set.
+{
+    int greatest = -1;
+
+    const char *cursor = list;
+    while (*cursor) {
+        char *end;
+        long  first = bsl::strtol(cursor, &end, 10);
+        if (end == cursor) {
+            break;
+        }
+
+        long last = first;
+        cursor    = end;
+        if ('-' == *cursor) {
+            ++cursor;
+            last = bsl::strtol(cursor, &end, 10);
+            if (end == cursor) {
+                break;
+            }
+            cursor = end;
+        }
+
+        for (long i = first; i <= last && i < numBits; ++i) {
+            mask[i / k_BITS_PER_WORD] |= 1UL << (i % k_BITS_PER_WORD);
+            greatest = static_cast<int>(i);
+        }
+
+        if (',' != *cursor) {
+            break;
+        }
+        ++cursor;
+    }
+    return greatest;
+}
+
+int readFile(char *buffer, int size, const char *path)
+    // Load into the specified 'buffer', of the specified 'size', the
+    // null-terminated contents of the file at the specified 'path', truncated
+    // to 'size - 1' characters.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+    const int fd = ::open(path, O_RDONLY);
+    if (0 > fd) {
+        return -1;                                                    // RETURN
+    }
+
+    const ssize_t length = ::read(fd, buffer, size - 1);
+    ::close(fd);
+
+    if (0 > length) {
+        return -2;                                                    // RETURN
+    }
+    buffer[length] = 0;
+    return 0;
+}
+
+int readNodeCpus(unsigned long *mask, int node)
+    // Set in the specified 'mask' of 'k_MAX_CPUS' bits the bits identifying
+    // the CPUs of the specified 'node'.  Return the greatest CPU set, or -1 if
+    // none is set.
+{
+    char path[64];
+    bsl::sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+
+    char buffer[4096];
+    if (0 != readFile(buffer, sizeof buffer, path)) {
+        return -1;                                                    // RETURN
+    }
+    return parseList(mask, k_MAX_CPUS, buffer);
+}
+
+#endif
+
+void loadTopology()
+    // Set 'g_numNodes' and 'g_cpuToNode' to describe the NUMA topology of the
+    // host.  The behavior is undefined if this function is called more than
+    // once.
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+    char buffer[4096];
+    if (0 != readFile(buffer,
+                      sizeof buffer,
+                      "/sys/devices/system/node/possible")) {
+        return;                                                       // RETURN
+    }
+
+    unsigned long nodes[k_MAX_NODES / k_BITS_PER_WORD] = { 0 };
+
+    const int greatestNode = parseList(nodes, k_MAX_NODES, buffer);
+    if (0 >= greatestNode) {
+        return;                                                       // RETURN
+    }
+
+    for (int node = 0; node <= greatestNode; ++node) {
+        unsigned long cpus[k_MAX_CPUS / k_BITS_PER_WORD] = { 0 };
+
+        const int greatestCpu = readNodeCpus(cpus, node);
+        for (int cpu = 0; cpu <= greatestCpu; ++cpu) {
+            if (cpus[cpu / k_BITS_PER_WORD] & (1UL << cpu % k_BITS_PER_WORD)) {
+                g_cpuToNode[cpu] = static_cast<short>(node);
+            }
+        }
+    }
+    g_numNodes = greatestNode + 1;
+#endif
+}
+
+void initTopology()
+    // Describe the NUMA topology of the host in 'g_numNodes' and
+    // 'g_cpuToNode', unless it was already described.
+{
+    BSLMT_ONCE_DO {
+        loadTopology();
+    }
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                              // ---------------
+                              // struct NumaUtil
+                              // ---------------
+
+// CLASS METHODS
+int NumaUtil::bindCurrentThreadToNode(int node)
+{
+    BSLS_ASSERT(0 <= node);
+    BSLS_ASSERT(node < numNodes());
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    unsigned long cpus[k_MAX_CPUS / k_BITS_PER_WORD] = { 0 };
+
+    if (0 > readNodeCpus(cpus, node)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != ::syscall(SYS_sched_setaffinity, 0, sizeof cpus, cpus)) {
+        return -2;                                                    // RETURN
+    }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_boundNode = node;
+#endif
+    return 0;
+#else
+    (void)node;
+    return -1;
+#endif
+}
+
+int NumaUtil::bindMemoryToNode(void *address, bsl::size_t size, int node)
+{
+    BSLS_ASSERT(0 <= node);
+    BSLS_ASSERT(node < numNodes());
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    typedef bsls::Types::UintPtr UintPtr;
+
+    const UintPtr pageSize = static_cast<UintPtr>(::sysconf(_SC_PAGESIZE));
+    const UintPtr start    = reinterpret_cast<UintPtr>(address);
+    const UintPtr begin    = (start + pageSize - 1) / pageSize * pageSize;
+    const UintPtr end      = (start + size) / pageSize * pageSize;
+
+    if (begin >= end) {
+        return 0;                                                     // RETURN
+    }
+
+    unsigned long nodes[k_MAX_NODES / k_BITS_PER_WORD] = { 0 };
+    nodes[node / k_BITS_PER_WORD] |= 1UL << (node % k_BITS_PER_WORD);
+
+    // Note that the kernel reads one bit less than the specified maximum
+    // node.
+
+    if (0 != ::syscall(SYS_mbind,
+                       begin,
+                       end - begin,
+                       static_cast<int>(k_MPOL_PREFERRED),
+                       nodes,
+                       static_cast<unsigned long>(k_MAX_NODES + 1),
+                       0U)) {
+        return -1;                                                    // RETURN
+    }
+    return 0;
+#else
+    (void)address;
+    (void)size;
+    (void)node;
+    return -1;
+#endif
+}
+
+int NumaUtil::currentNode()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (0 <= g_boundNode) {
+        return g_boundNode;                                           // RETURN
+    }
+#endif
+
+    initTopology();
+    if (1 == g_numNodes) {
+        return 0;                                                     // RETURN
+    }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    const int cpu = ::sched_getcpu();
+    if (0 <= cpu && cpu < k_MAX_CPUS) {
+        return g_cpuToNode[cpu];                                      // RETURN
+    }
+#endif
+    return 0;
+}
+
+int NumaUtil::numNodes()
+{
+    initTopology();
+    return g_numNodes;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
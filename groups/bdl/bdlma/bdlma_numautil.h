@@ -0,0 +1,156 @@
+// bdlma_numautil.h                                                   -*-C++-*-
+#ifndef INCLUDED_BDLMA_NUMAUTIL
+#define INCLUDED_BDLMA_NUMAUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to query and use the NUMA topology of the host.
+//
+//@CLASSES:
+//  bdlma::NumaUtil: namespace for NUMA topology and binding utilities
+//
+//@SEE_ALSO: bdlma_numaallocator
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlma::NumaUtil', that
+// serves as a namespace for utility functions describing the NUMA
+// (non-uniform memory access) topology of the host, and binding threads and
+// memory to the *nodes* of that topology.  On a NUMA host, each node groups a
+// set of CPUs with the memory closest to them; a thread accessing memory on
+// another node ("remote" memory) is slower than one accessing memory on its
+// own node.
+//
+// Nodes are identified by an index in the range '[0 .. numNodes())'.  On
+// platforms where the NUMA topology is not available (including every
+// platform other than Linux), or on hosts that are not NUMA, 'numNodes'
+// returns 1, 'currentNode' returns 0, and the binding functions return a
+// non-zero value without effect.
+//
+///Binding Threads and Memory
+///--------------------------
+// 'bindCurrentThreadToNode' restricts the calling thread to the CPUs of a
+// node, and records that node as the node of the thread, which is then
+// returned by 'currentNode' without consulting the operating system.
+// 'bindMemoryToNode' requests that the pages of a region of memory be placed
+// on a node when they are first accessed; pages that were already accessed
+// are not moved.  Note that, on Linux, memory is by default placed on the node
+// of the thread that first accesses it, so that memory allocated *and first
+// accessed* by a thread bound to a node is local to that node even without
+// calling 'bindMemoryToNode'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Binding a Worker Thread to a Node
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we start one worker thread per NUMA node, and want each worker to
+// run only on the CPUs of its node, so that the memory it allocates and
+// accesses is local to it.
+//
+// First, we define the function run by each worker, which binds the thread to
+// the node identified by its argument:
+//..
+//  extern "C" void *workerFunction(void *arg)
+//  {
+//      const int node = static_cast<int>(reinterpret_cast<bsl::size_t>(arg));
+//
+//      if (0 != bdlma::NumaUtil::bindCurrentThreadToNode(node)) {
+//          // The thread could not be bound (e.g., the platform does not
+//          // support NUMA); it runs unbound, which is still correct.
+//      }
+//..
+// Then, we verify that the worker now reports the node to which it is bound:
+//..
+//      if (1 < bdlma::NumaUtil::numNodes()) {
+//          assert(node == bdlma::NumaUtil::currentNode());
+//      }
+//
+//      // ... process work using memory local to 'node' ...
+//
+//      return 0;
+//  }
+//..
+// Finally, we start a worker for each node:
+//..
+//  bsl::vector<bslmt::ThreadUtil::Handle> handles(
+//                                               bdlma::NumaUtil::numNodes());
+//  for (bsl::size_t i = 0; i < handles.size(); ++i) {
+//      bslmt::ThreadUtil::create(&handles[i],
+//                                workerFunction,
+//                                reinterpret_cast<void *>(i));
+//  }
+//  for (bsl::size_t i = 0; i < handles.size(); ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                              // ===============
+                              // struct NumaUtil
+                              // ===============
+
+struct NumaUtil {
+    // This 'struct' provides a namespace for utility functions describing the
+    // NUMA topology of the host, and binding threads and memory to its nodes.
+
+    // CLASS METHODS
+    static int bindCurrentThreadToNode(int node);
+        // Restrict the calling thread to run on the CPUs of the specified NUMA
+        // 'node', and record 'node' as the node of the calling thread (see
+        // 'currentNode').  Return 0 on success, and a non-zero value (without
+        // effect) if the platform does not support binding threads to nodes,
+        // or 'node' has no CPUs.  The behavior is undefined unless
+        // '0 <= node < numNodes()'.
+
+    static int bindMemoryToNode(void *address, bsl::size_t size, int node);
+        // Request that the pages lying wholly within the specified 'size'
+        // bytes of memory at the specified 'address' be placed on the
+        // specified NUMA 'node' when first accessed.  Return 0 on success (or
+        // if no page lies wholly within the memory), and a non-zero value if
+        // the platform does not support binding memory to nodes, or the
+        // request failed.  The behavior is undefined unless
+        // '0 <= node < numNodes()', and 'address' refers to at least 'size'
+        // bytes of memory allocated by the calling process.  Note that pages
+        // that were already accessed are not moved, and that, should 'node'
+        // have insufficient free memory, pages are placed on another node.
+
+    static int currentNode();
+        // Return the index of the NUMA node of the calling thread: the node to
+        // which the thread was bound by 'bindCurrentThreadToNode' if any, and
+        // otherwise the node of the CPU on which the thread is running (which
+        // may change at any time unless the thread is bound), or 0 if that
+        // node cannot be determined.  The returned value is in the range
+        // '[0 .. numNodes())'.
+
+    static int numNodes();
+        // Return the number of NUMA nodes of the host, or 1 if the NUMA
+        // topology cannot be determined.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
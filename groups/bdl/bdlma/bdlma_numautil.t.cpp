@@ -0,0 +1,387 @@
+// bdlma_numautil.t.cpp                                               -*-C++-*-
+
+#include <bdlma_numautil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>        // 'atoi'
+#include <bsl_cstring.h>        // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <unistd.h>             // 'access'
+#endif
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::NumaUtil' is a utility describing the NUMA topology of the host,
+// and binding threads and memory to its nodes.  As the topology of the test
+// host is not known, the tests verify that the values reported are
+// consistent, and that binding succeeds where the platform reports a
+// topology.  Binding is performed in separate threads so that the binding of
+// the main thread is not affected.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bindCurrentThreadToNode(int node);
+// [ 3] int bindMemoryToNode(void *address, bsl::size_t size, int node);
+// [ 1] int currentNode();
+// [ 1] int numNodes();
+//-----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+//=============================================================================
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::NumaUtil Util;
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool topologyAvailable()
+    // Return 'true' if the NUMA topology of the host is reported by the
+    // platform, and 'false' otherwise.
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+    return 0 == ::access("/sys/devices/system/node/node0/cpulist", R_OK);
+#else
+    return false;
+#endif
+}
+
+struct BindArgs {
+    // This 'struct' provides the arguments and results of 'bindThread'.
+
+    int d_node;         // node to which to bind
+    int d_status;       // status returned by 'bindCurrentThreadToNode'
+    int d_currentNode;  // node reported after binding
+};
+
+extern "C" void *bindThread(void *arg)
+    // Bind the calling thread to the node specified by the 'BindArgs' at the
+    // specified 'arg', and load the status of the binding and the node then
+    // reported by 'currentNode' into that 'BindArgs'.
+{
+    BindArgs *args = static_cast<BindArgs *>(arg);
+
+    args->d_status      = Util::bindCurrentThreadToNode(args->d_node);
+    args->d_currentNode = Util::currentNode();
+    return 0;
+}
+
+//=============================================================================
+//                               USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Binding a Worker Thread to a Node
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we start one worker thread per NUMA node, and want each worker to
+// run only on the CPUs of its node, so that the memory it allocates and
+// accesses is local to it.
+//
+// First, we define the function run by each worker, which binds the thread to
+// the node identified by its argument:
+//..
+    extern "C" void *workerFunction(void *arg)
+    {
+        const int node = static_cast<int>(reinterpret_cast<bsl::size_t>(arg));
+
+        if (0 != bdlma::NumaUtil::bindCurrentThreadToNode(node)) {
+            // The thread could not be bound (e.g., the platform does not
+            // support NUMA); it runs unbound, which is still correct.
+        }
+//..
+// Then, we verify that the worker now reports the node to which it is bound:
+//..
+        if (1 < bdlma::NumaUtil::numNodes()) {
+            ASSERT(node == bdlma::NumaUtil::currentNode());
+        }
+
+        // ... process work using memory local to 'node' ...
+
+        return 0;
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+        using namespace USAGE_EXAMPLE;
+
+// Finally, we start a worker for each node:
+//..
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(
+                                                 bdlma::NumaUtil::numNodes());
+    for (bsl::size_t i = 0; i < handles.size(); ++i) {
+        bslmt::ThreadUtil::create(&handles[i],
+                                  workerFunction,
+                                  reinterpret_cast<void *>(i));
+    }
+    for (bsl::size_t i = 0; i < handles.size(); ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'bindMemoryToNode'
+        //
+        // Concerns:
+        //: 1 Binding memory to a node succeeds where the topology is
+        //:   available, and fails without effect otherwise.
+        //:
+        //: 2 Binding memory within which no page lies wholly succeeds without
+        //:   effect.
+        //:
+        //: 3 Memory bound to a node remains usable.
+        //
+        // Plan:
+        //: 1 Bind a region spanning several pages to each node, write to the
+        //:   region, and verify the status.  (C-1, 3)
+        //:
+        //: 2 Bind a region smaller than a page and verify the status.  (C-2)
+        //
+        // Testing:
+        //   int bindMemoryToNode(void *address, bsl::size_t size, int node);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'bindMemoryToNode'\n"
+                             "==========================\n";
+
+        const int  NUM_NODES = Util::numNodes();
+        const bool EXPECTED  = topologyAvailable();
+
+        if (veryVerbose) { P_(NUM_NODES) P(EXPECTED) }
+
+        enum { k_SIZE = 16 * 65536 };
+
+        char *buffer = new char[k_SIZE];
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            const int rc = Util::bindMemoryToNode(buffer, k_SIZE, node);
+
+            ASSERTV(node, rc, EXPECTED == (0 == rc));
+
+            bsl::memset(buffer, node, k_SIZE);
+            ASSERTV(node, node == buffer[k_SIZE - 1]);
+        }
+
+        char small[16];
+        ASSERT(!EXPECTED || 0 == Util::bindMemoryToNode(small, 16, 0));
+
+        delete [] buffer;
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'bindCurrentThreadToNode'
+        //
+        // Concerns:
+        //: 1 Binding a thread to a node succeeds where the topology is
+        //:   available, and fails otherwise.
+        //:
+        //: 2 A thread bound to a node reports that node as its current node.
+        //:
+        //: 3 The binding of a thread does not affect other threads.
+        //
+        // Plan:
+        //: 1 For each node, bind a new thread to the node, and verify the
+        //:   status and the node it then reports.  (C-1, 2)
+        //:
+        //: 2 Verify that the main thread still reports a node in range.  (C-3)
+        //
+        // Testing:
+        //   int bindCurrentThreadToNode(int node);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'bindCurrentThreadToNode'\n"
+                             "=================================\n";
+
+        const int  NUM_NODES = Util::numNodes();
+        const bool EXPECTED  = topologyAvailable();
+
+        if (veryVerbose) { P_(NUM_NODES) P(EXPECTED) }
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            BindArgs args = { node, -100, -100 };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, bindThread, &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            if (veryVerbose) {
+                P_(node) P_(args.d_status) P(args.d_currentNode)
+            }
+
+            ASSERTV(node, args.d_status, EXPECTED == (0 == args.d_status));
+            ASSERTV(node,
+                    args.d_currentNode,
+                    0 != args.d_status || node == args.d_currentNode);
+            ASSERTV(node,
+                    args.d_currentNode,
+                    0 <= args.d_currentNode && args.d_currentNode < NUM_NODES);
+        }
+
+        const int CURRENT = Util::currentNode();
+        ASSERTV(CURRENT, 0 <= CURRENT && CURRENT < NUM_NODES);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The number of nodes is positive, and stable.
+        //:
+        //: 2 The current node of an unbound thread is in range.
+        //
+        // Plan:
+        //: 1 Call 'numNodes' and 'currentNode' repeatedly, and verify the
+        //:   results.  (C-1, 2)
+        //
+        // Testing:
+        //   int currentNode();
+        //   int numNodes();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        const int NUM_NODES = Util::numNodes();
+
+        if (verbose) { P(NUM_NODES) }
+
+        ASSERTV(NUM_NODES, 1 <= NUM_NODES);
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, NUM_NODES == Util::numNodes());
+
+            const int CURRENT = Util::currentNode();
+            ASSERTV(i, CURRENT, 0 <= CURRENT && CURRENT < NUM_NODES);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
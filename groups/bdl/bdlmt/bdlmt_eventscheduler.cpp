@@ -16,6 +16,8 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
 #include <bdlt_timeunitratio.h>
 
+#include <bslma_deallocatorproctor.h>
+
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
@@ -23,6 +25,8 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 #include <bsls_review.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_limits.h>
+#include <bsl_new.h>
 #include <bsl_vector.h>
 
 // Implementation note: When casting, we often cast through 'void *' or
@@ -119,10 +123,732 @@ bsls::TimeInterval EventSchedulerTestTimeSource_Data::currentTime() const
     return d_currentTime;
 }
 
+                       // ==============================
+                       // struct EventScheduler_WheelLink
+                       // ==============================
+
+struct EventScheduler_WheelLink {
+    // This 'struct' provides the links of a circular, doubly-linked list of
+    // the events of an 'EventScheduler_TimingWheel', and serves as the
+    // sentinel of such a list.
+
+    // DATA
+    EventScheduler_WheelLink *d_prev_p;  // previous link in the list
+
+    EventScheduler_WheelLink *d_next_p;  // next link in the list, or 0 if
+                                         // not linked
+
+    // MANIPULATORS
+    void makeEmpty();
+        // Make this sentinel the sentinel of an empty list.
+
+    void pushBack(EventScheduler_WheelLink *link);
+        // Link the specified 'link' at the back of the list of which this
+        // object is the sentinel.
+
+    void unlink();
+        // Unlink this object from the list holding it.
+
+    // ACCESSORS
+    bool isEmpty() const;
+        // Return 'true' if the list of which this object is the sentinel is
+        // empty, and 'false' otherwise.
+};
+
+                      // ===============================
+                      // class EventScheduler_WheelEvent
+                      // ===============================
+
+class EventScheduler_WheelEvent : public EventScheduler_WheelLink {
+    // This 'class' describes a one-time event of an
+    // 'EventScheduler_TimingWheel'.  An event is linked into a slot of the
+    // wheel, the list of due events, or the list of events beyond the range
+    // of the wheel while it is scheduled, and is reference-counted: the wheel
+    // holds a reference while the event is scheduled, and each handle to the
+    // event holds a reference.
+
+  public:
+    // DATA
+    bsls::Types::Int64          d_time;      // scheduled time (in
+                                             // microseconds)
+
+    int                         d_level;     // level of the wheel holding
+                                             // the event, or 'k_DUE_LEVEL'
+
+    bsls::AtomicInt             d_refCount;  // number of references
+
+    EventScheduler_TimingWheel *d_wheel_p;   // wheel of the event
+
+    bsl::function<void()>       d_callback;  // callback of the event
+
+  private:
+    // NOT IMPLEMENTED
+    EventScheduler_WheelEvent(const EventScheduler_WheelEvent&);
+    EventScheduler_WheelEvent& operator=(const EventScheduler_WheelEvent&);
+
+  public:
+    // CREATORS
+    EventScheduler_WheelEvent(EventScheduler_TimingWheel   *wheel,
+                              bsls::Types::Int64            time,
+                              const bsl::function<void()>&  callback,
+                              bslma::Allocator             *basicAllocator);
+        // Create an unlinked event of the specified 'wheel', scheduled at the
+        // specified 'time' (in microseconds), having the specified 'callback'
+        // and one reference, and using the specified 'basicAllocator' to
+        // supply memory.
+};
+
+                      // ================================
+                      // class EventScheduler_TimingWheel
+                      // ================================
+
+class EventScheduler_TimingWheel {
+    // This 'class' provides a thread-safe hierarchical hashed timing wheel
+    // holding the one-time events of an 'EventScheduler'.  Each of the
+    // 'k_NUM_LEVELS' levels of the wheel has 'k_NUM_SLOTS' slots; a slot of
+    // level 'L' holds the events due within a span of 'k_NUM_SLOTS ** L'
+    // ticks.  At the start of each span of a level, the events of the
+    // corresponding slot are *cascaded* into the levels below, so that each
+    // event reaches level 0 before the tick at which it is due.  Events due
+    // beyond the range of the wheel are kept in an *overflow* list, cascaded
+    // at the start of each span of the range of the wheel.  The dispatcher
+    // thread advances the wheel, moving the events due to a list of due
+    // events ordered by scheduled time.
+
+  public:
+    // TYPES
+    enum {
+        k_SLOT_BITS      = 8,                    // bits of a slot index
+        k_NUM_SLOTS      = 1 << k_SLOT_BITS,     // slots per level
+        k_NUM_LEVELS     = 4,                    // levels of the wheel
+        k_OVERFLOW_LEVEL = k_NUM_LEVELS,         // level of the events
+                                                 // beyond the range
+        k_DUE_LEVEL      = k_NUM_LEVELS + 1      // level of the due events
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef EventScheduler_WheelLink  Link;
+    typedef EventScheduler_WheelEvent WheelEvent;
+
+    struct FreeEvent {
+        // This 'struct' describes the memory of a released event, retained
+        // for reuse.
+
+        FreeEvent *d_next_p;  // next released event
+    };
+
+    // DATA
+    const bsls::Types::Int64     d_tick;          // tick (in microseconds)
+
+    const bsl::function<bsls::TimeInterval()>&
+                                 d_now;           // current time functor of
+                                                  // the scheduler
+
+    mutable bslmt::Mutex         d_mutex;         // protects the following
+
+    bsls::Types::Int64           d_currentTick;   // last tick processed, or
+                                                  // -1 before the first
+
+    bsls::Types::Int64           d_wakeTick;      // tick at which the
+                                                  // dispatcher expects to
+                                                  // examine the wheel next
+
+    Link                         d_slots[k_NUM_LEVELS][k_NUM_SLOTS];
+                                                  // sentinels of the slots
+
+    Link                         d_overflow;      // sentinel of the events
+                                                  // beyond the range
+
+    Link                         d_due;           // sentinel of the events
+                                                  // due, in time order
+
+    int                          d_numEventsInLevel[k_DUE_LEVEL + 1];
+                                                  // events of each level
+
+    FreeEvent                   *d_freeList_p;    // memory of released events
+
+    bslma::Allocator            *d_allocator_p;   // memory allocator (held)
+
+    // NOT IMPLEMENTED
+    EventScheduler_TimingWheel(const EventScheduler_TimingWheel&);
+    EventScheduler_TimingWheel& operator=(const EventScheduler_TimingWheel&);
+
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Int64 levelSpan(int level);
+        // Return the number of ticks spanned by a slot of the specified
+        // 'level'.
+
+    // PRIVATE MANIPULATORS
+    void cascade(Link *list);
+        // Re-insert the events of the list of which the specified 'list' is
+        // the sentinel into the wheel.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+    void initialize();
+        // Set the current tick from the current time, if not yet set.  The
+        // behavior is undefined unless 'd_mutex' is locked.
+
+    void insert(WheelEvent *event);
+        // Link the specified unlinked 'event' into a slot, the overflow list,
+        // or the list of due events, according to its scheduled time.  The
+        // behavior is undefined unless 'd_mutex' is locked.
+
+    void remove(WheelEvent *event);
+        // Unlink the specified linked 'event'.  The behavior is undefined
+        // unless 'd_mutex' is locked.
+
+    bool updateWakeTick(const WheelEvent& event);
+        // Return 'true' if the specified linked 'event' is due before the
+        // tick at which the dispatcher expects to examine the wheel next,
+        // and expect the dispatcher to examine it at the tick of 'event' in
+        // that case, and 'false' otherwise.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+  public:
+    // CLASS METHODS
+    static void releaseReference(WheelEvent *event);
+        // Decrement the reference count of the specified 'event', destroying
+        // the event and retaining its memory for reuse by its wheel if no
+        // references remain.
+
+    // CREATORS
+    EventScheduler_TimingWheel(
+                      const bsls::TimeInterval&                   tick,
+                      const bsl::function<bsls::TimeInterval()>&  now,
+                      bslma::Allocator                           *allocator);
+        // Create an empty timing wheel of the specified 'tick', obtaining the
+        // current time from the specified 'now' functor, and using the
+        // specified 'allocator' to supply memory.  The behavior is undefined
+        // unless 'tick' is at least one microsecond, and 'now' outlives this
+        // object.
+
+    ~EventScheduler_TimingWheel();
+        // Cancel the scheduled events and destroy this object.  The behavior
+        // is undefined unless all references to events, other than those
+        // held by this wheel, have been released.
+
+    // MANIPULATORS
+    WheelEvent *add(bool                         *newTop,
+                    bsls::Types::Int64            time,
+                    const bsl::function<void()>&  callback,
+                    bool                          reference);
+        // Schedule a new event having the specified 'callback' at the
+        // specified 'time' (in microseconds), and return the event, having
+        // an additional reference, to be released by the caller, if the
+        // specified 'reference' is 'true'.  Load into the specified 'newTop'
+        // whether the dispatcher must be signaled to examine the wheel before
+        // it expected to.
+
+    int cancel(WheelEvent *event);
+        // Cancel the specified 'event'.  Return 0 on success, and a non-zero
+        // value if 'event' is not scheduled (i.e., has been dispatched or
+        // cancelled).
+
+    void cancelAll();
+        // Cancel all scheduled events.
+
+    WheelEvent *popDue();
+        // Unlink and return the first due event, transferring the reference
+        // held by this wheel to the caller, or return 0 if no event is due.
+
+    bool poll(bsls::Types::Int64 *time, bsls::Types::Int64 now);
+        // Advance this wheel to the specified 'now' (in microseconds).  If an
+        // event is due, load its scheduled time into the specified 'time' and
+        // return 'true'; otherwise, load into 'time' the time at which this
+        // wheel must next be polled (or the maximum 'Int64' value if no event
+        // is scheduled), expect to be polled at that time, and return
+        // 'false'.
+
+    int reschedule(bool               *newTop,
+                   WheelEvent         *event,
+                   bsls::Types::Int64  time);
+        // Reschedule the specified 'event' at the specified 'time' (in
+        // microseconds), and load into the specified 'newTop' whether the
+        // dispatcher must be signaled to examine the wheel before it expected
+        // to.  Return 0 on success, and a non-zero value if 'event' is not
+        // scheduled.
+
+    // ACCESSORS
+    int numEvents() const;
+        // Return the number of scheduled events.
+
+    bsls::Types::Int64 tick() const;
+        // Return the tick (in microseconds) of this wheel.
+};
+
+                       // ------------------------------
+                       // struct EventScheduler_WheelLink
+                       // ------------------------------
+
+// MANIPULATORS
+inline
+void EventScheduler_WheelLink::makeEmpty()
+{
+    d_prev_p = this;
+    d_next_p = this;
+}
+
+inline
+void EventScheduler_WheelLink::pushBack(EventScheduler_WheelLink *link)
+{
+    link->d_prev_p     = d_prev_p;
+    link->d_next_p     = this;
+    d_prev_p->d_next_p = link;
+    d_prev_p           = link;
+}
+
+inline
+void EventScheduler_WheelLink::unlink()
+{
+    d_prev_p->d_next_p = d_next_p;
+    d_next_p->d_prev_p = d_prev_p;
+    d_prev_p           = 0;
+    d_next_p           = 0;
+}
+
+// ACCESSORS
+inline
+bool EventScheduler_WheelLink::isEmpty() const
+{
+    return d_next_p == this;
+}
+
+                      // -------------------------------
+                      // class EventScheduler_WheelEvent
+                      // -------------------------------
+
+// CREATORS
+EventScheduler_WheelEvent::EventScheduler_WheelEvent(
+                                EventScheduler_TimingWheel   *wheel,
+                                bsls::Types::Int64            time,
+                                const bsl::function<void()>&  callback,
+                                bslma::Allocator             *basicAllocator)
+: d_time(time)
+, d_level(EventScheduler_TimingWheel::k_DUE_LEVEL)
+, d_refCount(1)
+, d_wheel_p(wheel)
+, d_callback(bsl::allocator_arg_t(), basicAllocator, callback)
+{
+    d_prev_p = 0;
+    d_next_p = 0;
+}
+
+                      // --------------------------------
+                      // class EventScheduler_TimingWheel
+                      // --------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Int64 EventScheduler_TimingWheel::levelSpan(int level)
+{
+    return static_cast<bsls::Types::Int64>(1) << (k_SLOT_BITS * level);
+}
+
+// PRIVATE MANIPULATORS
+void EventScheduler_TimingWheel::cascade(Link *list)
+{
+    // Move the events to a local list first, as they may be re-inserted into
+    // 'list'.
+
+    Link events;
+    events.makeEmpty();
+
+    while (!list->isEmpty()) {
+        WheelEvent *event = static_cast<WheelEvent *>(list->d_next_p);
+        remove(event);
+        events.pushBack(event);
+    }
+    while (!events.isEmpty()) {
+        WheelEvent *event = static_cast<WheelEvent *>(events.d_next_p);
+        event->unlink();
+        insert(event);
+    }
+}
+
+void EventScheduler_TimingWheel::initialize()
+{
+    if (0 > d_currentTick) {
+        d_currentTick = d_now().totalMicroseconds() / d_tick;
+    }
+}
+
+void EventScheduler_TimingWheel::insert(WheelEvent *event)
+{
+    int level;
+
+    if (event->d_time <= d_currentTick * d_tick) {
+        // The event is due: insert it in time order, searching from the back
+        // as events are mostly due in the order scheduled.
+
+        Link *prev = d_due.d_prev_p;
+        while (prev != &d_due
+            && static_cast<WheelEvent *>(prev)->d_time > event->d_time) {
+            prev = prev->d_prev_p;
+        }
+        prev->d_next_p->pushBack(event);
+        level = k_DUE_LEVEL;
+    }
+    else {
+        const bsls::Types::Int64 tick  = (event->d_time + d_tick - 1)
+                                       / d_tick;
+        const bsls::Types::Int64 delta = tick - d_currentTick;
+
+        level = 0;
+        while (level < k_NUM_LEVELS && delta >= levelSpan(level + 1)) {
+            ++level;
+        }
+
+        if (k_OVERFLOW_LEVEL == level) {
+            d_overflow.pushBack(event);
+        }
+        else {
+            const int slot = static_cast<int>(
+                          (tick >> (k_SLOT_BITS * level)) & (k_NUM_SLOTS - 1));
+            d_slots[level][slot].pushBack(event);
+        }
+    }
+
+    event->d_level = level;
+    ++d_numEventsInLevel[level];
+}
+
+void EventScheduler_TimingWheel::remove(WheelEvent *event)
+{
+    --d_numEventsInLevel[event->d_level];
+    event->unlink();
+}
+
+bool EventScheduler_TimingWheel::updateWakeTick(const WheelEvent& event)
+{
+    const bsls::Types::Int64 tick = k_DUE_LEVEL == event.d_level
+                                  ? d_currentTick
+                                  : (event.d_time + d_tick - 1) / d_tick;
+
+    if (tick < d_wakeTick) {
+        d_wakeTick = tick;
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
+// CLASS METHODS
+void EventScheduler_TimingWheel::releaseReference(WheelEvent *event)
+{
+    if (0 != event->d_refCount.addAcqRel(-1)) {
+        return;                                                       // RETURN
+    }
+
+    EventScheduler_TimingWheel *wheel = event->d_wheel_p;
+
+    // Destroy the event outside the lock, as destroying its callback may run
+    // arbitrary code.
+
+    event->~WheelEvent();
+
+    FreeEvent *memory = reinterpret_cast<FreeEvent *>(
+                                                  static_cast<void *>(event));
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&wheel->d_mutex);
+
+    memory->d_next_p    = wheel->d_freeList_p;
+    wheel->d_freeList_p = memory;
+}
+
+// CREATORS
+EventScheduler_TimingWheel::EventScheduler_TimingWheel(
+                        const bsls::TimeInterval&                   tick,
+                        const bsl::function<bsls::TimeInterval()>&  now,
+                        bslma::Allocator                           *allocator)
+: d_tick(tick.totalMicroseconds())
+, d_now(now)
+, d_currentTick(-1)
+, d_wakeTick(bsl::numeric_limits<bsls::Types::Int64>::max())
+, d_freeList_p(0)
+, d_allocator_p(allocator)
+{
+    BSLS_ASSERT(0 < d_tick);
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+            d_slots[level][slot].makeEmpty();
+        }
+    }
+    d_overflow.makeEmpty();
+    d_due.makeEmpty();
+
+    bsl::fill(d_numEventsInLevel, d_numEventsInLevel + k_DUE_LEVEL + 1, 0);
+}
+
+EventScheduler_TimingWheel::~EventScheduler_TimingWheel()
+{
+    cancelAll();
+
+    while (d_freeList_p) {
+        FreeEvent *next = d_freeList_p->d_next_p;
+        d_allocator_p->deallocate(d_freeList_p);
+        d_freeList_p = next;
+    }
+}
+
+// MANIPULATORS
+EventScheduler_WheelEvent *EventScheduler_TimingWheel::add(
+                                       bool                         *newTop,
+                                       bsls::Types::Int64            time,
+                                       const bsl::function<void()>&  callback,
+                                       bool                          reference)
+{
+    void *memory;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        memory = d_freeList_p;
+        if (memory) {
+            d_freeList_p = d_freeList_p->d_next_p;
+        }
+    }
+    if (!memory) {
+        memory = d_allocator_p->allocate(sizeof(WheelEvent));
+    }
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(memory,
+                                                        d_allocator_p);
+
+    WheelEvent *event = new (memory) WheelEvent(this,
+                                                time,
+                                                callback,
+                                                d_allocator_p);
+    proctor.release();
+
+    if (reference) {
+        event->d_refCount.addRelaxed(1);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    initialize();
+    insert(event);
+    *newTop = updateWakeTick(*event);
+
+    return event;
+}
+
+int EventScheduler_TimingWheel::cancel(WheelEvent *event)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (0 == event->d_next_p) {
+            return 1;                                                 // RETURN
+        }
+        remove(event);
+    }
+
+    releaseReference(event);
+    return 0;
+}
+
+void EventScheduler_TimingWheel::cancelAll()
+{
+    Link events;
+    events.makeEmpty();
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        for (int level = 0; level < k_NUM_LEVELS; ++level) {
+            for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+                Link& list = d_slots[level][slot];
+                while (!list.isEmpty()) {
+                    WheelEvent *event = static_cast<WheelEvent *>(
+                                                              list.d_next_p);
+                    remove(event);
+                    events.pushBack(event);
+                }
+            }
+        }
+
+        Link *lists[] = { &d_overflow, &d_due };
+        for (int i = 0; i < 2; ++i) {
+            while (!lists[i]->isEmpty()) {
+                WheelEvent *event = static_cast<WheelEvent *>(
+                                                         lists[i]->d_next_p);
+                remove(event);
+                events.pushBack(event);
+            }
+        }
+    }
+
+    // Release the references outside the lock, as releasing the last
+    // reference to an event locks 'd_mutex'.
+
+    while (!events.isEmpty()) {
+        WheelEvent *event = static_cast<WheelEvent *>(events.d_next_p);
+        event->unlink();
+        releaseReference(event);
+    }
+}
+
+EventScheduler_WheelEvent *EventScheduler_TimingWheel::popDue()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_due.isEmpty()) {
+        return 0;                                                     // RETURN
+    }
+
+    WheelEvent *event = static_cast<WheelEvent *>(d_due.d_next_p);
+    remove(event);
+    return event;
+}
+
+bool EventScheduler_TimingWheel::poll(bsls::Types::Int64 *time,
+                                      bsls::Types::Int64  now)
+{
+    typedef bsls::Types::Int64 Int64;
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    initialize();
+
+    const Int64 target = now / d_tick;
+
+    while (d_currentTick < target) {
+        if (0 == d_numEventsInLevel[0]) {
+            // No event can become due before the start of the next span of
+            // the lowest non-empty level: skip to the tick preceding it.
+
+            int level = 1;
+            while (level <= k_OVERFLOW_LEVEL
+                && 0 == d_numEventsInLevel[level]) {
+                ++level;
+            }
+
+            if (level > k_OVERFLOW_LEVEL) {
+                d_currentTick = target;
+                break;
+            }
+
+            const Int64 span  = levelSpan(level);
+            const Int64 start = (d_currentTick / span + 1) * span;
+            if (start > target) {
+                d_currentTick = target;
+                break;
+            }
+            d_currentTick = start - 1;
+        }
+
+        const Int64 tick = ++d_currentTick;
+
+        // Cascade, from the top level down, the slot of each level whose span
+        // starts at 'tick', then move the events of the slot of 'tick' to the
+        // list of due events.
+
+        if (0 == tick % levelSpan(k_NUM_LEVELS)) {
+            cascade(&d_overflow);
+        }
+        for (int level = k_NUM_LEVELS - 1; level > 0; --level) {
+            if (0 == tick % levelSpan(level)) {
+                const int slot = static_cast<int>(
+                          (tick >> (k_SLOT_BITS * level)) & (k_NUM_SLOTS - 1));
+                cascade(&d_slots[level][slot]);
+            }
+        }
+        cascade(&d_slots[0][tick & (k_NUM_SLOTS - 1)]);
+    }
+
+    if (!d_due.isEmpty()) {
+        // The dispatcher will poll again before waiting: no signal is needed
+        // until then.
+
+        *time      = static_cast<WheelEvent *>(d_due.d_next_p)->d_time;
+        d_wakeTick = bsl::numeric_limits<Int64>::min();
+        return true;                                                  // RETURN
+    }
+
+    // Find the next tick at which an event may become due: that of the next
+    // non-empty slot of level 0 in the current span of level 1, or else the
+    // start of the next span of the lowest non-empty level.
+
+    Int64 wakeTick = bsl::numeric_limits<Int64>::max();
+
+    if (0 != d_numEventsInLevel[0]) {
+        const Int64 start = (d_currentTick / k_NUM_SLOTS + 1) * k_NUM_SLOTS;
+
+        wakeTick = start;
+        for (Int64 tick = d_currentTick + 1; tick < start; ++tick) {
+            if (!d_slots[0][tick & (k_NUM_SLOTS - 1)].isEmpty()) {
+                wakeTick = tick;
+                break;
+            }
+        }
+    }
+    else {
+        for (int level = 1; level <= k_OVERFLOW_LEVEL; ++level) {
+            if (0 != d_numEventsInLevel[level]) {
+                const Int64 span = levelSpan(level);
+                wakeTick = (d_currentTick / span + 1) * span;
+                break;
+            }
+        }
+    }
+
+    d_wakeTick = wakeTick;
+    *time      = wakeTick > bsl::numeric_limits<Int64>::max() / d_tick
+               ? bsl::numeric_limits<Int64>::max()
+               : wakeTick * d_tick;
+    return false;
+}
+
+int EventScheduler_TimingWheel::reschedule(bool               *newTop,
+                                           WheelEvent         *event,
+                                           bsls::Types::Int64  time)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (0 == event->d_next_p) {
+        return 1;                                                     // RETURN
+    }
+
+    remove(event);
+    event->d_time = time;
+    insert(event);
+    *newTop = updateWakeTick(*event);
+    return 0;
+}
+
+// ACCESSORS
+int EventScheduler_TimingWheel::numEvents() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    int numEvents = 0;
+    for (int level = 0; level <= k_DUE_LEVEL; ++level) {
+        numEvents += d_numEventsInLevel[level];
+    }
+    return numEvents;
+}
+
+inline
+bsls::Types::Int64 EventScheduler_TimingWheel::tick() const
+{
+    return d_tick;
+}
+
                            // --------------------
                            // class EventScheduler
                            // --------------------
 
+// PRIVATE CLASS METHODS
+void EventScheduler::addWheelEventRef(EventScheduler_WheelEvent *event)
+{
+    event->d_refCount.addRelaxed(1);
+}
+
+void EventScheduler::releaseWheelEventRef(EventScheduler_WheelEvent *event)
+{
+    EventScheduler_TimingWheel::releaseReference(event);
+}
+
 // PRIVATE MANIPULATORS
 bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
 {
@@ -162,10 +888,42 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
     return t;
 }
 
+void EventScheduler::dispatch(
+                         bslmt::LockGuard<bslmt::Mutex>      *lock,
+                         bsl::vector<bsl::function<void()> > *batch,
+                         const bsl::function<void()>&         callback,
+                         bsls::Types::Int64                   time)
+{
+    d_latenessStats.record(d_currentTimeFunctor().totalMicroseconds() - time);
+
+    if (0 == d_maxBatchSize) {
+        lock->release()->unlock();
+        d_dispatcherFunctor(callback);
+        return;                                                       // RETURN
+    }
+
+    batch->push_back(callback);
+    if (static_cast<int>(batch->size()) >= d_maxBatchSize) {
+        lock->release()->unlock();
+        dispatchBatch(batch);
+    }
+}
+
+void EventScheduler::dispatchBatch(bsl::vector<bsl::function<void()> > *batch)
+{
+    if (!batch->empty()) {
+        d_batchDispatcherFunctor(batch);
+        batch->clear();
+    }
+}
+
 void EventScheduler::dispatchEvents()
 {
     bsls::Types::Int64 now = d_currentTimeFunctor().totalMicroseconds();
 
+    bsl::vector<bsl::function<void()> > batch(allocator());
+    batch.reserve(d_maxBatchSize);
+
     while (1) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
@@ -181,6 +939,8 @@ void EventScheduler::dispatchEvents()
         // Now proceed with the next iteration.
 
         if (!d_running) {
+            lock.release()->unlock();
+            dispatchBatch(&batch);
             return;                                                   // RETURN
         }
 
@@ -191,6 +951,11 @@ void EventScheduler::dispatchEvents()
         d_eventQueue.frontRaw(&d_currentEvent);
 
         if (0 == d_currentRecurringEvent && 0 == d_currentEvent) {
+            if (!batch.empty()) {
+                lock.release()->unlock();
+                dispatchBatch(&batch);
+                continue;
+            }
             ++d_waitCount;
             d_queueCondition.wait(&d_mutex);
             continue;
@@ -200,6 +965,11 @@ void EventScheduler::dispatchEvents()
 
         if (t > now) {
             releaseCurrentEvents();
+            if (!batch.empty()) {
+                lock.release()->unlock();
+                dispatchBatch(&batch);
+                continue;
+            }
             bsls::TimeInterval w;
             w.addMicroseconds(t);
             ++d_waitCount;
@@ -215,21 +985,116 @@ void EventScheduler::dispatchEvents()
                                           d_currentRecurringEvent,
                                           t + data.second.totalMicroseconds());
             if (0 == ret) {
-                lock.release()->unlock();
-                d_dispatcherFunctor(data.first);
+                dispatch(&lock, &batch, data.first, t);
             }
             continue;
         }
         BSLS_ASSERT(0 != d_currentEvent);
         int ret = d_eventQueue.remove(d_currentEvent);
         if (0 == ret) {
-            lock.release()->unlock();
-            d_dispatcherFunctor(d_currentEvent->data());
+            dispatch(&lock, &batch, d_currentEvent->data(), t);
         }
     }
 
 }
 
+void EventScheduler::dispatchWheelEvents()
+{
+    BSLS_ASSERT(d_wheel_p);
+
+    bsl::vector<bsl::function<void()> > batch(allocator());
+    batch.reserve(d_maxBatchSize);
+
+    while (1) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Get ready for the next iteration.
+
+        releaseCurrentEvents();
+
+        if (d_dispatcherAwaited) {
+            d_dispatcherAwaited = false;
+            d_iterationCondition.broadcast();
+        }
+
+        // Now proceed with the next iteration.
+
+        if (!d_running) {
+            lock.release()->unlock();
+            dispatchBatch(&batch);
+            return;                                                   // RETURN
+        }
+
+        BSLS_ASSERT(0 == d_currentRecurringEvent);
+        BSLS_ASSERT(0 == d_currentWheelEvent);
+
+        d_recurringQueue.frontRaw(&d_currentRecurringEvent);
+
+        bsls::Types::Int64 now = d_currentTimeFunctor().totalMicroseconds();
+        bsls::Types::Int64 eventTime;
+
+        const bool isEventDue = d_wheel_p->poll(&eventTime, now);
+
+        // Prefer overdue events over overdue clocks if running behind.
+
+        if (isEventDue
+         && (0 == d_currentRecurringEvent
+          || eventTime < d_currentRecurringEvent->key()
+          || eventTime < now)) {
+            releaseCurrentEvents();
+
+            d_currentWheelEvent = d_wheel_p->popDue();
+            if (d_currentWheelEvent) {
+                dispatch(&lock,
+                         &batch,
+                         d_currentWheelEvent->d_callback,
+                         d_currentWheelEvent->d_time);
+            }
+            continue;
+        }
+
+        if (d_currentRecurringEvent
+         && d_currentRecurringEvent->key() <= now) {
+            const bsls::Types::Int64 t = d_currentRecurringEvent->key();
+
+            RecurringEventData& data = d_currentRecurringEvent->data();
+            int ret = d_recurringQueue.updateR(
+                                          d_currentRecurringEvent,
+                                          t + data.second.totalMicroseconds());
+            if (0 == ret) {
+                dispatch(&lock, &batch, data.first, t);
+            }
+            continue;
+        }
+
+        // Nothing is due: dispatch the events collected, if any, then wait
+        // until the next recurring event, or the next time the wheel must be
+        // polled, whichever comes first.
+
+        bsls::Types::Int64 t = eventTime;
+        if (d_currentRecurringEvent) {
+            t = bsl::min(t, d_currentRecurringEvent->key());
+        }
+        releaseCurrentEvents();
+
+        if (!batch.empty()) {
+            lock.release()->unlock();
+            dispatchBatch(&batch);
+            continue;
+        }
+
+        ++d_waitCount;
+        if (bsl::numeric_limits<bsls::Types::Int64>::max() == t) {
+            d_queueCondition.wait(&d_mutex);
+        }
+        else {
+            bsls::TimeInterval w;
+            w.addMicroseconds(t);
+            d_queueCondition.timedWait(&d_mutex, w);
+        }
+    }
+}
+
 void EventScheduler::releaseCurrentEvents()
 {
     if (d_currentRecurringEvent) {
@@ -241,6 +1106,11 @@ void EventScheduler::releaseCurrentEvents()
         d_eventQueue.releaseReferenceRaw(d_currentEvent);
         d_currentEvent = 0;
     }
+
+    if (d_currentWheelEvent) {
+        EventScheduler_TimingWheel::releaseReference(d_currentWheelEvent);
+        d_currentWheelEvent = 0;
+    }
 }
 
 // CREATORS
@@ -250,13 +1120,17 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
 , d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(false)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 {
@@ -268,14 +1142,18 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
                        createDefaultCurrentTimeFunctor(clockType))
 , d_eventQueue(basicAllocator)
 , d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_queueCondition(clockType)
 , d_running(false)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 {
@@ -289,13 +1167,17 @@ EventScheduler::EventScheduler(
                                             bsls::SystemClockType::e_REALTIME))
 , d_eventQueue(basicAllocator)
 , d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(false)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 {
@@ -309,22 +1191,158 @@ EventScheduler::EventScheduler(
                        createDefaultCurrentTimeFunctor(clockType))
 , d_eventQueue(basicAllocator)
 , d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_queueCondition(clockType)
 , d_running(false)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 {
 }
 
+EventScheduler::EventScheduler(
+                              bsls::SystemClockType::Enum  clockType,
+                              const bsls::TimeInterval&    timingWheelTick,
+                              bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(1 <= timingWheelTick.totalMicroseconds());
+
+    d_wheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                                          timingWheelTick,
+                                                          d_currentTimeFunctor,
+                                                          allocator());
+}
+
+EventScheduler::EventScheduler(
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsls::TimeInterval&          timingWheelTick,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(1 <= timingWheelTick.totalMicroseconds());
+
+    d_wheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                                          timingWheelTick,
+                                                          d_currentTimeFunctor,
+                                                          allocator());
+}
+
+EventScheduler::EventScheduler(
+               const EventScheduler::BatchDispatcher&  batchDispatcherFunctor,
+               int                                     maxBatchSize,
+               bsls::SystemClockType::Enum             clockType,
+               bslma::Allocator                       *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                           batchDispatcherFunctor)
+, d_maxBatchSize(maxBatchSize)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(batchDispatcherFunctor);
+    BSLS_ASSERT(1 <= maxBatchSize);
+}
+
+EventScheduler::EventScheduler(
+               const EventScheduler::BatchDispatcher&  batchDispatcherFunctor,
+               int                                     maxBatchSize,
+               bsls::SystemClockType::Enum             clockType,
+               const bsls::TimeInterval&               timingWheelTick,
+               bslma::Allocator                       *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_wheel_p(0)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                           batchDispatcherFunctor)
+, d_maxBatchSize(maxBatchSize)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(batchDispatcherFunctor);
+    BSLS_ASSERT(1 <= maxBatchSize);
+    BSLS_ASSERT(1 <= timingWheelTick.totalMicroseconds());
+
+    d_wheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                                          timingWheelTick,
+                                                          d_currentTimeFunctor,
+                                                          allocator());
+}
+
 EventScheduler::~EventScheduler()
 {
     BSLS_ASSERT(bslmt::ThreadUtil::invalidHandle() == d_dispatcherThread);
+
+    if (d_wheel_p) {
+        allocator()->deleteObject(d_wheel_p);
+    }
 }
 
 // MANIPULATORS
@@ -356,7 +1374,10 @@ int EventScheduler::start(const bslmt::ThreadAttributes& threadAttributes)
     if (bslmt::ThreadUtil::createWithAllocator(
                 &d_dispatcherThread,
                 modAttr,
-                bdlf::BindUtil::bind(&EventScheduler::dispatchEvents, this),
+                bdlf::BindUtil::bind(d_wheel_p
+                                     ? &EventScheduler::dispatchWheelEvents
+                                     : &EventScheduler::dispatchEvents,
+                                     this),
                 allocator())) {
         return -1;                                                    // RETURN
     }
@@ -395,10 +1416,22 @@ EventScheduler::scheduleEvent(EventHandle                  *event,
 {
     bool newTop;
 
-    d_eventQueue.addR(&event->d_handle,
-                      epochTime.totalMicroseconds(),
-                      callback,
-                      &newTop);
+    if (d_wheel_p) {
+        event->release();
+        event->d_wheelEvent_p = d_wheel_p->add(&newTop,
+                                               epochTime.totalMicroseconds(),
+                                               callback,
+                                               true);
+    }
+    else {
+        if (event->d_wheelEvent_p) {
+            event->release();
+        }
+        d_eventQueue.addR(&event->d_handle,
+                          epochTime.totalMicroseconds(),
+                          callback,
+                          &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -412,10 +1445,23 @@ void EventScheduler::scheduleEventRaw(Event                        **event,
 {
     bool newTop;
 
-    d_eventQueue.addRawR((EventQueue::Pair **)event,
-                         epochTime.totalMicroseconds(),
-                         callback,
-                         &newTop);
+    if (d_wheel_p) {
+        EventScheduler_WheelEvent *wheelEvent =
+                                d_wheel_p->add(&newTop,
+                                               epochTime.totalMicroseconds(),
+                                               callback,
+                                               0 != event);
+        if (event) {
+            *event = reinterpret_cast<Event *>(
+                                           static_cast<void *>(wheelEvent));
+        }
+    }
+    else {
+        d_eventQueue.addRawR((EventQueue::Pair **)event,
+                             epochTime.totalMicroseconds(),
+                             callback,
+                             &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -486,6 +1532,29 @@ EventScheduler::scheduleRecurringEventRaw(
     }
 }
 
+int EventScheduler::cancelEvent(const Event *handle)
+{
+    if (d_wheel_p) {
+        if (0 == handle) {
+            return EventQueue::e_INVALID;                             // RETURN
+        }
+
+        EventScheduler_WheelEvent *event =
+                             reinterpret_cast<EventScheduler_WheelEvent *>(
+                                  const_cast<void *>(
+                                      reinterpret_cast<const void *>(handle)));
+
+        return d_wheel_p->cancel(event) ? EventQueue::e_NOT_FOUND : 0;
+                                                                      // RETURN
+    }
+
+    const EventQueue::Pair *itemPtr =
+                        reinterpret_cast<const EventQueue::Pair*>(
+                                        reinterpret_cast<const void*>(handle));
+
+    return d_eventQueue.remove(itemPtr);
+}
+
 int EventScheduler::cancelEvent(EventHandle *handle)
 {
     if (0 == (const Event *) *handle) {
@@ -550,11 +1619,7 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    const EventQueue::Pair *itemPtr =
-                             reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
-
-    int ret = d_eventQueue.remove(itemPtr);
+    int ret = cancelEvent(handle);
     if (EventQueue::e_NOT_FOUND != ret) {
         return ret;                                                   // RETURN
     }
@@ -563,9 +1628,12 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     // in the list.  Check whether the currently executing event is the one we
     // wanted to cancel; if it is, wait until the next iteration.
 
+    const void *itemPtr = handle;
+
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (d_currentEvent != itemPtr) {
+        if (static_cast<const void *>(d_currentEvent) != itemPtr
+         && static_cast<const void *>(d_currentWheelEvent) != itemPtr) {
             break;
         }
         else {
@@ -602,6 +1670,30 @@ int EventScheduler::cancelEventAndWait(RecurringEventHandle *handle)
 int EventScheduler::rescheduleEvent(const Event               *handle,
                                     const bsls::TimeInterval&  newEpochTime)
 {
+    if (d_wheel_p) {
+        if (0 == handle) {
+            return EventQueue::e_INVALID;                             // RETURN
+        }
+
+        EventScheduler_WheelEvent *event =
+                             reinterpret_cast<EventScheduler_WheelEvent *>(
+                                  const_cast<void *>(
+                                      reinterpret_cast<const void *>(handle)));
+
+        bool isNewTop;
+        if (d_wheel_p->reschedule(&isNewTop,
+                                  event,
+                                  newEpochTime.totalMicroseconds())) {
+            return EventQueue::e_NOT_FOUND;                           // RETURN
+        }
+
+        if (isNewTop) {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            d_queueCondition.signal();
+        }
+        return 0;                                                     // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
 
@@ -625,6 +1717,37 @@ int EventScheduler::rescheduleEventAndWait(
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_wheel_p) {
+        if (0 == handle) {
+            return EventQueue::e_INVALID;                             // RETURN
+        }
+
+        EventScheduler_WheelEvent *event =
+                             reinterpret_cast<EventScheduler_WheelEvent *>(
+                                  const_cast<void *>(
+                                      reinterpret_cast<const void *>(handle)));
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        bool isNewTop;
+        if (0 == d_wheel_p->reschedule(&isNewTop,
+                                       event,
+                                       newEpochTime.totalMicroseconds())) {
+            if (isNewTop) {
+                d_queueCondition.signal();
+            }
+            return 0;                                                 // RETURN
+        }
+
+        // Wait until the event is dispatched.
+
+        while (d_currentWheelEvent == event) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return EventQueue::e_NOT_FOUND;                               // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
     int ret;
@@ -664,7 +1787,12 @@ int EventScheduler::rescheduleEventAndWait(
 
 void EventScheduler::cancelAllEvents()
 {
-    d_eventQueue.removeAll();
+    if (d_wheel_p) {
+        d_wheel_p->cancelAll();
+    }
+    else {
+        d_eventQueue.removeAll();
+    }
     d_recurringQueue.removeAll();
 }
 
@@ -673,12 +1801,13 @@ void EventScheduler::cancelAllEventsAndWait()
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    d_eventQueue.removeAll();
-    d_recurringQueue.removeAll();
+    cancelAllEvents();
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (0 == d_currentEvent && 0 == d_currentRecurringEvent) {
+        if (0 == d_currentEvent
+         && 0 == d_currentWheelEvent
+         && 0 == d_currentRecurringEvent) {
             break;
         }
         else {
@@ -688,6 +1817,47 @@ void EventScheduler::cancelAllEventsAndWait()
     }
 }
 
+void EventScheduler::releaseEventRaw(Event *handle)
+{
+    if (d_wheel_p) {
+        EventScheduler_TimingWheel::releaseReference(
+                              reinterpret_cast<EventScheduler_WheelEvent *>(
+                                            reinterpret_cast<void *>(handle)));
+        return;                                                       // RETURN
+    }
+
+    d_eventQueue.releaseReferenceRaw(reinterpret_cast<EventQueue::Pair*>(
+                                             reinterpret_cast<void*>(handle)));
+}
+
+// ACCESSORS
+EventScheduler::Event *EventScheduler::addEventRefRaw(Event *handle) const
+{
+    if (d_wheel_p) {
+        addWheelEventRef(reinterpret_cast<EventScheduler_WheelEvent *>(
+                                            reinterpret_cast<void *>(handle)));
+        return handle;                                                // RETURN
+    }
+
+    EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
+                                              reinterpret_cast<void*>(handle));
+    return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
+}
+
+int EventScheduler::numEvents() const
+{
+    return d_wheel_p ? d_wheel_p->numEvents() : d_eventQueue.length();
+}
+
+bsls::TimeInterval EventScheduler::timingWheelTick() const
+{
+    bsls::TimeInterval tick;
+    if (d_wheel_p) {
+        tick.addMicroseconds(d_wheel_p->tick());
+    }
+    return tick;
+}
+
                     // ----------------------------------
                     // class EventSchedulerTestTimeSource
                     // ----------------------------------
@@ -111,6 +111,83 @@ BSLS_IDENT("$Id: $")
 // dispatcher thread becomes available; once the backlog is worked off, events
 // will be executed at or near their scheduled times.
 //
+///Batch Dispatch
+///--------------
+// Since the dispatcher thread executes the callbacks one at a time, a single
+// slow callback delays every event due after it.  A dispatcher functor (see
+// {The Dispatcher Thread and the Dispatcher Functor}) can transfer each
+// callback to another thread, but is invoked once per event.  Applications
+// keeping large numbers of events may instead construct a scheduler with a
+// *batch* *dispatcher* functor and a maximal batch size.  The dispatcher
+// thread of such a scheduler then only detects the events that are due: it
+// collects their callbacks, in the order in which the events would otherwise
+// be executed, into a vector of at most the maximal batch size, and passes
+// that vector to the batch dispatcher functor when it is full, or when no
+// further event is due.  The batch dispatcher functor is expected to hand the
+// callbacks off quickly to an executor, e.g., a 'bdlmt::FixedThreadPool', or
+// the queues of a 'bdlmt::MultiQueueThreadPool' chosen by an affinity
+// identifier bound into each callback.  It may modify the vector (e.g., swap
+// its contents out), which is cleared on return.  For example:
+//..
+//  void enqueueBatch(bdlmt::FixedThreadPool                *pool,
+//                    bsl::vector<bsl::function<void()> >   *batch)
+//      // Enqueue each of the callbacks of the specified 'batch' as a job of
+//      // the specified 'pool'.
+//  {
+//      for (bsl::size_t i = 0; i < batch->size(); ++i) {
+//          pool->enqueueJob((*batch)[i]);
+//      }
+//  }
+//
+//  bdlmt::FixedThreadPool pool(8, 1 << 20);
+//  pool.start();
+//
+//  bdlmt::EventScheduler scheduler(
+//                       bdlf::BindUtil::bind(&enqueueBatch, &pool, _1),
+//                       256,
+//                       bsls::SystemClockType::e_MONOTONIC,
+//                       bsls::TimeInterval(0, 100000));  // 100us wheel tick
+//  scheduler.start();
+//..
+// As for a dispatcher functor transferring the callbacks to other threads
+// (see the CAVEAT above), the callbacks of a scheduler using a batch
+// dispatcher functor may still be executing, or not yet started, when the
+// "AndWait" methods return, and may execute concurrently with one another.
+// Note that 'stop' passes the callbacks collected in an incomplete batch to
+// the batch dispatcher functor before returning.
+//
+// Whatever the dispatch mode, each scheduler records the *lateness* of the
+// events it dispatches, i.e., the time elapsed between the scheduled time of
+// each event and the time at which the dispatcher thread passed its callback
+// to the dispatcher functor or appended it to a batch, in a
+// 'bdlmt::TimerLatenessStats' object returned by 'latenessStats' (see
+// 'bdlmt_timerlatenessstats').  Note that this does not include the time the
+// callback waits in the executor of a batch dispatcher functor.
+//
+///Timing-Wheel Backend
+///--------------------
+// By default, one-time events are kept in a skip list ordered by their
+// scheduled times, so that scheduling, rescheduling, and cancelling a
+// one-time event takes time logarithmic in the number of pending events.
+// Applications keeping very large numbers of short-lived one-time events
+// (e.g., a timeout per connection, re-armed on each message received) may
+// instead construct a scheduler that keeps its one-time events in a
+// *hierarchical* *hashed* *timing* *wheel* by supplying a *tick* to the
+// constructor.  Scheduling, rescheduling, and cancelling a one-time event then
+// takes constant time, under a lock distinct from that of the dispatcher
+// thread.
+//
+// The timing wheel rounds the scheduled time of each one-time event up to
+// the next multiple of the tick, so that a one-time event is executed no
+// earlier than its scheduled time, but up to one tick (in addition to the
+// usual latency) later.  One-time events due at the same tick are executed in
+// the order of their scheduled times.  Recurring events are kept in a skip
+// list whatever the backend, and the handles, "Raw" API, and test time source
+// described in this documentation behave identically with either backend.
+// Note that the choice of backend is fixed at construction; 'timingWheelTick'
+// returns the tick of the timing wheel, or 0 if one-time events are kept in a
+// skip list.
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -382,11 +459,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlcc_skiplist.h>
 
+#include <bdlmt_timerlatenessstats.h>
+
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
@@ -402,6 +482,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlmt {
@@ -409,6 +490,8 @@ namespace bdlmt {
 class EventSchedulerEventHandle;
 class EventSchedulerRecurringEventHandle;
 class EventSchedulerTestTimeSource_Data;
+class EventScheduler_TimingWheel;
+class EventScheduler_WheelEvent;
 
                             // ====================
                             // class EventScheduler
@@ -453,6 +536,11 @@ class EventScheduler {
                                                Dispatcher;
         // Defines a type alias for the dispatcher functor type.
 
+    typedef bsl::function<void(bsl::vector<bsl::function<void()> > *)>
+                                               BatchDispatcher;
+        // Defines a type alias for the batch dispatcher functor type (see
+        // {Batch Dispatch} in the component documentation).
+
   private:
     // NOT IMPLEMENTED
     EventScheduler(const EventScheduler&);
@@ -469,8 +557,23 @@ class EventScheduler {
 
     RecurringEventQueue   d_recurringQueue;     // recurring events
 
+    EventScheduler_TimingWheel
+                         *d_wheel_p;            // timing wheel holding the
+                                                // one-time events (owned), or
+                                                // 0 if they are held in
+                                                // 'd_eventQueue'
+
     Dispatcher            d_dispatcherFunctor;  // dispatch events
 
+    BatchDispatcher       d_batchDispatcherFunctor;
+                                                // dispatch batches of events,
+                                                // or empty if events are
+                                                // dispatched one at a time
+
+    int                   d_maxBatchSize;       // maximal number of events in
+                                                // a batch, or 0 if events are
+                                                // dispatched one at a time
+
     bslmt::ThreadUtil::Handle
                           d_dispatcherThread;   // dispatcher thread handle
 
@@ -509,15 +612,32 @@ class EventScheduler {
                                                 // scheduled recurring event
                                                 // being executed
 
+    EventScheduler_WheelEvent
+                         *d_currentWheelEvent;  // reference to the one-time
+                                                // event of the timing wheel
+                                                // being executed
+
     unsigned int          d_waitCount;          // count of the number of waits
                                                 // performed in the main
                                                 // dispatch loop, used in
                                                 // 'advanceTime' to determine
                                                 // when to return
 
+    TimerLatenessStats    d_latenessStats;      // lateness of the dispatched
+                                                // events
+
     bsls::SystemClockType::Enum
                           d_clockType;          // clock type used
 
+    // PRIVATE CLASS METHODS
+    static void addWheelEventRef(EventScheduler_WheelEvent *event);
+        // Increment the reference count of the specified one-time 'event' of
+        // a timing wheel.
+
+    static void releaseWheelEventRef(EventScheduler_WheelEvent *event);
+        // Decrement the reference count of the specified one-time 'event' of
+        // a timing wheel, and release the event if no references remain.
+
     // PRIVATE MANIPULATORS
     bsls::Types::Int64 chooseNextEvent(bsls::Types::Int64 *now);
         // Pick either 'd_currentEvent' or 'd_currentRecurringEvent' as the
@@ -535,11 +655,35 @@ class EventScheduler {
         // documentation).  Also note that this method may update the value of
         // 'now' with the current system time if necessary.
 
+    void dispatch(bslmt::LockGuard<bslmt::Mutex>      *lock,
+                  bsl::vector<bsl::function<void()> > *batch,
+                  const bsl::function<void()>&         callback,
+                  bsls::Types::Int64                   time);
+        // Record the lateness of the event having the specified 'callback'
+        // and scheduled (absolute) 'time'.  If this scheduler dispatches
+        // events one at a time, release the specified 'lock' and pass
+        // 'callback' to the dispatcher functor; otherwise, append 'callback'
+        // to the specified 'batch' and, if 'batch' is then full, release
+        // 'lock' and dispatch 'batch'.  Note that 'time' is expressed in
+        // terms of the number of microseconds elapsed since some epoch, which
+        // is determined by the clock indicated at construction (see
+        // {Supported Clock-Types} in the component documentation).
+
+    void dispatchBatch(bsl::vector<bsl::function<void()> > *batch);
+        // If the specified 'batch' is not empty, pass it to the batch
+        // dispatcher functor, then clear it.
+
     void dispatchEvents();
         // While d_running is true, execute events in the event and recurring
         // event queues at their scheduled times.  Note that this method
         // implements the dispatching thread.
 
+    void dispatchWheelEvents();
+        // While d_running is true, execute events in the timing wheel and
+        // recurring event queue at their scheduled times.  Note that this
+        // method implements the dispatching thread of a scheduler keeping its
+        // one-time events in a timing wheel.
+
     void releaseCurrentEvents();
         // Release 'd_currentRecurringEvent' and 'd_currentEvent', if they
         // refer to valid events.
@@ -589,6 +733,62 @@ class EventScheduler {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timingWheelTick,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the default dispatcher functor
+        // and the specified 'clockType', keeping one-time events in a timing
+        // wheel whose tick is the specified 'timingWheelTick' (see
+        // {Timing-Wheel Backend} in the component documentation).  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'timingWheelTick' is at
+        // least one microsecond.
+
+    EventScheduler(const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timingWheelTick,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the specified 'dispatcherFunctor'
+        // and 'clockType', keeping one-time events in a timing wheel whose
+        // tick is the specified 'timingWheelTick' (see {Timing-Wheel Backend}
+        // in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'timingWheelTick' is at least one microsecond.
+
+    EventScheduler(const BatchDispatcher&       batchDispatcherFunctor,
+                   int                          maxBatchSize,
+                   bsls::SystemClockType::Enum  clockType,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler passing the callbacks of the events
+        // due, in batches of at most the specified 'maxBatchSize' callbacks,
+        // to the specified 'batchDispatcherFunctor' (see {Batch Dispatch} in
+        // the component documentation), and using the specified 'clockType'
+        // to indicate the epoch used for all time intervals (see {Supported
+        // Clock-Types} in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'batchDispatcherFunctor' is not empty and
+        // '1 <= maxBatchSize'.
+
+    EventScheduler(const BatchDispatcher&       batchDispatcherFunctor,
+                   int                          maxBatchSize,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timingWheelTick,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler passing the callbacks of the events
+        // due, in batches of at most the specified 'maxBatchSize' callbacks,
+        // to the specified 'batchDispatcherFunctor' (see {Batch Dispatch} in
+        // the component documentation), using the specified 'clockType', and
+        // keeping one-time events in a timing wheel whose tick is the
+        // specified 'timingWheelTick' (see {Timing-Wheel Backend} in the
+        // component documentation).  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'batchDispatcherFunctor' is not empty, '1 <= maxBatchSize',
+        // and 'timingWheelTick' is at least one microsecond.
+
     ~EventScheduler();
         // Discard all unprocessed events and destroy this object.  The
         // behavior is undefined unless the scheduler is stopped.
@@ -686,6 +886,10 @@ class EventScheduler {
         // behavior is undefined if this method is invoked from the dispatcher
         // thread.
 
+    void resetLatenessStats();
+        // Discard the lateness statistics of the events dispatched by this
+        // scheduler (see {Batch Dispatch} in the component documentation).
+
     void scheduleEvent(const bsls::TimeInterval&     epochTime,
                        const bsl::function<void()>&  callback);
     void scheduleEvent(EventHandle                  *event,
@@ -809,6 +1013,18 @@ class EventScheduler {
         // Return the value of the clock type that this object was created
         // with.
 
+    const TimerLatenessStats& latenessStats() const;
+        // Return a reference providing non-modifiable access to the lateness
+        // statistics of the events dispatched by this scheduler since its
+        // construction, or since the last call to 'resetLatenessStats' (see
+        // {Batch Dispatch} in the component documentation).
+
+    int maxBatchSize() const;
+        // Return the maximal number of callbacks passed at once to the batch
+        // dispatcher functor of this scheduler, or 0 if this scheduler
+        // dispatches events one at a time (see {Batch Dispatch} in the
+        // component documentation).
+
     bsls::TimeInterval now() const;
         // Return the current epoch time, an absolute time represented as an
         // interval from some epoch, which is determined by the clock indicated
@@ -822,6 +1038,12 @@ class EventScheduler {
         // Return the number of recurring events registered with this
         // scheduler.
 
+    bsls::TimeInterval timingWheelTick() const;
+        // Return the tick of the timing wheel in which this scheduler keeps
+        // its one-time events, or 0 if this scheduler keeps its one-time
+        // events in a skip list (see {Timing-Wheel Backend} in the component
+        // documentation).
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -843,7 +1065,10 @@ class EventSchedulerEventHandle
                             bsl::function<void()> > EventQueue;
 
     // DATA
-    EventQueue::PairHandle  d_handle;
+    EventQueue::PairHandle     d_handle;        // event of a skip list
+
+    EventScheduler_WheelEvent *d_wheelEvent_p;  // event of a timing wheel,
+                                                // or 0
 
     // FRIENDS
     friend class EventScheduler;
@@ -995,6 +1220,7 @@ class EventSchedulerTestTimeSource {
 // CREATORS
 inline
 EventSchedulerEventHandle::EventSchedulerEventHandle()
+: d_wheelEvent_p(0)
 {
 }
 
@@ -1002,12 +1228,19 @@ inline
 EventSchedulerEventHandle::EventSchedulerEventHandle(
                                      const EventSchedulerEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelEvent_p(original.d_wheelEvent_p)
 {
+    if (d_wheelEvent_p) {
+        EventScheduler::addWheelEventRef(d_wheelEvent_p);
+    }
 }
 
 inline
 EventSchedulerEventHandle::~EventSchedulerEventHandle()
 {
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventRef(d_wheelEvent_p);
+    }
 }
 
 // MANIPULATORS
@@ -1015,7 +1248,14 @@ inline
 EventSchedulerEventHandle&
 EventSchedulerEventHandle::operator=(const EventSchedulerEventHandle& rhs)
 {
-    d_handle = rhs.d_handle;
+    if (rhs.d_wheelEvent_p) {
+        EventScheduler::addWheelEventRef(rhs.d_wheelEvent_p);
+    }
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventRef(d_wheelEvent_p);
+    }
+    d_wheelEvent_p = rhs.d_wheelEvent_p;
+    d_handle       = rhs.d_handle;
     return *this;
 }
 
@@ -1023,6 +1263,10 @@ inline
 void EventSchedulerEventHandle::release()
 {
     d_handle.release();
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventRef(d_wheelEvent_p);
+        d_wheelEvent_p = 0;
+    }
 }
 }  // close package namespace
 
@@ -1034,6 +1278,11 @@ inline
 bdlmt::EventSchedulerEventHandle::
 operator const bdlmt::EventSchedulerEventHandle::Event*() const
 {
+    if (d_wheelEvent_p) {
+        return reinterpret_cast<const Event*>(
+                               reinterpret_cast<const void*>(d_wheelEvent_p));
+                                                                      // RETURN
+    }
     return (const Event*)((const EventQueue::Pair*)d_handle);
 }
 
@@ -1096,16 +1345,6 @@ namespace bdlmt {
                             // --------------------
 
 // MANIPULATORS
-inline
-int EventScheduler::cancelEvent(const Event *handle)
-{
-    const EventQueue::Pair *itemPtr =
-                        reinterpret_cast<const EventQueue::Pair*>(
-                                        reinterpret_cast<const void*>(handle));
-
-    return d_eventQueue.remove(itemPtr);
-}
-
 inline
 int EventScheduler::cancelEvent(const RecurringEvent *handle)
 {
@@ -1117,17 +1356,16 @@ int EventScheduler::cancelEvent(const RecurringEvent *handle)
 }
 
 inline
-void EventScheduler::scheduleEvent(const bsls::TimeInterval&    epochTime,
-                                   const bsl::function<void()>& callback)
+void EventScheduler::resetLatenessStats()
 {
-    scheduleEventRaw(0, epochTime, callback);
+    d_latenessStats.reset();
 }
 
 inline
-void EventScheduler::releaseEventRaw(Event *handle)
+void EventScheduler::scheduleEvent(const bsls::TimeInterval&    epochTime,
+                                   const bsl::function<void()>& callback)
 {
-    d_eventQueue.releaseReferenceRaw(reinterpret_cast<EventQueue::Pair*>(
-                                             reinterpret_cast<void*>(handle)));
+    scheduleEventRaw(0, epochTime, callback);
 }
 
 inline
@@ -1148,15 +1386,6 @@ void EventScheduler::scheduleRecurringEvent(
 }
 
 // ACCESSORS
-inline
-EventScheduler::Event*
-EventScheduler::addEventRefRaw(Event *handle) const
-{
-    EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
-                                              reinterpret_cast<void*>(handle));
-    return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
-}
-
 inline
 EventScheduler::RecurringEvent*
 EventScheduler::addRecurringEventRefRaw(RecurringEvent *handle) const
@@ -1175,15 +1404,21 @@ bsls::SystemClockType::Enum EventScheduler::clockType() const
 }
 
 inline
-bsls::TimeInterval EventScheduler::now() const
+const TimerLatenessStats& EventScheduler::latenessStats() const
 {
-    return d_currentTimeFunctor();
+    return d_latenessStats;
 }
 
 inline
-int EventScheduler::numEvents() const
+int EventScheduler::maxBatchSize() const
 {
-    return d_eventQueue.length();
+    return d_maxBatchSize;
+}
+
+inline
+bsls::TimeInterval EventScheduler::now() const
+{
+    return d_currentTimeFunctor();
 }
 
 inline
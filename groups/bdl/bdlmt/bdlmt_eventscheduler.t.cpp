@@ -24,6 +24,8 @@
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_timedsemaphore.h>
@@ -52,6 +54,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -97,6 +100,12 @@ using namespace bsl;  // automatically added by script
 // [08] bdlmt::EventScheduler(dispatcher, allocator = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
 //
+// [27] bdlmt::EventScheduler(clockType, timingWheelTick, alloc = 0);
+// [27] bdlmt::EventScheduler(disp, clockType, timingWheelTick, alloc = 0);
+//
+// [28] bdlmt::EventScheduler(batchDisp, maxBatchSize, clockType, alloc = 0);
+// [28] bdlmt::EventScheduler(batchDisp, maxBS, clockType, tick, alloc = 0);
+//
 // [01] ~bdlmt::EventScheduler();
 //
 // MANIPULATORS
@@ -114,10 +123,15 @@ using namespace bsl;  // automatically added by script
 //
 // [09] void stop();
 //
+// [28] void resetLatenessStats();
+//
 // ACCESSORS
 // [21] bsls::SystemClockType::Enum clockType() const;
 // [23] bsls::TimeInterval now() const;
 // [24] bslma::Allocator *allocator() const;
+// [27] bsls::TimeInterval timingWheelTick() const;
+// [28] const TimerLatenessStats& latenessStats() const;
+// [28] int maxBatchSize() const;
 //-----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [25] DRQS 150355963: 'advanceTime' WITH UNDER A MICROSECOND
@@ -126,7 +140,8 @@ using namespace bsl;  // automatically added by script
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [22] CLOCK REPLACEMENT BREATHING TEST
-// [27] USAGE EXAMPLE
+// [27] TIMING-WHEEL BACKEND
+// [29] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -942,6 +957,255 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 27 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_27 {
+
+class Recorder {
+    // This class records the identifiers of the events executed by a
+    // scheduler, and the times at which they are executed.
+
+    // DATA
+    bslmt::Mutex                    d_mutex;        // protects the following
+    bsl::vector<int>                d_ids;          // executed events
+    bsl::vector<bsls::TimeInterval> d_times;        // times of execution
+    Obj                            *d_scheduler_p;  // scheduler (held)
+
+  public:
+    // CREATORS
+    explicit Recorder(Obj *scheduler)
+    : d_scheduler_p(scheduler)
+        // Create a recorder of the events executed by the specified
+        // 'scheduler'.
+    {
+    }
+
+    // MANIPULATORS
+    void record(int id)
+        // Record the execution, at the current time of the scheduler, of the
+        // event having the specified 'id'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_ids.push_back(id);
+        d_times.push_back(d_scheduler_p->now());
+    }
+
+    // ACCESSORS
+    int id(int index)
+        // Return the identifier of the event executed at the specified
+        // 'index' in the order of execution.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_ids[index];
+    }
+
+    int numRecorded()
+        // Return the number of events executed.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return static_cast<int>(d_ids.size());
+    }
+
+    bsls::TimeInterval time(int index)
+        // Return the time of execution of the event executed at the specified
+        // 'index' in the order of execution.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_times[index];
+    }
+};
+
+bsls::TimeInterval alignOnTick(
+                              bdlmt::EventSchedulerTestTimeSource *timeSource,
+                              bsls::Types::Int64                   tick)
+    // Advance the time of the specified 'timeSource' to the next multiple of
+    // the specified 'tick' (in microseconds), and return that time.
+{
+    const bsls::TimeInterval now = timeSource->now();
+
+    bsls::TimeInterval aligned;
+    aligned.addMicroseconds((now.totalMicroseconds() / tick + 1) * tick);
+
+    timeSource->advanceTime(aligned - now);
+    return aligned;
+}
+
+struct RearmArgs {
+    // This 'struct' provides the arguments of 'rearmThread'.
+
+    Obj             *d_scheduler_p;      // scheduler
+    bslmt::Barrier  *d_barrier_p;        // starts the threads together
+    bsls::AtomicInt  d_numExecuted;      // events executed
+    int              d_numMissed;        // events dispatched before they
+                                         // could be cancelled
+};
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void *rearmThread(void *arg)
+    // Repeatedly cancel and re-schedule, 2 milliseconds in the future, an
+    // event counting its executions in the 'RearmArgs' at the specified
+    // 'arg', as a server re-arms the timeout of a connection on each message
+    // received at irregular intervals, counting the events that could not be
+    // cancelled.
+{
+    RearmArgs& args = *static_cast<RearmArgs *>(arg);
+
+    EventHandle handle;
+
+    args.d_barrier_p->wait();
+
+    for (int i = 0; i < 200; ++i) {
+        if (i && 0 != args.d_scheduler_p->cancelEvent(&handle)) {
+            ++args.d_numMissed;
+        }
+        args.d_scheduler_p->scheduleEvent(
+                      &handle,
+                      args.d_scheduler_p->now() + bsls::TimeInterval(0.002),
+                      bdlf::BindUtil::bind(&increment, &args.d_numExecuted));
+
+        bslmt::ThreadUtil::microSleep(i % 4 * 1000);
+    }
+    return 0;
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_27
+
+// ============================================================================
+//                         CASE 28 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_28 {
+
+using EVENTSCHEDULER_TEST_CASE_27::Recorder;
+
+enum {
+    k_NUM_EVENTS     = 10,  // number of events in 'testDueEvents'
+    k_MAX_BATCH_SIZE = 4    // maximal batch size in 'testDueEvents'
+};
+
+class BatchRecorder {
+    // This class provides a batch dispatcher functor that records the sizes
+    // of the batches it is passed, then executes their callbacks.
+
+    // DATA
+    bslmt::Mutex     d_mutex;       // protects 'd_sizes'
+    bsl::vector<int> d_sizes;       // sizes of the batches dispatched
+
+  public:
+    // MANIPULATORS
+    void dispatch(bsl::vector<bsl::function<void()> > *batch)
+        // Record the size of the specified 'batch', and execute its
+        // callbacks in order.
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_sizes.push_back(static_cast<int>(batch->size()));
+        }
+        for (bsl::size_t i = 0; i < batch->size(); ++i) {
+            (*batch)[i]();
+        }
+    }
+
+    // ACCESSORS
+    int numBatches()
+        // Return the number of batches dispatched.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return static_cast<int>(d_sizes.size());
+    }
+
+    int size(int index)
+        // Return the size of the batch dispatched at the specified 'index' in
+        // the order of dispatch.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_sizes[index];
+    }
+};
+
+void testDueEvents(Obj *scheduler, BatchRecorder *batchRecorder)
+    // Schedule on the specified 'scheduler', using the specified
+    // 'batchRecorder' as batch dispatcher with a maximal batch size of
+    // 'k_MAX_BATCH_SIZE', 'k_NUM_EVENTS' events becoming due at once, and
+    // verify the batches in which they are dispatched, the order in which they
+    // are executed, and the lateness statistics of 'scheduler'.
+{
+    ASSERT(k_MAX_BATCH_SIZE == scheduler->maxBatchSize());
+
+    bdlmt::EventSchedulerTestTimeSource timeSource(scheduler);
+
+    const bsls::TimeInterval T0 = timeSource.now();
+
+    Recorder recorder(scheduler);
+
+    // Schedule in reverse order, so that the order of execution is not that
+    // of scheduling.
+
+    for (int i = k_NUM_EVENTS - 1; 0 <= i; --i) {
+        bsls::TimeInterval time(T0);
+        time.addMicroseconds(1000 * i + 1);
+
+        scheduler->scheduleEvent(time,
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      i));
+    }
+
+    scheduler->start();
+    timeSource.advanceTime(bsls::TimeInterval(1));
+    scheduler->stop();
+
+    ASSERTV(recorder.numRecorded(), k_NUM_EVENTS == recorder.numRecorded());
+    for (int i = 0; i < recorder.numRecorded(); ++i) {
+        ASSERTV(i, recorder.id(i), i == recorder.id(i));
+    }
+
+    // All the events are due at once: all the batches are full, but the
+    // last.
+
+    const int NUM_BATCHES = batchRecorder->numBatches();
+    ASSERTV(NUM_BATCHES,
+            (k_NUM_EVENTS + k_MAX_BATCH_SIZE - 1) / k_MAX_BATCH_SIZE ==
+                                                                  NUM_BATCHES);
+
+    int total = 0;
+    for (int i = 0; i < NUM_BATCHES; ++i) {
+        const int SIZE = batchRecorder->size(i);
+        ASSERTV(i, SIZE, 0 < SIZE);
+        ASSERTV(i, SIZE, SIZE <= k_MAX_BATCH_SIZE);
+        total += SIZE;
+    }
+    ASSERTV(total, k_NUM_EVENTS == total);
+
+    const bdlmt::TimerLatenessStats& STATS = scheduler->latenessStats();
+
+    ASSERTV(STATS.numRecorded(), k_NUM_EVENTS == STATS.numRecorded());
+    ASSERTV(STATS.maxLateness(),
+            bsls::TimeInterval(0.99) < STATS.maxLateness());
+    ASSERTV(STATS.maxLateness(),
+            STATS.maxLateness() <= bsls::TimeInterval(1));
+
+    scheduler->resetLatenessStats();
+    ASSERT(0                    == STATS.numRecorded());
+    ASSERT(bsls::TimeInterval() == STATS.maxLateness());
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_28
+
 // ============================================================================
 //                         CASE 25 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2366,6 +2630,593 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 27: {
+        // --------------------------------------------------------------------
+        // TESTING TIMING-WHEEL BACKEND
+        //
+        // Concerns:
+        //: 1 A scheduler constructed with a timing wheel tick reports it,
+        //:   and other schedulers report a tick of 0.
+        //:
+        //: 2 One-time events are executed no earlier than their scheduled
+        //:   times, and no later than the tick following them, whether they
+        //:   are scheduled within the first level of the wheel, in higher
+        //:   levels, or beyond the range of the wheel.
+        //:
+        //: 3 One-time events due at the same tick are executed in the order
+        //:   of their scheduled times.
+        //:
+        //: 4 'cancelEvent', 'rescheduleEvent', and 'cancelAllEvents' behave
+        //:   as for the skip-list backend, and 'numEvents' reflects them.
+        //:
+        //: 5 Event handles and the "Raw" API manage the references to
+        //:   one-time events, and no memory is leaked.
+        //:
+        //: 6 One-time and recurring events are executed together.
+        //:
+        //: 7 Events concurrently cancelled and re-scheduled from several
+        //:   threads are executed exactly once unless cancelled.
+        //
+        // Plan:
+        //: 1 Construct schedulers with and without a timing wheel, and verify
+        //:   'timingWheelTick'.  (C-1)
+        //:
+        //: 2 Using a test time source aligned on the tick, schedule events
+        //:   at offsets crossing each level of the wheel, and advance the
+        //:   time to just before, then to the tick following, each offset,
+        //:   verifying the events executed and their times.  (C-2)
+        //:
+        //: 3 Schedule events due at the same tick in an order other than
+        //:   that of their times, and verify the order of execution.  (C-3)
+        //:
+        //: 4 Cancel, reschedule, and cancel all events before and after
+        //:   their execution, and verify the values returned, the events
+        //:   executed, and 'numEvents'.  (C-4)
+        //:
+        //: 5 Copy, assign, and release handles, add and release references
+        //:   using the "Raw" API, and verify that the test allocator has no
+        //:   memory in use after the scheduler is destroyed.  (C-5)
+        //:
+        //: 6 Schedule a recurring event and a one-time event, and verify
+        //:   the executions as time advances.  (C-6)
+        //:
+        //: 7 In several threads, repeatedly cancel and re-schedule an event
+        //:   per thread using the system clock, and verify that each thread
+        //:   observes exactly one execution more than the number of events
+        //:   it could not cancel.  (C-7)
+        //
+        // Testing:
+        //   EventScheduler(clockType, timingWheelTick, alloc = 0);
+        //   EventScheduler(disp, clockType, timingWheelTick, alloc = 0);
+        //   bsls::TimeInterval timingWheelTick() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TIMING-WHEEL BACKEND" << endl
+                          << "============================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_27;
+
+        typedef bsls::Types::Int64 Int64;
+
+        const bsls::TimeInterval TICK(0, 1000000);  // 1ms
+        const Int64              T = TICK.totalMicroseconds();
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'timingWheelTick'." << endl;
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+            ASSERT(TICK == mX.timingWheelTick());
+            ASSERT(0    == mX.numEvents());
+
+            Obj mY(&EVENTSCHEDULER_TEST_CASE_20::dispatcherFunction,
+                   bsls::SystemClockType::e_REALTIME,
+                   bsls::TimeInterval(2),
+                   &ta);
+            ASSERT(bsls::TimeInterval(2) == mY.timingWheelTick());
+
+            Obj mZ(&ta);
+            ASSERT(bsls::TimeInterval() == mZ.timingWheelTick());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting execution times." << endl;
+        {
+            static const Int64 DATA[] = {
+                // offsets (in microseconds) of the events, crossing the
+                // levels of the wheel (of 256 slots each) and its range
+
+                1,
+                2 * T,
+                2 * T + 500,
+                255 * T,
+                256 * T,
+                256 * T + 1,
+                65535 * T - 1,
+                65536 * T,
+                70000 * T + 123,
+                16777216 * T,
+                16777216 * T + 65536 * T + 3,
+                4294967296LL * T,
+                4294967296LL * T + 7,
+                5000000000LL * T
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            const Int64 T0 = alignOnTick(&timeSource, T).totalMicroseconds();
+            ASSERTV(T0, 0 == T0 % T);
+
+            Recorder recorder(&mX);
+
+            bsl::vector<EventHandle> handles(NUM_DATA);
+
+            // Schedule in reverse order, so that the order of execution is not
+            // that of scheduling.
+
+            for (int i = NUM_DATA - 1; 0 <= i; --i) {
+                bsls::TimeInterval time;
+                time.addMicroseconds(T0 + DATA[i]);
+                mX.scheduleEvent(&handles[i],
+                                 time,
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      i));
+            }
+            ASSERT(NUM_DATA == mX.numEvents());
+
+            mX.start();
+
+            Int64 now = T0;
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const Int64 OFFSET = DATA[i];
+                const Int64 DUE    = (OFFSET + T - 1) / T * T;
+
+                if (veryVerbose) { T_ P_(i) P(OFFSET) }
+
+                if (T0 + OFFSET - 1 > now) {
+                    bsls::TimeInterval amount;
+                    amount.addMicroseconds(T0 + OFFSET - 1 - now);
+                    timeSource.advanceTime(amount);
+                    now = T0 + OFFSET - 1;
+                }
+                ASSERTV(i,
+                        recorder.numRecorded(),
+                        i == recorder.numRecorded());
+
+                if (T0 + DUE > now) {
+                    bsls::TimeInterval amount;
+                    amount.addMicroseconds(T0 + DUE - now);
+                    timeSource.advanceTime(amount);
+                    now = T0 + DUE;
+                }
+                ASSERTV(i, recorder.numRecorded(),
+                        i + 1 == recorder.numRecorded());
+
+                if (i < recorder.numRecorded()) {
+                    ASSERTV(i, recorder.id(i), i == recorder.id(i));
+                    ASSERTV(i, T0 + OFFSET <=
+                                       recorder.time(i).totalMicroseconds());
+                }
+                ASSERTV(i, mX.numEvents(), NUM_DATA - i - 1 == mX.numEvents());
+            }
+
+            mX.stop();
+
+            // The events have been executed: they can no longer be cancelled
+            // or rescheduled.
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                ASSERTV(i, 0 != mX.rescheduleEvent(handles[i],
+                                                   timeSource.now()));
+                ASSERTV(i, 0 != mX.cancelEvent(&handles[i]));
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting order within a tick." << endl;
+        {
+            static const int DATA[] = { 500, 100, 900, 100, 300 };
+                // offsets (in microseconds) from the start of a tick
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            const Int64 T0 = alignOnTick(&timeSource, T).totalMicroseconds()
+                           + 10 * T;
+
+            Recorder recorder(&mX);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                bsls::TimeInterval time;
+                time.addMicroseconds(T0 + DATA[i]);
+                mX.scheduleEvent(time,
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      i));
+            }
+
+            mX.start();
+            timeSource.advanceTime(bsls::TimeInterval(1));
+            mX.stop();
+
+            static const int EXP[] = { 1, 3, 4, 0, 2 };
+
+            ASSERTV(recorder.numRecorded(),
+                    NUM_DATA == recorder.numRecorded());
+            for (int i = 0; i < NUM_DATA && i < recorder.numRecorded(); ++i) {
+                ASSERTV(i, recorder.id(i), EXP[i] == recorder.id(i));
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting cancellation and handles." << endl;
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T0 = alignOnTick(&timeSource, T);
+
+            Recorder recorder(&mX);
+
+            mX.start();
+
+            // Cancel through a handle, and through copies of a handle.
+
+            EventHandle h1;
+            ASSERT(0 == (const Event *)h1);
+            ASSERT(0 != mX.cancelEvent(&h1));
+
+            mX.scheduleEvent(&h1,
+                             T0 + bsls::TimeInterval(0.010),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  1));
+            ASSERT(0 != (const Event *)h1);
+            ASSERT(1 == mX.numEvents());
+
+            EventHandle h2(h1);
+            EventHandle h3;
+            h3 = h2;
+            ASSERT((const Event *)h1 == (const Event *)h2);
+            ASSERT((const Event *)h1 == (const Event *)h3);
+
+            ASSERT(0 == mX.cancelEvent(&h2));
+            ASSERT(0 == (const Event *)h2);
+            ASSERT(0 == mX.numEvents());
+            ASSERT(0 != mX.cancelEvent(h1));
+            ASSERT(0 != mX.cancelEventAndWait(&h3));
+            h1.release();
+            ASSERT(0 == (const Event *)h1);
+
+            // Reschedule later, then earlier.
+
+            EventHandle h4;
+            mX.scheduleEvent(&h4,
+                             T0 + bsls::TimeInterval(0.010),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  4));
+            ASSERT(0 == mX.rescheduleEvent(h4,
+                                           T0 + bsls::TimeInterval(0.030)));
+            timeSource.advanceTime(bsls::TimeInterval(0.020));
+            ASSERT(0 == recorder.numRecorded());
+            ASSERT(0 == mX.rescheduleEventAndWait(
+                                              h4,
+                                              T0 + bsls::TimeInterval(0.025)));
+            timeSource.advanceTime(bsls::TimeInterval(0.005));
+            ASSERT(1 == recorder.numRecorded());
+            ASSERT(0 != mX.cancelEvent(h4));
+
+            // Use the "Raw" API.
+
+            Event *raw;
+            mX.scheduleEventRaw(&raw,
+                                T0 + bsls::TimeInterval(0.040),
+                                bdlf::BindUtil::bind(&Recorder::record,
+                                                     &recorder,
+                                                     5));
+            ASSERT(raw == mX.addEventRefRaw(raw));
+            mX.releaseEventRaw(raw);
+            ASSERT(1 == mX.numEvents());
+            timeSource.advanceTime(bsls::TimeInterval(0.015));
+            ASSERT(2 == recorder.numRecorded());
+            ASSERT(0 != mX.cancelEvent(raw));
+            mX.releaseEventRaw(raw);
+
+            // Cancel all events.
+
+            for (int i = 0; i < 100; ++i) {
+                mX.scheduleEvent(T0 + bsls::TimeInterval(0.050 + 0.001 * i),
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      6));
+            }
+            ASSERT(100 == mX.numEvents());
+            mX.cancelAllEvents();
+            ASSERT(0 == mX.numEvents());
+            timeSource.advanceTime(bsls::TimeInterval(1));
+            ASSERT(2 == recorder.numRecorded());
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting with recurring events." << endl;
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T0 = alignOnTick(&timeSource, T);
+
+            Recorder recorder(&mX);
+
+            mX.scheduleRecurringEvent(bsls::TimeInterval(0.010),
+                                      bdlf::BindUtil::bind(&Recorder::record,
+                                                           &recorder,
+                                                           1));
+            mX.scheduleEvent(T0 + bsls::TimeInterval(0.025),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  2));
+
+            mX.start();
+
+            static const int EXP[] = { 1, 1, 2, 1, 1 };
+            const int        NUM_EXP = static_cast<int>(sizeof EXP
+                                                        / sizeof *EXP);
+
+            for (int i = 0; i < 4; ++i) {
+                timeSource.advanceTime(bsls::TimeInterval(0.010));
+            }
+
+            mX.stop();
+
+            ASSERTV(recorder.numRecorded(),
+                    NUM_EXP == recorder.numRecorded());
+            for (int i = 0; i < NUM_EXP && i < recorder.numRecorded(); ++i) {
+                ASSERTV(i, recorder.id(i), EXP[i] == recorder.id(i));
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting concurrent re-arming." << endl;
+        {
+            enum { k_NUM_THREADS = 4 };
+
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, TICK, &ta);
+
+            mX.start();
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            RearmArgs                 args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_scheduler_p = &mX;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_numMissed   = 0;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      rearmThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            // Wait for the last events to be executed.
+
+            bsls::Stopwatch stopwatch;
+            stopwatch.start(true);
+            while (0 < mX.numEvents() && stopwatch.elapsedTime() < 10) {
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+            mX.stop();
+
+            ASSERTV(mX.numEvents(), 0 == mX.numEvents());
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                if (veryVerbose) {
+                    T_ P_(i) P_(args[i].d_numExecuted) P(args[i].d_numMissed)
+                }
+                ASSERTV(i, args[i].d_numExecuted, args[i].d_numMissed,
+                        args[i].d_numMissed + 1 == args[i].d_numExecuted);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH DISPATCH
+        //
+        // Concerns:
+        //: 1 A scheduler constructed with a batch dispatcher reports its
+        //:   maximal batch size, and other schedulers report 0.
+        //:
+        //: 2 The callbacks of the events due at the same time are passed to
+        //:   the batch dispatcher in the order of their scheduled times, in
+        //:   batches of at most the maximal batch size, with both the
+        //:   skip-list and the timing-wheel backends.
+        //:
+        //: 3 Recurring events are dispatched in batches.
+        //:
+        //: 4 The lateness of every dispatched event is recorded, in batch
+        //:   mode or not, and 'resetLatenessStats' discards it.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Construct schedulers with and without a batch dispatcher, and
+        //:   verify 'maxBatchSize' and 'latenessStats'.  (C-1)
+        //:
+        //: 2 Using a test time source, schedule more events than the maximal
+        //:   batch size, in an order other than that of their times, then
+        //:   advance the time past all of them, and verify the sizes of the
+        //:   batches, the order of execution, and the lateness statistics.
+        //:   Repeat with a timing wheel.  (C-2, 4)
+        //:
+        //: 3 Schedule a recurring event, advance the time over several of
+        //:   its periods, and verify the executions.  (C-3)
+        //:
+        //: 4 Dispatch events using a scheduler without batch dispatcher,
+        //:   verify the lateness statistics, reset them, and verify them
+        //:   again.  (C-4)
+        //:
+        //: 5 Verify that the test allocator has no memory in use after each
+        //:   scheduler is destroyed.  (C-5)
+        //
+        // Testing:
+        //   EventScheduler(batchDisp, maxBatchSize, clockType, alloc = 0);
+        //   EventScheduler(batchDisp, maxBS, clockType, tick, alloc = 0);
+        //   void resetLatenessStats();
+        //   const TimerLatenessStats& latenessStats() const;
+        //   int maxBatchSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH DISPATCH" << endl
+                          << "======================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_28;
+        using EVENTSCHEDULER_TEST_CASE_27::Recorder;
+
+        const bsls::TimeInterval TICK(0, 1000000);  // 1ms
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'maxBatchSize'." << endl;
+        {
+            BatchRecorder batchRecorder;
+
+            Obj mX(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                          &batchRecorder),
+                   4,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+            ASSERT(4                    == mX.maxBatchSize());
+            ASSERT(bsls::TimeInterval() == mX.timingWheelTick());
+            ASSERT(0                    == mX.latenessStats().numRecorded());
+
+            Obj mY(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                          &batchRecorder),
+                   1,
+                   bsls::SystemClockType::e_REALTIME,
+                   TICK,
+                   &ta);
+            ASSERT(1    == mY.maxBatchSize());
+            ASSERT(TICK == mY.timingWheelTick());
+
+            Obj mZ(&ta);
+            ASSERT(0 == mZ.maxBatchSize());
+            ASSERT(0 == mZ.latenessStats().numRecorded());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting batches of due events." << endl;
+        for (int useWheel = 0; useWheel < 2; ++useWheel) {
+            if (veryVerbose) { T_ P(useWheel) }
+
+            BatchRecorder batchRecorder;
+
+            if (useWheel) {
+                Obj mX(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                              &batchRecorder),
+                       k_MAX_BATCH_SIZE,
+                       bsls::SystemClockType::e_MONOTONIC,
+                       TICK,
+                       &ta);
+
+                testDueEvents(&mX, &batchRecorder);
+            }
+            else {
+                Obj mX(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                              &batchRecorder),
+                       k_MAX_BATCH_SIZE,
+                       bsls::SystemClockType::e_MONOTONIC,
+                       &ta);
+
+                testDueEvents(&mX, &batchRecorder);
+            }
+            ASSERTV(useWheel, 0 == ta.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tTesting with recurring events." << endl;
+        {
+            BatchRecorder batchRecorder;
+
+            Obj mX(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                          &batchRecorder),
+                   2,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            Recorder recorder(&mX);
+
+            mX.scheduleRecurringEvent(bsls::TimeInterval(0.010),
+                                      bdlf::BindUtil::bind(&Recorder::record,
+                                                           &recorder,
+                                                           1));
+            mX.start();
+
+            for (int i = 0; i < 4; ++i) {
+                timeSource.advanceTime(bsls::TimeInterval(0.010));
+            }
+
+            mX.stop();
+
+            ASSERTV(recorder.numRecorded(), 4 == recorder.numRecorded());
+            ASSERTV(batchRecorder.numBatches(),
+                    4 == batchRecorder.numBatches());
+            ASSERTV(mX.latenessStats().numRecorded(),
+                    4 == mX.latenessStats().numRecorded());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting lateness without batches." << endl;
+        {
+            Obj mX(&ta);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            Recorder recorder(&mX);
+
+            for (int i = 0; i < 3; ++i) {
+                mX.scheduleEvent(T0 + bsls::TimeInterval(0, 1000000 * (i + 1)),
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      i));
+            }
+
+            mX.start();
+            timeSource.advanceTime(bsls::TimeInterval(0.010));
+            mX.stop();
+
+            const bdlmt::TimerLatenessStats& STATS = mX.latenessStats();
+
+            ASSERTV(recorder.numRecorded(), 3 == recorder.numRecorded());
+            ASSERTV(STATS.numRecorded(), 3 == STATS.numRecorded());
+            ASSERTV(STATS.maxLateness(),
+                    bsls::TimeInterval(0, 9000000) == STATS.maxLateness());
+            ASSERTV(STATS.meanLateness(),
+                    bsls::TimeInterval(0, 8000000) == STATS.meanLateness());
+
+            mX.resetLatenessStats();
+            ASSERT(0                    == STATS.numRecorded());
+            ASSERT(bsls::TimeInterval() == STATS.meanLateness());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 29: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLES:
         //
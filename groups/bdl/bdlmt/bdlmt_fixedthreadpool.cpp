@@ -14,7 +14,7 @@ BSLS_IDENT_RCSID(bdlmt_fixedthreadpool_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
 
-#include <bdlf_memfn.h>
+#include <bdlf_bind.h>
 #include <bdlt_currenttime.h>
 
 #include <bsls_assert.h>
@@ -135,8 +135,16 @@ void FixedThreadPool::interruptWorkerThreads()
     }
 }
 
-void FixedThreadPool::workerThread()
+void FixedThreadPool::workerThread(int index)
 {
+    // 'd_threadStartFunctor' is not modified while the thread is started
+    // ('d_metaMutex' is locked), and 'start' waits for each started thread to
+    // be ready at the gate before returning.
+
+    if (d_threadStartFunctor) {
+        d_threadStartFunctor(index);
+    }
+
     int gateCount = d_gateCount;
 
     while (1) {
@@ -173,7 +181,7 @@ void FixedThreadPool::workerThread()
     }
 }
 
-int FixedThreadPool::startNewThread()
+int FixedThreadPool::startNewThread(int index)
 {
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Block all asynchronous signals.
@@ -182,8 +190,10 @@ int FixedThreadPool::startNewThread()
     pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
 #endif
 
-    bsl::function<void()> workerThreadFunc =
-                  bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
+    bsl::function<void()> workerThreadFunc = bdlf::BindUtil::bind(
+                                                &FixedThreadPool::workerThread,
+                                                this,
+                                                index);
 
     int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
 
@@ -210,6 +220,7 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_threadStartFunctor(bsl::allocator_arg_t(), basicAllocator)
 {
     BSLS_ASSERT_OPT(1          <= numThreads);
     BSLS_ASSERT_OPT(1          <= maxNumPendingJobs);
@@ -232,6 +243,7 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_threadStartFunctor(bsl::allocator_arg_t(), basicAllocator)
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -330,6 +342,14 @@ void FixedThreadPool::drain()
     }
 }
 
+void FixedThreadPool::setThreadStartFunctor(
+                                             const ThreadStartFunctor& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    d_threadStartFunctor = functor;
+}
+
 void FixedThreadPool::shutdown()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
@@ -358,7 +378,7 @@ int FixedThreadPool::start()
     }
 
     for (int i = d_threadGroup.numThreads(); i < d_numThreads; ++i)  {
-        if (0 != startNewThread()) {
+        if (0 != startNewThread(i)) {
 
             releaseWorkerThreads();
             d_threadGroup.joinAll();
@@ -56,6 +56,14 @@ BSLS_IDENT("$Id: $")
 // 'bslmt_threadutil' package documentation for a description of
 // 'bslmt::ThreadAttributes'.
 //
+// An application can also supply a *thread start functor* (see
+// 'setThreadStartFunctor'), invoked by each processing thread, with the index
+// of that thread in the range '[0 .. numThreads())', when the thread starts
+// and before it processes any job.  For example, the functor can bind each
+// thread to a CPU or NUMA node (see 'bdlma_numautil'), so that the threads
+// of a pool are spread over the nodes of the host, and the memory each thread
+// allocates is local to it.
+//
 // Thread pools are ideal for developing multi-threaded server applications.  A
 // server need only package client requests to execute as jobs, and
 // 'bdlmt::FixedThreadPool' will handle the queue management, thread
@@ -346,6 +354,10 @@ class FixedThreadPool {
     typedef bsl::function<void()>  Job;
     typedef bdlcc::FixedQueue<Job> Queue;
 
+    typedef bsl::function<void(int)> ThreadStartFunctor;
+        // 'ThreadStartFunctor' is an alias for a functor invoked by each
+        // processing thread, with the index of the thread, when it starts.
+
     enum {
         e_STOP
       , e_RUN
@@ -412,6 +424,10 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    ThreadStartFunctor      d_threadStartFunctor; // functor invoked by each
+                                                  // processing thread when it
+                                                  // starts, or empty
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -427,13 +443,14 @@ class FixedThreadPool {
         // Repeatedly retrieves the next job off of the queue and processes it
         // until the queue is empty.
 
-    void workerThread();
-        // The main function executed by each worker thread.
+    void workerThread(int index);
+        // The main function executed by each worker thread, having the
+        // specified 'index'.
 
-    int startNewThread();
-        // Internal method to spawn a new processing thread and increment the
-        // current count.  Note that this method must be called with
-        // 'd_metaMutex' locked.
+    int startNewThread(int index);
+        // Internal method to spawn a new processing thread, having the
+        // specified 'index', and increment the current count.  Note that this
+        // method must be called with 'd_metaMutex' locked.
 
     void waitWorkerThreads();
         // Waits for worker threads to be ready at the gate.
@@ -522,6 +539,15 @@ class FixedThreadPool {
         // submitted concurrently with this method, this method may or may not
         // wait until they have also completed.
 
+    void setThreadStartFunctor(const ThreadStartFunctor& functor);
+        // Set the specified 'functor' to be invoked by each processing thread
+        // subsequently started by this thread pool, with the index of the
+        // thread in the range '[0 .. numThreads())', when the thread starts
+        // and before it processes any job.  If 'functor' is empty, no functor
+        // is invoked.  Note that 'start' returns only after each thread it
+        // started has returned from 'functor', and that threads already
+        // started are not affected.
+
     void shutdown();
         // Disable queuing on this thread pool, cancel all queued jobs, and
         // after all actives jobs have completed, join all processing threads.
@@ -18,6 +18,8 @@
 #include <bdlt_currenttime.h>
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
@@ -66,6 +68,7 @@ using namespace bsl;  // automatically added by script
 // [ 3] ~bdlmt::FixedThreadPool();
 // [ 3] int enqueueJob(const bsl::function<void()>& );
 // [15] int enqueueJob(bslmf::MovableRef<Job>);
+// [16] void setThreadStartFunctor(const ThreadStartFunctor&);
 // [ 3] int numThreads() const;
 // [ 4] int enqueueJob(FixedThreadPoolJobFunc, void *);
 // [ 4] void start();
@@ -492,6 +495,50 @@ void ConcurrencyTest::runTest()
 
 }  // close namespace FIXEDTHREADPOOL_CASE_14
 
+// ============================================================================
+//                         CASE 16 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_16 {
+
+enum { k_NUM_THREADS = 4 };
+
+bslmt::Mutex        s_mutex;                       // protects the following
+int                 s_numStarts[k_NUM_THREADS];    // starts of each index
+bsls::Types::Uint64 s_threadIds[k_NUM_THREADS];    // thread of each index
+int                 s_numUnknownThreads;           // jobs run by other threads
+
+void recordStart(int index)
+    // Record that the calling thread started with the specified 'index'.
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+
+    ASSERTV(index, 0 <= index && index < k_NUM_THREADS);
+
+    if (0 <= index && index < k_NUM_THREADS) {
+        ++s_numStarts[index];
+        s_threadIds[index] = bslmt::ThreadUtil::selfIdAsUint64();
+    }
+}
+
+void checkThread()
+    // Record whether the calling thread is a thread recorded by
+    // 'recordStart'.
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        if (id == s_threadIds[i]) {
+            return;                                                   // RETURN
+        }
+    }
+    ++s_numUnknownThreads;
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_16
+
 // ============================================================================
 //                         CASE 15 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -752,6 +799,81 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'setThreadStartFunctor'
+        //
+        // Concerns:
+        //: 1 Each processing thread invokes the thread start functor once,
+        //:   with a distinct index in the range '[0 .. numThreads())', before
+        //:   'start' returns.
+        //:
+        //: 2 Jobs are processed by the threads that invoked the functor.
+        //:
+        //: 3 The functor is invoked again by the threads of a restarted pool,
+        //:   and is not invoked once reset to an empty functor.
+        //
+        // Plan:
+        //: 1 Set a functor recording the index and identifier of each calling
+        //:   thread, start the pool, and verify the recorded indices.  (C-1)
+        //:
+        //: 2 Enqueue jobs verifying that they run on the recorded threads.
+        //:   (C-2)
+        //:
+        //: 3 Stop and restart the pool, with the functor and then with an
+        //:   empty functor, and verify the recorded indices.  (C-3)
+        //
+        // Testing:
+        //   void setThreadStartFunctor(const ThreadStartFunctor&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'setThreadStartFunctor'\n"
+                          << "===============================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_16;
+
+        {
+            Obj mX(k_NUM_THREADS, 100, &testAllocator);
+
+            mX.setThreadStartFunctor(&recordStart);
+
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+                ASSERTV(i, s_numStarts[i], 1 == s_numStarts[i]);
+            }
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(&checkThread));
+            }
+            mX.drain();
+            ASSERTV(s_numUnknownThreads, 0 == s_numUnknownThreads);
+
+            mX.stop();
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+                ASSERTV(i, s_numStarts[i], 2 == s_numStarts[i]);
+            }
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(&checkThread));
+            }
+            mX.drain();
+            ASSERTV(s_numUnknownThreads, 0 == s_numUnknownThreads);
+
+            mX.setThreadStartFunctor(Obj::ThreadStartFunctor());
+
+            mX.stop();
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+                ASSERTV(i, s_numStarts[i], 2 == s_numStarts[i]);
+            }
+            mX.shutdown();
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING MOVING ENQUEUEJOB
@@ -76,8 +76,30 @@ struct TimerEventSchedulerDispatcher {
     // thread.  Once started, it infinite loops, either waiting for or
     // executing events.
 
+    // TYPES
+    typedef TimerEventScheduler::ClockDataPtr        ClockDataPtr;
+    typedef bdlcc::TimeQueueItem<ClockDataPtr>       PendingClockItem;
+    typedef bsl::vector<bsl::function<void()> >      Batch;
+
     // CLASS METHODS
+    static void dispatchBatches(
+                       TimerEventScheduler                  *scheduler,
+                       const bsl::vector<PendingClockItem>&  pendingClockItems,
+                       Batch                                *batch);
+        // Pass the callbacks of the specified 'pendingClockItems' and of the
+        // pending event items of the specified 'scheduler', in time order and
+        // in batches of at most the maximal batch size of 'scheduler', to the
+        // batch dispatcher functor of 'scheduler', using the specified
+        // 'batch' to hold them, and reschedule the clocks that are not
+        // cancelled.
+
     static void dispatchEvents(TimerEventScheduler *scheduler);
+
+    static void recordLateness(TimerEventScheduler       *scheduler,
+                               const bsls::TimeInterval&  time);
+        // Record in the lateness statistics of the specified 'scheduler' the
+        // lateness of an event scheduled at the specified 'time' and
+        // dispatched now.
 };
 
 extern "C" void *TimerEventSchedulerDispatcherThread(void *scheduler)
@@ -87,14 +109,93 @@ extern "C" void *TimerEventSchedulerDispatcherThread(void *scheduler)
     return scheduler;
 }
 
+void TimerEventSchedulerDispatcher::dispatchBatches(
+                       TimerEventScheduler                  *scheduler,
+                       const bsl::vector<PendingClockItem>&  pendingClockItems,
+                       Batch                                *batch)
+{
+    BSLS_ASSERT(0 != scheduler);
+    BSLS_ASSERT(0 != batch);
+
+    const bsl::vector<TimerEventScheduler::EventItem>& pendingEventItems =
+                                                scheduler->d_pendingEventItems;
+
+    // All the pending events are handed off at once: it is too late to cancel
+    // any of them, even from a callback executed in the dispatcher thread.
+
+    scheduler->d_currentEventIndex =
+                                 static_cast<int>(pendingEventItems.size());
+
+    const bsl::size_t clockLen = pendingClockItems.size();
+    const bsl::size_t eventLen = pendingEventItems.size();
+    const bsl::size_t maxSize  = scheduler->d_maxBatchSize;
+
+    bsl::size_t clockIdx = 0;
+    bsl::size_t eventIdx = 0;
+
+    bsls::TimeInterval now = scheduler->d_currentTimeFunctor();
+
+    while (clockIdx < clockLen || eventIdx < eventLen) {
+        const bool isClockNext =
+                    eventIdx == eventLen
+                 || (clockIdx < clockLen
+                  && pendingClockItems[clockIdx].time() <
+                                           pendingEventItems[eventIdx].time());
+
+        if (isClockNext) {
+            const PendingClockItem& item = pendingClockItems[clockIdx];
+            ++clockIdx;
+
+            ClockDataPtr cd(item.data());
+            if (cd->d_isCancelled) {
+                continue;
+            }
+            batch->push_back(cd->d_callback);
+            scheduler->d_latenessStats.record(
+                                      (now - item.time()).totalMicroseconds());
+            cd->d_handle = scheduler->d_clockTimeQueue.add(
+                                        item.time() + cd->d_periodicInterval,
+                                        cd);
+        }
+        else {
+            const TimerEventScheduler::EventItem& item =
+                                                 pendingEventItems[eventIdx];
+            ++eventIdx;
+
+            --scheduler->d_numEvents;
+            batch->push_back(item.data());
+            scheduler->d_latenessStats.record(
+                                      (now - item.time()).totalMicroseconds());
+        }
+
+        if (batch->size() >= maxSize) {
+            scheduler->d_batchDispatcherFunctor(batch);
+            batch->clear();
+            now = scheduler->d_currentTimeFunctor();
+        }
+    }
+
+    if (!batch->empty()) {
+        scheduler->d_batchDispatcherFunctor(batch);
+        batch->clear();
+    }
+}
+
+void TimerEventSchedulerDispatcher::recordLateness(
+                                      TimerEventScheduler       *scheduler,
+                                      const bsls::TimeInterval&  time)
+{
+    scheduler->d_latenessStats.record(
+               (scheduler->d_currentTimeFunctor() - time).totalMicroseconds());
+}
+
 void TimerEventSchedulerDispatcher::dispatchEvents(
                                                 TimerEventScheduler* scheduler)
 {
     BSLS_ASSERT(0 != scheduler);
-    typedef TimerEventScheduler::ClockDataPtr ClockDataPtr;
-    typedef bdlcc::TimeQueueItem<ClockDataPtr>       PendingClockItem;
 
     bsl::vector<PendingClockItem> pendingClockItems;
+    Batch                         batch(scheduler->d_allocator_p);
 
     while (1) {
         bsl::size_t clockLen;
@@ -121,14 +222,25 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             };
             bsls::TimeInterval minTimeClock, minTimeEvent;
 
+            // In batch mode, retrieve at least enough items to fill a batch.
+
+            const int maxPendingClocks =
+                              scheduler->d_maxBatchSize > MAX_PENDING_CLOCKS
+                              ? scheduler->d_maxBatchSize
+                              : static_cast<int>(MAX_PENDING_CLOCKS);
+            const int maxPendingEvents =
+                              scheduler->d_maxBatchSize > MAX_PENDING_EVENTS
+                              ? scheduler->d_maxBatchSize
+                              : static_cast<int>(MAX_PENDING_EVENTS);
+
             scheduler->d_clockTimeQueue.popLE(now,
-                                              MAX_PENDING_CLOCKS,
+                                              maxPendingClocks,
                                               &pendingClockItems,
                                               &newLengthClock,
                                               &minTimeClock);
 
             scheduler->d_eventTimeQueue.popLE(now,
-                                              MAX_PENDING_EVENTS,
+                                              maxPendingEvents,
                                               &scheduler->d_pendingEventItems,
                                               &newLengthEvent,
                                               &minTimeEvent);
@@ -163,6 +275,14 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
 
         // We just unlocked the mutex.
 
+        if (scheduler->d_maxBatchSize) {
+            dispatchBatches(scheduler, pendingClockItems, &batch);
+
+            pendingClockItems.clear();
+            scheduler->d_pendingEventItems.clear();
+            continue;
+        }
+
         bsl::size_t clockIdx = 0;
         int *eventIdxPtr = &scheduler->d_currentEventIndex;
         *eventIdxPtr = 0;
@@ -189,6 +309,7 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             if (clockTime < eventData[*eventIdxPtr].time()) {
                 ClockDataPtr cd(clockData[clockIdx].data());
                 if (!cd->d_isCancelled) {
+                    recordLateness(scheduler, clockTime);
                     scheduler->d_dispatcherFunctor(cd->d_callback);
                     if (!cd->d_isCancelled) {
                         cd->d_handle = scheduler->d_clockTimeQueue.add(
@@ -200,6 +321,7 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             }
             else {
                 --scheduler->d_numEvents;
+                recordLateness(scheduler, eventData[*eventIdxPtr].time());
                 scheduler->d_dispatcherFunctor(eventData[*eventIdxPtr].data());
                 ++ *eventIdxPtr;
             }
@@ -211,6 +333,7 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             const bsls::TimeInterval& clockTime = clockData[clockIdx].time();
             ClockDataPtr cd(clockData[clockIdx].data());
             if (!cd->d_isCancelled) {
+                recordLateness(scheduler, clockTime);
                 scheduler->d_dispatcherFunctor(cd->d_callback);
                 if (!cd->d_isCancelled) {
                     cd->d_handle = scheduler->d_clockTimeQueue.add(
@@ -223,6 +346,7 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
         for (; *eventIdxPtr < (int) scheduler->d_pendingEventItems.size();
                                                             ++ *eventIdxPtr) {
             --scheduler->d_numEvents;
+            recordLateness(scheduler, eventData[*eventIdxPtr].time());
             scheduler->d_dispatcherFunctor(eventData[*eventIdxPtr].data());
         }
 
@@ -340,6 +464,8 @@ TimerEventScheduler::TimerEventScheduler(bslma::Allocator* basicAllocator)
 , d_clocks(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -366,6 +492,8 @@ TimerEventScheduler::TimerEventScheduler(
 , d_condition(clockType)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -391,6 +519,8 @@ TimerEventScheduler::TimerEventScheduler(
 , d_clocks(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -417,6 +547,8 @@ TimerEventScheduler::TimerEventScheduler(
 , d_condition(clockType)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -444,6 +576,8 @@ TimerEventScheduler::TimerEventScheduler(int               numEvents,
 , d_clocks(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -476,6 +610,8 @@ TimerEventScheduler::TimerEventScheduler(
 , d_condition(clockType)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -508,6 +644,8 @@ TimerEventScheduler::TimerEventScheduler(
 , d_clocks(basicAllocator)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -540,6 +678,76 @@ TimerEventScheduler::TimerEventScheduler(
 , d_condition(clockType)
 , d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
                       dispatcherFunctor)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator)
+, d_maxBatchSize(0)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(numEvents < (1 << 24) - 1);
+    BSLS_ASSERT(numClocks < (1 << 24) - 1);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+          const TimerEventScheduler::BatchDispatcher&  batchDispatcherFunctor,
+          int                                          maxBatchSize,
+          bsls::SystemClockType::Enum                  clockType,
+          bslma::Allocator                            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clockTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                           batchDispatcherFunctor)
+, d_maxBatchSize(maxBatchSize)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(batchDispatcherFunctor);
+    BSLS_ASSERT(1 <= maxBatchSize);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+          int                                          numEvents,
+          int                                          numClocks,
+          const TimerEventScheduler::BatchDispatcher&  batchDispatcherFunctor,
+          int                                          maxBatchSize,
+          bsls::SystemClockType::Enum                  clockType,
+          bslma::Allocator                            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numEvents)),
+                   basicAllocator)
+, d_clockTimeQueue(bsl::max(NUM_INDEX_BITS_MIN, numBitsRequired(numClocks)),
+                   basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_batchDispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                           batchDispatcherFunctor)
+, d_maxBatchSize(maxBatchSize)
 , d_dispatcherId(0)
 , d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
 , d_running(0)
@@ -552,6 +760,8 @@ TimerEventScheduler::TimerEventScheduler(
 {
     BSLS_ASSERT(numEvents < (1 << 24) - 1);
     BSLS_ASSERT(numClocks < (1 << 24) - 1);
+    BSLS_ASSERT(batchDispatcherFunctor);
+    BSLS_ASSERT(1 <= maxBatchSize);
 }
 
 TimerEventScheduler::~TimerEventScheduler()
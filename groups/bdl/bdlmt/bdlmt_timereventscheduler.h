@@ -84,6 +84,31 @@ BSLS_IDENT("$Id: $")
 // thread to run the callbacks).  In that case, the user-supplied functor will
 // still be run in the dispatcher thread, different from the scheduler thread.
 //
+///Batch Dispatch
+///--------------
+// Since the dispatcher thread executes the callbacks one at a time, a single
+// slow callback delays every event due after it.  Alternatively, a scheduler
+// can be constructed with a *batch* *dispatcher* functor and a maximal batch
+// size.  The dispatcher thread of such a scheduler only detects the events
+// (and clocks) that are due: it collects their callbacks, in time order, into
+// a vector of at most the maximal batch size, and passes that vector to the
+// batch dispatcher functor, which is expected to hand the callbacks off
+// quickly to an executor (e.g., a 'bdlmt::FixedThreadPool', or the queues of
+// a 'bdlmt::MultiQueueThreadPool' chosen by an affinity identifier bound into
+// each callback).  The batch dispatcher functor may modify the vector (e.g.,
+// swap its contents out), which is cleared on return.  Clocks are rescheduled
+// as soon as their callbacks are added to a batch.  Note that the callbacks
+// may then execute concurrently with one another, and that 'wait' arguments
+// only ensure that the dispatcher thread has handed the events off, not that
+// their callbacks have completed.
+//
+// Whatever the dispatch mode, each scheduler records the *lateness* of the
+// events and clocks it dispatches, i.e., the time elapsed between the
+// scheduled time of each and the time at which the dispatcher thread passed
+// its callback to the dispatcher functor or batch dispatcher functor, in a
+// 'bdlmt::TimerLatenessStats' object returned by 'latenessStats' (see
+// 'bdlmt_timerlatenessstats').
+//
 ///Thread Safety
 ///-------------
 // The 'bdlmt::TimerEventScheduler' class is both *fully thread-safe* (i.e.,
@@ -318,6 +343,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlma_concurrentpool.h>
 
+#include <bdlmt_timerlatenessstats.h>
+
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
@@ -423,6 +450,11 @@ class TimerEventScheduler {
     typedef bsl::function<void(const bsl::function<void()>&)> Dispatcher;
         // Defines a type alias for the dispatcher functor type.
 
+    typedef bsl::function<void(bsl::vector<bsl::function<void()> > *)>
+                                                              BatchDispatcher;
+        // Defines a type alias for the batch dispatcher functor type (see
+        // {Batch Dispatch} in the component documentation).
+
     typedef bdlcc::TimeQueue<bsl::function<void()> >::Key     EventKey;
         // Defines a type alias for a user-supplied key for identifying events.
 
@@ -467,6 +499,20 @@ class TimerEventScheduler {
 
     Dispatcher        d_dispatcherFunctor;  // functor used to dispatch events
 
+    BatchDispatcher   d_batchDispatcherFunctor;
+                                            // functor used to dispatch
+                                            // batches of events, or empty if
+                                            // events are dispatched one at a
+                                            // time
+
+    int               d_maxBatchSize;       // maximal number of events in a
+                                            // batch, or 0 if events are
+                                            // dispatched one at a time
+
+    TimerLatenessStats
+                      d_latenessStats;      // lateness of the dispatched
+                                            // events and clocks
+
     bsls::AtomicInt64 d_dispatcherId;       // id of the dispatcher thread
 
     bslmt::ThreadUtil::Handle
@@ -627,6 +673,42 @@ class TimerEventScheduler {
         // installed default allocator is used.  The behavior is undefined
         // unless '0 <= numEvents < 2**24' and '0 <= numClocks < 2**24'.
 
+    TimerEventScheduler(const BatchDispatcher&       batchDispatcherFunctor,
+                        int                          maxBatchSize,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler passing the callbacks of the events
+        // and clocks due, in batches of at most the specified 'maxBatchSize'
+        // callbacks, to the specified 'batchDispatcherFunctor' (see {Batch
+        // Dispatch} in the component documentation), and using the specified
+        // 'clockType' to indicate the epoch used for all time intervals (see
+        // {Supported Clock-Types} in the component documentation).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'batchDispatcherFunctor' is
+        // not empty and '1 <= maxBatchSize'.  Note that the maximal number of
+        // scheduled non-recurring events and recurring events defaults to an
+        // implementation defined constant.
+
+    TimerEventScheduler(int                          numEvents,
+                        int                          numClocks,
+                        const BatchDispatcher&       batchDispatcherFunctor,
+                        int                          maxBatchSize,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct a timer event scheduler that has the capability to
+        // concurrently schedule *at* *least* the specified 'numEvents' and
+        // 'numClocks', passing the callbacks of the events and clocks due, in
+        // batches of at most the specified 'maxBatchSize' callbacks, to the
+        // specified 'batchDispatcherFunctor' (see {Batch Dispatch} in the
+        // component documentation), and using the specified 'clockType' to
+        // indicate the epoch used for all time intervals (see {Supported
+        // Clock-Types} in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= numEvents < 2**24', '0 <= numClocks < 2**24',
+        // 'batchDispatcherFunctor' is not empty, and '1 <= maxBatchSize'.
+
     ~TimerEventScheduler();
         // Stop this scheduler, discard all the unprocessed events and destroy
         // this object.
@@ -699,6 +781,11 @@ class TimerEventScheduler {
         // which is detemined by the clock indicated at construction (see
         // {Supported Clock-Types} in the component documentation).
 
+    void resetLatenessStats();
+        // Discard the lateness statistics of the events and clocks dispatched
+        // by this scheduler (see {Batch Dispatch} in the component
+        // documentation).
+
     int cancelEvent(Handle          handle,
                     bool            wait = false);
     int cancelEvent(Handle          handle,
@@ -756,6 +843,19 @@ class TimerEventScheduler {
         // Return the value of the clock type that this object was created
         // with.
 
+    const TimerLatenessStats& latenessStats() const;
+        // Return a reference providing non-modifiable access to the lateness
+        // statistics of the events and clocks dispatched by this scheduler
+        // since its construction, or since the last call to
+        // 'resetLatenessStats' (see {Batch Dispatch} in the component
+        // documentation).
+
+    int maxBatchSize() const;
+        // Return the maximal number of callbacks passed at once to the batch
+        // dispatcher functor of this scheduler, or 0 if this scheduler
+        // dispatches events one at a time (see {Batch Dispatch} in the
+        // component documentation).
+
     bsls::TimeInterval now() const;
         // Return the current epoch time, an absolute time represented as an
         // interval from some epoch, which is determined by the clock indicated
@@ -847,6 +947,12 @@ int TimerEventScheduler::rescheduleEvent(TimerEventScheduler::Handle handle,
     return rescheduleEvent(handle, EventKey(0), newTime, wait);
 }
 
+inline
+void TimerEventScheduler::resetLatenessStats()
+{
+    d_latenessStats.reset();
+}
+
 // ACCESSORS
 inline
 bsls::SystemClockType::Enum TimerEventScheduler::clockType() const
@@ -854,6 +960,18 @@ bsls::SystemClockType::Enum TimerEventScheduler::clockType() const
     return d_clockType;
 }
 
+inline
+const TimerLatenessStats& TimerEventScheduler::latenessStats() const
+{
+    return d_latenessStats;
+}
+
+inline
+int TimerEventScheduler::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
 inline
 bsls::TimeInterval TimerEventScheduler::now() const
 {
@@ -31,6 +31,8 @@
 #include <bslmt_timedsemaphore.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
@@ -45,6 +47,7 @@
 #include <bsl_iostream.h>
 #include <bsl_list.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 
 using namespace BloombergLP;
@@ -106,6 +109,8 @@ using bsl::flush;
 // [23] bdlmt::TimerEventScheduler(nE, nC, disp, bA = 0);
 // [24] bdlmt::TimerEventScheduler(nE, nC, disp, cT, bA = 0);
 //
+// [29] bdlmt::TimerEventScheduler(bDisp, maxBatchSize, cT, bA = 0);
+// [29] bdlmt::TimerEventScheduler(nE, nC, bDisp, maxBatchSize, cT, bA = 0);
 //
 // [01] ~bdlmt::TimerEventScheduler();
 //
@@ -133,9 +138,13 @@ using bsl::flush;
 //
 // [06] void cancelAllClocks(bool wait=false);
 //
+// [29] void resetLatenessStats();
+//
 // ACCESSORS
 // [25] bsls::SystemClockType::Enum clockType();
 // [27] bsls::TimeInterval now();
+// [29] const TimerLatenessStats& latenessStats() const;
+// [29] int maxBatchSize() const;
 // ----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [28] DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -143,7 +152,8 @@ using bsl::flush;
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [26] CLOCK-REPLACEMENT BREATHING TEST
-// [29] USAGE EXAMPLE
+// [29] BATCH DISPATCH
+// [30] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -784,6 +794,99 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 29 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29
+{
+
+class BatchRecorder {
+    // This class provides a batch dispatcher functor that records the sizes
+    // of the batches it is passed, then executes their callbacks, and records
+    // the identifiers of the callbacks executed.
+
+    // DATA
+    bslmt::Mutex     d_mutex;  // protects the following
+    bsl::vector<int> d_sizes;  // sizes of the batches dispatched
+    bsl::vector<int> d_ids;    // identifiers of the callbacks executed
+
+  public:
+    // MANIPULATORS
+    void dispatch(bsl::vector<bsl::function<void()> > *batch)
+        // Record the size of the specified 'batch', and execute its
+        // callbacks in order.
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_sizes.push_back(static_cast<int>(batch->size()));
+        }
+        for (bsl::size_t i = 0; i < batch->size(); ++i) {
+            (*batch)[i]();
+        }
+    }
+
+    void record(int id)
+        // Record the execution of the callback having the specified 'id'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_ids.push_back(id);
+    }
+
+    // ACCESSORS
+    int id(int index)
+        // Return the identifier of the callback executed at the specified
+        // 'index' in the order of execution.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_ids[index];
+    }
+
+    int numBatches()
+        // Return the number of batches dispatched.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return static_cast<int>(d_sizes.size());
+    }
+
+    int numRecorded()
+        // Return the number of callbacks executed.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return static_cast<int>(d_ids.size());
+    }
+
+    int size(int index)
+        // Return the size of the batch dispatched at the specified 'index' in
+        // the order of dispatch.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_sizes[index];
+    }
+};
+
+void waitForNumRecorded(BatchRecorder *recorder, int numRecorded)
+    // Wait, for at most 10 seconds, until the specified 'recorder' has
+    // recorded the execution of the specified 'numRecorded' callbacks.  Note
+    // that, unlike 'bdlmt::EventSchedulerTestTimeSource', advancing the time
+    // of a 'bdlmt::TimerEventSchedulerTestTimeSource' does not wait for the
+    // callbacks becoming due to be executed.
+{
+    bsls::Stopwatch stopwatch;
+    stopwatch.start(true);
+    while (recorder->numRecorded() < numRecorded
+        && stopwatch.elapsedTime() < 10) {
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+}
+
+}  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29
+
 // ============================================================================
 //                         CASE 20 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2752,6 +2855,210 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 29: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH DISPATCH
+        //
+        // Concerns:
+        //: 1 A scheduler constructed with a batch dispatcher reports its
+        //:   maximal batch size, and other schedulers report 0.
+        //:
+        //: 2 The callbacks of the events and clocks due at the same time are
+        //:   passed to the batch dispatcher in the order of their scheduled
+        //:   times, in batches of at most the maximal batch size.
+        //:
+        //: 3 The lateness of every dispatched event and clock is recorded, in
+        //:   batch mode or not, and 'resetLatenessStats' discards it.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Construct schedulers with and without a batch dispatcher, and
+        //:   verify 'maxBatchSize' and 'latenessStats'.  (C-1)
+        //:
+        //: 2 Using a test time source, schedule more events than the maximal
+        //:   batch size, in an order other than that of their times, and
+        //:   start a clock, then advance the time past all of them, and
+        //:   verify the sizes of the batches, the order of execution, and the
+        //:   lateness statistics.  (C-2..3)
+        //:
+        //: 3 Dispatch events using a scheduler without batch dispatcher,
+        //:   verify the lateness statistics, reset them, and verify them
+        //:   again.  (C-3)
+        //:
+        //: 4 Verify that the test allocator has no memory in use after each
+        //:   scheduler is destroyed.  (C-4)
+        //
+        // Testing:
+        //   TimerEventScheduler(bDisp, maxBatchSize, cT, bA = 0);
+        //   TimerEventScheduler(nE, nC, bDisp, maxBatchSize, cT, bA = 0);
+        //   void resetLatenessStats();
+        //   const TimerLatenessStats& latenessStats() const;
+        //   int maxBatchSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH DISPATCH" << endl
+                          << "======================" << endl;
+
+        using namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'maxBatchSize'." << endl;
+        {
+            BatchRecorder batchRecorder;
+
+            Obj mX(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                          &batchRecorder),
+                   4,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+            ASSERT(4 == mX.maxBatchSize());
+            ASSERT(0 == mX.latenessStats().numRecorded());
+
+            Obj mY(16,
+                   4,
+                   bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                          &batchRecorder),
+                   1,
+                   bsls::SystemClockType::e_REALTIME,
+                   &ta);
+            ASSERT(1 == mY.maxBatchSize());
+
+            Obj mZ(&ta);
+            ASSERT(0 == mZ.maxBatchSize());
+            ASSERT(0 == mZ.latenessStats().numRecorded());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting batches of due events." << endl;
+        {
+            enum {
+                k_NUM_EVENTS     = 10,
+                k_MAX_BATCH_SIZE = 4,
+                k_CLOCK_ID       = 100
+            };
+
+            BatchRecorder batchRecorder;
+
+            Obj mX(bdlf::MemFnUtil::memFn(&BatchRecorder::dispatch,
+                                          &batchRecorder),
+                   k_MAX_BATCH_SIZE,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   &ta);
+
+            bdlmt::TimerEventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            // Schedule in reverse order, so that the order of execution is
+            // not that of scheduling.
+
+            for (int i = k_NUM_EVENTS - 1; 0 <= i; --i) {
+                bsls::TimeInterval time(T0);
+                time.addMilliseconds(i + 1);
+
+                mX.scheduleEvent(time,
+                                 bdlf::BindUtil::bind(&BatchRecorder::record,
+                                                      &batchRecorder,
+                                                      i));
+            }
+
+            bsls::TimeInterval clockTime(T0);
+            clockTime.addMicroseconds(500);
+
+            mX.startClock(bsls::TimeInterval(10),
+                          bdlf::BindUtil::bind(&BatchRecorder::record,
+                                               &batchRecorder,
+                                               static_cast<int>(k_CLOCK_ID)),
+                          clockTime);
+
+            mX.start();
+            timeSource.advanceTime(bsls::TimeInterval(1));
+            waitForNumRecorded(&batchRecorder, k_NUM_EVENTS + 1);
+            mX.stop();
+
+            ASSERTV(batchRecorder.numRecorded(),
+                    k_NUM_EVENTS + 1 == batchRecorder.numRecorded());
+            for (int i = 0; i < batchRecorder.numRecorded(); ++i) {
+                const int EXP = 0 == i ? static_cast<int>(k_CLOCK_ID) : i - 1;
+                ASSERTV(i, batchRecorder.id(i), EXP == batchRecorder.id(i));
+            }
+
+            // All the callbacks are due at once: all the batches are full,
+            // but the last.
+
+            const int NUM_BATCHES = batchRecorder.numBatches();
+            ASSERTV(NUM_BATCHES,
+                    (k_NUM_EVENTS + k_MAX_BATCH_SIZE) / k_MAX_BATCH_SIZE ==
+                                                                  NUM_BATCHES);
+
+            int total = 0;
+            for (int i = 0; i < NUM_BATCHES; ++i) {
+                const int SIZE = batchRecorder.size(i);
+                ASSERTV(i, SIZE, 0 < SIZE);
+                ASSERTV(i, SIZE, SIZE <= k_MAX_BATCH_SIZE);
+                total += SIZE;
+            }
+            ASSERTV(total, k_NUM_EVENTS + 1 == total);
+
+            const bdlmt::TimerLatenessStats& STATS = mX.latenessStats();
+
+            ASSERTV(STATS.numRecorded(),
+                    k_NUM_EVENTS + 1 == STATS.numRecorded());
+            ASSERTV(STATS.maxLateness(),
+                    bsls::TimeInterval(0.99) < STATS.maxLateness());
+            ASSERTV(STATS.maxLateness(),
+                    STATS.maxLateness() <= bsls::TimeInterval(1));
+
+            mX.resetLatenessStats();
+            ASSERT(0                    == STATS.numRecorded());
+            ASSERT(bsls::TimeInterval() == STATS.maxLateness());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tTesting lateness without batches." << endl;
+        {
+            BatchRecorder recorder;
+
+            Obj mX(&ta);
+
+            bdlmt::TimerEventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            for (int i = 0; i < 3; ++i) {
+                bsls::TimeInterval time(T0);
+                time.addMilliseconds(i + 1);
+
+                mX.scheduleEvent(time,
+                                 bdlf::BindUtil::bind(&BatchRecorder::record,
+                                                      &recorder,
+                                                      i));
+            }
+
+            mX.start();
+            timeSource.advanceTime(bsls::TimeInterval(0.010));
+            waitForNumRecorded(&recorder, 3);
+            mX.stop();
+
+            const bdlmt::TimerLatenessStats& STATS = mX.latenessStats();
+
+            ASSERTV(recorder.numRecorded(), 3 == recorder.numRecorded());
+            ASSERTV(recorder.numBatches(),  0 == recorder.numBatches());
+            ASSERTV(STATS.numRecorded(), 3 == STATS.numRecorded());
+            ASSERTV(STATS.maxLateness(),
+                    bsls::TimeInterval(0.009) == STATS.maxLateness());
+            ASSERTV(STATS.meanLateness(),
+                    bsls::TimeInterval(0.008) == STATS.meanLateness());
+
+            mX.resetLatenessStats();
+            ASSERT(0                    == STATS.numRecorded());
+            ASSERT(bsls::TimeInterval() == STATS.meanLateness());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 30: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE:
         //
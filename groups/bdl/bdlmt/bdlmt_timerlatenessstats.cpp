@@ -0,0 +1,162 @@
+// bdlmt_timerlatenessstats.cpp                                       -*-C++-*-
+
+#include <bdlmt_timerlatenessstats.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_timerlatenessstats_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsl_cmath.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                          // ------------------------
+                          // class TimerLatenessStats
+                          // ------------------------
+
+// CLASS METHODS
+int TimerLatenessStats::bucketIndex(bsls::Types::Int64 lateness)
+{
+    if (lateness <= 0) {
+        return 0;                                                     // RETURN
+    }
+
+    // A 'lateness' of at least '2^(i-1)' and less than '2^i' has 'i'
+    // significant bits.
+
+    const int index = 64 - bdlb::BitUtil::numLeadingUnsetBits(
+                                         static_cast<bsl::uint64_t>(lateness));
+
+    return index < k_NUM_BUCKETS ? index : k_NUM_BUCKETS - 1;
+}
+
+bsls::Types::Int64 TimerLatenessStats::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (k_NUM_BUCKETS - 1 == index) {
+        return bsl::numeric_limits<bsls::Types::Int64>::max();        // RETURN
+    }
+    return (static_cast<bsls::Types::Int64>(1) << index) - 1;
+}
+
+// CREATORS
+TimerLatenessStats::TimerLatenessStats()
+: d_numRecorded(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+}
+
+// MANIPULATORS
+void TimerLatenessStats::record(bsls::Types::Int64 lateness)
+{
+    if (lateness < 0) {
+        lateness = 0;
+    }
+
+    d_buckets[bucketIndex(lateness)].addRelaxed(1);
+    d_totalLateness.addRelaxed(lateness);
+    d_numRecorded.addRelaxed(1);
+
+    bsls::Types::Int64 max = d_maxLateness.loadRelaxed();
+    while (lateness > max) {
+        const bsls::Types::Int64 previous =
+                                d_maxLateness.testAndSwapAcqRel(max, lateness);
+        if (previous == max) {
+            break;
+        }
+        max = previous;
+    }
+}
+
+void TimerLatenessStats::reset()
+{
+    d_numRecorded.storeRelaxed(0);
+    d_totalLateness.storeRelaxed(0);
+    d_maxLateness.storeRelaxed(0);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+}
+
+// ACCESSORS
+bsls::TimeInterval TimerLatenessStats::meanLateness() const
+{
+    const bsls::Types::Int64 numRecorded = d_numRecorded.loadRelaxed();
+
+    bsls::TimeInterval result;
+    if (0 < numRecorded) {
+        result.addMicroseconds(d_totalLateness.loadRelaxed() / numRecorded);
+    }
+    return result;
+}
+
+bsls::TimeInterval TimerLatenessStats::quantile(double fraction) const
+{
+    BSLS_ASSERT(0 <= fraction);
+    BSLS_ASSERT(fraction <= 1);
+
+    bsls::Types::Int64 counts[k_NUM_BUCKETS];
+    bsls::Types::Int64 numRecorded = 0;
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        counts[i]    = d_buckets[i].loadRelaxed();
+        numRecorded += counts[i];
+    }
+
+    const bsls::Types::Int64 max = d_maxLateness.loadRelaxed();
+
+    bsls::TimeInterval result;
+    if (0 == numRecorded) {
+        return result;                                                // RETURN
+    }
+
+    bsls::Types::Int64 target = static_cast<bsls::Types::Int64>(
+                   bsl::ceil(fraction * static_cast<double>(numRecorded)));
+    if (target < 1) {
+        target = 1;
+    }
+
+    bsls::Types::Int64 bound      = max;
+    bsls::Types::Int64 cumulative = 0;
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        cumulative += counts[i];
+        if (cumulative >= target) {
+            bound = bucketUpperBound(i);
+            break;
+        }
+    }
+
+    result.addMicroseconds(bound < max ? bound : max);
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
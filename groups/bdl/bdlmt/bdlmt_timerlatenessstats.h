@@ -0,0 +1,225 @@
+// bdlmt_timerlatenessstats.h                                         -*-C++-*-
+
+#ifndef INCLUDED_BDLMT_TIMERLATENESSSTATS
+#define INCLUDED_BDLMT_TIMERLATENESSSTATS
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide thread-safe statistics on the lateness of timer events.
+//
+//@CLASSES:
+//  bdlmt::TimerLatenessStats: thread-safe timer lateness accumulator
+//
+//@SEE_ALSO: bdlmt_eventscheduler, bdlmt_timereventscheduler
+//
+//@DESCRIPTION: This component defines a mechanism,
+// 'bdlmt::TimerLatenessStats', that accumulates the *lateness* of timer
+// events, i.e., the time elapsed between the scheduled time of each event and
+// the time at which a scheduler dispatched it.  'bdlmt::EventScheduler' and
+// 'bdlmt::TimerEventScheduler' each maintain such an object, updated by their
+// dispatcher threads, so that applications can monitor the jitter of their
+// timers.
+//
+// Besides the number of events recorded, their mean and maximal lateness, a
+// 'bdlmt::TimerLatenessStats' keeps a histogram of the lateness values in
+// 'k_NUM_BUCKETS' buckets of exponentially increasing width: bucket 0 counts
+// the events dispatched less than one microsecond late, and bucket 'i' (for
+// '0 < i < k_NUM_BUCKETS - 1') counts the events dispatched at least '2^(i-1)'
+// and less than '2^i' microseconds late, the last bucket counting all the
+// events dispatched later than that.  'quantile' uses this histogram to
+// return an upper bound of a quantile of the lateness (e.g., the 99th
+// percentile) that is at most twice the exact value.
+//
+///Thread Safety
+///-------------
+// 'bdlmt::TimerLatenessStats' is *fully* *thread-safe*, meaning that all
+// non-creator methods can be invoked concurrently on the same object.  Note,
+// however, that the statistics are not updated atomically as a whole:
+// accessors invoked while another thread is executing 'record' or 'reset' may
+// observe some, but not all, of the effects of that call.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Monitoring the Jitter of a Scheduler
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a dispatcher thread records the lateness of the events it
+// dispatches, as 'bdlmt::EventScheduler' does.  Here, we simulate four
+// events, dispatched 0, 3, 40, and 150 microseconds late:
+//..
+//  bdlmt::TimerLatenessStats stats;
+//
+//  stats.record(0);
+//  stats.record(3);
+//  stats.record(40);
+//  stats.record(150);
+//..
+// Then, a monitoring thread can report the statistics accumulated so far:
+//..
+//  assert(4                            == stats.numRecorded());
+//  assert(bsls::TimeInterval(0, 150000) == stats.maxLateness());
+//  assert(bsls::TimeInterval(0,  48000) == stats.meanLateness());
+//..
+// The median lateness is at most 3 microseconds, the upper bound of the bucket
+// counting the event dispatched 3 microseconds late:
+//..
+//  assert(bsls::TimeInterval(0, 3000) == stats.quantile(0.5));
+//..
+// Finally, the monitoring thread starts a new reporting interval:
+//..
+//  stats.reset();
+//  assert(0 == stats.numRecorded());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                          // ========================
+                          // class TimerLatenessStats
+                          // ========================
+
+class TimerLatenessStats {
+    // This class provides a thread-safe accumulator of the lateness of timer
+    // events, keeping their number, their total and maximal lateness, and a
+    // histogram of their lateness in buckets of exponentially increasing
+    // width.
+
+  public:
+    // CONSTANTS
+    enum { k_NUM_BUCKETS = 32 };  // number of buckets of the histogram
+
+  private:
+    // DATA
+    bsls::AtomicInt64 d_numRecorded;             // number of events recorded
+
+    bsls::AtomicInt64 d_totalLateness;           // total lateness (in
+                                                 // microseconds)
+
+    bsls::AtomicInt64 d_maxLateness;             // maximal lateness (in
+                                                 // microseconds)
+
+    bsls::AtomicInt64 d_buckets[k_NUM_BUCKETS];  // histogram of the lateness
+
+    // NOT IMPLEMENTED
+    TimerLatenessStats(const TimerLatenessStats&);
+    TimerLatenessStats& operator=(const TimerLatenessStats&);
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(bsls::Types::Int64 lateness);
+        // Return the index of the bucket of the histogram counting the events
+        // dispatched the specified 'lateness' (in microseconds) late.  A
+        // negative 'lateness' is counted as 0.
+
+    static bsls::Types::Int64 bucketUpperBound(int index);
+        // Return the greatest lateness (in microseconds) counted in the
+        // bucket having the specified 'index', or the greatest value of
+        // 'bsls::Types::Int64' for the last bucket.  The behavior is undefined
+        // unless '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    TimerLatenessStats();
+        // Create a lateness accumulator having recorded no events.
+
+    //! ~TimerLatenessStats() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void record(bsls::Types::Int64 lateness);
+        // Record an event dispatched the specified 'lateness' (in
+        // microseconds) late.  A negative 'lateness' is recorded as 0.
+
+    void reset();
+        // Discard the statistics accumulated by this object.
+
+    // ACCESSORS
+    bsls::TimeInterval maxLateness() const;
+        // Return the greatest lateness recorded since the construction of
+        // this object, or since the last call to 'reset', or 0 if no event
+        // was recorded.
+
+    bsls::TimeInterval meanLateness() const;
+        // Return the mean lateness, truncated to the microsecond, of the
+        // events recorded since the construction of this object, or since the
+        // last call to 'reset', or 0 if no event was recorded.
+
+    bsls::Types::Int64 numInBucket(int index) const;
+        // Return the number of recorded events counted in the bucket of the
+        // histogram having the specified 'index'.  The behavior is undefined
+        // unless '0 <= index < k_NUM_BUCKETS'.
+
+    bsls::Types::Int64 numRecorded() const;
+        // Return the number of events recorded since the construction of this
+        // object, or since the last call to 'reset'.
+
+    bsls::TimeInterval quantile(double fraction) const;
+        // Return an upper bound of the lateness of the specified 'fraction' of
+        // the events recorded since the construction of this object, or since
+        // the last call to 'reset', i.e., the upper bound of the first bucket
+        // of the histogram such that at least 'fraction' of the events are
+        // counted in it or in the preceding buckets, bounded by the maximal
+        // lateness, or 0 if no event was recorded.  The behavior is undefined
+        // unless '0 <= fraction <= 1'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class TimerLatenessStats
+                          // ------------------------
+
+// ACCESSORS
+inline
+bsls::TimeInterval TimerLatenessStats::maxLateness() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_maxLateness.loadRelaxed());
+    return result;
+}
+
+inline
+bsls::Types::Int64 TimerLatenessStats::numInBucket(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    return d_buckets[index].loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 TimerLatenessStats::numRecorded() const
+{
+    return d_numRecorded.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,531 @@
+// bdlmt_timerlatenessstats.t.cpp                                     -*-C++-*-
+
+#include <bdlmt_timerlatenessstats.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadgroup.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe accumulator of lateness values.
+// The bucket computation is tested first, as a pure function of the lateness,
+// including at the boundaries of every bucket.  The manipulators and
+// accessors are then tested against values computed by the test driver, and
+// finally concurrent calls to 'record' are verified to lose no value.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int bucketIndex(bsls::Types::Int64 lateness);
+// [ 2] static bsls::Types::Int64 bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3] TimerLatenessStats();
+//
+// MANIPULATORS
+// [ 3] void record(bsls::Types::Int64 lateness);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] bsls::TimeInterval maxLateness() const;
+// [ 3] bsls::TimeInterval meanLateness() const;
+// [ 3] bsls::Types::Int64 numInBucket(int index) const;
+// [ 3] bsls::Types::Int64 numRecorded() const;
+// [ 3] bsls::TimeInterval quantile(double fraction) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT RECORDING
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::TimerLatenessStats Obj;
+typedef bsls::Types::Int64        Int64;
+
+static bsls::TimeInterval microseconds(Int64 value)
+    // Return a time interval of the specified 'value' microseconds.
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(value);
+    return result;
+}
+
+// ============================================================================
+//                         CASE 4 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace TIMERLATENESSSTATS_TEST_CASE_4 {
+
+enum {
+    k_NUM_THREADS = 4,
+    k_NUM_VALUES  = 10000
+};
+
+void recordValues(Obj *stats, int thread)
+    // Record in the specified 'stats' 'k_NUM_VALUES' values depending on the
+    // specified 'thread' index.
+{
+    for (int i = 0; i < k_NUM_VALUES; ++i) {
+        stats->record(i % 100 + thread);
+    }
+}
+
+}  // close namespace TIMERLATENESSSTATS_TEST_CASE_4
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Monitoring the Jitter of a Scheduler
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a dispatcher thread records the lateness of the events it
+// dispatches, as 'bdlmt::EventScheduler' does.  Here, we simulate four
+// events, dispatched 0, 3, 40, and 150 microseconds late:
+//..
+    bdlmt::TimerLatenessStats stats;
+
+    stats.record(0);
+    stats.record(3);
+    stats.record(40);
+    stats.record(150);
+//..
+// Then, a monitoring thread can report the statistics accumulated so far:
+//..
+    ASSERT(4                            == stats.numRecorded());
+    ASSERT(bsls::TimeInterval(0, 150000) == stats.maxLateness());
+    ASSERT(bsls::TimeInterval(0,  48000) == stats.meanLateness());
+//..
+// The median lateness is at most 3 microseconds, the upper bound of the bucket
+// counting the event dispatched 3 microseconds late:
+//..
+    ASSERT(bsls::TimeInterval(0, 3000) == stats.quantile(0.5));
+//..
+// Finally, the monitoring thread starts a new reporting interval:
+//..
+    stats.reset();
+    ASSERT(0 == stats.numRecorded());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT RECORDING
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently from several threads are all
+        //:   accounted for in the count, total, histogram, and maximum.
+        //
+        // Plan:
+        //: 1 Record a known set of values from several threads, and verify
+        //:   the resulting statistics against the values computed by the
+        //:   test driver.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT RECORDING" << endl
+                          << "====================" << endl;
+
+        using namespace TIMERLATENESSSTATS_TEST_CASE_4;
+
+        Obj mX;  const Obj& X = mX;
+
+        bslmt::ThreadGroup threadGroup;
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == threadGroup.addThread(
+                            bdlf::BindUtil::bind(&recordValues, &mX, i)));
+        }
+        threadGroup.joinAll();
+
+        Int64 total   = 0;
+        Int64 buckets[Obj::k_NUM_BUCKETS] = { 0 };
+
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                total += i % 100 + t;
+                ++buckets[Obj::bucketIndex(i % 100 + t)];
+            }
+        }
+
+        const Int64 NUM = k_NUM_THREADS * k_NUM_VALUES;
+
+        ASSERTV(X.numRecorded(), NUM == X.numRecorded());
+        ASSERTV(X.maxLateness(),
+                microseconds(99 + k_NUM_THREADS - 1) == X.maxLateness());
+        ASSERTV(X.meanLateness(),
+                microseconds(total / NUM) == X.meanLateness());
+
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, X.numInBucket(i), buckets[i] == X.numInBucket(i));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object has recorded no value, and its
+        //:   accessors return 0.
+        //:
+        //: 2 'record' counts the value in the bucket given by 'bucketIndex',
+        //:   and updates the count, mean, and maximum.
+        //:
+        //: 3 Negative values are recorded as 0.
+        //:
+        //: 4 'quantile' returns the upper bound of the first bucket reaching
+        //:   the requested fraction, bounded by the maximum.
+        //:
+        //: 5 'reset' discards all the statistics.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the accessors of a default-constructed object.  (C-1)
+        //:
+        //: 2 Record a sequence of values, including negative ones, and verify
+        //:   the accessors after each against values computed by the test
+        //:   driver.  (C-2..4)
+        //:
+        //: 3 Reset the object and verify its accessors.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid bucket indices and fractions.  (C-6)
+        //
+        // Testing:
+        //   TimerLatenessStats();
+        //   void record(bsls::Types::Int64 lateness);
+        //   void reset();
+        //   bsls::TimeInterval maxLateness() const;
+        //   bsls::TimeInterval meanLateness() const;
+        //   bsls::Types::Int64 numInBucket(int index) const;
+        //   bsls::Types::Int64 numRecorded() const;
+        //   bsls::TimeInterval quantile(double fraction) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0                    == X.numRecorded());
+        ASSERT(bsls::TimeInterval() == X.maxLateness());
+        ASSERT(bsls::TimeInterval() == X.meanLateness());
+        ASSERT(bsls::TimeInterval() == X.quantile(0.5));
+        ASSERT(bsls::TimeInterval() == X.quantile(1));
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == X.numInBucket(i));
+        }
+
+        static const struct {
+            int   d_line;      // source line number
+            Int64 d_lateness;  // value recorded
+            Int64 d_max;       // expected maximum
+            Int64 d_total;     // expected total
+            Int64 d_median;    // expected 'quantile(0.5)' in microseconds
+            Int64 d_p99;       // expected 'quantile(0.99)' in microseconds
+        } DATA[] = {
+            //LINE  LATENESS      MAX     TOTAL  MEDIAN      P99
+            //----  --------  -------  -------  ------  -------
+            { L_,        50,      50,      50,     50,      50 },
+            { L_,        -5,      50,      50,      0,      50 },
+            { L_,         0,      50,      50,      0,      50 },
+            { L_,        70,      70,     120,      0,      70 },
+            { L_,        63,      70,     183,     63,      70 },
+            { L_,      1000,    1000,    1183,     63,    1000 },
+            { L_,   2000000, 2000000, 2001183,     63, 2000000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        Int64 buckets[Obj::k_NUM_BUCKETS] = { 0 };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const Int64 LATENESS = DATA[ti].d_lateness;
+            const Int64 MAX      = DATA[ti].d_max;
+            const Int64 TOTAL    = DATA[ti].d_total;
+            const Int64 MEDIAN   = DATA[ti].d_median;
+            const Int64 P99      = DATA[ti].d_p99;
+
+            if (veryVerbose) { T_ P_(LINE) P(LATENESS) }
+
+            mX.record(LATENESS);
+            ++buckets[Obj::bucketIndex(LATENESS)];
+
+            ASSERTV(LINE, X.numRecorded(), ti + 1 == X.numRecorded());
+            ASSERTV(LINE, X.maxLateness(),
+                    microseconds(MAX) == X.maxLateness());
+            ASSERTV(LINE, X.meanLateness(),
+                    microseconds(TOTAL / (ti + 1)) == X.meanLateness());
+            ASSERTV(LINE, X.quantile(0.5),
+                    microseconds(MEDIAN) == X.quantile(0.5));
+            ASSERTV(LINE, X.quantile(0.99),
+                    microseconds(P99) == X.quantile(0.99));
+            ASSERTV(LINE, X.quantile(1), microseconds(MAX) == X.quantile(1));
+            ASSERTV(LINE, X.quantile(0), X.quantile(0) <= X.quantile(0.5));
+
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                ASSERTV(LINE, i, buckets[i] == X.numInBucket(i));
+            }
+        }
+
+        mX.reset();
+
+        ASSERT(0                    == X.numRecorded());
+        ASSERT(bsls::TimeInterval() == X.maxLateness());
+        ASSERT(bsls::TimeInterval() == X.meanLateness());
+        ASSERT(bsls::TimeInterval() == X.quantile(0.5));
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == X.numInBucket(i));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(X.numInBucket(0));
+            ASSERT_PASS(X.numInBucket(Obj::k_NUM_BUCKETS - 1));
+            ASSERT_FAIL(X.numInBucket(-1));
+            ASSERT_FAIL(X.numInBucket(Obj::k_NUM_BUCKETS));
+
+            ASSERT_PASS(X.quantile(0));
+            ASSERT_PASS(X.quantile(1));
+            ASSERT_FAIL(X.quantile(-0.1));
+            ASSERT_FAIL(X.quantile(1.1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKETS
+        //
+        // Concerns:
+        //: 1 Non-positive values are counted in bucket 0.
+        //:
+        //: 2 A value of at least '2^(i-1)' and less than '2^i' is counted in
+        //:   bucket 'i', and values too large for the other buckets are
+        //:   counted in the last bucket.
+        //:
+        //: 3 'bucketUpperBound' returns the greatest value counted in each
+        //:   bucket.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify 'bucketIndex' for non-positive values.  (C-1)
+        //:
+        //: 2 For each bucket, verify 'bucketIndex' for the bounds of the
+        //:   bucket, and that 'bucketUpperBound' is the greatest value
+        //:   counted in the bucket.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid indices.  (C-4)
+        //
+        // Testing:
+        //   static int bucketIndex(bsls::Types::Int64 lateness);
+        //   static bsls::Types::Int64 bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUCKETS" << endl
+                          << "=======" << endl;
+
+        const Int64 MAX = bsl::numeric_limits<Int64>::max();
+        const int   N   = Obj::k_NUM_BUCKETS;
+
+        ASSERT(0 == Obj::bucketIndex(0));
+        ASSERT(0 == Obj::bucketIndex(-1));
+        ASSERT(0 == Obj::bucketIndex(bsl::numeric_limits<Int64>::min()));
+        ASSERT(0 == Obj::bucketUpperBound(0));
+
+        for (int i = 1; i < N - 1; ++i) {
+            const Int64 LOWER = static_cast<Int64>(1) << (i - 1);
+            const Int64 UPPER = (static_cast<Int64>(1) << i) - 1;
+
+            if (veryVerbose) { T_ P_(i) P_(LOWER) P(UPPER) }
+
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(UPPER));
+            ASSERTV(i, i - 1 == Obj::bucketIndex(LOWER - 1));
+            ASSERTV(i, UPPER == Obj::bucketUpperBound(i));
+        }
+
+        const Int64 LAST = static_cast<Int64>(1) << (N - 2);
+
+        ASSERT(N - 1 == Obj::bucketIndex(LAST));
+        ASSERT(N - 1 == Obj::bucketIndex(MAX));
+        ASSERT(MAX   == Obj::bucketUpperBound(N - 1));
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::bucketUpperBound(0));
+            ASSERT_PASS(Obj::bucketUpperBound(N - 1));
+            ASSERT_FAIL(Obj::bucketUpperBound(-1));
+            ASSERT_FAIL(Obj::bucketUpperBound(N));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record a few values and verify the resulting statistics.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        mX.record(10);
+        mX.record(20);
+
+        ASSERT(2                == X.numRecorded());
+        ASSERT(microseconds(20) == X.maxLateness());
+        ASSERT(microseconds(15) == X.meanLateness());
+        ASSERT(1                == X.numInBucket(4));
+        ASSERT(1                == X.numInBucket(5));
+
+        mX.reset();
+
+        ASSERT(0 == X.numRecorded());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,730 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_managedptr.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_deque.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+
+enum {
+    k_MAX_IDLE_SPINS = 64  // number of consecutive unsuccessful searches for
+                           // work a worker performs before blocking
+};
+
+}  // close unnamed namespace
+
+                    // ===================================
+                    // struct WorkStealingThreadPool_Worker
+                    // ===================================
+
+struct WorkStealingThreadPool_Worker {
+    // This component-private structure holds the state of one processing
+    // thread of a 'WorkStealingThreadPool'.
+
+    // TYPES
+    typedef WorkStealingThreadPool::Job Job;
+
+    // DATA
+    WorkStealingThreadPool_Deque  d_deque;        // local work-stealing deque
+
+    bslmt::Mutex                  d_inboxMutex;   // protects 'd_inbox'
+
+    bsl::deque<Job *>             d_inbox;        // jobs submitted from
+                                                  // outside the pool, or that
+                                                  // overflowed 'd_deque'
+
+    bsls::AtomicInt               d_inboxLength;  // number of elements in
+                                                  // 'd_inbox', used to avoid
+                                                  // locking an empty inbox
+
+    bslmt::ThreadUtil::Handle     d_handle;       // handle of the thread
+
+    WorkStealingThreadPool       *d_pool_p;       // owning pool (held, not
+                                                  // owned)
+
+    unsigned int                  d_seed;         // state of the generator
+                                                  // used to choose victims
+
+    // CREATORS
+    WorkStealingThreadPool_Worker(WorkStealingThreadPool *pool,
+                                  int                     index,
+                                  int                     dequeCapacity,
+                                  bslma::Allocator       *basicAllocator);
+        // Create the state of the worker having the specified 'index' in the
+        // specified 'pool', with a local deque of the specified
+        // 'dequeCapacity', using the specified 'basicAllocator' to supply
+        // memory.
+
+    // MANIPULATORS
+    Job *popInbox();
+        // Remove and return the oldest job in the inbox, or 0 if the inbox is
+        // empty.
+
+    void pushInbox(Job *job);
+        // Append the specified 'job' to the inbox.
+
+    unsigned int random();
+        // Return the next value of this worker's pseudo-random sequence.
+
+    void run();
+        // Execute the processing loop of the owning pool on behalf of this
+        // worker.
+};
+
+                    // -----------------------------------
+                    // struct WorkStealingThreadPool_Worker
+                    // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                 WorkStealingThreadPool *pool,
+                                 int                     index,
+                                 int                     dequeCapacity,
+                                 bslma::Allocator       *basicAllocator)
+: d_deque(dequeCapacity, basicAllocator)
+, d_inbox(basicAllocator)
+, d_inboxLength(0)
+, d_handle(bslmt::ThreadUtil::invalidHandle())
+, d_pool_p(pool)
+, d_seed(2654435761U * static_cast<unsigned int>(index + 1))
+{
+}
+
+// MANIPULATORS
+WorkStealingThreadPool_Worker::Job *WorkStealingThreadPool_Worker::popInbox()
+{
+    if (0 == d_inboxLength.loadAcquire()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_inboxMutex);
+
+    if (d_inbox.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_inbox.front();
+    d_inbox.pop_front();
+    d_inboxLength.addRelaxed(-1);
+    return job;
+}
+
+void WorkStealingThreadPool_Worker::pushInbox(Job *job)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_inboxMutex);
+
+    d_inbox.push_back(job);
+    d_inboxLength.addRelaxed(1);
+}
+
+inline
+unsigned int WorkStealingThreadPool_Worker::random()
+{
+    // xorshift32
+
+    d_seed ^= d_seed << 13;
+    d_seed ^= d_seed >> 17;
+    d_seed ^= d_seed << 5;
+    return d_seed;
+}
+
+void WorkStealingThreadPool_Worker::run()
+{
+    d_pool_p->workerThread(this);
+}
+
+}  // close package namespace
+
+extern "C" void *bdlmt_WorkStealingThreadPool_workerEntry(void *worker)
+    // Entry point for processing threads.
+{
+    static_cast<bdlmt::WorkStealingThreadPool_Worker *>(worker)->run();
+    return 0;
+}
+
+namespace bdlmt {
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_bottomPad()
+, d_elements_p(0)
+, d_mask(capacity - 1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    d_elements_p = static_cast<bsls::AtomicPointer<Job> *>(
+                               d_allocator_p->allocate(
+                                 capacity * sizeof(bsls::AtomicPointer<Job>)));
+
+    for (int i = 0; i < capacity; ++i) {
+        new (d_elements_p + i) bsls::AtomicPointer<Job>(0);
+    }
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_elements_p);
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                            const Job& functor)
+{
+    Job *job = static_cast<Job *>(d_jobPool.allocate());
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(job, &d_jobPool);
+    bslma::ConstructionUtil::construct(job, d_allocator_p, functor);
+    proctor.release();
+
+    return job;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::createJob(
+                                                bslmf::MovableRef<Job> functor)
+{
+    Job *job = static_cast<Job *>(d_jobPool.allocate());
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(job, &d_jobPool);
+    bslma::ConstructionUtil::construct(job,
+                                       d_allocator_p,
+                                       bslmf::MovableRefUtil::move(functor));
+    proctor.release();
+
+    return job;
+}
+
+void WorkStealingThreadPool::deleteJob(Job *job)
+{
+    job->~Job();
+    d_jobPool.deallocate(job);
+}
+
+int WorkStealingThreadPool::doEnqueueJob(Job *job)
+{
+    Worker *worker = static_cast<Worker *>(
+                                  bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    if (0 == worker && 0 == d_enabled.load()) {
+        deleteJob(job);
+        return -1;                                                    // RETURN
+    }
+
+    // The counters are incremented before the job is made visible so that
+    // they never underflow, and so that a worker about to block (see
+    // 'workerThread') observes the job.
+
+    d_numUnfinished.add(1);
+    d_numPending.add(1);
+
+    if (worker) {
+        if (0 != worker->d_deque.pushBottom(job)) {
+            worker->pushInbox(job);
+        }
+    }
+    else {
+        const unsigned int index = d_nextInbox.addRelaxed(1);
+        d_workers[index % d_numThreads]->pushInbox(job);
+    }
+
+    if (0 < d_numSleeping.load()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_workCond.signal();
+    }
+    return 0;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    Job *job = worker->d_deque.popBottom();
+
+    if (0 == job) {
+        job = worker->popInbox();
+    }
+
+    if (0 == job && 1 < d_numThreads) {
+        const int start = static_cast<int>(worker->random() % d_numThreads);
+
+        for (int i = 0; 0 == job && i < d_numThreads; ++i) {
+            Worker *victim = d_workers[(start + i) % d_numThreads];
+
+            if (victim == worker) {
+                continue;                                           // CONTINUE
+            }
+
+            job = victim->d_deque.steal();
+            if (0 == job) {
+                job = victim->popInbox();
+            }
+        }
+    }
+
+    if (job) {
+        d_numPending.add(-1);
+    }
+    return job;
+}
+
+void WorkStealingThreadPool::initialize(int dequeCapacity)
+{
+    // The worker threads are joined by 'stopThreads'.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    initBlockSet();
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        bslma::ManagedPtr<Worker> worker(
+                   new (*d_allocator_p) Worker(this,
+                                               i,
+                                               dequeCapacity,
+                                               d_allocator_p),
+                   d_allocator_p);
+        d_workers.push_back(worker.get());
+        worker.release();
+    }
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void WorkStealingThreadPool::initBlockSet()
+{
+    sigfillset(&d_blockSet);
+
+    static const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+    static const int SIZE =
+                        sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(&d_blockSet, synchronousSignals[i]);
+    }
+}
+#else
+void WorkStealingThreadPool::initBlockSet()
+{
+}
+#endif
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    int numRemoved = 0;
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        Worker *worker = d_workers[i];
+
+        while (Job *job = worker->d_deque.steal()) {
+            deleteJob(job);
+            ++numRemoved;
+        }
+        while (Job *job = worker->popInbox()) {
+            deleteJob(job);
+            ++numRemoved;
+        }
+    }
+
+    d_numPending.add(-numRemoved);
+    if (0 == d_numUnfinished.add(-numRemoved)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_drainCond.broadcast();
+    }
+}
+
+void WorkStealingThreadPool::runJob(Job *job)
+{
+    d_numActive.add(1);
+
+    bsls::Types::Int64 start  = bsls::TimeUtil::getTimer();
+    (*job)();
+    bsls::Types::Int64 finish = bsls::TimeUtil::getTimer();
+
+    // The job is destroyed before the completion is published, so that
+    // 'drain' does not return while bound objects are still alive.
+
+    deleteJob(job);
+
+    if (start < d_lastResetTime) {
+        d_callbackTime.add(finish - d_lastResetTime);
+    }
+    else {
+        d_callbackTime.add(finish - start);
+    }
+
+    d_numActive.add(-1);
+
+    if (0 == d_numUnfinished.add(-1)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_drainCond.broadcast();
+    }
+}
+
+int WorkStealingThreadPool::startThreads()
+{
+    BSLS_ASSERT(0 == d_numThreadsStarted);
+
+    d_running.store(1);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // block all asynchronous signals
+
+    sigset_t oldset;
+
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = 0;
+    for (int i = 0; 0 == rc && i < d_numThreads; ++i) {
+        rc = bslmt::ThreadUtil::create(
+                                     &d_workers[i]->d_handle,
+                                     d_threadAttributes,
+                                     bdlmt_WorkStealingThreadPool_workerEntry,
+                                     d_workers[i]);
+        if (0 == rc) {
+            ++d_numThreadsStarted;
+        }
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    if (0 != rc) {
+        stopThreads();
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    d_running.store(0);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_workCond.broadcast();
+    }
+
+    for (int i = 0; i < d_numThreadsStarted; ++i) {
+        bslmt::ThreadUtil::join(d_workers[i]->d_handle);
+        d_workers[i]->d_handle = bslmt::ThreadUtil::invalidHandle();
+    }
+    d_numThreadsStarted = 0;
+}
+
+void WorkStealingThreadPool::workerThread(Worker *worker)
+{
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    int numIdleSpins = 0;
+    while (d_running.load()) {
+        Job *job = findJob(worker);
+
+        if (job) {
+            numIdleSpins = 0;
+            runJob(job);
+            continue;                                               // CONTINUE
+        }
+
+        if (++numIdleSpins < k_MAX_IDLE_SPINS) {
+            bslmt::ThreadUtil::yield();
+            continue;                                               // CONTINUE
+        }
+        numIdleSpins = 0;
+
+        // Block until a job is enqueued.  'd_numSleeping' is incremented
+        // before 'd_numPending' is checked, and 'doEnqueueJob' increments
+        // 'd_numPending' before checking 'd_numSleeping', so at least one of
+        // the two threads observes the other's update and no wake-up is lost.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_numSleeping.add(1);
+        while (0 >= d_numPending.load() && d_running.load()) {
+            d_workCond.wait(&d_mutex);
+        }
+        d_numSleeping.add(-1);
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_enabled(0)
+, d_running(0)
+, d_numPending(0)
+, d_numUnfinished(0)
+, d_numActive(0)
+, d_numSleeping(0)
+, d_nextInbox(0)
+, d_threadAttributes(basicAllocator)
+, d_numThreadsStarted(0)
+, d_numThreads(numThreads)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_callbackTime(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    initialize(k_DEFAULT_DEQUE_CAPACITY);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                       const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             numThreads,
+                       bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_enabled(0)
+, d_running(0)
+, d_numPending(0)
+, d_numUnfinished(0)
+, d_numActive(0)
+, d_numSleeping(0)
+, d_nextInbox(0)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreadsStarted(0)
+, d_numThreads(numThreads)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_callbackTime(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    initialize(k_DEFAULT_DEQUE_CAPACITY);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                       const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             numThreads,
+                       int                             dequeCapacity,
+                       bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_workers(basicAllocator)
+, d_enabled(0)
+, d_running(0)
+, d_numPending(0)
+, d_numUnfinished(0)
+, d_numActive(0)
+, d_numSleeping(0)
+, d_nextInbox(0)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreadsStarted(0)
+, d_numThreads(numThreads)
+, d_lastResetTime(bsls::TimeUtil::getTimer()) // now
+, d_callbackTime(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+    BSLS_ASSERT(0 < dequeCapacity);
+    BSLS_ASSERT(0 == (dequeCapacity & (dequeCapacity - 1)));
+
+    initialize(dequeCapacity);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_allocator_p->deleteObject(d_workers[i]);
+    }
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    d_enabled.store(0);
+
+    if (0 == d_numThreadsStarted) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    while (0 < d_numUnfinished.load()) {
+        d_drainCond.wait(&d_mutex);
+    }
+}
+
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    return doEnqueueJob(createJob(functor));
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    if (!bslmf::MovableRefUtil::access(functor)) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    return doEnqueueJob(createJob(bslmf::MovableRefUtil::move(functor)));
+}
+
+double WorkStealingThreadPool::resetPercentBusy()
+{
+    bsls::Types::Int64 now           = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64 lastResetTime = d_lastResetTime.swap(now);
+    const double callbackTime = static_cast<double>(d_callbackTime.swap(0));
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    double interval = static_cast<double>(now - lastResetTime);
+    interval = 0 != interval ? interval : 1;
+
+    return 100.0 / d_numThreads * callbackTime / interval;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    // Workers stop picking up jobs before queuing is seen to be disabled.
+
+    d_running.store(0);
+    d_enabled.store(0);
+
+    if (0 != d_numThreadsStarted) {
+        stopThreads();
+    }
+    removeAllJobs();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    if (0 == d_numThreadsStarted && 0 != startThreads()) {
+        return -1;                                                    // RETURN
+    }
+
+    d_enabled.store(1);
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    d_enabled.store(0);
+
+    if (0 == d_numThreadsStarted) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        while (0 < d_numUnfinished.load()) {
+            d_drainCond.wait(&d_mutex);
+        }
+    }
+
+    stopThreads();
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    return d_numThreadsStarted;
+}
+
+double WorkStealingThreadPool::percentBusy() const
+{
+    bsls::Types::Int64 last = d_lastResetTime;
+    double interval = static_cast<double>(bsls::TimeUtil::getTimer() - last);
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    interval = 0 != interval ? interval : 1;
+
+    double ratio = static_cast<double>(d_callbackTime) / interval;
+
+    return 100.0 / d_numThreads * ratio;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,691 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads using work-stealing queues.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//  bdlmt::WorkStealingThreadPool_Deque: single-owner, multi-thief job deque
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that distributes user-defined functions
+// ("jobs") among a fixed number of processing threads without funneling every
+// job through a single, mutex-protected queue.  The pool exposes the same
+// job-submission and control surface as 'bdlmt::ThreadPool' ('enqueueJob',
+// 'start', 'drain', 'stop', 'shutdown', 'percentBusy', 'resetPercentBusy'),
+// so that clients can switch between the two pool types without rewriting
+// their callers.
+//
+///Scheduling
+///----------
+// Each processing thread ("worker") owns two job containers:
+//
+//: o A *local* deque ('bdlmt::WorkStealingThreadPool_Deque') implementing the
+//:   Chase-Lev algorithm.  Only the owning worker pushes and pops at the
+//:   bottom of this deque (with no lock and, in the common case, no atomic
+//:   read-modify-write operation), while other workers may concurrently
+//:   "steal" jobs from the top.
+//:
+//: o An *inbox*, a short mutex-protected queue that receives jobs submitted
+//:   by threads that are not workers of the pool.
+//
+// A job submitted from one of the pool's own worker threads (i.e., a job that
+// enqueues further jobs) is pushed onto that worker's local deque: this is the
+// local submission fast path.  A job submitted from any other thread is
+// placed in the inbox of a worker chosen round-robin, so that external
+// submitters contend on 'numThreads()' distinct mutexes rather than on one.
+//
+// A worker looking for work first pops from the bottom of its own deque
+// (most-recently submitted job first, which favors cache locality), then
+// drains its inbox, and finally attempts to steal from the deques and
+// inboxes of the other workers, starting at a randomly chosen victim.  A
+// worker that finds no work after a short period of spinning blocks until a
+// job is submitted.  Consequently, unlike 'bdlmt::ThreadPool', this pool does
+// *not* guarantee that jobs are started in the order they were submitted.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// A thread pool ensures that, on unix platforms, all the threads in the pool
+// block all asynchronous signals.  Specifically all the signals, except the
+// following synchronous signals are blocked:
+//..
+// SIGBUS
+// SIGFPE
+// SIGILL
+// SIGSEGV
+// SIGSYS
+// SIGABRT
+// SIGTRAP
+// SIGIOT
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Parallel Summation
+///- - - - - - - - - - - - - - - - - - - -
+// Work stealing is most effective when jobs spawn further jobs.  In this
+// example we sum the elements of an array by recursively splitting the range
+// in two and enqueuing one half as a new job, until the ranges are small
+// enough to be summed directly.
+//
+// First, we define the job, which accumulates into a shared atomic total:
+//..
+//  void sumRange(bdlmt::WorkStealingThreadPool *pool,
+//                bsls::AtomicInt64             *total,
+//                const int                     *begin,
+//                const int                     *end)
+//  {
+//      while (end - begin > 1024) {
+//          const int *middle = begin + (end - begin) / 2;
+//          pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                                pool,
+//                                                total,
+//                                                middle,
+//                                                end));
+//          end = middle;
+//      }
+//      bsls::Types::Int64 sum = 0;
+//      for (; begin != end; ++begin) {
+//          sum += *begin;
+//      }
+//      total->add(sum);
+//  }
+//..
+// Then, we create a pool of four threads and start it:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the data and submit the root job.  The jobs enqueued by
+// 'sumRange' are pushed onto the local deque of the worker executing it, from
+// which idle workers steal:
+//..
+//  bsl::vector<int> data(1 << 20, 1);
+//
+//  bsls::AtomicInt64 total(0);
+//  pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                       &pool,
+//                                       &total,
+//                                       data.data(),
+//                                       data.data() + data.size()));
+//..
+// Finally, we wait for all jobs, including those enqueued by other jobs, to
+// complete, and verify the result:
+//..
+//  pool.drain();
+//  assert(static_cast<bsls::Types::Int64>(data.size()) == total);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bdlf_bind.h>
+
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // 'sigset_t'
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+struct WorkStealingThreadPool_Worker;
+
+                    // ==================================
+                    // class WorkStealingThreadPool_Deque
+                    // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // This component-private class implements a fixed-capacity, lock-free
+    // Chase-Lev work-stealing deque of pointers.  A single "owner" thread may
+    // call 'pushBottom' and 'popBottom'; any number of other threads may
+    // concurrently call 'steal'.  Elements are removed by the owner in LIFO
+    // order and by thieves in FIFO order.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_INDEX_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                     sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64        d_top;         // index of the oldest element;
+                                            // advanced by 'steal' and by the
+                                            // owner when taking the last
+                                            // element
+
+    const char               d_topPad[k_INDEX_PADDING];
+                                            // padding to prevent false sharing
+
+    bsls::AtomicInt64        d_bottom;      // one past the index of the newest
+                                            // element; modified only by the
+                                            // owner
+
+    const char               d_bottomPad[k_INDEX_PADDING];
+                                            // padding to prevent false sharing
+
+    bsls::AtomicPointer<Job> *d_elements_p; // circular array of elements
+
+    const bsls::Types::Int64  d_mask;       // 'capacity() - 1'
+
+    bslma::Allocator         *d_allocator_p;
+                                            // memory allocator (held, not
+                                            // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool_Deque,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool_Deque(int               capacity,
+                                 bslma::Allocator *basicAllocator = 0);
+        // Create an empty deque able to hold the specified 'capacity'
+        // elements.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless '0 < capacity'
+        // and 'capacity' is a power of two.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this deque.  Note that the elements (if any) are not
+        // deleted.
+
+    // MANIPULATORS
+    Job *popBottom();
+        // Remove and return the most recently pushed element of this deque,
+        // or return 0 if this deque is empty.  The behavior is undefined
+        // unless this method is invoked by the owner thread.
+
+    int pushBottom(Job *job);
+        // Push the specified 'job' onto the bottom of this deque.  Return 0
+        // on success, and a non-zero value, with no effect, if this deque is
+        // full.  The behavior is undefined unless this method is invoked by
+        // the owner thread and '0 != job'.
+
+    Job *steal();
+        // Remove and return the least recently pushed element of this deque,
+        // or return 0 if this deque is empty or if the removal lost a race
+        // with another thread removing the same element.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements this deque can hold.
+
+    int length() const;
+        // Return a snapshot of the number of elements in this deque.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool in which each processing
+    // thread owns a work-stealing deque, used for concurrently executing
+    // multiple user-defined functions ("jobs").
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+    enum {
+        k_DEFAULT_DEQUE_CAPACITY = 4096  // default capacity of the local
+                                         // deque of each worker
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    // DATA
+    bdlma::ConcurrentPool       d_jobPool;       // pool supplying the memory
+                                                 // for enqueued 'Job' objects
+
+    bsl::vector<Worker *>       d_workers;       // per-thread state, owned
+
+    bsls::AtomicInt             d_enabled;       // 1 if enqueuing is enabled,
+                                                 // and 0 otherwise
+
+    bsls::AtomicInt             d_running;       // 1 while worker threads
+                                                 // should keep processing jobs
+
+    bsls::AtomicInt             d_numPending;    // number of enqueued jobs not
+                                                 // yet dequeued by a worker
+
+    bsls::AtomicInt             d_numUnfinished; // number of enqueued jobs not
+                                                 // yet completed
+
+    bsls::AtomicInt             d_numActive;     // number of workers currently
+                                                 // executing a job
+
+    bsls::AtomicInt             d_numSleeping;   // number of workers blocked
+                                                 // on 'd_workCond'
+
+    bsls::AtomicUint            d_nextInbox;     // round-robin inbox index for
+                                                 // external submissions
+
+    mutable bslmt::Mutex        d_metaMutex;     // serializes the control
+                                                 // methods ('start', 'stop',
+                                                 // 'drain', 'shutdown')
+
+    bslmt::Mutex                d_mutex;         // used with 'd_workCond' and
+                                                 // 'd_drainCond'
+
+    bslmt::Condition            d_workCond;      // signaled when a job is
+                                                 // enqueued or the workers
+                                                 // must exit
+
+    bslmt::Condition            d_drainCond;     // signaled when
+                                                 // 'd_numUnfinished' drops to
+                                                 // 0
+
+    bslmt::ThreadAttributes     d_threadAttributes;
+                                                 // attributes of the worker
+                                                 // threads
+
+    bslmt::ThreadUtil::Key      d_workerKey;     // thread-specific key mapping
+                                                 // a worker thread to its
+                                                 // 'Worker'
+
+    int                         d_numThreadsStarted;
+                                                 // number of running worker
+                                                 // threads (protected by
+                                                 // 'd_metaMutex')
+
+    const int                   d_numThreads;    // number of configured
+                                                 // worker threads
+
+    bsls::AtomicInt64           d_lastResetTime; // last reset time of
+                                                 // percent-busy metric in
+                                                 // nanoseconds from some
+                                                 // arbitrary but fixed point
+                                                 // in time
+
+    bsls::AtomicInt64           d_callbackTime;  // the total time spent
+                                                 // running jobs across all
+                                                 // threads, in nanoseconds
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                    d_blockSet;      // set of signals to be
+                                                 // blocked in managed threads
+#endif
+
+    bslma::Allocator           *d_allocator_p;   // memory allocator (held,
+                                                 // not owned)
+
+    // FRIENDS
+    friend struct WorkStealingThreadPool_Worker;
+
+    // PRIVATE MANIPULATORS
+    Job *createJob(const Job& functor);
+    Job *createJob(bslmf::MovableRef<Job> functor);
+        // Return the address of a newly created copy of (or, for the
+        // 'MovableRef' overload, an object moved from) the specified
+        // 'functor', allocated from 'd_jobPool'.
+
+    void deleteJob(Job *job);
+        // Destroy the specified 'job' and return its memory to 'd_jobPool'.
+
+    int doEnqueueJob(Job *job);
+        // Make the specified 'job' available to the worker threads and, if
+        // any worker is blocked waiting for work, wake one up.  Return 0 on
+        // success, and a non-zero value (having deleted 'job') if queuing is
+        // disabled.
+
+    Job *findJob(Worker *worker);
+        // Return the next job to be executed by the specified 'worker', or 0
+        // if none could be found.  The behavior is undefined unless this
+        // method is invoked from the thread of 'worker'.
+
+    void initBlockSet();
+        // Initialize the set of signals to be blocked in the managed threads.
+
+    void initialize(int dequeCapacity);
+        // Create the per-thread state of this pool, each worker having a local
+        // deque of the specified 'dequeCapacity'.  Note that this method is
+        // called by the constructors only.
+
+    void removeAllJobs();
+        // Delete all jobs that are enqueued but not started.  The behavior is
+        // undefined unless no worker thread is running.
+
+    void runJob(Job *job);
+        // Execute and then delete the specified 'job', keeping the job timing
+        // and completion statistics.
+
+    int startThreads();
+        // Spawn the worker threads.  Return 0 on success, and a non-zero value
+        // (with no threads running) otherwise.  The behavior is undefined
+        // unless 'd_metaMutex' is locked.
+
+    void stopThreads();
+        // Instruct all worker threads to exit after their current job and
+        // join them.  The behavior is undefined unless 'd_metaMutex' is
+        // locked.
+
+    void workerThread(Worker *worker);
+        // Processing thread function for the specified 'worker'.
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+    WorkStealingThreadPool(
+                       const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             numThreads,
+                       bslma::Allocator               *basicAllocator = 0);
+    WorkStealingThreadPool(
+                       const bslmt::ThreadAttributes&  threadAttributes,
+                       int                             numThreads,
+                       int                             dequeCapacity,
+                       bslma::Allocator               *basicAllocator = 0);
+        // Create a work-stealing thread pool having the specified
+        // 'numThreads' processing threads.  Optionally specify
+        // 'threadAttributes' used to create the processing threads; if not
+        // specified, default-constructed attributes are used.  Optionally
+        // specify 'dequeCapacity', the number of jobs each worker can hold in
+        // its local deque (further jobs submitted by that worker are placed in
+        // its inbox); if not specified, 'k_DEFAULT_DEQUE_CAPACITY' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numThreads' and
+        // 'dequeCapacity' is a positive power of two.  Note that the
+        // detached state of 'threadAttributes' is ignored: the processing
+        // threads are always joinable.
+
+    ~WorkStealingThreadPool();
+        // Call 'shutdown()' and destroy this thread pool.
+
+    // MANIPULATORS
+    void drain();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete.  Use 'start' to re-enable queuing.  Note that jobs
+        // executing on this pool's processing threads may still enqueue
+        // further jobs while queuing is disabled (see 'enqueueJob'), and that
+        // this method also waits for those jobs to complete.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  The behavior is undefined unless
+        // 'functor' is not "unset".  Note that if this method is called from
+        // one of this pool's processing threads, 'functor' is pushed onto that
+        // thread's local deque without acquiring any lock, and is accepted
+        // even if queuing is disabled, so that jobs that enqueue further jobs
+        // can be drained.
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    double resetPercentBusy();
+        // Atomically report the percentage of wall time spent by each thread
+        // of this thread pool executing jobs since the last reset time, and
+        // set the reset time to now.  The creation of the thread pool is
+        // considered a first reset time.  This value is calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      numThreads
+        //..
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all queued jobs, and
+        // shut down all processing threads (after all active jobs complete).
+
+    int start();
+        // Enable queuing on this thread pool and spawn 'numThreads()'
+        // processing threads if they are not already running.  Return 0 on
+        // success, and a non-zero value otherwise.  If 'numThreads()' threads
+        // were not successfully started, all threads are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    int enabled() const;
+        // Return the state (enabled or not) of the thread pool.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs that are currently queued,
+        // but not yet being processed.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by this
+        // thread pool.
+
+    double percentBusy() const;
+        // Return the percentage of wall time spent by each thread of this
+        // thread pool executing jobs since the last reset time.  The creation
+        // of the thread pool is considered a first reset time.  This value is
+        // calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      numThreads
+        //..
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// MANIPULATORS
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::popBottom()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+
+    // The sequentially consistent store of 'd_bottom' followed by the
+    // sequentially consistent load of 'd_top' orders the owner's claim against
+    // any concurrent 'steal'.
+
+    d_bottom.store(bottom);
+    const bsls::Types::Int64 top = d_top.load();
+
+    if (top > bottom) {
+        // Empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_elements_p[bottom & d_mask].loadRelaxed();
+
+    if (top == bottom) {
+        // Last element: race against thieves for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+    return job;
+}
+
+inline
+int WorkStealingThreadPool_Deque::pushBottom(Job *job)
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top > d_mask) {
+        return -1;                                                    // RETURN
+    }
+
+    d_elements_p[bottom & d_mask].storeRelaxed(job);
+    d_bottom.storeRelease(bottom + 1);
+    return 0;
+}
+
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::steal()
+{
+    const bsls::Types::Int64 top    = d_top.load();
+    const bsls::Types::Int64 bottom = d_bottom.load();
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_elements_p[top & d_mask].loadRelaxed();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+    return job;
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Deque::capacity() const
+{
+    return static_cast<int>(d_mask + 1);
+}
+
+inline
+int WorkStealingThreadPool_Deque::length() const
+{
+    const bsls::Types::Int64 length = d_bottom.load() - d_top.load();
+    return length > 0 ? static_cast<int>(length) : 0;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool::enabled() const
+{
+    return d_enabled.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActive.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    const int numPending = d_numPending.loadRelaxed();
+    return numPending > 0 ? numPending : 0;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
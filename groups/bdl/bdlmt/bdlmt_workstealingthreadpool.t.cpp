@@ -0,0 +1,1122 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_c_signal.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test consists of a Chase-Lev work-stealing deque,
+// 'bdlmt::WorkStealingThreadPool_Deque', and a fixed-size thread pool built on
+// one such deque per worker, 'bdlmt::WorkStealingThreadPool'.  The deque is
+// first tested single-threaded for its LIFO/FIFO semantics and capacity, then
+// under concurrent stealing to verify that every element is removed exactly
+// once.  The pool is tested for its control methods ('start', 'drain',
+// 'stop', 'shutdown'), for correct execution of jobs enqueued from both
+// external and worker threads, and for its busy-time metric.
+//
+// In addition to positive test cases, a negative test case -1 compares the
+// throughput of this pool with that of 'bdlmt::ThreadPool' and
+// 'bdlmt::FixedThreadPool' using 'bslmt::ThroughputBenchmark'.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] WorkStealingThreadPool_Deque(int capacity, Allocator *ba = 0);
+// [ 2] Job *popBottom();
+// [ 2] int pushBottom(Job *job);
+// [ 2] Job *steal();
+// [ 2] int capacity() const;
+// [ 2] int length() const;
+//
+// WorkStealingThreadPool
+// [ 4] WorkStealingThreadPool(int numThreads, Allocator *ba = 0);
+// [ 4] WorkStealingThreadPool(const Attributes&, int, Alloc *);
+// [ 4] WorkStealingThreadPool(const Attributes&, int, int, Alloc *);
+// [ 4] ~WorkStealingThreadPool();
+// [ 4] int start();
+// [ 4] void stop();
+// [ 4] void drain();
+// [ 4] int enqueueJob(const Job& functor);
+// [ 4] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc func, void *data);
+// [ 4] int enabled() const;
+// [ 4] int numThreads() const;
+// [ 4] int numThreadsStarted() const;
+// [ 5] void shutdown();
+// [ 5] int numPendingJobs() const;
+// [ 5] int numActiveThreads() const;
+// [ 6] double percentBusy() const;
+// [ 6] double resetPercentBusy();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT STEALING
+// [ 7] JOBS ENQUEUING JOBS
+// [ 8] SYNCHRONOUS SIGNALS
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH OTHER THREAD POOLS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef Obj::Job                            Job;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS  FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCallback(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOnBarrier(bslmt::Barrier *barrier, bsls::AtomicInt *counter)
+    // Wait on the specified 'barrier', then increment the specified
+    // 'counter'.
+{
+    barrier->wait();
+    ++*counter;
+}
+
+void sleepAndIncrement(int microseconds, bsls::AtomicInt *counter)
+    // Sleep for the specified 'microseconds', then increment the specified
+    // 'counter'.
+{
+    bslmt::ThreadUtil::microSleep(microseconds);
+    ++*counter;
+}
+
+void fanOut(Obj *pool, int depth, bsls::AtomicInt *counter)
+    // Increment the specified 'counter' and, if the specified 'depth' is
+    // positive, enqueue two further 'fanOut' jobs of depth 'depth - 1' on the
+    // specified 'pool'.
+{
+    ++*counter;
+    if (0 < depth) {
+        ASSERT(0 == pool->enqueueJob(
+                     bdlf::BindUtil::bind(&fanOut, pool, depth - 1, counter)));
+        ASSERT(0 == pool->enqueueJob(
+                     bdlf::BindUtil::bind(&fanOut, pool, depth - 1, counter)));
+    }
+}
+
+                         // ========================
+                         // struct DequeStealerState
+                         // ========================
+
+struct DequeStealerState {
+    // Shared state for the concurrent stealing test.
+
+    Deque             *d_deque_p;
+    bsls::AtomicInt   *d_taken_p;   // count of removals per element
+    bsls::AtomicInt    d_done;
+    bsls::AtomicInt    d_numStolen;
+};
+
+void stealerThread(DequeStealerState *state)
+    // Steal from the deque of the specified 'state' until it is marked done
+    // and the deque is empty, recording each element removed.
+{
+    while (true) {
+        Job *job = state->d_deque_p->steal();
+        if (job) {
+            ++state->d_numStolen;
+            ++*reinterpret_cast<bsls::AtomicInt *>(job);
+        }
+        else if (state->d_done.load() && 0 == state->d_deque_p->length()) {
+            break;
+        }
+    }
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void testSynchronousSignals(bsls::AtomicInt *counter)
+    // Verify that all the synchronous signals are unblocked in the calling
+    // thread, and that 'SIGINT' is blocked, then increment the specified
+    // 'counter'.
+{
+    sigset_t blockedSet;
+    sigemptyset(&blockedSet);
+    pthread_sigmask(SIG_BLOCK, NULL, &blockedSet);
+
+    static const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+#ifdef SIGIOT
+      SIGIOT
+#endif
+    };
+
+    int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        ASSERT(sigismember(&blockedSet, synchronousSignals[i]) == 0);
+    }
+    ASSERT(sigismember(&blockedSet, SIGINT) == 1);
+
+    ++*counter;
+}
+#endif
+
+}  // close unnamed namespace
+
+                           // ======================
+                           // namespace PERFORMANCE
+                           // ======================
+
+namespace PERFORMANCE {
+
+void busyJob(bsls::Types::Int64 amount, bslmt::Latch *latch)
+    // Perform the specified 'amount' of busy work, then arrive at the
+    // specified 'latch'.
+{
+    bslmt::ThroughputBenchmark::busyWork(amount);
+    latch->arrive();
+}
+
+template <class POOL>
+struct Submitter {
+    // This 'struct' provides the run function of a benchmark thread that
+    // submits a batch of jobs to a pool of (template parameter) type 'POOL'
+    // and waits for them to complete.
+
+    static void run(POOL               *pool,
+                    int                 batchSize,
+                    bsls::Types::Int64  jobAmount,
+                    int)
+        // Enqueue the specified 'batchSize' jobs, each performing the
+        // specified 'jobAmount' of busy work, on the specified 'pool', and
+        // wait for their completion.
+    {
+        bslmt::Latch latch(batchSize);
+        for (int i = 0; i < batchSize; ++i) {
+            pool->enqueueJob(bdlf::BindUtil::bind(&busyJob,
+                                                  jobAmount,
+                                                  &latch));
+        }
+        latch.wait();
+    }
+};
+
+template <class POOL>
+void runBenchmark(const char         *name,
+                  POOL               *pool,
+                  int                 numSubmitters,
+                  int                 batchSize,
+                  bsls::Types::Int64  jobAmount,
+                  int                 millisecondsPerSample,
+                  int                 numSamples)
+    // Run a throughput benchmark having the specified 'numSubmitters' threads
+    // that each repeatedly submit the specified 'batchSize' jobs, of the
+    // specified 'jobAmount' busy work each, to the specified started 'pool',
+    // for the specified 'numSamples' samples of the specified
+    // 'millisecondsPerSample' duration, and print a CSV line labeled with the
+    // specified 'name' holding the median batch throughput.
+{
+    bslmt::ThroughputBenchmark       benchmark;
+    bslmt::ThroughputBenchmarkResult result;
+
+    benchmark.addThreadGroup(
+                     bdlf::BindUtil::bind(&Submitter<POOL>::run,
+                                          pool,
+                                          batchSize,
+                                          jobAmount,
+                                          bdlf::PlaceHolders::_1),
+                     numSubmitters,
+                     0);
+
+    benchmark.execute(&result, millisecondsPerSample, numSamples);
+
+    double median;
+    result.getMedian(&median, 0);
+
+    cout << name            << ","
+         << numSubmitters   << ","
+         << batchSize       << ","
+         << jobAmount       << ","
+         << fixed << setprecision(0) << median * batchSize
+         << endl;
+}
+
+}  // close namespace PERFORMANCE
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Parallel Summation
+///- - - - - - - - - - - - - - - - - - - -
+// Work stealing is most effective when jobs spawn further jobs.  In this
+// example we sum the elements of an array by recursively splitting the range
+// in two and enqueuing one half as a new job, until the ranges are small
+// enough to be summed directly.
+//
+// First, we define the job, which accumulates into a shared atomic total:
+//..
+    void sumRange(bdlmt::WorkStealingThreadPool *pool,
+                  bsls::AtomicInt64             *total,
+                  const int                     *begin,
+                  const int                     *end)
+    {
+        while (end - begin > 1024) {
+            const int *middle = begin + (end - begin) / 2;
+            pool->enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                                  pool,
+                                                  total,
+                                                  middle,
+                                                  end));
+            end = middle;
+        }
+        bsls::Types::Int64 sum = 0;
+        for (; begin != end; ++begin) {
+            sum += *begin;
+        }
+        total->add(sum);
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we create a pool of four threads and start it:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the data and submit the root job.  The jobs enqueued by
+// 'sumRange' are pushed onto the local deque of the worker executing it, from
+// which idle workers steal:
+//..
+    bsl::vector<int> data(1 << 20, 1);
+
+    bsls::AtomicInt64 total(0);
+    pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                         &pool,
+                                         &total,
+                                         data.data(),
+                                         data.data() + data.size()));
+//..
+// Finally, we wait for all jobs, including those enqueued by other jobs, to
+// complete, and verify the result:
+//..
+    pool.drain();
+    ASSERT(static_cast<bsls::Types::Int64>(data.size()) == total);
+
+    pool.stop();
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // SYNCHRONOUS SIGNALS
+        //
+        // Concerns:
+        //: 1 The processing threads block all signals except the synchronous
+        //:   ones.
+        //
+        // Plan:
+        //: 1 Enqueue, from an external thread, as many jobs as there are
+        //:   workers, each inspecting the signal mask of its thread.  (C-1)
+        //
+        // Testing:
+        //   SYNCHRONOUS SIGNALS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SYNCHRONOUS SIGNALS" << endl
+                          << "===================" << endl;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+        const int NUM_THREADS = 4;
+
+        Obj mX(NUM_THREADS);
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt counter(0);
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                       &testSynchronousSignals,
+                                                       &counter)));
+        }
+        mX.stop();
+        ASSERT(NUM_THREADS == counter);
+#endif
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // JOBS ENQUEUING JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued from a processing thread (the local submission fast
+        //:   path) are all executed exactly once.
+        //:
+        //: 2 Jobs enqueued from a processing thread are accepted while the
+        //:   pool is draining, and 'drain' waits for them.
+        //:
+        //: 3 When the local deque of a worker overflows, the excess jobs are
+        //:   still executed.
+        //
+        // Plan:
+        //: 1 Using pools of various sizes and local deque capacities
+        //:   (including a capacity of 1, forcing overflow), enqueue a job that
+        //:   recursively fans out into a binary tree of jobs, drain the pool,
+        //:   and verify the number of executed jobs.  (C-1..3)
+        //
+        // Testing:
+        //   JOBS ENQUEUING JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOBS ENQUEUING JOBS" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_THREADS[] = { 1, 2, 4, 8 };
+        const int CAPACITIES[]  = { 1, 16, 4096 };
+        const int DEPTH         = 12;
+        const int EXPECTED      = (1 << (DEPTH + 1)) - 1;
+
+        for (int ti = 0; ti < 4; ++ti) {
+            for (int ci = 0; ci < 3; ++ci) {
+                if (veryVerbose) { P_(NUM_THREADS[ti]) P(CAPACITIES[ci]) }
+
+                Obj mX(bslmt::ThreadAttributes(),
+                       NUM_THREADS[ti],
+                       CAPACITIES[ci],
+                       &ta);
+                ASSERT(0 == mX.start());
+
+                bsls::AtomicInt counter(0);
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                               &mX,
+                                                               DEPTH,
+                                                               &counter)));
+                mX.drain();
+                LOOP3_ASSERT(NUM_THREADS[ti],
+                             CAPACITIES[ci],
+                             counter,
+                             EXPECTED == counter);
+                ASSERT(0 == mX.numPendingJobs());
+                mX.stop();
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // PERCENT BUSY
+        //
+        // Concerns:
+        //: 1 'percentBusy' is (approximately) 0 for an idle pool.
+        //:
+        //: 2 'percentBusy' reflects the time spent executing jobs, relative
+        //:   to the number of threads.
+        //:
+        //: 3 'resetPercentBusy' returns the current value and restarts the
+        //:   measurement.
+        //
+        // Plan:
+        //: 1 Start a pool of two threads, sleep, and verify the metric is
+        //:   small.  (C-1)
+        //:
+        //: 2 Occupy both threads with sleeping jobs for most of an interval,
+        //:   and verify the reported percentage is large.  Reset the metric
+        //:   and verify it is small again.  (C-2..3)
+        //
+        // Testing:
+        //   double percentBusy() const;
+        //   double resetPercentBusy();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERCENT BUSY" << endl
+                          << "============" << endl;
+
+        Obj mX(2);
+        ASSERT(0 == mX.start());
+
+        bslmt::ThreadUtil::microSleep(100 * 1000);
+        ASSERTV(mX.percentBusy(), mX.percentBusy() < 10.0);
+
+        mX.resetPercentBusy();
+
+        bsls::AtomicInt counter(0);
+        for (int i = 0; i < 2; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&sleepAndIncrement,
+                                                           200 * 1000,
+                                                           &counter)));
+        }
+        mX.drain();
+        ASSERT(2 == counter);
+
+        const double busy = mX.resetPercentBusy();
+        ASSERTV(busy, 50.0 < busy);
+        ASSERTV(busy, busy <= 101.0);
+
+        bslmt::ThreadUtil::microSleep(100 * 1000);
+        ASSERTV(mX.percentBusy(), mX.percentBusy() < 10.0);
+
+        mX.stop();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SHUTDOWN AND SNAPSHOT ACCESSORS
+        //
+        // Concerns:
+        //: 1 'shutdown' waits for the active jobs, cancels the pending ones,
+        //:   and stops the processing threads.
+        //:
+        //: 2 'numActiveThreads' and 'numPendingJobs' reflect the state of the
+        //:   pool.
+        //:
+        //: 3 Cancelled jobs are destroyed and their memory released.
+        //
+        // Plan:
+        //: 1 Using a pool of 'N' threads, enqueue 'N' jobs blocking on a
+        //:   barrier, wait for them to be active, and enqueue further jobs.
+        //:   Verify the accessors, then call 'shutdown' from another thread,
+        //:   release the barrier, and verify that only the blocked jobs ran.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   void shutdown();
+        //   int numPendingJobs() const;
+        //   int numActiveThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHUTDOWN AND SNAPSHOT ACCESSORS" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_THREADS = 3;
+        const int NUM_EXTRA   = 20;
+        {
+            Obj mX(NUM_THREADS, &ta);
+            ASSERT(0 == mX.start());
+
+            bslmt::Barrier  barrier(NUM_THREADS + 1);
+            bsls::AtomicInt counter(0);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnBarrier,
+                                                               &barrier,
+                                                               &counter)));
+            }
+            while (NUM_THREADS != mX.numActiveThreads()) {
+                bslmt::ThreadUtil::yield();
+            }
+            ASSERT(0 == mX.numPendingJobs());
+
+            for (int i = 0; i < NUM_EXTRA; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &counter)));
+            }
+            ASSERTV(mX.numPendingJobs(), NUM_EXTRA == mX.numPendingJobs());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &handle,
+                                  bdlf::BindUtil::bind(&Obj::shutdown, &mX)));
+
+            while (mX.enabled()) {
+                bslmt::ThreadUtil::yield();
+            }
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                           &counter)));
+
+            barrier.wait();
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERTV(counter, NUM_THREADS == counter);
+            ASSERT(0 == mX.numPendingJobs());
+            ASSERT(0 == mX.numActiveThreads());
+            ASSERT(0 == mX.numThreadsStarted());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONTROL METHODS AND EXTERNAL SUBMISSION
+        //
+        // Concerns:
+        //: 1 A pool is constructed disabled with no threads started, and
+        //:   rejects jobs.
+        //:
+        //: 2 'start' starts 'numThreads()' threads and enables queuing.
+        //:
+        //: 3 All three 'enqueueJob' overloads execute the job exactly once.
+        //:
+        //: 4 'drain' disables queuing and waits for all jobs; 'start'
+        //:   re-enables queuing without starting new threads.
+        //:
+        //: 5 'stop' waits for the pending jobs and stops the threads; the pool
+        //:   can be restarted.
+        //:
+        //: 6 All memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 For each constructor and a range of thread counts, exercise the
+        //:   control methods, enqueuing a number of jobs from the main thread
+        //:   using each overload, and verifying the counts and the accessors.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int numThreads, Allocator *ba = 0);
+        //   WorkStealingThreadPool(const Attributes&, int, Alloc *);
+        //   WorkStealingThreadPool(const Attributes&, int, int, Alloc *);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   void stop();
+        //   void drain();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc func, void *data);
+        //   int enabled() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONTROL METHODS AND EXTERNAL SUBMISSION" << endl
+                          << "=======================================" << endl;
+
+        const int NUM_JOBS = 1000;
+
+        for (int numThreads = 1; numThreads <= 6; ++numThreads) {
+            for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+                if (veryVerbose) { P_(numThreads) P(cfg) }
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+                {
+                    bslmt::ThreadAttributes attributes;
+                    attributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_DETACHED);
+
+                    Obj *objPtr = 0;
+                    switch (cfg) {
+                      case 'a': {
+                        objPtr = new (ta) Obj(numThreads, &ta);
+                      } break;
+                      case 'b': {
+                        objPtr = new (ta) Obj(attributes, numThreads, &ta);
+                      } break;
+                      case 'c': {
+                        objPtr = new (ta) Obj(attributes,
+                                              numThreads,
+                                              64,
+                                              &ta);
+                      } break;
+                    }
+                    Obj& mX = *objPtr; const Obj& X = mX;
+
+                    ASSERT(numThreads == X.numThreads());
+                    ASSERT(0          == X.numThreadsStarted());
+                    ASSERT(0          == X.enabled());
+
+                    bsls::AtomicInt counter(0);
+                    ASSERT(0 != mX.enqueueJob(
+                                bdlf::BindUtil::bind(&increment, &counter)));
+
+                    ASSERT(0          == mX.start());
+                    ASSERT(numThreads == X.numThreadsStarted());
+                    ASSERT(0          != X.enabled());
+
+                    for (int i = 0; i < NUM_JOBS; ++i) {
+                        switch (i % 3) {
+                          case 0: {
+                            Job job = bdlf::BindUtil::bind(&increment,
+                                                           &counter);
+                            ASSERT(0 == mX.enqueueJob(job));
+                          } break;
+                          case 1: {
+                            Job job = bdlf::BindUtil::bind(&increment,
+                                                           &counter);
+                            ASSERT(0 == mX.enqueueJob(
+                                          bslmf::MovableRefUtil::move(job)));
+                          } break;
+                          case 2: {
+                            ASSERT(0 == mX.enqueueJob(&incrementCallback,
+                                                      &counter));
+                          } break;
+                        }
+                    }
+
+                    mX.drain();
+                    ASSERTV(counter, NUM_JOBS == counter);
+                    ASSERT(0          == X.enabled());
+                    ASSERT(numThreads == X.numThreadsStarted());
+                    ASSERT(0 != mX.enqueueJob(
+                                bdlf::BindUtil::bind(&increment, &counter)));
+
+                    ASSERT(0 == mX.start());
+                    ASSERT(numThreads == X.numThreadsStarted());
+                    for (int i = 0; i < NUM_JOBS; ++i) {
+                        ASSERT(0 == mX.enqueueJob(&incrementCallback,
+                                                  &counter));
+                    }
+                    mX.stop();
+                    ASSERTV(counter, 2 * NUM_JOBS == counter);
+                    ASSERT(0 == X.enabled());
+                    ASSERT(0 == X.numThreadsStarted());
+
+                    ASSERT(0 == mX.start());
+                    ASSERT(numThreads == X.numThreadsStarted());
+                    ASSERT(0 == mX.enqueueJob(&incrementCallback, &counter));
+
+                    ta.deleteObject(objPtr);
+                    ASSERTV(counter, 2 * NUM_JOBS + 1 >= counter);
+                }
+                ASSERT(0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT STEALING
+        //
+        // Concerns:
+        //: 1 When the owner pushes and pops while other threads steal, every
+        //:   element is removed exactly once.
+        //
+        // Plan:
+        //: 1 Use the addresses of a set of counters as the elements.  Start a
+        //:   number of stealer threads; in the main thread, repeatedly push a
+        //:   burst of elements and pop some of them.  When done, verify that
+        //:   each counter has been incremented exactly once.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT STEALING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT STEALING" << endl
+                          << "===================" << endl;
+
+        const int NUM_ELEMENTS = 200000;
+        const int NUM_STEALERS = 3;
+
+        bsl::vector<bsls::AtomicInt> taken(NUM_ELEMENTS);
+
+        Deque mX(256);
+
+        DequeStealerState state;
+        state.d_deque_p = &mX;
+        state.d_taken_p = taken.data();
+        state.d_done    = 0;
+        state.d_numStolen = 0;
+
+        bslmt::ThreadGroup stealers;
+        stealers.addThreads(bdlf::BindUtil::bind(&stealerThread, &state),
+                            NUM_STEALERS);
+
+        int numPopped = 0;
+        int next      = 0;
+        while (next < NUM_ELEMENTS) {
+            const int burst = 1 + next % 37;
+            for (int i = 0; i < burst && next < NUM_ELEMENTS; ++i) {
+                Job *element = reinterpret_cast<Job *>(&taken[next]);
+                if (0 == mX.pushBottom(element)) {
+                    ++next;
+                }
+            }
+            for (int i = 0; i < burst / 2; ++i) {
+                Job *job = mX.popBottom();
+                if (job) {
+                    ++numPopped;
+                    ++*reinterpret_cast<bsls::AtomicInt *>(job);
+                }
+            }
+        }
+        while (Job *job = mX.popBottom()) {
+            ++numPopped;
+            ++*reinterpret_cast<bsls::AtomicInt *>(job);
+        }
+        state.d_done = 1;
+        stealers.joinAll();
+
+        if (verbose) { P_(numPopped) P(state.d_numStolen) }
+
+        ASSERTV(numPopped + state.d_numStolen,
+                NUM_ELEMENTS == numPopped + state.d_numStolen);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            ASSERTV(i, taken[i], 1 == taken[i]);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEQUE SINGLE-THREADED BEHAVIOR
+        //
+        // Concerns:
+        //: 1 A new deque is empty and has the requested capacity.
+        //:
+        //: 2 'popBottom' returns elements in LIFO order and 'steal' in FIFO
+        //:   order; both return 0 on an empty deque.
+        //:
+        //: 3 'pushBottom' fails, with no effect, on a full deque.
+        //:
+        //: 4 The deque behaves correctly as its indices wrap around.
+        //:
+        //: 5 All memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 For a set of capacities, fill the deque, verify the full
+        //:   condition, and remove the elements alternating 'popBottom' and
+        //:   'steal', verifying the order.  Repeat many times so the indices
+        //:   wrap.  (C-1..5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(int capacity, Allocator *ba = 0);
+        //   Job *popBottom();
+        //   int pushBottom(Job *job);
+        //   Job *steal();
+        //   int capacity() const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEQUE SINGLE-THREADED BEHAVIOR" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Job jobs[64];
+
+        for (int capacity = 1; capacity <= 64; capacity *= 2) {
+            {
+                Deque mX(capacity, &ta); const Deque& X = mX;
+
+                ASSERT(capacity == X.capacity());
+                ASSERT(0        == X.length());
+                ASSERT(0        == mX.popBottom());
+                ASSERT(0        == mX.steal());
+                ASSERT(0        <  ta.numBlocksInUse());
+
+                for (int round = 0; round < 3 * 64 + 1; ++round) {
+                    for (int i = 0; i < capacity; ++i) {
+                        ASSERT(0 == mX.pushBottom(&jobs[i]));
+                        ASSERT(i + 1 == X.length());
+                    }
+                    ASSERT(0 != mX.pushBottom(&jobs[0]));
+                    ASSERT(capacity == X.length());
+
+                    int bottom = capacity - 1;
+                    int top    = 0;
+                    while (top <= bottom) {
+                        if (round % 2) {
+                            LOOP2_ASSERT(capacity, round,
+                                         &jobs[bottom] == mX.popBottom());
+                            --bottom;
+                        }
+                        else {
+                            LOOP2_ASSERT(capacity, round,
+                                         &jobs[top] == mX.steal());
+                            ++top;
+                        }
+                        if (top <= bottom) {
+                            LOOP2_ASSERT(capacity, round,
+                                         &jobs[top] == mX.steal());
+                            ++top;
+                        }
+                    }
+                    ASSERT(0 == X.length());
+                    ASSERT(0 == mX.popBottom());
+                    ASSERT(0 == mX.steal());
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue a few jobs, and stop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsls::AtomicInt counter(0);
+
+        Obj mX(4);
+        ASSERT(0 == mX.start());
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                           &counter)));
+        }
+        mX.stop();
+        ASSERT(100 == counter);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH OTHER THREAD POOLS
+        //
+        // Concerns:
+        //: 1 Compare the job throughput of 'bdlmt::WorkStealingThreadPool'
+        //:   with that of 'bdlmt::ThreadPool' and 'bdlmt::FixedThreadPool'.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', run a group of submitter
+        //:   threads, each repeatedly enqueuing a batch of short jobs and
+        //:   waiting for their completion, against each pool type.  Print one
+        //:   CSV line per configuration:
+        //:   'pool,submitters,batchSize,jobAmount,jobsPerSecond'.
+        //:
+        //: 2 The number of pool threads, the maximum number of submitters,
+        //:   and the busy work per job may be specified as the arguments 3, 4,
+        //:   and 5 on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH OTHER THREAD POOLS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE COMPARISON WITH OTHER THREAD POOLS"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        using namespace PERFORMANCE;
+
+        // Measure with the allocator production code would use.
+
+        bslma::DefaultAllocatorGuard perfGuard(
+                                     &bslma::NewDeleteAllocator::singleton());
+
+        const int numThreads    = argc > 3 ? atoi(argv[3]) : 8;
+        const int maxSubmitters = argc > 4 ? atoi(argv[4]) : 8;
+        const bsls::Types::Int64 jobAmount =
+                                           argc > 5 ? atoi(argv[5]) : 10;
+
+        const int BATCH_SIZE   = 256;
+        const int MILLISECONDS = 200;
+        const int NUM_SAMPLES  = 5;
+
+        cout << "pool,submitters,batchSize,jobAmount,jobsPerSecond" << endl;
+
+        for (int numSubmitters = 1;
+             numSubmitters <= maxSubmitters;
+             numSubmitters *= 2) {
+            {
+                bdlmt::ThreadPool pool(bslmt::ThreadAttributes(),
+                                       numThreads,
+                                       numThreads,
+                                       1000);
+                pool.start();
+                runBenchmark("ThreadPool",
+                             &pool,
+                             numSubmitters,
+                             BATCH_SIZE,
+                             jobAmount,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+                pool.stop();
+            }
+            {
+                bdlmt::FixedThreadPool pool(numThreads,
+                                            BATCH_SIZE * numSubmitters);
+                pool.start();
+                runBenchmark("FixedThreadPool",
+                             &pool,
+                             numSubmitters,
+                             BATCH_SIZE,
+                             jobAmount,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+                pool.stop();
+            }
+            {
+                bdlmt::WorkStealingThreadPool pool(numThreads);
+                pool.start();
+                runBenchmark("WorkStealingThreadPool",
+                             &pool,
+                             numSubmitters,
+                             BATCH_SIZE,
+                             jobAmount,
+                             MILLISECONDS,
+                             NUM_SAMPLES);
+                pool.stop();
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
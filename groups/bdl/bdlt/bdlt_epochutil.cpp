@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlt_epochutil_cpp,"$Id$ $CSID$")
 
+#include <bdlt_timeunitratio.h>
+
 namespace BloombergLP {
 namespace bdlt {
 
@@ -30,6 +32,119 @@ const EpochUtil::TimeT64 EpochUtil::s_earliestAsTimeT64 = -62135769600LL;
 const EpochUtil::TimeT64 EpochUtil::s_latestAsTimeT64   = 253402300799LL;
                                                  // December  31, 9999 23:59:59
 
+// CLASS METHODS
+
+                           // Batch Methods
+
+int EpochUtil::convertFromTimeT64(Datetime      *results,
+                                  const TimeT64 *times,
+                                  bsl::size_t    numTimes)
+{
+    BSLS_ASSERT(results || 0 == numTimes);
+    BSLS_ASSERT(times   || 0 == numTimes);
+
+    // Validate all of 'times' before loading any result.  Note that this loop
+    // has no early exit, so that it can be vectorized.
+
+    TimeT64 minTime = 0;
+    TimeT64 maxTime = 0;
+
+    for (bsl::size_t i = 0; i < numTimes; ++i) {
+        minTime = times[i] < minTime ? times[i] : minTime;
+        maxTime = times[i] > maxTime ? times[i] : maxTime;
+    }
+
+    if (minTime < s_earliestAsTimeT64 || maxTime > s_latestAsTimeT64) {
+        return 1;                                                     // RETURN
+    }
+
+    const Datetime epochDatetime(epoch());
+
+    for (bsl::size_t i = 0; i < numTimes; ++i) {
+        results[i] = epochDatetime;
+        results[i].addSeconds(times[i]);
+    }
+
+    return 0;
+}
+
+void EpochUtil::convertToTimeT64(TimeT64        *results,
+                                 const Datetime *datetimes,
+                                 bsl::size_t     numDatetimes)
+{
+    BSLS_ASSERT(results   || 0 == numDatetimes);
+    BSLS_ASSERT(datetimes || 0 == numDatetimes);
+
+    const Datetime epochDatetime(epoch());
+
+    for (bsl::size_t i = 0; i < numDatetimes; ++i) {
+        const bsls::Types::Int64 microseconds =
+                          (datetimes[i] - epochDatetime).totalMicroseconds();
+
+        // Round toward negative infinity, as does dropping the fractional
+        // seconds of 'datetimes[i]'.
+
+        const bsls::Types::Int64 remainder =
+                                    microseconds % TimeUnitRatio::k_US_PER_S;
+
+        results[i] = microseconds / TimeUnitRatio::k_US_PER_S
+                                                            - (remainder < 0);
+    }
+}
+
+int EpochUtil::convertFromMicroseconds(
+                                    Datetime                 *results,
+                                    const bsls::Types::Int64 *microseconds,
+                                    bsl::size_t               numMicroseconds)
+{
+    BSLS_ASSERT(results      || 0 == numMicroseconds);
+    BSLS_ASSERT(microseconds || 0 == numMicroseconds);
+
+    const bsls::Types::Int64 k_EARLIEST =
+                         s_earliestAsTimeT64 * TimeUnitRatio::k_US_PER_S;
+    const bsls::Types::Int64 k_LATEST   =
+                         s_latestAsTimeT64   * TimeUnitRatio::k_US_PER_S
+                                             + TimeUnitRatio::k_US_PER_S - 1;
+
+    // Validate all of 'microseconds' before loading any result.  Note that
+    // this loop has no early exit, so that it can be vectorized.
+
+    bsls::Types::Int64 minValue = 0;
+    bsls::Types::Int64 maxValue = 0;
+
+    for (bsl::size_t i = 0; i < numMicroseconds; ++i) {
+        minValue = microseconds[i] < minValue ? microseconds[i] : minValue;
+        maxValue = microseconds[i] > maxValue ? microseconds[i] : maxValue;
+    }
+
+    if (minValue < k_EARLIEST || maxValue > k_LATEST) {
+        return 1;                                                     // RETURN
+    }
+
+    const Datetime epochDatetime(epoch());
+
+    for (bsl::size_t i = 0; i < numMicroseconds; ++i) {
+        results[i] = epochDatetime;
+        results[i].addMicroseconds(microseconds[i]);
+    }
+
+    return 0;
+}
+
+void EpochUtil::convertToMicroseconds(bsls::Types::Int64 *results,
+                                      const Datetime     *datetimes,
+                                      bsl::size_t         numDatetimes)
+{
+    BSLS_ASSERT(results   || 0 == numDatetimes);
+    BSLS_ASSERT(datetimes || 0 == numDatetimes);
+
+    const Datetime epochDatetime(epoch());
+
+    for (bsl::size_t i = 0; i < numDatetimes; ++i) {
+        results[i] = (datetimes[i] - epochDatetime).totalMicroseconds();
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -51,6 +51,18 @@ BSLS_IDENT("$Id: $")
 // Reference Systems Service, but simply regard each day as having a fixed
 // number of seconds (24 hours * 60 minutes per hour * 60 seconds per minute).
 //
+///Batch Conversions
+///-----------------
+// Overloads of 'convertFromTimeT64' and 'convertToTimeT64', and the
+// 'convertFromMicroseconds' and 'convertToMicroseconds' methods, convert
+// arrays of values (e.g., the columns of a table) between 'bdlt::Datetime' and
+// seconds (respectively, microseconds) from the epoch.  These batch methods
+// produce exactly the same values as converting each element with the
+// corresponding scalar method, but validate their whole input once, up front,
+// in a loop free of early exits, and look up the epoch once per call.  A batch
+// conversion from the epoch either converts every element, or fails with no
+// effect on its results.
+//
 ///Thread Safety
 ///-------------
 // It is safe to invoke any function defined in this component in two or more
@@ -137,6 +149,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>        // 'Int64', 'Uint64'
 
+#include <bsl_cstddef.h>       // 'bsl::size_t'
 #include <bsl_ctime.h>         // 'bsl::time_t'
 
 namespace BloombergLP {
@@ -295,6 +308,58 @@ struct EpochUtil {
         // Return, as a 'DatetimeInterval', the relative time computed as the
         // difference between the specified absolute 'datetime' and the epoch.
 
+                           // Batch Methods
+
+    static int convertFromTimeT64(Datetime      *results,
+                                  const TimeT64 *times,
+                                  bsl::size_t    numTimes);
+        // Load into each element of the specified 'results' array the
+        // absolute datetime computed as the sum of the corresponding element
+        // of the specified 'times' array, having the specified 'numTimes'
+        // elements, and the epoch.  Return 0 on success, and a non-zero value
+        // (with no effect on 'results') if any element of 'times' cannot be
+        // represented as a 'Datetime'.  The behavior is undefined unless
+        // 'results' and 'times' each refer to an array of at least 'numTimes'
+        // elements.  Note that 'results[i]' has the same value as
+        // 'convertFromTimeT64(times[i])' for each index 'i' in
+        // '[0 .. numTimes - 1]'.
+
+    static void convertToTimeT64(TimeT64        *results,
+                                 const Datetime *datetimes,
+                                 bsl::size_t     numDatetimes);
+        // Load into each element of the specified 'results' array the
+        // relative time computed as the difference between the corresponding
+        // element of the specified 'datetimes' array, having the specified
+        // 'numDatetimes' elements, and the epoch.  The behavior is undefined
+        // unless 'results' and 'datetimes' each refer to an array of at least
+        // 'numDatetimes' elements.  Note that 'results[i]' has the same value
+        // as 'convertToTimeT64(datetimes[i])' for each index 'i' in
+        // '[0 .. numDatetimes - 1]'.
+
+    static int convertFromMicroseconds(
+                                   Datetime                 *results,
+                                   const bsls::Types::Int64 *microseconds,
+                                   bsl::size_t               numMicroseconds);
+        // Load into each element of the specified 'results' array the
+        // absolute datetime computed as the sum of the number of microseconds
+        // indicated by the corresponding element of the specified
+        // 'microseconds' array, having the specified 'numMicroseconds'
+        // elements, and the epoch.  Return 0 on success, and a non-zero value
+        // (with no effect on 'results') if any element of 'microseconds'
+        // cannot be represented as a 'Datetime'.  The behavior is undefined
+        // unless 'results' and 'microseconds' each refer to an array of at
+        // least 'numMicroseconds' elements.
+
+    static void convertToMicroseconds(bsls::Types::Int64 *results,
+                                      const Datetime     *datetimes,
+                                      bsl::size_t         numDatetimes);
+        // Load into each element of the specified 'results' array the number
+        // of microseconds of the relative time computed as the difference
+        // between the corresponding element of the specified 'datetimes'
+        // array, having the specified 'numDatetimes' elements, and the epoch.
+        // The behavior is undefined unless 'results' and 'datetimes' each
+        // refer to an array of at least 'numDatetimes' elements.
+
     // DEPRECATED CLASS METHODS
     static int convertToTimeInterval(bsls::TimeInterval *result,
                                      const Datetime&     datetime);
@@ -54,8 +54,12 @@ using namespace bsl;
 // [ 5] void convertFromDatetimeInterval(Dt *result, const DtI& dtI);
 // [ 5] DtI convertToDatetimeInterval(const Dt& dt);
 // [ 5] int convertToDatetimeInterval(DtI *result, const Dt& dt);
+// [ 7] int convertFromTimeT64(Dt *r, const TimeT64 *t, size_t n);
+// [ 7] void convertToTimeT64(TimeT64 *r, const Dt *dt, size_t n);
+// [ 7] int convertFromMicroseconds(Dt *r, const Int64 *us, size_t n);
+// [ 7] void convertToMicroseconds(Int64 *r, const Dt *dt, size_t n);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 6] DRQS 100907184
 
 // ============================================================================
@@ -202,7 +206,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -291,6 +295,282 @@ int main(int argc, char *argv[])
     ASSERT(inputDatetimeInterval == outputDatetimeInterval);
 //..
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // BATCH METHODS
+        //   Ensure that the batch conversion methods produce the same results
+        //   as their scalar counterparts.
+        //
+        // Concerns:
+        //: 1 Each element converted by a batch method has the same value as
+        //:   that obtained from the corresponding scalar method, including for
+        //:   datetimes (and relative times) prior to the epoch having
+        //:   non-zero fractional seconds.
+        //:
+        //: 2 The batch methods from relative times accept exactly the range
+        //:   of values that can be represented as a 'Datetime', and a single
+        //:   out-of-range element results in a non-zero status with no effect
+        //:   on any of the results.
+        //:
+        //: 3 The batch methods convert exactly the specified number of
+        //:   elements, and accept a 0 number of elements with null arrays.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of datetime
+        //:   values including the extremes of the valid range, a default
+        //:   constructed value, and values prior to the epoch with non-zero
+        //:   millisecond and microsecond fields.  Convert the whole table to
+        //:   seconds and microseconds, and back, with the batch methods, and
+        //:   verify each element against the scalar methods.  (C-1)
+        //:
+        //: 2 Invoke the batch methods from relative times on arrays whose
+        //:   last element is just inside, and then just outside, the valid
+        //:   range, and verify the status and the results.  (C-2)
+        //:
+        //: 3 Invoke the batch methods on arrays whose elements past the
+        //:   specified number of elements hold sentinel values, and verify
+        //:   that the sentinels are unchanged.  Invoke the batch methods with
+        //:   0 elements and null arrays.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values, but not triggered for
+        //:   adjacent valid ones (using the 'BSLS_ASSERTTEST_*' macros).
+        //:   (C-4)
+        //
+        // Testing:
+        //   int convertFromTimeT64(Dt *r, const TimeT64 *t, size_t n);
+        //   void convertToTimeT64(TimeT64 *r, const Dt *dt, size_t n);
+        //   int convertFromMicroseconds(Dt *r, const Int64 *us, size_t n);
+        //   void convertToMicroseconds(Int64 *r, const Dt *dt, size_t n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH METHODS" << endl
+                          << "=============" << endl;
+
+        static const struct {
+            int d_line;
+            int d_year;
+            int d_month;
+            int d_day;
+            int d_hour;
+            int d_minute;
+            int d_second;
+            int d_millisecond;
+            int d_microsecond;
+        } DATA[] = {
+            //LINE  YEAR  MO  DAY  HR  MI  SE   MSEC   USEC
+            //----  ----  --  ---  --  --  --   ----   ----
+            { L_,      1,  1,   1,  0,  0,  0,     0,     0 },
+            { L_,      1,  1,   1,  0,  0,  0,     0,     1 },
+            { L_,      1,  1,   1, 24,  0,  0,     0,     0 },
+            { L_,   1752,  9,   2, 23, 59, 59,   999,   999 },
+            { L_,   1752,  9,  14,  0,  0,  0,     0,     0 },
+            { L_,   1963,  5,  18, 11,  9,  1,     1,     1 },
+            { L_,   1969, 12,  31, 23, 59, 59,     0,     0 },
+            { L_,   1969, 12,  31, 23, 59, 59,     0,     1 },
+            { L_,   1969, 12,  31, 23, 59, 59,   999,   999 },
+            { L_,   1970,  1,   1,  0,  0,  0,     0,     0 },
+            { L_,   1970,  1,   1,  0,  0,  0,     0,     1 },
+            { L_,   1970,  1,   1,  0,  0,  0,   999,   999 },
+            { L_,   2038,  1,  19,  3, 14,  8,   500,     0 },
+            { L_,   9999, 12,  31, 23, 59, 59,   999,   999 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        enum { k_MAX_DATA = 16 };
+
+        ASSERT(NUM_DATA <= k_MAX_DATA);
+
+        if (verbose) cout << "\nCompare with scalar methods." << endl;
+        {
+            bdlt::Datetime datetimes[k_MAX_DATA];
+            Int64          seconds[k_MAX_DATA];
+            Int64          microseconds[k_MAX_DATA];
+            bdlt::Datetime fromSeconds[k_MAX_DATA];
+            bdlt::Datetime fromMicroseconds[k_MAX_DATA];
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                datetimes[ti].setDatetime(DATA[ti].d_year,
+                                          DATA[ti].d_month,
+                                          DATA[ti].d_day,
+                                          DATA[ti].d_hour,
+                                          DATA[ti].d_minute,
+                                          DATA[ti].d_second,
+                                          DATA[ti].d_millisecond,
+                                          DATA[ti].d_microsecond);
+            }
+
+            // A default-constructed 'Datetime' is also valid input.
+
+            const int NUM_DATETIMES = NUM_DATA + 1;
+
+            datetimes[NUM_DATA] = bdlt::Datetime();
+
+            Util::convertToTimeT64(seconds, datetimes, NUM_DATETIMES);
+            Util::convertToMicroseconds(microseconds,
+                                        datetimes,
+                                        NUM_DATETIMES);
+
+            ASSERT(0 == Util::convertFromTimeT64(fromSeconds,
+                                                 seconds,
+                                                 NUM_DATETIMES));
+            ASSERT(0 == Util::convertFromMicroseconds(fromMicroseconds,
+                                                      microseconds,
+                                                      NUM_DATETIMES));
+
+            for (int ti = 0; ti < NUM_DATETIMES; ++ti) {
+                const int            LINE = ti < NUM_DATA ? DATA[ti].d_line
+                                                          : L_;
+                const bdlt::Datetime X    = datetimes[ti];
+
+                if (veryVerbose) { T_ P_(LINE) P(X) }
+
+                const Int64 EXP_SECONDS = Util::convertToTimeT64(X);
+                const Int64 EXP_US      =
+                       Util::convertToDatetimeInterval(X).totalMicroseconds();
+
+                ASSERTV(LINE, EXP_SECONDS, seconds[ti],
+                        EXP_SECONDS == seconds[ti]);
+                ASSERTV(LINE, EXP_US, microseconds[ti],
+                        EXP_US == microseconds[ti]);
+
+                ASSERTV(LINE, fromSeconds[ti],
+                        Util::convertFromTimeT64(EXP_SECONDS) ==
+                                                             fromSeconds[ti]);
+
+                bdlt::Datetime expDatetime(X);
+                expDatetime.setHour(X.hour() % 24);
+
+                ASSERTV(LINE, expDatetime, fromMicroseconds[ti],
+                        expDatetime == fromMicroseconds[ti]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting the valid range." << endl;
+        {
+            const Int64 EARLIEST = Util::convertToTimeT64(
+                                             bdlt::Datetime(1, 1, 1));
+            const Int64 LATEST   = Util::convertToTimeT64(
+                                  bdlt::Datetime(9999, 12, 31, 23, 59, 59));
+
+            const Int64 EARLIEST_US = EARLIEST * 1000000;
+            const Int64 LATEST_US   = LATEST   * 1000000 + 999999;
+
+            const bdlt::Datetime SENTINEL(2000, 1, 2, 3, 4, 5);
+
+            Int64          seconds[]      = { 0, EARLIEST, LATEST };
+            Int64          microseconds[] = { 0, EARLIEST_US, LATEST_US };
+            bdlt::Datetime results[3];
+
+            ASSERT(0 == Util::convertFromTimeT64(results, seconds, 3));
+            ASSERT(bdlt::Datetime(   1,  1,  1)                 == results[1]);
+            ASSERT(bdlt::Datetime(9999, 12, 31, 23, 59, 59)     == results[2]);
+
+            ASSERT(0 == Util::convertFromMicroseconds(results,
+                                                      microseconds,
+                                                      3));
+            ASSERT(bdlt::Datetime(   1,  1,  1)                 == results[1]);
+            ASSERT(bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999)
+                                                                == results[2]);
+
+            for (int i = 1; i < 3; ++i) {
+                const Int64 DELTA = 1 == i ? -1 : 1;
+
+                for (int j = 0; j < 3; ++j) {
+                    results[j] = SENTINEL;
+                }
+
+                seconds[i] += DELTA;
+                ASSERTV(i, 0 != Util::convertFromTimeT64(results, seconds, 3));
+                seconds[i] -= DELTA;
+
+                microseconds[i] += DELTA;
+                ASSERTV(i, 0 != Util::convertFromMicroseconds(results,
+                                                              microseconds,
+                                                              3));
+                microseconds[i] -= DELTA;
+
+                for (int j = 0; j < 3; ++j) {
+                    ASSERTV(i, j, results[j], SENTINEL == results[j]);
+                }
+            }
+
+            // Values far outside the range must not overflow.
+
+            seconds[1] = bsl::numeric_limits<Int64>::min();
+            ASSERT(0 != Util::convertFromTimeT64(results, seconds, 3));
+
+            microseconds[2] = bsl::numeric_limits<Int64>::max();
+            ASSERT(0 != Util::convertFromMicroseconds(results,
+                                                      microseconds,
+                                                      3));
+        }
+
+        if (verbose) cout << "\nTesting the number of elements." << endl;
+        {
+            const Int64          SENTINEL = -17;
+            const bdlt::Datetime SENTINEL_DATETIME(2000, 1, 2);
+
+            bdlt::Datetime datetimes[] = { bdlt::Datetime(1970, 1, 2),
+                                           SENTINEL_DATETIME };
+            Int64          values[]    = { SENTINEL, SENTINEL };
+
+            Util::convertToTimeT64(values, datetimes, 1);
+            ASSERT(   86400 == values[0]);
+            ASSERT(SENTINEL == values[1]);
+
+            Util::convertToMicroseconds(values, datetimes, 1);
+            ASSERT(86400000000LL == values[0]);
+            ASSERT(     SENTINEL == values[1]);
+
+            // The out-of-range 'SENTINEL' microseconds are not converted.
+
+            values[0] = 0;
+            values[1] = bsl::numeric_limits<Int64>::min();
+
+            ASSERT(0 == Util::convertFromTimeT64(datetimes, values, 1));
+            ASSERT(Util::epoch()     == datetimes[0]);
+            ASSERT(SENTINEL_DATETIME == datetimes[1]);
+
+            datetimes[0] = SENTINEL_DATETIME;
+
+            ASSERT(0 == Util::convertFromMicroseconds(datetimes, values, 1));
+            ASSERT(Util::epoch()     == datetimes[0]);
+            ASSERT(SENTINEL_DATETIME == datetimes[1]);
+
+            ASSERT(0 == Util::convertFromTimeT64(0, 0, 0));
+            ASSERT(0 == Util::convertFromMicroseconds(0, 0, 0));
+            Util::convertToTimeT64(0, 0, 0);
+            Util::convertToMicroseconds(0, 0, 0);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlt::Datetime datetimes[1];
+            Int64          values[1] = { 0 };
+
+            ASSERT_PASS(Util::convertFromTimeT64(datetimes, values, 1));
+            ASSERT_FAIL(Util::convertFromTimeT64(        0, values, 1));
+            ASSERT_FAIL(Util::convertFromTimeT64(datetimes,      0, 1));
+
+            ASSERT_PASS(Util::convertToTimeT64(values, datetimes, 1));
+            ASSERT_FAIL(Util::convertToTimeT64(     0, datetimes, 1));
+            ASSERT_FAIL(Util::convertToTimeT64(values,         0, 1));
+
+            ASSERT_PASS(Util::convertFromMicroseconds(datetimes, values, 1));
+            ASSERT_FAIL(Util::convertFromMicroseconds(        0, values, 1));
+            ASSERT_FAIL(Util::convertFromMicroseconds(datetimes,      0, 1));
+
+            ASSERT_PASS(Util::convertToMicroseconds(values, datetimes, 1));
+            ASSERT_FAIL(Util::convertToMicroseconds(     0, datetimes, 1));
+            ASSERT_FAIL(Util::convertToMicroseconds(values,         0, 1));
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // DRQS 100907184
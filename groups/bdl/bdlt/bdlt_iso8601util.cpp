@@ -20,6 +20,23 @@ namespace BloombergLP {
 namespace bdlt {
 namespace {
 
+// CONSTANTS
+
+static const char k_DIGIT_PAIRS[] =
+    // The two-character decimal representations of the values 0 through 99,
+    // in order.
+
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 // STATIC HELPER FUNCTIONS
 
 static
@@ -401,6 +418,282 @@ int parseZoneDesignator(const char **nextPos,
     return 0;
 }
 
+static
+int parseDatetime(int                *year,
+                  int                *month,
+                  int                *day,
+                  int                *hour,
+                  int                *minute,
+                  int                *second,
+                  int                *millisecond,
+                  bsls::Types::Int64 *microsecond,
+                  bool               *hasLeapSecond,
+                  int                *tzOffset,
+                  const char         *string,
+                  int                 length)
+    // Parse the datetime, represented in the
+    // "YYYY-MM-DDThh:mm:ss[.s+][Z|(+|-)hh[:]mm]" ISO 8601 extended format, in
+    // the specified 'string' having the specified 'length', and load into the
+    // specified 'year', 'month', 'day', 'hour', 'minute', 'second',
+    // 'millisecond', 'microsecond', 'hasLeapSecond', and 'tzOffset' their
+    // respective parsed values as described for 'parseDate', 'parseTime', and
+    // 'parseZoneDesignator'.  Return 0 on success, and a non-zero value
+    // otherwise.  The behavior is undefined unless '0 <= length'.  Note that
+    // the entire 'string' must be consumed and that the date and time fields
+    // are not validated.
+{
+    BSLS_ASSERT(string);
+    BSLS_ASSERT(0 <= length);
+
+    enum { k_MINIMUM_LENGTH = sizeof "YYYY-MM-DDThh:mm:ss" - 1 };
+
+    if (length < k_MINIMUM_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *p   = string;
+    const char *end = string + length;
+
+    // 1. Parse date.
+
+    if (0 != parseDate(&p, year, month, day, p, end)
+     || p == end
+     || ('T' != *p && 't' != *p)) {
+
+        return -1;                                                    // RETURN
+    }
+    ++p;  // skip 'T' or 't'
+
+    // 2. Parse time.
+
+    if (0 != parseTime(&p,
+                       hour,
+                       minute,
+                       second,
+                       millisecond,
+                       microsecond,
+                       hasLeapSecond,
+                       p,
+                       end,
+                       1)) {
+        return -1;                                                    // RETURN
+    }
+
+    // 3. Parse zone designator, if any.
+
+    *tzOffset = 0;
+
+    if (p != end) {
+        if (0 != parseZoneDesignator(&p, tzOffset, p, end) || p != end) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    return 0;
+}
+
+static inline
+bsls::Types::Uint64 loadWord(const char *begin)
+    // Return the 8 characters starting at the specified 'begin' packed into a
+    // 64-bit word having 'begin[0]' in its least-significant byte, regardless
+    // of the byte order of the platform.
+{
+    bsls::Types::Uint64 word = 0;
+
+    for (int i = 7; 0 <= i; --i) {
+        word = (word << 8) | static_cast<unsigned char>(begin[i]);
+    }
+
+    return word;
+}
+
+static inline
+bool isDigitWord(bsls::Types::Uint64 word, bsls::Types::Uint64 digitMask)
+    // Return 'true' if every byte of the specified 'word' selected by the
+    // specified 'digitMask' is an ASCII decimal digit, and 'false' otherwise.
+    // The behavior is undefined unless each byte of 'digitMask' is either 0
+    // or 0xff.
+{
+    const bsls::Types::Uint64 k_ZEROS = 0x3030303030303030ULL & digitMask;
+    const bsls::Types::Uint64 k_HIGHS = 0xf0f0f0f0f0f0f0f0ULL & digitMask;
+    const bsls::Types::Uint64 k_SIXES = 0x0606060606060606ULL & digitMask;
+
+    const bsls::Types::Uint64 digits = word & digitMask;
+
+    // A byte is a digit if and only if its high nibble is 3 both before and
+    // after adding 6 to it.  Once the first test passes, each selected byte is
+    // at most 0x3f, so the addition cannot carry into the neighboring byte.
+
+    return k_ZEROS == (digits & k_HIGHS)
+        && k_ZEROS == ((digits + k_SIXES) & k_HIGHS);
+}
+
+static inline
+bsls::Types::Uint64 digitPairs(bsls::Types::Uint64 word,
+                               bsls::Types::Uint64 digitMask)
+    // Return a word whose byte 'i' holds '10 * d[i] + d[i + 1]', where 'd[i]'
+    // is the value of the digit in byte 'i' of the specified 'word' if that
+    // byte is selected by the specified 'digitMask', and 0 otherwise.  The
+    // behavior is undefined unless 'isDigitWord(word, digitMask)'.
+{
+    const bsls::Types::Uint64 values = (word & digitMask)
+                                     - (0x3030303030303030ULL & digitMask);
+
+    return values * 10 + (values >> 8);
+}
+
+static inline
+int pairAt(bsls::Types::Uint64 pairs, int index)
+    // Return the value of the byte at the specified 'index' of the specified
+    // 'pairs' word.
+{
+    return static_cast<int>((pairs >> (index * 8)) & 0xff);
+}
+
+static inline
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is an ASCII decimal digit,
+    // and 'false' otherwise.
+{
+    return '0' <= character && character <= '9';
+}
+
+static
+int parseFixedDatetime(int                *year,
+                       int                *month,
+                       int                *day,
+                       int                *hour,
+                       int                *minute,
+                       int                *second,
+                       int                *millisecond,
+                       bsls::Types::Int64 *microsecond,
+                       bool               *hasLeapSecond,
+                       int                *tzOffset,
+                       const char         *string,
+                       int                 length)
+    // Parse the datetime in the specified 'string' having the specified
+    // 'length' if it has the fixed-width layout
+    // "YYYY-MM-DDThh:mm:ss[(.|,)fff|(.|,)ffffff][Z|(+|-)hh:mm]", and load
+    // into the specified 'year', 'month', 'day', 'hour', 'minute', 'second',
+    // 'millisecond', 'microsecond', 'hasLeapSecond', and 'tzOffset' the same
+    // values that 'parseDate', 'parseTime', and 'parseZoneDesignator' would
+    // load for the same input.  Return 0 on success, and a non-zero value
+    // (with no effect) if 'string' does not have one of these layouts, in
+    // which case the general parsing functions must be used instead.  The
+    // behavior is undefined unless '0 <= length'.  Note that the date and
+    // time fields are not validated beyond their being decimal digits.
+{
+    BSLS_ASSERT(string);
+    BSLS_ASSERT(0 <= length);
+
+    enum { k_FIXED_LENGTH = sizeof "YYYY-MM-DDThh:mm:ss" - 1 };
+
+    if (length < k_FIXED_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    // 1. Check and convert "YYYY-MM-" and "DDThh:mm" a word at a time.
+
+    const bsls::Types::Uint64 k_DATE_DIGITS = 0x00ffff00ffffffffULL;
+    const bsls::Types::Uint64 k_DATE_SEPS   = 0x2d00002d00000000ULL;
+    const bsls::Types::Uint64 k_TIME_DIGITS = 0xffff00ffff00ffffULL;
+    const bsls::Types::Uint64 k_TIME_SEPS   = 0x00003a0000740000ULL;
+    const bsls::Types::Uint64 k_LOWER_T     = 0x0000000000200000ULL;
+
+    const bsls::Types::Uint64 dateWord = loadWord(string);
+    const bsls::Types::Uint64 timeWord = loadWord(string + 8);
+
+    if (!isDigitWord(dateWord, k_DATE_DIGITS)
+     || !isDigitWord(timeWord, k_TIME_DIGITS)
+     || k_DATE_SEPS != (dateWord & ~k_DATE_DIGITS)
+     || k_TIME_SEPS != ((timeWord | k_LOWER_T) & ~k_TIME_DIGITS)
+     || ':' != string[16]
+     || !isDigit(string[17])
+     || !isDigit(string[18])) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 datePairs = digitPairs(dateWord, k_DATE_DIGITS);
+    const bsls::Types::Uint64 timePairs = digitPairs(timeWord, k_TIME_DIGITS);
+
+    const char *p   = string + k_FIXED_LENGTH;
+    const char *end = string + length;
+
+    // 2. Parse the optional 3- or 6-digit fractional second, which needs no
+    // rounding to microseconds.
+
+    int fraction = 0;  // in microseconds
+
+    if (p < end && ('.' == *p || ',' == *p)) {
+        ++p;  // skip '.' or ','
+
+        int numDigits = 0;
+
+        while (p < end && numDigits < 7 && isDigit(*p)) {
+            fraction = fraction * 10 + (*p - '0');
+            ++numDigits;
+            ++p;
+        }
+
+        if (3 == numDigits) {
+            fraction *= 1000;
+        }
+        else if (6 != numDigits) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    // 3. Parse the optional zone designator.
+
+    int offset = 0;  // minutes from UTC
+
+    if (1 == end - p) {
+        if ('Z' != *p && 'z' != *p) {
+            return -1;                                                // RETURN
+        }
+    }
+    else if (6 == end - p) {
+        if (('+' != p[0] && '-' != p[0])
+         || !isDigit(p[1])
+         || !isDigit(p[2])
+         || ':' != p[3]
+         || !isDigit(p[4])
+         || !isDigit(p[5])) {
+            return -1;                                                // RETURN
+        }
+
+        const int tzHour   = (p[1] - '0') * 10 + (p[2] - '0');
+        const int tzMinute = (p[4] - '0') * 10 + (p[5] - '0');
+
+        if (tzHour >= 24 || tzMinute > 59) {
+            return -1;                                                // RETURN
+        }
+
+        offset = '-' == p[0] ? -(tzHour * 60 + tzMinute)
+                             :   tzHour * 60 + tzMinute;
+    }
+    else if (p != end) {
+        return -1;                                                    // RETURN
+    }
+
+    // 4. Load the results, handling a leap second as 'parseTime' does.
+
+    const int sec = (string[17] - '0') * 10 + (string[18] - '0');
+
+    *year          = pairAt(datePairs, 0) * 100 + pairAt(datePairs, 2);
+    *month         = pairAt(datePairs, 5);
+    *day           = pairAt(timePairs, 0);
+    *hour          = pairAt(timePairs, 3);
+    *minute        = pairAt(timePairs, 6);
+    *second        = 60 == sec ? 59 : sec;
+    *hasLeapSecond = 60 == sec;
+    *millisecond   = fraction / 1000;
+    *microsecond   = fraction % 1000;
+    *tzOffset      = offset;
+
+    return 0;
+}
+
 static
 int generateUnpaddedInt(char *buffer, bsls::Types::Int64 value)
     // Write, to the specified 'buffer', the decimal string representation of
@@ -461,9 +754,16 @@ int generateInt(char *buffer, int value, int paddedLen)
 
     char *p = buffer + paddedLen;
 
-    while (p > buffer) {
+    // Emit two digits at a time from the table of digit pairs.
+
+    while (p - buffer >= 2) {
+        p -= 2;
+        bsl::memcpy(p, k_DIGIT_PAIRS + 2 * (value % 100), 2);
+        value /= 100;
+    }
+
+    if (p > buffer) {
         *--p = static_cast<char>('0' + value % 10);
-        value /= 10;
     }
 
     return paddedLen;
@@ -1719,57 +2019,42 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and zone designator are independently optional.
 
-    enum { k_MINIMUM_LENGTH = sizeof "YYYY-MM-DDThh:mm:ss" - 1 };
+    // 1. Parse the date, time, and zone designator, using the fixed-width
+    // parser for the common layouts and the general parser otherwise.
 
-    if (length < k_MINIMUM_LENGTH) {
-        return -1;                                                    // RETURN
-    }
-
-    const char *p   = string;
-    const char *end = string + length;
-
-    // 1. Parse date.
-
-    int year, month, day;
-
-    if (0 != parseDate(&p, &year, &month, &day, p, end)
-     || p == end
-     || ('T' != *p && 't' != *p)) {
-
-        return -1;                                                    // RETURN
-    }
-    ++p;  // skip 'T' or 't'
-
-    // 2. Parse time.
-
-    int                hour, minute, second, millisecond;
+    int                year, month, day, hour, minute, second, millisecond;
     bsls::Types::Int64 microsecond;
     bool               hasLeapSecond;
-
-    if (0 != parseTime(&p,
-                       &hour,
-                       &minute,
-                       &second,
-                       &millisecond,
-                       &microsecond,
-                       &hasLeapSecond,
-                       p,
-                       end,
-                       1)) {
+    int                tzOffset;  // minutes from UTC
+
+    if (0 != parseFixedDatetime(&year,
+                                &month,
+                                &day,
+                                &hour,
+                                &minute,
+                                &second,
+                                &millisecond,
+                                &microsecond,
+                                &hasLeapSecond,
+                                &tzOffset,
+                                string,
+                                length)
+     && 0 != parseDatetime(&year,
+                           &month,
+                           &day,
+                           &hour,
+                           &minute,
+                           &second,
+                           &millisecond,
+                           &microsecond,
+                           &hasLeapSecond,
+                           &tzOffset,
+                           string,
+                           length)) {
         return -1;                                                    // RETURN
     }
 
-    // 3. Parse zone designator, if any.
-
-    int tzOffset = 0;  // minutes from UTC
-
-    if (p != end) {
-        if (0 != parseZoneDesignator(&p, &tzOffset, p, end) || p != end) {
-            return -1;                                                // RETURN
-        }
-    }
-
-    // 4. Account for special ISO 8601 values.
+    // 2. Account for special ISO 8601 values.
 
     ///Leap Seconds and Maximum Fractional Seconds
     ///- - - - - - - - - - - - - - - - - - - - - -
@@ -1807,7 +2092,7 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
         resultAdjustment.addSeconds(1);
     }
 
-    // 5. Load a 'Datetime'.
+    // 3. Load a 'Datetime'.
 
     Datetime localDatetime;
 
@@ -1822,7 +2107,7 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
         return -1;                                                    // RETURN
     }
 
-    // 6. Apply adjustments for special ISO 8601 values.
+    // 4. Apply adjustments for special ISO 8601 values.
 
     if (DatetimeInterval() != resultAdjustment) {
 
@@ -12,6 +12,7 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cctype.h>      // 'isdigit'
 #include <bsl_cstdlib.h>
@@ -109,6 +110,8 @@ using namespace bsl;
 // [ 9] int parse(DateTz *, const char *, int);
 // [10] int parse(TimeTz *, const char *, int);
 // [11] int parse(DatetimeTz *, const char *, int);
+// [12] int parse(Datetime *, const char *, int);
+// [12] int parse(DatetimeTz *, const char *, int);
 // [ 8] int parse(TimeInterval *result, const StringRef& string);
 // [ 9] int parse(Date *result, const StringRef& string);
 // [10] int parse(Time *result, const StringRef& string);
@@ -134,7 +137,8 @@ using namespace bsl;
 // [ 7] int generateRaw(char *, const DatetimeTz&, bool useZ);
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: FIXED-WIDTH PARSE AND GENERATE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -794,7 +798,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -991,6 +995,180 @@ if (veryVerbose)
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // PARSE: FIXED-WIDTH DATETIME LAYOUTS
+        //   Datetimes having the layout
+        //   "YYYY-MM-DDThh:mm:ss[.fff|.ffffff][Z|(+|-)hh:mm]" are parsed by a
+        //   dedicated fixed-width parser, and all other strings by the
+        //   general parser.
+        //
+        // Concerns:
+        //: 1 Strings having one of the fixed-width layouts yield the same
+        //:   status and value as equivalent strings handled by the general
+        //:   parser.
+        //:
+        //: 2 Strings that almost have a fixed-width layout (e.g., a 4-digit
+        //:   fractional second, or a zone designator without a colon) are
+        //:   handed to the general parser.
+        //:
+        //: 3 Leap seconds, 'T' and 'Z' in either case, ',' as the decimal
+        //:   sign, 24:00, and out-of-range field values are handled exactly
+        //:   as by the general parser.
+        //:
+        //: 4 If parsing fails, the result object is unaffected.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of strings
+        //:   having (or nearly having) a fixed-width layout.
+        //:
+        //: 2 For each string 'S' from P-1, form the equivalent string 'G' by
+        //:   appending a '0' to the fractional second of 'S' (or inserting
+        //:   ".0" if 'S' has none).  'G' does not have a fixed-width layout,
+        //:   and so is always handled by the general parser.
+        //:
+        //: 3 Parse 'S' and 'G' into both 'Datetime' and 'DatetimeTz' objects
+        //:   and verify that the statuses and values agree, and that the
+        //:   result is unaffected on failure.  (C-1..4)
+        //
+        // Testing:
+        //   int parse(Datetime *, const char *, int);
+        //   int parse(DatetimeTz *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSE: FIXED-WIDTH DATETIME LAYOUTS" << endl
+                          << "===================================" << endl;
+
+        static const struct {
+            int         d_line;    // source line number
+            const char *d_input;   // input string
+            bool        d_isValid; // is expected to parse successfully
+        } DATA[] = {
+            //LINE  INPUT                                    VALID
+            //----  ---------------------------------------  -----
+            { L_,   "0001-01-01T00:00:00",                    true  },
+            { L_,   "2005-01-31T08:59:59",                    true  },
+            { L_,   "2005-01-31t08:59:59",                    true  },
+            { L_,   "2005-01-31T08:59:59Z",                   true  },
+            { L_,   "2005-01-31T08:59:59z",                   true  },
+            { L_,   "2005-01-31T08:59:59+04:00",              true  },
+            { L_,   "2005-01-31T08:59:59-23:59",              true  },
+            { L_,   "2005-01-31T08:59:59.123",                true  },
+            { L_,   "2005-01-31T08:59:59,123",                true  },
+            { L_,   "2005-01-31T08:59:59.123Z",               true  },
+            { L_,   "2005-01-31T08:59:59.123-04:30",          true  },
+            { L_,   "2005-01-31T08:59:59.123456",             true  },
+            { L_,   "2005-01-31T08:59:59,123456",             true  },
+            { L_,   "2005-01-31T08:59:59.123456Z",            true  },
+            { L_,   "2005-01-31T08:59:59.123456+12:45",       true  },
+            { L_,   "2005-01-31T08:59:59.999999-00:01",       true  },
+            { L_,   "2008-12-31T23:59:60",                    true  },
+            { L_,   "2008-12-31T23:59:60.999999Z",            true  },
+            { L_,   "2008-12-31T23:59:60.999+01:00",          true  },
+            { L_,   "2004-02-29T12:00:00.000",                true  },
+            { L_,   "9999-12-31T23:59:59.999999",             true  },
+            { L_,   "0001-01-01T00:00:00.000000Z",            true  },
+            { L_,   "9999-12-31T23:59:59.999999+00:00",       true  },
+            { L_,   "2005-01-31T24:00:00",                    true  },
+            { L_,   "2005-01-31T24:00:00.000000Z",            true  },
+
+            { L_,   "2005-01-31T08:59:59.1234Z",              true  },
+            { L_,   "2005-01-31T08:59:59.1Z",                 true  },
+            { L_,   "2005-01-31T08:59:59+0400",               true  },
+            { L_,   "2005-01-31T08:59:59.123456-0400",        true  },
+
+            { L_,   "0000-01-01T00:00:00",                    false },
+            { L_,   "2005-00-31T08:59:59",                    false },
+            { L_,   "2005-13-31T08:59:59",                    false },
+            { L_,   "2005-02-29T08:59:59.123",                false },
+            { L_,   "2005-01-32T08:59:59.123456",             false },
+            { L_,   "2005-01-31T25:00:00",                    false },
+            { L_,   "2005-01-31T08:60:00",                    false },
+            { L_,   "2005-01-31T08:59:61",                    false },
+            { L_,   "2005-01-31T24:00:01",                    false },
+            { L_,   "2005-01-31T24:00:00.001",                false },
+            { L_,   "2005-01-31T24:00:00+01:00",              false },
+            { L_,   "9999-12-31T23:59:60",                    false },
+            { L_,   "2005-01-31T08:59:59+24:00",              false },
+            { L_,   "2005-01-31T08:59:59-00:60",              false },
+            { L_,   "2005-01-31X08:59:59",                    false },
+            { L_,   "2005/01-31T08:59:59",                    false },
+            { L_,   "2005-01/31T08:59:59",                    false },
+            { L_,   "2005-01-31T08-59:59",                    false },
+            { L_,   "2005-01-31T08:59-59",                    false },
+            { L_,   "2a05-01-31T08:59:59",                    false },
+            { L_,   "2005-0:-31T08:59:59",                    false },
+            { L_,   "2005-01-3/T08:59:59",                    false },
+            { L_,   "2005-01-31T0@:59:59",                    false },
+            { L_,   "2005-01-31T08:5 :59",                    false },
+            { L_,   "2005-01-31T08:59:5a",                    false },
+            { L_,   "2005-01-31T08:59:59.12a",                false },
+            { L_,   "2005-01-31T08:59:59*04:00",              false },
+            { L_,   "2005-01-31T08:59:59+04.00",              false },
+            { L_,   "2005-01-31T08:59:59+0a:00",              false },
+            { L_,   "2005-01-31T08:59:59ZZ",                  false },
+            { L_,   "2005-01-31T08:59:59X",                   false },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const bdlt::Datetime   XX(246, 8, 10, 9, 11, 12, 13, 14);
+        const bdlt::DatetimeTz ZZ(XX, -7);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const bsl::string  INPUT    = DATA[ti].d_input;
+            const bool         IS_VALID = DATA[ti].d_isValid;
+
+            // Form the equivalent string for the general parser.
+
+            bsl::string general(INPUT);
+
+            const bsl::size_t k_SECOND_END = sizeof "YYYY-MM-DDThh:mm:ss" - 1;
+
+            if (INPUT.length() > k_SECOND_END
+             && ('.' == INPUT[k_SECOND_END] || ',' == INPUT[k_SECOND_END])) {
+                bsl::size_t pos = k_SECOND_END + 1;
+                while (pos < INPUT.length() && isdigit(INPUT[pos])) {
+                    ++pos;
+                }
+                general.insert(pos, "0");
+            }
+            else {
+                general.insert(k_SECOND_END, ".0");
+            }
+
+            const char *const S  = INPUT.c_str();
+            const int         SL = static_cast<int>(INPUT.length());
+            const char *const G  = general.c_str();
+            const int         GL = static_cast<int>(general.length());
+
+            if (veryVerbose) { T_ P_(LINE) P_(S) P(G) }
+
+            bdlt::Datetime   mX(XX);  const bdlt::Datetime&   X = mX;
+            bdlt::Datetime   mY(XX);  const bdlt::Datetime&   Y = mY;
+            bdlt::DatetimeTz mZ(ZZ);  const bdlt::DatetimeTz& Z = mZ;
+            bdlt::DatetimeTz mW(ZZ);  const bdlt::DatetimeTz& W = mW;
+
+            const int RC_X = Util::parse(&mX, S, SL);
+            const int RC_Y = Util::parse(&mY, G, GL);
+            const int RC_Z = Util::parse(&mZ, S, SL);
+            const int RC_W = Util::parse(&mW, G, GL);
+
+            ASSERTV(LINE, RC_X, IS_VALID == (0 == RC_X));
+            ASSERTV(LINE, RC_Y, IS_VALID == (0 == RC_Y));
+            ASSERTV(LINE, RC_Z, IS_VALID == (0 == RC_Z));
+            ASSERTV(LINE, RC_W, IS_VALID == (0 == RC_W));
+
+            ASSERTV(LINE, X, Y, X == Y);
+            ASSERTV(LINE, Z, W, Z == W);
+
+            if (!IS_VALID) {
+                ASSERTV(LINE, X, XX == X);
+                ASSERTV(LINE, Z, ZZ == Z);
+            }
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
@@ -5698,6 +5876,115 @@ if (veryVerbose)
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: FIXED-WIDTH PARSE AND GENERATE
+        //   Compare the time taken to parse datetimes having a fixed-width
+        //   layout against that taken for equivalent strings handled by the
+        //   general parser, and measure the time taken to generate them.
+        //
+        // Concerns:
+        //: 1 The fixed-width parser is faster than the general parser.
+        //
+        // Plan:
+        //: 1 Repeatedly parse each of a set of fixed-width strings, and each
+        //:   of the same strings with a 7-digit fractional second (which the
+        //:   general parser handles), and report the elapsed times.
+        //:
+        //: 2 Repeatedly generate the same values and report the elapsed time.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: FIXED-WIDTH PARSE AND GENERATE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "PERFORMANCE TEST: FIXED-WIDTH PARSE AND GENERATE"
+                    << endl
+                    << "================================================"
+                    << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        static const char *const FIXED[] = {
+            "2005-01-31T08:59:59.123456",
+            "2005-01-31T08:59:59.123456Z",
+            "2005-01-31T08:59:59.123+04:00",
+            "2016-11-08T17:30:00.000000-05:00",
+        };
+        static const char *const GENERAL[] = {
+            "2005-01-31T08:59:59.1234560",
+            "2005-01-31T08:59:59.1234560Z",
+            "2005-01-31T08:59:59.1230+04:00",
+            "2016-11-08T17:30:00.0000000-05:00",
+        };
+        const int NUM_STRINGS = static_cast<int>(sizeof FIXED / sizeof *FIXED);
+
+        int fixedLength[NUM_STRINGS];
+        int generalLength[NUM_STRINGS];
+
+        for (int i = 0; i < NUM_STRINGS; ++i) {
+            fixedLength[i]   = static_cast<int>(bsl::strlen(FIXED[i]));
+            generalLength[i] = static_cast<int>(bsl::strlen(GENERAL[i]));
+        }
+
+        bdlt::DatetimeTz   value;
+        bsls::Types::Int64 checksum = 0;
+        bsls::Stopwatch    timer;
+
+        timer.start();
+        for (int n = 0; n < NUM_ITERATIONS; ++n) {
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                checksum += Util::parse(&value, FIXED[i], fixedLength[i]);
+                checksum += value.offset();
+            }
+        }
+        timer.stop();
+
+        const double fixedTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int n = 0; n < NUM_ITERATIONS; ++n) {
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                checksum += Util::parse(&value, GENERAL[i], generalLength[i]);
+                checksum += value.offset();
+            }
+        }
+        timer.stop();
+
+        const double generalTime = timer.elapsedTime();
+
+        bdlt::DatetimeTz values[NUM_STRINGS];
+        for (int i = 0; i < NUM_STRINGS; ++i) {
+            ASSERTV(i, 0 == Util::parse(&values[i], FIXED[i], fixedLength[i]));
+        }
+
+        char buffer[Util::k_DATETIMETZ_STRLEN];
+
+        timer.reset();
+        timer.start();
+        for (int n = 0; n < NUM_ITERATIONS; ++n) {
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                checksum += Util::generateRaw(buffer, values[i]);
+                checksum += buffer[5];
+            }
+        }
+        timer.stop();
+
+        const double generateTime = timer.elapsedTime();
+
+        const double numOps = static_cast<double>(NUM_ITERATIONS)
+                                                                 * NUM_STRINGS;
+
+        cout << "parse (fixed-width): "
+             << fixedTime / numOps * 1e9 << " ns/op" << endl
+             << "parse (general):     "
+             << generalTime / numOps * 1e9 << " ns/op" << endl
+             << "generateRaw:         "
+             << generateTime / numOps * 1e9 << " ns/op" << endl;
+
+        if (veryVerbose) { P(checksum) }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlt_prolepticdateimputil_cpp,"$Id$ $CSID$")
 
+#include <bsls_types.h>
+
 namespace BloombergLP {
 namespace bdlt {
 
@@ -441,6 +443,130 @@ void ProlepticDateImpUtil::ydToMd(int *month,
     *day = dayOfYear - daysThroughMonth[*month - 1];
 }
 
+                        // Batch Conversions
+
+// The following functions compute dates in a "computational" calendar whose
+// years begin on March 1 (so that the leap day, if any, is the last day of the
+// year), and whose day 0 is '0000/03/01', i.e., serial date '-305'.  See
+// Neri and Schneider, "Euclidean Affine Functions and their Application to
+// Calendar Algorithms" (Software: Practice and Experience, 2022).  The loops
+// have no data-dependent branches, so that they can be vectorized.
+
+void ProlepticDateImpUtil::ymdToSerial(int         *serialDays,
+                                       const int   *years,
+                                       const int   *months,
+                                       const int   *days,
+                                       bsl::size_t  numDates)
+{
+    BSLS_ASSERT(serialDays || 0 == numDates);
+    BSLS_ASSERT(years      || 0 == numDates);
+    BSLS_ASSERT(months     || 0 == numDates);
+    BSLS_ASSERT(days       || 0 == numDates);
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        BSLS_ASSERT_SAFE(isValidYearMonthDay(years[i], months[i], days[i]));
+
+        const unsigned year  = static_cast<unsigned>(years[i]);
+        const unsigned month = static_cast<unsigned>(months[i]);
+        const unsigned day   = static_cast<unsigned>(days[i]);
+
+        // 'isJanOrFeb': 1 if 'month' belongs to the previous computational
+        // year, and 0 otherwise
+
+        const unsigned isJanOrFeb = month <= k_FEB;
+
+        // 'cy': computational year, 'cm': computational month in '[3 .. 14]'
+
+        const unsigned cy = year  - isJanOrFeb;
+        const unsigned cm = month + 12 * isJanOrFeb;
+
+        // 'century': 0-based century of the computational year
+
+        const unsigned century = cy / 100;
+
+        // 'yearDays': days of the computational years before 'cy'
+
+        const unsigned yearDays = k_DAYS_IN_4_YEARS * cy / 4
+                                - century
+                                + century / 4;
+
+        // 'monthDays': days of the computational months before 'cm'
+
+        const unsigned monthDays = (979 * cm - 2919) / 32;
+
+        serialDays[i] = static_cast<int>(yearDays + monthDays + day - 306);
+    }
+}
+
+void ProlepticDateImpUtil::serialToYmd(int         *years,
+                                       int         *months,
+                                       int         *days,
+                                       const int   *serialDays,
+                                       bsl::size_t  numDates)
+{
+    BSLS_ASSERT(years      || 0 == numDates);
+    BSLS_ASSERT(months     || 0 == numDates);
+    BSLS_ASSERT(days       || 0 == numDates);
+    BSLS_ASSERT(serialDays || 0 == numDates);
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        BSLS_ASSERT_SAFE(isValidSerial(serialDays[i]));
+
+        // 'n': day of the computational calendar
+
+        const unsigned n = static_cast<unsigned>(serialDays[i]) + 305;
+
+        // 'century': 0-based century, 'doc': 0-based day of the century
+
+        const unsigned n1      = 4 * n + 3;
+        const unsigned century = n1 / k_DAYS_IN_400_YEAR_ERA;
+        const unsigned doc     = n1 % k_DAYS_IN_400_YEAR_ERA / 4;
+
+        // 'yoc': 0-based year of the century, 'doy': 0-based day of the
+        // computational year
+
+        const unsigned            n2  = 4 * doc + 3;
+        const bsls::Types::Uint64 p2  = 2939745ULL * n2;
+        const unsigned            yoc = static_cast<unsigned>(p2 >> 32);
+        const unsigned            doy =
+                                   static_cast<unsigned>(p2) / 2939745 / 4;
+
+        // 'cm': computational month in '[3 .. 14]', 'dom': 0-based day of the
+        // month
+
+        const unsigned n3  = 2141 * doy + 197913;
+        const unsigned cm  = n3 >> 16;
+        const unsigned dom = (n3 & 0xffff) / 2141;
+
+        // 'isJanOrFeb': 1 if the date belongs to the next calendar year, and
+        // 0 otherwise
+
+        const unsigned isJanOrFeb = doy >= 306;
+
+        years[i]  = static_cast<int>(100 * century + yoc + isJanOrFeb);
+        months[i] = static_cast<int>(cm - 12 * isJanOrFeb);
+        days[i]   = static_cast<int>(dom + 1);
+    }
+}
+
+void ProlepticDateImpUtil::serialToDayOfWeek(int         *daysOfWeek,
+                                             const int   *serialDays,
+                                             bsl::size_t  numDates)
+{
+    BSLS_ASSERT(daysOfWeek || 0 == numDates);
+    BSLS_ASSERT(serialDays || 0 == numDates);
+
+    for (bsl::size_t i = 0; i < numDates; ++i) {
+        BSLS_ASSERT_SAFE(isValidSerial(serialDays[i]));
+
+        // 0001/01/01 was a Monday (MON == 2).
+
+        daysOfWeek[i] =
+                    1 + static_cast<int>(
+                                   static_cast<unsigned>(serialDays[i]) % 7);
+    }
+}
+
 // ============================================================================
 //                    MACHINE-GENERATED DATA GOES HERE
 // ============================================================================
@@ -80,6 +80,20 @@ BSLS_IDENT("$Id: $")
 // are provided primarily for testing and for generating the cache in the first
 // place (see this component's test driver).
 //
+///Batch Conversions
+///-----------------
+// 'bdlt::ProlepticDateImpUtil' also provides overloads of 'ymdToSerial',
+// 'serialToYmd', and 'serialToDayOfWeek' that convert arrays of date values
+// (e.g., the columns of a table).  Rather than the cache (whose lookups are
+// data-dependent branches and memory accesses), these overloads use the
+// algorithms of Neri and Schneider ("Euclidean Affine Functions and their
+// Application to Calendar Algorithms", 2022), which compute the conversion
+// with multiplications, shifts, and divisions by constants only (which
+// compilers implement as multiplications), and without data-dependent
+// branches, so that compilers can vectorize the conversion loops.  The batch
+// overloads produce exactly the same values as the corresponding scalar
+// functions.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -347,6 +361,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlt {
 
@@ -550,6 +566,53 @@ struct ProlepticDateImpUtil {
         // the day (of the week) of the date value indicated by the specified
         // 'year', 'month', and 'day'.  The behavior is undefined unless
         // 'isValidYearMonthDay(year, month, day)' returns 'true'.
+
+                        // Batch Conversions
+
+    static void ymdToSerial(int         *serialDays,
+                            const int   *years,
+                            const int   *months,
+                            const int   *days,
+                            bsl::size_t  numDates);
+        // Load, into the specified 'serialDays' array, the serial date
+        // representation of each of the date values indicated by the
+        // corresponding elements of the specified 'years', 'months', and
+        // 'days' arrays, each having the specified 'numDates' elements.  The
+        // behavior is undefined unless each of 'serialDays', 'years',
+        // 'months', and 'days' refers to an array of at least 'numDates'
+        // elements, and 'isValidYearMonthDay(years[i], months[i], days[i])'
+        // returns 'true' for each index 'i' in '[0 .. numDates - 1]'.  Note
+        // that 'serialDays' may refer to the same array as 'years', 'months',
+        // or 'days'.
+
+    static void serialToYmd(int         *years,
+                            int         *months,
+                            int         *days,
+                            const int   *serialDays,
+                            bsl::size_t  numDates);
+        // Load, into the specified 'years', 'months', and 'days' arrays, the
+        // date value indicated by each of the corresponding elements of the
+        // specified 'serialDays' array, having the specified 'numDates'
+        // elements.  The behavior is undefined unless each of 'years',
+        // 'months', 'days', and 'serialDays' refers to an array of at least
+        // 'numDates' elements, 'years', 'months', and 'days' refer to
+        // distinct arrays, and 'isValidSerial(serialDays[i])' returns 'true'
+        // for each index 'i' in '[0 .. numDates - 1]'.  Note that one of
+        // 'years', 'months', or 'days' may refer to the same array as
+        // 'serialDays'.
+
+    static void serialToDayOfWeek(int         *daysOfWeek,
+                                  const int   *serialDays,
+                                  bsl::size_t  numDates);
+        // Load, into the specified 'daysOfWeek' array, as an integer (with
+        // '1 = SUN', '2 = MON', ..., '7 = SAT'), the day (of the week) of the
+        // date value indicated by each of the corresponding elements of the
+        // specified 'serialDays' array, having the specified 'numDates'
+        // elements.  The behavior is undefined unless each of 'daysOfWeek'
+        // and 'serialDays' refers to an array of at least 'numDates'
+        // elements, and 'isValidSerial(serialDays[i])' returns 'true' for each
+        // index 'i' in '[0 .. numDates - 1]'.  Note that 'daysOfWeek' may
+        // refer to the same array as 'serialDays'.
 };
 
 // ============================================================================
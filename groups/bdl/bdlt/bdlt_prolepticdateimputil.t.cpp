@@ -44,7 +44,9 @@ using namespace bsl;
 // Several negatively-numbered test cases are also provided, one of which
 // (test case -1) is used to generate the cache (for insertion into the '.cpp'
 // file).  The other negative tests (-2 through -7) compare the running times
-// of the 'NoCache' methods versus that of their cached counterparts.
+// of the 'NoCache' methods versus that of their cached counterparts, and test
+// case -8 compares the running time of the batch 'serialToYmd' versus that of
+// the scalar one.
 // ----------------------------------------------------------------------------
 // CLASS METHODS
 // [ 2] static bool isLeapYear(int year);
@@ -74,9 +76,12 @@ using namespace bsl;
 // [12] static int  serialToDayOfWeek(int serialDay);
 // [12] static int  ydToDayOfWeek(int year, int dayOfYear);
 // [12] static int  ymdToDayOfWeek(int year, int month, int day);
+// [13] static void ymdToSerial(int *sD, const int *y, *m, *d, size_t n);
+// [13] static void serialToYmd(int *y, int *m, int *d, const int *sD, n);
+// [13] static void serialToDayOfWeek(int *dow, const int *sD, size_t n);
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 1] CONCERN: The global constants used for testing are correct.
 // [ *] CONCERN: Precondition violations are detected when enabled.
 // [ *] CONCERN: In no case does memory come from the global allocator.
@@ -88,6 +93,7 @@ using namespace bsl;
 // [-5] PERFORMANCE TEST: serialToYear[NoCache]
 // [-6] PERFORMANCE TEST: serialToMonth[NoCache]
 // [-7] PERFORMANCE TEST: serialToDay[NoCache]
+// [-8] PERFORMANCE TEST: batch serialToYmd
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -399,7 +405,7 @@ int main(int argc, char *argv[])
     bool yearRangeFlag = !(argc > 3);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -454,7 +460,7 @@ int main(int argc, char *argv[])
 // more computation.
 
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -524,6 +530,215 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH CONVERSIONS
+        //   Ensure that the batch 'ymdToSerial', 'serialToYmd', and
+        //   'serialToDayOfWeek' methods produce the same results as their
+        //   scalar counterparts.
+        //
+        // Concerns:
+        //: 1 The batch 'serialToYmd' method maps every valid serial date to
+        //:   the same year/month/day date as the scalar 'serialToYmd'.
+        //:
+        //: 2 The batch 'ymdToSerial' method maps every valid year/month/day
+        //:   date to the same serial date as the scalar 'ymdToSerial'.
+        //:
+        //: 3 The batch 'serialToDayOfWeek' method maps every valid serial
+        //:   date to the same day of the week as the scalar
+        //:   'serialToDayOfWeek'.
+        //:
+        //: 4 The batch methods convert exactly the specified number of
+        //:   elements, and accept a 0 number of elements with null arrays.
+        //:
+        //: 5 The results of the batch methods may be loaded into one of their
+        //:   input arrays.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every valid serial date, in chunks of consecutive dates,
+        //:   invoke the batch 'serialToYmd' and 'serialToDayOfWeek' methods,
+        //:   and then the batch 'ymdToSerial' method on the results of
+        //:   'serialToYmd', and verify the results against the scalar
+        //:   methods.  (C-1..3)
+        //:
+        //: 2 Invoke the batch methods on arrays whose elements past the
+        //:   specified number of elements hold sentinel values, and verify
+        //:   that the sentinels are unchanged.  Invoke the batch methods with
+        //:   0 elements and null arrays.  (C-4)
+        //:
+        //: 3 Invoke the batch methods with one of the input arrays also
+        //:   supplied as an output array, and verify the results.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values, but not triggered for
+        //:   adjacent valid ones (using the 'BSLS_ASSERTTEST_*' macros).
+        //:   (C-6)
+        //
+        // Testing:
+        //   static void ymdToSerial(int *sD, const int *y, *m, *d, size_t n);
+        //   static void serialToYmd(int *y, int *m, int *d, const int *sD, n);
+        //   static void serialToDayOfWeek(int *dow, const int *sD, size_t n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH CONVERSIONS" << endl
+                          << "=========================" << endl;
+
+        enum { k_CHUNK_SIZE = 1000 };
+
+        if (verbose) cout << "\nExhaustively compare with scalar methods."
+                          << endl;
+        {
+            int serials[k_CHUNK_SIZE];
+            int years[k_CHUNK_SIZE];
+            int months[k_CHUNK_SIZE];
+            int days[k_CHUNK_SIZE];
+            int daysOfWeek[k_CHUNK_SIZE];
+            int roundTrips[k_CHUNK_SIZE];
+
+            for (int first = k_MIN_SERIAL;
+                 first <= k_MAX_SERIAL;
+                 first += k_CHUNK_SIZE) {
+                const int NUM_DATES = first + k_CHUNK_SIZE - 1 <= k_MAX_SERIAL
+                                    ? k_CHUNK_SIZE
+                                    : k_MAX_SERIAL - first + 1;
+
+                for (int j = 0; j < NUM_DATES; ++j) {
+                    serials[j] = first + j;
+                }
+
+                Util::serialToYmd(years, months, days, serials, NUM_DATES);
+                Util::serialToDayOfWeek(daysOfWeek, serials, NUM_DATES);
+                Util::ymdToSerial(roundTrips, years, months, days, NUM_DATES);
+
+                for (int j = 0; j < NUM_DATES; ++j) {
+                    const int SERIAL = serials[j];
+
+                    int expYear, expMonth, expDay;
+                    Util::serialToYmdNoCache(&expYear,
+                                             &expMonth,
+                                             &expDay,
+                                             SERIAL);
+
+                    ASSERTV(SERIAL, expYear,  years[j],  expYear  == years[j]);
+                    ASSERTV(SERIAL, expMonth, months[j],
+                            expMonth == months[j]);
+                    ASSERTV(SERIAL, expDay,   days[j],   expDay   == days[j]);
+
+                    ASSERTV(SERIAL,
+                            daysOfWeek[j],
+                            Util::serialToDayOfWeek(SERIAL) == daysOfWeek[j]);
+
+                    ASSERTV(SERIAL,
+                            roundTrips[j],
+                            Util::ymdToSerialNoCache(expYear,
+                                                     expMonth,
+                                                     expDay) == roundTrips[j]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting the number of elements." << endl;
+        {
+            const int SENTINEL = -17;
+
+            int serials[]    = { 730120, 730121, SENTINEL };
+            int years[]      = { SENTINEL, SENTINEL, SENTINEL };
+            int months[]     = { SENTINEL, SENTINEL, SENTINEL };
+            int days[]       = { SENTINEL, SENTINEL, SENTINEL };
+            int daysOfWeek[] = { SENTINEL, SENTINEL, SENTINEL };
+
+            Util::serialToYmd(years, months, days, serials, 2);
+            Util::serialToDayOfWeek(daysOfWeek, serials, 2);
+
+            ASSERT(2000 == years[0]);           ASSERT(2000 == years[1]);
+            ASSERT(   1 == months[0]);          ASSERT(   1 == months[1]);
+            ASSERT(   1 == days[0]);            ASSERT(   2 == days[1]);
+            ASSERT(   7 == daysOfWeek[0]);      ASSERT(   1 == daysOfWeek[1]);
+
+            ASSERT(SENTINEL == years[2]);
+            ASSERT(SENTINEL == months[2]);
+            ASSERT(SENTINEL == days[2]);
+            ASSERT(SENTINEL == daysOfWeek[2]);
+
+            serials[0] = serials[1] = SENTINEL;
+
+            Util::ymdToSerial(serials, years, months, days, 1);
+
+            ASSERT(  730120 == serials[0]);
+            ASSERT(SENTINEL == serials[1]);
+
+            Util::ymdToSerial(0, 0, 0, 0, 0);
+            Util::serialToYmd(0, 0, 0, 0, 0);
+            Util::serialToDayOfWeek(0, 0, 0);
+        }
+
+        if (verbose) cout << "\nTesting aliasing." << endl;
+        {
+            int values[] = { 730120, 730121 };
+            int months[2];
+            int days[2];
+
+            Util::serialToYmd(values, months, days, values, 2);
+
+            ASSERT(2000 == values[0]);          ASSERT(2000 == values[1]);
+            ASSERT(   1 == months[0]);          ASSERT(   1 == months[1]);
+            ASSERT(   1 == days[0]);            ASSERT(   2 == days[1]);
+
+            Util::ymdToSerial(days, values, months, days, 2);
+
+            ASSERT(730120 == days[0]);          ASSERT(730121 == days[1]);
+
+            Util::serialToDayOfWeek(days, days, 2);
+
+            ASSERT(     7 == days[0]);          ASSERT(     1 == days[1]);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int serials[] = { k_MIN_SERIAL, k_MAX_SERIAL };
+            int years[]   = { k_MIN_YEAR,   k_MAX_YEAR   };
+            int months[]  = { 1,            12           };
+            int days[]    = { 1,            31           };
+            int r1[2];
+            int r2[2];
+            int r3[2];
+
+            ASSERT_PASS(Util::ymdToSerial(r1, years, months, days, 2));
+            ASSERT_FAIL(Util::ymdToSerial( 0, years, months, days, 2));
+            ASSERT_FAIL(Util::ymdToSerial(r1,     0, months, days, 2));
+            ASSERT_FAIL(Util::ymdToSerial(r1, years,      0, days, 2));
+            ASSERT_FAIL(Util::ymdToSerial(r1, years, months,    0, 2));
+
+            ASSERT_PASS(Util::serialToYmd(r1, r2, r3, serials, 2));
+            ASSERT_FAIL(Util::serialToYmd( 0, r2, r3, serials, 2));
+            ASSERT_FAIL(Util::serialToYmd(r1,  0, r3, serials, 2));
+            ASSERT_FAIL(Util::serialToYmd(r1, r2,  0, serials, 2));
+            ASSERT_FAIL(Util::serialToYmd(r1, r2, r3,       0, 2));
+
+            ASSERT_PASS(Util::serialToDayOfWeek(r1, serials, 2));
+            ASSERT_FAIL(Util::serialToDayOfWeek( 0, serials, 2));
+            ASSERT_FAIL(Util::serialToDayOfWeek(r1,       0, 2));
+
+            days[1] = 32;
+            ASSERT_SAFE_FAIL(Util::ymdToSerial(r1, years, months, days, 2));
+            ASSERT_SAFE_PASS(Util::ymdToSerial(r1, years, months, days, 1));
+
+            serials[1] = k_MAX_SERIAL + 1;
+            ASSERT_SAFE_FAIL(Util::serialToYmd(r1, r2, r3, serials, 2));
+            ASSERT_SAFE_FAIL(Util::serialToDayOfWeek(r1, serials, 2));
+
+            serials[1] = k_MIN_SERIAL - 1;
+            ASSERT_SAFE_FAIL(Util::serialToYmd(r1, r2, r3, serials, 2));
+            ASSERT_SAFE_FAIL(Util::serialToDayOfWeek(r1, serials, 2));
+            ASSERT_SAFE_PASS(Util::serialToYmd(r1, r2, r3, serials, 1));
+            ASSERT_SAFE_PASS(Util::serialToDayOfWeek(r1, serials, 1));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING '{serial|yd|ymd}ToDayOfWeek'
@@ -3958,6 +4173,89 @@ int main(int argc, char *argv[])
                 cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
         }
 
+      } break;
+      case -8: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: batch 'serialToYmd'
+        //   Manually compare the running time of the batch 'serialToYmd'
+        //   with that of the scalar 'serialToYmd[NoCache]'.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: batch serialToYmd
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "PERFORMANCE TEST: batch 'serialToYmd'" << endl
+                 << "=====================================" << endl;
+
+        enum { k_NUM_DATES = 10000, k_NUM_ITERATIONS = 1000 };
+
+        static int serials[k_NUM_DATES];
+        static int years[k_NUM_DATES];
+        static int months[k_NUM_DATES];
+        static int days[k_NUM_DATES];
+
+        // Consecutive days starting in 1970, most of them within the cache.
+
+        const int FIRST_SERIAL = Util::ymdToSerial(1970, 1, 1);
+
+        for (int i = 0; i < k_NUM_DATES; ++i) {
+            serials[i] = FIRST_SERIAL + i;
+        }
+
+        if (verbose) cout << "\nTesting 'serialToYmdNoCache':" << endl;
+        {
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int j = 0; j < k_NUM_ITERATIONS; ++j) {
+                for (int i = 0; i < k_NUM_DATES; ++i) {
+                    Util::serialToYmdNoCache(years  + i,
+                                             months + i,
+                                             days   + i,
+                                             serials[i]);
+                }
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (verbose) cout << "\nTesting 'serialToYmd':" << endl;
+        {
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int j = 0; j < k_NUM_ITERATIONS; ++j) {
+                for (int i = 0; i < k_NUM_DATES; ++i) {
+                    Util::serialToYmd(years  + i,
+                                      months + i,
+                                      days   + i,
+                                      serials[i]);
+                }
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
+        if (verbose) cout << "\nTesting batch 'serialToYmd':" << endl;
+        {
+            bsls::Stopwatch sw;
+
+            sw.start(true);
+            for (int j = 0; j < k_NUM_ITERATIONS; ++j) {
+                Util::serialToYmd(years, months, days, serials, k_NUM_DATES);
+            }
+            sw.stop();
+
+            if (verbose)
+                cout << "\tUser time: " << sw.accumulatedUserTime() << endl;
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;